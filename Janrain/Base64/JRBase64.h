@@ -31,11 +31,47 @@
 //
 #import <Foundation/Foundation.h>
 
+/* This header is altered from Nick's original version: the codec below is table driven, with SSSE3 and NEON fast
+   paths where the compiler targets them and a scalar loop everywhere else, and can work directly on caller buffers.
+   The categories are thin wrappers around it. */
+
+typedef NS_ENUM(NSUInteger, JRBase64Options)
+{
+    JRBase64OptionsNone        = 0,
+    JRBase64OptionsURLSafe     = 1 << 0, /* RFC 4648 section 5 alphabet, '-' and '_' in place of '+' and '/' */
+    JRBase64OptionsOmitPadding = 1 << 1, /* No trailing '=' when encoding; decoding never needs it */
+};
+
+/**
+ * Number of characters JRBase64Encode() writes for inputLength bytes. No terminating NUL is counted or written.
+ **/
+size_t JRBase64EncodedLength(size_t inputLength, JRBase64Options options);
+
+/**
+ * Encodes inputLength bytes into output, which must have room for JRBase64EncodedLength() characters, and returns
+ * the number of characters written. Never wraps lines.
+ **/
+size_t JRBase64Encode(const void *input, size_t inputLength, char *output, JRBase64Options options);
+
+/**
+ * An upper bound on the number of bytes JRBase64Decode() writes for inputLength characters.
+ **/
+size_t JRBase64DecodedMaxLength(size_t inputLength);
+
+/**
+ * Decodes inputLength characters into output, which must have room for JRBase64DecodedMaxLength() bytes, and returns
+ * the number of bytes written. Like the categories, it skips anything outside the alphabet (line breaks, padding,
+ * stray whitespace) rather than failing, and drops a trailing partial group of a single character.
+ **/
+size_t JRBase64Decode(const char *input, size_t inputLength, void *output, JRBase64Options options);
+
 @interface NSData (JRBase64)
 
 + (NSData *)dataWithJRBase64EncodedString:(NSString *)string;
++ (NSData *)dataWithJRBase64URLEncodedString:(NSString *)string;
 - (NSString *)JRBase64EncodedStringWithWrapWidth:(NSUInteger)wrapWidth;
 - (NSString *)JRBase64EncodedString;
+- (NSString *)JRBase64URLEncodedString;
 
 @end
 
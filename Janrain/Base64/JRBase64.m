@@ -30,126 +30,425 @@
 //  3. This notice may not be removed or altered from any source distribution.
 //
 
+
 // This source is altered from Nick's original version. See JRBase64.h for descriptions.
 
 #import "JRBase64.h"
 
-@implementation NSData (JRBase64)
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define JR_BASE64_SSSE3 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define JR_BASE64_NEON 1
+#endif
 
-+ (NSData *)dataWithJRBase64EncodedString:(NSString *)string
+static const char JRBase64StandardAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char JRBase64URLSafeAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+#define JRBase64Invalid 0xFF
+
+static const uint8_t JRBase64StandardDecodeTable[256] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static const uint8_t JRBase64URLSafeDecodeTable[256] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+#if JR_BASE64_SSSE3
+
+/* Wojciech Muła's SSSE3 algorithms: 12 bytes are spread over the four 32 bit lanes, split into 6 bit indices with
+   two multiplies, and mapped to ASCII by adding a per-range offset looked up with pshufb. Decoding classifies each
+   character by range, and gives up on the block (leaving it to the scalar loop) as soon as anything is outside the
+   alphabet. */
+
+static size_t JRBase64EncodeVector(const uint8_t *input, size_t inputLength, char *output, BOOL urlSafe)
 {
-    const unsigned char lookup[] =
+    const __m128i spread = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          (urlSafe ? '-' : '+') - 62, (urlSafe ? '_' : '/') - 63, 'A', 0, 0);
+    size_t consumed = 0;
+
+    /* Each load reads 16 bytes to use 12 of them */
+    while (inputLength - consumed >= 16)
     {
-        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 
-        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 
-        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 62, 99, 99, 99, 63, 
-        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 99, 99, 99, 99, 99, 99, 
-        99,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 
-        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 99, 99, 99, 99, 99, 
-        99, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 
-        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 99, 99, 99, 99, 99
-    };
-    
-    NSData *inputData = [string dataUsingEncoding:NSASCIIStringEncoding allowLossyConversion:YES];
-    NSUInteger inputLength = [inputData length];
-    const unsigned char *inputBytes = [inputData bytes];
-    
-    NSUInteger maxOutputLength = (inputLength / 4 + 1) * 3;
-    NSMutableData *outputData = [NSMutableData dataWithLength:maxOutputLength];
-    unsigned char *outputBytes = (unsigned char *)[outputData mutableBytes];
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (input + consumed)), spread);
 
-    int accumulator = 0;
-    NSUInteger outputLength = 0;
-    unsigned char accumulated[] = {0, 0, 0, 0};
-    for (long long i = 0; i < inputLength; i++)
+        __m128i ac = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        __m128i bd = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(ac, bd);
+
+        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+
+        _mm_storeu_si128((__m128i *) output, _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range)));
+
+        output += 16;
+        consumed += 12;
+    }
+
+    return consumed;
+}
+
+static inline __m128i JRBase64InRange(__m128i in, char first, char last)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8(first - 1)), _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), in));
+}
+
+static size_t JRBase64DecodeVector(const uint8_t *input, size_t inputLength, uint8_t *output, BOOL urlSafe)
+{
+    const char c62 = urlSafe ? '-' : '+';
+    const char c63 = urlSafe ? '_' : '/';
+    size_t consumed = 0;
+
+    /* Each store writes 16 bytes to produce 12; keeping 8 characters back guarantees the extra 4 land inside a
+       buffer of JRBase64DecodedMaxLength() */
+    while (inputLength - consumed >= 24)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i *) (input + consumed));
+
+        __m128i upper = JRBase64InRange(in, 'A', 'Z');
+        __m128i lower = JRBase64InRange(in, 'a', 'z');
+        __m128i digit = JRBase64InRange(in, '0', '9');
+        __m128i is62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c62));
+        __m128i is63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c63));
+
+        __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+        if (_mm_movemask_epi8(valid) != 0xFFFF) break;
+
+        __m128i shift = _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                                     _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+        shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+        shift = _mm_or_si128(shift, _mm_and_si128(is62, _mm_set1_epi8(62 - c62)));
+        shift = _mm_or_si128(shift, _mm_and_si128(is63, _mm_set1_epi8(63 - c63)));
+        __m128i values = _mm_add_epi8(in, shift);
+
+        __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        __m128i bytes = _mm_shuffle_epi8(words, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm_storeu_si128((__m128i *) output, bytes);
+
+        output += 12;
+        consumed += 16;
+    }
+
+    return consumed;
+}
+
+#elif JR_BASE64_NEON
+
+/* AArch64 only, since 32 bit NEON has no 64 entry table lookup. vld3/vst4 do the (de)interleaving, so 48 bytes
+   become four vectors of 6 bit indices and go through the alphabet with a single tbl each. Decoding runs the same
+   in reverse against the first 128 entries of the decode table; anything that maps above 63 ends the fast path. */
+
+static inline uint8x16x4_t JRBase64LoadTable(const uint8_t *table)
+{
+    uint8x16x4_t result;
+    result.val[0] = vld1q_u8(table);
+    result.val[1] = vld1q_u8(table + 16);
+    result.val[2] = vld1q_u8(table + 32);
+    result.val[3] = vld1q_u8(table + 48);
+    return result;
+}
+
+static size_t JRBase64EncodeVector(const uint8_t *input, size_t inputLength, char *output, BOOL urlSafe)
+{
+    const uint8x16x4_t alphabet =
+            JRBase64LoadTable((const uint8_t *) (urlSafe ? JRBase64URLSafeAlphabet : JRBase64StandardAlphabet));
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+    size_t consumed = 0;
+
+    while (inputLength - consumed >= 48)
+    {
+        uint8x16x3_t in = vld3q_u8(input + consumed);
+        uint8x16x4_t out;
+
+        out.val[0] = vshrq_n_u8(in.val[0], 2);
+        out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        out.val[3] = vandq_u8(in.val[2], mask);
+
+        out.val[0] = vqtbl4q_u8(alphabet, out.val[0]);
+        out.val[1] = vqtbl4q_u8(alphabet, out.val[1]);
+        out.val[2] = vqtbl4q_u8(alphabet, out.val[2]);
+        out.val[3] = vqtbl4q_u8(alphabet, out.val[3]);
+
+        vst4q_u8((uint8_t *) output, out);
+
+        output += 64;
+        consumed += 48;
+    }
+
+    return consumed;
+}
+
+static size_t JRBase64DecodeVector(const uint8_t *input, size_t inputLength, uint8_t *output, BOOL urlSafe)
+{
+    const uint8_t *table = urlSafe ? JRBase64URLSafeDecodeTable : JRBase64StandardDecodeTable;
+    const uint8x16x4_t low = JRBase64LoadTable(table);
+    const uint8x16x4_t high = JRBase64LoadTable(table + 64);
+    const uint8x16_t highBit = vdupq_n_u8(0x80);
+    const uint8x16_t sixtyFour = vdupq_n_u8(64);
+    size_t consumed = 0;
+
+    while (inputLength - consumed >= 64)
     {
-        unsigned char decoded = lookup[inputBytes[i] & 0x7F];
-        if (decoded != 99)
+        uint8x16x4_t in = vld4q_u8(input + consumed);
+        uint8x16_t check = vdupq_n_u8(0);
+
+        for (int i = 0; i < 4; i++)
         {
-            accumulated[accumulator] = decoded;
-            if (accumulator == 3)
-            {
-                outputBytes[outputLength++] = (accumulated[0] << 2) | (accumulated[1] >> 4);  
-                outputBytes[outputLength++] = (accumulated[1] << 4) | (accumulated[2] >> 2);  
-                outputBytes[outputLength++] = (accumulated[2] << 6) | accumulated[3];
-            }
-            accumulator = (accumulator + 1) % 4;
+            /* Out of range indices come back as 0 from tbl, so exactly one of the two lookups can hit; characters
+               above 127 miss both and are caught by their high bit instead */
+            uint8x16_t value = vorrq_u8(vqtbl4q_u8(low, in.val[i]), vqtbl4q_u8(high, vsubq_u8(in.val[i], sixtyFour)));
+            check = vorrq_u8(check, vorrq_u8(value, vandq_u8(in.val[i], highBit)));
+            in.val[i] = value;
         }
+
+        if (vmaxvq_u8(check) > 63) break;
+
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+
+        vst3q_u8(output, out);
+
+        output += 48;
+        consumed += 64;
     }
-    
-    //handle left-over data
-    if (accumulator > 0) outputBytes[outputLength] = (accumulated[0] << 2) | (accumulated[1] >> 4);
-    if (accumulator > 1) outputBytes[++outputLength] = (accumulated[1] << 4) | (accumulated[2] >> 2);
-    if (accumulator > 2) outputLength++;
-    
-    //truncate data to match actual output length
-    outputData.length = outputLength;
-    return outputLength? outputData: nil;
+
+    return consumed;
 }
 
-- (NSString *)JRBase64EncodedStringWithWrapWidth:(NSUInteger)wrapWidth
+#else
+
+static size_t JRBase64EncodeVector(const uint8_t *input, size_t inputLength, char *output, BOOL urlSafe)
 {
-    //ensure wrapWidth is a multiple of 4
-    wrapWidth = (wrapWidth / 4) * 4;
-    
-    unsigned char *lookup = (unsigned char *) "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    
-    NSUInteger inputLength = [self length];
-    const unsigned char *inputBytes = [self bytes];
-    
-    NSUInteger maxOutputLength = (inputLength / 3 + 1) * 4;
-    maxOutputLength += wrapWidth? (maxOutputLength / wrapWidth) * 2: 0;
-    unsigned char *outputBytes = (unsigned char *)malloc(maxOutputLength);
-    
-    long long i;
-    NSUInteger outputLength = 0;
-    for (i = 0; i < inputLength - 2; i += 3)
+    return 0;
+}
+
+static size_t JRBase64DecodeVector(const uint8_t *input, size_t inputLength, uint8_t *output, BOOL urlSafe)
+{
+    return 0;
+}
+
+#endif
+
+size_t JRBase64EncodedLength(size_t inputLength, JRBase64Options options)
+{
+    if (options & JRBase64OptionsOmitPadding)
+        return (inputLength / 3) * 4 + (inputLength % 3 ? inputLength % 3 + 1 : 0);
+
+    return ((inputLength + 2) / 3) * 4;
+}
+
+size_t JRBase64Encode(const void *input, size_t inputLength, char *output, JRBase64Options options)
+{
+    BOOL urlSafe = (options & JRBase64OptionsURLSafe) != 0;
+    const char *lookup = urlSafe ? JRBase64URLSafeAlphabet : JRBase64StandardAlphabet;
+    const uint8_t *inputBytes = input;
+    char *outputBytes = output;
+
+    size_t i = JRBase64EncodeVector(inputBytes, inputLength, outputBytes, urlSafe);
+    outputBytes += (i / 3) * 4;
+
+    for (; inputLength - i >= 3; i += 3)
+    {
+        uint32_t triple = ((uint32_t) inputBytes[i] << 16) | ((uint32_t) inputBytes[i + 1] << 8) | inputBytes[i + 2];
+
+        *outputBytes++ = lookup[(triple >> 18) & 0x3F];
+        *outputBytes++ = lookup[(triple >> 12) & 0x3F];
+        *outputBytes++ = lookup[(triple >> 6) & 0x3F];
+        *outputBytes++ = lookup[triple & 0x3F];
+    }
+
+    //handle left-over data
+    if (inputLength - i == 2)
     {
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0xFC) >> 2];
-        outputBytes[outputLength++] = lookup[((inputBytes[i] & 0x03) << 4) | ((inputBytes[i + 1] & 0xF0) >> 4)];
-        outputBytes[outputLength++] = lookup[((inputBytes[i + 1] & 0x0F) << 2) | ((inputBytes[i + 2] & 0xC0) >> 6)];
-        outputBytes[outputLength++] = lookup[inputBytes[i + 2] & 0x3F];
-        
-        //add line break
-        if (wrapWidth && (outputLength + 2) % (wrapWidth + 2) == 0)
+        *outputBytes++ = lookup[inputBytes[i] >> 2];
+        *outputBytes++ = lookup[((inputBytes[i] & 0x03) << 4) | (inputBytes[i + 1] >> 4)];
+        *outputBytes++ = lookup[(inputBytes[i + 1] & 0x0F) << 2];
+        if (!(options & JRBase64OptionsOmitPadding)) *outputBytes++ = '=';
+    }
+    else if (inputLength - i == 1)
+    {
+        *outputBytes++ = lookup[inputBytes[i] >> 2];
+        *outputBytes++ = lookup[(inputBytes[i] & 0x03) << 4];
+        if (!(options & JRBase64OptionsOmitPadding))
         {
-            outputBytes[outputLength++] = '\r';
-            outputBytes[outputLength++] = '\n';
+            *outputBytes++ = '=';
+            *outputBytes++ = '=';
         }
     }
-    
-    //handle left-over data
-    if (i == inputLength - 2)
+
+    return (size_t) (outputBytes - output);
+}
+
+size_t JRBase64DecodedMaxLength(size_t inputLength)
+{
+    return ((inputLength + 3) / 4) * 3;
+}
+
+size_t JRBase64Decode(const char *input, size_t inputLength, void *output, JRBase64Options options)
+{
+    BOOL urlSafe = (options & JRBase64OptionsURLSafe) != 0;
+    const uint8_t *lookup = urlSafe ? JRBase64URLSafeDecodeTable : JRBase64StandardDecodeTable;
+    const uint8_t *inputBytes = (const uint8_t *) input;
+    uint8_t *outputBytes = output;
+
+    size_t outputLength = 0;
+    uint32_t accumulated = 0;
+    int accumulator = 0;
+    BOOL tryVector = YES;
+
+    for (size_t i = 0; i < inputLength;)
     {
-        // = terminator
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0xFC) >> 2];
-        outputBytes[outputLength++] = lookup[((inputBytes[i] & 0x03) << 4) | ((inputBytes[i + 1] & 0xF0) >> 4)];
-        outputBytes[outputLength++] = lookup[(inputBytes[i + 1] & 0x0F) << 2];
-        outputBytes[outputLength++] =   '=';
+        /* The fast path only takes whole, clean blocks, so it is tried at the start and again after anything that
+           had to be skipped, e.g. at the start of each line of wrapped input */
+        if (tryVector && accumulator == 0)
+        {
+            size_t consumed = JRBase64DecodeVector(inputBytes + i, inputLength - i, outputBytes + outputLength,
+                                                   urlSafe);
+            i += consumed;
+            outputLength += (consumed / 4) * 3;
+            tryVector = NO;
+            continue;
+        }
+
+        uint8_t decoded = lookup[inputBytes[i++]];
+        if (decoded == JRBase64Invalid)
+        {
+            tryVector = YES;
+            continue;
+        }
+
+        accumulated = (accumulated << 6) | decoded;
+        if (++accumulator == 4)
+        {
+            outputBytes[outputLength++] = (uint8_t) (accumulated >> 16);
+            outputBytes[outputLength++] = (uint8_t) (accumulated >> 8);
+            outputBytes[outputLength++] = (uint8_t) accumulated;
+            accumulated = 0;
+            accumulator = 0;
+        }
     }
-    else if (i == inputLength - 1)
+
+    //handle left-over data
+    if (accumulator == 2)
     {
-        // == terminator
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0xFC) >> 2];
-        outputBytes[outputLength++] = lookup[(inputBytes[i] & 0x03) << 4];
-        outputBytes[outputLength++] = '=';
-        outputBytes[outputLength++] = '=';
+        outputBytes[outputLength++] = (uint8_t) (accumulated >> 4);
     }
-    
-    if (outputLength >= 4)
+    else if (accumulator == 3)
     {
-        //truncate data to match actual output length
-        outputBytes = realloc(outputBytes, outputLength);
-        return [[NSString alloc] initWithBytesNoCopy:outputBytes
-                                               length:outputLength
-                                             encoding:NSASCIIStringEncoding
-                                         freeWhenDone:YES];
+        outputBytes[outputLength++] = (uint8_t) (accumulated >> 10);
+        outputBytes[outputLength++] = (uint8_t) (accumulated >> 2);
     }
-    else if (outputBytes)
+
+    return outputLength;
+}
+
+static NSData *JRBase64DecodeString(NSString *string, JRBase64Options options)
+{
+    /* Anything outside ASCII is outside the alphabet too, so the UTF-8 bytes can be decoded as they are */
+    const char *inputBytes = [string UTF8String];
+    size_t inputLength = inputBytes ? [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding] : 0;
+
+    NSMutableData *outputData = [NSMutableData dataWithLength:JRBase64DecodedMaxLength(inputLength)];
+    size_t outputLength = JRBase64Decode(inputBytes, inputLength, [outputData mutableBytes], options);
+
+    //truncate data to match actual output length
+    outputData.length = outputLength;
+    return outputLength ? outputData : nil;
+}
+
+static NSString *JRBase64EncodeData(NSData *data, NSUInteger wrapWidth, JRBase64Options options)
+{
+    //ensure wrapWidth is a multiple of 4
+    wrapWidth = (wrapWidth / 4) * 4;
+
+    size_t inputLength = [data length];
+    const uint8_t *inputBytes = [data bytes];
+    if (!inputLength) return nil;
+
+    /* Lines are only broken after whole groups, and a line that ends exactly at the end of the whole groups still
+       gets its line break, as it always has */
+    size_t wholeGroupsLength = inputLength - inputLength % 3;
+    size_t lineBytes = wrapWidth ? (wrapWidth / 4) * 3 : wholeGroupsLength;
+    size_t lineBreaks = wrapWidth ? wholeGroupsLength / lineBytes : 0;
+
+    size_t maxOutputLength = JRBase64EncodedLength(inputLength, options) + lineBreaks * 2;
+    char *outputBytes = malloc(maxOutputLength);
+    if (!outputBytes) return nil;
+
+    size_t outputLength = 0;
+    size_t i = 0;
+    for (; wrapWidth && wholeGroupsLength - i >= lineBytes; i += lineBytes)
     {
-        free(outputBytes);
+        outputLength += JRBase64Encode(inputBytes + i, lineBytes, outputBytes + outputLength, options);
+        outputBytes[outputLength++] = '\r';
+        outputBytes[outputLength++] = '\n';
     }
-    return nil;
+
+    outputLength += JRBase64Encode(inputBytes + i, inputLength - i, outputBytes + outputLength, options);
+
+    return [[NSString alloc] initWithBytesNoCopy:outputBytes
+                                          length:outputLength
+                                        encoding:NSASCIIStringEncoding
+                                    freeWhenDone:YES];
+}
+
+@implementation NSData (JRBase64)
+
++ (NSData *)dataWithJRBase64EncodedString:(NSString *)string
+{
+    return JRBase64DecodeString(string, JRBase64OptionsNone);
+}
+
++ (NSData *)dataWithJRBase64URLEncodedString:(NSString *)string
+{
+    return JRBase64DecodeString(string, JRBase64OptionsURLSafe);
+}
+
+- (NSString *)JRBase64EncodedStringWithWrapWidth:(NSUInteger)wrapWidth
+{
+    return JRBase64EncodeData(self, wrapWidth, JRBase64OptionsNone);
 }
 
 - (NSString *)JRBase64EncodedString
@@ -157,6 +456,11 @@
     return [self JRBase64EncodedStringWithWrapWidth:0];
 }
 
+- (NSString *)JRBase64URLEncodedString
+{
+    return JRBase64EncodeData(self, 0, JRBase64OptionsURLSafe | JRBase64OptionsOmitPadding);
+}
+
 @end
 
 
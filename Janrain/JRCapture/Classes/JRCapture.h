@@ -410,6 +410,18 @@ FOUNDATION_EXPORT NSString* const JRDownloadFlowResult;
  */
 + (void)setCaptureConfig:(JRCaptureConfig *)config;
 
+/**
+ * Calls back once the work started by setCaptureConfig: has finished: restoring the saved tokens, loading or
+ * downloading the flow, and loading the Engage configuration. These run concurrently, and sign-in, registration and
+ * profile calls made before they finish wait only for the ones they need, so apps don't need to call this first.
+ *
+ * @param completion
+ *   Called on the main thread. finished is NO if startup hadn't finished after 30 seconds. taskTimings maps each
+ *   task name to a dictionary with its "start" time and "duration", in seconds; taskErrors maps the names of
+ *   tasks that failed to their errors.
+ */
++ (void)whenStartupFinishes:(void (^)(BOOL finished, NSDictionary *taskTimings, NSDictionary *taskErrors))completion;
+
 /**
  * Set the Engage app id, this will force Engage to reload it's configuration data
  * @param engageAppId
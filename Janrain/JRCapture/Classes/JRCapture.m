@@ -45,17 +45,27 @@
 #import "JRCaptureError.h"
 #import "JRCaptureUser+Extras.h"
 #import "JRConnectionManager.h"
+#import "JRRequestBodyEncoder.h"
+#import "JRRetryPolicy.h"
 #import "JRCaptureConfig.h"
 #import "NSMutableDictionary+JRDictionaryUtils.h"
 #import "JRCaptureUIRequestBuilder.h"
 #import "JRCaptureFlow.h"
+#import "JRCaptureFormValidator.h"
 #import "JRJsonUtils.h"
 #import "NSMutableURLRequest+JRRequestUtils.h"
 #import "JREngage.h"
+#import "JRTracer.h"
+#import "JRStartupTaskGraph.h"
 
 
 NSString* const JRDownloadFlowResult = @"JRDownloadFlowResult";
 
+/* How long an API call waits on the startup work it depends on before going ahead with what it has */
+#define STARTUP_PREREQUISITE_TIMEOUT 10.0
+#define ENGAGE_CONFIGURATION_TIMEOUT 30.0
+#define STARTUP_TIMEOUT 30.0
+
 @implementation JRCapture
 
 
@@ -71,13 +81,82 @@ static id ObjectOrNull(id object)
 
 + (void)setCaptureConfig:(JRCaptureConfig *)config
 {
+    if (config.enablePreconnect) [JRConnectionManager setPreconnectEnabled:YES];
+    [JRRequestBodyEncoder sharedEncoder].compressionEnabled = config.compressRequestBodies;
+    [JRRequestBodyEncoder sharedEncoder].jsonBodiesEnabled = config.jsonRequestBodies;
     [JRCaptureData setCaptureConfig:config];
-    if (config.engageAppId.length > 0){
-        [JREngageWrapper configureEngageWithAppId:config.engageAppId engageAppUrl:config.engageAppUrl customIdentityProviders:config.customProviders];
-    }else{
-        [JREngageWrapper configureEngageWithOutAppId:config.customProviders engageAppUrl:config.engageAppUrl];
-        
-    }
+    [JRConnectionManager preconnectToUrl:[JRCaptureData sharedCaptureData].captureBaseUrl];
+
+    JRStartupTaskGraph *startupTasks = [JRCaptureData sharedCaptureData].startupTasks;
+    [startupTasks addTaskNamed:JRStartupTaskEngageConfiguration dependencies:nil
+                         start:^(JRStartupTaskFinish finish) {
+        [self finishOnEngageConfiguration:finish];
+        if (config.engageAppId.length > 0){
+            [JREngageWrapper configureEngageWithAppId:config.engageAppId engageAppUrl:config.engageAppUrl customIdentityProviders:config.customProviders];
+        }else{
+            [JREngageWrapper configureEngageWithOutAppId:config.customProviders engageAppUrl:config.engageAppUrl];
+        }
+    }];
+}
+
+/**
+ * Finishes the Engage configuration startup task on whichever notification JRSessionData posts first. Observing
+ * starts before Engage is configured because the configuration bundled with the app is applied synchronously. The
+ * timeout covers downloads that end without a notification, e.g. when the update is deferred behind a dialog.
+ */
++ (void)finishOnEngageConfiguration:(JRStartupTaskFinish)finish
+{
+    NSNotificationCenter *center = [NSNotificationCenter defaultCenter];
+    __block id finishedObserver = nil;
+    __block id failedObserver = nil;
+    void (^finishOnce)(NSError *) = ^(NSError *error) {
+        if (!finishedObserver) return;
+        [center removeObserver:finishedObserver];
+        [center removeObserver:failedObserver];
+        finishedObserver = failedObserver = nil;
+        finish(error);
+    };
+
+    finishedObserver = [center addObserverForName:JRFinishedUpdatingEngageConfigurationNotification object:nil
+                                            queue:nil usingBlock:^(NSNotification *note) {
+        finishOnce(nil);
+    }];
+    failedObserver = [center addObserverForName:JRFailedToUpdateEngageConfigurationNotification object:nil
+                                          queue:nil usingBlock:^(NSNotification *note) {
+        finishOnce([[note userInfo] objectForKey:@"error"]);
+    }];
+
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (ENGAGE_CONFIGURATION_TIMEOUT * NSEC_PER_SEC)),
+            dispatch_get_main_queue(), ^{
+        finishOnce([JRCaptureError errorWithErrorString:@"engage_configuration_timeout"
+                                                   code:JRCaptureLocalErrorGeneric
+                                            description:@"Timed out waiting for the Engage configuration"
+                                            extraFields:nil]);
+    });
+}
+
+/**
+ * Runs the block once the named startup tasks have finished - at once, in the common case - so calls made right
+ * after configuration see the restored tokens and the flow rather than racing them. If they're still running after
+ * STARTUP_PREREQUISITE_TIMEOUT the block runs anyway, and the call fails the way it would have without them.
+ * Tasks that were never added aren't waited for: the flow tasks are only added when the configuration has a locale,
+ * flow name and app id, and none are added before setCaptureConfig:, so those calls run at once and fail as before.
+ */
++ (void)afterStartupTasks:(NSArray *)taskNames perform:(void (^)(void))block
+{
+    JRStartupTaskGraph *startupTasks = [JRCaptureData sharedCaptureData].startupTasks;
+    [startupTasks waitForTasks:taskNames timeout:STARTUP_PREREQUISITE_TIMEOUT completion:^(BOOL finished) {
+        if (!finished) ALog(@"Startup tasks %@ still running, continuing without them", taskNames);
+        block();
+    }];
+}
+
++ (void)whenStartupFinishes:(void (^)(BOOL finished, NSDictionary *taskTimings, NSDictionary *taskErrors))completion
+{
+    JRStartupTaskGraph *startupTasks = [JRCaptureData sharedCaptureData].startupTasks;
+    [startupTasks waitForAllTasksWithTimeout:STARTUP_TIMEOUT completion:^(BOOL finished) {
+        completion(finished, [startupTasks taskTimings], [startupTasks taskErrors]);
+    }];
 }
 
 /**
@@ -105,6 +184,7 @@ static id ObjectOrNull(id object)
  */
 + (void)setCaptureDomain:(NSString *)captureDomain {
     [JRCaptureData setCaptureBaseUrl:captureDomain];
+    [JRConnectionManager preconnectToUrl:[JRCaptureData sharedCaptureData].captureBaseUrl];
 }
 
 + (void)setEngageAppId:(NSString *)engageAppId
@@ -379,12 +459,14 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                     withCustomInterfaceOverrides:(NSDictionary *)customInterfaceOverrides
                                      forDelegate:(id <JRCaptureDelegate>)delegate
 {
-    [JREngageWrapper startAuthenticationWithProviderToken:provider
-                                                withToken:token
-                                           andTokenSecret:tokenSecret
-                             withCustomInterfaceOverrides:customInterfaceOverrides
-                                               mergeToken:mergeToken
-                                              forDelegate:delegate];
+    [self afterStartupTasks:@[JRStartupTaskTokens, JRStartupTaskFlow] perform:^{
+        [JREngageWrapper startAuthenticationWithProviderToken:provider
+                                                    withToken:token
+                                               andTokenSecret:tokenSecret
+                                 withCustomInterfaceOverrides:customInterfaceOverrides
+                                                   mergeToken:mergeToken
+                                                  forDelegate:delegate];
+    }];
 }
 
 + (void)startEngageSignInWithNativeProviderToken:(NSString *)provider
@@ -395,13 +477,15 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                     withCustomInterfaceOverrides:(NSDictionary *)customInterfaceOverrides
                                      forDelegate:(id <JRCaptureDelegate>)delegate
 {
-    [JREngageWrapper startAuthenticationWithProviderToken:provider
-                                                withToken:token
-                                           andTokenSecret:tokenSecret
-                             withCustomInterfaceOverrides:customInterfaceOverrides
-                                               mergeToken:mergeToken
-                                             engageAppUrl:engageAppUrl
-                                              forDelegate:delegate];
+    [self afterStartupTasks:@[JRStartupTaskTokens, JRStartupTaskFlow] perform:^{
+        [JREngageWrapper startAuthenticationWithProviderToken:provider
+                                                    withToken:token
+                                               andTokenSecret:tokenSecret
+                                 withCustomInterfaceOverrides:customInterfaceOverrides
+                                                   mergeToken:mergeToken
+                                                 engageAppUrl:engageAppUrl
+                                                  forDelegate:delegate];
+    }];
 }
 
 + (void)startCaptureTraditionalSignInForUser:(NSString *)user withPassword:(NSString *)password
@@ -421,26 +505,34 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         return;
     }
 
-    NSMutableDictionary *params = [@{@"user" : user, @"password" : password} mutableCopy];
-    [params JR_maybeSetObject:mergeToken forKey:@"merge_token"];
-
-    NSString *secret = [JRCaptureData generateAndStoreRefreshSecret];
-    NSDictionary *tradAuthParams = [JRCaptureApidInterface tradAuthParamsWithParams:params refreshSecret:secret
-                                                                           delegate:delegate];
-    NSString *tradAuthUrl = [[[JRCaptureData requestWithPath:kJRTradAuthUrlPath] URL] absoluteString];
-
-    [JRConnectionManager jsonRequestToUrl:tradAuthUrl params:tradAuthParams
-                        completionHandler:^(id json, NSError *error) {
-                            [self signInHandler:json error:error delegate:delegate];
-                        }];
+    [[JRTracer sharedTracer] startTraceWithName:@"signin.traditional"];
+    [self afterStartupTasks:@[JRStartupTaskTokens, JRStartupTaskFlow] perform:^{
+        NSMutableDictionary *params = [@{@"user" : user, @"password" : password} mutableCopy];
+        [params JR_maybeSetObject:mergeToken forKey:@"merge_token"];
+
+        NSString *secret = [JRCaptureData generateRefreshSecret];
+        NSDictionary *tradAuthParams = [JRCaptureApidInterface tradAuthParamsWithParams:params refreshSecret:secret
+                                                                               delegate:delegate];
+        NSURL *tradAuthUrl = [[JRCaptureData requestWithPath:kJRTradAuthUrlPath] URL];
+        NSMutableURLRequest *request = [NSMutableURLRequest JR_requestWithURL:tradAuthUrl params:tradAuthParams];
+        [request JR_setOperationName:@"signin"];
+
+        [JRConnectionManager startURLConnectionWithRequest:request retryPolicy:[JRRetryPolicy defaultPolicy]
+                                                  priority:JRConnectionPriorityCritical
+                                         completionHandler:^(id json, NSError *error) {
+                                             [self signInHandler:json error:error delegate:delegate];
+                                         }];
+    }];
 }
 
 + (void)signInHandler:(id)json error:(NSError *)error delegate:(id <JRCaptureDelegate>)delegate
 {
+    JRTracer *tracer = [JRTracer sharedTracer];
     if (error || ![json isKindOfClass:[NSDictionary class]] || ![[json objectForKey:@"stat"] isEqual:@"ok"]) {
         if (!error) {
             error = [JRCaptureError errorFromResult:json onProvider:nil engageToken:nil];
         }
+        [tracer endTraceWithStatus:@"failed"];
         if ([delegate respondsToSelector:@selector(captureSignInDidFailWithError:)]){
             [delegate captureSignInDidFailWithError:error];
         }
@@ -451,9 +543,12 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
     NSString *authorizationCode = [json objectForKey:@"authorization_code"];
     BOOL isNew = [(NSNumber *) [json objectForKey:@"is_new"] boolValue];
     NSDictionary *captureUserJson = [json objectForKey:@"capture_user"];
+    JRTraceSpan *span = [tracer startSpanWithName:@"capture.build_user"];
     JRCaptureUser *captureUser = [JRCaptureUser captureUserObjectFromDictionary:captureUserJson];
+    [span end];
 
     if (!captureUserJson || !captureUser || !accessToken) {
+        [tracer endTraceWithStatus:@"invalid_response"];
         JRCaptureError *captureError = [JRCaptureError invalidApiResponseErrorWithString:json];
         if ([delegate respondsToSelector:@selector(captureSignInDidFailWithError:)]){
             [delegate captureSignInDidFailWithError:captureError];
@@ -467,6 +562,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
     [UIApplication sharedApplication].networkActivityIndicatorVisible = NO;
 
     JRCaptureRecordStatus recordStatus = isNew ? JRCaptureRecordNewlyCreated : JRCaptureRecordExists;
+    [tracer endTraceWithStatus:@"ok"];
     // XXX maybeDispatch inlined here because the second arg is actually an enum and logging it as an object will
     // seg fault, so the log statement is one-off modified here
     DLog(@"Dispatching %@ with %@, %i", NSStringFromSelector(@selector(captureSignInDidSucceedForUser:status:)),
@@ -489,106 +585,114 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
 + (void)refreshAccessTokenForDelegate:(id <JRCaptureDelegate>)delegate context:(id <NSObject>)context
 {
-    NSString *date = [self utcTimeString];
-    NSString *accessToken = [JRCaptureData sharedCaptureData].accessToken;
-    NSString *refreshSecret = [JRCaptureData sharedCaptureData].refreshSecret;
-    NSString *domain = [JRCaptureData sharedCaptureData].captureBaseUrl;
-    NSString *refreshUrl = [NSString stringWithFormat:@"%@/oauth/refresh_access_token", domain];
-    NSString *signature = [self base64SignatureForRefreshWithDate:date refreshSecret:refreshSecret
-                                                      accessToken:accessToken];
-    if (!signature || !accessToken || !date)
-    {
-        if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
-            [delegate refreshAccessTokenDidFailWithError:
-                    [JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate signature"]
-                                                 context:context];
-        }
-        return;
-    }
-
-    NSDictionary *params = @{
-            @"access_token" : accessToken,
-            @"signature" : signature,
-            @"date" : date,
-
-            @"client_id" : [JRCaptureData sharedCaptureData].clientId,
-            @"locale" : [JRCaptureData sharedCaptureData].captureLocale,
-            @"flow" : [JRCaptureData sharedCaptureData].captureFlowName,
-            @"flow_version" : [JRCaptureData sharedCaptureData].downloadedFlowVersion
-    };
-
-    [JRConnectionManager jsonRequestToUrl:refreshUrl params:params completionHandler:^(id r, NSError *e)
-    {
-        if (e)
+    [self afterStartupTasks:@[JRStartupTaskTokens] perform:^{
+        NSString *date = [self utcTimeString];
+        NSString *accessToken = [JRCaptureData sharedCaptureData].accessToken;
+        NSString *refreshSecret = [JRCaptureData sharedCaptureData].refreshSecret;
+        NSString *domain = [JRCaptureData sharedCaptureData].captureBaseUrl;
+        NSString *refreshUrl = [NSString stringWithFormat:@"%@/oauth/refresh_access_token", domain];
+        NSString *signature = [self base64SignatureForRefreshWithDate:date refreshSecret:refreshSecret
+                                                          accessToken:accessToken];
+        if (!signature || !accessToken || !date)
         {
-            ALog(@"Failure refreshing access token: %@", e);
             if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
-                [delegate refreshAccessTokenDidFailWithError:e context:context];
+                [delegate refreshAccessTokenDidFailWithError:
+                        [JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate signature"]
+                                                     context:context];
             }
             return;
         }
 
-        if ([@"ok" isEqual:[r objectForKey:@"stat"]])
+        NSDictionary *params = @{
+                @"access_token" : accessToken,
+                @"signature" : signature,
+                @"date" : date,
+
+                @"client_id" : [JRCaptureData sharedCaptureData].clientId,
+                @"locale" : [JRCaptureData sharedCaptureData].captureLocale,
+                @"flow" : [JRCaptureData sharedCaptureData].captureFlowName,
+                @"flow_version" : [JRCaptureData sharedCaptureData].downloadedFlowVersion
+        };
+
+        NSMutableURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:refreshUrl]
+                                                                       params:params];
+        [request JR_setOperationName:@"refresh"];
+
+        [JRConnectionManager startURLConnectionWithRequest:request completionHandler:^(id r, NSError *e)
         {
-            [JRCaptureData setAccessToken:[r objectForKey:@"access_token"]];
-            DLog(@"refreshed access token");
-            if ([delegate respondsToSelector:@selector(refreshAccessTokenDidSucceedWithContext:)]){
-                [delegate refreshAccessTokenDidSucceedWithContext:context];
+            if (e)
+            {
+                ALog(@"Failure refreshing access token: %@", e);
+                if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
+                    [delegate refreshAccessTokenDidFailWithError:e context:context];
+                }
+                return;
             }
-        }
-        else
-        {
-            if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
-                [delegate refreshAccessTokenDidFailWithError:
-                        [JRCaptureError errorFromResult:r onProvider:nil engageToken:nil] context:context];
+
+            if ([@"ok" isEqual:[r objectForKey:@"stat"]])
+            {
+                [JRCaptureData setAccessToken:[r objectForKey:@"access_token"]];
+                DLog(@"refreshed access token");
+                if ([delegate respondsToSelector:@selector(refreshAccessTokenDidSucceedWithContext:)]){
+                    [delegate refreshAccessTokenDidSucceedWithContext:context];
+                }
             }
-        }
+            else
+            {
+                if ([delegate respondsToSelector:@selector(refreshAccessTokenDidFailWithError:context:)]){
+                    [delegate refreshAccessTokenDidFailWithError:
+                            [JRCaptureError errorFromResult:r onProvider:nil engageToken:nil] context:context];
+                }
+            }
+        }];
     }];
 }
 
 + (void)startForgottenPasswordRecoveryForField:(NSString *)fieldValue
                                       delegate:(id <JRCaptureDelegate>)delegate {
-    JRCaptureData *data = [JRCaptureData sharedCaptureData];
-    NSString *url = [NSString stringWithFormat:@"%@/oauth/forgot_password_native", data.captureBaseUrl];
-    NSString *fieldName = [data getForgottenPasswordFieldName];
+    [self afterStartupTasks:@[JRStartupTaskFlow] perform:^{
+        JRCaptureData *data = [JRCaptureData sharedCaptureData];
+        NSString *url = [NSString stringWithFormat:@"%@/oauth/forgot_password_native", data.captureBaseUrl];
+        NSString *fieldName = [data getForgottenPasswordFieldName];
  
-    if (!fieldValue) {
-        JRCaptureError *captureError =
-                [JRCaptureError invalidArgumentErrorWithParameterName:@"fieldValue"];
-        if ([delegate respondsToSelector:@selector(forgottenPasswordRecoveryDidFailWithError:)]){
-            [delegate forgottenPasswordRecoveryDidFailWithError:captureError];
+        if (!fieldValue) {
+            JRCaptureError *captureError =
+                    [JRCaptureError invalidArgumentErrorWithParameterName:@"fieldValue"];
+            if ([delegate respondsToSelector:@selector(forgottenPasswordRecoveryDidFailWithError:)]){
+                [delegate forgottenPasswordRecoveryDidFailWithError:captureError];
+            }
+            return;
         }
-        return;
-    }
 
-    if (!data.captureForgottenPasswordFormName) {
-        JRCaptureError *captureError =
-            [JRCaptureError invalidArgumentErrorWithParameterName:@"forgottenPasswordFormName"];
-        if ([delegate respondsToSelector:@selector(forgottenPasswordRecoveryDidFailWithError:)]){
-            [delegate forgottenPasswordRecoveryDidFailWithError:captureError];
+        if (!data.captureForgottenPasswordFormName) {
+            JRCaptureError *captureError =
+                [JRCaptureError invalidArgumentErrorWithParameterName:@"forgottenPasswordFormName"];
+            if ([delegate respondsToSelector:@selector(forgottenPasswordRecoveryDidFailWithError:)]){
+                [delegate forgottenPasswordRecoveryDidFailWithError:captureError];
+            }
+            return;
         }
-        return;
-    }
 
-    NSDictionary *params = @{
-            @"client_id" : data.clientId,
-            @"locale" : data.captureLocale,
-            @"response_type" : @"token",
-            @"redirect_uri" : data.redirectUri,
-            @"form" : data.captureForgottenPasswordFormName,
-            @"flow" : data.captureFlowName,
-            @"flow_version" : data.downloadedFlowVersion,
-            fieldName : fieldValue
-    };
+        NSDictionary *params = @{
+                @"client_id" : data.clientId,
+                @"locale" : data.captureLocale,
+                @"response_type" : @"token",
+                @"redirect_uri" : data.redirectUri,
+                @"form" : data.captureForgottenPasswordFormName,
+                @"flow" : data.captureFlowName,
+                @"flow_version" : data.downloadedFlowVersion,
+                fieldName : fieldValue
+        };
 
-    NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
+        NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
 
-    [self startURLConnectionWithRequest:request
-                               delegate:delegate
-                              onSuccess:@selector(forgottenPasswordRecoveryDidSucceed)
-                              onFailure:@selector(forgottenPasswordRecoveryDidFailWithError:)
-                                message:@"initiating account forgotten password flow"
-                  extraOnSuccessHandler:nil];
+        [self startURLConnectionWithRequest:request
+                                   delegate:delegate
+                                  onSuccess:@selector(forgottenPasswordRecoveryDidSucceed)
+                                  onFailure:@selector(forgottenPasswordRecoveryDidFailWithError:)
+                                    message:@"initiating account forgotten password flow"
+                      extraOnSuccessHandler:nil];
+    }];
 }
 
 + (void)resendVerificationEmail:(NSString *)emailAddress delegate:(id <JRCaptureDelegate>)delegate {
@@ -629,9 +733,21 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                             onFailure:(SEL)failureSelector
                               message:(NSString *)message
                 extraOnSuccessHandler:(void(^)(id parsedResponse))extraOnSuccessHandler {
+    [self startURLConnectionWithRequest:request delegate:delegate onSuccess:successSelector onFailure:failureSelector
+                                message:message extraOnSuccessHandler:extraOnSuccessHandler extraOnFailureHandler:nil];
+}
+
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request
+                             delegate:(id <JRCaptureDelegate>)delegate
+                            onSuccess:(SEL)successSelector
+                            onFailure:(SEL)failureSelector
+                              message:(NSString *)message
+                extraOnSuccessHandler:(void(^)(id parsedResponse))extraOnSuccessHandler
+                extraOnFailureHandler:(void(^)(NSError *error))extraOnFailureHandler {
     void(^handler)(id, NSError *) = ^(id result, NSError *error) {
         if (error) {
             ALog("Failure %@: %@", message, error);
+            if (extraOnFailureHandler) extraOnFailureHandler(error);
             if (failureSelector && [delegate respondsToSelector:failureSelector]){
                 NSMethodSignature *propSignature = [[delegate class] instanceMethodSignatureForSelector:failureSelector];
                 NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
@@ -646,6 +762,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
             }
         } else if (![result isKindOfClass:[NSDictionary class]]) {
             JRCaptureError *captureError = [JRCaptureError invalidApiResponseErrorWithObject:result];
+            if (extraOnFailureHandler) extraOnFailureHandler(captureError);
             if (failureSelector){
                 NSMethodSignature *propSignature = [[delegate class] instanceMethodSignatureForSelector:failureSelector];
                 NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
@@ -674,6 +791,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
             }
         } else {
             JRCaptureError *captureError = [JRCaptureError errorFromResult:result onProvider:nil engageToken:nil];
+            if (extraOnFailureHandler) extraOnFailureHandler(captureError);
             if (failureSelector){
                 NSMethodSignature *propSignature = [[delegate class] instanceMethodSignatureForSelector:failureSelector];
                 NSInvocation *propInvoker = [NSInvocation invocationWithMethodSignature:propSignature];
@@ -750,6 +868,20 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
     return [[[NSData alloc] initWithBytes:cHMAC length:sizeof(cHMAC)] JRBase64EncodedString];
 }
 
+/**
+ * Checks form fields against the flow's client-checkable validation rules before they're posted. Returns the same
+ * error the server would for a failing form, or nil if the server should see the submission.
+ */
++ (JRCaptureError *)localValidationErrorForForm:(NSString *)formName fields:(NSDictionary *)fields
+                                           flow:(JRCaptureFlow *)flow
+{
+    NSDictionary *invalidFields = [[flow validatorForForm:formName] invalidFieldsForFormFields:fields];
+    if (![invalidFields count]) return nil;
+
+    DLog(@"Form %@ failed local validation: %@", formName, invalidFields);
+    return [JRCaptureError formValidationErrorWithInvalidFields:invalidFields];
+}
+
 + (void)registerNewUser:(JRCaptureUser *)newUser socialRegistrationToken:(NSString *)socialRegistrationToken
             forDelegate:(id <JRCaptureDelegate>)delegate
 {
@@ -761,47 +893,64 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         return;
     }
 
-    JRCaptureData *config = [JRCaptureData sharedCaptureData];
-    NSString *registrationForm = socialRegistrationToken ?
-            config.captureSocialRegistrationFormName : config.captureTraditionalRegistrationFormName;
-    NSMutableDictionary *params = [newUser toFormFieldsForForm:registrationForm withFlow:config.captureFlow];
-    NSString *refreshSecret = [JRCaptureData generateAndStoreRefreshSecret];
+    [[JRTracer sharedTracer] startTraceWithName:@"register"];
 
-    if (!refreshSecret)
-    {
-        if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
-            [delegate registerUserDidFailWithError:[JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate secure "
-                    "random refresh secret"]];
+    [self afterStartupTasks:@[JRStartupTaskTokens, JRStartupTaskFlow] perform:^{
+        JRCaptureData *config = [JRCaptureData sharedCaptureData];
+        NSString *registrationForm = socialRegistrationToken ?
+                config.captureSocialRegistrationFormName : config.captureTraditionalRegistrationFormName;
+        NSMutableDictionary *params = [newUser toFormFieldsForForm:registrationForm withFlow:config.captureFlow];
+
+        JRCaptureError *validationError = [self localValidationErrorForForm:registrationForm fields:params
+                                                                       flow:config.captureFlow];
+        if (validationError)
+        {
+            [[JRTracer sharedTracer] endTraceWithStatus:@"invalid_form"];
+            if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
+                [delegate registerUserDidFailWithError:validationError];
+            }
+            return;
         }
-        return;
-    }
 
-    [params addEntriesFromDictionary:@{
-            @"client_id" : config.clientId,
-            @"locale" : config.captureLocale,
-            @"response_type" : [config responseType:delegate],
-            @"redirect_uri" : [config redirectUri],
-            @"flow" : config.captureFlowName,
-            @"form" : registrationForm,
-            @"refresh_secret" : refreshSecret,
-    }];
+        NSString *refreshSecret = [JRCaptureData generateRefreshSecret];
 
-    if ([config downloadedFlowVersion]) [params setObject:[config downloadedFlowVersion] forKey:@"flow_version"];
+        if (!refreshSecret)
+        {
+            if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
+                [delegate registerUserDidFailWithError:[JRCaptureError invalidInternalStateErrorWithDescription:@"unable to generate secure "
+                        "random refresh secret"]];
+            }
+            [[JRTracer sharedTracer] endTraceWithStatus:@"failed"];
+            return;
+        }
 
-    NSString *urlString;
-    if (socialRegistrationToken)
-    {
-        [params setObject:socialRegistrationToken forKey:@"token"];
-        urlString = [NSString stringWithFormat:@"%@/oauth/register_native", config.captureBaseUrl];
-    }
-    else
-    {
-        urlString = [NSString stringWithFormat:@"%@/oauth/register_native_traditional", config.captureBaseUrl];
-    }
+        [params addEntriesFromDictionary:@{
+                @"client_id" : config.clientId,
+                @"locale" : config.captureLocale,
+                @"response_type" : [config responseType:delegate],
+                @"redirect_uri" : [config redirectUri],
+                @"flow" : config.captureFlowName,
+                @"form" : registrationForm,
+                @"refresh_secret" : refreshSecret,
+        }];
 
-    [JRConnectionManager jsonRequestToUrl:urlString params:params completionHandler:^(id parsedResponse, NSError *e)
-    {
-        [self handleRegistrationResponse:parsedResponse orError:e delegate:delegate];
+        if ([config downloadedFlowVersion]) [params setObject:[config downloadedFlowVersion] forKey:@"flow_version"];
+
+        NSString *urlString;
+        if (socialRegistrationToken)
+        {
+            [params setObject:socialRegistrationToken forKey:@"token"];
+            urlString = [NSString stringWithFormat:@"%@/oauth/register_native", config.captureBaseUrl];
+        }
+        else
+        {
+            urlString = [NSString stringWithFormat:@"%@/oauth/register_native_traditional", config.captureBaseUrl];
+        }
+
+        [JRConnectionManager jsonRequestToUrl:urlString params:params completionHandler:^(id parsedResponse, NSError *e)
+        {
+            [self handleRegistrationResponse:parsedResponse orError:e delegate:delegate];
+        }];
     }];
 }
 
@@ -823,6 +972,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
 
     if (e) {
         ALog(@"%@", e);
+        [[JRTracer sharedTracer] endTraceWithStatus:@"failed"];
         if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
             [delegate registerUserDidFailWithError:e];
         }
@@ -838,14 +988,18 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         ) {
             if (!e_) e_ = [JRCaptureError invalidApiResponseErrorWithObject:entityResponse];
             ALog(@"%@", e);
+            [[JRTracer sharedTracer] endTraceWithStatus:@"entity_failed"];
             if ([delegate respondsToSelector:@selector(registerUserDidFailWithError:)]){
                 [delegate registerUserDidFailWithError:e_];
             }
             return;
         }
 
+        JRTraceSpan *span = [[JRTracer sharedTracer] startSpanWithName:@"capture.build_user"];
         JRCaptureUser *newUser =
             [JRCaptureUser captureUserObjectFromDictionary:[entityResponse objectForKey:@"result"]];
+        [span end];
+        [[JRTracer sharedTracer] endTraceWithStatus:@"ok"];
         [self setAccessToken:accessToken];
         NSArray *linkedProfile = [[entityResponse objectForKey:@"result"] valueForKey:@"profiles"];
         [JRCaptureData setLinkedProfiles:linkedProfile];
@@ -861,7 +1015,13 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
     };
 
     NSString *entityUrl = [NSString stringWithFormat:@"%@/entity", [JRCaptureData sharedCaptureData].captureBaseUrl];
-    [JRConnectionManager jsonRequestToUrl:entityUrl params:@{@"access_token" : ObjectOrNull(accessToken)} completionHandler:handler];
+    NSMutableURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:entityUrl]
+                                                                   params:@{@"access_token" : ObjectOrNull(accessToken)}];
+    [request JR_setOperationName:@"entity"];
+
+    /* The entity fetch is a read, so it's safe to retry even though it's a POST */
+    [JRConnectionManager startURLConnectionWithRequest:request retryPolicy:[JRRetryPolicy idempotentPostPolicy]
+                                              priority:JRConnectionPriorityCritical completionHandler:handler];
 }
 
 + (void)updateProfileForUser:(JRCaptureUser *)user delegate:(id <JRCaptureDelegate>)delegate
@@ -870,37 +1030,48 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         [delegate updateUserProfileDidFailWithError:[JRCaptureError invalidArgumentErrorWithParameterName:@"user"]];
     }
 
-    JRCaptureData *data = [JRCaptureData sharedCaptureData];
-    NSString *editProfileForm = data.captureEditProfileFormName;
+    [self afterStartupTasks:@[JRStartupTaskFlow, JRStartupTaskTokens] perform:^{
+        JRCaptureData *data = [JRCaptureData sharedCaptureData];
+        NSString *editProfileForm = data.captureEditProfileFormName;
 
-    if (!editProfileForm) {
-        [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
-                                    format:@"Missing editProfileFormName configuration option"];
-    }
-    NSMutableDictionary *params = [user toFormFieldsForForm:editProfileForm withFlow:data.captureFlow];
-
-    [params addEntriesFromDictionary:@{
-        @"client_id" : ObjectOrNull(data.clientId),
-        @"access_token" : ObjectOrNull(data.accessToken),
-        @"locale" : ObjectOrNull(data.captureLocale),
-        @"form" : ObjectOrNull(editProfileForm),
-        @"flow" : ObjectOrNull(data.captureFlowName),
-    }];
+        if (!editProfileForm) {
+            [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
+                                        format:@"Missing editProfileFormName configuration option"];
+        }
+        NSMutableDictionary *params = [user toFormFieldsForForm:editProfileForm withFlow:data.captureFlow];
+
+        JRCaptureError *validationError = [self localValidationErrorForForm:editProfileForm fields:params
+                                                                       flow:data.captureFlow];
+        if (validationError) {
+            if ([delegate respondsToSelector:@selector(updateUserProfileDidFailWithError:)]){
+                [delegate updateUserProfileDidFailWithError:validationError];
+            }
+            return;
+        }
+
+        [params addEntriesFromDictionary:@{
+            @"client_id" : ObjectOrNull(data.clientId),
+            @"access_token" : ObjectOrNull(data.accessToken),
+            @"locale" : ObjectOrNull(data.captureLocale),
+            @"form" : ObjectOrNull(editProfileForm),
+            @"flow" : ObjectOrNull(data.captureFlowName),
+        }];
    
 
-    if ([data downloadedFlowVersion]) {
-        [params setObject:[data downloadedFlowVersion] forKey:@"flow_version"];
-    }
+        if ([data downloadedFlowVersion]) {
+            [params setObject:[data downloadedFlowVersion] forKey:@"flow_version"];
+        }
 
-    NSString *url = [NSString stringWithFormat:@"%@/oauth/update_profile_native", data.captureBaseUrl];
-    NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
+        NSString *url = [NSString stringWithFormat:@"%@/oauth/update_profile_native", data.captureBaseUrl];
+        NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
 
-    [self startURLConnectionWithRequest:request
-                               delegate:delegate
-                              onSuccess:@selector(updateUserProfileDidSucceed)
-                              onFailure:@selector(updateUserProfileDidFailWithError:)
-                                message:@"updating user profile"
-                  extraOnSuccessHandler:nil];
+        [self startURLConnectionWithRequest:request
+                                   delegate:delegate
+                                  onSuccess:@selector(updateUserProfileDidSucceed)
+                                  onFailure:@selector(updateUserProfileDidFailWithError:)
+                                    message:@"updating user profile"
+                      extraOnSuccessHandler:nil];
+    }];
 }
 
 + (void)updateProfileForUserWithForm:(JRCaptureUser *)user
@@ -911,35 +1082,45 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         [delegate updateUserProfileDidFailWithError:[JRCaptureError invalidArgumentErrorWithParameterName:@"user"]];
     }
     
-    JRCaptureData *data = [JRCaptureData sharedCaptureData];
+    [self afterStartupTasks:@[JRStartupTaskFlow, JRStartupTaskTokens] perform:^{
+        JRCaptureData *data = [JRCaptureData sharedCaptureData];
     
-    if (!formName) {
-        [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
-                                    format:@"Missing editProfileFormName configuration option"];
-    }
-    NSMutableDictionary *params = [user toFormFieldsForForm:formName withFlow:data.captureFlow];
+        if (!formName) {
+            [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
+                                        format:@"Missing editProfileFormName configuration option"];
+        }
+        NSMutableDictionary *params = [user toFormFieldsForForm:formName withFlow:data.captureFlow];
+
+        JRCaptureError *validationError = [self localValidationErrorForForm:formName fields:params flow:data.captureFlow];
+        if (validationError) {
+            if ([delegate respondsToSelector:@selector(updateUserProfileDidFailWithError:)]){
+                [delegate updateUserProfileDidFailWithError:validationError];
+            }
+            return;
+        }
     
-    [params addEntriesFromDictionary:@{
-                                       @"client_id" : ObjectOrNull(data.clientId),
-                                       @"access_token" : ObjectOrNull(data.accessToken),
-                                       @"locale" : ObjectOrNull(data.captureLocale),
-                                       @"form" : ObjectOrNull(formName),
-                                       @"flow" : ObjectOrNull(data.captureFlowName),
-                                       }];
+        [params addEntriesFromDictionary:@{
+                                           @"client_id" : ObjectOrNull(data.clientId),
+                                           @"access_token" : ObjectOrNull(data.accessToken),
+                                           @"locale" : ObjectOrNull(data.captureLocale),
+                                           @"form" : ObjectOrNull(formName),
+                                           @"flow" : ObjectOrNull(data.captureFlowName),
+                                           }];
     
-    if ([data downloadedFlowVersion]) {
-        [params setObject:[data downloadedFlowVersion] forKey:@"flow_version"];
-    }
+        if ([data downloadedFlowVersion]) {
+            [params setObject:[data downloadedFlowVersion] forKey:@"flow_version"];
+        }
     
-    NSString *url = [NSString stringWithFormat:@"%@/oauth/update_profile_native", data.captureBaseUrl];
-    NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
+        NSString *url = [NSString stringWithFormat:@"%@/oauth/update_profile_native", data.captureBaseUrl];
+        NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
     
-    [self startURLConnectionWithRequest:request
-                               delegate:delegate
-                              onSuccess:@selector(updateUserProfileDidSucceed)
-                              onFailure:@selector(updateUserProfileDidFailWithError:)
-                                message:[NSString stringWithFormat:@"updating user profile with form name: %@", formName]
-                  extraOnSuccessHandler:nil];
+        [self startURLConnectionWithRequest:request
+                                   delegate:delegate
+                                  onSuccess:@selector(updateUserProfileDidSucceed)
+                                  onFailure:@selector(updateUserProfileDidFailWithError:)
+                                    message:[NSString stringWithFormat:@"updating user profile with form name: %@", formName]
+                      extraOnSuccessHandler:nil];
+    }];
 }
 
 + (void)postFormWithFormDataProvided:(JRCaptureUser *)user
@@ -952,43 +1133,54 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
         [delegate updateUserProfileDidFailWithError:[JRCaptureError invalidArgumentErrorWithParameterName:@"user"]];
     }
     
-    JRCaptureData *data = [JRCaptureData sharedCaptureData];
+    [self afterStartupTasks:@[JRStartupTaskFlow, JRStartupTaskTokens] perform:^{
+        JRCaptureData *data = [JRCaptureData sharedCaptureData];
     
-    if (!endpointUrl) {
-        [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
-                                    format:@"Missing toCaptureEndpoint configuration option"];
-    }
+        if (!endpointUrl) {
+            [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
+                                        format:@"Missing toCaptureEndpoint configuration option"];
+        }
     
-    if (!formName) {
-        [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
-                                    format:@"Missing withFormName configuration option"];
-    }
+        if (!formName) {
+            [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
+                                        format:@"Missing withFormName configuration option"];
+        }
     
-    if ([fieldData count] == 0) {
-        [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
-                                    format:@"andFieldData configuration option is empty"];
-    }
+        if ([fieldData count] == 0) {
+            [NSException raiseJRDebugException:@"JRCaptureMissingParameterException"
+                                        format:@"andFieldData configuration option is empty"];
+        }
     
-    [fieldData addEntriesFromDictionary:@{
-                                       @"client_id" : ObjectOrNull(data.clientId),
-                                       @"access_token" : ObjectOrNull(data.accessToken),
-                                       @"locale" : ObjectOrNull(data.captureLocale),
-                                       @"form" : ObjectOrNull(formName),
-                                       @"flow" : ObjectOrNull(data.captureFlowName),
-                                       }];
+        JRCaptureError *validationError = [self localValidationErrorForForm:formName fields:fieldData
+                                                                       flow:data.captureFlow];
+        if (validationError) {
+            if ([delegate respondsToSelector:@selector(updateUserProfileDidFailWithError:)]){
+                [delegate updateUserProfileDidFailWithError:validationError];
+            }
+            return;
+        }
+
+        [fieldData addEntriesFromDictionary:@{
+                                           @"client_id" : ObjectOrNull(data.clientId),
+                                           @"access_token" : ObjectOrNull(data.accessToken),
+                                           @"locale" : ObjectOrNull(data.captureLocale),
+                                           @"form" : ObjectOrNull(formName),
+                                           @"flow" : ObjectOrNull(data.captureFlowName),
+                                           }];
     
-    if ([data downloadedFlowVersion]) {
-        [fieldData setObject:[data downloadedFlowVersion] forKey:@"flow_version"];
-    }
-    NSString *url = [NSString stringWithFormat:@"%@%@", data.captureBaseUrl, endpointUrl];
-    NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:fieldData];
+        if ([data downloadedFlowVersion]) {
+            [fieldData setObject:[data downloadedFlowVersion] forKey:@"flow_version"];
+        }
+        NSString *url = [NSString stringWithFormat:@"%@%@", data.captureBaseUrl, endpointUrl];
+        NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:fieldData];
     
-    [self startURLConnectionWithRequest:request
-                               delegate:delegate
-                              onSuccess:@selector(updateUserProfileDidSucceed)
-                              onFailure:@selector(updateUserProfileDidFailWithError:)
-                                message:[NSString stringWithFormat:@"Posting provided form field data to Capture endpoint: %@ form name: %@", url, formName]
-                  extraOnSuccessHandler:nil];
+        [self startURLConnectionWithRequest:request
+                                   delegate:delegate
+                                  onSuccess:@selector(updateUserProfileDidSucceed)
+                                  onFailure:@selector(updateUserProfileDidFailWithError:)
+                                    message:[NSString stringWithFormat:@"Posting provided form field data to Capture endpoint: %@ form name: %@", url, formName]
+                      extraOnSuccessHandler:nil];
+    }];
 }
 
 - (void)dealloc
@@ -1021,6 +1213,7 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
     if (!redirectUri) {
         JRCaptureError *captureError =
         [JRCaptureError invalidArgumentErrorWithParameterName:@"redirectUri"];
+        [[JRTracer sharedTracer] endTraceWithStatus:@"invalid_argument"];
         if ([delegate respondsToSelector:@selector(linkNewAccountDidFailWithError:)]){
             [delegate linkNewAccountDidFailWithError:captureError];
         }
@@ -1052,17 +1245,20 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
              [JRConnectionManager jsonRequestToUrl:url params:params completionHandler:^(id result, NSError *error) {
                  if (error) {
                      ALog("Failure: Failed to fetch linked accounts after linking: %@", error);
+                     [[JRTracer sharedTracer] endTraceWithStatus:@"entity_failed"];
                      if ([delegate respondsToSelector:@selector(linkNewAccountDidFailWithError:)]){
                          [delegate linkNewAccountDidFailWithError:error];
                      }
                  } else if ([@"ok" isEqual:[result objectForKey:@"stat"]]) {
                       DLog(@"Success: Fetched the linked accounts & updated Capture object successfully");
                      [JRCaptureData setLinkedProfiles:[[result valueForKey:@"result"] valueForKey:@"profiles"]];
+                     [[JRTracer sharedTracer] endTraceWithStatus:@"ok"];
                      if ([delegate respondsToSelector:@selector(linkNewAccountDidSucceed)]){
                          [delegate linkNewAccountDidSucceed];
                      }
                  } else {
                      JRCaptureError *captureError = [JRCaptureError errorFromResult:result onProvider:nil engageToken:nil];
+                     [[JRTracer sharedTracer] endTraceWithStatus:@"entity_failed"];
                      if ([delegate respondsToSelector:@selector(linkNewAccountDidFailWithError:)]){
                          [delegate linkNewAccountDidFailWithError:captureError];
                      }
@@ -1074,7 +1270,10 @@ captureRegistrationFormName:(NSString *)captureRegistrationFormName
                               onSuccess:nil
                               onFailure:@selector(linkNewAccountDidFailWithError:)
                                 message:@"initiating account linking flow"
-                  extraOnSuccessHandler:successHandler];
+                  extraOnSuccessHandler:successHandler
+                  extraOnFailureHandler:^(NSError *error) {
+                      [[JRTracer sharedTracer] endTraceWithStatus:@"failed"];
+                  }];
 }
 
 + (void)startActualAccountUnLinking:(id <JRCaptureDelegate>)delegate forProfileIdentifier:(NSString *)identifier {
@@ -34,6 +34,8 @@
 
 #import "debug_log.h"
 #import "JRConnectionManager.h"
+#import "JRRequestBodyEncoder.h"
+#import "JRRetryPolicy.h"
 #import "JRCaptureApidInterface.h"
 #import "JRCaptureData.h"
 #import "NSMutableDictionary+JRDictionaryUtils.h"
@@ -106,7 +108,7 @@ typedef enum CaptureInterfaceStatEnum
                              withContext:(NSObject *)context
 {
     DLog(@"");
-    NSString *refreshSecret = [JRCaptureData generateAndStoreRefreshSecret];
+    NSString *refreshSecret = [JRCaptureData generateRefreshSecret];
 
     if (!refreshSecret)
     {
@@ -120,6 +122,7 @@ typedef enum CaptureInterfaceStatEnum
                                                                                    refreshSecret:refreshSecret
                                                                                         delegate:delegate];
     NSMutableURLRequest *request = [JRCaptureData requestWithPath:kJRTradAuthUrlPath];
+    [request JR_setOperationName:@"signin"];
     [request JR_setBodyWithParams:signInParams];
     [self startTradAuthForDelegate:delegate context:context request:request];
 }
@@ -129,7 +132,9 @@ typedef enum CaptureInterfaceStatEnum
     NSMutableDictionary *tag = [@{cTagAction : cSignInUser, @"delegate" : delegate } mutableCopy];
     if (context) [tag setObject:context forKey:@"context"];
     JRCaptureApidInterface *singleton = [JRCaptureApidInterface sharedCaptureApidInterface];
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:singleton withTag:tag])
+    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:singleton returnFullResponse:NO
+                                                  withTag:tag retryPolicy:[JRRetryPolicy defaultPolicy]
+                                                 priority:JRConnectionPriorityCritical])
     {
         JRCaptureError *err = [JRCaptureError connectionCreationErr:request forDelegate:singleton withTag:tag];
         [self finishSignInFailureWithError:err forDelegate:delegate withContext:context];
@@ -157,10 +162,13 @@ typedef enum CaptureInterfaceStatEnum
                     withContext:(NSObject *)context
 {
     NSMutableURLRequest *request = [self entityRequestForPath:nil token:token];
+    [request JR_setOperationName:@"entity"];
 
     NSMutableDictionary *tag = [@{cTagAction : cGetUser, @"delegate" : delegate } mutableCopy];
     [tag JR_maybeSetObject:context forKey:@"context"];
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
+    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:NO withTag:tag
+                                            retryPolicy:[JRRetryPolicy idempotentPostPolicy]
+                                               priority:JRConnectionPriorityCritical])
     {
         NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
                                                        [[request URL] absoluteString]];
@@ -199,7 +207,8 @@ typedef enum CaptureInterfaceStatEnum
 
     NSMutableDictionary *tag = [@{cTagAction : cGetObject, @"delegate" : delegate } mutableCopy];
     [tag JR_maybeSetObject:context forKey:@"context"];
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
+    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:NO withTag:tag
+                                            retryPolicy:[JRRetryPolicy idempotentPostPolicy]])
     {
         NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
                                                        [[request URL] absoluteString]];
@@ -226,6 +235,19 @@ typedef enum CaptureInterfaceStatEnum
     return request;
 }
 
+/* The attributes go in as they are; JRRequestBodyEncoder writes them as JSON in whichever body it builds */
+- (NSDictionary *)entityParamsWithAttributes:(id)attributes atPath:(NSString *)entityPath token:(NSString *)token
+{
+    NSMutableDictionary *params = [@{@"include_record" : @"true"} mutableCopy];
+    [params JR_maybeSetObject:attributes forKey:@"attributes"];
+    [params JR_maybeSetObject:token forKey:@"access_token"];
+
+    if (entityPath && ![entityPath isEqualToString:@""])
+        [params setObject:entityPath forKey:@"attribute_name"];
+
+    return params;
+}
+
 - (void)finishUpdateObjectWithStat:(CaptureInterfaceStat)stat andResult:(NSDictionary *)result
                        forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
 {
@@ -249,30 +271,15 @@ typedef enum CaptureInterfaceStatEnum
 {
     DLog(@"");
 
-    NSString *attributes = [[captureObject JR_jsonString] stringByAddingUrlPercentEscapes];
-    NSMutableData *body = [NSMutableData data];
-
-    NSString *attrArgString = [NSString stringWithFormat:@"&attributes=%@", attributes];
-    [body appendData:[attrArgString dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[[NSString stringWithFormat:@"&access_token=%@", token] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[@"&include_record=true" dataUsingEncoding:NSUTF8StringEncoding]];
-
-    if (!entityPath || [entityPath isEqualToString:@""])
-    {
-        ;
-    }
-    else
-    {
-        NSString *attrNameArgString = [NSString stringWithFormat:@"&attribute_name=%@", entityPath];
-        [body appendData:[attrNameArgString dataUsingEncoding:NSUTF8StringEncoding]];
-    }
-
     NSString *updateUrl = [NSString stringWithFormat:@"%@/entity.update",
                                                      [JRCaptureData sharedCaptureData].captureBaseUrl];
     NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:updateUrl]];
 
-    [request setHTTPMethod:@"POST"];
-    [request setHTTPBody:body];
+    [request JR_setOperationName:@"entity.update"];
+    [[JRRequestBodyEncoder sharedEncoder] setBodyOfRequest:request
+                                                withParams:[self entityParamsWithAttributes:captureObject
+                                                                                     atPath:entityPath
+                                                                                      token:token]];
 
     NSMutableDictionary *tag = [@{cTagAction : cUpdateObject, @"delegate" : delegate} mutableCopy];
     [tag JR_maybeSetObject:context forKey:@"context"];
@@ -315,34 +322,21 @@ typedef enum CaptureInterfaceStatEnum
 {
     DLog(@"");
 
-    NSString *attributes = [[captureObject JR_jsonString] stringByAddingUrlPercentEscapes];
-    NSMutableData *body = [NSMutableData data];
-
-    [body appendData:[[NSString stringWithFormat:@"&attributes=%@", attributes] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[[NSString stringWithFormat:@"&access_token=%@", token] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[@"&include_record=true" dataUsingEncoding:NSUTF8StringEncoding]];
-
-    if (!entityPath || [entityPath isEqualToString:@""])
-    {
-        ;
-    }
-    else
-    {
-        NSString *argString = [NSString stringWithFormat:@"&attribute_name=%@", entityPath];
-        [body appendData:[argString dataUsingEncoding:NSUTF8StringEncoding]];        
-    }
-
     NSString *replaceUrl = [NSString stringWithFormat:@"%@/entity.replace",
                                                       [JRCaptureData sharedCaptureData].captureBaseUrl];
     NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:replaceUrl]];
 
-    [request setHTTPMethod:@"POST"];
-    [request setHTTPBody:body];
+    [request JR_setOperationName:@"entity.replace"];
+    [[JRRequestBodyEncoder sharedEncoder] setBodyOfRequest:request
+                                                withParams:[self entityParamsWithAttributes:captureObject
+                                                                                     atPath:entityPath
+                                                                                      token:token]];
 
     NSMutableDictionary *tag = [@{cTagAction : cReplaceObject, @"delegate" : delegate} mutableCopy];
     [tag JR_maybeSetObject:context forKey:@"context"];
 
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
+    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:NO withTag:tag
+                                            retryPolicy:[JRRetryPolicy idempotentPostPolicy]])
     {
         NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
                                                       [[request URL] absoluteString]];
@@ -380,35 +374,25 @@ typedef enum CaptureInterfaceStatEnum
 {
     DLog(@"");
 
-    NSString *attributes = [[captureArray JR_jsonString] stringByAddingUrlPercentEscapes];
-    NSMutableData *body = [NSMutableData data];
-
-    [body appendData:[[NSString stringWithFormat:@"&attributes=%@", attributes] 
-            dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[[NSString stringWithFormat:@"&access_token=%@", token] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[@"&include_record=true" dataUsingEncoding:NSUTF8StringEncoding]];
-
-    if (entityPath && ![entityPath isEqualToString:@""])
-    {
-        NSString *argString = [NSString stringWithFormat:@"&attribute_name=%@", entityPath];
-        [body appendData:[argString dataUsingEncoding:NSUTF8StringEncoding]];
-    }
-
     NSString *captureBaseUrl = [JRCaptureData sharedCaptureData].captureBaseUrl;
     NSString *replaceUrl = [NSString stringWithFormat:@"%@/entity.replace", captureBaseUrl];
     NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:replaceUrl]];
 
-    [request setHTTPMethod:@"POST"];
-    [request setHTTPBody:body];
+    [request JR_setOperationName:@"entity.replace"];
+    [[JRRequestBodyEncoder sharedEncoder] setBodyOfRequest:request
+                                                withParams:[self entityParamsWithAttributes:captureArray
+                                                                                     atPath:entityPath
+                                                                                      token:token]];
 
     NSMutableDictionary *tag = [@{cTagAction : cReplaceArray, @"delegate" : delegate} mutableCopy];
     [tag JR_maybeSetObject:context forKey:@"context"];
 
-    DLog(@"%@ attributes=%@ access_token=%@ attribute_name=%@", [[request URL] absoluteString], attributes, token,
-        entityPath);
+    DLog(@"%@ attributes=%@ attribute_name=%@", [[request URL] absoluteString],
+         JRLogRedactedPayload([captureArray JR_jsonString]), entityPath);
 
     /* tag vs context for workaround */
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag]) 
+    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:NO withTag:tag
+                                            retryPolicy:[JRRetryPolicy idempotentPostPolicy]])
     {
         NSString *errDesc = [NSString stringWithFormat:@"Could not create a connection to %@",
                                                        [[request URL] absoluteString]];
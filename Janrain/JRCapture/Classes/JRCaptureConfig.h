@@ -123,6 +123,29 @@
  **/
 @property (nonatomic) NSString *downloadFlowUrl;
 
+/**
+ *   Opens connections to the Capture domain, Engage app and token URL as soon as the library is configured, and
+ *   again when the app returns to the foreground or the network changes, so that the first sign-in requests don't
+ *   wait on DNS lookups and TLS handshakes. Off by default.
+ **/
+@property bool enablePreconnect;
+
+/**
+ *   gzips entity.update and entity.replace request bodies of 1 KB or more, which typically makes a whole record
+ *   upload several times smaller. Only enable for Capture applications whose API is known to accept compressed
+ *   bodies. An endpoint that answers with 415, or with a missing_argument or attributes invalid_argument error, is
+ *   sent plain bodies instead, but a server that misreads the body some other way isn't detected. Off by default.
+ **/
+@property bool compressRequestBodies;
+
+/**
+ *   Sends entity.update and entity.replace as JSON rather than form encoded bodies, avoiding the percent encoding
+ *   of the attributes. Only enable for Capture applications whose API is known to accept JSON bodies. An endpoint
+ *   that answers with 415, or with a missing_argument or attributes invalid_argument error, is sent form encoded
+ *   bodies instead, but a server that misreads the body some other way isn't detected. Off by default.
+ **/
+@property bool jsonRequestBodies;
+
 
 /**
  *   Get an empty Capture Configuration
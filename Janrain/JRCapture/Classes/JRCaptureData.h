@@ -32,6 +32,19 @@
 
 @class JRCaptureConfig;
 @class JRCaptureFlow;
+@class JRStartupTaskGraph;
+@protocol JRCaptureTokenStoreBackend;
+
+/**
+ * @internal
+ * Names of the tasks in JRCaptureData#startupTasks. JRStartupTaskFlow finishes as soon as there is a flow to use,
+ * the cached one or, on first launch, the downloaded one.
+ */
+FOUNDATION_EXPORT NSString *const JRStartupTaskTokens;
+FOUNDATION_EXPORT NSString *const JRStartupTaskFlowLoad;
+FOUNDATION_EXPORT NSString *const JRStartupTaskFlowDownload;
+FOUNDATION_EXPORT NSString *const JRStartupTaskFlow;
+FOUNDATION_EXPORT NSString *const JRStartupTaskEngageConfiguration;
 
 /**
  * @internal
@@ -58,8 +71,19 @@
 @property(nonatomic, readonly) NSArray *linkedProfiles;
 @property(nonatomic, readonly) BOOL socialSignMode;
 
+/**
+ * Already started; the token restore is added when the shared instance is created, the flow tasks by
+ * setCaptureConfig: and the Engage configuration task by JRCapture
+ */
+@property(nonatomic, readonly) JRStartupTaskGraph *startupTasks;
+
 + (void)setAccessToken:(NSString *)token;
 
+/**
+ * Replaces where the access token and refresh secret are kept (the keychain by default) and reloads them from there
+ */
++ (void)setTokenStoreBackend:(id <JRCaptureTokenStoreBackend>)backend;
+
 + (void)setCaptureRedirectUri:(NSString *)redirectUri;
 
 + (void)setCaptureConfig:(JRCaptureConfig *)config;
@@ -72,7 +96,10 @@
 
 + (JRCaptureData *)sharedCaptureData;
 
-+ (NSString *)generateAndStoreRefreshSecret;
+/**
+ * The secret isn't stored until setAccessToken: is given the token of the sign-in it was generated for
+ */
++ (NSString *)generateRefreshSecret;
 
 + (NSMutableURLRequest *)requestWithPath:(NSString *)path;
 
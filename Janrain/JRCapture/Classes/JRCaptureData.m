@@ -30,13 +30,20 @@
 
 #import "debug_log.h"
 #import "JRCaptureData.h"
-#import "SFHFKeychainUtils.h"
+#import "JRCaptureTokenStore.h"
+#import "JRCaptureKeychainTokenBackend.h"
 #import "JRCaptureConfig.h"
 #import "NSDictionary+JRQueryParams.h"
 #import "JREngageWrapper.h"
 #import "JRCaptureFlow.h"
 #import "JRCaptureError.h"
 #import "JRCapture.h"
+#import "JRConnectionManager.h"
+#import "JRRetryPolicy.h"
+#import "NSMutableURLRequest+JRRequestUtils.h"
+#import "JRStageMetrics.h"
+#import "JRStartupTaskGraph.h"
+#import "JRTracer.h"
 
 #define cJRCaptureKeychainIdentifier @"capture_tokens.janrain"
 #define cJRCaptureKeychainUserName @"capture_user"
@@ -63,18 +70,32 @@ static NSString*appBundleDisplayNameAndIdentifier()
     return [NSString stringWithFormat:@"%@.%@", name, identifier];
 }
 
-typedef enum
-{
-    JRTokenTypeAccess,
-    JRTokenTypeRefresh,
-} JRTokenType;
+static NSString *const ACCESS_TOKEN_NAME = @"access_token";
+static NSString *const REFRESH_SECRET_NAME = @"refresh_secret";
 
 static NSString *const FLOW_KEY = @"JR_capture_flow";
 
+/* Only bounds how long sign-in waits on first launch; the download itself carries on */
+#define FLOW_DOWNLOAD_WAIT_TIMEOUT 30.0
+
+NSString *const JRStartupTaskTokens = @"tokens";
+NSString *const JRStartupTaskFlowLoad = @"flow_load";
+NSString *const JRStartupTaskFlowDownload = @"flow_download";
+NSString *const JRStartupTaskFlow = @"flow";
+NSString *const JRStartupTaskEngageConfiguration = @"engage_configuration";
+
 @interface JRCaptureData ()
+{
+    /* Set while the saved tokens are read in the background; the first use of tokenStore waits for them */
+    dispatch_group_t tokenStoreGroup;
+    JRCaptureTokenStore *loadedTokenStore;
+}
 
-@property(nonatomic) NSString *accessToken;
-@property(nonatomic) NSString *refreshSecret;
+@property(nonatomic) JRCaptureTokenStore *tokenStore;
+
+/* Generated for a sign-in in flight; it's stored with the access token that sign-in hands back, see setAccessToken: */
+@property(nonatomic) NSString *pendingRefreshSecret;
+@property(nonatomic) JRStartupTaskGraph *startupTasks;
 
 @property(nonatomic) NSString *captureBaseUrl;
 @property(nonatomic) NSString *clientId;
@@ -109,8 +130,8 @@ static JRCaptureData *singleton = nil;
 
 @synthesize clientId;
 @synthesize captureBaseUrl;
-@synthesize accessToken;
-@synthesize refreshSecret;
+@synthesize tokenStore;
+@synthesize pendingRefreshSecret;
 @synthesize captureLocale;
 @synthesize captureTraditionalSignInFormName;
 //@synthesize captureTradSignInType;
@@ -126,23 +147,94 @@ static JRCaptureData *singleton = nil;
 @synthesize captureRedirectUri;
 @synthesize downloadFlowUrl;
 @synthesize engageAppUrl;
+@synthesize startupTasks;
 
 - (JRCaptureData *)init
 {
     if ((self = [super init]))
     {
-        self.accessToken = [self readTokenForTokenName:@"access_token"];
-        self.refreshSecret = [self readTokenForTokenName:@"refresh_secret"];
+        JRCaptureKeychainTokenBackend *backend =
+                [[JRCaptureKeychainTokenBackend alloc] initWithUsername:cJRCaptureKeychainUserName
+                                                          servicePrefix:[cJRCaptureKeychainIdentifier stringByAppendingString:@"."]
+                                                          serviceSuffix:[NSString stringWithFormat:@".%@.",
+                                                                                  appBundleDisplayNameAndIdentifier()]];
+        /* Started straight away, so API calls made without a config never wait on tasks that can't run */
+        self.startupTasks = [[JRStartupTaskGraph alloc] init];
+        [self.startupTasks start];
+        [self startLoadingTokensFromBackend:backend];
     }
 
     return self;
 }
 
-- (NSString *)readTokenForTokenName:(NSString *)tokenName
++ (JRCaptureTokenStore *)tokenStoreWithBackend:(id <JRCaptureTokenStoreBackend>)backend
+{
+    return [[JRCaptureTokenStore alloc] initWithBackend:backend
+                                             tokenNames:[NSArray arrayWithObjects:ACCESS_TOKEN_NAME,
+                                                                                  REFRESH_SECRET_NAME, nil]];
+}
+
+/* The keychain read is the slow part of launching signed in, so it runs alongside the rest of startup */
+- (void)startLoadingTokensFromBackend:(id <JRCaptureTokenStoreBackend>)backend
+{
+    dispatch_group_t group = dispatch_group_create();
+    tokenStoreGroup = group;
+    dispatch_group_async(group, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        /* Read after dispatch_group_wait, which orders this write before the read */
+        self->loadedTokenStore = [JRCaptureData tokenStoreWithBackend:backend];
+    });
+
+    [self.startupTasks addTaskNamed:JRStartupTaskTokens dependencies:nil start:^(JRStartupTaskFinish finish) {
+        dispatch_group_notify(group, dispatch_get_main_queue(), ^{
+            finish(nil);
+        });
+    }];
+}
+
+- (void)waitForLoadedTokens
+{
+    if (!tokenStoreGroup) return;
+
+    dispatch_group_wait(tokenStoreGroup, DISPATCH_TIME_FOREVER);
+    tokenStore = loadedTokenStore;
+    loadedTokenStore = nil;
+    tokenStoreGroup = nil;
+}
+
+- (JRCaptureTokenStore *)tokenStore
+{
+    [self waitForLoadedTokens];
+    return tokenStore;
+}
+
+- (void)loadTokensFromBackend:(id <JRCaptureTokenStoreBackend>)backend
 {
-    return [SFHFKeychainUtils getPasswordForUsername:cJRCaptureKeychainUserName
-                                      andServiceName:[JRCaptureData serviceNameForTokenName:tokenName]
-                                               error:nil];
+    /* Otherwise the background load could be adopted over the new backend's tokens */
+    [self waitForLoadedTokens];
+    self.tokenStore = [JRCaptureData tokenStoreWithBackend:backend];
+}
+
+- (NSString *)accessToken
+{
+    return [self.tokenStore tokenForName:ACCESS_TOKEN_NAME];
+}
+
+- (NSString *)refreshSecret
+{
+    return [self.tokenStore tokenForName:REFRESH_SECRET_NAME];
+}
+
+- (void)setCaptureBaseUrl:(NSString *)captureBaseUrl_
+{
+    captureBaseUrl = captureBaseUrl_;
+
+    /* Capture apps can be on a custom domain; requests there are still Janrain's */
+    [[JRTracer sharedTracer] addCorrelatedHost:[[NSURL URLWithString:captureBaseUrl_] host]];
+}
+
++ (void)setTokenStoreBackend:(id <JRCaptureTokenStoreBackend>)backend
+{
+    [[JRCaptureData sharedCaptureData] loadTokensFromBackend:backend];
 }
 
 + (JRCaptureData *)sharedCaptureData
@@ -194,7 +286,7 @@ static JRCaptureData *singleton = nil;
             }];
     
     if (!linkAccount) {
-        [urlArgs setObject:[self generateAndStoreRefreshSecret] forKey:@"refresh_secret"];
+        [urlArgs setObject:[self generateRefreshSecret] forKey:@"refresh_secret"];
     }
     if (captureData.captureFlowName) {
         [urlArgs setObject:captureData.captureFlowName forKey:@"flow"];
@@ -213,7 +305,7 @@ static JRCaptureData *singleton = nil;
     return [NSString stringWithFormat:@"%@/oauth/auth_native?%@", captureData.captureBaseUrl, getParams];
 }
 
-+ (NSString *)generateAndStoreRefreshSecret
++ (NSString *)generateRefreshSecret
 {
     #define RANDOM_BYTES 20
 
@@ -229,8 +321,9 @@ static JRCaptureData *singleton = nil;
     for (int i=0; i<RANDOM_BYTES; i++) [buffer appendFormat:@"%02hhx", refreshSecret_[i]];
     [buffer replaceCharactersInRange:NSMakeRange(0, 1) withString:@"a"];
 
-    [JRCaptureData saveNewToken:[NSString stringWithString:buffer] ofType:JRTokenTypeRefresh];
-    return [JRCaptureData sharedCaptureData].refreshSecret;
+    NSString *refreshSecret = [NSString stringWithString:buffer];
+    [JRCaptureData sharedCaptureData].pendingRefreshSecret = refreshSecret;
+    return refreshSecret;
 }
 
 - (NSString *)downloadedFlowVersion
@@ -275,16 +368,72 @@ static JRCaptureData *singleton = nil;
     if ([captureDataInstance.captureLocale length] &&
             [captureDataInstance.captureFlowName length] && [captureDataInstance.captureAppId length])
     {
-        [captureDataInstance loadFlow];
-        [captureDataInstance downloadFlow];
+        [captureDataInstance addFlowStartupTasks];
     }
 }
 
-- (void)loadFlow
+- (void)addFlowStartupTasks
+{
+    __weak JRCaptureData *weakSelf = self;
+    [self.startupTasks addTaskNamed:JRStartupTaskFlowLoad dependencies:nil start:^(JRStartupTaskFinish finish) {
+        [weakSelf loadFlowInBackgroundWithCompletion:^{
+            finish(nil);
+        }];
+    }];
+
+    [self.startupTasks addTaskNamed:JRStartupTaskFlowDownload dependencies:nil start:^(JRStartupTaskFinish finish) {
+        [weakSelf downloadFlowWithCompletion:finish];
+    }];
+
+    /* Any flow will do for signing in, so the download is only waited for when nothing was cached */
+    [self.startupTasks addTaskNamed:JRStartupTaskFlow dependencies:@[JRStartupTaskFlowLoad]
+                              start:^(JRStartupTaskFinish finish) {
+        JRCaptureData *captureData = weakSelf;
+        if ([captureData.captureFlow dictionary]) {
+            finish(nil);
+            return;
+        }
+
+        [captureData.startupTasks waitForTasks:@[JRStartupTaskFlowDownload] timeout:FLOW_DOWNLOAD_WAIT_TIMEOUT
+                                    completion:^(BOOL finished) {
+            NSError *error = [[captureData.startupTasks taskErrors] objectForKey:JRStartupTaskFlowDownload];
+            if (!finished) {
+                error = [JRCaptureError errorWithErrorString:@"flow_download_timeout" code:JRCaptureLocalErrorGeneric
+                                                 description:@"Timed out waiting for the flow to download"
+                                                 extraFields:nil];
+            }
+            finish(error);
+        }];
+    }];
+}
+
+- (NSDictionary *)cachedFlowDictionary
 {
+    JR_STAGE_BEGIN(JRStageUnarchive);
     NSDictionary *flowDict =
             [NSKeyedUnarchiver unarchiveObjectWithData:[[NSUserDefaults standardUserDefaults] objectForKey:FLOW_KEY]];
-    self.captureFlow = [JRCaptureFlow flowWithDictionary:flowDict];
+    JR_STAGE_END(JRStageUnarchive);
+    return flowDict;
+}
+
+- (void)loadFlow
+{
+    self.captureFlow = [JRCaptureFlow flowWithDictionary:[self cachedFlowDictionary]];
+}
+
+- (void)loadFlowInBackgroundWithCompletion:(void (^)(void))completion
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSDictionary *flowDict = [self cachedFlowDictionary];
+        JRCaptureFlow *flow = [flowDict isKindOfClass:[NSDictionary class]] ?
+                [JRCaptureFlow flowWithDictionary:flowDict] : nil;
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+            /* A download that beat the disk read is newer than what was cached */
+            if (flow && ![self.captureFlow dictionary]) self.captureFlow = flow;
+            completion();
+        });
+    });
 }
 
 - (NSString *)getForgottenPasswordFieldName {
@@ -296,7 +445,8 @@ static JRCaptureData *singleton = nil;
     return [self.captureFlow userIdentifyingFieldForForm:self.captureForgottenPasswordFormName];
 }
 
-- (void)downloadFlow
+/* The notification is posted when idle, for the app; the completion is for the startup tasks, which can't wait */
+- (void)downloadFlowWithCompletion:(void (^)(NSError *error))completion
 {
     NSString *flowVersion = self.captureFlowVersion ? self.captureFlowVersion : @"HEAD";
 
@@ -316,8 +466,11 @@ static JRCaptureData *singleton = nil;
     
     NSMutableURLRequest *downloadRequest = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:flowUrlString]];
     [downloadRequest setValue:@"gzip" forHTTPHeaderField:@"Accept-Encoding"];
+    [downloadRequest JR_setOperationName:@"flow"];
     
-    NSURLSessionTask *task = [[NSURLSession sharedSession] dataTaskWithRequest:downloadRequest completionHandler:^(NSData * _Nullable data, NSURLResponse * _Nullable response, NSError * _Nullable e) {
+    /* The flow is the biggest thing the library downloads; it's parsed as it comes in */
+    [JRConnectionManager startJsonTaskWithRequest:downloadRequest retryPolicy:[JRRetryPolicy defaultPolicy]
+                                         priority:JRConnectionPriorityBackground completionHandler:^(id parsedFlow, NSURLResponse *response, NSError *e) {
         /*
          * "Notification Centers" @ developer.apple.com
          * A notification center delivers notifications to observers synchronously. In other words,
@@ -330,29 +483,26 @@ static JRCaptureData *singleton = nil;
             ALog(@"Error downloading flow: %@", e);
             NSNotification *notification = [NSNotification notificationWithName:JRDownloadFlowResult object:e];
             [[NSNotificationQueue defaultQueue] enqueueNotification:notification postingStyle:NSPostWhenIdle];
+            if (completion) completion(e);
             return;
         }
         DLog(@"Fetched flow URL: %@", flowUrlString);
-        NSError *error = [self processFlow:data response:(NSHTTPURLResponse *) response];
+        NSError *error = [self processParsedFlow:parsedFlow response:(NSHTTPURLResponse *) response];
         NSNotification *notification = [NSNotification notificationWithName:JRDownloadFlowResult object:error];
         [[NSNotificationQueue defaultQueue] enqueueNotification:notification postingStyle:NSPostWhenIdle];
+        if (completion) completion(error);
     }];
-    
-    [task resume];
 }
 
-- (NSError *)processFlow:(NSData *)flowData response:(NSHTTPURLResponse *)response
+/* parsedFlow is the NSError from the parser if the body wasn't JSON */
+- (NSError *)processParsedFlow:(id)parsedFlow response:(NSHTTPURLResponse *)response
 {
-    NSError *jsonErr = nil;
-    NSObject *parsedFlow = [NSJSONSerialization JSONObjectWithData:flowData options:(NSJSONReadingOptions) 0
-                                                             error:&jsonErr];
-
-    if (jsonErr)
+    if ([parsedFlow isKindOfClass:[NSError class]])
     {
         NSString *responseString = [NSHTTPURLResponse localizedStringForStatusCode:[response statusCode]];
         ALog(@"Error parsing flow JSON, response: %@", responseString);
-        ALog(@"Error parsing flow JSON, err: %@", [jsonErr description]);
-        return jsonErr;
+        ALog(@"Error parsing flow JSON, err: %@", [parsedFlow description]);
+        return parsedFlow;
     }
     
     if (![parsedFlow isKindOfClass:[NSDictionary class]])
@@ -377,52 +527,10 @@ static JRCaptureData *singleton = nil;
 
 - (void)writeCaptureFlow
 {
-    [[NSUserDefaults standardUserDefaults] setValue:[NSKeyedArchiver archivedDataWithRootObject:[captureFlow dictionary]]
-                                             forKey:FLOW_KEY];
-}
-
-+ (NSString *)serviceNameForTokenName:(NSString *)tokenName
-{
-    return [NSString stringWithFormat:@"%@.%@.%@.", cJRCaptureKeychainIdentifier, tokenName,
-                     appBundleDisplayNameAndIdentifier()];
-}
-
-+ (void)deleteTokenNameFromKeychain:(NSString *)name
-{
-    [SFHFKeychainUtils deleteItemForUsername:cJRCaptureKeychainUserName
-                              andServiceName:[JRCaptureData serviceNameForTokenName:name]
-                                       error:nil];
-}
-
-+ (void)storeTokenInKeychain:(NSString *)token name:(NSString *)name
-{
-    NSError *error = nil;
-
-    [SFHFKeychainUtils storeUsername:cJRCaptureKeychainUserName andPassword:token
-                      forServiceName:[JRCaptureData serviceNameForTokenName:name]
-                      updateExisting:YES error:&error];
-
-    if (error)
-    {
-        ALog (@"Error storing device token in keychain: %@", [error localizedDescription]);
-    }
-}
-
-+ (void)saveNewToken:(NSString *)token ofType:(JRTokenType)tokenType
-{
-    NSString *name = tokenType == JRTokenTypeAccess ? @"access_token" : @"refresh_secret";
-    [JRCaptureData deleteTokenNameFromKeychain:name];
-
-    if (tokenType == JRTokenTypeAccess)
-    {
-        [JRCaptureData sharedCaptureData].accessToken = token;
-    }
-    else if (tokenType == JRTokenTypeRefresh)
-    {
-        [JRCaptureData sharedCaptureData].refreshSecret = token;
-    }
-
-    [JRCaptureData storeTokenInKeychain:token name:name];
+    JR_STAGE_BEGIN(JRStageArchive);
+    NSData *archivedFlow = [NSKeyedArchiver archivedDataWithRootObject:[captureFlow dictionary]];
+    JR_STAGE_END(JRStageArchive);
+    [[NSUserDefaults standardUserDefaults] setValue:archivedFlow forKey:FLOW_KEY];
 }
 
 + (void)setCaptureRedirectUri:(NSString *)captureRedirectUri
@@ -432,7 +540,16 @@ static JRCaptureData *singleton = nil;
 
 + (void)setAccessToken:(NSString *)token
 {
-    [JRCaptureData saveNewToken:token ofType:JRTokenTypeAccess];
+    JRCaptureData *captureData = [JRCaptureData sharedCaptureData];
+    NSMutableDictionary *tokens = [NSMutableDictionary dictionaryWithObject:(token ? token : [NSNull null])
+                                                                     forKey:ACCESS_TOKEN_NAME];
+
+    /* A sign-in's token and the secret it was requested with go to the keychain together, or not at all */
+    if (token && captureData.pendingRefreshSecret)
+        [tokens setObject:captureData.pendingRefreshSecret forKey:REFRESH_SECRET_NAME];
+    captureData.pendingRefreshSecret = nil;
+
+    [captureData.tokenStore setTokens:tokens];
 }
 
 + (NSString *)captureBaseUrl __unused
@@ -455,10 +572,8 @@ static JRCaptureData *singleton = nil;
 
 + (void)clearSignInState
 {
-    [JRCaptureData deleteTokenNameFromKeychain:@"access_token"];
-    [JRCaptureData deleteTokenNameFromKeychain:@"refresh_secret"];
-    [JRCaptureData sharedCaptureData].accessToken = nil;
-    [JRCaptureData sharedCaptureData].refreshSecret = nil;
+    [JRCaptureData sharedCaptureData].pendingRefreshSecret = nil;
+    [[JRCaptureData sharedCaptureData].tokenStore removeAllTokens];
 }
 
 + (NSMutableURLRequest *)requestWithPath:(NSString *)path
@@ -202,6 +202,12 @@ typedef enum
 
 + (JRCaptureError *)invalidApiResponseErrorWithString:(NSString *)rawResponse;
 + (JRCaptureError *)invalidApiResponseErrorWithObject:(id)rawResponse;
+
+/*
+ *  Builds the same error a server-side form validation failure (code 390) produces, for forms that failed the
+ *  flow's validation rules locally. invalidFields maps field names to arrays of failure messages.
+ */
++ (JRCaptureError *)formValidationErrorWithInvalidFields:(NSDictionary *)invalidFields;
 @end
 
 /**
@@ -174,6 +174,18 @@ static NSString *const ENGAGE_TOKEN_KEY = @"merge_token";
     return [JRCaptureError errorFromResult:result onProvider:nil engageToken:nil];
 }
 
++ (JRCaptureError *)formValidationErrorWithInvalidFields:(NSDictionary *)invalidFields
+{
+    NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:
+                                                 @"error", @"stat",
+                                                 @"invalid_form_fields", @"error",
+                                                 @"The form contains invalid fields", @"error_description",
+                                                 [NSNumber numberWithInteger:390], @"code",
+                                                 invalidFields, @"invalid_fields",
+                                                 nil];
+    return [JRCaptureError errorFromResult:result onProvider:nil engageToken:nil];
+}
+
 + (JRCaptureError *)errorWithErrorString:(NSString *)error code:(NSInteger)code description:(NSString *)description
                              extraFields:(NSDictionary *)extraFields
 {
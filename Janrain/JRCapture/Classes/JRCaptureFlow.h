@@ -31,6 +31,7 @@
 
 #import <Foundation/Foundation.h>
 
+@class JRCaptureFormValidator;
 
 @interface JRCaptureFlow : NSObject
 + (JRCaptureFlow *)flowWithDictionary:(NSDictionary *)dictionary;
@@ -40,4 +41,9 @@
 - (id)schemaIdForFieldName:(NSString *)fieldName;
 - (NSMutableDictionary *)fieldsForForm:(NSString *)form fromDictionary:(NSDictionary *)dict;
 - (NSString *)userIdentifyingFieldForForm:(NSString *)formName;
+
+/**
+ * The form's validation rules, compiled when the flow was loaded. Nil if the flow has no such form.
+ */
+- (JRCaptureFormValidator *)validatorForForm:(NSString *)formName;
 @end
\ No newline at end of file
@@ -30,9 +30,11 @@
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #import "JRCaptureFlow.h"
+#import "JRCaptureFormValidator.h"
 
 @interface JRCaptureFlow()
 @property (nonatomic, copy) NSDictionary *flowDict;
+@property (nonatomic, copy) NSDictionary *validators;
 @end
 
 @implementation JRCaptureFlow {
@@ -47,6 +49,7 @@
     self = [super init];
     if (self) {
         _flowDict = [dict copy];
+        _validators = [JRCaptureFormValidator validatorsForFlowFields:[_flowDict objectForKey:@"fields"]];
     }
 
     return self;
@@ -96,6 +99,10 @@
     return nil;
 }
 
+- (JRCaptureFormValidator *)validatorForForm:(NSString *)formName {
+    return formName ? [self.validators objectForKey:formName] : nil;
+}
+
 - (NSDictionary *)fields {
     return [self objectForKey:@"fields"];
 }
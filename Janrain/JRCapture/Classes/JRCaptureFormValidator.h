@@ -0,0 +1,64 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Runs a Capture flow form's client-checkable validation rules (required, minLength, maxLength, format/regex and
+ * match) over a dictionary of form field values, so an obviously invalid submission can be failed without a round
+ * trip. Rules the client can't check (e.g. unique) are skipped; the server is still the authority on everything that
+ * passes here.
+ *
+ * Validators are compiled once per flow, see JRCaptureFlow#validatorForForm:, and are immutable afterwards.
+ */
+@interface JRCaptureFormValidator : NSObject
+
+@property(nonatomic, readonly) NSString *formName;
+
+/** Number of compiled rules across all of the form's fields */
+@property(nonatomic, readonly) NSUInteger ruleCount;
+
+/**
+ * Compiles a validator for every form in a flow's "fields" dictionary, keyed by form name.
+ */
++ (NSDictionary *)validatorsForFlowFields:(NSDictionary *)flowFields;
+
+- (id)initWithFormName:(NSString *)formName flowFields:(NSDictionary *)flowFields;
+
+/**
+ * Validates form field values as built by JRCaptureUser#toFormFieldsForForm:withFlow:.
+ *
+ * @return
+ *   Nil if no rule failed, otherwise a dictionary of field name to an array of failure messages, in the same shape
+ *   as the "invalid_fields" of a server-side form validation error.
+ */
+- (NSDictionary *)invalidFieldsForFormFields:(NSDictionary *)formFields;
+@end
@@ -0,0 +1,301 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import "JRCaptureFormValidator.h"
+#import "debug_log.h"
+
+typedef enum
+{
+    JRFormRuleRequired,
+    JRFormRuleMinLength,
+    JRFormRuleMaxLength,
+    JRFormRuleFormat,
+    JRFormRuleMatch,
+} JRFormRuleKind;
+
+/* Named formats are deliberately lenient; a value the server would accept must never fail locally */
+static NSRegularExpression *JRNamedFormatRegex(NSString *formatName) {
+    static NSDictionary *namedFormats;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSDictionary *patterns = @{
+                @"email" : @"^[^@\\s]+@[^@\\s]+\\.[^@\\s]+$",
+                @"alphanumeric" : @"^[\\p{L}\\p{N}]*$",
+                @"numeric" : @"^[0-9]*$",
+        };
+        NSMutableDictionary *compiled = [NSMutableDictionary dictionary];
+        for (NSString *name in patterns) {
+            [compiled setObject:[NSRegularExpression regularExpressionWithPattern:[patterns objectForKey:name]
+                                                                          options:0 error:nil]
+                         forKey:name];
+        }
+        namedFormats = [compiled copy];
+    });
+
+    return [namedFormats objectForKey:formatName];
+}
+
+/* Accepts both bare patterns and the JavaScript literal form the flow uses for the web, e.g. "/^[a-z]+$/i" */
+static NSRegularExpression *JRRegexFromFlowPattern(NSString *pattern) {
+    NSRegularExpressionOptions options = 0;
+    NSRange lastSlash = [pattern rangeOfString:@"/" options:NSBackwardsSearch];
+
+    if ([pattern hasPrefix:@"/"] && lastSlash.location > 0) {
+        NSString *flags = [pattern substringFromIndex:lastSlash.location + 1];
+        if ([flags rangeOfString:@"i"].location != NSNotFound) options |= NSRegularExpressionCaseInsensitive;
+        if ([flags rangeOfString:@"m"].location != NSNotFound) options |= NSRegularExpressionAnchorsMatchLines;
+        pattern = [pattern substringWithRange:NSMakeRange(1, lastSlash.location - 1)];
+    }
+
+    NSError *error = nil;
+    NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:pattern options:options
+                                                                             error:&error];
+    if (!regex) ALog(@"Skipping uncompilable validation pattern %@: %@", pattern, error);
+    return regex;
+}
+
+static BOOL JRFormValueIsEmpty(id value) {
+    if (!value || value == [NSNull null]) return YES;
+    if (![value isKindOfClass:[NSString class]]) return NO;
+    return [[value stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]] length] == 0;
+}
+
+@interface JRCaptureFormRule : NSObject
+@property(nonatomic) JRFormRuleKind kind;
+@property(nonatomic) NSUInteger length;
+@property(nonatomic) NSRegularExpression *regex;
+@property(nonatomic, copy) NSString *otherField;
+@property(nonatomic, copy) NSString *message;
+@end
+
+@implementation JRCaptureFormRule
+@end
+
+@interface JRCaptureFormField : NSObject
+@property(nonatomic, copy) NSString *name;
+@property(nonatomic, copy) NSArray *rules;
+@end
+
+@implementation JRCaptureFormField
+@end
+
+@interface JRCaptureFormValidator ()
+@property(nonatomic, copy) NSString *formName;
+@property(nonatomic, copy) NSArray *fields;
+@end
+
+@implementation JRCaptureFormValidator
+
++ (NSDictionary *)validatorsForFlowFields:(NSDictionary *)flowFields {
+    if (![flowFields isKindOfClass:[NSDictionary class]]) return @{};
+
+    NSMutableDictionary *validators = [NSMutableDictionary dictionary];
+    NSMutableDictionary *compiledFields = [NSMutableDictionary dictionary];
+
+    for (NSString *name in flowFields) {
+        NSDictionary *form = [flowFields objectForKey:name];
+        if (![form isKindOfClass:[NSDictionary class]]) continue;
+        if (![[form objectForKey:@"fields"] isKindOfClass:[NSArray class]]) continue;
+
+        JRCaptureFormValidator *validator = [[JRCaptureFormValidator alloc] initWithFormName:name flowFields:flowFields
+                                                                              compiledFields:compiledFields];
+        [validators setObject:validator forKey:name];
+    }
+
+    return validators;
+}
+
+- (id)initWithFormName:(NSString *)formName flowFields:(NSDictionary *)flowFields {
+    return [self initWithFormName:formName flowFields:flowFields compiledFields:[NSMutableDictionary dictionary]];
+}
+
+/* compiledFields is shared across the forms of one flow so a field used by several forms is compiled once */
+- (id)initWithFormName:(NSString *)formName flowFields:(NSDictionary *)flowFields
+        compiledFields:(NSMutableDictionary *)compiledFields {
+    self = [super init];
+    if (self) {
+        _formName = [formName copy];
+
+        NSMutableArray *fields = [NSMutableArray array];
+        NSArray *fieldNames = [[flowFields objectForKey:formName] objectForKey:@"fields"];
+        if (![fieldNames isKindOfClass:[NSArray class]]) fieldNames = nil;
+
+        for (NSString *fieldName in fieldNames) {
+            if (![fieldName isKindOfClass:[NSString class]]) continue;
+
+            JRCaptureFormField *field = [compiledFields objectForKey:fieldName];
+            if (!field) {
+                field = [JRCaptureFormValidator compileField:fieldName fromDefinition:[flowFields objectForKey:fieldName]];
+                [compiledFields setObject:field forKey:fieldName];
+            }
+
+            if ([field.rules count]) {
+                [fields addObject:field];
+                _ruleCount += [field.rules count];
+            }
+        }
+
+        _fields = [fields copy];
+    }
+
+    return self;
+}
+
++ (JRCaptureFormField *)compileField:(NSString *)fieldName fromDefinition:(NSDictionary *)definition {
+    JRCaptureFormField *field = [[JRCaptureFormField alloc] init];
+    field.name = fieldName;
+
+    NSArray *validations = [definition isKindOfClass:[NSDictionary class]] ?
+            [definition objectForKey:@"validation"] : nil;
+    if (![validations isKindOfClass:[NSArray class]]) return field;
+
+    NSMutableArray *rules = [NSMutableArray array];
+    for (NSDictionary *validation in validations) {
+        if (![validation isKindOfClass:[NSDictionary class]]) continue;
+
+        JRCaptureFormRule *rule = [self compileRule:validation forField:fieldName];
+        if (rule) [rules addObject:rule];
+    }
+
+    field.rules = rules;
+    return field;
+}
+
++ (JRCaptureFormRule *)compileRule:(NSDictionary *)validation forField:(NSString *)fieldName {
+    NSString *ruleName = [validation objectForKey:@"rule"];
+    id value = [validation objectForKey:@"value"];
+    NSString *message = [validation objectForKey:@"message"];
+    if (![message isKindOfClass:[NSString class]]) message = nil;
+
+    JRCaptureFormRule *rule = [[JRCaptureFormRule alloc] init];
+
+    if ([ruleName isEqual:@"required"]) {
+        if ([value respondsToSelector:@selector(boolValue)] && ![value boolValue]) return nil;
+        rule.kind = JRFormRuleRequired;
+        rule.message = message ? message : [NSString stringWithFormat:@"%@ is required", fieldName];
+    } else if ([ruleName isEqual:@"minLength"] || [ruleName isEqual:@"maxLength"]) {
+        if (![value respondsToSelector:@selector(integerValue)] || [value integerValue] < 0) return nil;
+        BOOL isMin = [ruleName isEqual:@"minLength"];
+        rule.kind = isMin ? JRFormRuleMinLength : JRFormRuleMaxLength;
+        rule.length = (NSUInteger) [value integerValue];
+        rule.message = message ? message : [NSString stringWithFormat:@"%@ must be %@ %lu characters", fieldName,
+                                                                      isMin ? @"at least" : @"at most",
+                                                                      (unsigned long) rule.length];
+    } else if ([ruleName isEqual:@"format"] || [ruleName isEqual:@"regex"] || [ruleName isEqual:@"formatRegex"]) {
+        if (![value isKindOfClass:[NSString class]]) return nil;
+        rule.kind = JRFormRuleFormat;
+        rule.regex = [ruleName isEqual:@"format"] ? JRNamedFormatRegex(value) : nil;
+        if (!rule.regex && ([value hasPrefix:@"/"] || ![ruleName isEqual:@"format"])) {
+            rule.regex = JRRegexFromFlowPattern(value);
+        }
+        if (!rule.regex) return nil;
+        rule.message = message ? message : [NSString stringWithFormat:@"%@ is not in the correct format", fieldName];
+    } else if ([ruleName isEqual:@"match"]) {
+        if (![value isKindOfClass:[NSString class]]) return nil;
+        rule.kind = JRFormRuleMatch;
+        rule.otherField = value;
+        rule.message = message ? message : [NSString stringWithFormat:@"%@ does not match %@", fieldName, value];
+    } else {
+        /* unique, unicode letter checks, etc. are left to the server */
+        return nil;
+    }
+
+    return rule;
+}
+
+- (NSDictionary *)invalidFieldsForFormFields:(NSDictionary *)formFields {
+    NSMutableDictionary *invalidFields = nil;
+
+    for (JRCaptureFormField *field in self.fields) {
+        NSArray *messages = [self failedMessagesForField:field formFields:formFields];
+        if (![messages count]) continue;
+
+        if (!invalidFields) invalidFields = [NSMutableDictionary dictionary];
+        [invalidFields setObject:messages forKey:field.name];
+    }
+
+    return invalidFields;
+}
+
+- (NSArray *)failedMessagesForField:(JRCaptureFormField *)field formFields:(NSDictionary *)formFields {
+    id value = [formFields objectForKey:field.name];
+    BOOL isComposite = !value && [self hasSubscriptedValueForField:field.name formFields:formFields];
+    BOOL isEmpty = !isComposite && JRFormValueIsEmpty(value);
+    NSString *stringValue = isEmpty || isComposite ? nil :
+            ([value isKindOfClass:[NSString class]] ? value : [value description]);
+
+    NSMutableArray *messages = nil;
+    for (JRCaptureFormRule *rule in field.rules) {
+        BOOL failed = NO;
+
+        switch (rule.kind) {
+            case JRFormRuleRequired:
+                failed = isEmpty;
+                break;
+            case JRFormRuleMinLength:
+            case JRFormRuleMaxLength: {
+                if (!stringValue) break;
+                NSUInteger length = [stringValue lengthOfBytesUsingEncoding:NSUTF32StringEncoding] / 4;
+                failed = rule.kind == JRFormRuleMinLength ? length < rule.length : length > rule.length;
+                break;
+            }
+            case JRFormRuleFormat:
+                if (!stringValue) break;
+                failed = [rule.regex numberOfMatchesInString:stringValue options:0
+                                                       range:NSMakeRange(0, [stringValue length])] == 0;
+                break;
+            case JRFormRuleMatch: {
+                id otherValue = [formFields objectForKey:rule.otherField];
+                if (isEmpty && JRFormValueIsEmpty(otherValue)) break;
+                failed = isComposite || ![value isEqual:otherValue];
+                break;
+            }
+        }
+
+        if (!failed) continue;
+        if (!messages) messages = [NSMutableArray array];
+        [messages addObject:rule.message];
+    }
+
+    return messages;
+}
+
+/* Fields with a dictionary schemaId (e.g. dateselect) are posted as "name[subscript]" entries */
+- (BOOL)hasSubscriptedValueForField:(NSString *)fieldName formFields:(NSDictionary *)formFields {
+    NSString *prefix = [fieldName stringByAppendingString:@"["];
+    for (NSString *key in formFields) {
+        if (![key isKindOfClass:[NSString class]] || ![key hasPrefix:prefix]) continue;
+        if (!JRFormValueIsEmpty([formFields objectForKey:key])) return YES;
+    }
+
+    return NO;
+}
+
+@end
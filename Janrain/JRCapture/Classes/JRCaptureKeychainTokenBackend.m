@@ -0,0 +1,146 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Security/Security.h>
+#import "debug_log.h"
+#import "JRCaptureKeychainTokenBackend.h"
+
+static NSString *const JRCaptureKeychainTokenBackendErrorDomain = @"JRCaptureKeychainTokenBackendErrorDomain";
+
+@interface JRCaptureKeychainTokenBackend ()
+@property(nonatomic, copy) NSString *username;
+@property(nonatomic, copy) NSString *servicePrefix;
+@property(nonatomic, copy) NSString *serviceSuffix;
+@end
+
+@implementation JRCaptureKeychainTokenBackend
+@synthesize username;
+@synthesize servicePrefix;
+@synthesize serviceSuffix;
+
+- (id)initWithUsername:(NSString *)username_ servicePrefix:(NSString *)servicePrefix_
+         serviceSuffix:(NSString *)serviceSuffix_
+{
+    if ((self = [super init]))
+    {
+        self.username      = username_;
+        self.servicePrefix = servicePrefix_;
+        self.serviceSuffix = serviceSuffix_;
+    }
+
+    return self;
+}
+
+- (NSMutableDictionary *)queryForTokenName:(NSString *)tokenName
+{
+    NSString *serviceName = [NSString stringWithFormat:@"%@%@%@", self.servicePrefix, tokenName, self.serviceSuffix];
+
+    return [NSMutableDictionary dictionaryWithObjectsAndKeys:
+                                        (__bridge id) kSecClassGenericPassword, (__bridge id) kSecClass,
+                                        self.username, (__bridge id) kSecAttrAccount,
+                                        serviceName, (__bridge id) kSecAttrService, nil];
+}
+
+- (NSDictionary *)tokensForNames:(NSArray *)tokenNames
+{
+    NSMutableDictionary *tokens = [NSMutableDictionary dictionaryWithCapacity:[tokenNames count]];
+
+    for (NSString *tokenName in tokenNames)
+    {
+        /* Ask for the data straight away, rather than looking the item up and then fetching its data */
+        NSMutableDictionary *query = [self queryForTokenName:tokenName];
+        [query setObject:(__bridge id) kCFBooleanTrue forKey:(__bridge id) kSecReturnData];
+
+        CFTypeRef result = NULL;
+        OSStatus status = SecItemCopyMatching((__bridge CFDictionaryRef) query, &result);
+        NSData *data = (__bridge_transfer NSData *) result;
+
+        if (status != errSecSuccess)
+        {
+            if (status != errSecItemNotFound) ALog(@"Error reading %@ from keychain: %d", tokenName, (int) status);
+            continue;
+        }
+
+        NSString *token = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+        if (token)
+            [tokens setObject:token forKey:tokenName];
+    }
+
+    return tokens;
+}
+
+- (OSStatus)writeToken:(NSString *)token forName:(NSString *)tokenName
+{
+    NSMutableDictionary *query = [self queryForTokenName:tokenName];
+
+    if ((id) token == [NSNull null])
+    {
+        OSStatus status = SecItemDelete((__bridge CFDictionaryRef) query);
+        return status == errSecItemNotFound ? errSecSuccess : status;
+    }
+
+    NSData *data = [token dataUsingEncoding:NSUTF8StringEncoding];
+
+    /* Existing items are updated in place, so the common case is a single keychain call */
+    NSDictionary *attributes = [NSDictionary dictionaryWithObject:data forKey:(__bridge id) kSecValueData];
+    OSStatus status = SecItemUpdate((__bridge CFDictionaryRef) query, (__bridge CFDictionaryRef) attributes);
+    if (status != errSecItemNotFound)
+        return status;
+
+    [query setObject:data forKey:(__bridge id) kSecValueData];
+    [query setObject:[query objectForKey:(__bridge id) kSecAttrService] forKey:(__bridge id) kSecAttrLabel];
+    [query setObject:(__bridge id) kSecAttrAccessibleWhenUnlockedThisDeviceOnly
+              forKey:(__bridge id) kSecAttrAccessible];
+
+    return SecItemAdd((__bridge CFDictionaryRef) query, NULL);
+}
+
+- (BOOL)writeTokens:(NSDictionary *)tokens error:(NSError **)error
+{
+    OSStatus lastError = errSecSuccess;
+
+    for (NSString *tokenName in tokens)
+    {
+        OSStatus status = [self writeToken:[tokens objectForKey:tokenName] forName:tokenName];
+        if (status != errSecSuccess)
+            lastError = status;
+    }
+
+    if (lastError != errSecSuccess)
+    {
+        if (error)
+            *error = [NSError errorWithDomain:JRCaptureKeychainTokenBackendErrorDomain code:lastError userInfo:nil];
+        return NO;
+    }
+
+    return YES;
+}
+@end
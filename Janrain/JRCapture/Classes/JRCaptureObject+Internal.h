@@ -35,6 +35,7 @@
 
 @interface NSArray (JRArray_StringArray)
 - (NSArray *)arrayOfStringsFromStringPluralDictionariesWithType:(NSString *)type;
+- (NSUInteger)captureObjectElementsHash;
 @end
 
 @class JRCaptureObject;
@@ -76,6 +77,7 @@ didSucceedWithResult:(NSString *)result context:(NSObject *)context;
 @interface JRCaptureObject (Private) <NSCoding>
 @property(readwrite, nonatomic) NSString *captureObjectPath;
 @property(readwrite, nonatomic) NSMutableSet *dirtyPropertySet;
+@property(readwrite) NSSet *sharedPropertySet;
 @property(readwrite) BOOL canBeUpdatedOnCapture;
 
 - (NSDictionary *)newDictionaryForEncoder:(BOOL)forEncoder;
@@ -83,6 +85,18 @@ didSucceedWithResult:(NSString *)result context:(NSObject *)context;
 - (NSDictionary *)toReplaceDictionary;
 - (NSDictionary *)objectProperties;
 
+- (NSSet *)copyOnWritePropertySet;
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName;
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName;
+- (id)claimValue:(id)value forProperty:(NSString *)propertyName;
+- (void)unshareProperty:(NSString *)propertyName;
+- (void)willChangeProperty:(NSString *)propertyName;
+- (void)willMutate;
+
+@property(readonly) BOOL cachedContentHashIsValid;
+- (NSUInteger)contentHash;
+- (void)invalidateContentHash;
+
 - (NSSet *)updatablePropertySet;
 - (void)setAllPropertiesToDirty;
 - (void)deepClearDirtyProperties;
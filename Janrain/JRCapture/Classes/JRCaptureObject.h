@@ -137,8 +137,22 @@
 /**
  * @brief
  * Base class for all Capture objects and plural elements
+ *
+ * @note
+ * Copies are cheap: a copy shares its sub-objects and plural elements with the original. Reading, archiving or
+ * comparing either side duplicates nothing. A sub-object or plural element is duplicated for the copy just before it
+ * is changed through the original, or the first time it is handed out by the copy's getter.
+ *
+ * @note
+ * Capture objects compare by content: \c isEqual: uses the generated <code>isEqualTo&lt;<em>ObjectName</em>&gt;:</code>
+ * methods, and \c hash agrees with them. An object's hash is cached until it, or one of its sub-objects or plural
+ * elements, changes, so repeated comparisons of unchanged objects return early on a hash mismatch.
+ *
+ * @warning
+ * Because the hash follows the content, it changes whenever the object is edited. Don't keep Capture objects you are
+ * still editing in an \e NSSet or use them as \e NSDictionary keys; put a copy in instead, and leave it alone.
  **/
-@interface JRCaptureObject : NSObject
+@interface JRCaptureObject : NSObject <NSCopying>
 /**
  * \c YES if this object can be updated on Capture with the method JRCaptureObject#updateOnCaptureForDelegate:context:().
  * \c NO if it can't. Always \c YES if the object or any of its ancestors are \e not elements of a plural.
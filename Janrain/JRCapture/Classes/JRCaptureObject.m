@@ -37,6 +37,7 @@
 #import "JRCaptureData.h"
 #import "JRCaptureError.h"
 #import "JRJsonUtils.h"
+#import "JRStageMetrics.h"
 
 @implementation NSArray (JRArray_StringArray)
 // TODO: Test this!
@@ -57,6 +58,16 @@
 
     return filteredStringArray;
 }
+
+/* Combines the elements' hashes in order; an empty array hashes to 0, the same as a nil one */
+- (NSUInteger)captureObjectElementsHash
+{
+    NSUInteger hash = 0;
+    for (NSObject *element in self)
+        hash = hash * 31 + [element hash];
+
+    return hash;
+}
 @end
 
 @interface JRCaptureObjectApidHandler : NSObject <JRCaptureInternalDelegate>
@@ -370,8 +381,27 @@
 @property(nonatomic, readwrite) NSString *captureObjectPath;
 @property(readwrite) BOOL canBeUpdatedOnCapture;
 @property(nonatomic, readwrite) NSMutableSet *dirtyPropertySet;
+@property(readwrite) NSSet *sharedPropertySet;
+@property(nonatomic, weak) JRCaptureObject *parentObject;
+@property(nonatomic, copy) NSString *parentPropertyName;
+@property(nonatomic) NSHashTable *sharingObjects;
+@property NSUInteger cachedContentHash;
+@property BOOL cachedContentHashIsValid;
 @end
 
+/* Guards the sharing bookkeeping, which a change to one object can carry into its parents and their copies. It's
+   recursive because detaching a sharer copies sub-objects, which registers the copies with the objects they share. */
+static NSRecursiveLock *JRCaptureSharingLock()
+{
+    static NSRecursiveLock *sharingLock;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharingLock = [[NSRecursiveLock alloc] init];
+    });
+
+    return sharingLock;
+}
+
 @implementation JRCaptureObject
 - (id)init
 {
@@ -382,22 +412,233 @@
     return self;
 }
 
-- (id)copyWithZone:(NSZone*)zone __unused
+/* Used by copyWithZone: so that the subclass's init doesn't allocate sub-objects that the copy is just going to
+   replace with the original's */
+- (id)initForCopy
 {
-    JRCaptureObject *objectCopy = [[[self class] allocWithZone:zone] init];
+    if ((self = [super init]))
+    {
+        self.dirtyPropertySet = [NSMutableSet setWithCapacity:0];
+    }
+    return self;
+}
 
-    for (NSString *dirtyProperty in [self.dirtyPropertySet allObjects])
-        [objectCopy.dirtyPropertySet addObject:dirtyProperty];
+/* Copies are shallow until written: the generated subclasses hand the copy the same sub-objects and plural arrays
+   as the original, and the copy marks those properties as shared. The original keeps owning them, so reading,
+   archiving or comparing either side never duplicates anything. What gets duplicated, and when:
+     - Before an owned sub-object or plural element changes, it tells its parent, and the parent hands every copy still
+       sharing it a copy of its own (see willMutateChild:ofProperty:).
+     - The first time the copy's getter hands out a shared property, the copy takes its own shallow copy of it (see
+       unshareProperty:). The caller may be about to change what it was handed, and by then it would be too late to
+       tell which side the change was meant for.
+   Leaf values (strings, numbers, dates, string plurals) are immutable and stay shared. */
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRCaptureObject *objectCopy = [[[self class] allocWithZone:zone] initForCopy];
+
+    [objectCopy.dirtyPropertySet setSet:self.dirtyPropertySet];
 
     objectCopy.captureObjectPath      = self.captureObjectPath;
     objectCopy.canBeUpdatedOnCapture  = self.canBeUpdatedOnCapture;
 
+    [JRCaptureSharingLock() lock];
+    objectCopy.sharedPropertySet = [self copyOnWritePropertySet];
+
+    if (!self.sharingObjects)
+        self.sharingObjects = [NSHashTable weakObjectsHashTable];
+
+    [self.sharingObjects addObject:objectCopy];
+    [JRCaptureSharingLock() unlock];
+
+    objectCopy.cachedContentHash        = self.cachedContentHash;
+    objectCopy.cachedContentHashIsValid = self.cachedContentHashIsValid;
+
     return objectCopy;
 }
 
+- (NSSet *)copyOnWritePropertySet
+{
+    [NSException raise:NSInternalInconsistencyException
+                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    return nil;
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    [NSException raise:NSInternalInconsistencyException
+                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    [NSException raise:NSInternalInconsistencyException
+                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+}
+
+/* Points a sub-object, or each element of a plural, back at this object, so that it can tell this object before it
+   changes. One that already belongs to another object, or to another property, is copied rather than taken from its
+   owner, which would stop hearing about its changes. Returns what was claimed. */
+- (id)claimValue:(id)value forProperty:(NSString *)propertyName
+{
+    if ([value isKindOfClass:[JRCaptureObject class]])
+    {
+        JRCaptureObject *owner = [value parentObject];
+        if (owner && (owner != self || ![[value parentPropertyName] isEqualToString:propertyName]))
+            value = [value copy];
+
+        [value setParentObject:self];
+        [value setParentPropertyName:propertyName];
+    }
+    else if ([value isKindOfClass:[NSArray class]])
+    {
+        NSMutableArray *elements = nil;
+        NSUInteger index = 0;
+        for (id element in (NSArray *)value)
+        {
+            id claimed = [self claimValue:element forProperty:propertyName];
+            if (claimed != element && !elements)
+                elements = [(NSArray *)value mutableCopy];
+            [elements replaceObjectAtIndex:index withObject:claimed];
+            index++;
+        }
+
+        if (elements)
+            value = [elements copy];
+    }
+
+    return value;
+}
+
+- (void)removeSharedProperty:(NSString *)propertyName
+{
+    if (![self.sharedPropertySet containsObject:propertyName])
+        return;
+
+    NSMutableSet *sharedPropertySet = [self.sharedPropertySet mutableCopy];
+    [sharedPropertySet removeObject:propertyName];
+    self.sharedPropertySet = [sharedPropertySet count] ? [sharedPropertySet copy] : nil;
+}
+
+/* Called by the getters of a copy that's still sharing the property, see copyWithZone: */
+- (void)unshareProperty:(NSString *)propertyName
+{
+    [JRCaptureSharingLock() lock];
+    if ([self.sharedPropertySet containsObject:propertyName])
+    {
+        id value = [self valueForCopyOnWriteProperty:propertyName];
+
+        if ([value isKindOfClass:[JRCaptureObject class]])
+        {
+            value = [value copy];
+        }
+        else if ([value isKindOfClass:[NSArray class]])
+        {
+            /* Elements already handed to this object by willMutateChild:ofProperty: are its own */
+            NSMutableArray *elements = [NSMutableArray arrayWithCapacity:[(NSArray *)value count]];
+            for (id element in (NSArray *)value)
+                [elements addObject:[element isKindOfClass:[JRCaptureObject class]] && [element parentObject] != self ?
+                        [element copy] : element];
+
+            value = [elements copy];
+        }
+
+        [self setValue:[self claimValue:value forProperty:propertyName] forCopyOnWriteProperty:propertyName];
+        [self removeSharedProperty:propertyName];
+    }
+    [JRCaptureSharingLock() unlock];
+}
+
+- (void)willChangeProperty:(NSString *)propertyName
+{
+    [JRCaptureSharingLock() lock];
+    [self removeSharedProperty:propertyName];
+    [self willMutate];
+    [JRCaptureSharingLock() unlock];
+
+    [self invalidateContentHash];
+}
+
+/* Called before anything but a property value changes, e.g. the dirty properties */
+- (void)willMutate
+{
+    [JRCaptureSharingLock() lock];
+    [self.parentObject willMutateChild:self ofProperty:self.parentPropertyName];
+    [JRCaptureSharingLock() unlock];
+}
+
+- (void)willMutateChild:(JRCaptureObject *)child ofProperty:(NSString *)propertyName
+{
+    /* A change to a sub-object or plural element changes this object's hash too */
+    [self invalidateContentHash];
+
+    /* The parent goes first, so that by the time this object's copies are detached from the child, they're no longer
+       sharing this object with anybody either */
+    [self willMutate];
+
+    for (JRCaptureObject *sharer in [self.sharingObjects allObjects])
+        [sharer stopSharingChild:child ofProperty:propertyName];
+}
+
+- (void)stopSharingChild:(JRCaptureObject *)child ofProperty:(NSString *)propertyName
+{
+    if ([self.sharedPropertySet containsObject:propertyName])
+    {
+        id value = [self valueForCopyOnWriteProperty:propertyName];
+
+        if (value == child)
+        {
+            [self setValue:[self claimValue:[child copy] forProperty:propertyName] forCopyOnWriteProperty:propertyName];
+            [self removeSharedProperty:propertyName];
+        }
+        else if ([value isKindOfClass:[NSArray class]])
+        {
+            /* Only the element being changed is duplicated; the rest of the plural stays shared */
+            NSUInteger index = [(NSArray *)value indexOfObjectIdenticalTo:child];
+            if (index != NSNotFound)
+            {
+                NSMutableArray *elements = [value mutableCopy];
+                [elements replaceObjectAtIndex:index withObject:[self claimValue:[child copy] forProperty:propertyName]];
+                [self setValue:[elements copy] forCopyOnWriteProperty:propertyName];
+            }
+        }
+    }
+
+    /* Copies of this copy may still be sharing the child too */
+    for (JRCaptureObject *sharer in [self.sharingObjects allObjects])
+        [sharer stopSharingChild:child ofProperty:propertyName];
+}
+
+- (NSUInteger)contentHash
+{
+    [NSException raise:NSInternalInconsistencyException
+                format:@"You must override %@ in a subclass", NSStringFromSelector(_cmd)];
+    return 0;
+}
+
+/* Only this object and its parents are invalidated, through willChangeProperty: and willMutateChild:ofProperty:.
+   Copies that share sub-objects with it keep their hashes, as whatever they share is unchanged for them. */
+- (void)invalidateContentHash
+{
+    self.cachedContentHashIsValid = NO;
+}
+
+- (NSUInteger)hash
+{
+    if (!self.cachedContentHashIsValid)
+    {
+        self.cachedContentHash        = [self contentHash];
+        self.cachedContentHashIsValid = YES;
+    }
+
+    return self.cachedContentHash;
+}
+
 - (void)encodeWithCoder:(NSCoder *)coder
 {
+    JR_STAGE_BEGIN(JRStageModelEncode);
     NSDictionary *dictionary = [self newDictionaryForEncoder:YES];
+    JR_STAGE_END(JRStageModelEncode);
     [coder encodeObject:dictionary forKey:cJREncodedCaptureUser];
 }
 
@@ -471,6 +712,7 @@
 
 - (void)deepClearDirtyProperties
 {
+    [self willMutate];
     [self.dirtyPropertySet removeAllObjects];
     unsigned int pCount;
     objc_property_t *properties = class_copyPropertyList([self class], &pCount);
@@ -538,7 +780,9 @@
                                                      delegate, @"delegate",
                                                      context, @"callerContext", nil];
 
+    JR_STAGE_BEGIN(JRStageUpdateDictionary);
     NSDictionary *updateDictionary = [self toUpdateDictionary];
+    JR_STAGE_END(JRStageUpdateDictionary);
 
 //    /* Removing the objects from the set here, because if there's an error, they will all get put back anyway... */
 //    [dirtyPropertySet removeAllObjects];
@@ -587,7 +831,11 @@
         return;
     }
 
-    [JRCaptureApidInterface replaceCaptureObject:[self toReplaceDictionary]
+    JR_STAGE_BEGIN(JRStageReplaceDictionary);
+    NSDictionary *replaceDictionary = [self toReplaceDictionary];
+    JR_STAGE_END(JRStageReplaceDictionary);
+
+    [JRCaptureApidInterface replaceCaptureObject:replaceDictionary
                                           atPath:self.captureObjectPath
                                        withToken:[[JRCaptureData sharedCaptureData] accessToken]
                                      forDelegate:[JRCaptureObjectApidHandler captureObjectApidHandler]
@@ -739,7 +987,7 @@
             if (![otherProp isKindOfClass:[NSArray class]] || [otherProp count] != [prop count]) return NO;
             for (id element in ((NSArray *) prop))
             {
-                id element_ = [((NSArray *) otherProp) objectAtIndex:[((NSArray *) prop) indexOfObject:element]];
+                id element_ = [((NSArray *) otherProp) objectAtIndex:[((NSArray *) prop) indexOfObjectIdenticalTo:element]];
                 if ([element isKindOfClass:[JRCaptureObject class]])
                     if (![((JRCaptureObject *) element) isEqualByPrivateProperties:element_]) return NO;
             }
@@ -0,0 +1,82 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Where a JRCaptureTokenStore persists its tokens. Backends only see writes that change something; reads happen once,
+ * when the store is created.
+ */
+@protocol JRCaptureTokenStoreBackend <NSObject>
+/**
+ * Returns the persisted value of each of the named tokens, leaving out any that aren't stored
+ */
+- (NSDictionary *)tokensForNames:(NSArray *)tokenNames;
+
+/**
+ * Persists every token in the dictionary in one go. A value of [NSNull null] removes that token.
+ */
+- (BOOL)writeTokens:(NSDictionary *)tokens error:(NSError **)error;
+@end
+
+/**
+ * @internal
+ * Stands in for the keychain where it isn't available (tests, benchmarks); tokens are kept in a property list file.
+ */
+@interface JRCaptureFileTokenBackend : NSObject <JRCaptureTokenStoreBackend>
+@property(nonatomic, readonly) NSString *path;
+
+- (id)initWithPath:(NSString *)path;
+@end
+
+/**
+ * @internal
+ * Write-through in-memory cache of the Capture tokens. Reads never touch the backend after the store is created, and
+ * each write goes to the backend once, with unchanged tokens skipped. A write the backend fails leaves the cache as it
+ * was, and returns NO.
+ */
+@interface JRCaptureTokenStore : NSObject
+@property(nonatomic, readonly) id <JRCaptureTokenStoreBackend> backend;
+
+- (id)initWithBackend:(id <JRCaptureTokenStoreBackend>)backend tokenNames:(NSArray *)tokenNames;
+
+- (NSString *)tokenForName:(NSString *)tokenName;
+
+- (BOOL)setToken:(NSString *)token forName:(NSString *)tokenName;
+
+/**
+ * Sets several tokens with a single backend write. A value of [NSNull null] removes that token.
+ */
+- (BOOL)setTokens:(NSDictionary *)tokens;
+
+- (BOOL)removeAllTokens;
+@end
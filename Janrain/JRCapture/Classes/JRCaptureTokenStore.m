@@ -0,0 +1,158 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "debug_log.h"
+#import "JRCaptureTokenStore.h"
+
+@implementation JRCaptureFileTokenBackend
+@synthesize path;
+
+- (id)initWithPath:(NSString *)path_
+{
+    if ((self = [super init]))
+    {
+        path = [path_ copy];
+    }
+
+    return self;
+}
+
+- (NSDictionary *)tokensForNames:(NSArray *)tokenNames
+{
+    NSDictionary *stored = [NSDictionary dictionaryWithContentsOfFile:self.path];
+    NSMutableDictionary *tokens = [NSMutableDictionary dictionaryWithCapacity:[tokenNames count]];
+
+    for (NSString *tokenName in tokenNames)
+        if ([stored objectForKey:tokenName])
+            [tokens setObject:[stored objectForKey:tokenName] forKey:tokenName];
+
+    return tokens;
+}
+
+- (BOOL)writeTokens:(NSDictionary *)tokens error:(NSError **)error
+{
+    NSMutableDictionary *stored = [NSMutableDictionary dictionaryWithContentsOfFile:self.path];
+    if (!stored)
+        stored = [NSMutableDictionary dictionaryWithCapacity:[tokens count]];
+
+    for (NSString *tokenName in tokens)
+    {
+        id token = [tokens objectForKey:tokenName];
+        if (token == [NSNull null])
+            [stored removeObjectForKey:tokenName];
+        else
+            [stored setObject:token forKey:tokenName];
+    }
+
+    NSData *data = [NSPropertyListSerialization dataWithPropertyList:stored format:NSPropertyListBinaryFormat_v1_0
+                                                             options:0 error:error];
+
+    return data && [data writeToFile:self.path options:NSDataWritingAtomic error:error];
+}
+@end
+
+@interface JRCaptureTokenStore ()
+@property(nonatomic, readwrite) id <JRCaptureTokenStoreBackend> backend;
+@property(nonatomic) NSMutableDictionary *tokens;
+@end
+
+@implementation JRCaptureTokenStore
+@synthesize backend;
+@synthesize tokens;
+
+- (id)initWithBackend:(id <JRCaptureTokenStoreBackend>)backend_ tokenNames:(NSArray *)tokenNames
+{
+    if ((self = [super init]))
+    {
+        self.backend = backend_;
+        self.tokens  = [NSMutableDictionary dictionaryWithDictionary:[backend_ tokensForNames:tokenNames]];
+    }
+
+    return self;
+}
+
+- (NSString *)tokenForName:(NSString *)tokenName
+{
+    return [self.tokens objectForKey:tokenName];
+}
+
+- (BOOL)setToken:(NSString *)token forName:(NSString *)tokenName
+{
+    return [self setTokens:[NSDictionary dictionaryWithObject:(token ? token : [NSNull null]) forKey:tokenName]];
+}
+
+- (BOOL)setTokens:(NSDictionary *)newTokens
+{
+    NSMutableDictionary *changedTokens = [NSMutableDictionary dictionaryWithCapacity:[newTokens count]];
+
+    for (NSString *tokenName in newTokens)
+    {
+        id token = [newTokens objectForKey:tokenName];
+        id oldToken = [self.tokens objectForKey:tokenName];
+
+        if (token == [NSNull null] && !oldToken) continue;
+        if ([token isEqual:oldToken]) continue;
+
+        [changedTokens setObject:token forKey:tokenName];
+    }
+
+    if (![changedTokens count])
+        return YES;
+
+    /* The cache only takes the new tokens once they're persisted, so it never holds tokens the next launch won't */
+    NSError *error = nil;
+    if (![self.backend writeTokens:changedTokens error:&error])
+    {
+        ALog(@"Error storing tokens: %@", [error localizedDescription]);
+        return NO;
+    }
+
+    for (NSString *tokenName in changedTokens)
+    {
+        id token = [changedTokens objectForKey:tokenName];
+        if (token == [NSNull null])
+            [self.tokens removeObjectForKey:tokenName];
+        else
+            [self.tokens setObject:token forKey:tokenName];
+    }
+
+    return YES;
+}
+
+- (BOOL)removeAllTokens
+{
+    NSMutableDictionary *removedTokens = [NSMutableDictionary dictionaryWithCapacity:[self.tokens count]];
+    for (NSString *tokenName in self.tokens)
+        [removedTokens setObject:[NSNull null] forKey:tokenName];
+
+    return [self setTokens:removedTokens];
+}
+@end
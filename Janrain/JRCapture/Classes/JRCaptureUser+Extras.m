@@ -36,6 +36,7 @@
 #import "JRCaptureError.h"
 #import "JRCaptureObject+Internal.h"
 #import "JRCaptureFlow.h"
+#import "JRStageMetrics.h"
 
 @interface JRCaptureUserApidHandler : NSObject <JRCaptureInternalDelegate>
 @end
@@ -104,9 +105,11 @@
 
 + (id)captureUserObjectFromDictionary:(NSDictionary *)dictionary
 {
+    JR_STAGE_BEGIN(JRStageModelBuild);
     JRCaptureUser *user = [JRCaptureUser captureUserObjectFromDictionary:dictionary withPath:@""];
     // MOB-143, clear DPS on all sub-objects
     [user deepClearDirtyProperties];
+    JR_STAGE_END(JRStageModelBuild);
     return user;
 }
 
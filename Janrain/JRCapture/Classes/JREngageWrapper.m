@@ -37,6 +37,7 @@
 #import "JRTraditionalSigninViewController.h"
 #import "JRCapture.h"
 #import "JRJsonUtils.h"
+#import "JRTracer.h"
 
 typedef enum {
     JREngageDialogStateAuthentication,
@@ -156,6 +157,7 @@ static JREngageWrapper *singleton = nil;
                                          withRedirectUri:(NSString *)redirectUri
                                        forAccountLinking:(BOOL)linkAccount
 {
+    [[JRTracer sharedTracer] startTraceWithName:linkAccount ? @"link_account" : @"signin.social"];
     [JREngage updateTokenUrl:[JRCaptureData captureTokenUrlWithMergeToken:nil forAccountLinking:linkAccount delegate:delegate ]];
     
     JREngageWrapper *wrapper = [JREngageWrapper singletonInstance];
@@ -232,6 +234,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
                                   mergeToken:(NSString *)mergeToken
                                  forDelegate:(id <JRCaptureDelegate>)delegate
 {
+    [[JRTracer sharedTracer] startTraceWithName:@"signin.native"];
     [JREngage updateTokenUrl:[JRCaptureData captureTokenUrlWithMergeToken:mergeToken delegate:delegate]];
     
     [[JREngageWrapper singletonInstance] setDelegate:delegate];
@@ -248,6 +251,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
                                 engageAppUrl:(NSString *)engageAppUrl
                                  forDelegate:(id <JRCaptureDelegate>)delegate
 {
+    [[JRTracer sharedTracer] startTraceWithName:@"signin.native"];
     [JREngage updateTokenUrl:[JRCaptureData captureTokenUrlWithMergeToken:mergeToken delegate:delegate]];
     
     [[JREngageWrapper singletonInstance] setDelegate:delegate];
@@ -279,6 +283,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
                          forProvider:(NSString *)provider
 {
     DLog();
+    [[JRTracer sharedTracer] endTraceWithStatus:@"token_url_failed"];
     if ([delegate respondsToSelector:@selector(captureSignInDidFailWithError:)])
         [delegate captureSignInDidFailWithError:error];
 
@@ -288,6 +293,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 - (void)authenticationDidFailWithError:(NSError *)error forProvider:(NSString *)provider
 {
     DLog();
+    [[JRTracer sharedTracer] endTraceWithStatus:@"authentication_failed"];
     if ([delegate respondsToSelector:@selector(engageAuthenticationDidFailWithError:forProvider:)])
         [delegate engageAuthenticationDidFailWithError:error forProvider:provider];
 
@@ -297,6 +303,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 - (void)authenticationDidNotComplete
 {
     DLog();
+    [[JRTracer sharedTracer] endTraceWithStatus:@"cancelled"];
     if ([delegate respondsToSelector:@selector(engageAuthenticationDidCancel)])
         [delegate engageAuthenticationDidCancel];
 
@@ -306,8 +313,10 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 - (void)authenticationDidReachTokenUrl:(NSString *)tokenUrl withResponse:(NSURLResponse *)response
                             andPayload:(NSData *)tokenUrlPayload forProvider:(NSString *)provider
 {
+    JRTraceSpan *span = [[JRTracer sharedTracer] startSpanWithName:@"engage.token_url_response"];
     NSString *payload = [[NSString alloc] initWithData:tokenUrlPayload encoding:NSUTF8StringEncoding];
     NSDictionary *payloadDict = [payload JR_objectFromJSONString];
+    [span end];
 
     DLog(@"%@", payload);
 
@@ -358,6 +367,7 @@ expandedCustomInterfaceOverrides:(NSMutableDictionary *)expandedCustomInterfaceO
 
 - (void)engageDialogDidFailToShowWithError:(NSError *)error
 {
+    [[JRTracer sharedTracer] endTraceWithStatus:@"dialog_failed"];
     if (dialogState == JREngageDialogStateAuthentication)
     {
         if ([delegate respondsToSelector:@selector(engageAuthenticationDialogDidFailToShowWithError:)])
@@ -30,6 +30,7 @@
 
 #import "debug_log.h"
 #import "JRNSDate+ISO8601_CaptureDateTimeString.h"
+#import "JRStageMetrics.h"
 
 @implementation NSDate (JRDate_ISO8601_CaptureDateTimeString)
 + (NSDate *)dateFromISO8601DateString:(NSString *)dateString
@@ -45,6 +46,7 @@
         [dateFormatter setLenient:NO];
     }
 
+    JR_STAGE_BEGIN(JRStageDateParse);
     NSDate *date = nil;
     NSString *ISO8601String = [[NSString stringWithString:dateString] uppercaseString];
     /* Try e.g. 1983-03-12 */
@@ -57,7 +59,9 @@
         date = [dateFormatter dateFromString:ISO8601String];
     }
 
-    if (!date) NSLog(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateString);
+    JR_STAGE_END(JRStageDateParse);
+
+    if (!date) JRLogWarning(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateString);
     return date;
 }
 
@@ -73,6 +77,7 @@
         [dateFormatter setTimeZone:[NSTimeZone timeZoneForSecondsFromGMT:0]];
     }
 
+    JR_STAGE_BEGIN(JRStageDateParse);
     NSString *ISO8601String = [[NSString stringWithString:dateTimeString] uppercaseString];
     NSDate *date = nil;
     /* Try full ISO8601; e.g., 2012-02-02 01:33:20.122198 +0000 */
@@ -115,7 +120,9 @@
         date = [dateFormatter dateFromString:ISO8601String];
     }
 
-    if (!date) NSLog(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateTimeString);
+    JR_STAGE_END(JRStageDateParse);
+
+    if (!date) JRLogWarning(@"Could not parse ISO8601 date: \"%@\" Possibly invalid format.", dateTimeString);
     return date;
 }
 
@@ -339,6 +339,7 @@
 
 - (void)setAboutMe:(NSString *)newAboutMe
 {
+    [self willChangeProperty:@"aboutMe"];
     [self.dirtyPropertySet addObject:@"aboutMe"];
 
     _aboutMe = [newAboutMe copy];
@@ -351,6 +352,7 @@
 
 - (void)setBirthday:(JRDate *)newBirthday
 {
+    [self willChangeProperty:@"birthday"];
     [self.dirtyPropertySet addObject:@"birthday"];
 
     _birthday = [newBirthday copy];
@@ -358,12 +360,17 @@
 
 - (NSArray *)clients
 {
+    if ([self.sharedPropertySet containsObject:@"clients"])
+        [self unshareProperty:@"clients"];
+
     return _clients;
 }
 
 - (void)setClients:(NSArray *)newClients
 {
-    _clients = [newClients copy];
+    [self willChangeProperty:@"clients"];
+
+    _clients = [self claimValue:[newClients copy] forProperty:@"clients"];
 }
 
 - (NSString *)currentLocation
@@ -373,6 +380,7 @@
 
 - (void)setCurrentLocation:(NSString *)newCurrentLocation
 {
+    [self willChangeProperty:@"currentLocation"];
     [self.dirtyPropertySet addObject:@"currentLocation"];
 
     _currentLocation = [newCurrentLocation copy];
@@ -385,6 +393,7 @@
 
 - (void)setDeactivateAccount:(JRDateTime *)newDeactivateAccount
 {
+    [self willChangeProperty:@"deactivateAccount"];
     [self.dirtyPropertySet addObject:@"deactivateAccount"];
 
     _deactivateAccount = [newDeactivateAccount copy];
@@ -397,6 +406,7 @@
 
 - (void)setDisplay:(JRJsonObject *)newDisplay
 {
+    [self willChangeProperty:@"display"];
     [self.dirtyPropertySet addObject:@"display"];
 
     _display = [newDisplay copy];
@@ -409,6 +419,7 @@
 
 - (void)setDisplayName:(NSString *)newDisplayName
 {
+    [self willChangeProperty:@"displayName"];
     [self.dirtyPropertySet addObject:@"displayName"];
 
     _displayName = [newDisplayName copy];
@@ -421,6 +432,7 @@
 
 - (void)setEmail:(NSString *)newEmail
 {
+    [self willChangeProperty:@"email"];
     [self.dirtyPropertySet addObject:@"email"];
 
     _email = [newEmail copy];
@@ -433,6 +445,7 @@
 
 - (void)setEmailVerified:(JRDateTime *)newEmailVerified
 {
+    [self willChangeProperty:@"emailVerified"];
     [self.dirtyPropertySet addObject:@"emailVerified"];
 
     _emailVerified = [newEmailVerified copy];
@@ -445,6 +458,7 @@
 
 - (void)setExternalId:(NSString *)newExternalId
 {
+    [self willChangeProperty:@"externalId"];
     [self.dirtyPropertySet addObject:@"externalId"];
 
     _externalId = [newExternalId copy];
@@ -457,6 +471,7 @@
 
 - (void)setFamilyName:(NSString *)newFamilyName
 {
+    [self willChangeProperty:@"familyName"];
     [self.dirtyPropertySet addObject:@"familyName"];
 
     _familyName = [newFamilyName copy];
@@ -469,6 +484,7 @@
 
 - (void)setGender:(NSString *)newGender
 {
+    [self willChangeProperty:@"gender"];
     [self.dirtyPropertySet addObject:@"gender"];
 
     _gender = [newGender copy];
@@ -481,6 +497,7 @@
 
 - (void)setGivenName:(NSString *)newGivenName
 {
+    [self willChangeProperty:@"givenName"];
     [self.dirtyPropertySet addObject:@"givenName"];
 
     _givenName = [newGivenName copy];
@@ -488,14 +505,18 @@
 
 - (JRJanrain *)janrain
 {
+    if ([self.sharedPropertySet containsObject:@"janrain"])
+        [self unshareProperty:@"janrain"];
+
     return _janrain;
 }
 
 - (void)setJanrain:(JRJanrain *)newJanrain
 {
+    [self willChangeProperty:@"janrain"];
     [self.dirtyPropertySet addObject:@"janrain"];
 
-    _janrain = newJanrain;
+    _janrain = [self claimValue:newJanrain forProperty:@"janrain"];
 
     [_janrain setAllPropertiesToDirty];
 }
@@ -507,6 +528,7 @@
 
 - (void)setLastLogin:(JRDateTime *)newLastLogin
 {
+    [self willChangeProperty:@"lastLogin"];
     [self.dirtyPropertySet addObject:@"lastLogin"];
 
     _lastLogin = [newLastLogin copy];
@@ -519,6 +541,7 @@
 
 - (void)setMiddleName:(NSString *)newMiddleName
 {
+    [self willChangeProperty:@"middleName"];
     [self.dirtyPropertySet addObject:@"middleName"];
 
     _middleName = [newMiddleName copy];
@@ -526,14 +549,18 @@
 
 - (JROptIn *)optIn
 {
+    if ([self.sharedPropertySet containsObject:@"optIn"])
+        [self unshareProperty:@"optIn"];
+
     return _optIn;
 }
 
 - (void)setOptIn:(JROptIn *)newOptIn
 {
+    [self willChangeProperty:@"optIn"];
     [self.dirtyPropertySet addObject:@"optIn"];
 
-    _optIn = newOptIn;
+    _optIn = [self claimValue:newOptIn forProperty:@"optIn"];
 
     [_optIn setAllPropertiesToDirty];
 }
@@ -545,6 +572,7 @@
 
 - (void)setPassword:(JRPassword *)newPassword
 {
+    [self willChangeProperty:@"password"];
     [self.dirtyPropertySet addObject:@"password"];
 
     _password = [newPassword copy];
@@ -552,46 +580,65 @@
 
 - (NSArray *)photos
 {
+    if ([self.sharedPropertySet containsObject:@"photos"])
+        [self unshareProperty:@"photos"];
+
     return _photos;
 }
 
 - (void)setPhotos:(NSArray *)newPhotos
 {
-    _photos = [newPhotos copy];
+    [self willChangeProperty:@"photos"];
+
+    _photos = [self claimValue:[newPhotos copy] forProperty:@"photos"];
 }
 
 - (JRPrimaryAddress *)primaryAddress
 {
+    if ([self.sharedPropertySet containsObject:@"primaryAddress"])
+        [self unshareProperty:@"primaryAddress"];
+
     return _primaryAddress;
 }
 
 - (void)setPrimaryAddress:(JRPrimaryAddress *)newPrimaryAddress
 {
+    [self willChangeProperty:@"primaryAddress"];
     [self.dirtyPropertySet addObject:@"primaryAddress"];
 
-    _primaryAddress = newPrimaryAddress;
+    _primaryAddress = [self claimValue:newPrimaryAddress forProperty:@"primaryAddress"];
 
     [_primaryAddress setAllPropertiesToDirty];
 }
 
 - (NSArray *)profiles
 {
+    if ([self.sharedPropertySet containsObject:@"profiles"])
+        [self unshareProperty:@"profiles"];
+
     return _profiles;
 }
 
 - (void)setProfiles:(NSArray *)newProfiles
 {
-    _profiles = [newProfiles copy];
+    [self willChangeProperty:@"profiles"];
+
+    _profiles = [self claimValue:[newProfiles copy] forProperty:@"profiles"];
 }
 
 - (NSArray *)statuses
 {
+    if ([self.sharedPropertySet containsObject:@"statuses"])
+        [self unshareProperty:@"statuses"];
+
     return _statuses;
 }
 
 - (void)setStatuses:(NSArray *)newStatuses
 {
-    _statuses = [newStatuses copy];
+    [self willChangeProperty:@"statuses"];
+
+    _statuses = [self claimValue:[newStatuses copy] forProperty:@"statuses"];
 }
 
 - (JRObjectId *)captureUserId
@@ -601,6 +648,7 @@
 
 - (void)setCaptureUserId:(JRObjectId *)newCaptureUserId
 {
+    [self willChangeProperty:@"captureUserId"];
     [self.dirtyPropertySet addObject:@"captureUserId"];
 
     _captureUserId = [newCaptureUserId copy];
@@ -613,6 +661,7 @@
 
 - (void)setCreated:(JRDateTime *)newCreated
 {
+    [self willChangeProperty:@"created"];
     [self.dirtyPropertySet addObject:@"created"];
 
     _created = [newCreated copy];
@@ -625,6 +674,7 @@
 
 - (void)setLastUpdated:(JRDateTime *)newLastUpdated
 {
+    [self willChangeProperty:@"lastUpdated"];
     [self.dirtyPropertySet addObject:@"lastUpdated"];
 
     _lastUpdated = [newLastUpdated copy];
@@ -637,6 +687,7 @@
 
 - (void)setUuid:(JRUuid *)newUuid
 {
+    [self willChangeProperty:@"uuid"];
     [self.dirtyPropertySet addObject:@"uuid"];
 
     _uuid = [newUuid copy];
@@ -649,9 +700,9 @@
         self.captureObjectPath = @"";
         self.canBeUpdatedOnCapture = YES;
 
-        _janrain = [[JRJanrain alloc] init];
-        _optIn = [[JROptIn alloc] init];
-        _primaryAddress = [[JRPrimaryAddress alloc] init];
+        _janrain = [self claimValue:[[JRJanrain alloc] init] forProperty:@"janrain"];
+        _optIn = [self claimValue:[[JROptIn alloc] init] forProperty:@"optIn"];
+        _primaryAddress = [self claimValue:[[JRPrimaryAddress alloc] init] forProperty:@"primaryAddress"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -663,62 +714,125 @@
     return [[JRCaptureUser alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRCaptureUser *captureUserCopy = (JRCaptureUser *)[super copyWithZone:zone];
+
+    captureUserCopy->_aboutMe = _aboutMe;
+    captureUserCopy->_birthday = _birthday;
+    captureUserCopy->_clients = _clients;
+    captureUserCopy->_currentLocation = _currentLocation;
+    captureUserCopy->_deactivateAccount = _deactivateAccount;
+    captureUserCopy->_display = _display;
+    captureUserCopy->_displayName = _displayName;
+    captureUserCopy->_email = _email;
+    captureUserCopy->_emailVerified = _emailVerified;
+    captureUserCopy->_externalId = _externalId;
+    captureUserCopy->_familyName = _familyName;
+    captureUserCopy->_gender = _gender;
+    captureUserCopy->_givenName = _givenName;
+    captureUserCopy->_janrain = _janrain;
+    captureUserCopy->_lastLogin = _lastLogin;
+    captureUserCopy->_middleName = _middleName;
+    captureUserCopy->_optIn = _optIn;
+    captureUserCopy->_password = _password;
+    captureUserCopy->_photos = _photos;
+    captureUserCopy->_primaryAddress = _primaryAddress;
+    captureUserCopy->_profiles = _profiles;
+    captureUserCopy->_statuses = _statuses;
+    captureUserCopy->_captureUserId = _captureUserId;
+    captureUserCopy->_created = _created;
+    captureUserCopy->_lastUpdated = _lastUpdated;
+    captureUserCopy->_uuid = _uuid;
+
+    return captureUserCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"clients", @"janrain", @"optIn", @"photos", @"primaryAddress", @"profiles", @"statuses", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"clients"]) return _clients;
+    if ([propertyName isEqualToString:@"janrain"]) return _janrain;
+    if ([propertyName isEqualToString:@"optIn"]) return _optIn;
+    if ([propertyName isEqualToString:@"photos"]) return _photos;
+    if ([propertyName isEqualToString:@"primaryAddress"]) return _primaryAddress;
+    if ([propertyName isEqualToString:@"profiles"]) return _profiles;
+    if ([propertyName isEqualToString:@"statuses"]) return _statuses;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"clients"]) _clients = value;
+    if ([propertyName isEqualToString:@"janrain"]) _janrain = value;
+    if ([propertyName isEqualToString:@"optIn"]) _optIn = value;
+    if ([propertyName isEqualToString:@"photos"]) _photos = value;
+    if ([propertyName isEqualToString:@"primaryAddress"]) _primaryAddress = value;
+    if ([propertyName isEqualToString:@"profiles"]) _profiles = value;
+    if ([propertyName isEqualToString:@"statuses"]) _statuses = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null])
+    [dictionary setObject:(_aboutMe ? _aboutMe : [NSNull null])
                    forKey:@"aboutMe"];
-    [dictionary setObject:(self.birthday ? [self.birthday stringFromISO8601Date] : [NSNull null])
+    [dictionary setObject:(_birthday ? [_birthday stringFromISO8601Date] : [NSNull null])
                    forKey:@"birthday"];
-    [dictionary setObject:(self.clients ? [self.clients arrayOfClientsDictionariesFromClientsElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_clients ? [_clients arrayOfClientsDictionariesFromClientsElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"clients"];
-    [dictionary setObject:(self.currentLocation ? self.currentLocation : [NSNull null])
+    [dictionary setObject:(_currentLocation ? _currentLocation : [NSNull null])
                    forKey:@"currentLocation"];
-    [dictionary setObject:(self.deactivateAccount ? [self.deactivateAccount stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_deactivateAccount ? [_deactivateAccount stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"deactivateAccount"];
-    [dictionary setObject:(self.display ? self.display : [NSNull null])
+    [dictionary setObject:(_display ? _display : [NSNull null])
                    forKey:@"display"];
-    [dictionary setObject:(self.displayName ? self.displayName : [NSNull null])
+    [dictionary setObject:(_displayName ? _displayName : [NSNull null])
                    forKey:@"displayName"];
-    [dictionary setObject:(self.email ? self.email : [NSNull null])
+    [dictionary setObject:(_email ? _email : [NSNull null])
                    forKey:@"email"];
-    [dictionary setObject:(self.emailVerified ? [self.emailVerified stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_emailVerified ? [_emailVerified stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"emailVerified"];
-    [dictionary setObject:(self.externalId ? self.externalId : [NSNull null])
+    [dictionary setObject:(_externalId ? _externalId : [NSNull null])
                    forKey:@"externalId"];
-    [dictionary setObject:(self.familyName ? self.familyName : [NSNull null])
+    [dictionary setObject:(_familyName ? _familyName : [NSNull null])
                    forKey:@"familyName"];
-    [dictionary setObject:(self.gender ? self.gender : [NSNull null])
+    [dictionary setObject:(_gender ? _gender : [NSNull null])
                    forKey:@"gender"];
-    [dictionary setObject:(self.givenName ? self.givenName : [NSNull null])
+    [dictionary setObject:(_givenName ? _givenName : [NSNull null])
                    forKey:@"givenName"];
-    [dictionary setObject:(self.janrain ? [self.janrain newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_janrain ? [_janrain newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"janrain"];
-    [dictionary setObject:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_lastLogin ? [_lastLogin stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"lastLogin"];
-    [dictionary setObject:(self.middleName ? self.middleName : [NSNull null])
+    [dictionary setObject:(_middleName ? _middleName : [NSNull null])
                    forKey:@"middleName"];
-    [dictionary setObject:(self.optIn ? [self.optIn newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_optIn ? [_optIn newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"optIn"];
-    [dictionary setObject:(self.password ? self.password : [NSNull null])
+    [dictionary setObject:(_password ? _password : [NSNull null])
                    forKey:@"password"];
-    [dictionary setObject:(self.photos ? [self.photos arrayOfPhotosDictionariesFromPhotosElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_photos ? [_photos arrayOfPhotosDictionariesFromPhotosElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"photos"];
-    [dictionary setObject:(self.primaryAddress ? [self.primaryAddress newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_primaryAddress ? [_primaryAddress newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"primaryAddress"];
-    [dictionary setObject:(self.profiles ? [self.profiles arrayOfProfilesDictionariesFromProfilesElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_profiles ? [_profiles arrayOfProfilesDictionariesFromProfilesElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"profiles"];
-    [dictionary setObject:(self.statuses ? [self.statuses arrayOfStatusesDictionariesFromStatusesElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_statuses ? [_statuses arrayOfStatusesDictionariesFromStatusesElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"statuses"];
-    [dictionary setObject:(self.captureUserId ? [NSNumber numberWithInteger:[self.captureUserId integerValue]] : [NSNull null])
+    [dictionary setObject:(_captureUserId ? [NSNumber numberWithInteger:[_captureUserId integerValue]] : [NSNull null])
                    forKey:@"id"];
-    [dictionary setObject:(self.created ? [self.created stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_created ? [_created stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"created"];
-    [dictionary setObject:(self.lastUpdated ? [self.lastUpdated stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_lastUpdated ? [_lastUpdated stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"lastUpdated"];
-    [dictionary setObject:(self.uuid ? self.uuid : [NSNull null])
+    [dictionary setObject:(_uuid ? _uuid : [NSNull null])
                    forKey:@"uuid"];
 
     if (forEncoder)
@@ -1111,6 +1225,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -1122,16 +1237,16 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"captureUser"];
 
-    if (self.janrain)
-        [snapshotDictionary setObject:[self.janrain snapshotDictionaryFromDirtyPropertySet]
+    if (_janrain)
+        [snapshotDictionary setObject:[_janrain snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"janrain"];
 
-    if (self.optIn)
-        [snapshotDictionary setObject:[self.optIn snapshotDictionaryFromDirtyPropertySet]
+    if (_optIn)
+        [snapshotDictionary setObject:[_optIn snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"optIn"];
 
-    if (self.primaryAddress)
-        [snapshotDictionary setObject:[self.primaryAddress snapshotDictionaryFromDirtyPropertySet]
+    if (_primaryAddress)
+        [snapshotDictionary setObject:[_primaryAddress snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"primaryAddress"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -1139,6 +1254,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"captureUser"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"captureUser"] allObjects]];
 
@@ -1162,75 +1279,75 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"aboutMe"])
-        [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null]) forKey:@"aboutMe"];
+        [dictionary setObject:(_aboutMe ? _aboutMe : [NSNull null]) forKey:@"aboutMe"];
 
     if ([self.dirtyPropertySet containsObject:@"birthday"])
-        [dictionary setObject:(self.birthday ? [self.birthday stringFromISO8601Date] : [NSNull null]) forKey:@"birthday"];
+        [dictionary setObject:(_birthday ? [_birthday stringFromISO8601Date] : [NSNull null]) forKey:@"birthday"];
 
     if ([self.dirtyPropertySet containsObject:@"currentLocation"])
-        [dictionary setObject:(self.currentLocation ? self.currentLocation : [NSNull null]) forKey:@"currentLocation"];
+        [dictionary setObject:(_currentLocation ? _currentLocation : [NSNull null]) forKey:@"currentLocation"];
 
     if ([self.dirtyPropertySet containsObject:@"deactivateAccount"])
-        [dictionary setObject:(self.deactivateAccount ? [self.deactivateAccount stringFromISO8601DateTime] : [NSNull null]) forKey:@"deactivateAccount"];
+        [dictionary setObject:(_deactivateAccount ? [_deactivateAccount stringFromISO8601DateTime] : [NSNull null]) forKey:@"deactivateAccount"];
 
     if ([self.dirtyPropertySet containsObject:@"display"])
-        [dictionary setObject:(self.display ? self.display : [NSNull null]) forKey:@"display"];
+        [dictionary setObject:(_display ? _display : [NSNull null]) forKey:@"display"];
 
     if ([self.dirtyPropertySet containsObject:@"displayName"])
-        [dictionary setObject:(self.displayName ? self.displayName : [NSNull null]) forKey:@"displayName"];
+        [dictionary setObject:(_displayName ? _displayName : [NSNull null]) forKey:@"displayName"];
 
     if ([self.dirtyPropertySet containsObject:@"email"])
-        [dictionary setObject:(self.email ? self.email : [NSNull null]) forKey:@"email"];
+        [dictionary setObject:(_email ? _email : [NSNull null]) forKey:@"email"];
 
     if ([self.dirtyPropertySet containsObject:@"emailVerified"])
-        [dictionary setObject:(self.emailVerified ? [self.emailVerified stringFromISO8601DateTime] : [NSNull null]) forKey:@"emailVerified"];
+        [dictionary setObject:(_emailVerified ? [_emailVerified stringFromISO8601DateTime] : [NSNull null]) forKey:@"emailVerified"];
 
     if ([self.dirtyPropertySet containsObject:@"externalId"])
-        [dictionary setObject:(self.externalId ? self.externalId : [NSNull null]) forKey:@"externalId"];
+        [dictionary setObject:(_externalId ? _externalId : [NSNull null]) forKey:@"externalId"];
 
     if ([self.dirtyPropertySet containsObject:@"familyName"])
-        [dictionary setObject:(self.familyName ? self.familyName : [NSNull null]) forKey:@"familyName"];
+        [dictionary setObject:(_familyName ? _familyName : [NSNull null]) forKey:@"familyName"];
 
     if ([self.dirtyPropertySet containsObject:@"gender"])
-        [dictionary setObject:(self.gender ? self.gender : [NSNull null]) forKey:@"gender"];
+        [dictionary setObject:(_gender ? _gender : [NSNull null]) forKey:@"gender"];
 
     if ([self.dirtyPropertySet containsObject:@"givenName"])
-        [dictionary setObject:(self.givenName ? self.givenName : [NSNull null]) forKey:@"givenName"];
+        [dictionary setObject:(_givenName ? _givenName : [NSNull null]) forKey:@"givenName"];
 
     if ([self.dirtyPropertySet containsObject:@"janrain"])
-        [dictionary setObject:(self.janrain ?
-                              [self.janrain toUpdateDictionary] :
+        [dictionary setObject:(_janrain ?
+                              [_janrain toUpdateDictionary] :
                               [[JRJanrain janrain] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"janrain"];
-    else if ([self.janrain needsUpdate])
-        [dictionary setObject:[self.janrain toUpdateDictionary]
+    else if ([_janrain needsUpdate])
+        [dictionary setObject:[_janrain toUpdateDictionary]
                        forKey:@"janrain"];
 
     if ([self.dirtyPropertySet containsObject:@"lastLogin"])
-        [dictionary setObject:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
+        [dictionary setObject:(_lastLogin ? [_lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
 
     if ([self.dirtyPropertySet containsObject:@"middleName"])
-        [dictionary setObject:(self.middleName ? self.middleName : [NSNull null]) forKey:@"middleName"];
+        [dictionary setObject:(_middleName ? _middleName : [NSNull null]) forKey:@"middleName"];
 
     if ([self.dirtyPropertySet containsObject:@"optIn"])
-        [dictionary setObject:(self.optIn ?
-                              [self.optIn toUpdateDictionary] :
+        [dictionary setObject:(_optIn ?
+                              [_optIn toUpdateDictionary] :
                               [[JROptIn optIn] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"optIn"];
-    else if ([self.optIn needsUpdate])
-        [dictionary setObject:[self.optIn toUpdateDictionary]
+    else if ([_optIn needsUpdate])
+        [dictionary setObject:[_optIn toUpdateDictionary]
                        forKey:@"optIn"];
 
     if ([self.dirtyPropertySet containsObject:@"password"])
-        [dictionary setObject:(self.password ? self.password : [NSNull null]) forKey:@"password"];
+        [dictionary setObject:(_password ? _password : [NSNull null]) forKey:@"password"];
 
     if ([self.dirtyPropertySet containsObject:@"primaryAddress"])
-        [dictionary setObject:(self.primaryAddress ?
-                              [self.primaryAddress toUpdateDictionary] :
+        [dictionary setObject:(_primaryAddress ?
+                              [_primaryAddress toUpdateDictionary] :
                               [[JRPrimaryAddress primaryAddress] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"primaryAddress"];
-    else if ([self.primaryAddress needsUpdate])
-        [dictionary setObject:[self.primaryAddress toUpdateDictionary]
+    else if ([_primaryAddress needsUpdate])
+        [dictionary setObject:[_primaryAddress toUpdateDictionary]
                        forKey:@"primaryAddress"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -1247,54 +1364,54 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null]) forKey:@"aboutMe"];
-    [dictionary setObject:(self.birthday ? [self.birthday stringFromISO8601Date] : [NSNull null]) forKey:@"birthday"];
+    [dictionary setObject:(_aboutMe ? _aboutMe : [NSNull null]) forKey:@"aboutMe"];
+    [dictionary setObject:(_birthday ? [_birthday stringFromISO8601Date] : [NSNull null]) forKey:@"birthday"];
 
-    [dictionary setObject:(self.clients ?
-                          [self.clients arrayOfClientsReplaceDictionariesFromClientsElements] :
+    [dictionary setObject:(_clients ?
+                          [_clients arrayOfClientsReplaceDictionariesFromClientsElements] :
                           [NSArray array])
                    forKey:@"clients"];
-    [dictionary setObject:(self.currentLocation ? self.currentLocation : [NSNull null]) forKey:@"currentLocation"];
-    [dictionary setObject:(self.deactivateAccount ? [self.deactivateAccount stringFromISO8601DateTime] : [NSNull null]) forKey:@"deactivateAccount"];
-    [dictionary setObject:(self.display ? self.display : [NSNull null]) forKey:@"display"];
-    [dictionary setObject:(self.displayName ? self.displayName : [NSNull null]) forKey:@"displayName"];
-    [dictionary setObject:(self.email ? self.email : [NSNull null]) forKey:@"email"];
-    [dictionary setObject:(self.emailVerified ? [self.emailVerified stringFromISO8601DateTime] : [NSNull null]) forKey:@"emailVerified"];
-    [dictionary setObject:(self.externalId ? self.externalId : [NSNull null]) forKey:@"externalId"];
-    [dictionary setObject:(self.familyName ? self.familyName : [NSNull null]) forKey:@"familyName"];
-    [dictionary setObject:(self.gender ? self.gender : [NSNull null]) forKey:@"gender"];
-    [dictionary setObject:(self.givenName ? self.givenName : [NSNull null]) forKey:@"givenName"];
-
-    [dictionary setObject:(self.janrain ?
-                          [self.janrain toReplaceDictionary] :
+    [dictionary setObject:(_currentLocation ? _currentLocation : [NSNull null]) forKey:@"currentLocation"];
+    [dictionary setObject:(_deactivateAccount ? [_deactivateAccount stringFromISO8601DateTime] : [NSNull null]) forKey:@"deactivateAccount"];
+    [dictionary setObject:(_display ? _display : [NSNull null]) forKey:@"display"];
+    [dictionary setObject:(_displayName ? _displayName : [NSNull null]) forKey:@"displayName"];
+    [dictionary setObject:(_email ? _email : [NSNull null]) forKey:@"email"];
+    [dictionary setObject:(_emailVerified ? [_emailVerified stringFromISO8601DateTime] : [NSNull null]) forKey:@"emailVerified"];
+    [dictionary setObject:(_externalId ? _externalId : [NSNull null]) forKey:@"externalId"];
+    [dictionary setObject:(_familyName ? _familyName : [NSNull null]) forKey:@"familyName"];
+    [dictionary setObject:(_gender ? _gender : [NSNull null]) forKey:@"gender"];
+    [dictionary setObject:(_givenName ? _givenName : [NSNull null]) forKey:@"givenName"];
+
+    [dictionary setObject:(_janrain ?
+                          [_janrain toReplaceDictionary] :
                           [[JRJanrain janrain] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"janrain"];
-    [dictionary setObject:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
-    [dictionary setObject:(self.middleName ? self.middleName : [NSNull null]) forKey:@"middleName"];
+    [dictionary setObject:(_lastLogin ? [_lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
+    [dictionary setObject:(_middleName ? _middleName : [NSNull null]) forKey:@"middleName"];
 
-    [dictionary setObject:(self.optIn ?
-                          [self.optIn toReplaceDictionary] :
+    [dictionary setObject:(_optIn ?
+                          [_optIn toReplaceDictionary] :
                           [[JROptIn optIn] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"optIn"];
-    [dictionary setObject:(self.password ? self.password : [NSNull null]) forKey:@"password"];
+    [dictionary setObject:(_password ? _password : [NSNull null]) forKey:@"password"];
 
-    [dictionary setObject:(self.photos ?
-                          [self.photos arrayOfPhotosReplaceDictionariesFromPhotosElements] :
+    [dictionary setObject:(_photos ?
+                          [_photos arrayOfPhotosReplaceDictionariesFromPhotosElements] :
                           [NSArray array])
                    forKey:@"photos"];
 
-    [dictionary setObject:(self.primaryAddress ?
-                          [self.primaryAddress toReplaceDictionary] :
+    [dictionary setObject:(_primaryAddress ?
+                          [_primaryAddress toReplaceDictionary] :
                           [[JRPrimaryAddress primaryAddress] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"primaryAddress"];
 
-    [dictionary setObject:(self.profiles ?
-                          [self.profiles arrayOfProfilesReplaceDictionariesFromProfilesElements] :
+    [dictionary setObject:(_profiles ?
+                          [_profiles arrayOfProfilesReplaceDictionariesFromProfilesElements] :
                           [NSArray array])
                    forKey:@"profiles"];
 
-    [dictionary setObject:(self.statuses ?
-                          [self.statuses arrayOfStatusesReplaceDictionariesFromStatusesElements] :
+    [dictionary setObject:(_statuses ?
+                          [_statuses arrayOfStatusesReplaceDictionariesFromStatusesElements] :
                           [NSArray array])
                    forKey:@"statuses"];
 
@@ -1331,13 +1448,13 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.janrain needsUpdate])
+    if ([_janrain needsUpdate])
         return YES;
 
-    if ([self.optIn needsUpdate])
+    if ([_optIn needsUpdate])
         return YES;
 
-    if ([self.primaryAddress needsUpdate])
+    if ([_primaryAddress needsUpdate])
         return YES;
 
     return NO;
@@ -1345,104 +1462,145 @@
 
 - (BOOL)isEqualToCaptureUser:(JRCaptureUser *)otherCaptureUser
 {
-    if (!self.aboutMe && !otherCaptureUser.aboutMe) /* Keep going... */;
-    else if ((self.aboutMe == nil) ^ (otherCaptureUser.aboutMe == nil)) return NO; // xor
-    else if (![self.aboutMe isEqualToString:otherCaptureUser.aboutMe]) return NO;
-
-    if (!self.birthday && !otherCaptureUser.birthday) /* Keep going... */;
-    else if ((self.birthday == nil) ^ (otherCaptureUser.birthday == nil)) return NO; // xor
-    else if (![self.birthday isEqualToDate:otherCaptureUser.birthday]) return NO;
-
-    if (!self.clients && !otherCaptureUser.clients) /* Keep going... */;
-    else if (!self.clients && ![otherCaptureUser.clients count]) /* Keep going... */;
-    else if (!otherCaptureUser.clients && ![self.clients count]) /* Keep going... */;
-    else if (![self.clients isEqualToClientsArray:otherCaptureUser.clients]) return NO;
-
-    if (!self.currentLocation && !otherCaptureUser.currentLocation) /* Keep going... */;
-    else if ((self.currentLocation == nil) ^ (otherCaptureUser.currentLocation == nil)) return NO; // xor
-    else if (![self.currentLocation isEqualToString:otherCaptureUser.currentLocation]) return NO;
-
-    if (!self.deactivateAccount && !otherCaptureUser.deactivateAccount) /* Keep going... */;
-    else if ((self.deactivateAccount == nil) ^ (otherCaptureUser.deactivateAccount == nil)) return NO; // xor
-    else if (![self.deactivateAccount isEqualToDate:otherCaptureUser.deactivateAccount]) return NO;
-
-    if (!self.display && !otherCaptureUser.display) /* Keep going... */;
-    else if ((self.display == nil) ^ (otherCaptureUser.display == nil)) return NO; // xor
-    else if (![self.display isEqual:otherCaptureUser.display]) return NO;
-
-    if (!self.displayName && !otherCaptureUser.displayName) /* Keep going... */;
-    else if ((self.displayName == nil) ^ (otherCaptureUser.displayName == nil)) return NO; // xor
-    else if (![self.displayName isEqualToString:otherCaptureUser.displayName]) return NO;
-
-    if (!self.email && !otherCaptureUser.email) /* Keep going... */;
-    else if ((self.email == nil) ^ (otherCaptureUser.email == nil)) return NO; // xor
-    else if (![self.email isEqualToString:otherCaptureUser.email]) return NO;
-
-    if (!self.emailVerified && !otherCaptureUser.emailVerified) /* Keep going... */;
-    else if ((self.emailVerified == nil) ^ (otherCaptureUser.emailVerified == nil)) return NO; // xor
-    else if (![self.emailVerified isEqualToDate:otherCaptureUser.emailVerified]) return NO;
-
-    if (!self.externalId && !otherCaptureUser.externalId) /* Keep going... */;
-    else if ((self.externalId == nil) ^ (otherCaptureUser.externalId == nil)) return NO; // xor
-    else if (![self.externalId isEqualToString:otherCaptureUser.externalId]) return NO;
-
-    if (!self.familyName && !otherCaptureUser.familyName) /* Keep going... */;
-    else if ((self.familyName == nil) ^ (otherCaptureUser.familyName == nil)) return NO; // xor
-    else if (![self.familyName isEqualToString:otherCaptureUser.familyName]) return NO;
-
-    if (!self.gender && !otherCaptureUser.gender) /* Keep going... */;
-    else if ((self.gender == nil) ^ (otherCaptureUser.gender == nil)) return NO; // xor
-    else if (![self.gender isEqualToString:otherCaptureUser.gender]) return NO;
-
-    if (!self.givenName && !otherCaptureUser.givenName) /* Keep going... */;
-    else if ((self.givenName == nil) ^ (otherCaptureUser.givenName == nil)) return NO; // xor
-    else if (![self.givenName isEqualToString:otherCaptureUser.givenName]) return NO;
-
-    if (!self.janrain && !otherCaptureUser.janrain) /* Keep going... */;
-    else if (!self.janrain && [otherCaptureUser.janrain isEqualToJanrain:[JRJanrain janrain]]) /* Keep going... */;
-    else if (!otherCaptureUser.janrain && [self.janrain isEqualToJanrain:[JRJanrain janrain]]) /* Keep going... */;
-    else if (![self.janrain isEqualToJanrain:otherCaptureUser.janrain]) return NO;
-
-    if (!self.lastLogin && !otherCaptureUser.lastLogin) /* Keep going... */;
-    else if ((self.lastLogin == nil) ^ (otherCaptureUser.lastLogin == nil)) return NO; // xor
-    else if (![self.lastLogin isEqualToDate:otherCaptureUser.lastLogin]) return NO;
-
-    if (!self.middleName && !otherCaptureUser.middleName) /* Keep going... */;
-    else if ((self.middleName == nil) ^ (otherCaptureUser.middleName == nil)) return NO; // xor
-    else if (![self.middleName isEqualToString:otherCaptureUser.middleName]) return NO;
-
-    if (!self.optIn && !otherCaptureUser.optIn) /* Keep going... */;
-    else if (!self.optIn && [otherCaptureUser.optIn isEqualToOptIn:[JROptIn optIn]]) /* Keep going... */;
-    else if (!otherCaptureUser.optIn && [self.optIn isEqualToOptIn:[JROptIn optIn]]) /* Keep going... */;
-    else if (![self.optIn isEqualToOptIn:otherCaptureUser.optIn]) return NO;
-
-    if (!self.password && !otherCaptureUser.password) /* Keep going... */;
-    else if ((self.password == nil) ^ (otherCaptureUser.password == nil)) return NO; // xor
-    else if (![self.password isEqual:otherCaptureUser.password]) return NO;
-
-    if (!self.photos && !otherCaptureUser.photos) /* Keep going... */;
-    else if (!self.photos && ![otherCaptureUser.photos count]) /* Keep going... */;
-    else if (!otherCaptureUser.photos && ![self.photos count]) /* Keep going... */;
-    else if (![self.photos isEqualToPhotosArray:otherCaptureUser.photos]) return NO;
-
-    if (!self.primaryAddress && !otherCaptureUser.primaryAddress) /* Keep going... */;
-    else if (!self.primaryAddress && [otherCaptureUser.primaryAddress isEqualToPrimaryAddress:[JRPrimaryAddress primaryAddress]]) /* Keep going... */;
-    else if (!otherCaptureUser.primaryAddress && [self.primaryAddress isEqualToPrimaryAddress:[JRPrimaryAddress primaryAddress]]) /* Keep going... */;
-    else if (![self.primaryAddress isEqualToPrimaryAddress:otherCaptureUser.primaryAddress]) return NO;
-
-    if (!self.profiles && !otherCaptureUser.profiles) /* Keep going... */;
-    else if (!self.profiles && ![otherCaptureUser.profiles count]) /* Keep going... */;
-    else if (!otherCaptureUser.profiles && ![self.profiles count]) /* Keep going... */;
-    else if (![self.profiles isEqualToProfilesArray:otherCaptureUser.profiles]) return NO;
-
-    if (!self.statuses && !otherCaptureUser.statuses) /* Keep going... */;
-    else if (!self.statuses && ![otherCaptureUser.statuses count]) /* Keep going... */;
-    else if (!otherCaptureUser.statuses && ![self.statuses count]) /* Keep going... */;
-    else if (![self.statuses isEqualToStatusesArray:otherCaptureUser.statuses]) return NO;
+    if (!otherCaptureUser) return NO;
+    if ([self hash] != [otherCaptureUser hash]) return NO;
+
+    if (!_aboutMe && !otherCaptureUser->_aboutMe) /* Keep going... */;
+    else if ((_aboutMe == nil) ^ (otherCaptureUser->_aboutMe == nil)) return NO; // xor
+    else if (![_aboutMe isEqualToString:otherCaptureUser->_aboutMe]) return NO;
+
+    if (!_birthday && !otherCaptureUser->_birthday) /* Keep going... */;
+    else if ((_birthday == nil) ^ (otherCaptureUser->_birthday == nil)) return NO; // xor
+    else if (![_birthday isEqualToDate:otherCaptureUser->_birthday]) return NO;
+
+    if (!_clients && !otherCaptureUser->_clients) /* Keep going... */;
+    else if (!_clients && ![otherCaptureUser->_clients count]) /* Keep going... */;
+    else if (!otherCaptureUser->_clients && ![_clients count]) /* Keep going... */;
+    else if (![_clients isEqualToClientsArray:otherCaptureUser->_clients]) return NO;
+
+    if (!_currentLocation && !otherCaptureUser->_currentLocation) /* Keep going... */;
+    else if ((_currentLocation == nil) ^ (otherCaptureUser->_currentLocation == nil)) return NO; // xor
+    else if (![_currentLocation isEqualToString:otherCaptureUser->_currentLocation]) return NO;
+
+    if (!_deactivateAccount && !otherCaptureUser->_deactivateAccount) /* Keep going... */;
+    else if ((_deactivateAccount == nil) ^ (otherCaptureUser->_deactivateAccount == nil)) return NO; // xor
+    else if (![_deactivateAccount isEqualToDate:otherCaptureUser->_deactivateAccount]) return NO;
+
+    if (!_display && !otherCaptureUser->_display) /* Keep going... */;
+    else if ((_display == nil) ^ (otherCaptureUser->_display == nil)) return NO; // xor
+    else if (![_display isEqual:otherCaptureUser->_display]) return NO;
+
+    if (!_displayName && !otherCaptureUser->_displayName) /* Keep going... */;
+    else if ((_displayName == nil) ^ (otherCaptureUser->_displayName == nil)) return NO; // xor
+    else if (![_displayName isEqualToString:otherCaptureUser->_displayName]) return NO;
+
+    if (!_email && !otherCaptureUser->_email) /* Keep going... */;
+    else if ((_email == nil) ^ (otherCaptureUser->_email == nil)) return NO; // xor
+    else if (![_email isEqualToString:otherCaptureUser->_email]) return NO;
+
+    if (!_emailVerified && !otherCaptureUser->_emailVerified) /* Keep going... */;
+    else if ((_emailVerified == nil) ^ (otherCaptureUser->_emailVerified == nil)) return NO; // xor
+    else if (![_emailVerified isEqualToDate:otherCaptureUser->_emailVerified]) return NO;
+
+    if (!_externalId && !otherCaptureUser->_externalId) /* Keep going... */;
+    else if ((_externalId == nil) ^ (otherCaptureUser->_externalId == nil)) return NO; // xor
+    else if (![_externalId isEqualToString:otherCaptureUser->_externalId]) return NO;
+
+    if (!_familyName && !otherCaptureUser->_familyName) /* Keep going... */;
+    else if ((_familyName == nil) ^ (otherCaptureUser->_familyName == nil)) return NO; // xor
+    else if (![_familyName isEqualToString:otherCaptureUser->_familyName]) return NO;
+
+    if (!_gender && !otherCaptureUser->_gender) /* Keep going... */;
+    else if ((_gender == nil) ^ (otherCaptureUser->_gender == nil)) return NO; // xor
+    else if (![_gender isEqualToString:otherCaptureUser->_gender]) return NO;
+
+    if (!_givenName && !otherCaptureUser->_givenName) /* Keep going... */;
+    else if ((_givenName == nil) ^ (otherCaptureUser->_givenName == nil)) return NO; // xor
+    else if (![_givenName isEqualToString:otherCaptureUser->_givenName]) return NO;
+
+    if (!_janrain && !otherCaptureUser->_janrain) /* Keep going... */;
+    else if (!_janrain && [otherCaptureUser->_janrain isEqualToJanrain:[JRJanrain janrain]]) /* Keep going... */;
+    else if (!otherCaptureUser->_janrain && [_janrain isEqualToJanrain:[JRJanrain janrain]]) /* Keep going... */;
+    else if (![_janrain isEqualToJanrain:otherCaptureUser->_janrain]) return NO;
+
+    if (!_lastLogin && !otherCaptureUser->_lastLogin) /* Keep going... */;
+    else if ((_lastLogin == nil) ^ (otherCaptureUser->_lastLogin == nil)) return NO; // xor
+    else if (![_lastLogin isEqualToDate:otherCaptureUser->_lastLogin]) return NO;
+
+    if (!_middleName && !otherCaptureUser->_middleName) /* Keep going... */;
+    else if ((_middleName == nil) ^ (otherCaptureUser->_middleName == nil)) return NO; // xor
+    else if (![_middleName isEqualToString:otherCaptureUser->_middleName]) return NO;
+
+    if (!_optIn && !otherCaptureUser->_optIn) /* Keep going... */;
+    else if (!_optIn && [otherCaptureUser->_optIn isEqualToOptIn:[JROptIn optIn]]) /* Keep going... */;
+    else if (!otherCaptureUser->_optIn && [_optIn isEqualToOptIn:[JROptIn optIn]]) /* Keep going... */;
+    else if (![_optIn isEqualToOptIn:otherCaptureUser->_optIn]) return NO;
+
+    if (!_password && !otherCaptureUser->_password) /* Keep going... */;
+    else if ((_password == nil) ^ (otherCaptureUser->_password == nil)) return NO; // xor
+    else if (![_password isEqual:otherCaptureUser->_password]) return NO;
+
+    if (!_photos && !otherCaptureUser->_photos) /* Keep going... */;
+    else if (!_photos && ![otherCaptureUser->_photos count]) /* Keep going... */;
+    else if (!otherCaptureUser->_photos && ![_photos count]) /* Keep going... */;
+    else if (![_photos isEqualToPhotosArray:otherCaptureUser->_photos]) return NO;
+
+    if (!_primaryAddress && !otherCaptureUser->_primaryAddress) /* Keep going... */;
+    else if (!_primaryAddress && [otherCaptureUser->_primaryAddress isEqualToPrimaryAddress:[JRPrimaryAddress primaryAddress]]) /* Keep going... */;
+    else if (!otherCaptureUser->_primaryAddress && [_primaryAddress isEqualToPrimaryAddress:[JRPrimaryAddress primaryAddress]]) /* Keep going... */;
+    else if (![_primaryAddress isEqualToPrimaryAddress:otherCaptureUser->_primaryAddress]) return NO;
+
+    if (!_profiles && !otherCaptureUser->_profiles) /* Keep going... */;
+    else if (!_profiles && ![otherCaptureUser->_profiles count]) /* Keep going... */;
+    else if (!otherCaptureUser->_profiles && ![_profiles count]) /* Keep going... */;
+    else if (![_profiles isEqualToProfilesArray:otherCaptureUser->_profiles]) return NO;
+
+    if (!_statuses && !otherCaptureUser->_statuses) /* Keep going... */;
+    else if (!_statuses && ![otherCaptureUser->_statuses count]) /* Keep going... */;
+    else if (!otherCaptureUser->_statuses && ![_statuses count]) /* Keep going... */;
+    else if (![_statuses isEqualToStatusesArray:otherCaptureUser->_statuses]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRCaptureUser class]]) return NO;
+
+    return [self isEqualToCaptureUser:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_aboutMe hash];
+    hash = hash * 31 + [_birthday hash];
+    hash = hash * 31 + [_clients captureObjectElementsHash];
+    hash = hash * 31 + [_currentLocation hash];
+    hash = hash * 31 + [_deactivateAccount hash];
+    hash = hash * 31 + [_display hash];
+    hash = hash * 31 + [_displayName hash];
+    hash = hash * 31 + [_email hash];
+    hash = hash * 31 + [_emailVerified hash];
+    hash = hash * 31 + [_externalId hash];
+    hash = hash * 31 + [_familyName hash];
+    hash = hash * 31 + [_gender hash];
+    hash = hash * 31 + [_givenName hash];
+    hash = hash * 31 + [_janrain hash];
+    hash = hash * 31 + [_lastLogin hash];
+    hash = hash * 31 + [_middleName hash];
+    hash = hash * 31 + [_optIn hash];
+    hash = hash * 31 + [_password hash];
+    hash = hash * 31 + [_photos captureObjectElementsHash];
+    hash = hash * 31 + [_primaryAddress hash];
+    hash = hash * 31 + [_profiles captureObjectElementsHash];
+    hash = hash * 31 + [_statuses captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
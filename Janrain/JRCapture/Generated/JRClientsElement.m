@@ -60,6 +60,7 @@
 
 - (void)setClientId:(NSString *)newClientId
 {
+    [self willChangeProperty:@"clientId"];
     [self.dirtyPropertySet addObject:@"clientId"];
 
     _clientId = [newClientId copy];
@@ -72,6 +73,7 @@
 
 - (void)setFirstLogin:(JRDateTime *)newFirstLogin
 {
+    [self willChangeProperty:@"firstLogin"];
     [self.dirtyPropertySet addObject:@"firstLogin"];
 
     _firstLogin = [newFirstLogin copy];
@@ -84,6 +86,7 @@
 
 - (void)setLastLogin:(JRDateTime *)newLastLogin
 {
+    [self willChangeProperty:@"lastLogin"];
     [self.dirtyPropertySet addObject:@"lastLogin"];
 
     _lastLogin = [newLastLogin copy];
@@ -96,6 +99,7 @@
 
 - (void)setName:(NSString *)newName
 {
+    [self willChangeProperty:@"name"];
     [self.dirtyPropertySet addObject:@"name"];
 
     _name = [newName copy];
@@ -143,18 +147,45 @@
     return [[JRClientsElement alloc] initWithClientId:clientId];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRClientsElement *clientsElementCopy = (JRClientsElement *)[super copyWithZone:zone];
+
+    clientsElementCopy->_clientId = _clientId;
+    clientsElementCopy->_firstLogin = _firstLogin;
+    clientsElementCopy->_lastLogin = _lastLogin;
+    clientsElementCopy->_name = _name;
+
+    return clientsElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.clientId ? self.clientId : [NSNull null])
+    [dictionary setObject:(_clientId ? _clientId : [NSNull null])
                    forKey:@"clientId"];
-    [dictionary setObject:(self.firstLogin ? [self.firstLogin stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_firstLogin ? [_firstLogin stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"firstLogin"];
-    [dictionary setObject:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_lastLogin ? [_lastLogin stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"lastLogin"];
-    [dictionary setObject:(self.name ? self.name : [NSNull null])
+    [dictionary setObject:(_name ? _name : [NSNull null])
                    forKey:@"name"];
 
     if (forEncoder)
@@ -255,6 +286,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -271,6 +303,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"clientsElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"clientsElement"] allObjects]];
 
@@ -282,16 +316,16 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"clientId"])
-        [dictionary setObject:(self.clientId ? self.clientId : [NSNull null]) forKey:@"clientId"];
+        [dictionary setObject:(_clientId ? _clientId : [NSNull null]) forKey:@"clientId"];
 
     if ([self.dirtyPropertySet containsObject:@"firstLogin"])
-        [dictionary setObject:(self.firstLogin ? [self.firstLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"firstLogin"];
+        [dictionary setObject:(_firstLogin ? [_firstLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"firstLogin"];
 
     if ([self.dirtyPropertySet containsObject:@"lastLogin"])
-        [dictionary setObject:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
+        [dictionary setObject:(_lastLogin ? [_lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
 
     if ([self.dirtyPropertySet containsObject:@"name"])
-        [dictionary setObject:(self.name ? self.name : [NSNull null]) forKey:@"name"];
+        [dictionary setObject:(_name ? _name : [NSNull null]) forKey:@"name"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -307,10 +341,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.clientId ? self.clientId : [NSNull null]) forKey:@"clientId"];
-    [dictionary setObject:(self.firstLogin ? [self.firstLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"firstLogin"];
-    [dictionary setObject:(self.lastLogin ? [self.lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
-    [dictionary setObject:(self.name ? self.name : [NSNull null]) forKey:@"name"];
+    [dictionary setObject:(_clientId ? _clientId : [NSNull null]) forKey:@"clientId"];
+    [dictionary setObject:(_firstLogin ? [_firstLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"firstLogin"];
+    [dictionary setObject:(_lastLogin ? [_lastLogin stringFromISO8601DateTime] : [NSNull null]) forKey:@"lastLogin"];
+    [dictionary setObject:(_name ? _name : [NSNull null]) forKey:@"name"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -326,25 +360,48 @@
 
 - (BOOL)isEqualToClientsElement:(JRClientsElement *)otherClientsElement
 {
-    if (!self.clientId && !otherClientsElement.clientId) /* Keep going... */;
-    else if ((self.clientId == nil) ^ (otherClientsElement.clientId == nil)) return NO; // xor
-    else if (![self.clientId isEqualToString:otherClientsElement.clientId]) return NO;
+    if (!otherClientsElement) return NO;
+    if ([self hash] != [otherClientsElement hash]) return NO;
+
+    if (!_clientId && !otherClientsElement->_clientId) /* Keep going... */;
+    else if ((_clientId == nil) ^ (otherClientsElement->_clientId == nil)) return NO; // xor
+    else if (![_clientId isEqualToString:otherClientsElement->_clientId]) return NO;
 
-    if (!self.firstLogin && !otherClientsElement.firstLogin) /* Keep going... */;
-    else if ((self.firstLogin == nil) ^ (otherClientsElement.firstLogin == nil)) return NO; // xor
-    else if (![self.firstLogin isEqualToDate:otherClientsElement.firstLogin]) return NO;
+    if (!_firstLogin && !otherClientsElement->_firstLogin) /* Keep going... */;
+    else if ((_firstLogin == nil) ^ (otherClientsElement->_firstLogin == nil)) return NO; // xor
+    else if (![_firstLogin isEqualToDate:otherClientsElement->_firstLogin]) return NO;
 
-    if (!self.lastLogin && !otherClientsElement.lastLogin) /* Keep going... */;
-    else if ((self.lastLogin == nil) ^ (otherClientsElement.lastLogin == nil)) return NO; // xor
-    else if (![self.lastLogin isEqualToDate:otherClientsElement.lastLogin]) return NO;
+    if (!_lastLogin && !otherClientsElement->_lastLogin) /* Keep going... */;
+    else if ((_lastLogin == nil) ^ (otherClientsElement->_lastLogin == nil)) return NO; // xor
+    else if (![_lastLogin isEqualToDate:otherClientsElement->_lastLogin]) return NO;
 
-    if (!self.name && !otherClientsElement.name) /* Keep going... */;
-    else if ((self.name == nil) ^ (otherClientsElement.name == nil)) return NO; // xor
-    else if (![self.name isEqualToString:otherClientsElement.name]) return NO;
+    if (!_name && !otherClientsElement->_name) /* Keep going... */;
+    else if ((_name == nil) ^ (otherClientsElement->_name == nil)) return NO; // xor
+    else if (![_name isEqualToString:otherClientsElement->_name]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRClientsElement class]]) return NO;
+
+    return [self isEqualToClientsElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_clientId hash];
+    hash = hash * 31 + [_firstLogin hash];
+    hash = hash * 31 + [_lastLogin hash];
+    hash = hash * 31 + [_name hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
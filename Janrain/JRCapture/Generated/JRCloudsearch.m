@@ -58,6 +58,7 @@
 
 - (void)setSyncAttempts:(JRInteger *)newSyncAttempts
 {
+    [self willChangeProperty:@"syncAttempts"];
     [self.dirtyPropertySet addObject:@"syncAttempts"];
 
     _syncAttempts = [newSyncAttempts copy];
@@ -70,6 +71,7 @@
 
 - (void)setSyncAttemptsWithInteger:(NSInteger)integerVal
 {
+    [self willChangeProperty:@"syncAttempts"];
     [self.dirtyPropertySet addObject:@"syncAttempts"];
 
     _syncAttempts = [NSNumber numberWithInteger:integerVal];
@@ -82,6 +84,7 @@
 
 - (void)setSyncUpdated:(JRDateTime *)newSyncUpdated
 {
+    [self willChangeProperty:@"syncUpdated"];
     [self.dirtyPropertySet addObject:@"syncUpdated"];
 
     _syncUpdated = [newSyncUpdated copy];
@@ -105,14 +108,39 @@
     return [[JRCloudsearch alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRCloudsearch *cloudsearchCopy = (JRCloudsearch *)[super copyWithZone:zone];
+
+    cloudsearchCopy->_syncAttempts = _syncAttempts;
+    cloudsearchCopy->_syncUpdated = _syncUpdated;
+
+    return cloudsearchCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.syncAttempts ? [NSNumber numberWithInteger:[self.syncAttempts integerValue]] : [NSNull null])
+    [dictionary setObject:(_syncAttempts ? [NSNumber numberWithInteger:[_syncAttempts integerValue]] : [NSNull null])
                    forKey:@"syncAttempts"];
-    [dictionary setObject:(self.syncUpdated ? [self.syncUpdated stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_syncUpdated ? [_syncUpdated stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"syncUpdated"];
 
     if (forEncoder)
@@ -190,6 +218,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -206,6 +235,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"cloudsearch"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"cloudsearch"] allObjects]];
 
@@ -217,10 +248,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"syncAttempts"])
-        [dictionary setObject:(self.syncAttempts ? [NSNumber numberWithInteger:[self.syncAttempts integerValue]] : [NSNull null]) forKey:@"syncAttempts"];
+        [dictionary setObject:(_syncAttempts ? [NSNumber numberWithInteger:[_syncAttempts integerValue]] : [NSNull null]) forKey:@"syncAttempts"];
 
     if ([self.dirtyPropertySet containsObject:@"syncUpdated"])
-        [dictionary setObject:(self.syncUpdated ? [self.syncUpdated stringFromISO8601DateTime] : [NSNull null]) forKey:@"syncUpdated"];
+        [dictionary setObject:(_syncUpdated ? [_syncUpdated stringFromISO8601DateTime] : [NSNull null]) forKey:@"syncUpdated"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -236,8 +267,8 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.syncAttempts ? [NSNumber numberWithInteger:[self.syncAttempts integerValue]] : [NSNull null]) forKey:@"syncAttempts"];
-    [dictionary setObject:(self.syncUpdated ? [self.syncUpdated stringFromISO8601DateTime] : [NSNull null]) forKey:@"syncUpdated"];
+    [dictionary setObject:(_syncAttempts ? [NSNumber numberWithInteger:[_syncAttempts integerValue]] : [NSNull null]) forKey:@"syncAttempts"];
+    [dictionary setObject:(_syncUpdated ? [_syncUpdated stringFromISO8601DateTime] : [NSNull null]) forKey:@"syncUpdated"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -253,17 +284,38 @@
 
 - (BOOL)isEqualToCloudsearch:(JRCloudsearch *)otherCloudsearch
 {
-    if (!self.syncAttempts && !otherCloudsearch.syncAttempts) /* Keep going... */;
-    else if ((self.syncAttempts == nil) ^ (otherCloudsearch.syncAttempts == nil)) return NO; // xor
-    else if (![self.syncAttempts isEqualToNumber:otherCloudsearch.syncAttempts]) return NO;
+    if (!otherCloudsearch) return NO;
+    if ([self hash] != [otherCloudsearch hash]) return NO;
+
+    if (!_syncAttempts && !otherCloudsearch->_syncAttempts) /* Keep going... */;
+    else if ((_syncAttempts == nil) ^ (otherCloudsearch->_syncAttempts == nil)) return NO; // xor
+    else if (![_syncAttempts isEqualToNumber:otherCloudsearch->_syncAttempts]) return NO;
 
-    if (!self.syncUpdated && !otherCloudsearch.syncUpdated) /* Keep going... */;
-    else if ((self.syncUpdated == nil) ^ (otherCloudsearch.syncUpdated == nil)) return NO; // xor
-    else if (![self.syncUpdated isEqualToDate:otherCloudsearch.syncUpdated]) return NO;
+    if (!_syncUpdated && !otherCloudsearch->_syncUpdated) /* Keep going... */;
+    else if ((_syncUpdated == nil) ^ (otherCloudsearch->_syncUpdated == nil)) return NO; // xor
+    else if (![_syncUpdated isEqualToDate:otherCloudsearch->_syncUpdated]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRCloudsearch class]]) return NO;
+
+    return [self isEqualToCloudsearch:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_syncAttempts hash];
+    hash = hash * 31 + [_syncUpdated hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -63,28 +63,36 @@
 
 - (JRCloudsearch *)cloudsearch
 {
+    if ([self.sharedPropertySet containsObject:@"cloudsearch"])
+        [self unshareProperty:@"cloudsearch"];
+
     return _cloudsearch;
 }
 
 - (void)setCloudsearch:(JRCloudsearch *)newCloudsearch
 {
+    [self willChangeProperty:@"cloudsearch"];
     [self.dirtyPropertySet addObject:@"cloudsearch"];
 
-    _cloudsearch = newCloudsearch;
+    _cloudsearch = [self claimValue:newCloudsearch forProperty:@"cloudsearch"];
 
     [_cloudsearch setAllPropertiesToDirty];
 }
 
 - (JRProperties *)properties
 {
+    if ([self.sharedPropertySet containsObject:@"properties"])
+        [self unshareProperty:@"properties"];
+
     return _properties;
 }
 
 - (void)setProperties:(JRProperties *)newProperties
 {
+    [self willChangeProperty:@"properties"];
     [self.dirtyPropertySet addObject:@"properties"];
 
-    _properties = newProperties;
+    _properties = [self claimValue:newProperties forProperty:@"properties"];
 
     [_properties setAllPropertiesToDirty];
 }
@@ -96,8 +104,8 @@
         self.captureObjectPath = @"/janrain";
         self.canBeUpdatedOnCapture = YES;
 
-        _cloudsearch = [[JRCloudsearch alloc] init];
-        _properties = [[JRProperties alloc] init];
+        _cloudsearch = [self claimValue:[[JRCloudsearch alloc] init] forProperty:@"cloudsearch"];
+        _properties = [self claimValue:[[JRProperties alloc] init] forProperty:@"properties"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -109,14 +117,43 @@
     return [[JRJanrain alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRJanrain *janrainCopy = (JRJanrain *)[super copyWithZone:zone];
+
+    janrainCopy->_cloudsearch = _cloudsearch;
+    janrainCopy->_properties = _properties;
+
+    return janrainCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"cloudsearch", @"properties", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"cloudsearch"]) return _cloudsearch;
+    if ([propertyName isEqualToString:@"properties"]) return _properties;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"cloudsearch"]) _cloudsearch = value;
+    if ([propertyName isEqualToString:@"properties"]) _properties = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.cloudsearch ? [self.cloudsearch newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_cloudsearch ? [_cloudsearch newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"cloudsearch"];
-    [dictionary setObject:(self.properties ? [self.properties newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_properties ? [_properties newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"properties"];
 
     if (forEncoder)
@@ -200,6 +237,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -211,12 +249,12 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"janrain"];
 
-    if (self.cloudsearch)
-        [snapshotDictionary setObject:[self.cloudsearch snapshotDictionaryFromDirtyPropertySet]
+    if (_cloudsearch)
+        [snapshotDictionary setObject:[_cloudsearch snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"cloudsearch"];
 
-    if (self.properties)
-        [snapshotDictionary setObject:[self.properties snapshotDictionaryFromDirtyPropertySet]
+    if (_properties)
+        [snapshotDictionary setObject:[_properties snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"properties"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -224,6 +262,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"janrain"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"janrain"] allObjects]];
 
@@ -243,21 +283,21 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"cloudsearch"])
-        [dictionary setObject:(self.cloudsearch ?
-                              [self.cloudsearch toUpdateDictionary] :
+        [dictionary setObject:(_cloudsearch ?
+                              [_cloudsearch toUpdateDictionary] :
                               [[JRCloudsearch cloudsearch] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"cloudsearch"];
-    else if ([self.cloudsearch needsUpdate])
-        [dictionary setObject:[self.cloudsearch toUpdateDictionary]
+    else if ([_cloudsearch needsUpdate])
+        [dictionary setObject:[_cloudsearch toUpdateDictionary]
                        forKey:@"cloudsearch"];
 
     if ([self.dirtyPropertySet containsObject:@"properties"])
-        [dictionary setObject:(self.properties ?
-                              [self.properties toUpdateDictionary] :
+        [dictionary setObject:(_properties ?
+                              [_properties toUpdateDictionary] :
                               [[JRProperties properties] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"properties"];
-    else if ([self.properties needsUpdate])
-        [dictionary setObject:[self.properties toUpdateDictionary]
+    else if ([_properties needsUpdate])
+        [dictionary setObject:[_properties toUpdateDictionary]
                        forKey:@"properties"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -275,13 +315,13 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
 
-    [dictionary setObject:(self.cloudsearch ?
-                          [self.cloudsearch toReplaceDictionary] :
+    [dictionary setObject:(_cloudsearch ?
+                          [_cloudsearch toReplaceDictionary] :
                           [[JRCloudsearch cloudsearch] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"cloudsearch"];
 
-    [dictionary setObject:(self.properties ?
-                          [self.properties toReplaceDictionary] :
+    [dictionary setObject:(_properties ?
+                          [_properties toReplaceDictionary] :
                           [[JRProperties properties] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"properties"];
 
@@ -294,10 +334,10 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.cloudsearch needsUpdate])
+    if ([_cloudsearch needsUpdate])
         return YES;
 
-    if ([self.properties needsUpdate])
+    if ([_properties needsUpdate])
         return YES;
 
     return NO;
@@ -305,19 +345,40 @@
 
 - (BOOL)isEqualToJanrain:(JRJanrain *)otherJanrain
 {
-    if (!self.cloudsearch && !otherJanrain.cloudsearch) /* Keep going... */;
-    else if (!self.cloudsearch && [otherJanrain.cloudsearch isEqualToCloudsearch:[JRCloudsearch cloudsearch]]) /* Keep going... */;
-    else if (!otherJanrain.cloudsearch && [self.cloudsearch isEqualToCloudsearch:[JRCloudsearch cloudsearch]]) /* Keep going... */;
-    else if (![self.cloudsearch isEqualToCloudsearch:otherJanrain.cloudsearch]) return NO;
+    if (!otherJanrain) return NO;
+    if ([self hash] != [otherJanrain hash]) return NO;
 
-    if (!self.properties && !otherJanrain.properties) /* Keep going... */;
-    else if (!self.properties && [otherJanrain.properties isEqualToProperties:[JRProperties properties]]) /* Keep going... */;
-    else if (!otherJanrain.properties && [self.properties isEqualToProperties:[JRProperties properties]]) /* Keep going... */;
-    else if (![self.properties isEqualToProperties:otherJanrain.properties]) return NO;
+    if (!_cloudsearch && !otherJanrain->_cloudsearch) /* Keep going... */;
+    else if (!_cloudsearch && [otherJanrain->_cloudsearch isEqualToCloudsearch:[JRCloudsearch cloudsearch]]) /* Keep going... */;
+    else if (!otherJanrain->_cloudsearch && [_cloudsearch isEqualToCloudsearch:[JRCloudsearch cloudsearch]]) /* Keep going... */;
+    else if (![_cloudsearch isEqualToCloudsearch:otherJanrain->_cloudsearch]) return NO;
+
+    if (!_properties && !otherJanrain->_properties) /* Keep going... */;
+    else if (!_properties && [otherJanrain->_properties isEqualToProperties:[JRProperties properties]]) /* Keep going... */;
+    else if (!otherJanrain->_properties && [_properties isEqualToProperties:[JRProperties properties]]) /* Keep going... */;
+    else if (![_properties isEqualToProperties:otherJanrain->_properties]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRJanrain class]]) return NO;
+
+    return [self isEqualToJanrain:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_cloudsearch hash];
+    hash = hash * 31 + [_properties hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -67,6 +67,7 @@
 
 - (void)setCountry:(NSString *)newCountry
 {
+    [self willChangeProperty:@"country"];
     [self.dirtyPropertySet addObject:@"country"];
 
     _country = [newCountry copy];
@@ -79,6 +80,7 @@
 
 - (void)setExtendedAddress:(NSString *)newExtendedAddress
 {
+    [self willChangeProperty:@"extendedAddress"];
     [self.dirtyPropertySet addObject:@"extendedAddress"];
 
     _extendedAddress = [newExtendedAddress copy];
@@ -91,6 +93,7 @@
 
 - (void)setFormatted:(NSString *)newFormatted
 {
+    [self willChangeProperty:@"formatted"];
     [self.dirtyPropertySet addObject:@"formatted"];
 
     _formatted = [newFormatted copy];
@@ -103,6 +106,7 @@
 
 - (void)setLatitude:(JRDecimal *)newLatitude
 {
+    [self willChangeProperty:@"latitude"];
     [self.dirtyPropertySet addObject:@"latitude"];
 
     _latitude = [newLatitude copy];
@@ -115,6 +119,7 @@
 
 - (void)setLocality:(NSString *)newLocality
 {
+    [self willChangeProperty:@"locality"];
     [self.dirtyPropertySet addObject:@"locality"];
 
     _locality = [newLocality copy];
@@ -127,6 +132,7 @@
 
 - (void)setLongitude:(JRDecimal *)newLongitude
 {
+    [self willChangeProperty:@"longitude"];
     [self.dirtyPropertySet addObject:@"longitude"];
 
     _longitude = [newLongitude copy];
@@ -139,6 +145,7 @@
 
 - (void)setPoBox:(NSString *)newPoBox
 {
+    [self willChangeProperty:@"poBox"];
     [self.dirtyPropertySet addObject:@"poBox"];
 
     _poBox = [newPoBox copy];
@@ -151,6 +158,7 @@
 
 - (void)setPostalCode:(NSString *)newPostalCode
 {
+    [self willChangeProperty:@"postalCode"];
     [self.dirtyPropertySet addObject:@"postalCode"];
 
     _postalCode = [newPostalCode copy];
@@ -163,6 +171,7 @@
 
 - (void)setRegion:(NSString *)newRegion
 {
+    [self willChangeProperty:@"region"];
     [self.dirtyPropertySet addObject:@"region"];
 
     _region = [newRegion copy];
@@ -175,6 +184,7 @@
 
 - (void)setStreetAddress:(NSString *)newStreetAddress
 {
+    [self willChangeProperty:@"streetAddress"];
     [self.dirtyPropertySet addObject:@"streetAddress"];
 
     _streetAddress = [newStreetAddress copy];
@@ -187,6 +197,7 @@
 
 - (void)setType:(NSString *)newType
 {
+    [self willChangeProperty:@"type"];
     [self.dirtyPropertySet addObject:@"type"];
 
     _type = [newType copy];
@@ -210,32 +221,66 @@
     return [[JRLocation alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRLocation *locationCopy = (JRLocation *)[super copyWithZone:zone];
+
+    locationCopy->_country = _country;
+    locationCopy->_extendedAddress = _extendedAddress;
+    locationCopy->_formatted = _formatted;
+    locationCopy->_latitude = _latitude;
+    locationCopy->_locality = _locality;
+    locationCopy->_longitude = _longitude;
+    locationCopy->_poBox = _poBox;
+    locationCopy->_postalCode = _postalCode;
+    locationCopy->_region = _region;
+    locationCopy->_streetAddress = _streetAddress;
+    locationCopy->_type = _type;
+
+    return locationCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.country ? self.country : [NSNull null])
+    [dictionary setObject:(_country ? _country : [NSNull null])
                    forKey:@"country"];
-    [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null])
+    [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null])
                    forKey:@"extendedAddress"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null])
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null])
                    forKey:@"formatted"];
-    [dictionary setObject:(self.latitude ? self.latitude : [NSNull null])
+    [dictionary setObject:(_latitude ? _latitude : [NSNull null])
                    forKey:@"latitude"];
-    [dictionary setObject:(self.locality ? self.locality : [NSNull null])
+    [dictionary setObject:(_locality ? _locality : [NSNull null])
                    forKey:@"locality"];
-    [dictionary setObject:(self.longitude ? self.longitude : [NSNull null])
+    [dictionary setObject:(_longitude ? _longitude : [NSNull null])
                    forKey:@"longitude"];
-    [dictionary setObject:(self.poBox ? self.poBox : [NSNull null])
+    [dictionary setObject:(_poBox ? _poBox : [NSNull null])
                    forKey:@"poBox"];
-    [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null])
+    [dictionary setObject:(_postalCode ? _postalCode : [NSNull null])
                    forKey:@"postalCode"];
-    [dictionary setObject:(self.region ? self.region : [NSNull null])
+    [dictionary setObject:(_region ? _region : [NSNull null])
                    forKey:@"region"];
-    [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null])
+    [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null])
                    forKey:@"streetAddress"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null])
+    [dictionary setObject:(_type ? _type : [NSNull null])
                    forKey:@"type"];
 
     if (forEncoder)
@@ -392,6 +437,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -408,6 +454,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"location"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"location"] allObjects]];
 
@@ -419,37 +467,37 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"country"])
-        [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
+        [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
 
     if ([self.dirtyPropertySet containsObject:@"extendedAddress"])
-        [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
+        [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"formatted"])
-        [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
+        [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
 
     if ([self.dirtyPropertySet containsObject:@"latitude"])
-        [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
+        [dictionary setObject:(_latitude ? _latitude : [NSNull null]) forKey:@"latitude"];
 
     if ([self.dirtyPropertySet containsObject:@"locality"])
-        [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
+        [dictionary setObject:(_locality ? _locality : [NSNull null]) forKey:@"locality"];
 
     if ([self.dirtyPropertySet containsObject:@"longitude"])
-        [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
+        [dictionary setObject:(_longitude ? _longitude : [NSNull null]) forKey:@"longitude"];
 
     if ([self.dirtyPropertySet containsObject:@"poBox"])
-        [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
+        [dictionary setObject:(_poBox ? _poBox : [NSNull null]) forKey:@"poBox"];
 
     if ([self.dirtyPropertySet containsObject:@"postalCode"])
-        [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
+        [dictionary setObject:(_postalCode ? _postalCode : [NSNull null]) forKey:@"postalCode"];
 
     if ([self.dirtyPropertySet containsObject:@"region"])
-        [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
+        [dictionary setObject:(_region ? _region : [NSNull null]) forKey:@"region"];
 
     if ([self.dirtyPropertySet containsObject:@"streetAddress"])
-        [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
+        [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null]) forKey:@"streetAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"type"])
-        [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+        [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -465,17 +513,17 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
-    [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
-    [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
-    [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
-    [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
-    [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
-    [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
-    [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
-    [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+    [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
+    [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
+    [dictionary setObject:(_latitude ? _latitude : [NSNull null]) forKey:@"latitude"];
+    [dictionary setObject:(_locality ? _locality : [NSNull null]) forKey:@"locality"];
+    [dictionary setObject:(_longitude ? _longitude : [NSNull null]) forKey:@"longitude"];
+    [dictionary setObject:(_poBox ? _poBox : [NSNull null]) forKey:@"poBox"];
+    [dictionary setObject:(_postalCode ? _postalCode : [NSNull null]) forKey:@"postalCode"];
+    [dictionary setObject:(_region ? _region : [NSNull null]) forKey:@"region"];
+    [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null]) forKey:@"streetAddress"];
+    [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -491,53 +539,83 @@
 
 - (BOOL)isEqualToLocation:(JRLocation *)otherLocation
 {
-    if (!self.country && !otherLocation.country) /* Keep going... */;
-    else if ((self.country == nil) ^ (otherLocation.country == nil)) return NO; // xor
-    else if (![self.country isEqualToString:otherLocation.country]) return NO;
+    if (!otherLocation) return NO;
+    if ([self hash] != [otherLocation hash]) return NO;
+
+    if (!_country && !otherLocation->_country) /* Keep going... */;
+    else if ((_country == nil) ^ (otherLocation->_country == nil)) return NO; // xor
+    else if (![_country isEqualToString:otherLocation->_country]) return NO;
 
-    if (!self.extendedAddress && !otherLocation.extendedAddress) /* Keep going... */;
-    else if ((self.extendedAddress == nil) ^ (otherLocation.extendedAddress == nil)) return NO; // xor
-    else if (![self.extendedAddress isEqualToString:otherLocation.extendedAddress]) return NO;
+    if (!_extendedAddress && !otherLocation->_extendedAddress) /* Keep going... */;
+    else if ((_extendedAddress == nil) ^ (otherLocation->_extendedAddress == nil)) return NO; // xor
+    else if (![_extendedAddress isEqualToString:otherLocation->_extendedAddress]) return NO;
 
-    if (!self.formatted && !otherLocation.formatted) /* Keep going... */;
-    else if ((self.formatted == nil) ^ (otherLocation.formatted == nil)) return NO; // xor
-    else if (![self.formatted isEqualToString:otherLocation.formatted]) return NO;
+    if (!_formatted && !otherLocation->_formatted) /* Keep going... */;
+    else if ((_formatted == nil) ^ (otherLocation->_formatted == nil)) return NO; // xor
+    else if (![_formatted isEqualToString:otherLocation->_formatted]) return NO;
 
-    if (!self.latitude && !otherLocation.latitude) /* Keep going... */;
-    else if ((self.latitude == nil) ^ (otherLocation.latitude == nil)) return NO; // xor
-    else if (![self.latitude isEqualToNumber:otherLocation.latitude]) return NO;
+    if (!_latitude && !otherLocation->_latitude) /* Keep going... */;
+    else if ((_latitude == nil) ^ (otherLocation->_latitude == nil)) return NO; // xor
+    else if (![_latitude isEqualToNumber:otherLocation->_latitude]) return NO;
 
-    if (!self.locality && !otherLocation.locality) /* Keep going... */;
-    else if ((self.locality == nil) ^ (otherLocation.locality == nil)) return NO; // xor
-    else if (![self.locality isEqualToString:otherLocation.locality]) return NO;
+    if (!_locality && !otherLocation->_locality) /* Keep going... */;
+    else if ((_locality == nil) ^ (otherLocation->_locality == nil)) return NO; // xor
+    else if (![_locality isEqualToString:otherLocation->_locality]) return NO;
 
-    if (!self.longitude && !otherLocation.longitude) /* Keep going... */;
-    else if ((self.longitude == nil) ^ (otherLocation.longitude == nil)) return NO; // xor
-    else if (![self.longitude isEqualToNumber:otherLocation.longitude]) return NO;
+    if (!_longitude && !otherLocation->_longitude) /* Keep going... */;
+    else if ((_longitude == nil) ^ (otherLocation->_longitude == nil)) return NO; // xor
+    else if (![_longitude isEqualToNumber:otherLocation->_longitude]) return NO;
 
-    if (!self.poBox && !otherLocation.poBox) /* Keep going... */;
-    else if ((self.poBox == nil) ^ (otherLocation.poBox == nil)) return NO; // xor
-    else if (![self.poBox isEqualToString:otherLocation.poBox]) return NO;
+    if (!_poBox && !otherLocation->_poBox) /* Keep going... */;
+    else if ((_poBox == nil) ^ (otherLocation->_poBox == nil)) return NO; // xor
+    else if (![_poBox isEqualToString:otherLocation->_poBox]) return NO;
 
-    if (!self.postalCode && !otherLocation.postalCode) /* Keep going... */;
-    else if ((self.postalCode == nil) ^ (otherLocation.postalCode == nil)) return NO; // xor
-    else if (![self.postalCode isEqualToString:otherLocation.postalCode]) return NO;
+    if (!_postalCode && !otherLocation->_postalCode) /* Keep going... */;
+    else if ((_postalCode == nil) ^ (otherLocation->_postalCode == nil)) return NO; // xor
+    else if (![_postalCode isEqualToString:otherLocation->_postalCode]) return NO;
 
-    if (!self.region && !otherLocation.region) /* Keep going... */;
-    else if ((self.region == nil) ^ (otherLocation.region == nil)) return NO; // xor
-    else if (![self.region isEqualToString:otherLocation.region]) return NO;
+    if (!_region && !otherLocation->_region) /* Keep going... */;
+    else if ((_region == nil) ^ (otherLocation->_region == nil)) return NO; // xor
+    else if (![_region isEqualToString:otherLocation->_region]) return NO;
 
-    if (!self.streetAddress && !otherLocation.streetAddress) /* Keep going... */;
-    else if ((self.streetAddress == nil) ^ (otherLocation.streetAddress == nil)) return NO; // xor
-    else if (![self.streetAddress isEqualToString:otherLocation.streetAddress]) return NO;
+    if (!_streetAddress && !otherLocation->_streetAddress) /* Keep going... */;
+    else if ((_streetAddress == nil) ^ (otherLocation->_streetAddress == nil)) return NO; // xor
+    else if (![_streetAddress isEqualToString:otherLocation->_streetAddress]) return NO;
 
-    if (!self.type && !otherLocation.type) /* Keep going... */;
-    else if ((self.type == nil) ^ (otherLocation.type == nil)) return NO; // xor
-    else if (![self.type isEqualToString:otherLocation.type]) return NO;
+    if (!_type && !otherLocation->_type) /* Keep going... */;
+    else if ((_type == nil) ^ (otherLocation->_type == nil)) return NO; // xor
+    else if (![_type isEqualToString:otherLocation->_type]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRLocation class]]) return NO;
+
+    return [self isEqualToLocation:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_country hash];
+    hash = hash * 31 + [_extendedAddress hash];
+    hash = hash * 31 + [_formatted hash];
+    hash = hash * 31 + [_latitude hash];
+    hash = hash * 31 + [_locality hash];
+    hash = hash * 31 + [_longitude hash];
+    hash = hash * 31 + [_poBox hash];
+    hash = hash * 31 + [_postalCode hash];
+    hash = hash * 31 + [_region hash];
+    hash = hash * 31 + [_streetAddress hash];
+    hash = hash * 31 + [_type hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -59,6 +59,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [newPrimary copy];
@@ -71,6 +72,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [NSNumber numberWithBool:boolVal];
@@ -83,6 +85,7 @@
 
 - (void)setType:(NSString *)newType
 {
+    [self willChangeProperty:@"type"];
     [self.dirtyPropertySet addObject:@"type"];
 
     _type = [newType copy];
@@ -95,6 +98,7 @@
 
 - (void)setValue:(NSString *)newValue
 {
+    [self willChangeProperty:@"value"];
     [self.dirtyPropertySet addObject:@"value"];
 
     _value = [newValue copy];
@@ -118,16 +122,42 @@
     return [[JRPhoneNumbersElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPhoneNumbersElement *phoneNumbersElementCopy = (JRPhoneNumbersElement *)[super copyWithZone:zone];
+
+    phoneNumbersElementCopy->_primary = _primary;
+    phoneNumbersElementCopy->_type = _type;
+    phoneNumbersElementCopy->_value = _value;
+
+    return phoneNumbersElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null])
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null])
                    forKey:@"primary"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null])
+    [dictionary setObject:(_type ? _type : [NSNull null])
                    forKey:@"type"];
-    [dictionary setObject:(self.value ? self.value : [NSNull null])
+    [dictionary setObject:(_value ? _value : [NSNull null])
                    forKey:@"value"];
 
     if (forEncoder)
@@ -220,6 +250,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -236,6 +267,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"phoneNumbersElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"phoneNumbersElement"] allObjects]];
 
@@ -247,13 +280,13 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"primary"])
-        [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
+        [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
     if ([self.dirtyPropertySet containsObject:@"type"])
-        [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+        [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     if ([self.dirtyPropertySet containsObject:@"value"])
-        [dictionary setObject:(self.value ? self.value : [NSNull null]) forKey:@"value"];
+        [dictionary setObject:(_value ? _value : [NSNull null]) forKey:@"value"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -269,9 +302,9 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
-    [dictionary setObject:(self.value ? self.value : [NSNull null]) forKey:@"value"];
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
+    [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
+    [dictionary setObject:(_value ? _value : [NSNull null]) forKey:@"value"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -287,21 +320,43 @@
 
 - (BOOL)isEqualToPhoneNumbersElement:(JRPhoneNumbersElement *)otherPhoneNumbersElement
 {
-    if (!self.primary && !otherPhoneNumbersElement.primary) /* Keep going... */;
-    else if ((self.primary == nil) ^ (otherPhoneNumbersElement.primary == nil)) return NO; // xor
-    else if (![self.primary isEqualToNumber:otherPhoneNumbersElement.primary]) return NO;
+    if (!otherPhoneNumbersElement) return NO;
+    if ([self hash] != [otherPhoneNumbersElement hash]) return NO;
+
+    if (!_primary && !otherPhoneNumbersElement->_primary) /* Keep going... */;
+    else if ((_primary == nil) ^ (otherPhoneNumbersElement->_primary == nil)) return NO; // xor
+    else if (![_primary isEqualToNumber:otherPhoneNumbersElement->_primary]) return NO;
 
-    if (!self.type && !otherPhoneNumbersElement.type) /* Keep going... */;
-    else if ((self.type == nil) ^ (otherPhoneNumbersElement.type == nil)) return NO; // xor
-    else if (![self.type isEqualToString:otherPhoneNumbersElement.type]) return NO;
+    if (!_type && !otherPhoneNumbersElement->_type) /* Keep going... */;
+    else if ((_type == nil) ^ (otherPhoneNumbersElement->_type == nil)) return NO; // xor
+    else if (![_type isEqualToString:otherPhoneNumbersElement->_type]) return NO;
 
-    if (!self.value && !otherPhoneNumbersElement.value) /* Keep going... */;
-    else if ((self.value == nil) ^ (otherPhoneNumbersElement.value == nil)) return NO; // xor
-    else if (![self.value isEqualToString:otherPhoneNumbersElement.value]) return NO;
+    if (!_value && !otherPhoneNumbersElement->_value) /* Keep going... */;
+    else if ((_value == nil) ^ (otherPhoneNumbersElement->_value == nil)) return NO; // xor
+    else if (![_value isEqualToString:otherPhoneNumbersElement->_value]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPhoneNumbersElement class]]) return NO;
+
+    return [self isEqualToPhoneNumbersElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_primary hash];
+    hash = hash * 31 + [_type hash];
+    hash = hash * 31 + [_value hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -66,6 +66,7 @@
 
 - (void)setAddress1:(NSString *)newAddress1
 {
+    [self willChangeProperty:@"address1"];
     [self.dirtyPropertySet addObject:@"address1"];
 
     _address1 = [newAddress1 copy];
@@ -78,6 +79,7 @@
 
 - (void)setAddress2:(NSString *)newAddress2
 {
+    [self willChangeProperty:@"address2"];
     [self.dirtyPropertySet addObject:@"address2"];
 
     _address2 = [newAddress2 copy];
@@ -90,6 +92,7 @@
 
 - (void)setCity:(NSString *)newCity
 {
+    [self willChangeProperty:@"city"];
     [self.dirtyPropertySet addObject:@"city"];
 
     _city = [newCity copy];
@@ -102,6 +105,7 @@
 
 - (void)setCompany:(NSString *)newCompany
 {
+    [self willChangeProperty:@"company"];
     [self.dirtyPropertySet addObject:@"company"];
 
     _company = [newCompany copy];
@@ -114,6 +118,7 @@
 
 - (void)setCountry:(NSString *)newCountry
 {
+    [self willChangeProperty:@"country"];
     [self.dirtyPropertySet addObject:@"country"];
 
     _country = [newCountry copy];
@@ -126,6 +131,7 @@
 
 - (void)setMobile:(NSString *)newMobile
 {
+    [self willChangeProperty:@"mobile"];
     [self.dirtyPropertySet addObject:@"mobile"];
 
     _mobile = [newMobile copy];
@@ -138,6 +144,7 @@
 
 - (void)setPhone:(NSString *)newPhone
 {
+    [self willChangeProperty:@"phone"];
     [self.dirtyPropertySet addObject:@"phone"];
 
     _phone = [newPhone copy];
@@ -150,6 +157,7 @@
 
 - (void)setStateAbbreviation:(NSString *)newStateAbbreviation
 {
+    [self willChangeProperty:@"stateAbbreviation"];
     [self.dirtyPropertySet addObject:@"stateAbbreviation"];
 
     _stateAbbreviation = [newStateAbbreviation copy];
@@ -162,6 +170,7 @@
 
 - (void)setZip:(NSString *)newZip
 {
+    [self willChangeProperty:@"zip"];
     [self.dirtyPropertySet addObject:@"zip"];
 
     _zip = [newZip copy];
@@ -174,6 +183,7 @@
 
 - (void)setZipPlus4:(NSString *)newZipPlus4
 {
+    [self willChangeProperty:@"zipPlus4"];
     [self.dirtyPropertySet addObject:@"zipPlus4"];
 
     _zipPlus4 = [newZipPlus4 copy];
@@ -197,30 +207,63 @@
     return [[JRPrimaryAddress alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPrimaryAddress *primaryAddressCopy = (JRPrimaryAddress *)[super copyWithZone:zone];
+
+    primaryAddressCopy->_address1 = _address1;
+    primaryAddressCopy->_address2 = _address2;
+    primaryAddressCopy->_city = _city;
+    primaryAddressCopy->_company = _company;
+    primaryAddressCopy->_country = _country;
+    primaryAddressCopy->_mobile = _mobile;
+    primaryAddressCopy->_phone = _phone;
+    primaryAddressCopy->_stateAbbreviation = _stateAbbreviation;
+    primaryAddressCopy->_zip = _zip;
+    primaryAddressCopy->_zipPlus4 = _zipPlus4;
+
+    return primaryAddressCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.address1 ? self.address1 : [NSNull null])
+    [dictionary setObject:(_address1 ? _address1 : [NSNull null])
                    forKey:@"address1"];
-    [dictionary setObject:(self.address2 ? self.address2 : [NSNull null])
+    [dictionary setObject:(_address2 ? _address2 : [NSNull null])
                    forKey:@"address2"];
-    [dictionary setObject:(self.city ? self.city : [NSNull null])
+    [dictionary setObject:(_city ? _city : [NSNull null])
                    forKey:@"city"];
-    [dictionary setObject:(self.company ? self.company : [NSNull null])
+    [dictionary setObject:(_company ? _company : [NSNull null])
                    forKey:@"company"];
-    [dictionary setObject:(self.country ? self.country : [NSNull null])
+    [dictionary setObject:(_country ? _country : [NSNull null])
                    forKey:@"country"];
-    [dictionary setObject:(self.mobile ? self.mobile : [NSNull null])
+    [dictionary setObject:(_mobile ? _mobile : [NSNull null])
                    forKey:@"mobile"];
-    [dictionary setObject:(self.phone ? self.phone : [NSNull null])
+    [dictionary setObject:(_phone ? _phone : [NSNull null])
                    forKey:@"phone"];
-    [dictionary setObject:(self.stateAbbreviation ? self.stateAbbreviation : [NSNull null])
+    [dictionary setObject:(_stateAbbreviation ? _stateAbbreviation : [NSNull null])
                    forKey:@"stateAbbreviation"];
-    [dictionary setObject:(self.zip ? self.zip : [NSNull null])
+    [dictionary setObject:(_zip ? _zip : [NSNull null])
                    forKey:@"zip"];
-    [dictionary setObject:(self.zipPlus4 ? self.zipPlus4 : [NSNull null])
+    [dictionary setObject:(_zipPlus4 ? _zipPlus4 : [NSNull null])
                    forKey:@"zipPlus4"];
 
     if (forEncoder)
@@ -362,6 +405,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -378,6 +422,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"primaryAddress"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"primaryAddress"] allObjects]];
 
@@ -389,34 +435,34 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"address1"])
-        [dictionary setObject:(self.address1 ? self.address1 : [NSNull null]) forKey:@"address1"];
+        [dictionary setObject:(_address1 ? _address1 : [NSNull null]) forKey:@"address1"];
 
     if ([self.dirtyPropertySet containsObject:@"address2"])
-        [dictionary setObject:(self.address2 ? self.address2 : [NSNull null]) forKey:@"address2"];
+        [dictionary setObject:(_address2 ? _address2 : [NSNull null]) forKey:@"address2"];
 
     if ([self.dirtyPropertySet containsObject:@"city"])
-        [dictionary setObject:(self.city ? self.city : [NSNull null]) forKey:@"city"];
+        [dictionary setObject:(_city ? _city : [NSNull null]) forKey:@"city"];
 
     if ([self.dirtyPropertySet containsObject:@"company"])
-        [dictionary setObject:(self.company ? self.company : [NSNull null]) forKey:@"company"];
+        [dictionary setObject:(_company ? _company : [NSNull null]) forKey:@"company"];
 
     if ([self.dirtyPropertySet containsObject:@"country"])
-        [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
+        [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
 
     if ([self.dirtyPropertySet containsObject:@"mobile"])
-        [dictionary setObject:(self.mobile ? self.mobile : [NSNull null]) forKey:@"mobile"];
+        [dictionary setObject:(_mobile ? _mobile : [NSNull null]) forKey:@"mobile"];
 
     if ([self.dirtyPropertySet containsObject:@"phone"])
-        [dictionary setObject:(self.phone ? self.phone : [NSNull null]) forKey:@"phone"];
+        [dictionary setObject:(_phone ? _phone : [NSNull null]) forKey:@"phone"];
 
     if ([self.dirtyPropertySet containsObject:@"stateAbbreviation"])
-        [dictionary setObject:(self.stateAbbreviation ? self.stateAbbreviation : [NSNull null]) forKey:@"stateAbbreviation"];
+        [dictionary setObject:(_stateAbbreviation ? _stateAbbreviation : [NSNull null]) forKey:@"stateAbbreviation"];
 
     if ([self.dirtyPropertySet containsObject:@"zip"])
-        [dictionary setObject:(self.zip ? self.zip : [NSNull null]) forKey:@"zip"];
+        [dictionary setObject:(_zip ? _zip : [NSNull null]) forKey:@"zip"];
 
     if ([self.dirtyPropertySet containsObject:@"zipPlus4"])
-        [dictionary setObject:(self.zipPlus4 ? self.zipPlus4 : [NSNull null]) forKey:@"zipPlus4"];
+        [dictionary setObject:(_zipPlus4 ? _zipPlus4 : [NSNull null]) forKey:@"zipPlus4"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -432,16 +478,16 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.address1 ? self.address1 : [NSNull null]) forKey:@"address1"];
-    [dictionary setObject:(self.address2 ? self.address2 : [NSNull null]) forKey:@"address2"];
-    [dictionary setObject:(self.city ? self.city : [NSNull null]) forKey:@"city"];
-    [dictionary setObject:(self.company ? self.company : [NSNull null]) forKey:@"company"];
-    [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
-    [dictionary setObject:(self.mobile ? self.mobile : [NSNull null]) forKey:@"mobile"];
-    [dictionary setObject:(self.phone ? self.phone : [NSNull null]) forKey:@"phone"];
-    [dictionary setObject:(self.stateAbbreviation ? self.stateAbbreviation : [NSNull null]) forKey:@"stateAbbreviation"];
-    [dictionary setObject:(self.zip ? self.zip : [NSNull null]) forKey:@"zip"];
-    [dictionary setObject:(self.zipPlus4 ? self.zipPlus4 : [NSNull null]) forKey:@"zipPlus4"];
+    [dictionary setObject:(_address1 ? _address1 : [NSNull null]) forKey:@"address1"];
+    [dictionary setObject:(_address2 ? _address2 : [NSNull null]) forKey:@"address2"];
+    [dictionary setObject:(_city ? _city : [NSNull null]) forKey:@"city"];
+    [dictionary setObject:(_company ? _company : [NSNull null]) forKey:@"company"];
+    [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
+    [dictionary setObject:(_mobile ? _mobile : [NSNull null]) forKey:@"mobile"];
+    [dictionary setObject:(_phone ? _phone : [NSNull null]) forKey:@"phone"];
+    [dictionary setObject:(_stateAbbreviation ? _stateAbbreviation : [NSNull null]) forKey:@"stateAbbreviation"];
+    [dictionary setObject:(_zip ? _zip : [NSNull null]) forKey:@"zip"];
+    [dictionary setObject:(_zipPlus4 ? _zipPlus4 : [NSNull null]) forKey:@"zipPlus4"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -457,49 +503,78 @@
 
 - (BOOL)isEqualToPrimaryAddress:(JRPrimaryAddress *)otherPrimaryAddress
 {
-    if (!self.address1 && !otherPrimaryAddress.address1) /* Keep going... */;
-    else if ((self.address1 == nil) ^ (otherPrimaryAddress.address1 == nil)) return NO; // xor
-    else if (![self.address1 isEqualToString:otherPrimaryAddress.address1]) return NO;
+    if (!otherPrimaryAddress) return NO;
+    if ([self hash] != [otherPrimaryAddress hash]) return NO;
+
+    if (!_address1 && !otherPrimaryAddress->_address1) /* Keep going... */;
+    else if ((_address1 == nil) ^ (otherPrimaryAddress->_address1 == nil)) return NO; // xor
+    else if (![_address1 isEqualToString:otherPrimaryAddress->_address1]) return NO;
 
-    if (!self.address2 && !otherPrimaryAddress.address2) /* Keep going... */;
-    else if ((self.address2 == nil) ^ (otherPrimaryAddress.address2 == nil)) return NO; // xor
-    else if (![self.address2 isEqualToString:otherPrimaryAddress.address2]) return NO;
+    if (!_address2 && !otherPrimaryAddress->_address2) /* Keep going... */;
+    else if ((_address2 == nil) ^ (otherPrimaryAddress->_address2 == nil)) return NO; // xor
+    else if (![_address2 isEqualToString:otherPrimaryAddress->_address2]) return NO;
 
-    if (!self.city && !otherPrimaryAddress.city) /* Keep going... */;
-    else if ((self.city == nil) ^ (otherPrimaryAddress.city == nil)) return NO; // xor
-    else if (![self.city isEqualToString:otherPrimaryAddress.city]) return NO;
+    if (!_city && !otherPrimaryAddress->_city) /* Keep going... */;
+    else if ((_city == nil) ^ (otherPrimaryAddress->_city == nil)) return NO; // xor
+    else if (![_city isEqualToString:otherPrimaryAddress->_city]) return NO;
 
-    if (!self.company && !otherPrimaryAddress.company) /* Keep going... */;
-    else if ((self.company == nil) ^ (otherPrimaryAddress.company == nil)) return NO; // xor
-    else if (![self.company isEqualToString:otherPrimaryAddress.company]) return NO;
+    if (!_company && !otherPrimaryAddress->_company) /* Keep going... */;
+    else if ((_company == nil) ^ (otherPrimaryAddress->_company == nil)) return NO; // xor
+    else if (![_company isEqualToString:otherPrimaryAddress->_company]) return NO;
 
-    if (!self.country && !otherPrimaryAddress.country) /* Keep going... */;
-    else if ((self.country == nil) ^ (otherPrimaryAddress.country == nil)) return NO; // xor
-    else if (![self.country isEqualToString:otherPrimaryAddress.country]) return NO;
+    if (!_country && !otherPrimaryAddress->_country) /* Keep going... */;
+    else if ((_country == nil) ^ (otherPrimaryAddress->_country == nil)) return NO; // xor
+    else if (![_country isEqualToString:otherPrimaryAddress->_country]) return NO;
 
-    if (!self.mobile && !otherPrimaryAddress.mobile) /* Keep going... */;
-    else if ((self.mobile == nil) ^ (otherPrimaryAddress.mobile == nil)) return NO; // xor
-    else if (![self.mobile isEqualToString:otherPrimaryAddress.mobile]) return NO;
+    if (!_mobile && !otherPrimaryAddress->_mobile) /* Keep going... */;
+    else if ((_mobile == nil) ^ (otherPrimaryAddress->_mobile == nil)) return NO; // xor
+    else if (![_mobile isEqualToString:otherPrimaryAddress->_mobile]) return NO;
 
-    if (!self.phone && !otherPrimaryAddress.phone) /* Keep going... */;
-    else if ((self.phone == nil) ^ (otherPrimaryAddress.phone == nil)) return NO; // xor
-    else if (![self.phone isEqualToString:otherPrimaryAddress.phone]) return NO;
+    if (!_phone && !otherPrimaryAddress->_phone) /* Keep going... */;
+    else if ((_phone == nil) ^ (otherPrimaryAddress->_phone == nil)) return NO; // xor
+    else if (![_phone isEqualToString:otherPrimaryAddress->_phone]) return NO;
 
-    if (!self.stateAbbreviation && !otherPrimaryAddress.stateAbbreviation) /* Keep going... */;
-    else if ((self.stateAbbreviation == nil) ^ (otherPrimaryAddress.stateAbbreviation == nil)) return NO; // xor
-    else if (![self.stateAbbreviation isEqualToString:otherPrimaryAddress.stateAbbreviation]) return NO;
+    if (!_stateAbbreviation && !otherPrimaryAddress->_stateAbbreviation) /* Keep going... */;
+    else if ((_stateAbbreviation == nil) ^ (otherPrimaryAddress->_stateAbbreviation == nil)) return NO; // xor
+    else if (![_stateAbbreviation isEqualToString:otherPrimaryAddress->_stateAbbreviation]) return NO;
 
-    if (!self.zip && !otherPrimaryAddress.zip) /* Keep going... */;
-    else if ((self.zip == nil) ^ (otherPrimaryAddress.zip == nil)) return NO; // xor
-    else if (![self.zip isEqualToString:otherPrimaryAddress.zip]) return NO;
+    if (!_zip && !otherPrimaryAddress->_zip) /* Keep going... */;
+    else if ((_zip == nil) ^ (otherPrimaryAddress->_zip == nil)) return NO; // xor
+    else if (![_zip isEqualToString:otherPrimaryAddress->_zip]) return NO;
 
-    if (!self.zipPlus4 && !otherPrimaryAddress.zipPlus4) /* Keep going... */;
-    else if ((self.zipPlus4 == nil) ^ (otherPrimaryAddress.zipPlus4 == nil)) return NO; // xor
-    else if (![self.zipPlus4 isEqualToString:otherPrimaryAddress.zipPlus4]) return NO;
+    if (!_zipPlus4 && !otherPrimaryAddress->_zipPlus4) /* Keep going... */;
+    else if ((_zipPlus4 == nil) ^ (otherPrimaryAddress->_zipPlus4 == nil)) return NO; // xor
+    else if (![_zipPlus4 isEqualToString:otherPrimaryAddress->_zipPlus4]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPrimaryAddress class]]) return NO;
+
+    return [self isEqualToPrimaryAddress:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_address1 hash];
+    hash = hash * 31 + [_address2 hash];
+    hash = hash * 31 + [_city hash];
+    hash = hash * 31 + [_company hash];
+    hash = hash * 31 + [_country hash];
+    hash = hash * 31 + [_mobile hash];
+    hash = hash * 31 + [_phone hash];
+    hash = hash * 31 + [_stateAbbreviation hash];
+    hash = hash * 31 + [_zip hash];
+    hash = hash * 31 + [_zipPlus4 hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
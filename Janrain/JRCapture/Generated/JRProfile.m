@@ -610,6 +610,7 @@
 
 - (void)setAboutMe:(NSString *)newAboutMe
 {
+    [self willChangeProperty:@"aboutMe"];
     [self.dirtyPropertySet addObject:@"aboutMe"];
 
     _aboutMe = [newAboutMe copy];
@@ -617,12 +618,17 @@
 
 - (NSArray *)accounts
 {
+    if ([self.sharedPropertySet containsObject:@"accounts"])
+        [self unshareProperty:@"accounts"];
+
     return _accounts;
 }
 
 - (void)setAccounts:(NSArray *)newAccounts
 {
-    _accounts = [newAccounts copy];
+    [self willChangeProperty:@"accounts"];
+
+    _accounts = [self claimValue:[newAccounts copy] forProperty:@"accounts"];
 }
 
 - (JRStringArray *)activities
@@ -632,17 +638,24 @@
 
 - (void)setActivities:(JRStringArray *)newActivities
 {
+    [self willChangeProperty:@"activities"];
+
     _activities = [newActivities copy];
 }
 
 - (NSArray *)addresses
 {
+    if ([self.sharedPropertySet containsObject:@"addresses"])
+        [self unshareProperty:@"addresses"];
+
     return _addresses;
 }
 
 - (void)setAddresses:(NSArray *)newAddresses
 {
-    _addresses = [newAddresses copy];
+    [self willChangeProperty:@"addresses"];
+
+    _addresses = [self claimValue:[newAddresses copy] forProperty:@"addresses"];
 }
 
 - (JRDate *)anniversary
@@ -652,6 +665,7 @@
 
 - (void)setAnniversary:(JRDate *)newAnniversary
 {
+    [self willChangeProperty:@"anniversary"];
     [self.dirtyPropertySet addObject:@"anniversary"];
 
     _anniversary = [newAnniversary copy];
@@ -664,6 +678,7 @@
 
 - (void)setBirthday:(NSString *)newBirthday
 {
+    [self willChangeProperty:@"birthday"];
     [self.dirtyPropertySet addObject:@"birthday"];
 
     _birthday = [newBirthday copy];
@@ -671,14 +686,18 @@
 
 - (JRBodyType *)bodyType
 {
+    if ([self.sharedPropertySet containsObject:@"bodyType"])
+        [self unshareProperty:@"bodyType"];
+
     return _bodyType;
 }
 
 - (void)setBodyType:(JRBodyType *)newBodyType
 {
+    [self willChangeProperty:@"bodyType"];
     [self.dirtyPropertySet addObject:@"bodyType"];
 
-    _bodyType = newBodyType;
+    _bodyType = [self claimValue:newBodyType forProperty:@"bodyType"];
 
     [_bodyType setAllPropertiesToDirty];
 }
@@ -690,6 +709,8 @@
 
 - (void)setBooks:(JRStringArray *)newBooks
 {
+    [self willChangeProperty:@"books"];
+
     _books = [newBooks copy];
 }
 
@@ -700,6 +721,8 @@
 
 - (void)setCars:(JRStringArray *)newCars
 {
+    [self willChangeProperty:@"cars"];
+
     _cars = [newCars copy];
 }
 
@@ -710,19 +733,25 @@
 
 - (void)setChildren:(JRStringArray *)newChildren
 {
+    [self willChangeProperty:@"children"];
+
     _children = [newChildren copy];
 }
 
 - (JRCurrentLocation *)currentLocation
 {
+    if ([self.sharedPropertySet containsObject:@"currentLocation"])
+        [self unshareProperty:@"currentLocation"];
+
     return _currentLocation;
 }
 
 - (void)setCurrentLocation:(JRCurrentLocation *)newCurrentLocation
 {
+    [self willChangeProperty:@"currentLocation"];
     [self.dirtyPropertySet addObject:@"currentLocation"];
 
-    _currentLocation = newCurrentLocation;
+    _currentLocation = [self claimValue:newCurrentLocation forProperty:@"currentLocation"];
 
     [_currentLocation setAllPropertiesToDirty];
 }
@@ -734,6 +763,7 @@
 
 - (void)setDisplayName:(NSString *)newDisplayName
 {
+    [self willChangeProperty:@"displayName"];
     [self.dirtyPropertySet addObject:@"displayName"];
 
     _displayName = [newDisplayName copy];
@@ -746,6 +776,7 @@
 
 - (void)setDrinker:(NSString *)newDrinker
 {
+    [self willChangeProperty:@"drinker"];
     [self.dirtyPropertySet addObject:@"drinker"];
 
     _drinker = [newDrinker copy];
@@ -753,12 +784,17 @@
 
 - (NSArray *)emails
 {
+    if ([self.sharedPropertySet containsObject:@"emails"])
+        [self unshareProperty:@"emails"];
+
     return _emails;
 }
 
 - (void)setEmails:(NSArray *)newEmails
 {
-    _emails = [newEmails copy];
+    [self willChangeProperty:@"emails"];
+
+    _emails = [self claimValue:[newEmails copy] forProperty:@"emails"];
 }
 
 - (NSString *)ethnicity
@@ -768,6 +804,7 @@
 
 - (void)setEthnicity:(NSString *)newEthnicity
 {
+    [self willChangeProperty:@"ethnicity"];
     [self.dirtyPropertySet addObject:@"ethnicity"];
 
     _ethnicity = [newEthnicity copy];
@@ -780,6 +817,7 @@
 
 - (void)setFashion:(NSString *)newFashion
 {
+    [self willChangeProperty:@"fashion"];
     [self.dirtyPropertySet addObject:@"fashion"];
 
     _fashion = [newFashion copy];
@@ -792,6 +830,8 @@
 
 - (void)setFood:(JRStringArray *)newFood
 {
+    [self willChangeProperty:@"food"];
+
     _food = [newFood copy];
 }
 
@@ -802,6 +842,7 @@
 
 - (void)setGender:(NSString *)newGender
 {
+    [self willChangeProperty:@"gender"];
     [self.dirtyPropertySet addObject:@"gender"];
 
     _gender = [newGender copy];
@@ -814,6 +855,7 @@
 
 - (void)setHappiestWhen:(NSString *)newHappiestWhen
 {
+    [self willChangeProperty:@"happiestWhen"];
     [self.dirtyPropertySet addObject:@"happiestWhen"];
 
     _happiestWhen = [newHappiestWhen copy];
@@ -826,6 +868,8 @@
 
 - (void)setHeroes:(JRStringArray *)newHeroes
 {
+    [self willChangeProperty:@"heroes"];
+
     _heroes = [newHeroes copy];
 }
 
@@ -836,6 +880,7 @@
 
 - (void)setHumor:(NSString *)newHumor
 {
+    [self willChangeProperty:@"humor"];
     [self.dirtyPropertySet addObject:@"humor"];
 
     _humor = [newHumor copy];
@@ -843,12 +888,17 @@
 
 - (NSArray *)ims
 {
+    if ([self.sharedPropertySet containsObject:@"ims"])
+        [self unshareProperty:@"ims"];
+
     return _ims;
 }
 
 - (void)setIms:(NSArray *)newIms
 {
-    _ims = [newIms copy];
+    [self willChangeProperty:@"ims"];
+
+    _ims = [self claimValue:[newIms copy] forProperty:@"ims"];
 }
 
 - (JRStringArray *)interestedInMeeting
@@ -858,6 +908,8 @@
 
 - (void)setInterestedInMeeting:(JRStringArray *)newInterestedInMeeting
 {
+    [self willChangeProperty:@"interestedInMeeting"];
+
     _interestedInMeeting = [newInterestedInMeeting copy];
 }
 
@@ -868,6 +920,8 @@
 
 - (void)setInterests:(JRStringArray *)newInterests
 {
+    [self willChangeProperty:@"interests"];
+
     _interests = [newInterests copy];
 }
 
@@ -878,6 +932,8 @@
 
 - (void)setJobInterests:(JRStringArray *)newJobInterests
 {
+    [self willChangeProperty:@"jobInterests"];
+
     _jobInterests = [newJobInterests copy];
 }
 
@@ -888,6 +944,8 @@
 
 - (void)setLanguages:(JRStringArray *)newLanguages
 {
+    [self willChangeProperty:@"languages"];
+
     _languages = [newLanguages copy];
 }
 
@@ -898,6 +956,8 @@
 
 - (void)setLanguagesSpoken:(JRStringArray *)newLanguagesSpoken
 {
+    [self willChangeProperty:@"languagesSpoken"];
+
     _languagesSpoken = [newLanguagesSpoken copy];
 }
 
@@ -908,6 +968,7 @@
 
 - (void)setLivingArrangement:(NSString *)newLivingArrangement
 {
+    [self willChangeProperty:@"livingArrangement"];
     [self.dirtyPropertySet addObject:@"livingArrangement"];
 
     _livingArrangement = [newLivingArrangement copy];
@@ -920,6 +981,8 @@
 
 - (void)setLookingFor:(JRStringArray *)newLookingFor
 {
+    [self willChangeProperty:@"lookingFor"];
+
     _lookingFor = [newLookingFor copy];
 }
 
@@ -930,6 +993,8 @@
 
 - (void)setMovies:(JRStringArray *)newMovies
 {
+    [self willChangeProperty:@"movies"];
+
     _movies = [newMovies copy];
 }
 
@@ -940,19 +1005,25 @@
 
 - (void)setMusic:(JRStringArray *)newMusic
 {
+    [self willChangeProperty:@"music"];
+
     _music = [newMusic copy];
 }
 
 - (JRName *)name
 {
+    if ([self.sharedPropertySet containsObject:@"name"])
+        [self unshareProperty:@"name"];
+
     return _name;
 }
 
 - (void)setName:(JRName *)newName
 {
+    [self willChangeProperty:@"name"];
     [self.dirtyPropertySet addObject:@"name"];
 
-    _name = newName;
+    _name = [self claimValue:newName forProperty:@"name"];
 
     [_name setAllPropertiesToDirty];
 }
@@ -964,6 +1035,7 @@
 
 - (void)setNickname:(NSString *)newNickname
 {
+    [self willChangeProperty:@"nickname"];
     [self.dirtyPropertySet addObject:@"nickname"];
 
     _nickname = [newNickname copy];
@@ -976,6 +1048,7 @@
 
 - (void)setNote:(NSString *)newNote
 {
+    [self willChangeProperty:@"note"];
     [self.dirtyPropertySet addObject:@"note"];
 
     _note = [newNote copy];
@@ -983,12 +1056,17 @@
 
 - (NSArray *)organizations
 {
+    if ([self.sharedPropertySet containsObject:@"organizations"])
+        [self unshareProperty:@"organizations"];
+
     return _organizations;
 }
 
 - (void)setOrganizations:(NSArray *)newOrganizations
 {
-    _organizations = [newOrganizations copy];
+    [self willChangeProperty:@"organizations"];
+
+    _organizations = [self claimValue:[newOrganizations copy] forProperty:@"organizations"];
 }
 
 - (JRStringArray *)pets
@@ -998,27 +1076,39 @@
 
 - (void)setPets:(JRStringArray *)newPets
 {
+    [self willChangeProperty:@"pets"];
+
     _pets = [newPets copy];
 }
 
 - (NSArray *)phoneNumbers
 {
+    if ([self.sharedPropertySet containsObject:@"phoneNumbers"])
+        [self unshareProperty:@"phoneNumbers"];
+
     return _phoneNumbers;
 }
 
 - (void)setPhoneNumbers:(NSArray *)newPhoneNumbers
 {
-    _phoneNumbers = [newPhoneNumbers copy];
+    [self willChangeProperty:@"phoneNumbers"];
+
+    _phoneNumbers = [self claimValue:[newPhoneNumbers copy] forProperty:@"phoneNumbers"];
 }
 
 - (NSArray *)profilePhotos
 {
+    if ([self.sharedPropertySet containsObject:@"profilePhotos"])
+        [self unshareProperty:@"profilePhotos"];
+
     return _profilePhotos;
 }
 
 - (void)setProfilePhotos:(NSArray *)newProfilePhotos
 {
-    _profilePhotos = [newProfilePhotos copy];
+    [self willChangeProperty:@"profilePhotos"];
+
+    _profilePhotos = [self claimValue:[newProfilePhotos copy] forProperty:@"profilePhotos"];
 }
 
 - (NSString *)politicalViews
@@ -1028,6 +1118,7 @@
 
 - (void)setPoliticalViews:(NSString *)newPoliticalViews
 {
+    [self willChangeProperty:@"politicalViews"];
     [self.dirtyPropertySet addObject:@"politicalViews"];
 
     _politicalViews = [newPoliticalViews copy];
@@ -1040,6 +1131,7 @@
 
 - (void)setPreferredUsername:(NSString *)newPreferredUsername
 {
+    [self willChangeProperty:@"preferredUsername"];
     [self.dirtyPropertySet addObject:@"preferredUsername"];
 
     _preferredUsername = [newPreferredUsername copy];
@@ -1052,6 +1144,7 @@
 
 - (void)setProfileSong:(NSString *)newProfileSong
 {
+    [self willChangeProperty:@"profileSong"];
     [self.dirtyPropertySet addObject:@"profileSong"];
 
     _profileSong = [newProfileSong copy];
@@ -1064,6 +1157,7 @@
 
 - (void)setProfileUrl:(NSString *)newProfileUrl
 {
+    [self willChangeProperty:@"profileUrl"];
     [self.dirtyPropertySet addObject:@"profileUrl"];
 
     _profileUrl = [newProfileUrl copy];
@@ -1076,6 +1170,7 @@
 
 - (void)setProfileVideo:(NSString *)newProfileVideo
 {
+    [self willChangeProperty:@"profileVideo"];
     [self.dirtyPropertySet addObject:@"profileVideo"];
 
     _profileVideo = [newProfileVideo copy];
@@ -1088,6 +1183,7 @@
 
 - (void)setPublished:(JRDateTime *)newPublished
 {
+    [self willChangeProperty:@"published"];
     [self.dirtyPropertySet addObject:@"published"];
 
     _published = [newPublished copy];
@@ -1100,6 +1196,8 @@
 
 - (void)setQuotes:(JRStringArray *)newQuotes
 {
+    [self willChangeProperty:@"quotes"];
+
     _quotes = [newQuotes copy];
 }
 
@@ -1110,6 +1208,7 @@
 
 - (void)setRelationshipStatus:(NSString *)newRelationshipStatus
 {
+    [self willChangeProperty:@"relationshipStatus"];
     [self.dirtyPropertySet addObject:@"relationshipStatus"];
 
     _relationshipStatus = [newRelationshipStatus copy];
@@ -1122,6 +1221,8 @@
 
 - (void)setRelationships:(JRStringArray *)newRelationships
 {
+    [self willChangeProperty:@"relationships"];
+
     _relationships = [newRelationships copy];
 }
 
@@ -1132,6 +1233,7 @@
 
 - (void)setReligion:(NSString *)newReligion
 {
+    [self willChangeProperty:@"religion"];
     [self.dirtyPropertySet addObject:@"religion"];
 
     _religion = [newReligion copy];
@@ -1144,6 +1246,7 @@
 
 - (void)setRomance:(NSString *)newRomance
 {
+    [self willChangeProperty:@"romance"];
     [self.dirtyPropertySet addObject:@"romance"];
 
     _romance = [newRomance copy];
@@ -1156,6 +1259,7 @@
 
 - (void)setScaredOf:(NSString *)newScaredOf
 {
+    [self willChangeProperty:@"scaredOf"];
     [self.dirtyPropertySet addObject:@"scaredOf"];
 
     _scaredOf = [newScaredOf copy];
@@ -1168,6 +1272,7 @@
 
 - (void)setSexualOrientation:(NSString *)newSexualOrientation
 {
+    [self willChangeProperty:@"sexualOrientation"];
     [self.dirtyPropertySet addObject:@"sexualOrientation"];
 
     _sexualOrientation = [newSexualOrientation copy];
@@ -1180,6 +1285,7 @@
 
 - (void)setSmoker:(NSString *)newSmoker
 {
+    [self willChangeProperty:@"smoker"];
     [self.dirtyPropertySet addObject:@"smoker"];
 
     _smoker = [newSmoker copy];
@@ -1192,6 +1298,8 @@
 
 - (void)setSports:(JRStringArray *)newSports
 {
+    [self willChangeProperty:@"sports"];
+
     _sports = [newSports copy];
 }
 
@@ -1202,6 +1310,7 @@
 
 - (void)setStatus:(NSString *)newStatus
 {
+    [self willChangeProperty:@"status"];
     [self.dirtyPropertySet addObject:@"status"];
 
     _status = [newStatus copy];
@@ -1214,6 +1323,8 @@
 
 - (void)setTags:(JRStringArray *)newTags
 {
+    [self willChangeProperty:@"tags"];
+
     _tags = [newTags copy];
 }
 
@@ -1224,6 +1335,8 @@
 
 - (void)setTurnOffs:(JRStringArray *)newTurnOffs
 {
+    [self willChangeProperty:@"turnOffs"];
+
     _turnOffs = [newTurnOffs copy];
 }
 
@@ -1234,6 +1347,8 @@
 
 - (void)setTurnOns:(JRStringArray *)newTurnOns
 {
+    [self willChangeProperty:@"turnOns"];
+
     _turnOns = [newTurnOns copy];
 }
 
@@ -1244,6 +1359,8 @@
 
 - (void)setTvShows:(JRStringArray *)newTvShows
 {
+    [self willChangeProperty:@"tvShows"];
+
     _tvShows = [newTvShows copy];
 }
 
@@ -1254,6 +1371,7 @@
 
 - (void)setUpdated:(JRDateTime *)newUpdated
 {
+    [self willChangeProperty:@"updated"];
     [self.dirtyPropertySet addObject:@"updated"];
 
     _updated = [newUpdated copy];
@@ -1261,12 +1379,17 @@
 
 - (NSArray *)urls
 {
+    if ([self.sharedPropertySet containsObject:@"urls"])
+        [self unshareProperty:@"urls"];
+
     return _urls;
 }
 
 - (void)setUrls:(NSArray *)newUrls
 {
-    _urls = [newUrls copy];
+    [self willChangeProperty:@"urls"];
+
+    _urls = [self claimValue:[newUrls copy] forProperty:@"urls"];
 }
 
 - (NSString *)utcOffset
@@ -1276,6 +1399,7 @@
 
 - (void)setUtcOffset:(NSString *)newUtcOffset
 {
+    [self willChangeProperty:@"utcOffset"];
     [self.dirtyPropertySet addObject:@"utcOffset"];
 
     _utcOffset = [newUtcOffset copy];
@@ -1288,9 +1412,9 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _bodyType = [[JRBodyType alloc] init];
-        _currentLocation = [[JRCurrentLocation alloc] init];
-        _name = [[JRName alloc] init];
+        _bodyType = [self claimValue:[[JRBodyType alloc] init] forProperty:@"bodyType"];
+        _currentLocation = [self claimValue:[[JRCurrentLocation alloc] init] forProperty:@"currentLocation"];
+        _name = [self claimValue:[[JRName alloc] init] forProperty:@"name"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -1302,132 +1426,238 @@
     return [[JRProfile alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRProfile *profileCopy = (JRProfile *)[super copyWithZone:zone];
+
+    profileCopy->_aboutMe = _aboutMe;
+    profileCopy->_accounts = _accounts;
+    profileCopy->_activities = _activities;
+    profileCopy->_addresses = _addresses;
+    profileCopy->_anniversary = _anniversary;
+    profileCopy->_birthday = _birthday;
+    profileCopy->_bodyType = _bodyType;
+    profileCopy->_books = _books;
+    profileCopy->_cars = _cars;
+    profileCopy->_children = _children;
+    profileCopy->_currentLocation = _currentLocation;
+    profileCopy->_displayName = _displayName;
+    profileCopy->_drinker = _drinker;
+    profileCopy->_emails = _emails;
+    profileCopy->_ethnicity = _ethnicity;
+    profileCopy->_fashion = _fashion;
+    profileCopy->_food = _food;
+    profileCopy->_gender = _gender;
+    profileCopy->_happiestWhen = _happiestWhen;
+    profileCopy->_heroes = _heroes;
+    profileCopy->_humor = _humor;
+    profileCopy->_ims = _ims;
+    profileCopy->_interestedInMeeting = _interestedInMeeting;
+    profileCopy->_interests = _interests;
+    profileCopy->_jobInterests = _jobInterests;
+    profileCopy->_languages = _languages;
+    profileCopy->_languagesSpoken = _languagesSpoken;
+    profileCopy->_livingArrangement = _livingArrangement;
+    profileCopy->_lookingFor = _lookingFor;
+    profileCopy->_movies = _movies;
+    profileCopy->_music = _music;
+    profileCopy->_name = _name;
+    profileCopy->_nickname = _nickname;
+    profileCopy->_note = _note;
+    profileCopy->_organizations = _organizations;
+    profileCopy->_pets = _pets;
+    profileCopy->_phoneNumbers = _phoneNumbers;
+    profileCopy->_profilePhotos = _profilePhotos;
+    profileCopy->_politicalViews = _politicalViews;
+    profileCopy->_preferredUsername = _preferredUsername;
+    profileCopy->_profileSong = _profileSong;
+    profileCopy->_profileUrl = _profileUrl;
+    profileCopy->_profileVideo = _profileVideo;
+    profileCopy->_published = _published;
+    profileCopy->_quotes = _quotes;
+    profileCopy->_relationshipStatus = _relationshipStatus;
+    profileCopy->_relationships = _relationships;
+    profileCopy->_religion = _religion;
+    profileCopy->_romance = _romance;
+    profileCopy->_scaredOf = _scaredOf;
+    profileCopy->_sexualOrientation = _sexualOrientation;
+    profileCopy->_smoker = _smoker;
+    profileCopy->_sports = _sports;
+    profileCopy->_status = _status;
+    profileCopy->_tags = _tags;
+    profileCopy->_turnOffs = _turnOffs;
+    profileCopy->_turnOns = _turnOns;
+    profileCopy->_tvShows = _tvShows;
+    profileCopy->_updated = _updated;
+    profileCopy->_urls = _urls;
+    profileCopy->_utcOffset = _utcOffset;
+
+    return profileCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"accounts", @"addresses", @"bodyType", @"currentLocation", @"emails", @"ims", @"name", @"organizations", @"phoneNumbers", @"profilePhotos", @"urls", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"accounts"]) return _accounts;
+    if ([propertyName isEqualToString:@"addresses"]) return _addresses;
+    if ([propertyName isEqualToString:@"bodyType"]) return _bodyType;
+    if ([propertyName isEqualToString:@"currentLocation"]) return _currentLocation;
+    if ([propertyName isEqualToString:@"emails"]) return _emails;
+    if ([propertyName isEqualToString:@"ims"]) return _ims;
+    if ([propertyName isEqualToString:@"name"]) return _name;
+    if ([propertyName isEqualToString:@"organizations"]) return _organizations;
+    if ([propertyName isEqualToString:@"phoneNumbers"]) return _phoneNumbers;
+    if ([propertyName isEqualToString:@"profilePhotos"]) return _profilePhotos;
+    if ([propertyName isEqualToString:@"urls"]) return _urls;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"accounts"]) _accounts = value;
+    if ([propertyName isEqualToString:@"addresses"]) _addresses = value;
+    if ([propertyName isEqualToString:@"bodyType"]) _bodyType = value;
+    if ([propertyName isEqualToString:@"currentLocation"]) _currentLocation = value;
+    if ([propertyName isEqualToString:@"emails"]) _emails = value;
+    if ([propertyName isEqualToString:@"ims"]) _ims = value;
+    if ([propertyName isEqualToString:@"name"]) _name = value;
+    if ([propertyName isEqualToString:@"organizations"]) _organizations = value;
+    if ([propertyName isEqualToString:@"phoneNumbers"]) _phoneNumbers = value;
+    if ([propertyName isEqualToString:@"profilePhotos"]) _profilePhotos = value;
+    if ([propertyName isEqualToString:@"urls"]) _urls = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null])
+    [dictionary setObject:(_aboutMe ? _aboutMe : [NSNull null])
                    forKey:@"aboutMe"];
-    [dictionary setObject:(self.accounts ? [self.accounts arrayOfAccountsDictionariesFromAccountsElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_accounts ? [_accounts arrayOfAccountsDictionariesFromAccountsElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"accounts"];
-    [dictionary setObject:(self.activities ? self.activities : [NSNull null])
+    [dictionary setObject:(_activities ? _activities : [NSNull null])
                    forKey:@"activities"];
-    [dictionary setObject:(self.addresses ? [self.addresses arrayOfAddressesDictionariesFromAddressesElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_addresses ? [_addresses arrayOfAddressesDictionariesFromAddressesElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"addresses"];
-    [dictionary setObject:(self.anniversary ? [self.anniversary stringFromISO8601Date] : [NSNull null])
+    [dictionary setObject:(_anniversary ? [_anniversary stringFromISO8601Date] : [NSNull null])
                    forKey:@"anniversary"];
-    [dictionary setObject:(self.birthday ? self.birthday : [NSNull null])
+    [dictionary setObject:(_birthday ? _birthday : [NSNull null])
                    forKey:@"birthday"];
-    [dictionary setObject:(self.bodyType ? [self.bodyType newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_bodyType ? [_bodyType newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"bodyType"];
-    [dictionary setObject:(self.books ? self.books : [NSNull null])
+    [dictionary setObject:(_books ? _books : [NSNull null])
                    forKey:@"books"];
-    [dictionary setObject:(self.cars ? self.cars : [NSNull null])
+    [dictionary setObject:(_cars ? _cars : [NSNull null])
                    forKey:@"cars"];
-    [dictionary setObject:(self.children ? self.children : [NSNull null])
+    [dictionary setObject:(_children ? _children : [NSNull null])
                    forKey:@"children"];
-    [dictionary setObject:(self.currentLocation ? [self.currentLocation newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_currentLocation ? [_currentLocation newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"currentLocation"];
-    [dictionary setObject:(self.displayName ? self.displayName : [NSNull null])
+    [dictionary setObject:(_displayName ? _displayName : [NSNull null])
                    forKey:@"displayName"];
-    [dictionary setObject:(self.drinker ? self.drinker : [NSNull null])
+    [dictionary setObject:(_drinker ? _drinker : [NSNull null])
                    forKey:@"drinker"];
-    [dictionary setObject:(self.emails ? [self.emails arrayOfEmailsDictionariesFromEmailsElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_emails ? [_emails arrayOfEmailsDictionariesFromEmailsElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"emails"];
-    [dictionary setObject:(self.ethnicity ? self.ethnicity : [NSNull null])
+    [dictionary setObject:(_ethnicity ? _ethnicity : [NSNull null])
                    forKey:@"ethnicity"];
-    [dictionary setObject:(self.fashion ? self.fashion : [NSNull null])
+    [dictionary setObject:(_fashion ? _fashion : [NSNull null])
                    forKey:@"fashion"];
-    [dictionary setObject:(self.food ? self.food : [NSNull null])
+    [dictionary setObject:(_food ? _food : [NSNull null])
                    forKey:@"food"];
-    [dictionary setObject:(self.gender ? self.gender : [NSNull null])
+    [dictionary setObject:(_gender ? _gender : [NSNull null])
                    forKey:@"gender"];
-    [dictionary setObject:(self.happiestWhen ? self.happiestWhen : [NSNull null])
+    [dictionary setObject:(_happiestWhen ? _happiestWhen : [NSNull null])
                    forKey:@"happiestWhen"];
-    [dictionary setObject:(self.heroes ? self.heroes : [NSNull null])
+    [dictionary setObject:(_heroes ? _heroes : [NSNull null])
                    forKey:@"heroes"];
-    [dictionary setObject:(self.humor ? self.humor : [NSNull null])
+    [dictionary setObject:(_humor ? _humor : [NSNull null])
                    forKey:@"humor"];
-    [dictionary setObject:(self.ims ? [self.ims arrayOfImsDictionariesFromImsElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_ims ? [_ims arrayOfImsDictionariesFromImsElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"ims"];
-    [dictionary setObject:(self.interestedInMeeting ? self.interestedInMeeting : [NSNull null])
+    [dictionary setObject:(_interestedInMeeting ? _interestedInMeeting : [NSNull null])
                    forKey:@"interestedInMeeting"];
-    [dictionary setObject:(self.interests ? self.interests : [NSNull null])
+    [dictionary setObject:(_interests ? _interests : [NSNull null])
                    forKey:@"interests"];
-    [dictionary setObject:(self.jobInterests ? self.jobInterests : [NSNull null])
+    [dictionary setObject:(_jobInterests ? _jobInterests : [NSNull null])
                    forKey:@"jobInterests"];
-    [dictionary setObject:(self.languages ? self.languages : [NSNull null])
+    [dictionary setObject:(_languages ? _languages : [NSNull null])
                    forKey:@"languages"];
-    [dictionary setObject:(self.languagesSpoken ? self.languagesSpoken : [NSNull null])
+    [dictionary setObject:(_languagesSpoken ? _languagesSpoken : [NSNull null])
                    forKey:@"languagesSpoken"];
-    [dictionary setObject:(self.livingArrangement ? self.livingArrangement : [NSNull null])
+    [dictionary setObject:(_livingArrangement ? _livingArrangement : [NSNull null])
                    forKey:@"livingArrangement"];
-    [dictionary setObject:(self.lookingFor ? self.lookingFor : [NSNull null])
+    [dictionary setObject:(_lookingFor ? _lookingFor : [NSNull null])
                    forKey:@"lookingFor"];
-    [dictionary setObject:(self.movies ? self.movies : [NSNull null])
+    [dictionary setObject:(_movies ? _movies : [NSNull null])
                    forKey:@"movies"];
-    [dictionary setObject:(self.music ? self.music : [NSNull null])
+    [dictionary setObject:(_music ? _music : [NSNull null])
                    forKey:@"music"];
-    [dictionary setObject:(self.name ? [self.name newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_name ? [_name newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"name"];
-    [dictionary setObject:(self.nickname ? self.nickname : [NSNull null])
+    [dictionary setObject:(_nickname ? _nickname : [NSNull null])
                    forKey:@"nickname"];
-    [dictionary setObject:(self.note ? self.note : [NSNull null])
+    [dictionary setObject:(_note ? _note : [NSNull null])
                    forKey:@"note"];
-    [dictionary setObject:(self.organizations ? [self.organizations arrayOfOrganizationsDictionariesFromOrganizationsElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_organizations ? [_organizations arrayOfOrganizationsDictionariesFromOrganizationsElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"organizations"];
-    [dictionary setObject:(self.pets ? self.pets : [NSNull null])
+    [dictionary setObject:(_pets ? _pets : [NSNull null])
                    forKey:@"pets"];
-    [dictionary setObject:(self.phoneNumbers ? [self.phoneNumbers arrayOfPhoneNumbersDictionariesFromPhoneNumbersElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_phoneNumbers ? [_phoneNumbers arrayOfPhoneNumbersDictionariesFromPhoneNumbersElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"phoneNumbers"];
-    [dictionary setObject:(self.profilePhotos ? [self.profilePhotos arrayOfProfilePhotosDictionariesFromProfilePhotosElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_profilePhotos ? [_profilePhotos arrayOfProfilePhotosDictionariesFromProfilePhotosElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"photos"];
-    [dictionary setObject:(self.politicalViews ? self.politicalViews : [NSNull null])
+    [dictionary setObject:(_politicalViews ? _politicalViews : [NSNull null])
                    forKey:@"politicalViews"];
-    [dictionary setObject:(self.preferredUsername ? self.preferredUsername : [NSNull null])
+    [dictionary setObject:(_preferredUsername ? _preferredUsername : [NSNull null])
                    forKey:@"preferredUsername"];
-    [dictionary setObject:(self.profileSong ? self.profileSong : [NSNull null])
+    [dictionary setObject:(_profileSong ? _profileSong : [NSNull null])
                    forKey:@"profileSong"];
-    [dictionary setObject:(self.profileUrl ? self.profileUrl : [NSNull null])
+    [dictionary setObject:(_profileUrl ? _profileUrl : [NSNull null])
                    forKey:@"profileUrl"];
-    [dictionary setObject:(self.profileVideo ? self.profileVideo : [NSNull null])
+    [dictionary setObject:(_profileVideo ? _profileVideo : [NSNull null])
                    forKey:@"profileVideo"];
-    [dictionary setObject:(self.published ? [self.published stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_published ? [_published stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"published"];
-    [dictionary setObject:(self.quotes ? self.quotes : [NSNull null])
+    [dictionary setObject:(_quotes ? _quotes : [NSNull null])
                    forKey:@"quotes"];
-    [dictionary setObject:(self.relationshipStatus ? self.relationshipStatus : [NSNull null])
+    [dictionary setObject:(_relationshipStatus ? _relationshipStatus : [NSNull null])
                    forKey:@"relationshipStatus"];
-    [dictionary setObject:(self.relationships ? self.relationships : [NSNull null])
+    [dictionary setObject:(_relationships ? _relationships : [NSNull null])
                    forKey:@"relationships"];
-    [dictionary setObject:(self.religion ? self.religion : [NSNull null])
+    [dictionary setObject:(_religion ? _religion : [NSNull null])
                    forKey:@"religion"];
-    [dictionary setObject:(self.romance ? self.romance : [NSNull null])
+    [dictionary setObject:(_romance ? _romance : [NSNull null])
                    forKey:@"romance"];
-    [dictionary setObject:(self.scaredOf ? self.scaredOf : [NSNull null])
+    [dictionary setObject:(_scaredOf ? _scaredOf : [NSNull null])
                    forKey:@"scaredOf"];
-    [dictionary setObject:(self.sexualOrientation ? self.sexualOrientation : [NSNull null])
+    [dictionary setObject:(_sexualOrientation ? _sexualOrientation : [NSNull null])
                    forKey:@"sexualOrientation"];
-    [dictionary setObject:(self.smoker ? self.smoker : [NSNull null])
+    [dictionary setObject:(_smoker ? _smoker : [NSNull null])
                    forKey:@"smoker"];
-    [dictionary setObject:(self.sports ? self.sports : [NSNull null])
+    [dictionary setObject:(_sports ? _sports : [NSNull null])
                    forKey:@"sports"];
-    [dictionary setObject:(self.status ? self.status : [NSNull null])
+    [dictionary setObject:(_status ? _status : [NSNull null])
                    forKey:@"status"];
-    [dictionary setObject:(self.tags ? self.tags : [NSNull null])
+    [dictionary setObject:(_tags ? _tags : [NSNull null])
                    forKey:@"tags"];
-    [dictionary setObject:(self.turnOffs ? self.turnOffs : [NSNull null])
+    [dictionary setObject:(_turnOffs ? _turnOffs : [NSNull null])
                    forKey:@"turnOffs"];
-    [dictionary setObject:(self.turnOns ? self.turnOns : [NSNull null])
+    [dictionary setObject:(_turnOns ? _turnOns : [NSNull null])
                    forKey:@"turnOns"];
-    [dictionary setObject:(self.tvShows ? self.tvShows : [NSNull null])
+    [dictionary setObject:(_tvShows ? _tvShows : [NSNull null])
                    forKey:@"tvShows"];
-    [dictionary setObject:(self.updated ? [self.updated stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_updated ? [_updated stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"updated"];
-    [dictionary setObject:(self.urls ? [self.urls arrayOfUrlsDictionariesFromUrlsElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_urls ? [_urls arrayOfUrlsDictionariesFromUrlsElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"urls"];
-    [dictionary setObject:(self.utcOffset ? self.utcOffset : [NSNull null])
+    [dictionary setObject:(_utcOffset ? _utcOffset : [NSNull null])
                    forKey:@"utcOffset"];
 
     if (forEncoder)
@@ -1993,6 +2223,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -2004,16 +2235,16 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"profile"];
 
-    if (self.bodyType)
-        [snapshotDictionary setObject:[self.bodyType snapshotDictionaryFromDirtyPropertySet]
+    if (_bodyType)
+        [snapshotDictionary setObject:[_bodyType snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"bodyType"];
 
-    if (self.currentLocation)
-        [snapshotDictionary setObject:[self.currentLocation snapshotDictionaryFromDirtyPropertySet]
+    if (_currentLocation)
+        [snapshotDictionary setObject:[_currentLocation snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"currentLocation"];
 
-    if (self.name)
-        [snapshotDictionary setObject:[self.name snapshotDictionaryFromDirtyPropertySet]
+    if (_name)
+        [snapshotDictionary setObject:[_name snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"name"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -2021,6 +2252,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"profile"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"profile"] allObjects]];
 
@@ -2044,115 +2277,115 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"aboutMe"])
-        [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null]) forKey:@"aboutMe"];
+        [dictionary setObject:(_aboutMe ? _aboutMe : [NSNull null]) forKey:@"aboutMe"];
 
     if ([self.dirtyPropertySet containsObject:@"anniversary"])
-        [dictionary setObject:(self.anniversary ? [self.anniversary stringFromISO8601Date] : [NSNull null]) forKey:@"anniversary"];
+        [dictionary setObject:(_anniversary ? [_anniversary stringFromISO8601Date] : [NSNull null]) forKey:@"anniversary"];
 
     if ([self.dirtyPropertySet containsObject:@"birthday"])
-        [dictionary setObject:(self.birthday ? self.birthday : [NSNull null]) forKey:@"birthday"];
+        [dictionary setObject:(_birthday ? _birthday : [NSNull null]) forKey:@"birthday"];
 
     if ([self.dirtyPropertySet containsObject:@"bodyType"])
-        [dictionary setObject:(self.bodyType ?
-                              [self.bodyType toUpdateDictionary] :
+        [dictionary setObject:(_bodyType ?
+                              [_bodyType toUpdateDictionary] :
                               [[JRBodyType bodyType] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"bodyType"];
-    else if ([self.bodyType needsUpdate])
-        [dictionary setObject:[self.bodyType toUpdateDictionary]
+    else if ([_bodyType needsUpdate])
+        [dictionary setObject:[_bodyType toUpdateDictionary]
                        forKey:@"bodyType"];
 
     if ([self.dirtyPropertySet containsObject:@"currentLocation"])
-        [dictionary setObject:(self.currentLocation ?
-                              [self.currentLocation toUpdateDictionary] :
+        [dictionary setObject:(_currentLocation ?
+                              [_currentLocation toUpdateDictionary] :
                               [[JRCurrentLocation currentLocation] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"currentLocation"];
-    else if ([self.currentLocation needsUpdate])
-        [dictionary setObject:[self.currentLocation toUpdateDictionary]
+    else if ([_currentLocation needsUpdate])
+        [dictionary setObject:[_currentLocation toUpdateDictionary]
                        forKey:@"currentLocation"];
 
     if ([self.dirtyPropertySet containsObject:@"displayName"])
-        [dictionary setObject:(self.displayName ? self.displayName : [NSNull null]) forKey:@"displayName"];
+        [dictionary setObject:(_displayName ? _displayName : [NSNull null]) forKey:@"displayName"];
 
     if ([self.dirtyPropertySet containsObject:@"drinker"])
-        [dictionary setObject:(self.drinker ? self.drinker : [NSNull null]) forKey:@"drinker"];
+        [dictionary setObject:(_drinker ? _drinker : [NSNull null]) forKey:@"drinker"];
 
     if ([self.dirtyPropertySet containsObject:@"ethnicity"])
-        [dictionary setObject:(self.ethnicity ? self.ethnicity : [NSNull null]) forKey:@"ethnicity"];
+        [dictionary setObject:(_ethnicity ? _ethnicity : [NSNull null]) forKey:@"ethnicity"];
 
     if ([self.dirtyPropertySet containsObject:@"fashion"])
-        [dictionary setObject:(self.fashion ? self.fashion : [NSNull null]) forKey:@"fashion"];
+        [dictionary setObject:(_fashion ? _fashion : [NSNull null]) forKey:@"fashion"];
 
     if ([self.dirtyPropertySet containsObject:@"gender"])
-        [dictionary setObject:(self.gender ? self.gender : [NSNull null]) forKey:@"gender"];
+        [dictionary setObject:(_gender ? _gender : [NSNull null]) forKey:@"gender"];
 
     if ([self.dirtyPropertySet containsObject:@"happiestWhen"])
-        [dictionary setObject:(self.happiestWhen ? self.happiestWhen : [NSNull null]) forKey:@"happiestWhen"];
+        [dictionary setObject:(_happiestWhen ? _happiestWhen : [NSNull null]) forKey:@"happiestWhen"];
 
     if ([self.dirtyPropertySet containsObject:@"humor"])
-        [dictionary setObject:(self.humor ? self.humor : [NSNull null]) forKey:@"humor"];
+        [dictionary setObject:(_humor ? _humor : [NSNull null]) forKey:@"humor"];
 
     if ([self.dirtyPropertySet containsObject:@"livingArrangement"])
-        [dictionary setObject:(self.livingArrangement ? self.livingArrangement : [NSNull null]) forKey:@"livingArrangement"];
+        [dictionary setObject:(_livingArrangement ? _livingArrangement : [NSNull null]) forKey:@"livingArrangement"];
 
     if ([self.dirtyPropertySet containsObject:@"name"])
-        [dictionary setObject:(self.name ?
-                              [self.name toUpdateDictionary] :
+        [dictionary setObject:(_name ?
+                              [_name toUpdateDictionary] :
                               [[JRName name] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"name"];
-    else if ([self.name needsUpdate])
-        [dictionary setObject:[self.name toUpdateDictionary]
+    else if ([_name needsUpdate])
+        [dictionary setObject:[_name toUpdateDictionary]
                        forKey:@"name"];
 
     if ([self.dirtyPropertySet containsObject:@"nickname"])
-        [dictionary setObject:(self.nickname ? self.nickname : [NSNull null]) forKey:@"nickname"];
+        [dictionary setObject:(_nickname ? _nickname : [NSNull null]) forKey:@"nickname"];
 
     if ([self.dirtyPropertySet containsObject:@"note"])
-        [dictionary setObject:(self.note ? self.note : [NSNull null]) forKey:@"note"];
+        [dictionary setObject:(_note ? _note : [NSNull null]) forKey:@"note"];
 
     if ([self.dirtyPropertySet containsObject:@"politicalViews"])
-        [dictionary setObject:(self.politicalViews ? self.politicalViews : [NSNull null]) forKey:@"politicalViews"];
+        [dictionary setObject:(_politicalViews ? _politicalViews : [NSNull null]) forKey:@"politicalViews"];
 
     if ([self.dirtyPropertySet containsObject:@"preferredUsername"])
-        [dictionary setObject:(self.preferredUsername ? self.preferredUsername : [NSNull null]) forKey:@"preferredUsername"];
+        [dictionary setObject:(_preferredUsername ? _preferredUsername : [NSNull null]) forKey:@"preferredUsername"];
 
     if ([self.dirtyPropertySet containsObject:@"profileSong"])
-        [dictionary setObject:(self.profileSong ? self.profileSong : [NSNull null]) forKey:@"profileSong"];
+        [dictionary setObject:(_profileSong ? _profileSong : [NSNull null]) forKey:@"profileSong"];
 
     if ([self.dirtyPropertySet containsObject:@"profileUrl"])
-        [dictionary setObject:(self.profileUrl ? self.profileUrl : [NSNull null]) forKey:@"profileUrl"];
+        [dictionary setObject:(_profileUrl ? _profileUrl : [NSNull null]) forKey:@"profileUrl"];
 
     if ([self.dirtyPropertySet containsObject:@"profileVideo"])
-        [dictionary setObject:(self.profileVideo ? self.profileVideo : [NSNull null]) forKey:@"profileVideo"];
+        [dictionary setObject:(_profileVideo ? _profileVideo : [NSNull null]) forKey:@"profileVideo"];
 
     if ([self.dirtyPropertySet containsObject:@"published"])
-        [dictionary setObject:(self.published ? [self.published stringFromISO8601DateTime] : [NSNull null]) forKey:@"published"];
+        [dictionary setObject:(_published ? [_published stringFromISO8601DateTime] : [NSNull null]) forKey:@"published"];
 
     if ([self.dirtyPropertySet containsObject:@"relationshipStatus"])
-        [dictionary setObject:(self.relationshipStatus ? self.relationshipStatus : [NSNull null]) forKey:@"relationshipStatus"];
+        [dictionary setObject:(_relationshipStatus ? _relationshipStatus : [NSNull null]) forKey:@"relationshipStatus"];
 
     if ([self.dirtyPropertySet containsObject:@"religion"])
-        [dictionary setObject:(self.religion ? self.religion : [NSNull null]) forKey:@"religion"];
+        [dictionary setObject:(_religion ? _religion : [NSNull null]) forKey:@"religion"];
 
     if ([self.dirtyPropertySet containsObject:@"romance"])
-        [dictionary setObject:(self.romance ? self.romance : [NSNull null]) forKey:@"romance"];
+        [dictionary setObject:(_romance ? _romance : [NSNull null]) forKey:@"romance"];
 
     if ([self.dirtyPropertySet containsObject:@"scaredOf"])
-        [dictionary setObject:(self.scaredOf ? self.scaredOf : [NSNull null]) forKey:@"scaredOf"];
+        [dictionary setObject:(_scaredOf ? _scaredOf : [NSNull null]) forKey:@"scaredOf"];
 
     if ([self.dirtyPropertySet containsObject:@"sexualOrientation"])
-        [dictionary setObject:(self.sexualOrientation ? self.sexualOrientation : [NSNull null]) forKey:@"sexualOrientation"];
+        [dictionary setObject:(_sexualOrientation ? _sexualOrientation : [NSNull null]) forKey:@"sexualOrientation"];
 
     if ([self.dirtyPropertySet containsObject:@"smoker"])
-        [dictionary setObject:(self.smoker ? self.smoker : [NSNull null]) forKey:@"smoker"];
+        [dictionary setObject:(_smoker ? _smoker : [NSNull null]) forKey:@"smoker"];
 
     if ([self.dirtyPropertySet containsObject:@"status"])
-        [dictionary setObject:(self.status ? self.status : [NSNull null]) forKey:@"status"];
+        [dictionary setObject:(_status ? _status : [NSNull null]) forKey:@"status"];
 
     if ([self.dirtyPropertySet containsObject:@"updated"])
-        [dictionary setObject:(self.updated ? [self.updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
+        [dictionary setObject:(_updated ? [_updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
 
     if ([self.dirtyPropertySet containsObject:@"utcOffset"])
-        [dictionary setObject:(self.utcOffset ? self.utcOffset : [NSNull null]) forKey:@"utcOffset"];
+        [dictionary setObject:(_utcOffset ? _utcOffset : [NSNull null]) forKey:@"utcOffset"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -2168,199 +2401,199 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.aboutMe ? self.aboutMe : [NSNull null]) forKey:@"aboutMe"];
+    [dictionary setObject:(_aboutMe ? _aboutMe : [NSNull null]) forKey:@"aboutMe"];
 
-    [dictionary setObject:(self.accounts ?
-                          [self.accounts arrayOfAccountsReplaceDictionariesFromAccountsElements] :
+    [dictionary setObject:(_accounts ?
+                          [_accounts arrayOfAccountsReplaceDictionariesFromAccountsElements] :
                           [NSArray array])
                    forKey:@"accounts"];
 
-    [dictionary setObject:(self.activities ?
-                          self.activities :
+    [dictionary setObject:(_activities ?
+                          _activities :
                           [NSArray array])
                    forKey:@"activities"];
 
-    [dictionary setObject:(self.addresses ?
-                          [self.addresses arrayOfAddressesReplaceDictionariesFromAddressesElements] :
+    [dictionary setObject:(_addresses ?
+                          [_addresses arrayOfAddressesReplaceDictionariesFromAddressesElements] :
                           [NSArray array])
                    forKey:@"addresses"];
-    [dictionary setObject:(self.anniversary ? [self.anniversary stringFromISO8601Date] : [NSNull null]) forKey:@"anniversary"];
-    [dictionary setObject:(self.birthday ? self.birthday : [NSNull null]) forKey:@"birthday"];
+    [dictionary setObject:(_anniversary ? [_anniversary stringFromISO8601Date] : [NSNull null]) forKey:@"anniversary"];
+    [dictionary setObject:(_birthday ? _birthday : [NSNull null]) forKey:@"birthday"];
 
-    [dictionary setObject:(self.bodyType ?
-                          [self.bodyType toReplaceDictionary] :
+    [dictionary setObject:(_bodyType ?
+                          [_bodyType toReplaceDictionary] :
                           [[JRBodyType bodyType] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"bodyType"];
 
-    [dictionary setObject:(self.books ?
-                          self.books :
+    [dictionary setObject:(_books ?
+                          _books :
                           [NSArray array])
                    forKey:@"books"];
 
-    [dictionary setObject:(self.cars ?
-                          self.cars :
+    [dictionary setObject:(_cars ?
+                          _cars :
                           [NSArray array])
                    forKey:@"cars"];
 
-    [dictionary setObject:(self.children ?
-                          self.children :
+    [dictionary setObject:(_children ?
+                          _children :
                           [NSArray array])
                    forKey:@"children"];
 
-    [dictionary setObject:(self.currentLocation ?
-                          [self.currentLocation toReplaceDictionary] :
+    [dictionary setObject:(_currentLocation ?
+                          [_currentLocation toReplaceDictionary] :
                           [[JRCurrentLocation currentLocation] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"currentLocation"];
-    [dictionary setObject:(self.displayName ? self.displayName : [NSNull null]) forKey:@"displayName"];
-    [dictionary setObject:(self.drinker ? self.drinker : [NSNull null]) forKey:@"drinker"];
+    [dictionary setObject:(_displayName ? _displayName : [NSNull null]) forKey:@"displayName"];
+    [dictionary setObject:(_drinker ? _drinker : [NSNull null]) forKey:@"drinker"];
 
-    [dictionary setObject:(self.emails ?
-                          [self.emails arrayOfEmailsReplaceDictionariesFromEmailsElements] :
+    [dictionary setObject:(_emails ?
+                          [_emails arrayOfEmailsReplaceDictionariesFromEmailsElements] :
                           [NSArray array])
                    forKey:@"emails"];
-    [dictionary setObject:(self.ethnicity ? self.ethnicity : [NSNull null]) forKey:@"ethnicity"];
-    [dictionary setObject:(self.fashion ? self.fashion : [NSNull null]) forKey:@"fashion"];
+    [dictionary setObject:(_ethnicity ? _ethnicity : [NSNull null]) forKey:@"ethnicity"];
+    [dictionary setObject:(_fashion ? _fashion : [NSNull null]) forKey:@"fashion"];
 
-    [dictionary setObject:(self.food ?
-                          self.food :
+    [dictionary setObject:(_food ?
+                          _food :
                           [NSArray array])
                    forKey:@"food"];
-    [dictionary setObject:(self.gender ? self.gender : [NSNull null]) forKey:@"gender"];
-    [dictionary setObject:(self.happiestWhen ? self.happiestWhen : [NSNull null]) forKey:@"happiestWhen"];
+    [dictionary setObject:(_gender ? _gender : [NSNull null]) forKey:@"gender"];
+    [dictionary setObject:(_happiestWhen ? _happiestWhen : [NSNull null]) forKey:@"happiestWhen"];
 
-    [dictionary setObject:(self.heroes ?
-                          self.heroes :
+    [dictionary setObject:(_heroes ?
+                          _heroes :
                           [NSArray array])
                    forKey:@"heroes"];
-    [dictionary setObject:(self.humor ? self.humor : [NSNull null]) forKey:@"humor"];
+    [dictionary setObject:(_humor ? _humor : [NSNull null]) forKey:@"humor"];
 
-    [dictionary setObject:(self.ims ?
-                          [self.ims arrayOfImsReplaceDictionariesFromImsElements] :
+    [dictionary setObject:(_ims ?
+                          [_ims arrayOfImsReplaceDictionariesFromImsElements] :
                           [NSArray array])
                    forKey:@"ims"];
 
-    [dictionary setObject:(self.interestedInMeeting ?
-                          self.interestedInMeeting :
+    [dictionary setObject:(_interestedInMeeting ?
+                          _interestedInMeeting :
                           [NSArray array])
                    forKey:@"interestedInMeeting"];
 
-    [dictionary setObject:(self.interests ?
-                          self.interests :
+    [dictionary setObject:(_interests ?
+                          _interests :
                           [NSArray array])
                    forKey:@"interests"];
 
-    [dictionary setObject:(self.jobInterests ?
-                          self.jobInterests :
+    [dictionary setObject:(_jobInterests ?
+                          _jobInterests :
                           [NSArray array])
                    forKey:@"jobInterests"];
 
-    [dictionary setObject:(self.languages ?
-                          self.languages :
+    [dictionary setObject:(_languages ?
+                          _languages :
                           [NSArray array])
                    forKey:@"languages"];
 
-    [dictionary setObject:(self.languagesSpoken ?
-                          self.languagesSpoken :
+    [dictionary setObject:(_languagesSpoken ?
+                          _languagesSpoken :
                           [NSArray array])
                    forKey:@"languagesSpoken"];
-    [dictionary setObject:(self.livingArrangement ? self.livingArrangement : [NSNull null]) forKey:@"livingArrangement"];
+    [dictionary setObject:(_livingArrangement ? _livingArrangement : [NSNull null]) forKey:@"livingArrangement"];
 
-    [dictionary setObject:(self.lookingFor ?
-                          self.lookingFor :
+    [dictionary setObject:(_lookingFor ?
+                          _lookingFor :
                           [NSArray array])
                    forKey:@"lookingFor"];
 
-    [dictionary setObject:(self.movies ?
-                          self.movies :
+    [dictionary setObject:(_movies ?
+                          _movies :
                           [NSArray array])
                    forKey:@"movies"];
 
-    [dictionary setObject:(self.music ?
-                          self.music :
+    [dictionary setObject:(_music ?
+                          _music :
                           [NSArray array])
                    forKey:@"music"];
 
-    [dictionary setObject:(self.name ?
-                          [self.name toReplaceDictionary] :
+    [dictionary setObject:(_name ?
+                          [_name toReplaceDictionary] :
                           [[JRName name] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"name"];
-    [dictionary setObject:(self.nickname ? self.nickname : [NSNull null]) forKey:@"nickname"];
-    [dictionary setObject:(self.note ? self.note : [NSNull null]) forKey:@"note"];
+    [dictionary setObject:(_nickname ? _nickname : [NSNull null]) forKey:@"nickname"];
+    [dictionary setObject:(_note ? _note : [NSNull null]) forKey:@"note"];
 
-    [dictionary setObject:(self.organizations ?
-                          [self.organizations arrayOfOrganizationsReplaceDictionariesFromOrganizationsElements] :
+    [dictionary setObject:(_organizations ?
+                          [_organizations arrayOfOrganizationsReplaceDictionariesFromOrganizationsElements] :
                           [NSArray array])
                    forKey:@"organizations"];
 
-    [dictionary setObject:(self.pets ?
-                          self.pets :
+    [dictionary setObject:(_pets ?
+                          _pets :
                           [NSArray array])
                    forKey:@"pets"];
 
-    [dictionary setObject:(self.phoneNumbers ?
-                          [self.phoneNumbers arrayOfPhoneNumbersReplaceDictionariesFromPhoneNumbersElements] :
+    [dictionary setObject:(_phoneNumbers ?
+                          [_phoneNumbers arrayOfPhoneNumbersReplaceDictionariesFromPhoneNumbersElements] :
                           [NSArray array])
                    forKey:@"phoneNumbers"];
 
-    [dictionary setObject:(self.profilePhotos ?
-                          [self.profilePhotos arrayOfProfilePhotosReplaceDictionariesFromProfilePhotosElements] :
+    [dictionary setObject:(_profilePhotos ?
+                          [_profilePhotos arrayOfProfilePhotosReplaceDictionariesFromProfilePhotosElements] :
                           [NSArray array])
                    forKey:@"photos"];
-    [dictionary setObject:(self.politicalViews ? self.politicalViews : [NSNull null]) forKey:@"politicalViews"];
-    [dictionary setObject:(self.preferredUsername ? self.preferredUsername : [NSNull null]) forKey:@"preferredUsername"];
-    [dictionary setObject:(self.profileSong ? self.profileSong : [NSNull null]) forKey:@"profileSong"];
-    [dictionary setObject:(self.profileUrl ? self.profileUrl : [NSNull null]) forKey:@"profileUrl"];
-    [dictionary setObject:(self.profileVideo ? self.profileVideo : [NSNull null]) forKey:@"profileVideo"];
-    [dictionary setObject:(self.published ? [self.published stringFromISO8601DateTime] : [NSNull null]) forKey:@"published"];
-
-    [dictionary setObject:(self.quotes ?
-                          self.quotes :
+    [dictionary setObject:(_politicalViews ? _politicalViews : [NSNull null]) forKey:@"politicalViews"];
+    [dictionary setObject:(_preferredUsername ? _preferredUsername : [NSNull null]) forKey:@"preferredUsername"];
+    [dictionary setObject:(_profileSong ? _profileSong : [NSNull null]) forKey:@"profileSong"];
+    [dictionary setObject:(_profileUrl ? _profileUrl : [NSNull null]) forKey:@"profileUrl"];
+    [dictionary setObject:(_profileVideo ? _profileVideo : [NSNull null]) forKey:@"profileVideo"];
+    [dictionary setObject:(_published ? [_published stringFromISO8601DateTime] : [NSNull null]) forKey:@"published"];
+
+    [dictionary setObject:(_quotes ?
+                          _quotes :
                           [NSArray array])
                    forKey:@"quotes"];
-    [dictionary setObject:(self.relationshipStatus ? self.relationshipStatus : [NSNull null]) forKey:@"relationshipStatus"];
+    [dictionary setObject:(_relationshipStatus ? _relationshipStatus : [NSNull null]) forKey:@"relationshipStatus"];
 
-    [dictionary setObject:(self.relationships ?
-                          self.relationships :
+    [dictionary setObject:(_relationships ?
+                          _relationships :
                           [NSArray array])
                    forKey:@"relationships"];
-    [dictionary setObject:(self.religion ? self.religion : [NSNull null]) forKey:@"religion"];
-    [dictionary setObject:(self.romance ? self.romance : [NSNull null]) forKey:@"romance"];
-    [dictionary setObject:(self.scaredOf ? self.scaredOf : [NSNull null]) forKey:@"scaredOf"];
-    [dictionary setObject:(self.sexualOrientation ? self.sexualOrientation : [NSNull null]) forKey:@"sexualOrientation"];
-    [dictionary setObject:(self.smoker ? self.smoker : [NSNull null]) forKey:@"smoker"];
-
-    [dictionary setObject:(self.sports ?
-                          self.sports :
+    [dictionary setObject:(_religion ? _religion : [NSNull null]) forKey:@"religion"];
+    [dictionary setObject:(_romance ? _romance : [NSNull null]) forKey:@"romance"];
+    [dictionary setObject:(_scaredOf ? _scaredOf : [NSNull null]) forKey:@"scaredOf"];
+    [dictionary setObject:(_sexualOrientation ? _sexualOrientation : [NSNull null]) forKey:@"sexualOrientation"];
+    [dictionary setObject:(_smoker ? _smoker : [NSNull null]) forKey:@"smoker"];
+
+    [dictionary setObject:(_sports ?
+                          _sports :
                           [NSArray array])
                    forKey:@"sports"];
-    [dictionary setObject:(self.status ? self.status : [NSNull null]) forKey:@"status"];
+    [dictionary setObject:(_status ? _status : [NSNull null]) forKey:@"status"];
 
-    [dictionary setObject:(self.tags ?
-                          self.tags :
+    [dictionary setObject:(_tags ?
+                          _tags :
                           [NSArray array])
                    forKey:@"tags"];
 
-    [dictionary setObject:(self.turnOffs ?
-                          self.turnOffs :
+    [dictionary setObject:(_turnOffs ?
+                          _turnOffs :
                           [NSArray array])
                    forKey:@"turnOffs"];
 
-    [dictionary setObject:(self.turnOns ?
-                          self.turnOns :
+    [dictionary setObject:(_turnOns ?
+                          _turnOns :
                           [NSArray array])
                    forKey:@"turnOns"];
 
-    [dictionary setObject:(self.tvShows ?
-                          self.tvShows :
+    [dictionary setObject:(_tvShows ?
+                          _tvShows :
                           [NSArray array])
                    forKey:@"tvShows"];
-    [dictionary setObject:(self.updated ? [self.updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
+    [dictionary setObject:(_updated ? [_updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
 
-    [dictionary setObject:(self.urls ?
-                          [self.urls arrayOfUrlsReplaceDictionariesFromUrlsElements] :
+    [dictionary setObject:(_urls ?
+                          [_urls arrayOfUrlsReplaceDictionariesFromUrlsElements] :
                           [NSArray array])
                    forKey:@"urls"];
-    [dictionary setObject:(self.utcOffset ? self.utcOffset : [NSNull null]) forKey:@"utcOffset"];
+    [dictionary setObject:(_utcOffset ? _utcOffset : [NSNull null]) forKey:@"utcOffset"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -2551,13 +2784,13 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.bodyType needsUpdate])
+    if ([_bodyType needsUpdate])
         return YES;
 
-    if ([self.currentLocation needsUpdate])
+    if ([_currentLocation needsUpdate])
         return YES;
 
-    if ([self.name needsUpdate])
+    if ([_name needsUpdate])
         return YES;
 
     return NO;
@@ -2565,286 +2798,366 @@
 
 - (BOOL)isEqualToProfile:(JRProfile *)otherProfile
 {
-    if (!self.aboutMe && !otherProfile.aboutMe) /* Keep going... */;
-    else if ((self.aboutMe == nil) ^ (otherProfile.aboutMe == nil)) return NO; // xor
-    else if (![self.aboutMe isEqualToString:otherProfile.aboutMe]) return NO;
-
-    if (!self.accounts && !otherProfile.accounts) /* Keep going... */;
-    else if (!self.accounts && ![otherProfile.accounts count]) /* Keep going... */;
-    else if (!otherProfile.accounts && ![self.accounts count]) /* Keep going... */;
-    else if (![self.accounts isEqualToAccountsArray:otherProfile.accounts]) return NO;
-
-    if (!self.activities && !otherProfile.activities) /* Keep going... */;
-    else if (!self.activities && ![otherProfile.activities count]) /* Keep going... */;
-    else if (!otherProfile.activities && ![self.activities count]) /* Keep going... */;
-    else if (![self.activities isEqualToArray:otherProfile.activities]) return NO;
-
-    if (!self.addresses && !otherProfile.addresses) /* Keep going... */;
-    else if (!self.addresses && ![otherProfile.addresses count]) /* Keep going... */;
-    else if (!otherProfile.addresses && ![self.addresses count]) /* Keep going... */;
-    else if (![self.addresses isEqualToAddressesArray:otherProfile.addresses]) return NO;
-
-    if (!self.anniversary && !otherProfile.anniversary) /* Keep going... */;
-    else if ((self.anniversary == nil) ^ (otherProfile.anniversary == nil)) return NO; // xor
-    else if (![self.anniversary isEqualToDate:otherProfile.anniversary]) return NO;
-
-    if (!self.birthday && !otherProfile.birthday) /* Keep going... */;
-    else if ((self.birthday == nil) ^ (otherProfile.birthday == nil)) return NO; // xor
-    else if (![self.birthday isEqualToString:otherProfile.birthday]) return NO;
-
-    if (!self.bodyType && !otherProfile.bodyType) /* Keep going... */;
-    else if (!self.bodyType && [otherProfile.bodyType isEqualToBodyType:[JRBodyType bodyType]]) /* Keep going... */;
-    else if (!otherProfile.bodyType && [self.bodyType isEqualToBodyType:[JRBodyType bodyType]]) /* Keep going... */;
-    else if (![self.bodyType isEqualToBodyType:otherProfile.bodyType]) return NO;
-
-    if (!self.books && !otherProfile.books) /* Keep going... */;
-    else if (!self.books && ![otherProfile.books count]) /* Keep going... */;
-    else if (!otherProfile.books && ![self.books count]) /* Keep going... */;
-    else if (![self.books isEqualToArray:otherProfile.books]) return NO;
-
-    if (!self.cars && !otherProfile.cars) /* Keep going... */;
-    else if (!self.cars && ![otherProfile.cars count]) /* Keep going... */;
-    else if (!otherProfile.cars && ![self.cars count]) /* Keep going... */;
-    else if (![self.cars isEqualToArray:otherProfile.cars]) return NO;
-
-    if (!self.children && !otherProfile.children) /* Keep going... */;
-    else if (!self.children && ![otherProfile.children count]) /* Keep going... */;
-    else if (!otherProfile.children && ![self.children count]) /* Keep going... */;
-    else if (![self.children isEqualToArray:otherProfile.children]) return NO;
-
-    if (!self.currentLocation && !otherProfile.currentLocation) /* Keep going... */;
-    else if (!self.currentLocation && [otherProfile.currentLocation isEqualToCurrentLocation:[JRCurrentLocation currentLocation]]) /* Keep going... */;
-    else if (!otherProfile.currentLocation && [self.currentLocation isEqualToCurrentLocation:[JRCurrentLocation currentLocation]]) /* Keep going... */;
-    else if (![self.currentLocation isEqualToCurrentLocation:otherProfile.currentLocation]) return NO;
-
-    if (!self.displayName && !otherProfile.displayName) /* Keep going... */;
-    else if ((self.displayName == nil) ^ (otherProfile.displayName == nil)) return NO; // xor
-    else if (![self.displayName isEqualToString:otherProfile.displayName]) return NO;
-
-    if (!self.drinker && !otherProfile.drinker) /* Keep going... */;
-    else if ((self.drinker == nil) ^ (otherProfile.drinker == nil)) return NO; // xor
-    else if (![self.drinker isEqualToString:otherProfile.drinker]) return NO;
-
-    if (!self.emails && !otherProfile.emails) /* Keep going... */;
-    else if (!self.emails && ![otherProfile.emails count]) /* Keep going... */;
-    else if (!otherProfile.emails && ![self.emails count]) /* Keep going... */;
-    else if (![self.emails isEqualToEmailsArray:otherProfile.emails]) return NO;
-
-    if (!self.ethnicity && !otherProfile.ethnicity) /* Keep going... */;
-    else if ((self.ethnicity == nil) ^ (otherProfile.ethnicity == nil)) return NO; // xor
-    else if (![self.ethnicity isEqualToString:otherProfile.ethnicity]) return NO;
-
-    if (!self.fashion && !otherProfile.fashion) /* Keep going... */;
-    else if ((self.fashion == nil) ^ (otherProfile.fashion == nil)) return NO; // xor
-    else if (![self.fashion isEqualToString:otherProfile.fashion]) return NO;
-
-    if (!self.food && !otherProfile.food) /* Keep going... */;
-    else if (!self.food && ![otherProfile.food count]) /* Keep going... */;
-    else if (!otherProfile.food && ![self.food count]) /* Keep going... */;
-    else if (![self.food isEqualToArray:otherProfile.food]) return NO;
-
-    if (!self.gender && !otherProfile.gender) /* Keep going... */;
-    else if ((self.gender == nil) ^ (otherProfile.gender == nil)) return NO; // xor
-    else if (![self.gender isEqualToString:otherProfile.gender]) return NO;
-
-    if (!self.happiestWhen && !otherProfile.happiestWhen) /* Keep going... */;
-    else if ((self.happiestWhen == nil) ^ (otherProfile.happiestWhen == nil)) return NO; // xor
-    else if (![self.happiestWhen isEqualToString:otherProfile.happiestWhen]) return NO;
-
-    if (!self.heroes && !otherProfile.heroes) /* Keep going... */;
-    else if (!self.heroes && ![otherProfile.heroes count]) /* Keep going... */;
-    else if (!otherProfile.heroes && ![self.heroes count]) /* Keep going... */;
-    else if (![self.heroes isEqualToArray:otherProfile.heroes]) return NO;
-
-    if (!self.humor && !otherProfile.humor) /* Keep going... */;
-    else if ((self.humor == nil) ^ (otherProfile.humor == nil)) return NO; // xor
-    else if (![self.humor isEqualToString:otherProfile.humor]) return NO;
-
-    if (!self.ims && !otherProfile.ims) /* Keep going... */;
-    else if (!self.ims && ![otherProfile.ims count]) /* Keep going... */;
-    else if (!otherProfile.ims && ![self.ims count]) /* Keep going... */;
-    else if (![self.ims isEqualToImsArray:otherProfile.ims]) return NO;
-
-    if (!self.interestedInMeeting && !otherProfile.interestedInMeeting) /* Keep going... */;
-    else if (!self.interestedInMeeting && ![otherProfile.interestedInMeeting count]) /* Keep going... */;
-    else if (!otherProfile.interestedInMeeting && ![self.interestedInMeeting count]) /* Keep going... */;
-    else if (![self.interestedInMeeting isEqualToArray:otherProfile.interestedInMeeting]) return NO;
-
-    if (!self.interests && !otherProfile.interests) /* Keep going... */;
-    else if (!self.interests && ![otherProfile.interests count]) /* Keep going... */;
-    else if (!otherProfile.interests && ![self.interests count]) /* Keep going... */;
-    else if (![self.interests isEqualToArray:otherProfile.interests]) return NO;
-
-    if (!self.jobInterests && !otherProfile.jobInterests) /* Keep going... */;
-    else if (!self.jobInterests && ![otherProfile.jobInterests count]) /* Keep going... */;
-    else if (!otherProfile.jobInterests && ![self.jobInterests count]) /* Keep going... */;
-    else if (![self.jobInterests isEqualToArray:otherProfile.jobInterests]) return NO;
-
-    if (!self.languages && !otherProfile.languages) /* Keep going... */;
-    else if (!self.languages && ![otherProfile.languages count]) /* Keep going... */;
-    else if (!otherProfile.languages && ![self.languages count]) /* Keep going... */;
-    else if (![self.languages isEqualToArray:otherProfile.languages]) return NO;
-
-    if (!self.languagesSpoken && !otherProfile.languagesSpoken) /* Keep going... */;
-    else if (!self.languagesSpoken && ![otherProfile.languagesSpoken count]) /* Keep going... */;
-    else if (!otherProfile.languagesSpoken && ![self.languagesSpoken count]) /* Keep going... */;
-    else if (![self.languagesSpoken isEqualToArray:otherProfile.languagesSpoken]) return NO;
-
-    if (!self.livingArrangement && !otherProfile.livingArrangement) /* Keep going... */;
-    else if ((self.livingArrangement == nil) ^ (otherProfile.livingArrangement == nil)) return NO; // xor
-    else if (![self.livingArrangement isEqualToString:otherProfile.livingArrangement]) return NO;
-
-    if (!self.lookingFor && !otherProfile.lookingFor) /* Keep going... */;
-    else if (!self.lookingFor && ![otherProfile.lookingFor count]) /* Keep going... */;
-    else if (!otherProfile.lookingFor && ![self.lookingFor count]) /* Keep going... */;
-    else if (![self.lookingFor isEqualToArray:otherProfile.lookingFor]) return NO;
-
-    if (!self.movies && !otherProfile.movies) /* Keep going... */;
-    else if (!self.movies && ![otherProfile.movies count]) /* Keep going... */;
-    else if (!otherProfile.movies && ![self.movies count]) /* Keep going... */;
-    else if (![self.movies isEqualToArray:otherProfile.movies]) return NO;
-
-    if (!self.music && !otherProfile.music) /* Keep going... */;
-    else if (!self.music && ![otherProfile.music count]) /* Keep going... */;
-    else if (!otherProfile.music && ![self.music count]) /* Keep going... */;
-    else if (![self.music isEqualToArray:otherProfile.music]) return NO;
-
-    if (!self.name && !otherProfile.name) /* Keep going... */;
-    else if (!self.name && [otherProfile.name isEqualToName:[JRName name]]) /* Keep going... */;
-    else if (!otherProfile.name && [self.name isEqualToName:[JRName name]]) /* Keep going... */;
-    else if (![self.name isEqualToName:otherProfile.name]) return NO;
-
-    if (!self.nickname && !otherProfile.nickname) /* Keep going... */;
-    else if ((self.nickname == nil) ^ (otherProfile.nickname == nil)) return NO; // xor
-    else if (![self.nickname isEqualToString:otherProfile.nickname]) return NO;
-
-    if (!self.note && !otherProfile.note) /* Keep going... */;
-    else if ((self.note == nil) ^ (otherProfile.note == nil)) return NO; // xor
-    else if (![self.note isEqualToString:otherProfile.note]) return NO;
-
-    if (!self.organizations && !otherProfile.organizations) /* Keep going... */;
-    else if (!self.organizations && ![otherProfile.organizations count]) /* Keep going... */;
-    else if (!otherProfile.organizations && ![self.organizations count]) /* Keep going... */;
-    else if (![self.organizations isEqualToOrganizationsArray:otherProfile.organizations]) return NO;
-
-    if (!self.pets && !otherProfile.pets) /* Keep going... */;
-    else if (!self.pets && ![otherProfile.pets count]) /* Keep going... */;
-    else if (!otherProfile.pets && ![self.pets count]) /* Keep going... */;
-    else if (![self.pets isEqualToArray:otherProfile.pets]) return NO;
-
-    if (!self.phoneNumbers && !otherProfile.phoneNumbers) /* Keep going... */;
-    else if (!self.phoneNumbers && ![otherProfile.phoneNumbers count]) /* Keep going... */;
-    else if (!otherProfile.phoneNumbers && ![self.phoneNumbers count]) /* Keep going... */;
-    else if (![self.phoneNumbers isEqualToPhoneNumbersArray:otherProfile.phoneNumbers]) return NO;
-
-    if (!self.profilePhotos && !otherProfile.profilePhotos) /* Keep going... */;
-    else if (!self.profilePhotos && ![otherProfile.profilePhotos count]) /* Keep going... */;
-    else if (!otherProfile.profilePhotos && ![self.profilePhotos count]) /* Keep going... */;
-    else if (![self.profilePhotos isEqualToProfilePhotosArray:otherProfile.profilePhotos]) return NO;
-
-    if (!self.politicalViews && !otherProfile.politicalViews) /* Keep going... */;
-    else if ((self.politicalViews == nil) ^ (otherProfile.politicalViews == nil)) return NO; // xor
-    else if (![self.politicalViews isEqualToString:otherProfile.politicalViews]) return NO;
-
-    if (!self.preferredUsername && !otherProfile.preferredUsername) /* Keep going... */;
-    else if ((self.preferredUsername == nil) ^ (otherProfile.preferredUsername == nil)) return NO; // xor
-    else if (![self.preferredUsername isEqualToString:otherProfile.preferredUsername]) return NO;
-
-    if (!self.profileSong && !otherProfile.profileSong) /* Keep going... */;
-    else if ((self.profileSong == nil) ^ (otherProfile.profileSong == nil)) return NO; // xor
-    else if (![self.profileSong isEqualToString:otherProfile.profileSong]) return NO;
-
-    if (!self.profileUrl && !otherProfile.profileUrl) /* Keep going... */;
-    else if ((self.profileUrl == nil) ^ (otherProfile.profileUrl == nil)) return NO; // xor
-    else if (![self.profileUrl isEqualToString:otherProfile.profileUrl]) return NO;
-
-    if (!self.profileVideo && !otherProfile.profileVideo) /* Keep going... */;
-    else if ((self.profileVideo == nil) ^ (otherProfile.profileVideo == nil)) return NO; // xor
-    else if (![self.profileVideo isEqualToString:otherProfile.profileVideo]) return NO;
-
-    if (!self.published && !otherProfile.published) /* Keep going... */;
-    else if ((self.published == nil) ^ (otherProfile.published == nil)) return NO; // xor
-    else if (![self.published isEqualToDate:otherProfile.published]) return NO;
-
-    if (!self.quotes && !otherProfile.quotes) /* Keep going... */;
-    else if (!self.quotes && ![otherProfile.quotes count]) /* Keep going... */;
-    else if (!otherProfile.quotes && ![self.quotes count]) /* Keep going... */;
-    else if (![self.quotes isEqualToArray:otherProfile.quotes]) return NO;
-
-    if (!self.relationshipStatus && !otherProfile.relationshipStatus) /* Keep going... */;
-    else if ((self.relationshipStatus == nil) ^ (otherProfile.relationshipStatus == nil)) return NO; // xor
-    else if (![self.relationshipStatus isEqualToString:otherProfile.relationshipStatus]) return NO;
-
-    if (!self.relationships && !otherProfile.relationships) /* Keep going... */;
-    else if (!self.relationships && ![otherProfile.relationships count]) /* Keep going... */;
-    else if (!otherProfile.relationships && ![self.relationships count]) /* Keep going... */;
-    else if (![self.relationships isEqualToArray:otherProfile.relationships]) return NO;
-
-    if (!self.religion && !otherProfile.religion) /* Keep going... */;
-    else if ((self.religion == nil) ^ (otherProfile.religion == nil)) return NO; // xor
-    else if (![self.religion isEqualToString:otherProfile.religion]) return NO;
-
-    if (!self.romance && !otherProfile.romance) /* Keep going... */;
-    else if ((self.romance == nil) ^ (otherProfile.romance == nil)) return NO; // xor
-    else if (![self.romance isEqualToString:otherProfile.romance]) return NO;
-
-    if (!self.scaredOf && !otherProfile.scaredOf) /* Keep going... */;
-    else if ((self.scaredOf == nil) ^ (otherProfile.scaredOf == nil)) return NO; // xor
-    else if (![self.scaredOf isEqualToString:otherProfile.scaredOf]) return NO;
-
-    if (!self.sexualOrientation && !otherProfile.sexualOrientation) /* Keep going... */;
-    else if ((self.sexualOrientation == nil) ^ (otherProfile.sexualOrientation == nil)) return NO; // xor
-    else if (![self.sexualOrientation isEqualToString:otherProfile.sexualOrientation]) return NO;
-
-    if (!self.smoker && !otherProfile.smoker) /* Keep going... */;
-    else if ((self.smoker == nil) ^ (otherProfile.smoker == nil)) return NO; // xor
-    else if (![self.smoker isEqualToString:otherProfile.smoker]) return NO;
-
-    if (!self.sports && !otherProfile.sports) /* Keep going... */;
-    else if (!self.sports && ![otherProfile.sports count]) /* Keep going... */;
-    else if (!otherProfile.sports && ![self.sports count]) /* Keep going... */;
-    else if (![self.sports isEqualToArray:otherProfile.sports]) return NO;
-
-    if (!self.status && !otherProfile.status) /* Keep going... */;
-    else if ((self.status == nil) ^ (otherProfile.status == nil)) return NO; // xor
-    else if (![self.status isEqualToString:otherProfile.status]) return NO;
-
-    if (!self.tags && !otherProfile.tags) /* Keep going... */;
-    else if (!self.tags && ![otherProfile.tags count]) /* Keep going... */;
-    else if (!otherProfile.tags && ![self.tags count]) /* Keep going... */;
-    else if (![self.tags isEqualToArray:otherProfile.tags]) return NO;
-
-    if (!self.turnOffs && !otherProfile.turnOffs) /* Keep going... */;
-    else if (!self.turnOffs && ![otherProfile.turnOffs count]) /* Keep going... */;
-    else if (!otherProfile.turnOffs && ![self.turnOffs count]) /* Keep going... */;
-    else if (![self.turnOffs isEqualToArray:otherProfile.turnOffs]) return NO;
-
-    if (!self.turnOns && !otherProfile.turnOns) /* Keep going... */;
-    else if (!self.turnOns && ![otherProfile.turnOns count]) /* Keep going... */;
-    else if (!otherProfile.turnOns && ![self.turnOns count]) /* Keep going... */;
-    else if (![self.turnOns isEqualToArray:otherProfile.turnOns]) return NO;
-
-    if (!self.tvShows && !otherProfile.tvShows) /* Keep going... */;
-    else if (!self.tvShows && ![otherProfile.tvShows count]) /* Keep going... */;
-    else if (!otherProfile.tvShows && ![self.tvShows count]) /* Keep going... */;
-    else if (![self.tvShows isEqualToArray:otherProfile.tvShows]) return NO;
-
-    if (!self.updated && !otherProfile.updated) /* Keep going... */;
-    else if ((self.updated == nil) ^ (otherProfile.updated == nil)) return NO; // xor
-    else if (![self.updated isEqualToDate:otherProfile.updated]) return NO;
-
-    if (!self.urls && !otherProfile.urls) /* Keep going... */;
-    else if (!self.urls && ![otherProfile.urls count]) /* Keep going... */;
-    else if (!otherProfile.urls && ![self.urls count]) /* Keep going... */;
-    else if (![self.urls isEqualToUrlsArray:otherProfile.urls]) return NO;
-
-    if (!self.utcOffset && !otherProfile.utcOffset) /* Keep going... */;
-    else if ((self.utcOffset == nil) ^ (otherProfile.utcOffset == nil)) return NO; // xor
-    else if (![self.utcOffset isEqualToString:otherProfile.utcOffset]) return NO;
+    if (!otherProfile) return NO;
+    if ([self hash] != [otherProfile hash]) return NO;
+
+    if (!_aboutMe && !otherProfile->_aboutMe) /* Keep going... */;
+    else if ((_aboutMe == nil) ^ (otherProfile->_aboutMe == nil)) return NO; // xor
+    else if (![_aboutMe isEqualToString:otherProfile->_aboutMe]) return NO;
+
+    if (!_accounts && !otherProfile->_accounts) /* Keep going... */;
+    else if (!_accounts && ![otherProfile->_accounts count]) /* Keep going... */;
+    else if (!otherProfile->_accounts && ![_accounts count]) /* Keep going... */;
+    else if (![_accounts isEqualToAccountsArray:otherProfile->_accounts]) return NO;
+
+    if (!_activities && !otherProfile->_activities) /* Keep going... */;
+    else if (!_activities && ![otherProfile->_activities count]) /* Keep going... */;
+    else if (!otherProfile->_activities && ![_activities count]) /* Keep going... */;
+    else if (![_activities isEqualToArray:otherProfile->_activities]) return NO;
+
+    if (!_addresses && !otherProfile->_addresses) /* Keep going... */;
+    else if (!_addresses && ![otherProfile->_addresses count]) /* Keep going... */;
+    else if (!otherProfile->_addresses && ![_addresses count]) /* Keep going... */;
+    else if (![_addresses isEqualToAddressesArray:otherProfile->_addresses]) return NO;
+
+    if (!_anniversary && !otherProfile->_anniversary) /* Keep going... */;
+    else if ((_anniversary == nil) ^ (otherProfile->_anniversary == nil)) return NO; // xor
+    else if (![_anniversary isEqualToDate:otherProfile->_anniversary]) return NO;
+
+    if (!_birthday && !otherProfile->_birthday) /* Keep going... */;
+    else if ((_birthday == nil) ^ (otherProfile->_birthday == nil)) return NO; // xor
+    else if (![_birthday isEqualToString:otherProfile->_birthday]) return NO;
+
+    if (!_bodyType && !otherProfile->_bodyType) /* Keep going... */;
+    else if (!_bodyType && [otherProfile->_bodyType isEqualToBodyType:[JRBodyType bodyType]]) /* Keep going... */;
+    else if (!otherProfile->_bodyType && [_bodyType isEqualToBodyType:[JRBodyType bodyType]]) /* Keep going... */;
+    else if (![_bodyType isEqualToBodyType:otherProfile->_bodyType]) return NO;
+
+    if (!_books && !otherProfile->_books) /* Keep going... */;
+    else if (!_books && ![otherProfile->_books count]) /* Keep going... */;
+    else if (!otherProfile->_books && ![_books count]) /* Keep going... */;
+    else if (![_books isEqualToArray:otherProfile->_books]) return NO;
+
+    if (!_cars && !otherProfile->_cars) /* Keep going... */;
+    else if (!_cars && ![otherProfile->_cars count]) /* Keep going... */;
+    else if (!otherProfile->_cars && ![_cars count]) /* Keep going... */;
+    else if (![_cars isEqualToArray:otherProfile->_cars]) return NO;
+
+    if (!_children && !otherProfile->_children) /* Keep going... */;
+    else if (!_children && ![otherProfile->_children count]) /* Keep going... */;
+    else if (!otherProfile->_children && ![_children count]) /* Keep going... */;
+    else if (![_children isEqualToArray:otherProfile->_children]) return NO;
+
+    if (!_currentLocation && !otherProfile->_currentLocation) /* Keep going... */;
+    else if (!_currentLocation && [otherProfile->_currentLocation isEqualToCurrentLocation:[JRCurrentLocation currentLocation]]) /* Keep going... */;
+    else if (!otherProfile->_currentLocation && [_currentLocation isEqualToCurrentLocation:[JRCurrentLocation currentLocation]]) /* Keep going... */;
+    else if (![_currentLocation isEqualToCurrentLocation:otherProfile->_currentLocation]) return NO;
+
+    if (!_displayName && !otherProfile->_displayName) /* Keep going... */;
+    else if ((_displayName == nil) ^ (otherProfile->_displayName == nil)) return NO; // xor
+    else if (![_displayName isEqualToString:otherProfile->_displayName]) return NO;
+
+    if (!_drinker && !otherProfile->_drinker) /* Keep going... */;
+    else if ((_drinker == nil) ^ (otherProfile->_drinker == nil)) return NO; // xor
+    else if (![_drinker isEqualToString:otherProfile->_drinker]) return NO;
+
+    if (!_emails && !otherProfile->_emails) /* Keep going... */;
+    else if (!_emails && ![otherProfile->_emails count]) /* Keep going... */;
+    else if (!otherProfile->_emails && ![_emails count]) /* Keep going... */;
+    else if (![_emails isEqualToEmailsArray:otherProfile->_emails]) return NO;
+
+    if (!_ethnicity && !otherProfile->_ethnicity) /* Keep going... */;
+    else if ((_ethnicity == nil) ^ (otherProfile->_ethnicity == nil)) return NO; // xor
+    else if (![_ethnicity isEqualToString:otherProfile->_ethnicity]) return NO;
+
+    if (!_fashion && !otherProfile->_fashion) /* Keep going... */;
+    else if ((_fashion == nil) ^ (otherProfile->_fashion == nil)) return NO; // xor
+    else if (![_fashion isEqualToString:otherProfile->_fashion]) return NO;
+
+    if (!_food && !otherProfile->_food) /* Keep going... */;
+    else if (!_food && ![otherProfile->_food count]) /* Keep going... */;
+    else if (!otherProfile->_food && ![_food count]) /* Keep going... */;
+    else if (![_food isEqualToArray:otherProfile->_food]) return NO;
+
+    if (!_gender && !otherProfile->_gender) /* Keep going... */;
+    else if ((_gender == nil) ^ (otherProfile->_gender == nil)) return NO; // xor
+    else if (![_gender isEqualToString:otherProfile->_gender]) return NO;
+
+    if (!_happiestWhen && !otherProfile->_happiestWhen) /* Keep going... */;
+    else if ((_happiestWhen == nil) ^ (otherProfile->_happiestWhen == nil)) return NO; // xor
+    else if (![_happiestWhen isEqualToString:otherProfile->_happiestWhen]) return NO;
+
+    if (!_heroes && !otherProfile->_heroes) /* Keep going... */;
+    else if (!_heroes && ![otherProfile->_heroes count]) /* Keep going... */;
+    else if (!otherProfile->_heroes && ![_heroes count]) /* Keep going... */;
+    else if (![_heroes isEqualToArray:otherProfile->_heroes]) return NO;
+
+    if (!_humor && !otherProfile->_humor) /* Keep going... */;
+    else if ((_humor == nil) ^ (otherProfile->_humor == nil)) return NO; // xor
+    else if (![_humor isEqualToString:otherProfile->_humor]) return NO;
+
+    if (!_ims && !otherProfile->_ims) /* Keep going... */;
+    else if (!_ims && ![otherProfile->_ims count]) /* Keep going... */;
+    else if (!otherProfile->_ims && ![_ims count]) /* Keep going... */;
+    else if (![_ims isEqualToImsArray:otherProfile->_ims]) return NO;
+
+    if (!_interestedInMeeting && !otherProfile->_interestedInMeeting) /* Keep going... */;
+    else if (!_interestedInMeeting && ![otherProfile->_interestedInMeeting count]) /* Keep going... */;
+    else if (!otherProfile->_interestedInMeeting && ![_interestedInMeeting count]) /* Keep going... */;
+    else if (![_interestedInMeeting isEqualToArray:otherProfile->_interestedInMeeting]) return NO;
+
+    if (!_interests && !otherProfile->_interests) /* Keep going... */;
+    else if (!_interests && ![otherProfile->_interests count]) /* Keep going... */;
+    else if (!otherProfile->_interests && ![_interests count]) /* Keep going... */;
+    else if (![_interests isEqualToArray:otherProfile->_interests]) return NO;
+
+    if (!_jobInterests && !otherProfile->_jobInterests) /* Keep going... */;
+    else if (!_jobInterests && ![otherProfile->_jobInterests count]) /* Keep going... */;
+    else if (!otherProfile->_jobInterests && ![_jobInterests count]) /* Keep going... */;
+    else if (![_jobInterests isEqualToArray:otherProfile->_jobInterests]) return NO;
+
+    if (!_languages && !otherProfile->_languages) /* Keep going... */;
+    else if (!_languages && ![otherProfile->_languages count]) /* Keep going... */;
+    else if (!otherProfile->_languages && ![_languages count]) /* Keep going... */;
+    else if (![_languages isEqualToArray:otherProfile->_languages]) return NO;
+
+    if (!_languagesSpoken && !otherProfile->_languagesSpoken) /* Keep going... */;
+    else if (!_languagesSpoken && ![otherProfile->_languagesSpoken count]) /* Keep going... */;
+    else if (!otherProfile->_languagesSpoken && ![_languagesSpoken count]) /* Keep going... */;
+    else if (![_languagesSpoken isEqualToArray:otherProfile->_languagesSpoken]) return NO;
+
+    if (!_livingArrangement && !otherProfile->_livingArrangement) /* Keep going... */;
+    else if ((_livingArrangement == nil) ^ (otherProfile->_livingArrangement == nil)) return NO; // xor
+    else if (![_livingArrangement isEqualToString:otherProfile->_livingArrangement]) return NO;
+
+    if (!_lookingFor && !otherProfile->_lookingFor) /* Keep going... */;
+    else if (!_lookingFor && ![otherProfile->_lookingFor count]) /* Keep going... */;
+    else if (!otherProfile->_lookingFor && ![_lookingFor count]) /* Keep going... */;
+    else if (![_lookingFor isEqualToArray:otherProfile->_lookingFor]) return NO;
+
+    if (!_movies && !otherProfile->_movies) /* Keep going... */;
+    else if (!_movies && ![otherProfile->_movies count]) /* Keep going... */;
+    else if (!otherProfile->_movies && ![_movies count]) /* Keep going... */;
+    else if (![_movies isEqualToArray:otherProfile->_movies]) return NO;
+
+    if (!_music && !otherProfile->_music) /* Keep going... */;
+    else if (!_music && ![otherProfile->_music count]) /* Keep going... */;
+    else if (!otherProfile->_music && ![_music count]) /* Keep going... */;
+    else if (![_music isEqualToArray:otherProfile->_music]) return NO;
+
+    if (!_name && !otherProfile->_name) /* Keep going... */;
+    else if (!_name && [otherProfile->_name isEqualToName:[JRName name]]) /* Keep going... */;
+    else if (!otherProfile->_name && [_name isEqualToName:[JRName name]]) /* Keep going... */;
+    else if (![_name isEqualToName:otherProfile->_name]) return NO;
+
+    if (!_nickname && !otherProfile->_nickname) /* Keep going... */;
+    else if ((_nickname == nil) ^ (otherProfile->_nickname == nil)) return NO; // xor
+    else if (![_nickname isEqualToString:otherProfile->_nickname]) return NO;
+
+    if (!_note && !otherProfile->_note) /* Keep going... */;
+    else if ((_note == nil) ^ (otherProfile->_note == nil)) return NO; // xor
+    else if (![_note isEqualToString:otherProfile->_note]) return NO;
+
+    if (!_organizations && !otherProfile->_organizations) /* Keep going... */;
+    else if (!_organizations && ![otherProfile->_organizations count]) /* Keep going... */;
+    else if (!otherProfile->_organizations && ![_organizations count]) /* Keep going... */;
+    else if (![_organizations isEqualToOrganizationsArray:otherProfile->_organizations]) return NO;
+
+    if (!_pets && !otherProfile->_pets) /* Keep going... */;
+    else if (!_pets && ![otherProfile->_pets count]) /* Keep going... */;
+    else if (!otherProfile->_pets && ![_pets count]) /* Keep going... */;
+    else if (![_pets isEqualToArray:otherProfile->_pets]) return NO;
+
+    if (!_phoneNumbers && !otherProfile->_phoneNumbers) /* Keep going... */;
+    else if (!_phoneNumbers && ![otherProfile->_phoneNumbers count]) /* Keep going... */;
+    else if (!otherProfile->_phoneNumbers && ![_phoneNumbers count]) /* Keep going... */;
+    else if (![_phoneNumbers isEqualToPhoneNumbersArray:otherProfile->_phoneNumbers]) return NO;
+
+    if (!_profilePhotos && !otherProfile->_profilePhotos) /* Keep going... */;
+    else if (!_profilePhotos && ![otherProfile->_profilePhotos count]) /* Keep going... */;
+    else if (!otherProfile->_profilePhotos && ![_profilePhotos count]) /* Keep going... */;
+    else if (![_profilePhotos isEqualToProfilePhotosArray:otherProfile->_profilePhotos]) return NO;
+
+    if (!_politicalViews && !otherProfile->_politicalViews) /* Keep going... */;
+    else if ((_politicalViews == nil) ^ (otherProfile->_politicalViews == nil)) return NO; // xor
+    else if (![_politicalViews isEqualToString:otherProfile->_politicalViews]) return NO;
+
+    if (!_preferredUsername && !otherProfile->_preferredUsername) /* Keep going... */;
+    else if ((_preferredUsername == nil) ^ (otherProfile->_preferredUsername == nil)) return NO; // xor
+    else if (![_preferredUsername isEqualToString:otherProfile->_preferredUsername]) return NO;
+
+    if (!_profileSong && !otherProfile->_profileSong) /* Keep going... */;
+    else if ((_profileSong == nil) ^ (otherProfile->_profileSong == nil)) return NO; // xor
+    else if (![_profileSong isEqualToString:otherProfile->_profileSong]) return NO;
+
+    if (!_profileUrl && !otherProfile->_profileUrl) /* Keep going... */;
+    else if ((_profileUrl == nil) ^ (otherProfile->_profileUrl == nil)) return NO; // xor
+    else if (![_profileUrl isEqualToString:otherProfile->_profileUrl]) return NO;
+
+    if (!_profileVideo && !otherProfile->_profileVideo) /* Keep going... */;
+    else if ((_profileVideo == nil) ^ (otherProfile->_profileVideo == nil)) return NO; // xor
+    else if (![_profileVideo isEqualToString:otherProfile->_profileVideo]) return NO;
+
+    if (!_published && !otherProfile->_published) /* Keep going... */;
+    else if ((_published == nil) ^ (otherProfile->_published == nil)) return NO; // xor
+    else if (![_published isEqualToDate:otherProfile->_published]) return NO;
+
+    if (!_quotes && !otherProfile->_quotes) /* Keep going... */;
+    else if (!_quotes && ![otherProfile->_quotes count]) /* Keep going... */;
+    else if (!otherProfile->_quotes && ![_quotes count]) /* Keep going... */;
+    else if (![_quotes isEqualToArray:otherProfile->_quotes]) return NO;
+
+    if (!_relationshipStatus && !otherProfile->_relationshipStatus) /* Keep going... */;
+    else if ((_relationshipStatus == nil) ^ (otherProfile->_relationshipStatus == nil)) return NO; // xor
+    else if (![_relationshipStatus isEqualToString:otherProfile->_relationshipStatus]) return NO;
+
+    if (!_relationships && !otherProfile->_relationships) /* Keep going... */;
+    else if (!_relationships && ![otherProfile->_relationships count]) /* Keep going... */;
+    else if (!otherProfile->_relationships && ![_relationships count]) /* Keep going... */;
+    else if (![_relationships isEqualToArray:otherProfile->_relationships]) return NO;
+
+    if (!_religion && !otherProfile->_religion) /* Keep going... */;
+    else if ((_religion == nil) ^ (otherProfile->_religion == nil)) return NO; // xor
+    else if (![_religion isEqualToString:otherProfile->_religion]) return NO;
+
+    if (!_romance && !otherProfile->_romance) /* Keep going... */;
+    else if ((_romance == nil) ^ (otherProfile->_romance == nil)) return NO; // xor
+    else if (![_romance isEqualToString:otherProfile->_romance]) return NO;
+
+    if (!_scaredOf && !otherProfile->_scaredOf) /* Keep going... */;
+    else if ((_scaredOf == nil) ^ (otherProfile->_scaredOf == nil)) return NO; // xor
+    else if (![_scaredOf isEqualToString:otherProfile->_scaredOf]) return NO;
+
+    if (!_sexualOrientation && !otherProfile->_sexualOrientation) /* Keep going... */;
+    else if ((_sexualOrientation == nil) ^ (otherProfile->_sexualOrientation == nil)) return NO; // xor
+    else if (![_sexualOrientation isEqualToString:otherProfile->_sexualOrientation]) return NO;
+
+    if (!_smoker && !otherProfile->_smoker) /* Keep going... */;
+    else if ((_smoker == nil) ^ (otherProfile->_smoker == nil)) return NO; // xor
+    else if (![_smoker isEqualToString:otherProfile->_smoker]) return NO;
+
+    if (!_sports && !otherProfile->_sports) /* Keep going... */;
+    else if (!_sports && ![otherProfile->_sports count]) /* Keep going... */;
+    else if (!otherProfile->_sports && ![_sports count]) /* Keep going... */;
+    else if (![_sports isEqualToArray:otherProfile->_sports]) return NO;
+
+    if (!_status && !otherProfile->_status) /* Keep going... */;
+    else if ((_status == nil) ^ (otherProfile->_status == nil)) return NO; // xor
+    else if (![_status isEqualToString:otherProfile->_status]) return NO;
+
+    if (!_tags && !otherProfile->_tags) /* Keep going... */;
+    else if (!_tags && ![otherProfile->_tags count]) /* Keep going... */;
+    else if (!otherProfile->_tags && ![_tags count]) /* Keep going... */;
+    else if (![_tags isEqualToArray:otherProfile->_tags]) return NO;
+
+    if (!_turnOffs && !otherProfile->_turnOffs) /* Keep going... */;
+    else if (!_turnOffs && ![otherProfile->_turnOffs count]) /* Keep going... */;
+    else if (!otherProfile->_turnOffs && ![_turnOffs count]) /* Keep going... */;
+    else if (![_turnOffs isEqualToArray:otherProfile->_turnOffs]) return NO;
+
+    if (!_turnOns && !otherProfile->_turnOns) /* Keep going... */;
+    else if (!_turnOns && ![otherProfile->_turnOns count]) /* Keep going... */;
+    else if (!otherProfile->_turnOns && ![_turnOns count]) /* Keep going... */;
+    else if (![_turnOns isEqualToArray:otherProfile->_turnOns]) return NO;
+
+    if (!_tvShows && !otherProfile->_tvShows) /* Keep going... */;
+    else if (!_tvShows && ![otherProfile->_tvShows count]) /* Keep going... */;
+    else if (!otherProfile->_tvShows && ![_tvShows count]) /* Keep going... */;
+    else if (![_tvShows isEqualToArray:otherProfile->_tvShows]) return NO;
+
+    if (!_updated && !otherProfile->_updated) /* Keep going... */;
+    else if ((_updated == nil) ^ (otherProfile->_updated == nil)) return NO; // xor
+    else if (![_updated isEqualToDate:otherProfile->_updated]) return NO;
+
+    if (!_urls && !otherProfile->_urls) /* Keep going... */;
+    else if (!_urls && ![otherProfile->_urls count]) /* Keep going... */;
+    else if (!otherProfile->_urls && ![_urls count]) /* Keep going... */;
+    else if (![_urls isEqualToUrlsArray:otherProfile->_urls]) return NO;
+
+    if (!_utcOffset && !otherProfile->_utcOffset) /* Keep going... */;
+    else if ((_utcOffset == nil) ^ (otherProfile->_utcOffset == nil)) return NO; // xor
+    else if (![_utcOffset isEqualToString:otherProfile->_utcOffset]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRProfile class]]) return NO;
+
+    return [self isEqualToProfile:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_aboutMe hash];
+    hash = hash * 31 + [_accounts captureObjectElementsHash];
+    hash = hash * 31 + [_activities hash];
+    hash = hash * 31 + [_addresses captureObjectElementsHash];
+    hash = hash * 31 + [_anniversary hash];
+    hash = hash * 31 + [_birthday hash];
+    hash = hash * 31 + [_bodyType hash];
+    hash = hash * 31 + [_books hash];
+    hash = hash * 31 + [_cars hash];
+    hash = hash * 31 + [_children hash];
+    hash = hash * 31 + [_currentLocation hash];
+    hash = hash * 31 + [_displayName hash];
+    hash = hash * 31 + [_drinker hash];
+    hash = hash * 31 + [_emails captureObjectElementsHash];
+    hash = hash * 31 + [_ethnicity hash];
+    hash = hash * 31 + [_fashion hash];
+    hash = hash * 31 + [_food hash];
+    hash = hash * 31 + [_gender hash];
+    hash = hash * 31 + [_happiestWhen hash];
+    hash = hash * 31 + [_heroes hash];
+    hash = hash * 31 + [_humor hash];
+    hash = hash * 31 + [_ims captureObjectElementsHash];
+    hash = hash * 31 + [_interestedInMeeting hash];
+    hash = hash * 31 + [_interests hash];
+    hash = hash * 31 + [_jobInterests hash];
+    hash = hash * 31 + [_languages hash];
+    hash = hash * 31 + [_languagesSpoken hash];
+    hash = hash * 31 + [_livingArrangement hash];
+    hash = hash * 31 + [_lookingFor hash];
+    hash = hash * 31 + [_movies hash];
+    hash = hash * 31 + [_music hash];
+    hash = hash * 31 + [_name hash];
+    hash = hash * 31 + [_nickname hash];
+    hash = hash * 31 + [_note hash];
+    hash = hash * 31 + [_organizations captureObjectElementsHash];
+    hash = hash * 31 + [_pets hash];
+    hash = hash * 31 + [_phoneNumbers captureObjectElementsHash];
+    hash = hash * 31 + [_profilePhotos captureObjectElementsHash];
+    hash = hash * 31 + [_politicalViews hash];
+    hash = hash * 31 + [_preferredUsername hash];
+    hash = hash * 31 + [_profileSong hash];
+    hash = hash * 31 + [_profileUrl hash];
+    hash = hash * 31 + [_profileVideo hash];
+    hash = hash * 31 + [_published hash];
+    hash = hash * 31 + [_quotes hash];
+    hash = hash * 31 + [_relationshipStatus hash];
+    hash = hash * 31 + [_relationships hash];
+    hash = hash * 31 + [_religion hash];
+    hash = hash * 31 + [_romance hash];
+    hash = hash * 31 + [_scaredOf hash];
+    hash = hash * 31 + [_sexualOrientation hash];
+    hash = hash * 31 + [_smoker hash];
+    hash = hash * 31 + [_sports hash];
+    hash = hash * 31 + [_status hash];
+    hash = hash * 31 + [_tags hash];
+    hash = hash * 31 + [_turnOffs hash];
+    hash = hash * 31 + [_turnOns hash];
+    hash = hash * 31 + [_tvShows hash];
+    hash = hash * 31 + [_updated hash];
+    hash = hash * 31 + [_urls captureObjectElementsHash];
+    hash = hash * 31 + [_utcOffset hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
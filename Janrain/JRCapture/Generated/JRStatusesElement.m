@@ -58,6 +58,7 @@
 
 - (void)setStatus:(NSString *)newStatus
 {
+    [self willChangeProperty:@"status"];
     [self.dirtyPropertySet addObject:@"status"];
 
     _status = [newStatus copy];
@@ -70,6 +71,7 @@
 
 - (void)setStatusCreated:(JRDateTime *)newStatusCreated
 {
+    [self willChangeProperty:@"statusCreated"];
     [self.dirtyPropertySet addObject:@"statusCreated"];
 
     _statusCreated = [newStatusCreated copy];
@@ -93,14 +95,39 @@
     return [[JRStatusesElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRStatusesElement *statusesElementCopy = (JRStatusesElement *)[super copyWithZone:zone];
+
+    statusesElementCopy->_status = _status;
+    statusesElementCopy->_statusCreated = _statusCreated;
+
+    return statusesElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.status ? self.status : [NSNull null])
+    [dictionary setObject:(_status ? _status : [NSNull null])
                    forKey:@"status"];
-    [dictionary setObject:(self.statusCreated ? [self.statusCreated stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_statusCreated ? [_statusCreated stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"statusCreated"];
 
     if (forEncoder)
@@ -185,6 +212,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -201,6 +229,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"statusesElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"statusesElement"] allObjects]];
 
@@ -212,10 +242,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"status"])
-        [dictionary setObject:(self.status ? self.status : [NSNull null]) forKey:@"status"];
+        [dictionary setObject:(_status ? _status : [NSNull null]) forKey:@"status"];
 
     if ([self.dirtyPropertySet containsObject:@"statusCreated"])
-        [dictionary setObject:(self.statusCreated ? [self.statusCreated stringFromISO8601DateTime] : [NSNull null]) forKey:@"statusCreated"];
+        [dictionary setObject:(_statusCreated ? [_statusCreated stringFromISO8601DateTime] : [NSNull null]) forKey:@"statusCreated"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -231,8 +261,8 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.status ? self.status : [NSNull null]) forKey:@"status"];
-    [dictionary setObject:(self.statusCreated ? [self.statusCreated stringFromISO8601DateTime] : [NSNull null]) forKey:@"statusCreated"];
+    [dictionary setObject:(_status ? _status : [NSNull null]) forKey:@"status"];
+    [dictionary setObject:(_statusCreated ? [_statusCreated stringFromISO8601DateTime] : [NSNull null]) forKey:@"statusCreated"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -248,17 +278,38 @@
 
 - (BOOL)isEqualToStatusesElement:(JRStatusesElement *)otherStatusesElement
 {
-    if (!self.status && !otherStatusesElement.status) /* Keep going... */;
-    else if ((self.status == nil) ^ (otherStatusesElement.status == nil)) return NO; // xor
-    else if (![self.status isEqualToString:otherStatusesElement.status]) return NO;
+    if (!otherStatusesElement) return NO;
+    if ([self hash] != [otherStatusesElement hash]) return NO;
+
+    if (!_status && !otherStatusesElement->_status) /* Keep going... */;
+    else if ((_status == nil) ^ (otherStatusesElement->_status == nil)) return NO; // xor
+    else if (![_status isEqualToString:otherStatusesElement->_status]) return NO;
 
-    if (!self.statusCreated && !otherStatusesElement.statusCreated) /* Keep going... */;
-    else if ((self.statusCreated == nil) ^ (otherStatusesElement.statusCreated == nil)) return NO; // xor
-    else if (![self.statusCreated isEqualToDate:otherStatusesElement.statusCreated]) return NO;
+    if (!_statusCreated && !otherStatusesElement->_statusCreated) /* Keep going... */;
+    else if ((_statusCreated == nil) ^ (otherStatusesElement->_statusCreated == nil)) return NO; // xor
+    else if (![_statusCreated isEqualToDate:otherStatusesElement->_statusCreated]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRStatusesElement class]]) return NO;
+
+    return [self isEqualToStatusesElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_status hash];
+    hash = hash * 31 + [_statusCreated hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -629,6 +629,9 @@ sub recursiveParse {
   #   exampleElementCopy.captureObjectPath = self.captureObjectPath;
   $copyConstructorSection[2]  = "    " . $className . " *" . $objectName . "Copy = (" . $className . " *)";
   $copyConstructorSection[6]  = $objectName . "Copy";
+  $copyConstructorSection[10] = "";
+  $copyConstructorSection[13] = "";
+  $copyConstructorSection[16] = "";
 
   # e.g.:
   #   + (id)exampleElementFromDictionary:(NSDictionary*)dictionary withPath:(NSString *)capturePath fromDecoder:(BOOL)fromDecoder
@@ -690,6 +693,19 @@ sub recursiveParse {
   #   - (BOOL)isEqualToExampleElement:(JRExampleElement *)otherExampleElement
   #   {
   $isEqualObjectSection[1]    = ucfirst($objectName) . ":(" . $className . " *)other" . ucfirst($objectName);
+  $isEqualObjectSection[4]    = ucfirst($objectName);
+  $isEqualObjectSection[7]    = ucfirst($objectName);
+
+  # e.g.:
+  #   - (BOOL)isEqual:(id)object
+  #   {
+  #       if (object == self) return YES;
+  #       if (![object isKindOfClass:[JRExampleElement class]]) return NO;
+  #
+  #       return [self isEqualToExampleElement:object];
+  #   }
+  $isEqualObjectSection[13]   = $className;
+  $isEqualObjectSection[15]   = ucfirst($objectName);
 
   ################################################################################
   # Deal with the Capture path and id depending on whether the object itself
@@ -917,9 +933,9 @@ sub recursiveParse {
     ######################################################
     # Finish initializing property defaults
     ######################################################
-    my $toDictionary           = "self.$propertyName";        # Default operation is to insert the NSObject into an NSMutableDictionary with no other modifications
-    my $toUpDictionary         = "self.$propertyName";        # Default operation for toUpdateDictionary
-    my $toRplDictionary        = "self.$propertyName";        # Default operation for toReplaceDictionary
+    my $toDictionary           = "_$propertyName";            # Default operation is to insert the NSObject into an NSMutableDictionary with no other modifications
+    my $toUpDictionary         = "_$propertyName";            # Default operation for toUpdateDictionary
+    my $toRplDictionary        = "_$propertyName";            # Default operation for toReplaceDictionary
     my $frDictionary           =                              # Default operation is to just pull the NSObject from
           "[dictionary objectForKey:\@\"$dictionaryKey\"]";   # the dictionary and stick it into the property
     my $frUpDictionary         =
@@ -953,7 +969,7 @@ sub recursiveParse {
 
       $objectiveType   = "JRBoolean *";
 
-      $toDictionary    = $toUpDictionary = $toRplDictionary = "[NSNumber numberWithBool:[self." . $propertyName . " boolValue]]";
+      $toDictionary    = $toUpDictionary = $toRplDictionary = "[NSNumber numberWithBool:[_" . $propertyName . " boolValue]]";
       $frDictionary    = $frUpDictionary = $frRplDictionary = "[NSNumber numberWithBool:[(NSNumber*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] boolValue]]";
 
       $isEqualMethod   = "isEqualToNumber:";
@@ -968,7 +984,7 @@ sub recursiveParse {
 
       $objectiveType   = "JRInteger *";
 
-      $toDictionary    = $toUpDictionary = $toRplDictionary = "[NSNumber numberWithInteger:[self." . $propertyName . " integerValue]]";
+      $toDictionary    = $toUpDictionary = $toRplDictionary = "[NSNumber numberWithInteger:[_" . $propertyName . " integerValue]]";
       $frDictionary    = $frUpDictionary = $frRplDictionary = "[NSNumber numberWithInteger:[(NSNumber*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] integerValue]]";
 
       $isEqualMethod   = "isEqualToNumber:";
@@ -990,7 +1006,7 @@ sub recursiveParse {
 
       $objectiveType  = "JRDate *";
 
-      $toDictionary   = $toUpDictionary = $toRplDictionary = "[self." . $propertyName . " stringFromISO8601Date]";
+      $toDictionary   = $toUpDictionary = $toRplDictionary = "[_" . $propertyName . " stringFromISO8601Date]";
       $frDictionary   = $frUpDictionary = $frRplDictionary = "[JRDate dateFromISO8601DateString:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"]]";
 
       $isEqualMethod  = "isEqualToDate:";
@@ -1002,7 +1018,7 @@ sub recursiveParse {
 
       $objectiveType  = "JRDateTime *";
 
-      $toDictionary   = $toUpDictionary = $toRplDictionary = "[self." . $propertyName . " stringFromISO8601DateTime]";
+      $toDictionary   = $toUpDictionary = $toRplDictionary = "[_" . $propertyName . " stringFromISO8601DateTime]";
       $frDictionary   = $frUpDictionary = $frRplDictionary = "[JRDateTime dateFromISO8601DateTimeString:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"]]";
 
       $isEqualMethod  = "isEqualToDate:";
@@ -1060,7 +1076,7 @@ sub recursiveParse {
 
       $objectiveType  = "JRObjectId *";
 
-      $toDictionary   = $toUpDictionary = $toRplDictionary = "[NSNumber numberWithInteger:[self." . $propertyName . " integerValue]]";
+      $toDictionary   = $toUpDictionary = $toRplDictionary = "[NSNumber numberWithInteger:[_" . $propertyName . " integerValue]]";
       $frDictionary   = $frUpDictionary = $frRplDictionary = "[NSNumber numberWithInteger:[(NSNumber*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] integerValue]]";
 
       $isEqualMethod  = "isEqualToNumber:";
@@ -1103,8 +1119,8 @@ sub recursiveParse {
           $propertyName = $objectName . ucfirst($propertyName);
         }
 
-        $toDictionary    = "[self." . $propertyName . " arrayOf" . ucfirst($propertyName) . "DictionariesFrom" . ucfirst($propertyName) . "ElementsForEncoder:forEncoder]";
-        $toRplDictionary = "[self." . $propertyName . " arrayOf" . ucfirst($propertyName) . "ReplaceDictionariesFrom" . ucfirst($propertyName) . "Elements]";
+        $toDictionary    = "[_" . $propertyName . " arrayOf" . ucfirst($propertyName) . "DictionariesFrom" . ucfirst($propertyName) . "ElementsForEncoder:forEncoder]";
+        $toRplDictionary = "[_" . $propertyName . " arrayOf" . ucfirst($propertyName) . "ReplaceDictionariesFrom" . ucfirst($propertyName) . "Elements]";
         $frDictionary    = "[(NSArray*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] arrayOf" . ucfirst($propertyName) . "ElementsFrom" . ucfirst($propertyName) . "DictionariesWithPath:" . $objectName . ".captureObjectPath fromDecoder:fromDecoder]";
         $frRplDictionary = "[(NSArray*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] arrayOf" . ucfirst($propertyName) . "ElementsFrom" . ucfirst($propertyName) . "DictionariesWithPath:self.captureObjectPath fromDecoder:NO]";
         $frDcdDictionary = "[(NSArray*)[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] arrayOf" . ucfirst($propertyName) . "ElementsFrom" . ucfirst($propertyName) . "DictionariesWithPath:self.captureObjectPath fromDecoder:YES]";
@@ -1143,8 +1159,8 @@ sub recursiveParse {
       }
 
       $objectiveType          = "JR" . ucfirst($propertyName) . " *";
-      $toDictionary           = "[self." . $propertyName . " newDictionaryForEncoder:forEncoder]";
-      $toUpDictionary         = "[self." . $propertyName . " toUpdateDictionary]";
+      $toDictionary           = "[_" . $propertyName . " newDictionaryForEncoder:forEncoder]";
+      $toUpDictionary         = "[_" . $propertyName . " toUpdateDictionary]";
 
       $frDictionary    = "[JR" . ucfirst($propertyName) . " " . $propertyName . "ObjectFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:" . $objectName . ".captureObjectPath fromDecoder:fromDecoder]";
       $frUpDictionary  = "[JR" . ucfirst($propertyName) . " " . $propertyName . "ObjectFromDictionary:[dictionary objectForKey:\@\"" . $dictionaryKey . "\"] withPath:self.captureObjectPath fromDecoder:NO]";
@@ -1256,7 +1272,11 @@ sub recursiveParse {
 
       # e.g.:
       #   foo = [newFoo copy];
-      $constructorSection[8] .= "\n        _" . $propertyName . " = [new" . ucfirst($propertyName) . " copy];";
+      if ($isObject || ($isArray && !$isStringArray)) {
+        $constructorSection[8] .= "\n        _" . $propertyName . " = [self claimValue:[new" . ucfirst($propertyName) . " copy] forProperty:\@\"" . $propertyName . "\"];";
+      } else {
+        $constructorSection[8] .= "\n        _" . $propertyName . " = [new" . ucfirst($propertyName) . " copy];";
+      }
 
       my $argDesc;
       if ($propertyDesc) {
@@ -1283,8 +1303,22 @@ sub recursiveParse {
     ##########################################################################
 
     # e.g.:
-    #   exampleElementCopy.baz = self.baz;
-    $copyConstructorSection[4]  .= "    " . $objectName . "Copy." . $propertyName . " = self." . $propertyName . ";\n";
+    #   exampleElementCopy->_baz = _baz;
+    $copyConstructorSection[4]  .= "    " . $objectName . "Copy->_" . $propertyName . " = _" . $propertyName . ";\n";
+
+    # e.g.:
+    #   return [NSSet setWithObjects:@"foo", @"bar", ... nil];
+    if ($isObject || ($isArray && !$isStringArray)) {
+      $copyConstructorSection[10] .= "\@\"" . $propertyName . "\", ";
+
+      # e.g.:
+      #   if ([propertyName isEqualToString:@"foo"]) return _foo;
+      $copyConstructorSection[13] .= "    if ([propertyName isEqualToString:\@\"" . $propertyName . "\"]) return _" . $propertyName . ";\n";
+
+      # e.g.:
+      #   if ([propertyName isEqualToString:@"foo"]) _foo = value;
+      $copyConstructorSection[16] .= "    if ([propertyName isEqualToString:\@\"" . $propertyName . "\"]) _" . $propertyName . " = value;\n";
+    }
 
     # e.g.:
     #   exampleElement.baz =
@@ -1295,9 +1329,9 @@ sub recursiveParse {
     $objFromDictSection[20]     .= "        " . $frDictionary . " : nil;\n";
 
     # e.g.:
-    #   [dictionary setObject:(self.baz ? self.baz : [NSNull null])
+    #   [dictionary setObject:(_baz ? _baz : [NSNull null])
     #                  forKey:@"baz"];
-    $dictFromObjSection[3]      .= "    [dictionary setObject:(self." . $propertyName . " ? " . $toDictionary . " : [NSNull null])\n";
+    $dictFromObjSection[3]      .= "    [dictionary setObject:(_" . $propertyName . " ? " . $toDictionary . " : [NSNull null])\n";
     $dictFromObjSection[3]      .= "                   forKey:\@\"" . $dictionaryKey . "\"];\n";
 
     # e.g.:
@@ -1364,9 +1398,9 @@ sub recursiveParse {
 
 
       # e.g.:
-      #   _foo = [[JRFoo alloc] init];
-      $minConstructorSection[3] .= "\n        _" . $propertyName . " = [[JR" . ucfirst($propertyName) . " alloc] init];";
-      $constructorSection[8]    .= "\n        _" . $propertyName . " = [[JR" . ucfirst($propertyName) . " alloc] init];";
+      #   _foo = [self claimValue:[[JRFoo alloc] init] forProperty:@"foo"];
+      $minConstructorSection[3] .= "\n        _" . $propertyName . " = [self claimValue:[[JR" . ucfirst($propertyName) . " alloc] init] forProperty:\@\"" . $propertyName . "\"];";
+      $constructorSection[8]    .= "\n        _" . $propertyName . " = [self claimValue:[[JR" . ucfirst($propertyName) . " alloc] init] forProperty:\@\"" . $propertyName . "\"];";
 
     } else {
 
@@ -1416,39 +1450,39 @@ sub recursiveParse {
 
         # e.g.:
         #   if ([self.dirtyPropertySet containsObject:@"foo"])
-        #       [dictionary setObject:(self.foo ?
-        #                             [self.foo toUpdateDictionary] :
+        #       [dictionary setObject:(_foo ?
+        #                             [_foo toUpdateDictionary] :
         #                             [[JRFoo foo] toUpdateDictionary]) /* Use the default constructor to create an empty object */
         #                      forKey:@"foo"];
-        #   else if ([self.foo needsUpdate])
-        #       [dictionary setObject:[self.foo toUpdateDictionary]
+        #   else if ([_foo needsUpdate])
+        #       [dictionary setObject:[_foo toUpdateDictionary]
         #                      forKey:@"foo"];
         $toUpdateDictSection[3]  .= "\n    if ([self.dirtyPropertySet containsObject:\@\"" . $propertyName . "\"])\n";
-        $toUpdateDictSection[3]  .= "        [dictionary setObject:(self." . $propertyName . " ?\n" .
-                                    "                              [self." . $propertyName . " toUpdateDictionary] :\n" .
+        $toUpdateDictSection[3]  .= "        [dictionary setObject:(_" . $propertyName . " ?\n" .
+                                    "                              [_" . $propertyName . " toUpdateDictionary] :\n" .
                                     "                              [[JR" . ucfirst($propertyName) . " " . $propertyName . "] toUpdateDictionary]) /* Use the default constructor to create an empty object */\n" .
                                     "                       forKey:\@\"" . $dictionaryKey . "\"];\n" .
-                                    "    else if ([self." . $propertyName . " needsUpdate])\n" .
-                                    "        [dictionary setObject:[self." . $propertyName . " toUpdateDictionary]\n" .
+                                    "    else if ([_" . $propertyName . " needsUpdate])\n" .
+                                    "        [dictionary setObject:[_" . $propertyName . " toUpdateDictionary]\n" .
                                     "                       forKey:\@\"" . $dictionaryKey . "\"];\n";
 
         # e.g.:
-        #   [dictionary setObject:(self.foo ?
-        #                         [self.foo toReplaceDictionary] :
+        #   [dictionary setObject:(_foo ?
+        #                         [_foo toReplaceDictionary] :
         #                         [[JRFoo foo] toReplaceDictionary) /* Use the default constructor to create an empty object */
         #                  forKey:@"foo"];
-        $toReplaceDictSection[3] .= "\n    [dictionary setObject:(self." . $propertyName . " ?\n" .
-                                    "                          [self." . $propertyName . " toReplaceDictionary] :\n" .
+        $toReplaceDictSection[3] .= "\n    [dictionary setObject:(_" . $propertyName . " ?\n" .
+                                    "                          [_" . $propertyName . " toReplaceDictionary] :\n" .
                                     "                          [[JR" . ucfirst($propertyName) . " " . $propertyName . "] toUpdateDictionary]) /* Use the default constructor to create an empty object */\n" .
                                     "                   forKey:\@\"" . $dictionaryKey . "\"];\n";
 
         # e.g.:
-        #   if ([self.foo needsUpdate])
+        #   if ([_foo needsUpdate])
         #       return YES;
-        $needsUpdateSection[3]    .= "    if ([self." . $propertyName . " needsUpdate])\n        return YES;\n\n";
+        $needsUpdateSection[3]    .= "    if ([_" . $propertyName . " needsUpdate])\n        return YES;\n\n";
 
-        $dirtyPropertySection[9]  .= "    if (self." . $propertyName . ")\n" .
-                                     "        [snapshotDictionary setObject:[self.". $propertyName . " snapshotDictionaryFromDirtyPropertySet]\n" .
+        $dirtyPropertySection[9]  .= "    if (_" . $propertyName . ")\n" .
+                                     "        [snapshotDictionary setObject:[_" . $propertyName . " snapshotDictionaryFromDirtyPropertySet]\n" .
                                      "                               forKey:\@\"" . $propertyName . "\"];\n\n";
 
         $dirtyPropertySection[16] .= "\n    if ([snapshotDictionary objectForKey:\@\"" . $propertyName . "\"])\n" .
@@ -1467,15 +1501,24 @@ sub recursiveParse {
         ####################################################################################################
 
         # e.g.:
-        #   if (!self.bar && !otherExampleObject.bar) /* Keep going... */;
-        #   else if (!self.bar && [otherExampleObject.bar isEqualToBar:[JRBar bar]]) /* Keep going... */;
-        #   else if (!otherExampleObject.bar && [self.bar isEqualToBar:[JRBar bar]]) /* Keep going... */;
-        #   else if (![self.bar isEqualToOtherBarArray:otherExampleObject.bar]) return NO;
-        $isEqualObjectSection[3] .=
-              "    if (!self." . $propertyName . " && !other" . ucfirst($objectName) . "." . $propertyName . ") /* Keep going... */;\n" .
-              "    else if (!self." . $propertyName . " && [other" . ucfirst($objectName) . "." . $propertyName . " " . $isEqualMethod . "[JR" . ucfirst($propertyName) . " " . $propertyName . "]]) /* Keep going... */;\n" .
-              "    else if (!other" . ucfirst($objectName) . "." . $propertyName . " && [self." . $propertyName . " " . $isEqualMethod . "[JR" . ucfirst($propertyName) . " " . $propertyName . "]]) /* Keep going... */;\n" .
-              "    else if (![self." . $propertyName . " " . $isEqualMethod . "other" . ucfirst($objectName) . "." . $propertyName . "]) return NO;\n\n";
+        #   if (!_bar && !otherExampleObject->_bar) /* Keep going... */;
+        #   else if (!_bar && [otherExampleObject->_bar isEqualToBar:[JRBar bar]]) /* Keep going... */;
+        #   else if (!otherExampleObject->_bar && [_bar isEqualToBar:[JRBar bar]]) /* Keep going... */;
+        #   else if (![_bar isEqualToOtherBarArray:otherExampleObject->_bar]) return NO;
+        $isEqualObjectSection[9] .=
+              "    if (!_" . $propertyName . " && !other" . ucfirst($objectName) . "->_" . $propertyName . ") /* Keep going... */;\n" .
+              "    else if (!_" . $propertyName . " && [other" . ucfirst($objectName) . "->_" . $propertyName . " " . $isEqualMethod . "[JR" . ucfirst($propertyName) . " " . $propertyName . "]]) /* Keep going... */;\n" .
+              "    else if (!other" . ucfirst($objectName) . "->_" . $propertyName . " && [_" . $propertyName . " " . $isEqualMethod . "[JR" . ucfirst($propertyName) . " " . $propertyName . "]]) /* Keep going... */;\n" .
+              "    else if (![_" . $propertyName . " " . $isEqualMethod . "other" . ucfirst($objectName) . "->_" . $propertyName . "]) return NO;\n\n";
+
+        ####################################################################################################
+        # An empty sub-object hashes to 0, the same as a null one, so that the hash agrees with the loose
+        # comparison above
+        ####################################################################################################
+
+        # e.g.:
+        #   hash = hash * 31 + [_bar hash];
+        $isEqualObjectSection[18] .= "    hash = hash * 31 + [_" . $propertyName . " hash];\n";
 
         if ($subObjectCount == 1) {
           $needsUpdateDocSection[1]  = "\n *\n * \@note\n" .
@@ -1496,8 +1539,8 @@ sub recursiveParse {
       ####################################################################################################################
 
         # e.g.:
-        #   [dictionary setObject:(self.bar ? [self.bar arrayOfBarReplaceDictionariesFromBarObjects] : [NSArray array]) forKey:@"bar"];
-        $toReplaceDictSection[3] .= "\n    [dictionary setObject:(self." . $propertyName . " ?\n" .
+        #   [dictionary setObject:(_bar ? [_bar arrayOfBarReplaceDictionariesFromBarObjects] : [NSArray array]) forKey:@"bar"];
+        $toReplaceDictSection[3] .= "\n    [dictionary setObject:(_" . $propertyName . " ?\n" .
                                     "                          " . $toRplDictionary . " :\n" .
                                     "                          [NSArray array])\n" .
                                     "                   forKey:\@\"" . $dictionaryKey . "\"];\n";
@@ -1514,15 +1557,23 @@ sub recursiveParse {
         ####################################################################################################
 
         # e.g.:
-        #   if (!self.bar && !otherExampleObject.bar) /* Keep going... */;
-        #   else if (!self.bar && [otherExampleObject.bar count]) return NO;
-        #   else if (!otherExampleObject.bar && [self.bar count]) return NO;
-        #   else if (![self.bar isEqualToOtherBarArray:otherExampleObject.bar]) return NO;
-        $isEqualObjectSection[3] .=
-              "    if (!self." . $propertyName . " && !other" . ucfirst($objectName) . "." . $propertyName . ") /* Keep going... */;\n" .
-              "    else if (!self." . $propertyName . " && ![other" . ucfirst($objectName) . "." . $propertyName . " count]) /* Keep going... */;\n" .
-              "    else if (!other" . ucfirst($objectName) . "." . $propertyName . " && ![self." . $propertyName . " count]) /* Keep going... */;\n" .
-              "    else if (![self." . $propertyName . " " . $isEqualMethod . "other" . ucfirst($objectName) . "." . $propertyName . "]) return NO;\n\n";
+        #   if (!_bar && !otherExampleObject->_bar) /* Keep going... */;
+        #   else if (!_bar && [otherExampleObject->_bar count]) return NO;
+        #   else if (!otherExampleObject->_bar && [_bar count]) return NO;
+        #   else if (![_bar isEqualToOtherBarArray:otherExampleObject->_bar]) return NO;
+        $isEqualObjectSection[9] .=
+              "    if (!_" . $propertyName . " && !other" . ucfirst($objectName) . "->_" . $propertyName . ") /* Keep going... */;\n" .
+              "    else if (!_" . $propertyName . " && ![other" . ucfirst($objectName) . "->_" . $propertyName . " count]) /* Keep going... */;\n" .
+              "    else if (!other" . ucfirst($objectName) . "->_" . $propertyName . " && ![_" . $propertyName . " count]) /* Keep going... */;\n" .
+              "    else if (![_" . $propertyName . " " . $isEqualMethod . "other" . ucfirst($objectName) . "->_" . $propertyName . "]) return NO;\n\n";
+
+        ####################################################################################################
+        # Likewise, an empty array hashes to 0, the same as a null one
+        ####################################################################################################
+
+        # e.g.:
+        #   hash = hash * 31 + [_bar captureObjectElementsHash];
+        $isEqualObjectSection[18] .= "    hash = hash * 31 + [_" . $propertyName . ($isStringArray ? " hash" : " captureObjectElementsHash") . "];\n";
 
         if ($subArrayCount == 1) {
           if (!$hasPluralParent)
@@ -1552,24 +1603,28 @@ sub recursiveParse {
 
         # e.g.:
         #   if ([self.dirtyPropertySet containsObject:@"baz"])
-        #       [dictionary setObject:self.baz forKey:@"baz"];
+        #       [dictionary setObject:_baz forKey:@"baz"];
         $toUpdateDictSection[3]  .= "\n    if ([self.dirtyPropertySet containsObject:\@\"" . $propertyName . "\"])\n";
-        $toUpdateDictSection[3]  .= "        [dictionary setObject:(self." . $propertyName . " ? " . $toUpDictionary . " : [NSNull null]) forKey:\@\"" . $dictionaryKey . "\"];\n";
+        $toUpdateDictSection[3]  .= "        [dictionary setObject:(_" . $propertyName . " ? " . $toUpDictionary . " : [NSNull null]) forKey:\@\"" . $dictionaryKey . "\"];\n";
 
         # e.g.:
-        #   [dictionary setObject:(self.baz ? self.baz : [NSNull null]) forKey:@"baz"];
-        $toReplaceDictSection[3] .= "    [dictionary setObject:(self." . $propertyName . " ? " . $toRplDictionary . " : [NSNull null]) forKey:\@\"" . $dictionaryKey . "\"];\n";
+        #   [dictionary setObject:(_baz ? _baz : [NSNull null]) forKey:@"baz"];
+        $toReplaceDictSection[3] .= "    [dictionary setObject:(_" . $propertyName . " ? " . $toRplDictionary . " : [NSNull null]) forKey:\@\"" . $dictionaryKey . "\"];\n";
 
         # e.g.:
-        #   if ((self.foo == nil) ^ (otherExampleObject.foo == nil)) // xor
+        #   if ((_foo == nil) ^ (otherExampleObject->_foo == nil)) // xor
         #       return NO;
         #
-        #   if (![self.foo isEqualToString:otherExampleObject.foo])
+        #   if (![_foo isEqualToString:otherExampleObject->_foo])
         #       return NO;
-        $isEqualObjectSection[3] .=
-              "    if (!self." . $propertyName . " && !other" . ucfirst($objectName) . "." . $propertyName . ") /* Keep going... */;\n" .
-              "    else if ((self." . $propertyName . " == nil) ^ (other" . ucfirst($objectName) . "." . $propertyName . " == nil)) return NO; // xor\n" .
-              "    else if (![self." . $propertyName . " " . $isEqualMethod . "other" . ucfirst($objectName) . "." . $propertyName . "]) return NO;\n\n";
+        $isEqualObjectSection[9] .=
+              "    if (!_" . $propertyName . " && !other" . ucfirst($objectName) . "->_" . $propertyName . ") /* Keep going... */;\n" .
+              "    else if ((_" . $propertyName . " == nil) ^ (other" . ucfirst($objectName) . "->_" . $propertyName . " == nil)) return NO; // xor\n" .
+              "    else if (![_" . $propertyName . " " . $isEqualMethod . "other" . ucfirst($objectName) . "->_" . $propertyName . "]) return NO;\n\n";
+
+        # e.g.:
+        #   hash = hash * 31 + [_foo hash];
+        $isEqualObjectSection[18] .= "    hash = hash * 31 + [_" . $propertyName . " hash];\n";
 
       }
 
@@ -1764,6 +1819,13 @@ sub recursiveParse {
     }
   }
 
+  ##########################################################################
+  # Add the copy constructor...
+  ##########################################################################
+  for (my $i = 0; $i < @copyConstructorSection; $i++) {
+    $mFile .= $copyConstructorSection[$i];
+  }
+
   ##########################################################################
   # Loop through the rest of our methods, and add '@end'
   ##########################################################################
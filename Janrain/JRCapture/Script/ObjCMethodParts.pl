@@ -233,19 +233,42 @@ my @classConstructorParts = (
 
 
 ###################################################################
-# COPY CONSTRUCTOR (W REQUIRED PROPERTIES)
+# COPY CONSTRUCTOR
+#
+# The copy shares the property values with the original. Values
+# that can't be changed (strings, numbers, dates, etc.) are just
+# shared, while sub-objects and plurals are shared copy-on-write:
+# the original keeps them, and the copy gets its own when either
+# side is about to change them (see JRCaptureObject#copyWithZone:).
 #
 # - (id)copyWithZone:(NSZone*)zone
 # {
-#     <className> *<object>Copy = (<className> *)[JRCaptureObject copy];
+#     <className> *<object>Copy = (<className> *)[super copyWithZone:zone];
 #
-#     <object>Copy.<property> = self.<property>;
+#     <object>Copy->_<property> = _<property>;
 #       ...
 #
-#     <object>Copy.canBeUpdatedOnCapture = self.canBeUpdatedOnCapture;
-#
 #     return <object>Copy;
 # }
+#
+# - (NSSet *)copyOnWritePropertySet
+# {
+#     return [NSSet setWithObjects:@"<objectProperty1>", @"<pluralProperty1>", ... , nil];
+# }
+#
+# - (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+# {
+#     if ([propertyName isEqualToString:@"<objectProperty1>"]) return _<objectProperty1>;
+#       ...
+#
+#     return nil;
+# }
+#
+# - (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+# {
+#     if ([propertyName isEqualToString:@"<objectProperty1>"]) _<objectProperty1> = value;
+#       ...
+# }
 ###################################################################
 
 my @copyConstructorParts = (
@@ -254,7 +277,18 @@ my @copyConstructorParts = (
 "","[super copyWithZone:zone];\n\n",
 "",
 "\n    return ","",";",
-"\n}\n\n");
+"\n}\n\n",
+"- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:","","nil];
+}\n\n",
+"- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{\n","",
+"\n    return nil;
+}\n\n",
+"- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{\n","",
+"}\n\n");
 
 
 ###################################################################
@@ -666,6 +700,7 @@ my @dirtyPropertySnapshotParts = (
 }\n\n",
 "- (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];\n",
 "",
 "\n}\n\n",
@@ -680,6 +715,8 @@ my @dirtyPropertySnapshotParts = (
 }\n\n",
 "- (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:\@\"","","\"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:\@\"","","\"] allObjects]];\n",
 "",
@@ -825,6 +862,8 @@ my @toReplaceDictionaryParts = (
 #  **/
 # - (BOOL)isEqualTo<objectName>:<className>other<objectName>
 # {
+#     if ([self hash] != [other<objectName> hash]) return NO;
+#
 #     if (!self.<objectProperty> && !other<objectName>.<objectProperty>) /* Keep going... */;
 #     else if ((self.<objectProperty> == nil) ^ (other<objectName>.<objectProperty> == nil)) return NO; // xor
 #     else if (![self.<objectProperty> isEqualTo<propertyObject>:other<objectName>.<objectProperty>]) return NO;
@@ -832,6 +871,24 @@ my @toReplaceDictionaryParts = (
 #
 #     return YES;
 # }
+#
+# - (BOOL)isEqual:(id)object
+# {
+#     if (object == self) return YES;
+#     if (![object isKindOfClass:[<className> class]]) return NO;
+#
+#     return [self isEqualTo<objectName>:object];
+# }
+#
+# - (NSUInteger)contentHash
+# {
+#     NSUInteger hash = 0;
+#
+#     hash = hash * 31 + [_<objectProperty> hash];
+#       ...
+#
+#     return hash;
+# }
 ###################################################################
 
 my @isEqualObjectDocParts = (
@@ -844,9 +901,23 @@ my @isEqualObjectParts = (
 "\n{\n",
 #"    if (![self.captureObjectPath isEqualToString:other","",".captureObjectPath])
 #         return NO;\n\n",
+"    if (!other","",") return NO;\n",
+"    if ([self hash] != [other",""," hash]) return NO;\n\n",
 "",
 "    return YES;",
-"\n}\n\n");
+"\n}\n\n",
+"- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[",""," class]]) return NO;
+
+    return [self isEqualTo","",":object];
+}\n\n",
+"- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;\n\n","",
+"\n    return hash;
+}\n\n");
 
 
 ###################################################################
@@ -1122,25 +1193,38 @@ sub createGetterSetterForProperty {
   my $primitiveGetter = "";
   my $primitiveSetter = "";
 
+  # Sub-objects and plurals of objects are shared copy-on-write with any copies of this object
+  my $isCopyOnWrite = $isObject || ($isArray && $propertyType ne "JRStringArray *");
+
   $getter = "- (" . $propertyType . ")" . $propertyName;
 
   $getter .= "\n{\n";
+  if ($isCopyOnWrite) {
+    $getter .= "    if ([self.sharedPropertySet containsObject:@\"" . $propertyName . "\"])\n";
+    $getter .= "        [self unshareProperty:@\"" . $propertyName . "\"];\n\n";
+  }
   $getter .= "    return _" . $propertyName . ";";
   $getter .= "\n}\n\n";
 
   $setter .= "- (void)set". ucfirst($propertyName) . ":(" . $propertyType . ")new" . ucfirst($propertyName);
   $setter .= "\n{\n";
 
+  $setter .= "    [self willChangeProperty:@\"" . $propertyName . "\"];\n";
+
 #  if ($isArray) {
 #    $setter .= "    [self.dirtyArraySet addObject:@\"" . $propertyName . "\"];\n\n";
 #  } else {
   if (!$isArray) {
-    $setter .= "    [self.dirtyPropertySet addObject:@\"" . $propertyName . "\"];\n\n";
+    $setter .= "    [self.dirtyPropertySet addObject:@\"" . $propertyName . "\"];\n";
   }
 
+  $setter .= "\n";
+
   if ($isObject) {
-    $setter .= "    _" . $propertyName . " = new" . ucfirst($propertyName) . ";\n\n";
+    $setter .= "    _" . $propertyName . " = [self claimValue:new" . ucfirst($propertyName) . " forProperty:@\"" . $propertyName . "\"];\n\n";
     $setter .= "    [_" . $propertyName . " setAllPropertiesToDirty];"
+  } elsif ($isCopyOnWrite) {
+    $setter .= "    _" . $propertyName . " = [self claimValue:[new" . ucfirst($propertyName) . " copy] forProperty:@\"" . $propertyName . "\"];";
   } else {
     $setter .= "    _" . $propertyName . " = [new" . ucfirst($propertyName) . " copy];";
   }
@@ -1156,6 +1240,7 @@ sub createGetterSetterForProperty {
 
     $primitiveSetter .= "- (void)set" . ucfirst($propertyName) . "WithBool:(BOOL)boolVal";
     $primitiveSetter .= "\n{\n";
+    $primitiveSetter .= "    [self willChangeProperty:@\"" . $propertyName . "\"];\n";
     $primitiveSetter .= "    [self.dirtyPropertySet addObject:@\"" . $propertyName . "\"];\n\n";
 
     $primitiveSetter .= "    _" . $propertyName .  " = [NSNumber numberWithBool:boolVal];";
@@ -1170,6 +1255,7 @@ sub createGetterSetterForProperty {
 
     $primitiveSetter .= "- (void)set" . ucfirst($propertyName) . "WithInteger:(NSInteger)integerVal";
     $primitiveSetter .= "\n{\n";
+    $primitiveSetter .= "    [self willChangeProperty:@\"" . $propertyName . "\"];\n";
     $primitiveSetter .= "    [self.dirtyPropertySet addObject:@\"" . $propertyName . "\"];\n\n";
 
     $primitiveSetter .= "    _" . $propertyName .  " = [NSNumber numberWithInteger:integerVal];";
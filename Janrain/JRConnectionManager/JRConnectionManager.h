@@ -35,6 +35,10 @@
 
 #import <Foundation/Foundation.h>
 #import <UIKit/UIKit.h>
+#import "JRRequestScheduler.h"
+#import "JRRequestMetrics.h"
+
+@class JRRetryPolicy;
 
 @interface NSString (JRString_UrlEscaping)
 - (NSString *)stringByAddingUrlPercentEscapes;
@@ -72,6 +76,27 @@
                  returnFullResponse:(BOOL)returnFullResponse
                             withTag:(id)userData;
 
+/**
+ * Transient failures are retried according to the retry policy before the delegate hears about them. The variants
+ * without a retry policy use JRRetryPolicy#defaultPolicy.
+ **/
++ (bool)createConnectionFromRequest:(NSURLRequest *)request
+                        forDelegate:(id <JRConnectionManagerDelegate>)delegate
+                 returnFullResponse:(BOOL)returnFullResponse
+                            withTag:(id)userData
+                        retryPolicy:(JRRetryPolicy *)retryPolicy;
+
+/**
+ * Critical requests start right away; background ones wait for the sign-in critical path to go idle. The variants
+ * without a priority use JRConnectionPriorityNormal.
+ **/
++ (bool)createConnectionFromRequest:(NSURLRequest *)request
+                        forDelegate:(id <JRConnectionManagerDelegate>)delegate
+                 returnFullResponse:(BOOL)returnFullResponse
+                            withTag:(id)userData
+                        retryPolicy:(JRRetryPolicy *)retryPolicy
+                           priority:(JRConnectionPriority)priority;
+
 + (void)stopConnectionsForDelegate:(id <JRConnectionManagerDelegate>)delegate;
 
 + (NSUInteger)openConnections;
@@ -79,5 +104,85 @@
 + (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params
        completionHandler:(void (^)(id, NSError *))handler;
 
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params retryPolicy:(JRRetryPolicy *)retryPolicy
+       completionHandler:(void (^)(id, NSError *))handler;
+
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params retryPolicy:(JRRetryPolicy *)retryPolicy
+                priority:(JRConnectionPriority)priority completionHandler:(void (^)(id, NSError *))handler;
+
 + (void)startURLConnectionWithRequest:(NSURLRequest *)request completionHandler:(void (^)(id parsedResponse, NSError *e))handler;
+
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                    completionHandler:(void (^)(id parsedResponse, NSError *e))handler;
+
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                             priority:(JRConnectionPriority)priority
+                    completionHandler:(void (^)(id parsedResponse, NSError *e))handler;
+
+/**
+ * Hands back the raw response of the last attempt, on the main queue
+ **/
++ (void)startDataTaskWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+               completionHandler:(void (^)(NSData *data, NSURLResponse *response, NSError *e))handler;
+
++ (void)startDataTaskWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                        priority:(JRConnectionPriority)priority
+               completionHandler:(void (^)(NSData *data, NSURLResponse *response, NSError *e))handler;
+
+/**
+ * Parses the body as it downloads, see JRIncrementalJsonParser, and hands back the parsed JSON of the last attempt, on
+ * the main queue. If there's no error but the body wasn't valid JSON, parsedResponse is the NSError saying why.
+ **/
++ (void)startJsonTaskWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                        priority:(JRConnectionPriority)priority
+               completionHandler:(void (^)(id parsedResponse, NSURLResponse *response, NSError *e))handler;
+
+/**
+ * Number of retries made, and number of requests that were still failing when their policy ran out of attempts
+ **/
++ (NSUInteger)retryCount;
+
++ (NSUInteger)retryGiveUpCount;
+
++ (void)resetRetryCounters;
+
+/**
+ * Caps how many background requests run at once; defaults to 2
+ **/
++ (void)setMaxConcurrentBackgroundRequests:(NSUInteger)maxConcurrentBackgroundRequests;
+
+/**
+ * See JRRequestScheduler#queueingDelaySnapshot
+ **/
++ (NSDictionary *)queueingDelaySnapshot;
+
++ (void)resetQueueingDelays;
+
+/**
+ * Observers are held weakly and told about every completed request, see JRRequestMetricsObserver
+ **/
++ (void)addMetricsObserver:(id <JRRequestMetricsObserver>)observer;
+
++ (void)removeMetricsObserver:(id <JRRequestMetricsObserver>)observer;
+
+/**
+ * See JRRequestMetricsCollector#histogramSnapshot
+ **/
++ (NSDictionary *)metricsHistogramSnapshot;
+
++ (void)resetMetricsHistograms;
+
+/**
+ * Replaces the configuration of the session all requests are made on, e.g. to route them through a custom
+ * NSURLProtocol
+ **/
++ (void)setSessionConfiguration:(NSURLSessionConfiguration *)configuration;
+
+/**
+ * Opens connections ahead of the first request to a host, see JRPreconnector. Off by default; while it's off
+ * preconnectToUrl: only remembers the host, and it's warmed when preconnecting is turned on.
+ **/
++ (void)setPreconnectEnabled:(BOOL)enabled;
+
++ (void)preconnectToUrl:(NSString *)url;
 @end
@@ -40,6 +40,13 @@
 #import "JRWebViewController.h"
 #import "JRSessionData.h"
 #import "JRJsonUtils.h"
+#import "JRRetryPolicy.h"
+#import "JRRequestScheduler.h"
+#import "JRRequestMetrics.h"
+#import "JRPreconnector.h"
+#import "JRRequestBodyEncoder.h"
+#import "JRURLSessionDelegate.h"
+#import "JRTracer.h"
 
 @implementation NSString (JRString_UrlEscaping)
 - (NSString *)stringByAddingUrlPercentEscapes
@@ -82,6 +89,7 @@
 @property(readonly) BOOL            returnFullResponse;
 @property(readonly) id <JRConnectionManagerDelegate> delegate;
 @property           NSURLSessionTask *task;
+@property           JRRetryPolicy   *retryPolicy;
 
 @end
 
@@ -98,6 +106,7 @@
     objectCopy->_returnFullResponse = self.returnFullResponse;
     objectCopy->_delegate   = self.delegate;
     objectCopy->_task         = self.task;
+    objectCopy.retryPolicy  = self.retryPolicy;
     return objectCopy;
 }
 
@@ -132,6 +141,13 @@
  **/
 @interface JRConnectionManager()
 @property NSMutableArray *connectionBuffers;
+@property NSUInteger retryCount;
+@property NSUInteger retryGiveUpCount;
+@property JRRequestScheduler *scheduler;
+@property JRRequestMetricsCollector *metricsCollector;
+@property JRURLSessionDelegate *sessionDelegate;
+@property NSURLSession *session;
+@property JRPreconnector *preconnector;
 @end
 
 
@@ -191,44 +207,73 @@ static JRConnectionManager *singleton = nil;
                  returnFullResponse:(BOOL)returnFullResponse
                             withTag:(id)userData
 {
-    NSString *body = [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding];
-    DLog(@"request to '%@' with body: '%@'", [[request URL] absoluteString], body);
+    return [JRConnectionManager createConnectionFromRequest:request forDelegate:delegate
+                                         returnFullResponse:returnFullResponse withTag:userData
+                                                retryPolicy:[JRRetryPolicy defaultPolicy]];
+}
+
++ (bool)createConnectionFromRequest:(NSURLRequest *)request
+                        forDelegate:(id <JRConnectionManagerDelegate>)delegate
+                 returnFullResponse:(BOOL)returnFullResponse
+                            withTag:(id)userData
+                        retryPolicy:(JRRetryPolicy *)retryPolicy
+{
+    return [JRConnectionManager createConnectionFromRequest:request forDelegate:delegate
+                                         returnFullResponse:returnFullResponse withTag:userData
+                                                retryPolicy:retryPolicy priority:JRConnectionPriorityNormal];
+}
+
++ (bool)createConnectionFromRequest:(NSURLRequest *)request
+                        forDelegate:(id <JRConnectionManagerDelegate>)delegate
+                 returnFullResponse:(BOOL)returnFullResponse
+                            withTag:(id)userData
+                        retryPolicy:(JRRetryPolicy *)retryPolicy
+                           priority:(JRConnectionPriority)priority
+{
+    DLog(@"request to '%@' with body: '%@'", [[request URL] absoluteString], JRLogRedactedPayload([request HTTPBody]));
 
-    __block JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
+    JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
     NSMutableArray *connectionBuffers = [connectionManager connectionBuffers];
 
     if (![NSURLConnection canHandleRequest:request])
         return NO;
 
-    __block NSURLSessionTask *task = [[NSURLSession sharedSession] dataTaskWithRequest:request completionHandler:^(NSData * _Nullable data, NSURLResponse * _Nullable response, NSError * _Nullable error) {
-        dispatch_async(dispatch_get_main_queue(), ^{
-        ConnectionData *connectionData = [JRConnectionManager getConnectionDataFromTask:task];
+    ConnectionData *connectionData = [[ConnectionData alloc] initWithRequest:request
+                                                                 forDelegate:delegate
+                                                              withTask:nil
+                                                          returnFullResponse:returnFullResponse
+                                                                     withTag:userData];
+    connectionData.retryPolicy = retryPolicy;
+
+    /* Once the connection is stopped it's no longer in the buffers, and any retry that's still pending is dropped */
+    BOOL (^isStopped)(void) = ^BOOL {
+        return ![[connectionManager connectionBuffers] containsObject:connectionData];
+    };
+
+    connectionData.task = [connectionManager resumeTaskWithRequest:request retryPolicy:retryPolicy
+                                                          priority:priority parseJson:NO attempt:1
+                                                         isStopped:isStopped
+                                                       onRetryTask:^(NSURLSessionTask *retryTask) {
+                                                           connectionData.task = retryTask;
+                                                       }
+                                                 completionHandler:^(NSData *data, NSURLResponse *response,
+                                                                     NSError *error) {
         if (connectionData.returnFullResponse) {
             connectionData.fullResponse = response;
         }
         connectionData.response = [NSMutableData dataWithData:data];
 
-            if (error) {
-                [connectionManager taskDidFailWithError:error forConnectionData:connectionData];
-            } else {
-                [connectionManager taskDidFinishLoadingWith:connectionData];
-            }
-
-
-        });
-
+        if (error) {
+            [connectionManager taskDidFailWithError:error forConnectionData:connectionData];
+        } else {
+            [connectionManager taskDidFinishLoadingWith:connectionData];
+        }
     }];
 
-    if (!task)
+    if (!connectionData.task)
         return NO;
 
-    ConnectionData *connectionData = [[ConnectionData alloc] initWithRequest:request
-                                                                 forDelegate:delegate
-                                                              withTask:task
-                                                          returnFullResponse:returnFullResponse
-                                                                     withTag:userData];
     [connectionBuffers addObject:connectionData];
-    [task resume];
     [connectionManager startActivity];
 
     return YES;
@@ -266,53 +311,323 @@ static JRConnectionManager *singleton = nil;
 
 + (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params
      completionHandler:(void(^)(id parsedResponse, NSError *e))handler
+{
+    [JRConnectionManager jsonRequestToUrl:url params:params retryPolicy:[JRRetryPolicy defaultPolicy]
+                        completionHandler:handler];
+}
+
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params retryPolicy:(JRRetryPolicy *)retryPolicy
+       completionHandler:(void(^)(id parsedResponse, NSError *e))handler
+{
+    [JRConnectionManager jsonRequestToUrl:url params:params retryPolicy:retryPolicy
+                                 priority:JRConnectionPriorityNormal completionHandler:handler];
+}
+
++ (void)jsonRequestToUrl:(NSString *)url params:(NSDictionary *)params retryPolicy:(JRRetryPolicy *)retryPolicy
+                priority:(JRConnectionPriority)priority completionHandler:(void(^)(id parsedResponse, NSError *e))handler
 {
     DLog(@"url=%@", url);
     NSURLRequest *request = [NSMutableURLRequest JR_requestWithURL:[NSURL URLWithString:url] params:params];
-    [JRConnectionManager startURLConnectionWithRequest:request completionHandler:handler];
+    [JRConnectionManager startURLConnectionWithRequest:request retryPolicy:retryPolicy priority:priority
+                                     completionHandler:handler];
 }
 
 + (void)startURLConnectionWithRequest:(NSURLRequest *)request
                     completionHandler:(void(^)(id parsedResponse, NSError *e))handler
 {
-    NSString *p = [[NSString alloc] initWithData:[request HTTPBody] encoding:NSUTF8StringEncoding];
-    NSString *url = [request.URL absoluteString];
-    DLog(@"URL: \"%@\" params: \"%@\"", url, p);
+    [JRConnectionManager startURLConnectionWithRequest:request retryPolicy:[JRRetryPolicy defaultPolicy]
+                                     completionHandler:handler];
+}
 
-    NSURLSessionTask *task = [[NSURLSession sharedSession] dataTaskWithRequest:request completionHandler:^(NSData * _Nullable data, NSURLResponse * _Nullable response, NSError * _Nullable e) {
-        dispatch_async(dispatch_get_main_queue(), ^{
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                    completionHandler:(void(^)(id parsedResponse, NSError *e))handler
+{
+    [JRConnectionManager startURLConnectionWithRequest:request retryPolicy:retryPolicy
+                                              priority:JRConnectionPriorityNormal completionHandler:handler];
+}
+
++ (void)startURLConnectionWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                             priority:(JRConnectionPriority)priority
+                    completionHandler:(void(^)(id parsedResponse, NSError *e))handler
+{
+    DLog(@"URL: \"%@\" params: \"%@\"", [request.URL absoluteString], JRLogRedactedPayload([request HTTPBody]));
+
+    [JRConnectionManager startJsonTaskWithRequest:request retryPolicy:retryPolicy priority:priority
+                                completionHandler:^(id parsedJson, NSURLResponse *response, NSError *e) {
             if (e) {
-                ALog(@"Error fetching JSON: %@", e);
+                JRLogError(@"Error fetching JSON: %@", e);
+                handler(nil, e);
+            }else if ([parsedJson isKindOfClass:[NSError class]]) {
+                JRLogError(@"Parse err: \"%@\"", parsedJson);
                 handler(nil, e);
-            }else {
-                NSString *bodyString =
-                [[NSString alloc] initWithData:data
-                                      encoding:NSUTF8StringEncoding];
-                NSError *err = nil;
-                id parsedJson = [NSJSONSerialization JSONObjectWithData:data
-                                                                options:(NSJSONReadingOptions) 0
-                                                                  error:&err];
-                ALog(@"Fetched: \"%@\"", bodyString);
-                if (err) {
-                    ALog(@"Parse err: \"%@\"", err);
-                    handler(nil, e);
-                }
-                else{
-                    handler(parsedJson, nil);
-                }
             }
-        });
+            else{
+                DLog(@"Fetched: \"%@\"", JRLogRedactedPayload(parsedJson));
+                handler(parsedJson, nil);
+            }
     }];
+}
+
++ (void)startJsonTaskWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                        priority:(JRConnectionPriority)priority
+               completionHandler:(void(^)(id parsedResponse, NSURLResponse *response, NSError *e))handler
+{
+    [[JRConnectionManager getJRConnectionManager] resumeTaskWithRequest:request retryPolicy:retryPolicy
+                                                               priority:priority parseJson:YES attempt:1
+                                                              isStopped:nil onRetryTask:nil
+                                                      completionHandler:handler];
+}
 
-    [task resume];
++ (void)startDataTaskWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+               completionHandler:(void(^)(NSData *data, NSURLResponse *response, NSError *e))handler
+{
+    [JRConnectionManager startDataTaskWithRequest:request retryPolicy:retryPolicy priority:JRConnectionPriorityNormal
+                                completionHandler:handler];
+}
+
++ (void)startDataTaskWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                        priority:(JRConnectionPriority)priority
+               completionHandler:(void(^)(NSData *data, NSURLResponse *response, NSError *e))handler
+{
+    [[JRConnectionManager getJRConnectionManager] resumeTaskWithRequest:request retryPolicy:retryPolicy
+                                                               priority:priority parseJson:NO attempt:1
+                                                              isStopped:nil onRetryTask:nil
+                                                      completionHandler:handler];
+}
+
++ (NSUInteger)retryCount
+{
+    return [[JRConnectionManager getJRConnectionManager] retryCount];
+}
+
++ (NSUInteger)retryGiveUpCount
+{
+    return [[JRConnectionManager getJRConnectionManager] retryGiveUpCount];
+}
+
++ (void)resetRetryCounters
+{
+    JRConnectionManager *connectionManager = [JRConnectionManager getJRConnectionManager];
+    connectionManager.retryCount = 0;
+    connectionManager.retryGiveUpCount = 0;
+}
+
++ (void)setMaxConcurrentBackgroundRequests:(NSUInteger)maxConcurrentBackgroundRequests
+{
+    [[[JRConnectionManager getJRConnectionManager] scheduler]
+            setMaxConcurrentBackgroundTasks:MAX(maxConcurrentBackgroundRequests, 1)];
 }
 
++ (NSDictionary *)queueingDelaySnapshot
+{
+    return [[[JRConnectionManager getJRConnectionManager] scheduler] queueingDelaySnapshot];
+}
+
++ (void)resetQueueingDelays
+{
+    [[[JRConnectionManager getJRConnectionManager] scheduler] resetQueueingDelays];
+}
+
++ (void)addMetricsObserver:(id <JRRequestMetricsObserver>)observer
+{
+    [[[JRConnectionManager getJRConnectionManager] metricsCollector] addObserver:observer];
+}
+
++ (void)removeMetricsObserver:(id <JRRequestMetricsObserver>)observer
+{
+    [[[JRConnectionManager getJRConnectionManager] metricsCollector] removeObserver:observer];
+}
+
++ (NSDictionary *)metricsHistogramSnapshot
+{
+    return [[[JRConnectionManager getJRConnectionManager] metricsCollector] histogramSnapshot];
+}
+
++ (void)resetMetricsHistograms
+{
+    [[[JRConnectionManager getJRConnectionManager] metricsCollector] resetHistograms];
+}
+
++ (void)setSessionConfiguration:(NSURLSessionConfiguration *)configuration
+{
+    [[JRConnectionManager getJRConnectionManager] setSessionConfiguration:configuration];
+}
+
+- (void)setSessionConfiguration:(NSURLSessionConfiguration *)configuration
+{
+    /* Requests already running on the old session are left to finish */
+    [self.session finishTasksAndInvalidate];
+
+    /* The delegate picks up the task metrics, and the bodies of JSON tasks as they arrive */
+    self.session = [NSURLSession sessionWithConfiguration:configuration delegate:self.sessionDelegate
+                                            delegateQueue:nil];
+    self.preconnector.session = self.session;
+}
+
++ (void)setPreconnectEnabled:(BOOL)enabled
+{
+    dispatch_block_t block = ^{
+        [[[JRConnectionManager getJRConnectionManager] preconnector] setEnabled:enabled];
+    };
+
+    if ([NSThread isMainThread]) block();
+    else dispatch_async(dispatch_get_main_queue(), block);
+}
+
++ (void)preconnectToUrl:(NSString *)url
+{
+    if (![url length]) return;
+
+    dispatch_block_t block = ^{
+        [[[JRConnectionManager getJRConnectionManager] preconnector] addUrl:[NSURL URLWithString:url]];
+    };
+
+    if ([NSThread isMainThread]) block();
+    else dispatch_async(dispatch_get_main_queue(), block);
+}
+
+/* Hands the request to the scheduler, and retries it as the policy allows. The handler is called on the main queue
+   with the outcome of the last attempt; it isn't called at all if isStopped returns YES first. The body is the
+   response's NSData, or with parseJson the JSON parsed as it downloaded, or the NSError saying why it couldn't be.
+   A parse error isn't passed as the error, so that the policy still gets to retry e.g. a 503 with an HTML body. */
+- (NSURLSessionTask *)resumeTaskWithRequest:(NSURLRequest *)request retryPolicy:(JRRetryPolicy *)retryPolicy
+                                   priority:(JRConnectionPriority)priority parseJson:(BOOL)parseJson
+                                    attempt:(NSUInteger)attempt
+                                  isStopped:(BOOL (^)(void))isStopped
+                                onRetryTask:(void (^)(NSURLSessionTask *retryTask))onRetryTask
+                          completionHandler:(void (^)(id body, NSURLResponse *response, NSError *error))handler
+{
+    JRTracer *tracer = [JRTracer sharedTracer];
+    if (attempt == 1 && [NSThread isMainThread] && [tracer currentCorrelationId])
+    {
+        /* The id only goes to Janrain, not e.g. to the application's token URL */
+        if ([tracer shouldCorrelateRequestToUrl:[request URL]])
+        {
+            NSMutableURLRequest *tracedRequest = [request mutableCopy];
+            [tracedRequest setValue:[tracer currentCorrelationId] forHTTPHeaderField:JRTracerCorrelationIdHeader];
+            request = tracedRequest;
+        }
+
+        /* One span covers all the attempts, and it ends when the caller hears back */
+        JRTraceSpan *span = [tracer startAsyncSpanWithName:[@"http." stringByAppendingString:[request JR_operationName]]];
+        void (^untracedHandler)(id, NSURLResponse *, NSError *) = handler;
+        handler = ^(id body, NSURLResponse *response, NSError *error) {
+            if ([response isKindOfClass:[NSHTTPURLResponse class]])
+                [span setAttribute:[NSNumber numberWithInteger:[(NSHTTPURLResponse *) response statusCode]]
+                            forKey:@"status_code"];
+            [span setAttribute:[error localizedDescription] forKey:@"error"];
+            [span end];
+            untracedHandler(body, response, error);
+        };
+    }
+
+    __block NSURLSessionTask *task = nil;
+    void (^taskDidComplete)(id, NSURLResponse *, NSError *) = ^(id body, NSURLResponse *response, NSError *error) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            BOOL stopped = isStopped && isStopped();
+
+            /* An endpoint that refused an encoded body gets the plain one straight away, as the next attempt */
+            NSURLRequest *fallbackRequest = stopped ? nil :
+                    [[JRRequestBodyEncoder sharedEncoder] fallbackRequestForRequest:request response:response
+                                                                                body:body];
+            BOOL willRetry = !stopped && !fallbackRequest &&
+                    [retryPolicy shouldRetryRequest:request response:response error:error attempt:attempt];
+
+            /* Until the next attempt is scheduled the request has no task, but it's still pending; for a critical
+               request that keeps background work from starting during the backoff */
+            if (fallbackRequest || willRetry)
+                [self.scheduler beginRetryWithPriority:priority];
+            [self.scheduler taskDidComplete:task];
+
+            if (stopped)
+                return;
+
+            if (fallbackRequest)
+            {
+                NSURLSessionTask *retryTask = [self resumeTaskWithRequest:fallbackRequest retryPolicy:retryPolicy
+                                                                 priority:priority parseJson:parseJson
+                                                                  attempt:attempt + 1 isStopped:isStopped
+                                                              onRetryTask:onRetryTask
+                                                        completionHandler:handler];
+                [self.scheduler endRetryWithPriority:priority];
+                if (onRetryTask) onRetryTask(retryTask);
+                return;
+            }
+
+            if (willRetry)
+            {
+                NSTimeInterval delay = [retryPolicy delayBeforeRetryAfterAttempt:attempt];
+                DLog(@"retrying '%@' in %f seconds (attempt %lu)", [[request URL] absoluteString], delay,
+                     (unsigned long) attempt + 1);
+
+                self.retryCount++;
+
+                dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (delay * NSEC_PER_SEC)),
+                               dispatch_get_main_queue(), ^{
+                    if (isStopped && isStopped())
+                    {
+                        [self.scheduler endRetryWithPriority:priority];
+                        return;
+                    }
+
+                    NSURLSessionTask *retryTask = [self resumeTaskWithRequest:request retryPolicy:retryPolicy
+                                                                     priority:priority parseJson:parseJson
+                                                                      attempt:attempt + 1 isStopped:isStopped
+                                                                  onRetryTask:onRetryTask
+                                                            completionHandler:handler];
+                    [self.scheduler endRetryWithPriority:priority];
+                    if (onRetryTask) onRetryTask(retryTask);
+                });
+
+                return;
+            }
+
+            if (retryPolicy.maxAttempts > 1 &&
+                    [retryPolicy isRetryableFailureOfRequest:request response:response error:error])
+            {
+                ALog(@"giving up on '%@' after %lu attempts", [[request URL] absoluteString], (unsigned long) attempt);
+                self.retryGiveUpCount++;
+            }
+
+            handler(body, response, error);
+        });
+    };
+
+    if (parseJson)
+    {
+        task = [self.session dataTaskWithRequest:request];
+        [self.sessionDelegate parseJsonOfTask:task completionHandler:^(id parsedJson, NSError *parseError,
+                                                                       NSURLResponse *response, NSError *error) {
+            taskDidComplete(parseError ? parseError : parsedJson, response, error);
+        }];
+    }
+    else
+    {
+        task = [self.session dataTaskWithRequest:request completionHandler:^(NSData * _Nullable data, NSURLResponse * _Nullable response, NSError * _Nullable error) {
+            taskDidComplete(data, response, error);
+        }];
+    }
+
+    if ([NSThread isMainThread])
+        [self.scheduler scheduleTask:task withPriority:priority];
+    else
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self.scheduler scheduleTask:task withPriority:priority];
+        });
+
+    return task;
+}
 
 - (JRConnectionManager *)init
 {
     if ((self = [super init]))
     {
         _connectionBuffers = [[NSMutableArray alloc] init];
+        _scheduler = [[JRRequestScheduler alloc] init];
+        _metricsCollector = [[JRRequestMetricsCollector alloc] init];
+        _sessionDelegate = [[JRURLSessionDelegate alloc] initWithMetricsCollector:_metricsCollector];
+        [self setSessionConfiguration:[NSURLSessionConfiguration defaultSessionConfiguration]];
+        _preconnector = [[JRPreconnector alloc] initWithSession:_session];
     }
 
     return self;
@@ -374,7 +689,7 @@ static JRConnectionManager *singleton = nil;
         if (![connectionData fullResponse])
     {
         NSString *payload = [[NSString alloc] initWithData:responseBody encoding:encoding];
-        NSLog(@"PAYLOAD!: %@", payload);
+        DLog(@"payload: %@", JRLogRedactedPayload(payload));
 
         if ([delegate respondsToSelector:@selector(connectionDidFinishLoadingWithPayload:request:andTag:)])
             [delegate connectionDidFinishLoadingWithPayload:payload request:request andTag:userData];
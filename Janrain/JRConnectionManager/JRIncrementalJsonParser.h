@@ -0,0 +1,70 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * A push parser for UTF-8 JSON: bytes are handed over in whatever pieces they arrive in and parsed straight away,
+ * so a response can be parsed while it downloads rather than after, and the raw body never has to be held in full.
+ * Only the partly read token at the end of a piece is kept back.
+ *
+ * Produces what NSJSONSerialization does with no options: the top level must be an object or an array, integers
+ * become long long NSNumbers (doubles if they don't fit), other numbers doubles, true and false boolean NSNumbers
+ * and null NSNull. Containers are mutable, but callers shouldn't rely on it. Unpaired UTF-16 surrogates in \u
+ * escapes become U+FFFD. Errors are in NSCocoaErrorDomain with NSJSONSerialization's code, 3840.
+ *
+ * Not thread safe; feed a parser from one queue at a time.
+ */
+@interface JRIncrementalJsonParser : NSObject
+
+/**
+ * Returns NO, and does nothing more, once the bytes so far can't be the start of a JSON document
+ */
+- (BOOL)appendBytes:(const void *)bytes length:(NSUInteger)length;
+
+- (BOOL)appendData:(NSData *)data;
+
+/**
+ * Ends the document and returns its top level object, or nil, setting error, if it was malformed or incomplete
+ */
+- (id)finishWithError:(NSError **)error;
+
+/** The first error found, if any */
+@property(nonatomic, readonly) NSError *error;
+
+/** How many bytes have been parsed */
+@property(nonatomic, readonly) NSUInteger bytesParsed;
+
+/**
+ * Parses the data as if it had arrived in chunkSize pieces; for tests and benchmarks
+ */
++ (id)JSONObjectWithData:(NSData *)data chunkSize:(NSUInteger)chunkSize error:(NSError **)error;
+@end
@@ -0,0 +1,600 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <errno.h>
+#import "JRIncrementalJsonParser.h"
+
+/* Same limit NSJSONSerialization has; it keeps a hostile document from growing the stack without bound */
+#define MAX_NESTING_DEPTH 512
+#define JSON_READ_CORRUPT_ERROR 3840
+
+typedef enum
+{
+    JRJsonExpectValue,
+    JRJsonExpectValueOrEnd,
+    JRJsonExpectKey,
+    JRJsonExpectKeyOrEnd,
+    JRJsonExpectColon,
+    JRJsonExpectCommaOrEnd,
+    JRJsonExpectNothing
+} JRJsonExpect;
+
+typedef enum
+{
+    JRJsonTokenNone,
+    JRJsonTokenString,
+    JRJsonTokenNumber,
+    JRJsonTokenLiteral
+} JRJsonToken;
+
+static BOOL JRIsJsonWhitespace(uint8_t c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static BOOL JRIsJsonNumberByte(uint8_t c)
+{
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+/* -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)? */
+static BOOL JRIsValidJsonNumber(const char *s, BOOL *isInteger)
+{
+    *isInteger = YES;
+    if (*s == '-') s++;
+
+    if (*s == '0') s++;
+    else if (*s >= '1' && *s <= '9') while (*s >= '0' && *s <= '9') s++;
+    else return NO;
+
+    if (*s == '.')
+    {
+        *isInteger = NO;
+        s++;
+        if (!(*s >= '0' && *s <= '9')) return NO;
+        while (*s >= '0' && *s <= '9') s++;
+    }
+
+    if (*s == 'e' || *s == 'E')
+    {
+        *isInteger = NO;
+        s++;
+        if (*s == '+' || *s == '-') s++;
+        if (!(*s >= '0' && *s <= '9')) return NO;
+        while (*s >= '0' && *s <= '9') s++;
+    }
+
+    return *s == '\0';
+}
+
+@interface JRIncrementalJsonParser ()
+{
+    NSMutableArray *containers;
+    NSMutableArray *keys;
+    id root;
+    JRJsonExpect expect;
+    JRJsonToken token;
+
+    /* The partly read token: a string's UTF-8 with escapes already resolved, or a number's or literal's text */
+    NSMutableData *tokenBytes;
+    BOOL stringIsKey;
+    BOOL escaping;
+    NSUInteger hexDigitsLeft;
+    uint32_t hexValue;
+    uint32_t highSurrogate;
+    const char *literal;
+    NSUInteger literalMatched;
+}
+@property(nonatomic) NSError *error;
+@property(nonatomic) NSUInteger bytesParsed;
+@end
+
+@implementation JRIncrementalJsonParser
+@synthesize error;
+@synthesize bytesParsed;
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        containers = [NSMutableArray array];
+        keys = [NSMutableArray array];
+        tokenBytes = [NSMutableData data];
+        expect = JRJsonExpectValue;
+        token = JRJsonTokenNone;
+    }
+
+    return self;
+}
+
++ (id)JSONObjectWithData:(NSData *)data chunkSize:(NSUInteger)chunkSize error:(NSError **)error
+{
+    JRIncrementalJsonParser *parser = [[JRIncrementalJsonParser alloc] init];
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+    chunkSize = MAX(chunkSize, 1);
+
+    for (NSUInteger start = 0; start < length; start += chunkSize)
+        if (![parser appendBytes:bytes + start length:MIN(chunkSize, length - start)]) break;
+
+    return [parser finishWithError:error];
+}
+
+- (void)failAt:(NSUInteger)position reason:(NSString *)reason
+{
+    if (self.error) return;
+
+    NSString *description = [NSString stringWithFormat:@"%@ around character %lu.", reason,
+                                                       (unsigned long) position];
+    self.error = [NSError errorWithDomain:NSCocoaErrorDomain code:JSON_READ_CORRUPT_ERROR
+                                 userInfo:[NSDictionary dictionaryWithObject:description
+                                                                      forKey:NSDebugDescriptionErrorKey]];
+}
+
+- (BOOL)appendData:(NSData *)data
+{
+    /* Data straight off the network can be in several pieces; parse them where they lie */
+    __block BOOL ok = YES;
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        ok = [self appendBytes:bytes length:byteRange.length];
+        if (!ok) *stop = YES;
+    }];
+
+    return ok;
+}
+
+- (BOOL)appendBytes:(const void *)theBytes length:(NSUInteger)length
+{
+    const uint8_t *bytes = theBytes;
+    NSUInteger i = 0;
+
+    while (i < length && !self.error)
+    {
+        switch (token)
+        {
+            case JRJsonTokenString:
+                i = [self consumeString:bytes from:i length:length];
+                break;
+            case JRJsonTokenNumber:
+                i = [self consumeNumber:bytes from:i length:length];
+                break;
+            case JRJsonTokenLiteral:
+                i = [self consumeLiteral:bytes from:i length:length];
+                break;
+            case JRJsonTokenNone:
+                if (!JRIsJsonWhitespace(bytes[i])) [self consumeStructuralByte:bytes[i] at:i];
+                if (!self.error) i++;
+                break;
+        }
+    }
+
+    /* After an error this is the offset of the offending byte */
+    self.bytesParsed += i;
+    return !self.error;
+}
+
+- (id)finishWithError:(NSError **)outError
+{
+    if (token == JRJsonTokenNumber) [self finishNumberAt:self.bytesParsed];
+
+    if (token != JRJsonTokenNone || expect != JRJsonExpectNothing)
+        [self failAt:self.bytesParsed reason:@"Unexpected end of data"];
+
+    if (self.error)
+    {
+        if (outError) *outError = self.error;
+        return nil;
+    }
+
+    return root;
+}
+
+#pragma mark structure
+
+- (void)consumeStructuralByte:(uint8_t)c at:(NSUInteger)i
+{
+    NSUInteger position = self.bytesParsed + i;
+    BOOL inObject = [[containers lastObject] isKindOfClass:[NSDictionary class]];
+
+    switch (expect)
+    {
+        case JRJsonExpectValueOrEnd:
+            if (c == ']')
+            {
+                [self closeContainer];
+                return;
+            }
+            /* fall through */
+        case JRJsonExpectValue:
+            [self startValue:c at:position];
+            return;
+
+        case JRJsonExpectKeyOrEnd:
+            if (c == '}')
+            {
+                [self closeContainer];
+                return;
+            }
+            /* fall through */
+        case JRJsonExpectKey:
+            if (c != '"') break;
+            token = JRJsonTokenString;
+            stringIsKey = YES;
+            return;
+
+        case JRJsonExpectColon:
+            if (c != ':') break;
+            expect = JRJsonExpectValue;
+            return;
+
+        case JRJsonExpectCommaOrEnd:
+            if (c == ',')
+                expect = inObject ? JRJsonExpectKey : JRJsonExpectValue;
+            else if ((c == '}' && inObject) || (c == ']' && !inObject))
+                [self closeContainer];
+            else
+                break;
+            return;
+
+        case JRJsonExpectNothing:
+            [self failAt:position reason:@"Garbage at end"];
+            return;
+    }
+
+    [self failAt:position reason:[NSString stringWithFormat:@"Unexpected character '%c'", c]];
+}
+
+- (void)startValue:(uint8_t)c at:(NSUInteger)position
+{
+    if (![containers count] && c != '{' && c != '[')
+    {
+        [self failAt:position reason:@"JSON text did not start with array or object"];
+        return;
+    }
+
+    switch (c)
+    {
+        case '{':
+        case '[':
+            if ([containers count] >= MAX_NESTING_DEPTH)
+            {
+                [self failAt:position reason:@"Too many nested arrays or dictionaries"];
+                return;
+            }
+            [containers addObject:c == '{' ? [NSMutableDictionary dictionary] : [NSMutableArray array]];
+            [keys addObject:[NSNull null]];
+            expect = c == '{' ? JRJsonExpectKeyOrEnd : JRJsonExpectValueOrEnd;
+            return;
+        case '"':
+            token = JRJsonTokenString;
+            stringIsKey = NO;
+            return;
+        case 't':
+            literal = "true";
+            break;
+        case 'f':
+            literal = "false";
+            break;
+        case 'n':
+            literal = "null";
+            break;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9'))
+            {
+                token = JRJsonTokenNumber;
+                [tokenBytes appendBytes:&c length:1];
+                return;
+            }
+            [self failAt:position reason:@"Invalid value"];
+            return;
+    }
+
+    token = JRJsonTokenLiteral;
+    literalMatched = 1;
+}
+
+- (void)closeContainer
+{
+    id container = [containers lastObject];
+    [containers removeLastObject];
+    [keys removeLastObject];
+    [self addValue:container];
+}
+
+- (void)addValue:(id)value
+{
+    token = JRJsonTokenNone;
+
+    id container = [containers lastObject];
+    if (!container)
+    {
+        root = value;
+        expect = JRJsonExpectNothing;
+        return;
+    }
+
+    if ([container isKindOfClass:[NSMutableDictionary class]])
+        [(NSMutableDictionary *) container setObject:value forKey:[keys lastObject]];
+    else
+        [(NSMutableArray *) container addObject:value];
+
+    expect = JRJsonExpectCommaOrEnd;
+}
+
+#pragma mark strings
+
+- (void)appendCodePoint:(uint32_t)codePoint
+{
+    uint8_t utf8[4];
+    NSUInteger length;
+
+    if (codePoint < 0x80)
+    {
+        utf8[0] = (uint8_t) codePoint;
+        length = 1;
+    }
+    else if (codePoint < 0x800)
+    {
+        utf8[0] = (uint8_t) (0xC0 | (codePoint >> 6));
+        utf8[1] = (uint8_t) (0x80 | (codePoint & 0x3F));
+        length = 2;
+    }
+    else if (codePoint < 0x10000)
+    {
+        utf8[0] = (uint8_t) (0xE0 | (codePoint >> 12));
+        utf8[1] = (uint8_t) (0x80 | ((codePoint >> 6) & 0x3F));
+        utf8[2] = (uint8_t) (0x80 | (codePoint & 0x3F));
+        length = 3;
+    }
+    else
+    {
+        utf8[0] = (uint8_t) (0xF0 | (codePoint >> 18));
+        utf8[1] = (uint8_t) (0x80 | ((codePoint >> 12) & 0x3F));
+        utf8[2] = (uint8_t) (0x80 | ((codePoint >> 6) & 0x3F));
+        utf8[3] = (uint8_t) (0x80 | (codePoint & 0x3F));
+        length = 4;
+    }
+
+    [tokenBytes appendBytes:utf8 length:length];
+}
+
+- (void)flushHighSurrogate
+{
+    if (!highSurrogate) return;
+
+    highSurrogate = 0;
+    [self appendCodePoint:0xFFFD];
+}
+
+- (void)appendCodeUnit:(uint32_t)codeUnit
+{
+    if (codeUnit >= 0xD800 && codeUnit <= 0xDBFF)
+    {
+        [self flushHighSurrogate];
+        highSurrogate = codeUnit;
+    }
+    else if (codeUnit >= 0xDC00 && codeUnit <= 0xDFFF)
+    {
+        uint32_t high = highSurrogate;
+        highSurrogate = 0;
+        [self appendCodePoint:high ? 0x10000 + ((high - 0xD800) << 10) + (codeUnit - 0xDC00) : 0xFFFD];
+    }
+    else
+    {
+        [self flushHighSurrogate];
+        [self appendCodePoint:codeUnit];
+    }
+}
+
+- (void)consumeEscapedByte:(uint8_t)c at:(NSUInteger)position
+{
+    if (hexDigitsLeft)
+    {
+        uint32_t digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+        else
+        {
+            [self failAt:position reason:@"Invalid unicode escape sequence"];
+            return;
+        }
+
+        hexValue = hexValue * 16 + digit;
+        if (--hexDigitsLeft == 0) [self appendCodeUnit:hexValue];
+        return;
+    }
+
+    escaping = NO;
+    uint8_t unescaped;
+    switch (c)
+    {
+        case '"':
+        case '\\':
+        case '/':
+            unescaped = c;
+            break;
+        case 'b':
+            unescaped = '\b';
+            break;
+        case 'f':
+            unescaped = '\f';
+            break;
+        case 'n':
+            unescaped = '\n';
+            break;
+        case 'r':
+            unescaped = '\r';
+            break;
+        case 't':
+            unescaped = '\t';
+            break;
+        case 'u':
+            hexDigitsLeft = 4;
+            hexValue = 0;
+            return;
+        default:
+            [self failAt:position reason:@"Invalid escape sequence"];
+            return;
+    }
+
+    [self flushHighSurrogate];
+    [tokenBytes appendBytes:&unescaped length:1];
+}
+
+- (NSUInteger)consumeString:(const uint8_t *)bytes from:(NSUInteger)i length:(NSUInteger)length
+{
+    while (i < length && !self.error)
+    {
+        if (escaping || hexDigitsLeft)
+        {
+            [self consumeEscapedByte:bytes[i] at:self.bytesParsed + i];
+            i++;
+            continue;
+        }
+
+        /* Most of a string is plain bytes; copy them over in one go */
+        NSUInteger runStart = i;
+        while (i < length && bytes[i] != '"' && bytes[i] != '\\' && bytes[i] >= 0x20) i++;
+        if (i > runStart)
+        {
+            [self flushHighSurrogate];
+            [tokenBytes appendBytes:bytes + runStart length:i - runStart];
+        }
+
+        if (i == length) break;
+
+        if (bytes[i] == '"')
+        {
+            [self finishStringAt:self.bytesParsed + i];
+            return i + 1;
+        }
+
+        if (bytes[i] == '\\')
+        {
+            escaping = YES;
+            i++;
+            continue;
+        }
+
+        [self failAt:self.bytesParsed + i reason:@"Unescaped control character"];
+    }
+
+    return i;
+}
+
+- (void)finishStringAt:(NSUInteger)position
+{
+    [self flushHighSurrogate];
+    NSString *string = [[NSString alloc] initWithBytes:[tokenBytes bytes] length:[tokenBytes length]
+                                              encoding:NSUTF8StringEncoding];
+    [tokenBytes setLength:0];
+
+    if (!string)
+    {
+        [self failAt:position reason:@"Invalid UTF-8 in string"];
+        return;
+    }
+
+    if (stringIsKey)
+    {
+        [keys replaceObjectAtIndex:[keys count] - 1 withObject:string];
+        token = JRJsonTokenNone;
+        expect = JRJsonExpectColon;
+        return;
+    }
+
+    [self addValue:string];
+}
+
+#pragma mark numbers and literals
+
+- (NSUInteger)consumeNumber:(const uint8_t *)bytes from:(NSUInteger)i length:(NSUInteger)length
+{
+    NSUInteger runStart = i;
+    while (i < length && JRIsJsonNumberByte(bytes[i])) i++;
+    [tokenBytes appendBytes:bytes + runStart length:i - runStart];
+
+    /* The byte that ended the number is left for the structure to deal with */
+    if (i < length) [self finishNumberAt:self.bytesParsed + i];
+    return i;
+}
+
+- (void)finishNumberAt:(NSUInteger)position
+{
+    [tokenBytes appendBytes:"" length:1];
+    const char *text = [tokenBytes bytes];
+
+    BOOL isInteger;
+    NSNumber *number = nil;
+    if (JRIsValidJsonNumber(text, &isInteger))
+    {
+        errno = 0;
+        long long integerValue = isInteger ? strtoll(text, NULL, 10) : 0;
+        if (isInteger && errno != ERANGE)
+            number = [NSNumber numberWithLongLong:integerValue];
+        else
+            number = [NSNumber numberWithDouble:strtod(text, NULL)];
+    }
+
+    [tokenBytes setLength:0];
+    if (!number)
+    {
+        [self failAt:position reason:@"Invalid number"];
+        return;
+    }
+
+    [self addValue:number];
+}
+
+- (NSUInteger)consumeLiteral:(const uint8_t *)bytes from:(NSUInteger)i length:(NSUInteger)length
+{
+    NSUInteger literalLength = strlen(literal);
+    while (i < length && literalMatched < literalLength)
+    {
+        if (bytes[i] != (uint8_t) literal[literalMatched])
+        {
+            [self failAt:self.bytesParsed + i reason:@"Invalid value"];
+            return i;
+        }
+
+        literalMatched++;
+        i++;
+    }
+
+    if (literalMatched == literalLength)
+    {
+        if (literal[0] == 'n') [self addValue:[NSNull null]];
+        else [self addValue:[NSNumber numberWithBool:literal[0] == 't']];
+    }
+
+    return i;
+}
+@end
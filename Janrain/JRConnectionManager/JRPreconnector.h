@@ -0,0 +1,68 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Opens connections to hosts the library is about to talk to, so that the first real request to each of them finds
+ * DNS resolved and the TLS handshake done. Each origin gets a HEAD request on the given session, which leaves an idle
+ * connection in the session's pool. Origins are warmed again when the app comes back to the foreground or the
+ * network changes, since both drop pooled connections.
+ * Only to be used from the main thread.
+ */
+@interface JRPreconnector : NSObject
+
+/** The session whose connection pool is warmed; JRConnectionManager swaps it along with its own */
+@property(nonatomic) NSURLSession *session;
+
+/** Off by default; while off, origins are remembered but nothing is requested */
+@property(nonatomic) BOOL enabled;
+
+/** An origin warmed more recently than this is left alone unless the network changed; defaults to 30 seconds */
+@property(nonatomic) NSTimeInterval warmInterval;
+
+- (id)initWithSession:(NSURLSession *)session;
+
+/**
+ * Remembers the URL's scheme, host and port, and warms it if enabled. Other parts of the URL are ignored, so it's
+ * fine to pass the full URL of the request that's expected to follow.
+ */
+- (void)addUrl:(NSURL *)url;
+
+/** The remembered origins, as "scheme://host:port" strings */
+- (NSSet *)origins;
+
+/** Warms every remembered origin, even ones warmed within warmInterval, as after a network change */
+- (void)rewarmAll;
+
+/** Number of warm-up requests started */
+- (NSUInteger)warmCount;
+@end
@@ -0,0 +1,249 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <UIKit/UIKit.h>
+#import <SystemConfiguration/SystemConfiguration.h>
+#import <netinet/in.h>
+#import "debug_log.h"
+#import "JRPreconnector.h"
+#import "NSMutableURLRequest+JRRequestUtils.h"
+
+#define DEFAULT_WARM_INTERVAL 30.0
+#define WARM_REQUEST_TIMEOUT 10.0
+
+@interface JRPreconnector ()
+{
+    SCNetworkReachabilityRef reachability;
+    SCNetworkReachabilityFlags reachabilityFlags;
+}
+@property(nonatomic) NSMutableDictionary *originUrls;
+@property(nonatomic) NSMutableDictionary *lastWarmTimes;
+@property(nonatomic) NSMutableSet *warmingOrigins;
+@property(nonatomic) NSUInteger warmCount;
+- (void)reachabilityDidChangeFlags:(SCNetworkReachabilityFlags)flags;
+@end
+
+static void JRPreconnectorReachabilityCallback(__unused SCNetworkReachabilityRef target,
+                                               SCNetworkReachabilityFlags flags, void *info)
+{
+    [(__bridge JRPreconnector *) info reachabilityDidChangeFlags:flags];
+}
+
+@implementation JRPreconnector
+@synthesize session;
+@synthesize enabled;
+@synthesize warmInterval;
+@synthesize originUrls;
+@synthesize lastWarmTimes;
+@synthesize warmingOrigins;
+@synthesize warmCount;
+
+- (id)initWithSession:(NSURLSession *)theSession
+{
+    if ((self = [super init]))
+    {
+        session = theSession;
+        warmInterval = DEFAULT_WARM_INTERVAL;
+        originUrls = [NSMutableDictionary dictionary];
+        lastWarmTimes = [NSMutableDictionary dictionary];
+        warmingOrigins = [NSMutableSet set];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    [self stopMonitoringNetworkChanges];
+}
+
+- (void)setEnabled:(BOOL)isEnabled
+{
+    if (enabled == isEnabled) return;
+    enabled = isEnabled;
+
+    if (enabled)
+    {
+        [self startMonitoringNetworkChanges];
+        [self warmOriginsForcingRecent:NO];
+    }
+    else
+    {
+        [self stopMonitoringNetworkChanges];
+    }
+}
+
+- (void)addUrl:(NSURL *)url
+{
+    NSString *origin = [self originOfUrl:url];
+    if (!origin) return;
+
+    if (![self.originUrls objectForKey:origin])
+    {
+        NSString *originUrl = [NSString stringWithFormat:@"%@/", origin];
+        [self.originUrls setObject:[NSURL URLWithString:originUrl] forKey:origin];
+    }
+
+    if (self.enabled) [self warmOrigin:origin forcingRecent:NO];
+}
+
+- (NSSet *)origins
+{
+    return [NSSet setWithArray:[self.originUrls allKeys]];
+}
+
+- (void)rewarmAll
+{
+    if (self.enabled) [self warmOriginsForcingRecent:YES];
+}
+
+- (NSString *)originOfUrl:(NSURL *)url
+{
+    NSString *scheme = [[url scheme] lowercaseString];
+    NSString *host = [[url host] lowercaseString];
+    if (![host length] || !([scheme isEqualToString:@"https"] || [scheme isEqualToString:@"http"])) return nil;
+
+    NSNumber *port = [url port];
+    if (!port) port = [NSNumber numberWithInt:[scheme isEqualToString:@"https"] ? 443 : 80];
+
+    return [NSString stringWithFormat:@"%@://%@:%@", scheme, host, port];
+}
+
+- (void)warmOriginsForcingRecent:(BOOL)forceRecent
+{
+    for (NSString *origin in [self.originUrls allKeys])
+        [self warmOrigin:origin forcingRecent:forceRecent];
+}
+
+- (void)warmOrigin:(NSString *)origin forcingRecent:(BOOL)forceRecent
+{
+    if ([self.warmingOrigins containsObject:origin]) return;
+
+    NSDate *lastWarmTime = [self.lastWarmTimes objectForKey:origin];
+    if (!forceRecent && lastWarmTime && -[lastWarmTime timeIntervalSinceNow] < self.warmInterval) return;
+
+    /* Nothing in the response matters, only the connection it leaves behind in the session's pool */
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[self.originUrls objectForKey:origin]
+                                                           cachePolicy:NSURLRequestReloadIgnoringLocalCacheData
+                                                       timeoutInterval:WARM_REQUEST_TIMEOUT];
+    [request setHTTPMethod:@"HEAD"];
+    [request setHTTPShouldHandleCookies:NO];
+    [request JR_setOperationName:@"preconnect"];
+
+    [self.warmingOrigins addObject:origin];
+    [self.lastWarmTimes setObject:[NSDate date] forKey:origin];
+    self.warmCount++;
+
+    __weak JRPreconnector *weakSelf = self;
+    NSURLSessionDataTask *task = [self.session dataTaskWithRequest:request completionHandler:
+            ^(__unused NSData *data, __unused NSURLResponse *response, NSError *error)
+    {
+        dispatch_async(dispatch_get_main_queue(), ^
+        {
+            JRPreconnector *preconnector = weakSelf;
+            if (!preconnector) return;
+
+            [preconnector.warmingOrigins removeObject:origin];
+
+            /* A failed warm-up leaves nothing in the pool, so don't let it hold off the next attempt */
+            if (error)
+            {
+                DLog(@"Preconnect to %@ failed: %@", origin, [error localizedDescription]);
+                [preconnector.lastWarmTimes removeObjectForKey:origin];
+            }
+        });
+    }];
+
+    task.priority = NSURLSessionTaskPriorityLow;
+    [task resume];
+}
+
+#pragma mark network_changes
+
+- (void)startMonitoringNetworkChanges
+{
+    [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(applicationWillEnterForeground:)
+                                                 name:UIApplicationWillEnterForegroundNotification object:nil];
+
+    if (reachability) return;
+
+    struct sockaddr_in zeroAddress;
+    bzero(&zeroAddress, sizeof(zeroAddress));
+    zeroAddress.sin_len = sizeof(zeroAddress);
+    zeroAddress.sin_family = AF_INET;
+
+    reachability = SCNetworkReachabilityCreateWithAddress(kCFAllocatorDefault, (const struct sockaddr *) &zeroAddress);
+    if (!reachability) return;
+
+    SCNetworkReachabilityGetFlags(reachability, &reachabilityFlags);
+
+    SCNetworkReachabilityContext context = { 0, (__bridge void *) self, NULL, NULL, NULL };
+    if (!SCNetworkReachabilitySetCallback(reachability, JRPreconnectorReachabilityCallback, &context) ||
+            !SCNetworkReachabilitySetDispatchQueue(reachability, dispatch_get_main_queue()))
+    {
+        ALog(@"Unable to monitor network changes, preconnects won't follow them");
+        [self stopMonitoringNetworkChanges];
+    }
+}
+
+- (void)stopMonitoringNetworkChanges
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self name:UIApplicationWillEnterForegroundNotification
+                                                  object:nil];
+
+    if (!reachability) return;
+
+    SCNetworkReachabilitySetCallback(reachability, NULL, NULL);
+    SCNetworkReachabilitySetDispatchQueue(reachability, NULL);
+    CFRelease(reachability);
+    reachability = NULL;
+}
+
+- (void)applicationWillEnterForeground:(__unused NSNotification *)notification
+{
+    [self warmOriginsForcingRecent:NO];
+}
+
+- (void)reachabilityDidChangeFlags:(SCNetworkReachabilityFlags)flags
+{
+    SCNetworkReachabilityFlags interesting = kSCNetworkReachabilityFlagsReachable |
+            kSCNetworkReachabilityFlagsIsWWAN | kSCNetworkReachabilityFlagsConnectionRequired;
+    BOOL changed = (flags & interesting) != (reachabilityFlags & interesting);
+    reachabilityFlags = flags;
+
+    /* Connections pooled on the old interface are gone or about to be */
+    if (changed && (flags & kSCNetworkReachabilityFlagsReachable) &&
+            !(flags & kSCNetworkReachabilityFlagsConnectionRequired))
+    {
+        DLog(@"Network changed, warming %lu origins again", (unsigned long) [self.originUrls count]);
+        [self rewarmAll];
+    }
+}
+@end
@@ -0,0 +1,86 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Builds the bodies of requests that can carry large payloads - entity.update and entity.replace send whole records
+ * or plurals - in the smallest form the endpoint accepts. Bodies are form encoded by default, or JSON when
+ * jsonBodiesEnabled, and gzipped when compressionEnabled and they're at least compressionThreshold bytes.
+ *
+ * Support is negotiated per endpoint: an endpoint that answers an encoded body with 415 Unsupported Media Type, or
+ * with a Capture error showing it couldn't read the params, is remembered, sent the plain form encoded body straight
+ * away (see fallbackRequestForRequest:response:body:), and sent plain bodies from then on. Safe to use from any
+ * thread.
+ */
+@interface JRRequestBodyEncoder : NSObject
+
+/** Off by default */
+@property BOOL compressionEnabled;
+
+/** Off by default; only for endpoints that take JSON bodies */
+@property BOOL jsonBodiesEnabled;
+
+/** Bodies smaller than this aren't worth the gzip header; defaults to 1024 bytes */
+@property NSUInteger compressionThreshold;
+
++ (JRRequestBodyEncoder *)sharedEncoder;
+
+/**
+ * Makes the request a POST of the params. Values that are neither strings nor numbers - the attributes of an
+ * entity.update, say - are written as JSON, in a form body as a JSON encoded string.
+ */
+- (void)setBodyOfRequest:(NSMutableURLRequest *)request withParams:(NSDictionary *)params;
+
+/**
+ * If the response refuses the request's encoding, records that for the endpoint and returns a copy of the request
+ * with the plain form encoded body; otherwise nil. Besides a 415, a refusal is a Capture stat "error" body (NSData,
+ * or already parsed) with a missing_argument error, or an invalid_argument one about the attributes: what Capture
+ * answers when it can't make out the params of a body it doesn't understand.
+ */
+- (NSURLRequest *)fallbackRequestForRequest:(NSURLRequest *)request response:(NSURLResponse *)response body:(id)body;
+
+/** Only looks at the status code */
+- (NSURLRequest *)fallbackRequestForRequest:(NSURLRequest *)request response:(NSURLResponse *)response;
+
+/** Whether bodies to the URL's endpoint are sent plain because it refused an encoded one */
+- (BOOL)isEncodingRefusedForUrl:(NSURL *)url;
+
+/** Forgets which endpoints refused encoded bodies */
+- (void)resetRefusedEndpoints;
+
++ (NSData *)formBodyWithParams:(NSDictionary *)params;
+
++ (NSData *)jsonBodyWithParams:(NSDictionary *)params;
+
+/** gzip (RFC 1952) data, or nil if zlib fails */
++ (NSData *)gzipData:(NSData *)data;
+@end
@@ -0,0 +1,250 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <zlib.h>
+#import "debug_log.h"
+#import "JRRequestBodyEncoder.h"
+
+#define DEFAULT_COMPRESSION_THRESHOLD 1024
+#define GZIP_WINDOW_BITS (MAX_WBITS + 16)
+
+/* Holds the form encoded body on encoded requests, for the fallback. Protocol properties are copied along with the
+   request, so it's still there on the request a retry or the task hands back. */
+static NSString *const JRPlainBodyKey = @"JRPlainBody";
+
+static NSString *JRFormValueString(id value)
+{
+    if ([value isKindOfClass:[NSString class]])
+        return value;
+    if ([value isKindOfClass:[NSNumber class]])
+        return [value stringValue];
+
+    NSData *json = [NSJSONSerialization dataWithJSONObject:value options:0 error:nil];
+    return json ? [[NSString alloc] initWithData:json encoding:NSUTF8StringEncoding] : @"";
+}
+
+/* Same escaping as NSString#stringByAddingUrlPercentEscapes, which lives with the UIKit bound connection manager */
+static NSString *JRFormEscapedString(NSString *string)
+{
+    static NSCharacterSet *allowed = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        NSMutableCharacterSet *tmp = [[NSCharacterSet URLQueryAllowedCharacterSet] mutableCopy];
+        [tmp removeCharactersInString:@"?+=&"];
+        allowed = [tmp copy];
+    });
+
+    return [string stringByAddingPercentEncodingWithAllowedCharacters:allowed];
+}
+
+/* Capture answers a body it can't read with a 200 and an error about the params it couldn't find in it; invalid_argument
+   is also a validation error, so only one about the attributes counts */
+static BOOL JRIsUnreadableBodyError(id body)
+{
+    if ([body isKindOfClass:[NSData class]])
+        body = [NSJSONSerialization JSONObjectWithData:body options:0 error:nil];
+    if (![body isKindOfClass:[NSDictionary class]] || ![[body objectForKey:@"stat"] isEqual:@"error"])
+        return NO;
+
+    id error = [body objectForKey:@"error"];
+    id description = [body objectForKey:@"error_description"];
+    if ([error isEqual:@"missing_argument"])
+        return YES;
+
+    return [error isEqual:@"invalid_argument"] && [description isKindOfClass:[NSString class]] &&
+            [description rangeOfString:@"attributes"].location != NSNotFound;
+}
+
+@interface JRRequestBodyEncoder ()
+{
+    dispatch_queue_t refusedEndpointsQueue;
+}
+@property(nonatomic) NSMutableSet *refusedEndpoints;
+@end
+
+@implementation JRRequestBodyEncoder
+@synthesize compressionEnabled;
+@synthesize jsonBodiesEnabled;
+@synthesize compressionThreshold;
+@synthesize refusedEndpoints;
+
++ (JRRequestBodyEncoder *)sharedEncoder
+{
+    static JRRequestBodyEncoder *sharedEncoder = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedEncoder = [[JRRequestBodyEncoder alloc] init];
+    });
+
+    return sharedEncoder;
+}
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        compressionThreshold = DEFAULT_COMPRESSION_THRESHOLD;
+        refusedEndpoints = [NSMutableSet set];
+        refusedEndpointsQueue = dispatch_queue_create("com.janrain.JRRequestBodyEncoder", DISPATCH_QUEUE_SERIAL);
+    }
+
+    return self;
+}
+
+/* Endpoints are told apart by host and path; the Capture API puts the operation in the path */
+- (NSString *)endpointForUrl:(NSURL *)url
+{
+    return [NSString stringWithFormat:@"%@%@", [[url host] lowercaseString], [url path]];
+}
+
+- (BOOL)isEncodingRefusedForUrl:(NSURL *)url
+{
+    NSString *endpoint = [self endpointForUrl:url];
+    __block BOOL refused;
+    dispatch_sync(refusedEndpointsQueue, ^{
+        refused = [self->refusedEndpoints containsObject:endpoint];
+    });
+
+    return refused;
+}
+
+- (void)resetRefusedEndpoints
+{
+    dispatch_sync(refusedEndpointsQueue, ^{
+        [self->refusedEndpoints removeAllObjects];
+    });
+}
+
+- (void)setBodyOfRequest:(NSMutableURLRequest *)request withParams:(NSDictionary *)params
+{
+    [request setHTTPMethod:@"POST"];
+
+    NSData *plainBody = [JRRequestBodyEncoder formBodyWithParams:params];
+    if ((!self.compressionEnabled && !self.jsonBodiesEnabled) || [self isEncodingRefusedForUrl:[request URL]])
+    {
+        [request setHTTPBody:plainBody];
+        return;
+    }
+
+    NSData *body = plainBody;
+    if (self.jsonBodiesEnabled)
+    {
+        body = [JRRequestBodyEncoder jsonBodyWithParams:params];
+        [request setValue:@"application/json" forHTTPHeaderField:@"Content-Type"];
+    }
+
+    if (self.compressionEnabled && [body length] >= self.compressionThreshold)
+    {
+        NSData *compressed = [JRRequestBodyEncoder gzipData:body];
+        if (compressed && [compressed length] < [body length])
+        {
+            DLog(@"Compressed %@ body from %lu to %lu bytes", [[request URL] path], (unsigned long) [body length],
+                 (unsigned long) [compressed length]);
+            body = compressed;
+            [request setValue:@"gzip" forHTTPHeaderField:@"Content-Encoding"];
+        }
+    }
+
+    [request setHTTPBody:body];
+    if (body != plainBody) [NSURLProtocol setProperty:plainBody forKey:JRPlainBodyKey inRequest:request];
+}
+
+- (NSURLRequest *)fallbackRequestForRequest:(NSURLRequest *)request response:(NSURLResponse *)response
+{
+    return [self fallbackRequestForRequest:request response:response body:nil];
+}
+
+- (NSURLRequest *)fallbackRequestForRequest:(NSURLRequest *)request response:(NSURLResponse *)response body:(id)body
+{
+    NSData *plainBody = [NSURLProtocol propertyForKey:JRPlainBodyKey inRequest:request];
+    if (!plainBody || ![response isKindOfClass:[NSHTTPURLResponse class]])
+        return nil;
+
+    if ([(NSHTTPURLResponse *) response statusCode] != 415 && !JRIsUnreadableBodyError(body))
+        return nil;
+
+    NSString *endpoint = [self endpointForUrl:[request URL]];
+    ALog(@"%@ refused a %@ body, sending plain form bodies from now on", endpoint,
+         [request valueForHTTPHeaderField:@"Content-Encoding"] ? @"compressed" : @"JSON");
+    dispatch_sync(refusedEndpointsQueue, ^{
+        [self->refusedEndpoints addObject:endpoint];
+    });
+
+    NSMutableURLRequest *fallbackRequest = [request mutableCopy];
+    [fallbackRequest setValue:nil forHTTPHeaderField:@"Content-Encoding"];
+    [fallbackRequest setValue:nil forHTTPHeaderField:@"Content-Type"];
+    [fallbackRequest setHTTPBody:plainBody];
+    [NSURLProtocol removePropertyForKey:JRPlainBodyKey inRequest:fallbackRequest];
+
+    return fallbackRequest;
+}
+
+/* Keys are sorted so that equal params always make the same body */
++ (NSData *)formBodyWithParams:(NSDictionary *)params
+{
+    NSMutableString *body = [NSMutableString string];
+    for (NSString *key in [[params allKeys] sortedArrayUsingSelector:@selector(compare:)])
+    {
+        if ([body length]) [body appendString:@"&"];
+        [body appendFormat:@"%@=%@", JRFormEscapedString(key),
+                                     JRFormEscapedString(JRFormValueString([params objectForKey:key]))];
+    }
+
+    return [body dataUsingEncoding:NSUTF8StringEncoding];
+}
+
++ (NSData *)jsonBodyWithParams:(NSDictionary *)params
+{
+    return [NSJSONSerialization dataWithJSONObject:params options:0 error:nil];
+}
+
++ (NSData *)gzipData:(NSData *)data
+{
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return nil;
+
+    /* deflateBound is for zlib framing; the gzip header and trailer take up to 18 bytes more */
+    NSMutableData *compressed = [NSMutableData dataWithLength:deflateBound(&stream, (uLong) [data length]) + 18];
+    stream.next_in = (Bytef *) [data bytes];
+    stream.avail_in = (uInt) [data length];
+    stream.next_out = [compressed mutableBytes];
+    stream.avail_out = (uInt) [compressed length];
+
+    int status = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+    if (status != Z_STREAM_END) return nil;
+
+    [compressed setLength:stream.total_out];
+    return compressed;
+}
+@end
@@ -0,0 +1,84 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Where the time went for one completed request, from its NSURLSessionTaskMetrics. Durations are in seconds and are
+ * 0 for phases that didn't happen, e.g. DNS, connect and TLS on a reused connection. Only collected on iOS 10 and up.
+ */
+@interface JRRequestMetrics : NSObject
+@property(nonatomic, copy) NSString *operationName;
+@property(nonatomic, copy) NSURL *url;
+@property(nonatomic) NSInteger statusCode;
+@property(nonatomic) NSTimeInterval totalDuration;
+@property(nonatomic) NSTimeInterval dnsDuration;
+@property(nonatomic) NSTimeInterval connectDuration;
+@property(nonatomic) NSTimeInterval tlsDuration;
+@property(nonatomic) NSTimeInterval requestDuration;
+@property(nonatomic) NSTimeInterval serverDuration;
+@property(nonatomic) NSTimeInterval responseDuration;
+@property(nonatomic) int64_t bytesSent;
+@property(nonatomic) int64_t bytesReceived;
+@property(nonatomic) BOOL reusedConnection;
+@property(nonatomic, copy) NSString *networkProtocolName;
+@property(nonatomic) NSUInteger redirectCount;
+@end
+
+@protocol JRRequestMetricsObserver <NSObject>
+/**
+ * Called on the main thread for every request JRConnectionManager completes
+ */
+- (void)requestDidFinishWithMetrics:(JRRequestMetrics *)metrics;
+@end
+
+/**
+ * @internal
+ * The delegate of JRConnectionManager's session. Turns task metrics into JRRequestMetrics, tells the observers, and
+ * keeps a histogram of total durations per operation.
+ */
+@interface JRRequestMetricsCollector : NSObject <NSURLSessionTaskDelegate>
+- (void)addObserver:(id <JRRequestMetricsObserver>)observer;
+
+- (void)removeObserver:(id <JRRequestMetricsObserver>)observer;
+
+- (void)recordMetrics:(JRRequestMetrics *)metrics;
+
+/**
+ * Keyed by operation name. Each value holds the "count" of requests, their "totalDuration", and a "histogram" array
+ * of counts for the buckets bounded above by +histogramBucketBounds (in seconds), plus one for anything slower.
+ */
+- (NSDictionary *)histogramSnapshot;
+
+- (void)resetHistograms;
+
++ (NSArray *)histogramBucketBounds;
+@end
@@ -0,0 +1,196 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "debug_log.h"
+#import "JRRequestMetrics.h"
+#import "NSMutableURLRequest+JRRequestUtils.h"
+
+static NSTimeInterval intervalBetween(NSDate *start, NSDate *end)
+{
+    if (!start || !end) return 0;
+    return MAX([end timeIntervalSinceDate:start], 0);
+}
+
+@implementation JRRequestMetrics
+@synthesize operationName;
+@synthesize url;
+@synthesize statusCode;
+@synthesize totalDuration;
+@synthesize dnsDuration;
+@synthesize connectDuration;
+@synthesize tlsDuration;
+@synthesize requestDuration;
+@synthesize serverDuration;
+@synthesize responseDuration;
+@synthesize bytesSent;
+@synthesize bytesReceived;
+@synthesize reusedConnection;
+@synthesize networkProtocolName;
+@synthesize redirectCount;
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %@ %ld total=%.3f dns=%.3f connect=%.3f tls=%.3f server=%.3f "
+                                              "response=%.3f sent=%lld received=%lld reused=%d protocol=%@>",
+                                      self.operationName, [self.url absoluteString], (long) self.statusCode,
+                                      self.totalDuration, self.dnsDuration, self.connectDuration, self.tlsDuration,
+                                      self.serverDuration, self.responseDuration, self.bytesSent, self.bytesReceived,
+                                      self.reusedConnection, self.networkProtocolName];
+}
+@end
+
+@interface JRRequestMetricsCollector ()
+@property(nonatomic) NSHashTable *observers;
+@property(nonatomic) NSMutableDictionary *histograms;
+@end
+
+@implementation JRRequestMetricsCollector
+@synthesize observers;
+@synthesize histograms;
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        observers = [NSHashTable weakObjectsHashTable];
+        histograms = [NSMutableDictionary dictionary];
+    }
+
+    return self;
+}
+
++ (NSArray *)histogramBucketBounds
+{
+    return [NSArray arrayWithObjects:[NSNumber numberWithDouble:0.05], [NSNumber numberWithDouble:0.1],
+                                     [NSNumber numberWithDouble:0.25], [NSNumber numberWithDouble:0.5],
+                                     [NSNumber numberWithDouble:1], [NSNumber numberWithDouble:2.5],
+                                     [NSNumber numberWithDouble:5], nil];
+}
+
+- (void)addObserver:(id <JRRequestMetricsObserver>)observer
+{
+    [self.observers addObject:observer];
+}
+
+- (void)removeObserver:(id <JRRequestMetricsObserver>)observer
+{
+    [self.observers removeObject:observer];
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task
+        didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)taskMetrics
+{
+    NSURLSessionTaskTransactionMetrics *transaction = [[taskMetrics transactionMetrics] lastObject];
+    JRRequestMetrics *metrics = [[JRRequestMetrics alloc] init];
+
+    metrics.operationName       = [[task originalRequest] JR_operationName];
+    metrics.url                 = [[task originalRequest] URL];
+    metrics.totalDuration       = [[taskMetrics taskInterval] duration];
+    metrics.redirectCount       = [taskMetrics redirectCount];
+    metrics.bytesSent           = [task countOfBytesSent];
+    metrics.bytesReceived       = [task countOfBytesReceived];
+    metrics.dnsDuration         = intervalBetween(transaction.domainLookupStartDate, transaction.domainLookupEndDate);
+    metrics.connectDuration     = intervalBetween(transaction.connectStartDate, transaction.connectEndDate);
+    metrics.tlsDuration         = intervalBetween(transaction.secureConnectionStartDate,
+                                                  transaction.secureConnectionEndDate);
+    metrics.requestDuration     = intervalBetween(transaction.requestStartDate, transaction.requestEndDate);
+    metrics.serverDuration      = intervalBetween(transaction.requestEndDate, transaction.responseStartDate);
+    metrics.responseDuration    = intervalBetween(transaction.responseStartDate, transaction.responseEndDate);
+    metrics.reusedConnection    = transaction.reusedConnection;
+    metrics.networkProtocolName = transaction.networkProtocolName;
+
+    if ([transaction.response isKindOfClass:[NSHTTPURLResponse class]])
+        metrics.statusCode = [(NSHTTPURLResponse *) transaction.response statusCode];
+
+    /* This is called on the session's delegate queue, everything after this happens on main */
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [self recordMetrics:metrics];
+    });
+}
+
+- (void)recordMetrics:(JRRequestMetrics *)metrics
+{
+    DLog(@"%@", metrics);
+
+    NSArray *bounds = [JRRequestMetricsCollector histogramBucketBounds];
+    NSMutableDictionary *histogram = [self.histograms objectForKey:metrics.operationName];
+    if (!histogram)
+    {
+        NSMutableArray *buckets = [NSMutableArray arrayWithCapacity:[bounds count] + 1];
+        for (NSUInteger i = 0; i <= [bounds count]; i++)
+            [buckets addObject:[NSNumber numberWithUnsignedInteger:0]];
+
+        histogram = [NSMutableDictionary dictionaryWithObjectsAndKeys:
+                                                 [NSNumber numberWithUnsignedInteger:0], @"count",
+                                                 [NSNumber numberWithDouble:0], @"totalDuration",
+                                                 buckets, @"histogram", nil];
+        [self.histograms setObject:histogram forKey:metrics.operationName];
+    }
+
+    NSUInteger bucket = [bounds indexOfObjectPassingTest:^BOOL(NSNumber *bound, NSUInteger idx, BOOL *stop) {
+        return metrics.totalDuration < [bound doubleValue];
+    }];
+    if (bucket == NSNotFound) bucket = [bounds count];
+
+    NSMutableArray *buckets = [histogram objectForKey:@"histogram"];
+    [buckets replaceObjectAtIndex:bucket withObject:
+            [NSNumber numberWithUnsignedInteger:[[buckets objectAtIndex:bucket] unsignedIntegerValue] + 1]];
+    [histogram setObject:[NSNumber numberWithUnsignedInteger:[[histogram objectForKey:@"count"] unsignedIntegerValue] + 1]
+                  forKey:@"count"];
+    [histogram setObject:[NSNumber numberWithDouble:[[histogram objectForKey:@"totalDuration"] doubleValue] +
+                                                            metrics.totalDuration]
+                  forKey:@"totalDuration"];
+
+    for (id <JRRequestMetricsObserver> observer in [self.observers allObjects])
+        [observer requestDidFinishWithMetrics:metrics];
+}
+
+- (NSDictionary *)histogramSnapshot
+{
+    NSMutableDictionary *snapshot = [NSMutableDictionary dictionaryWithCapacity:[self.histograms count]];
+    for (NSString *operationName in self.histograms)
+    {
+        NSDictionary *histogram = [self.histograms objectForKey:operationName];
+        [snapshot setObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                  [histogram objectForKey:@"count"], @"count",
+                                                  [histogram objectForKey:@"totalDuration"], @"totalDuration",
+                                                  [[histogram objectForKey:@"histogram"] copy], @"histogram", nil]
+                     forKey:operationName];
+    }
+
+    return snapshot;
+}
+
+- (void)resetHistograms
+{
+    [self.histograms removeAllObjects];
+}
+@end
@@ -0,0 +1,85 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+typedef NS_ENUM(NSInteger, JRConnectionPriority)
+{
+    /**
+     * The sign-in critical path: token URL calls, traditional sign-in and the entity fetch. Always started right away.
+     */
+    JRConnectionPriorityCritical = 0,
+
+    /**
+     * Anything the user is waiting on that isn't part of signing in. Always started right away.
+     */
+    JRConnectionPriorityNormal,
+
+    /**
+     * Work nobody is waiting on, like recording activities, shortening URLs, and refreshing the configuration or
+     * flow. Held back while any critical request is pending, and capped at maxConcurrentBackgroundTasks.
+     */
+    JRConnectionPriorityBackground
+};
+
+#define JRConnectionPriorityCount 3
+
+/**
+ * @internal
+ * Decides when JRConnectionManager's tasks are resumed. Tasks are handed over suspended and the scheduler resumes
+ * them in priority order, and it has to be told when each one completes so it can start what was waiting on it.
+ * Only to be used from the main thread.
+ */
+@interface JRRequestScheduler : NSObject
+@property(nonatomic) NSUInteger maxConcurrentBackgroundTasks;
+
+- (void)scheduleTask:(NSURLSessionTask *)task withPriority:(JRConnectionPriority)priority;
+
+- (void)taskDidComplete:(NSURLSessionTask *)task;
+
+/**
+ * A request that's going to be retried has no task between attempts, e.g. while it backs off. Bracketing that gap
+ * with these keeps it pending, so a critical request still holds back background work while it waits.
+ */
+- (void)beginRetryWithPriority:(JRConnectionPriority)priority;
+
+- (void)endRetryWithPriority:(JRConnectionPriority)priority;
+
+- (BOOL)isCriticalPathActive;
+
+/**
+ * How long tasks waited before being resumed, keyed by priority name ("critical", "normal" and "background"). Each
+ * value is a dictionary with the "count" of tasks started, and their "totalDelay" and "maxDelay" in seconds.
+ */
+- (NSDictionary *)queueingDelaySnapshot;
+
+- (void)resetQueueingDelays;
+@end
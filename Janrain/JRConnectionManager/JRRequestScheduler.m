@@ -0,0 +1,201 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "debug_log.h"
+#import "JRRequestScheduler.h"
+
+@interface JRScheduledTask : NSObject
+@property(nonatomic) NSURLSessionTask *task;
+@property(nonatomic) JRConnectionPriority priority;
+@property(nonatomic) CFAbsoluteTime scheduledTime;
+@end
+
+@implementation JRScheduledTask
+@synthesize task;
+@synthesize priority;
+@synthesize scheduledTime;
+@end
+
+@interface JRRequestScheduler ()
+{
+    NSUInteger startedCounts[JRConnectionPriorityCount];
+    NSTimeInterval totalDelays[JRConnectionPriorityCount];
+    NSTimeInterval maxDelays[JRConnectionPriorityCount];
+    NSUInteger retryingCounts[JRConnectionPriorityCount];
+}
+@property(nonatomic) NSMutableArray *waitingTasks;
+@property(nonatomic) NSMutableArray *runningTasks;
+@end
+
+@implementation JRRequestScheduler
+@synthesize maxConcurrentBackgroundTasks;
+@synthesize waitingTasks;
+@synthesize runningTasks;
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        maxConcurrentBackgroundTasks = 2;
+        waitingTasks = [NSMutableArray array];
+        runningTasks = [NSMutableArray array];
+    }
+
+    return self;
+}
+
+- (void)scheduleTask:(NSURLSessionTask *)task withPriority:(JRConnectionPriority)priority
+{
+    JRScheduledTask *scheduledTask = [[JRScheduledTask alloc] init];
+    scheduledTask.task = task;
+    scheduledTask.priority = priority;
+    scheduledTask.scheduledTime = CFAbsoluteTimeGetCurrent();
+
+    [self.waitingTasks addObject:scheduledTask];
+    [self startWaitingTasks];
+}
+
+- (void)taskDidComplete:(NSURLSessionTask *)task
+{
+    /* A task that's cancelled before it's started completes straight out of the waiting list */
+    for (NSMutableArray *tasks in [NSArray arrayWithObjects:self.runningTasks, self.waitingTasks, nil])
+    {
+        NSUInteger index = [self indexOfTask:task in:tasks];
+        if (index != NSNotFound)
+        {
+            [tasks removeObjectAtIndex:index];
+            break;
+        }
+    }
+
+    [self startWaitingTasks];
+}
+
+- (void)beginRetryWithPriority:(JRConnectionPriority)priority
+{
+    retryingCounts[priority]++;
+}
+
+- (void)endRetryWithPriority:(JRConnectionPriority)priority
+{
+    if (retryingCounts[priority] == 0)
+    {
+        ALog(@"Unbalanced endRetryWithPriority: %ld", (long) priority);
+        return;
+    }
+
+    retryingCounts[priority]--;
+    [self startWaitingTasks];
+}
+
+- (NSUInteger)indexOfTask:(NSURLSessionTask *)task in:(NSArray *)tasks
+{
+    return [tasks indexOfObjectPassingTest:^BOOL(JRScheduledTask *scheduledTask, NSUInteger idx, BOOL *stop) {
+        return scheduledTask.task == task;
+    }];
+}
+
+- (NSUInteger)countOfTasksWithPriority:(JRConnectionPriority)priority in:(NSArray *)tasks
+{
+    return [[tasks indexesOfObjectsPassingTest:^BOOL(JRScheduledTask *scheduledTask, NSUInteger idx, BOOL *stop) {
+        return scheduledTask.priority == priority;
+    }] count];
+}
+
+- (BOOL)isCriticalPathActive
+{
+    return [self countOfTasksWithPriority:JRConnectionPriorityCritical in:self.runningTasks] > 0 ||
+            [self countOfTasksWithPriority:JRConnectionPriorityCritical in:self.waitingTasks] > 0 ||
+            retryingCounts[JRConnectionPriorityCritical] > 0;
+}
+
+- (void)startWaitingTasks
+{
+    BOOL criticalPathActive = [self isCriticalPathActive];
+    NSUInteger runningBackgroundTasks = [self countOfTasksWithPriority:JRConnectionPriorityBackground
+                                                                    in:self.runningTasks];
+
+    /* Waiting tasks are in scheduling order, so this starts each class first come first served */
+    for (JRScheduledTask *scheduledTask in [self.waitingTasks copy])
+    {
+        if (scheduledTask.priority == JRConnectionPriorityBackground)
+        {
+            if (criticalPathActive || runningBackgroundTasks >= self.maxConcurrentBackgroundTasks)
+                continue;
+
+            runningBackgroundTasks++;
+        }
+
+        [self.waitingTasks removeObjectIdenticalTo:scheduledTask];
+        [self.runningTasks addObject:scheduledTask];
+        [self recordDelayForTask:scheduledTask];
+        [scheduledTask.task resume];
+    }
+}
+
+- (void)recordDelayForTask:(JRScheduledTask *)scheduledTask
+{
+    NSTimeInterval delay = CFAbsoluteTimeGetCurrent() - scheduledTask.scheduledTime;
+    JRConnectionPriority priority = scheduledTask.priority;
+
+    startedCounts[priority]++;
+    totalDelays[priority] += delay;
+    maxDelays[priority] = MAX(maxDelays[priority], delay);
+
+    if (delay > 1.0)
+        DLog(@"%@ waited %f seconds to start", [[[scheduledTask.task originalRequest] URL] absoluteString], delay);
+}
+
+- (NSDictionary *)queueingDelaySnapshot
+{
+    NSArray *priorityNames = [NSArray arrayWithObjects:@"critical", @"normal", @"background", nil];
+    NSMutableDictionary *snapshot = [NSMutableDictionary dictionary];
+
+    for (NSUInteger priority = 0; priority < JRConnectionPriorityCount; priority++)
+        [snapshot setObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                  [NSNumber numberWithUnsignedInteger:startedCounts[priority]], @"count",
+                                                  [NSNumber numberWithDouble:totalDelays[priority]], @"totalDelay",
+                                                  [NSNumber numberWithDouble:maxDelays[priority]], @"maxDelay", nil]
+                     forKey:[priorityNames objectAtIndex:priority]];
+
+    return snapshot;
+}
+
+- (void)resetQueueingDelays
+{
+    for (NSUInteger priority = 0; priority < JRConnectionPriorityCount; priority++)
+    {
+        startedCounts[priority] = 0;
+        totalDelays[priority] = 0;
+        maxDelays[priority] = 0;
+    }
+}
+@end
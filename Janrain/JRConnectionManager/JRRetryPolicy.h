@@ -0,0 +1,75 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Describes when and how JRConnectionManager retries a failed request. A request is retried when it failed with a
+ * transient network error (timeout, lost connection, host unreachable) or one of the retryable HTTP status codes, it
+ * hasn't used up its attempts yet, and, if the policy is idempotent-only, its HTTP method is safe to repeat.
+ *
+ * The wait before retry n is <code>min(maxBackoff, initialBackoff * backoffMultiplier^(n - 1))</code>, less a random
+ * amount of up to \c jitter times that, so clients that failed together don't all come back together.
+ */
+@interface JRRetryPolicy : NSObject <NSCopying>
+@property(nonatomic) NSUInteger maxAttempts;
+@property(nonatomic) NSTimeInterval initialBackoff;
+@property(nonatomic) NSTimeInterval maxBackoff;
+@property(nonatomic) double backoffMultiplier;
+@property(nonatomic) double jitter;
+@property(nonatomic, copy) NSIndexSet *retryableStatusCodes;
+@property(nonatomic) BOOL idempotentOnly;
+
+/**
+ * Three attempts, half a second then a second apart (before jitter), on 408, 429, 500, 502, 503 and 504, for
+ * idempotent requests only. Used for requests that don't ask for anything else.
+ */
++ (JRRetryPolicy *)defaultPolicy;
+
+/**
+ * The default policy, minus the idempotent-only restriction. For POSTs that are safe to repeat, like fetching or
+ * replacing the entity.
+ */
++ (JRRetryPolicy *)idempotentPostPolicy;
+
+/**
+ * Never retries
+ */
++ (JRRetryPolicy *)noRetryPolicy;
+
+- (BOOL)isRetryableFailureOfRequest:(NSURLRequest *)request response:(NSURLResponse *)response error:(NSError *)error;
+
+- (BOOL)shouldRetryRequest:(NSURLRequest *)request response:(NSURLResponse *)response error:(NSError *)error
+                   attempt:(NSUInteger)attempt;
+
+- (NSTimeInterval)delayBeforeRetryAfterAttempt:(NSUInteger)attempt;
+@end
@@ -0,0 +1,152 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRRetryPolicy.h"
+
+@implementation JRRetryPolicy
+@synthesize maxAttempts;
+@synthesize initialBackoff;
+@synthesize maxBackoff;
+@synthesize backoffMultiplier;
+@synthesize jitter;
+@synthesize retryableStatusCodes;
+@synthesize idempotentOnly;
+
++ (JRRetryPolicy *)defaultPolicy
+{
+    JRRetryPolicy *policy = [[JRRetryPolicy alloc] init];
+
+    NSMutableIndexSet *statusCodes = [NSMutableIndexSet indexSetWithIndex:408];
+    [statusCodes addIndex:429];
+    [statusCodes addIndex:500];
+    [statusCodes addIndexesInRange:NSMakeRange(502, 3)];
+
+    policy.maxAttempts          = 3;
+    policy.initialBackoff       = 0.5;
+    policy.maxBackoff           = 8;
+    policy.backoffMultiplier    = 2;
+    policy.jitter               = 0.5;
+    policy.retryableStatusCodes = statusCodes;
+    policy.idempotentOnly       = YES;
+
+    return policy;
+}
+
++ (JRRetryPolicy *)idempotentPostPolicy
+{
+    JRRetryPolicy *policy = [JRRetryPolicy defaultPolicy];
+    policy.idempotentOnly = NO;
+
+    return policy;
+}
+
++ (JRRetryPolicy *)noRetryPolicy
+{
+    JRRetryPolicy *policy = [JRRetryPolicy defaultPolicy];
+    policy.maxAttempts = 1;
+
+    return policy;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    JRRetryPolicy *policyCopy = [[[self class] allocWithZone:zone] init];
+
+    policyCopy.maxAttempts          = self.maxAttempts;
+    policyCopy.initialBackoff       = self.initialBackoff;
+    policyCopy.maxBackoff           = self.maxBackoff;
+    policyCopy.backoffMultiplier    = self.backoffMultiplier;
+    policyCopy.jitter               = self.jitter;
+    policyCopy.retryableStatusCodes = self.retryableStatusCodes;
+    policyCopy.idempotentOnly       = self.idempotentOnly;
+
+    return policyCopy;
+}
+
++ (BOOL)isIdempotentMethod:(NSString *)method
+{
+    static NSSet *idempotentMethods = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        idempotentMethods = [NSSet setWithObjects:@"GET", @"HEAD", @"OPTIONS", @"PUT", @"DELETE", nil];
+    });
+
+    return [idempotentMethods containsObject:(method ? [method uppercaseString] : @"GET")];
+}
+
++ (BOOL)isTransientError:(NSError *)error
+{
+    if (![[error domain] isEqualToString:NSURLErrorDomain])
+        return NO;
+
+    switch ([error code])
+    {
+        case NSURLErrorTimedOut:
+        case NSURLErrorCannotFindHost:
+        case NSURLErrorCannotConnectToHost:
+        case NSURLErrorNetworkConnectionLost:
+        case NSURLErrorDNSLookupFailed:
+            return YES;
+        default:
+            return NO;
+    }
+}
+
+- (BOOL)isRetryableFailureOfRequest:(NSURLRequest *)request response:(NSURLResponse *)response error:(NSError *)error
+{
+    if (self.idempotentOnly && ![JRRetryPolicy isIdempotentMethod:[request HTTPMethod]])
+        return NO;
+
+    if (error)
+        return [JRRetryPolicy isTransientError:error];
+
+    if ([response isKindOfClass:[NSHTTPURLResponse class]])
+        return [self.retryableStatusCodes containsIndex:(NSUInteger) [(NSHTTPURLResponse *) response statusCode]];
+
+    return NO;
+}
+
+- (BOOL)shouldRetryRequest:(NSURLRequest *)request response:(NSURLResponse *)response error:(NSError *)error
+                   attempt:(NSUInteger)attempt
+{
+    return attempt < self.maxAttempts && [self isRetryableFailureOfRequest:request response:response error:error];
+}
+
+- (NSTimeInterval)delayBeforeRetryAfterAttempt:(NSUInteger)attempt
+{
+    NSTimeInterval delay = self.initialBackoff * pow(self.backoffMultiplier, attempt > 0 ? attempt - 1 : 0);
+    delay = MIN(delay, self.maxBackoff);
+
+    double random = (double) arc4random_uniform(UINT32_MAX) / UINT32_MAX;
+    return delay * (1 - self.jitter * random);
+}
+@end
@@ -0,0 +1,52 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <Foundation/Foundation.h>
+
+@class JRRequestMetricsCollector;
+
+/**
+ * @internal
+ * The delegate of JRConnectionManager's session. Tasks registered with parseJsonOfTask:completionHandler: have their
+ * body parsed as it arrives, chunk by chunk on the session's delegate queue, so by the time the last byte is in only
+ * the last chunk is left to parse; those tasks must be created without a completion handler, or the session never
+ * hands their data to the delegate. Task metrics are passed on to the metrics collector.
+ */
+@interface JRURLSessionDelegate : NSObject <NSURLSessionDataDelegate>
+
+- (id)initWithMetricsCollector:(JRRequestMetricsCollector *)metricsCollector;
+
+/**
+ * Register before resuming the task. The handler is called once, on the delegate queue, with the parsed body or the
+ * reason it couldn't be parsed, and with the transport error if the task failed, in which case the body is moot.
+ */
+- (void)parseJsonOfTask:(NSURLSessionTask *)task
+      completionHandler:(void (^)(id parsedJson, NSError *parseError, NSURLResponse *response, NSError *error))handler;
+@end
@@ -0,0 +1,123 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import "debug_log.h"
+#import "JRURLSessionDelegate.h"
+#import "JRRequestMetrics.h"
+#import "JRIncrementalJsonParser.h"
+#import "JRStageMetrics.h"
+
+@interface JRJsonTaskStream : NSObject
+@property(nonatomic) JRIncrementalJsonParser *parser;
+@property(nonatomic, copy) void (^handler)(id, NSError *, NSURLResponse *, NSError *);
+@end
+
+@implementation JRJsonTaskStream
+@synthesize parser;
+@synthesize handler;
+@end
+
+@interface JRURLSessionDelegate ()
+@property(nonatomic) JRRequestMetricsCollector *metricsCollector;
+@property(nonatomic) NSMapTable *streams;
+@property(nonatomic) dispatch_queue_t streamsQueue;
+@end
+
+@implementation JRURLSessionDelegate
+@synthesize metricsCollector;
+@synthesize streams;
+@synthesize streamsQueue;
+
+- (id)initWithMetricsCollector:(JRRequestMetricsCollector *)theMetricsCollector
+{
+    if ((self = [super init]))
+    {
+        metricsCollector = theMetricsCollector;
+        streams = [NSMapTable strongToStrongObjectsMapTable];
+        streamsQueue = dispatch_queue_create("com.janrain.JRURLSessionDelegate.streams", DISPATCH_QUEUE_SERIAL);
+    }
+
+    return self;
+}
+
+- (void)parseJsonOfTask:(NSURLSessionTask *)task
+      completionHandler:(void (^)(id parsedJson, NSError *parseError, NSURLResponse *response, NSError *error))handler
+{
+    JRJsonTaskStream *stream = [[JRJsonTaskStream alloc] init];
+    stream.parser = [[JRIncrementalJsonParser alloc] init];
+    stream.handler = handler;
+
+    dispatch_sync(self.streamsQueue, ^{
+        [self->streams setObject:stream forKey:task];
+    });
+}
+
+- (JRJsonTaskStream *)streamForTask:(NSURLSessionTask *)task remove:(BOOL)remove
+{
+    __block JRJsonTaskStream *stream;
+    dispatch_sync(self.streamsQueue, ^{
+        stream = [self->streams objectForKey:task];
+        if (remove) [self->streams removeObjectForKey:task];
+    });
+
+    return stream;
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data
+{
+    JRIncrementalJsonParser *parser = [[self streamForTask:dataTask remove:NO] parser];
+    if (!parser || parser.error) return;
+
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        JR_STAGE_BEGIN(JRStageJSONParseChunk);
+        BOOL ok = [parser appendBytes:bytes length:byteRange.length];
+        JR_STAGE_END(JRStageJSONParseChunk);
+        if (!ok) *stop = YES;
+    }];
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error
+{
+    JRJsonTaskStream *stream = [self streamForTask:task remove:YES];
+    if (!stream) return;
+
+    NSError *parseError = nil;
+    id parsedJson = error ? nil : [stream.parser finishWithError:&parseError];
+    if (parseError) DLog(@"parse error after %lu bytes: %@", (unsigned long) stream.parser.bytesParsed, parseError);
+
+    stream.handler(parsedJson, parseError, task.response, error);
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task
+        didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)taskMetrics
+{
+    [self.metricsCollector URLSession:session task:task didFinishCollectingMetrics:taskMetrics];
+}
+@end
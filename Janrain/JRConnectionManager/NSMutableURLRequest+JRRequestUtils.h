@@ -33,4 +33,17 @@
 @interface NSMutableURLRequest (JRRequestUtils)
 + (NSMutableURLRequest *)JR_requestWithURL:(NSURL *)url params:(NSDictionary *)dictionary;
 - (void)JR_setBodyWithParams:(NSDictionary *)dictionary;
+
+/**
+ * Names what the request is for ("config", "flow", "token_url", "entity", "entity.update", "refresh", ...) so its
+ * metrics can be told apart from those of other requests to the same host
+ */
+- (void)JR_setOperationName:(NSString *)operationName;
+@end
+
+@interface NSURLRequest (JRRequestUtils)
+/**
+ * The name set with NSMutableURLRequest#JR_setOperationName:, or the last component of the URL's path if none was
+ */
+- (NSString *)JR_operationName;
 @end
\ No newline at end of file
@@ -32,6 +32,8 @@
 #import "NSDictionary+JRQueryParams.h"
 #import "debug_log.h"
 
+static NSString *const JROperationNameKey = @"JROperationName";
+
 @implementation NSMutableURLRequest (JRRequestUtils)
 + (NSMutableURLRequest *)JR_requestWithURL:(NSURL *)url params:(NSDictionary *)params {
     NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:url];
@@ -47,4 +49,22 @@
     DLog(@"Adding params to %@: %@", self, paramString);
     [self setHTTPBody:[paramString dataUsingEncoding:NSUTF8StringEncoding]];
 }
+
+- (void)JR_setOperationName:(NSString *)operationName
+{
+    /* Protocol properties are copied along with the request, so the name is still there on the task's request */
+    [NSURLProtocol setProperty:operationName forKey:JROperationNameKey inRequest:self];
+}
+@end
+
+@implementation NSURLRequest (JRRequestUtils)
+- (NSString *)JR_operationName
+{
+    NSString *operationName = [NSURLProtocol propertyForKey:JROperationNameKey inRequest:self];
+    if (operationName)
+        return operationName;
+
+    NSString *lastPathComponent = [[self URL] lastPathComponent];
+    return [lastPathComponent length] ? lastPathComponent : @"unknown";
+}
 @end
@@ -0,0 +1,71 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+@class JRSessionStore;
+
+/**
+ * @internal
+ * Sends one buffered event, calling the completion with whether the server took it. Called on the main thread.
+ */
+typedef void (^JRAnalyticsEventSender)(NSDictionary *event, void (^completion)(BOOL sent));
+
+/**
+ * @internal
+ * Buffers fire-and-forget analytics events (the email and SMS share records) instead of sending each one as it
+ * happens. The buffer is kept in the session store so it survives relaunches, and is sent flushInterval seconds after
+ * the first event goes into it, or when the app goes to the background, as one burst of back-to-back requests. A
+ * failed send stops the burst and keeps what's left for next time, backing off up to maxFlushInterval. When the
+ * buffer is full the oldest events are dropped. Main thread only.
+ */
+@interface JRAnalyticsBeacon : NSObject
+@property(readonly) NSUInteger capacity;
+@property(readonly) NSTimeInterval flushInterval;
+@property(readonly) NSTimeInterval maxFlushInterval;
+@property(readonly) NSUInteger droppedEventCount;
+
+- (id)initWithStore:(JRSessionStore *)store key:(NSString *)key capacity:(NSUInteger)capacity
+      flushInterval:(NSTimeInterval)flushInterval maxFlushInterval:(NSTimeInterval)maxFlushInterval
+             sender:(JRAnalyticsEventSender)sender;
+
+/**
+ * The event should be a property list, as it's saved in NSUserDefaults.
+ */
+- (void)recordEvent:(NSDictionary *)event;
+
+/**
+ * Starts sending what's buffered now, unless a burst is already under way.
+ */
+- (void)flush;
+
+- (NSArray *)pendingEvents;
+@end
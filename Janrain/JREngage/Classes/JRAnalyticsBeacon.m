@@ -0,0 +1,185 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <UIKit/UIKit.h>
+#import "JRAnalyticsBeacon.h"
+#import "JRSessionStore.h"
+#import "debug_log.h"
+
+@implementation JRAnalyticsBeacon
+{
+    JRSessionStore *store;
+    NSString *key;
+    JRAnalyticsEventSender sender;
+
+    NSMutableArray *events;
+    NSTimeInterval currentFlushInterval;
+    BOOL flushScheduled;
+    BOOL sending;
+
+    /* Bumped whenever the schedule changes, so that superseded dispatch_afters do nothing */
+    NSUInteger flushGeneration;
+}
+
+@synthesize capacity;
+@synthesize flushInterval;
+@synthesize maxFlushInterval;
+@synthesize droppedEventCount;
+
+- (id)initWithStore:(JRSessionStore *)theStore key:(NSString *)theKey capacity:(NSUInteger)theCapacity
+      flushInterval:(NSTimeInterval)theFlushInterval maxFlushInterval:(NSTimeInterval)theMaxFlushInterval
+             sender:(JRAnalyticsEventSender)theSender
+{
+    if ((self = [super init]))
+    {
+        store = theStore;
+        key = [theKey copy];
+        capacity = MAX(theCapacity, 1);
+        flushInterval = theFlushInterval;
+        maxFlushInterval = MAX(theMaxFlushInterval, theFlushInterval);
+        sender = [theSender copy];
+        currentFlushInterval = flushInterval;
+
+        NSArray *savedEvents = [store objectForKey:key];
+        events = [savedEvents isKindOfClass:[NSArray class]] ? [savedEvents mutableCopy] : [NSMutableArray array];
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(applicationDidEnterBackground:)
+                                                     name:UIApplicationDidEnterBackgroundNotification object:nil];
+
+        /* Whatever didn't get sent last time goes out with the next scheduled flush */
+        if ([events count]) [self scheduleFlush];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)applicationDidEnterBackground:(NSNotification *)notification
+{
+    [self flush];
+}
+
+- (NSArray *)pendingEvents
+{
+    return [NSArray arrayWithArray:events];
+}
+
+- (void)saveEvents
+{
+    [store setObject:([events count] ? [NSArray arrayWithArray:events] : nil) forKey:key];
+}
+
+- (void)recordEvent:(NSDictionary *)event
+{
+    if (!event) return;
+
+    if ([events count] >= capacity)
+    {
+        [events removeObjectAtIndex:0];
+        droppedEventCount++;
+        JRLogWarning(@"Analytics buffer full, dropped the oldest event (%lu dropped so far)",
+                     (unsigned long) droppedEventCount);
+    }
+
+    [events addObject:event];
+    [self saveEvents];
+
+    if (!flushScheduled && !sending) [self scheduleFlush];
+}
+
+- (void)scheduleFlush
+{
+    flushScheduled = YES;
+    NSUInteger generation = ++flushGeneration;
+
+    __weak JRAnalyticsBeacon *weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (currentFlushInterval * NSEC_PER_SEC)),
+                   dispatch_get_main_queue(), ^
+    {
+        JRAnalyticsBeacon *beacon = weakSelf;
+        if (beacon && beacon->flushGeneration == generation)
+            [beacon flush];
+    });
+}
+
+- (void)flush
+{
+    flushScheduled = NO;
+    flushGeneration++;
+
+    if (sending || ![events count]) return;
+
+    sending = YES;
+    [self sendEventsFrom:0 count:[events count]];
+}
+
+/* Sends the first count events one after another. Events stay in the buffer (and on disk) until they're sent. */
+- (void)sendEventsFrom:(NSUInteger)sentCount count:(NSUInteger)count
+{
+    if (sentCount == count || ![events count])
+    {
+        [self finishSendingWithFailure:NO];
+        return;
+    }
+
+    /* A full buffer can drop this event while it's on its way, so don't assume it's still first when it's done */
+    NSDictionary *event = [events objectAtIndex:0];
+    __weak JRAnalyticsBeacon *weakSelf = self;
+    sender(event, ^(BOOL sent)
+    {
+        JRAnalyticsBeacon *beacon = weakSelf;
+        if (!beacon) return;
+
+        if (!sent)
+        {
+            [beacon finishSendingWithFailure:YES];
+            return;
+        }
+
+        [beacon->events removeObjectIdenticalTo:event];
+        [beacon saveEvents];
+        [beacon sendEventsFrom:sentCount + 1 count:count];
+    });
+}
+
+- (void)finishSendingWithFailure:(BOOL)failed
+{
+    sending = NO;
+    currentFlushInterval = failed ? MIN(currentFlushInterval * 2, maxFlushInterval) : flushInterval;
+
+    /* Events recorded during the burst, or left over from a failed one */
+    if ([events count]) [self scheduleFlush];
+}
+@end
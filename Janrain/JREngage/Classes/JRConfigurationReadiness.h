@@ -0,0 +1,60 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Waits, without polling, for something the session data is still downloading - typically the provider lists - to
+ * become available. The condition is checked straight away, and again each time the sender posts the notification
+ * (JRFinishedUpdatingEngageConfigurationNotification, for the dialogs); the completion runs exactly once, with YES
+ * as soon as the condition holds or NO when the timeout expires first. If the sender posts the failure notification
+ * (JRFailedToUpdateEngageConfigurationNotification) the wait ends then, with NO unless the condition holds anyway.
+ * Use from the main thread; the completion always runs there.
+ */
+@interface JRConfigurationReadiness : NSObject
+- (id)initWithSender:(id)sender notificationName:(NSString *)notificationName condition:(BOOL (^)(void))condition;
+
+- (id)initWithSender:(id)sender notificationName:(NSString *)notificationName
+        failureNotificationName:(NSString *)failureNotificationName condition:(BOOL (^)(void))condition;
+
+/**
+ * Runs the completion synchronously if the condition already holds, so callers don't need a separate fast path.
+ */
+- (void)waitWithTimeout:(NSTimeInterval)timeout completion:(void (^)(BOOL ready))completion;
+
+/**
+ * Stops waiting without running the completion. Also done on dealloc.
+ */
+- (void)cancel;
+
+@property(readonly, getter=isWaiting) BOOL waiting;
+@end
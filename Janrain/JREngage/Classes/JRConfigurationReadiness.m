@@ -0,0 +1,143 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRConfigurationReadiness.h"
+
+@interface JRConfigurationReadiness ()
+@property(copy) BOOL (^condition)(void);
+@property(copy) void (^completion)(BOOL ready);
+@property id observer;
+@property id failureObserver;
+@property(readwrite, getter=isWaiting) BOOL waiting;
+@end
+
+@implementation JRConfigurationReadiness
+{
+    id sender;
+    NSString *notificationName;
+    NSString *failureNotificationName;
+}
+
+@synthesize condition;
+@synthesize completion;
+@synthesize observer;
+@synthesize failureObserver;
+@synthesize waiting;
+
+- (id)initWithSender:(id)theSender notificationName:(NSString *)theNotificationName condition:(BOOL (^)(void))theCondition
+{
+    return [self initWithSender:theSender notificationName:theNotificationName failureNotificationName:nil
+                      condition:theCondition];
+}
+
+- (id)initWithSender:(id)theSender notificationName:(NSString *)theNotificationName
+        failureNotificationName:(NSString *)theFailureNotificationName condition:(BOOL (^)(void))theCondition
+{
+    if ((self = [super init]))
+    {
+        sender = theSender;
+        notificationName = [theNotificationName copy];
+        failureNotificationName = [theFailureNotificationName copy];
+        self.condition = theCondition;
+    }
+
+    return self;
+}
+
+- (void)waitWithTimeout:(NSTimeInterval)timeout completion:(void (^)(BOOL ready))theCompletion
+{
+    [self cancel];
+
+    if (self.condition())
+    {
+        theCompletion(YES);
+        return;
+    }
+
+    self.completion = theCompletion;
+    self.waiting = YES;
+
+    __weak JRConfigurationReadiness *weakSelf = self;
+    self.observer = [[NSNotificationCenter defaultCenter] addObserverForName:notificationName object:sender
+                                                                       queue:[NSOperationQueue mainQueue]
+                                                                  usingBlock:^(NSNotification *notification)
+                                                                  {
+                                                                      JRConfigurationReadiness *readiness = weakSelf;
+                                                                      if (readiness.condition()) [readiness finish:YES];
+                                                                  }];
+
+    /* No point waiting out the timeout for a download that's already failed */
+    if (failureNotificationName)
+    {
+        NSNotificationCenter *center = [NSNotificationCenter defaultCenter];
+        self.failureObserver = [center addObserverForName:failureNotificationName object:sender
+                                                    queue:[NSOperationQueue mainQueue]
+                                               usingBlock:^(NSNotification *notification)
+                                               {
+                                                   JRConfigurationReadiness *readiness = weakSelf;
+                                                   [readiness finish:readiness.condition()];
+                                               }];
+    }
+
+    /* The completion captured here tells a stale timeout (from before a cancel or a second wait) from the live one */
+    void (^expected)(BOOL) = self.completion;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (timeout * NSEC_PER_SEC)), dispatch_get_main_queue(), ^
+    {
+        JRConfigurationReadiness *readiness = weakSelf;
+        if (readiness.completion == expected) [readiness finish:NO];
+    });
+}
+
+- (void)finish:(BOOL)ready
+{
+    void (^theCompletion)(BOOL) = self.completion;
+    [self cancel];
+
+    if (theCompletion) theCompletion(ready);
+}
+
+- (void)cancel
+{
+    if (self.observer) [[NSNotificationCenter defaultCenter] removeObserver:self.observer];
+    if (self.failureObserver) [[NSNotificationCenter defaultCenter] removeObserver:self.failureObserver];
+
+    self.observer = nil;
+    self.failureObserver = nil;
+    self.completion = nil;
+    self.waiting = NO;
+}
+
+- (void)dealloc
+{
+    if (observer) [[NSNotificationCenter defaultCenter] removeObserver:observer];
+    if (failureObserver) [[NSNotificationCenter defaultCenter] removeObserver:failureObserver];
+}
+@end
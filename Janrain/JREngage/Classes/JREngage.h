@@ -583,6 +583,16 @@ FOUNDATION_EXPORT NSString *const JRFailedToUpdateEngageConfigurationNotificatio
  * Returns the currently configured token URL (or nil if none is configured)
  */
 + (NSString *)tokenUrl __unused;
+
+/**
+ * Use this function to have the library open connections to the Engage servers and your token URL as soon as it
+ * knows them, and again when the app returns to the foreground or the network changes, so that the first
+ * sign-in requests don't wait on DNS lookups and TLS handshakes. Off by default.
+ *
+ * @param preconnect
+ *   \c YES to warm up connections ahead of the first requests
+ **/
++ (void)setPreconnectEnabled:(BOOL)preconnect;
 /*@}*/
 
 
@@ -34,6 +34,7 @@
 #import "debug_log.h"
 #import "JREngage.h"
 #import "JRSessionData.h"
+#import "JRConnectionManager.h"
 #import "JRUserInterfaceMaestro.h"
 #import "JREngageError.h"
 #import "JROpenIDAppAuth.h"
@@ -646,6 +647,12 @@ static JREngage* singleton = nil;
 {
     DLog(@"new token URL: %@", newTokenUrl);
     [sessionData setTokenUrl:newTokenUrl];
+    [sessionData preconnectToEngageHosts];
+}
+
++ (void)setPreconnectEnabled:(BOOL)preconnect
+{
+    [JRConnectionManager setPreconnectEnabled:preconnect];
 }
 
 + (NSString *)tokenUrl
@@ -0,0 +1,107 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Hands back the data for an icon shipped with the app, or nil.
+ */
+typedef NSData *(^JRIconBundleLoader)(NSString *name);
+
+/**
+ * @internal
+ * Downloads an icon that isn't shipped or cached, calling the completion (on any queue) with its data, or nil.
+ */
+typedef void (^JRIconFetcher)(NSString *name, void (^completion)(NSData *data));
+
+/**
+ * @internal
+ * Turns icon data into whatever the platform draws (a fully decoded UIImage, on iOS). Runs on a background queue.
+ */
+typedef id (^JRIconDecoder)(NSData *data);
+
+/**
+ * @internal
+ * The platform neutral core of the provider icon pipeline: Foundation and libdispatch only, with the bundle, network
+ * and image decoding supplied as blocks (see JRProviderIcons for the iOS wiring).
+ *
+ * Icons are looked up by file name, first in a bounded, least recently used memory cache of decoded icons, then (on a
+ * background queue) in the bundle, then in the on-disk cache, and finally through the fetcher, whose results are
+ * written to disk. Concurrent requests for the same icon share one lookup, and every completion runs on the
+ * callback queue (the main queue unless set otherwise). Icons the fetcher couldn't find aren't asked for again until
+ * -forgetUnavailableIcons or one of the remove methods is called.
+ */
+@interface JRIconCache : NSObject
+@property(readonly) NSString *diskCacheDirectory;
+@property(readonly) NSUInteger memoryCapacity;
+
+- (id)initWithDiskCacheDirectory:(NSString *)diskCacheDirectory memoryCapacity:(NSUInteger)memoryCapacity
+                    bundleLoader:(JRIconBundleLoader)bundleLoader fetcher:(JRIconFetcher)fetcher
+                         decoder:(JRIconDecoder)decoder;
+
+/**
+ * "icon_facebook_30x30.png", "icon_bw_twitter_30x30.png" and so on, the names the icons ship under.
+ */
++ (NSString *)iconNameForProvider:(NSString *)providerName blackAndWhite:(BOOL)blackAndWhite
+                            width:(NSUInteger)width height:(NSUInteger)height;
+
+/**
+ * Memory cache only, so it's cheap enough to call while configuring a table cell. Counts as a use for the LRU.
+ */
+- (id)cachedIconNamed:(NSString *)name;
+
+/**
+ * Completes with nil if the icon couldn't be found anywhere.
+ */
+- (void)iconNamed:(NSString *)name completion:(void (^)(id icon))completion;
+
+/**
+ * Brings the icons into the memory cache ahead of time, fetching any that are missing.
+ */
+- (void)prefetchIconsNamed:(NSArray *)names;
+
+- (void)removeAllIconsFromMemory;
+
+- (void)forgetUnavailableIcons;
+
+/**
+ * Empties the memory cache and deletes everything in the disk cache directory.
+ */
+- (void)removeAllIcons;
+
+- (NSUInteger)memoryCount;
+
+/**
+ * Defaults to the main queue.
+ */
+- (void)setCallbackQueue:(dispatch_queue_t)callbackQueue;
+@end
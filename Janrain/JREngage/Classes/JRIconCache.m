@@ -0,0 +1,280 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRIconCache.h"
+#import "debug_log.h"
+
+@implementation JRIconCache
+{
+    JRIconBundleLoader bundleLoader;
+    JRIconFetcher fetcher;
+    JRIconDecoder decoder;
+
+    /* Everything below is only touched on stateQueue */
+    dispatch_queue_t stateQueue;
+    dispatch_queue_t callbackQueue;
+    NSMutableDictionary *icons;
+    NSMutableArray *leastRecentlyUsed;
+    NSMutableDictionary *waitingCompletions;
+    NSMutableSet *unavailableIcons;
+}
+
+@synthesize diskCacheDirectory;
+@synthesize memoryCapacity;
+
+- (id)initWithDiskCacheDirectory:(NSString *)theDiskCacheDirectory memoryCapacity:(NSUInteger)theMemoryCapacity
+                    bundleLoader:(JRIconBundleLoader)theBundleLoader fetcher:(JRIconFetcher)theFetcher
+                         decoder:(JRIconDecoder)theDecoder
+{
+    if ((self = [super init]))
+    {
+        diskCacheDirectory = [theDiskCacheDirectory copy];
+        memoryCapacity = MAX(theMemoryCapacity, 1);
+        bundleLoader = [theBundleLoader copy];
+        fetcher = [theFetcher copy];
+        decoder = [theDecoder copy];
+
+        stateQueue = dispatch_queue_create("com.janrain.engage.iconCache", DISPATCH_QUEUE_SERIAL);
+        callbackQueue = dispatch_get_main_queue();
+        icons = [NSMutableDictionary dictionary];
+        leastRecentlyUsed = [NSMutableArray array];
+        waitingCompletions = [NSMutableDictionary dictionary];
+        unavailableIcons = [NSMutableSet set];
+    }
+
+    return self;
+}
+
++ (NSString *)iconNameForProvider:(NSString *)providerName blackAndWhite:(BOOL)blackAndWhite
+                            width:(NSUInteger)width height:(NSUInteger)height
+{
+    return [NSString stringWithFormat:@"icon_%@%@_%lux%lu.png", blackAndWhite ? @"bw_" : @"", providerName,
+                                      (unsigned long) width, (unsigned long) height];
+}
+
+- (void)setCallbackQueue:(dispatch_queue_t)theCallbackQueue
+{
+    dispatch_sync(stateQueue, ^
+    {
+        self->callbackQueue = theCallbackQueue;
+    });
+}
+
+- (NSString *)diskPathForIconNamed:(NSString *)name
+{
+    if (!diskCacheDirectory) return nil;
+
+    /* Names come from provider names in the server's configuration, so keep them from reaching outside the cache */
+    NSString *fileName = [[name stringByReplacingOccurrencesOfString:@"/" withString:@"_"]
+            stringByReplacingOccurrencesOfString:@".." withString:@"_"];
+    return [diskCacheDirectory stringByAppendingPathComponent:fileName];
+}
+
+#pragma mark memory cache (on stateQueue)
+
+- (id)iconFromMemoryNamed:(NSString *)name
+{
+    id icon = [icons objectForKey:name];
+    if (icon)
+    {
+        [leastRecentlyUsed removeObject:name];
+        [leastRecentlyUsed addObject:name];
+    }
+
+    return icon;
+}
+
+- (void)storeIconInMemory:(id)icon named:(NSString *)name
+{
+    if (![icons objectForKey:name])
+    {
+        while ([leastRecentlyUsed count] >= memoryCapacity)
+        {
+            [icons removeObjectForKey:[leastRecentlyUsed objectAtIndex:0]];
+            [leastRecentlyUsed removeObjectAtIndex:0];
+        }
+    }
+
+    [icons setObject:icon forKey:name];
+    [leastRecentlyUsed removeObject:name];
+    [leastRecentlyUsed addObject:name];
+}
+
+#pragma mark lookup
+
+- (id)cachedIconNamed:(NSString *)name
+{
+    if (!name) return nil;
+
+    __block id icon;
+    dispatch_sync(stateQueue, ^
+    {
+        icon = [self iconFromMemoryNamed:name];
+    });
+
+    return icon;
+}
+
+- (void)iconNamed:(NSString *)name completion:(void (^)(id icon))completion
+{
+    void (^theCompletion)(id) = completion ? [completion copy] : ^(id icon) {};
+
+    dispatch_async(stateQueue, ^
+    {
+        /* Icons that couldn't be fetched aren't asked for again until the caches are cleared */
+        id icon = name ? [self iconFromMemoryNamed:name] : nil;
+        if (icon || !name || [self->unavailableIcons containsObject:name])
+        {
+            dispatch_async(self->callbackQueue, ^{ theCompletion(icon); });
+            return;
+        }
+
+        NSMutableArray *waiting = [self->waitingCompletions objectForKey:name];
+        if (waiting)
+        {
+            [waiting addObject:theCompletion];
+            return;
+        }
+
+        [self->waitingCompletions setObject:[NSMutableArray arrayWithObject:theCompletion] forKey:name];
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_LOW, 0), ^
+        {
+            [self loadIconNamed:name];
+        });
+    });
+}
+
+- (void)prefetchIconsNamed:(NSArray *)names
+{
+    for (NSString *name in names)
+        [self iconNamed:name completion:nil];
+}
+
+/* On a background queue */
+- (void)loadIconNamed:(NSString *)name
+{
+    NSData *data = bundleLoader ? bundleLoader(name) : nil;
+
+    NSString *diskPath = [self diskPathForIconNamed:name];
+    if (!data && diskPath)
+        data = [NSData dataWithContentsOfFile:diskPath];
+
+    if (data)
+    {
+        [self finishLoadingIconNamed:name data:data unavailable:NO];
+        return;
+    }
+
+    if (!fetcher)
+    {
+        [self finishLoadingIconNamed:name data:nil unavailable:NO];
+        return;
+    }
+
+    fetcher(name, ^(NSData *fetchedData)
+    {
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_LOW, 0), ^
+        {
+            if (fetchedData && diskPath)
+            {
+                [[NSFileManager defaultManager] createDirectoryAtPath:self->diskCacheDirectory
+                                          withIntermediateDirectories:YES attributes:nil error:nil];
+                if (![fetchedData writeToFile:diskPath atomically:YES])
+                    JRLogWarning(@"Couldn't cache icon %@ at %@", name, diskPath);
+            }
+
+            [self finishLoadingIconNamed:name data:fetchedData unavailable:!fetchedData];
+        });
+    });
+}
+
+/* On a background queue */
+- (void)finishLoadingIconNamed:(NSString *)name data:(NSData *)data unavailable:(BOOL)unavailable
+{
+    id icon = data ? decoder(data) : nil;
+    if (data && !icon)
+        JRLogWarning(@"Couldn't decode icon %@", name);
+
+    dispatch_async(stateQueue, ^
+    {
+        if (icon) [self storeIconInMemory:icon named:name];
+        if (unavailable) [self->unavailableIcons addObject:name];
+
+        NSArray *waiting = [self->waitingCompletions objectForKey:name];
+        [self->waitingCompletions removeObjectForKey:name];
+
+        dispatch_async(self->callbackQueue, ^
+        {
+            for (void (^completion)(id) in waiting)
+                completion(icon);
+        });
+    });
+}
+
+#pragma mark housekeeping
+
+- (NSUInteger)memoryCount
+{
+    __block NSUInteger count;
+    dispatch_sync(stateQueue, ^
+    {
+        count = [self->icons count];
+    });
+
+    return count;
+}
+
+- (void)removeAllIconsFromMemory
+{
+    dispatch_sync(stateQueue, ^
+    {
+        [self->icons removeAllObjects];
+        [self->leastRecentlyUsed removeAllObjects];
+        [self->unavailableIcons removeAllObjects];
+    });
+}
+
+- (void)forgetUnavailableIcons
+{
+    dispatch_sync(stateQueue, ^
+    {
+        [self->unavailableIcons removeAllObjects];
+    });
+}
+
+- (void)removeAllIcons
+{
+    [self removeAllIconsFromMemory];
+
+    if (diskCacheDirectory)
+        [[NSFileManager defaultManager] removeItemAtPath:diskCacheDirectory error:nil];
+}
+@end
@@ -30,12 +30,15 @@
 
 #import "JRJsonUtils.h"
 #import "debug_log.h"
+#import "JRStageMetrics.h"
 
 @implementation JRJsonUtils
 + (NSString *)jsonStringForJsonObject:(id)jsonObject
 {
     NSError *jsonErr = nil;
+    JR_STAGE_BEGIN(JRStageJSONSerialize);
     NSData *jsonData = [NSJSONSerialization dataWithJSONObject:jsonObject options:0 error:&jsonErr];
+    JR_STAGE_END(JRStageJSONSerialize);
     if (jsonErr) ALog("WARNING, JSON serialization error: %@", jsonErr);
     NSString *jsonString = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
     return jsonString;
@@ -50,7 +53,9 @@
 + (id)jsonObjectWithData:(NSData *)jsonData
 {
     NSError *jsonErr = nil;
+    JR_STAGE_BEGIN(JRStageJSONParse);
     id jsonObject = [NSJSONSerialization JSONObjectWithData:jsonData options:(NSJSONReadingOptions) 0 error:&jsonErr];
+    JR_STAGE_END(JRStageJSONParse);
     if (jsonErr) ALog("WARNING, JSON parse error: %@", jsonErr);
     return jsonObject;
 }
@@ -36,50 +36,52 @@
 #import "JRPreviewLabel.h"
 #import "JRUserInterfaceMaestro.h"
 #import "JRCompatibilityUtils.h"
+#import "JRTextFitter.h"
 
-@interface NSString (visibleText)
-- (NSUInteger)lengthOfStringVisibleInSize:(CGSize)size withFont:(UIFont *)font
-                         andLineBreakMode:(JRLineBreakMode)lineBreakMode;
+/* Measures with one font and line break mode, remembering sizes per constraint, since rebuilding the text lays out
+   the same lines again every time the user types */
+@interface JRFontTextMeasurer : NSObject <JRTextMeasurer>
+- (id)initWithFont:(UIFont *)font lineBreakMode:(JRLineBreakMode)lineBreakMode;
 @end
 
-@implementation NSString (visibleText)
-
-- (NSUInteger)lengthOfStringVisibleInSize:(CGSize)size withFont:(UIFont *)font
-                         andLineBreakMode:(JRLineBreakMode)lineBreakMode
+@implementation JRFontTextMeasurer
 {
-    if (self.length == 0)
-        return 0;
-
-    NSInteger indexOfLastBreakingCharacter = -1;
-    NSString *visibleString = @"";
-    CGFloat   lineHeight = ([font respondsToSelector:@selector(lineHeight)]) ? 
-                             font.lineHeight : font.ascender - font.descender + 1.0;
+    UIFont *font;
+    JRLineBreakMode lineBreakMode;
+    NSCache *sizes;
+}
 
-    for (NSUInteger i = 1; i <= self.length; i++)
+- (id)initWithFont:(UIFont *)theFont lineBreakMode:(JRLineBreakMode)theLineBreakMode
+{
+    if ((self = [super init]))
     {
-        unichar currentChar = [self characterAtIndex:i - 1];
-        if ([[NSCharacterSet whitespaceAndNewlineCharacterSet] characterIsMember:currentChar] || currentChar == '-')
-            indexOfLastBreakingCharacter = i - 1;
+        font = theFont;
+        lineBreakMode = theLineBreakMode;
+        sizes = [[NSCache alloc] init];
+        sizes.countLimit = 512;
+    }
 
-        NSString *testString = [self substringToIndex:i];
-        
-        CGSize stringSize = [JRCompatibilityUtils jrGetSizeOfString:testString
-                                                               font:font
-                                                  constrainedToSize:CGSizeMake(size.width, size.height + lineHeight)
-                                                      lineBreakMode:lineBreakMode];
+    return self;
+}
 
-        if (stringSize.height > size.height || stringSize.width > size.width)
-            break;
+- (CGFloat)lineHeight
+{
+    return ([font respondsToSelector:@selector(lineHeight)]) ? font.lineHeight : font.ascender - font.descender + 1.0;
+}
 
-        visibleString = testString;
-    }
+- (CGSize)sizeOfString:(NSString *)string constrainedToSize:(CGSize)size
+{
+    NSString *key = [NSString stringWithFormat:@"%g,%g:%@", size.width, size.height, string];
+    NSValue *cachedSize = [sizes objectForKey:key];
+    if (cachedSize)
+        return [cachedSize CGSizeValue];
 
-    if (lineBreakMode == JR_LINE_BREAK_MODE_WORD_WRAP && indexOfLastBreakingCharacter != -1)
-        return (NSUInteger)indexOfLastBreakingCharacter + 1;
+    CGSize stringSize = [JRCompatibilityUtils jrGetSizeOfString:string font:font constrainedToSize:size
+                                                  lineBreakMode:lineBreakMode];
+    [sizes setObject:[NSValue valueWithCGSize:stringSize] forKey:key];
 
-    return visibleString.length;
+    return stringSize;
 }
-
 @end
 
 @interface JRPreviewLabel ()
@@ -101,6 +103,8 @@
 
     id<JRPreviewLabelDelegate> delegate;
     CGFloat contentHeight;
+
+    JRTextFitter *textFitter;
 }
 
 - (void)rebuildText;
@@ -133,6 +137,10 @@
     font     = [UIFont systemFontOfSize:fontSize];
     boldFont = [UIFont boldSystemFontOfSize:fontSize];
 
+    textFitter = [[JRTextFitter alloc] initWithMeasurer:[[JRFontTextMeasurer alloc]
+                                                                initWithFont:font
+                                                               lineBreakMode:JR_LINE_BREAK_MODE_WORD_WRAP]];
+
     usernameLabel = [[UILabel alloc] init];
     usernameLabel.numberOfLines = 1;
     usernameLabel.lineBreakMode = JR_LINE_BREAK_MODE_TAIL_TRUNCATION;
@@ -270,9 +278,9 @@
     {
         wrapTextToSecondLine = YES;
 
-        lengthOfFirstLineOfText = [userText lengthOfStringVisibleInSize:CGSizeMake(sizeOfFirstLineOfText.width, lineHeight)
-                                                               withFont:font
-                                                       andLineBreakMode:(int)JR_LINE_BREAK_MODE_WORD_WRAP];
+        lengthOfFirstLineOfText = [textFitter lengthOfString:userText
+                                               visibleInSize:CGSizeMake(sizeOfFirstLineOfText.width, lineHeight)
+                                                breakAtWords:YES];
 
         firstLineOfText = [userText substringToIndex:lengthOfFirstLineOfText];
 
@@ -293,9 +301,9 @@
         {
             wrapTextToThirdLine = YES;
 
-            lengthOfSecondLineOfText = [remainingText lengthOfStringVisibleInSize:CGSizeMake(sizeOfSecondLineOfText.width, lineHeight)
-                                                                withFont:font
-                                                        andLineBreakMode:(int)JR_LINE_BREAK_MODE_WORD_WRAP];
+            lengthOfSecondLineOfText = [textFitter lengthOfString:remainingText
+                                                    visibleInSize:CGSizeMake(sizeOfSecondLineOfText.width, lineHeight)
+                                                     breakAtWords:YES];
 
             secondLineOfText = [remainingText substringToIndex:lengthOfSecondLineOfText];
 
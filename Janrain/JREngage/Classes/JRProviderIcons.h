@@ -0,0 +1,75 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+
+@class JRIconCache;
+
+typedef NS_ENUM(NSUInteger, JRProviderIconStyle)
+{
+    JRProviderIconStyleColor = 0,
+    JRProviderIconStyleBlackAndWhite
+};
+
+/**
+ * @internal
+ * Provider icons for the Engage dialogs, in place of synchronous +[UIImage imageNamed:] calls. Bundled icons are
+ * read and decoded off the main thread; icons for providers the library doesn't ship with are downloaded from
+ * remoteBaseUrl and kept in the caches directory. Decoded icons are kept in a bounded memory cache.
+ */
+@interface JRProviderIcons : NSObject
++ (JRProviderIcons *)sharedIcons;
+
+/**
+ * Where to download icons that aren't in the bundle from, e.g. the Engage application's base URL plus
+ * "/cdn/images/mobile_icons/ios". Missing icons aren't downloaded while this is nil. Main thread only.
+ */
+@property(nonatomic, copy) NSString *remoteBaseUrl;
+
+@property(readonly) JRIconCache *cache;
+
+/**
+ * The icon if it's already decoded in memory, else nil; call -iconForProvider:style:size:completion: then.
+ */
+- (UIImage *)cachedIconForProvider:(NSString *)providerName style:(JRProviderIconStyle)style size:(CGSize)size;
+
+/**
+ * Completes on the main queue, with nil if the icon can't be found.
+ */
+- (void)iconForProvider:(NSString *)providerName style:(JRProviderIconStyle)style size:(CGSize)size
+             completion:(void (^)(UIImage *icon))completion;
+
+/**
+ * Warms the memory cache with both styles of the standard 30x30 icon for each provider.
+ */
+- (void)prefetchIconsForProviders:(NSArray *)providerNames;
+@end
@@ -0,0 +1,176 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRProviderIcons.h"
+#import "JRIconCache.h"
+#import "JRConnectionManager.h"
+#import "JRRetryPolicy.h"
+
+/* Room for every provider's icon in both styles */
+#define JRProviderIconsMemoryCapacity 96
+
+@implementation JRProviderIcons
+{
+    NSString *remoteBaseUrl;
+}
+
+@synthesize cache;
+
++ (JRProviderIcons *)sharedIcons
+{
+    static JRProviderIcons *sharedIcons = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        sharedIcons = [[JRProviderIcons alloc] init];
+    });
+
+    return sharedIcons;
+}
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        NSString *cachesDirectory =
+                [NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES) lastObject];
+        __weak JRProviderIcons *weakSelf = self;
+
+        cache = [[JRIconCache alloc]
+                initWithDiskCacheDirectory:[cachesDirectory stringByAppendingPathComponent:@"JREngageIcons"]
+                            memoryCapacity:JRProviderIconsMemoryCapacity
+                              bundleLoader:^NSData *(NSString *name)
+                              {
+                                  NSString *path = [[NSBundle mainBundle] pathForResource:name ofType:nil];
+                                  return path ? [NSData dataWithContentsOfFile:path] : nil;
+                              }
+                                   fetcher:^(NSString *name, void (^completion)(NSData *))
+                                   {
+                                       JRProviderIcons *icons = weakSelf;
+                                       if (icons) [icons downloadIconNamed:name completion:completion];
+                                       else completion(nil);
+                                   }
+                                   decoder:^id(NSData *data)
+                                   {
+                                       return [JRProviderIcons decodedImageWithData:data];
+                                   }];
+    }
+
+    return self;
+}
+
+/* Draws the image once so that the PNG is decompressed here, on the cache's background queue, rather than the
+   first time a cell or tab bar item is rendered */
++ (UIImage *)decodedImageWithData:(NSData *)data
+{
+    /* The icons are all 1x artwork, which is how +imageNamed: loaded them too */
+    UIImage *image = [UIImage imageWithData:data scale:1.0];
+    if (!image) return nil;
+
+    UIGraphicsBeginImageContextWithOptions(image.size, NO, image.scale);
+    [image drawAtPoint:CGPointZero];
+    UIImage *decodedImage = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+
+    return decodedImage ? decodedImage : image;
+}
+
+- (void)downloadIconNamed:(NSString *)name completion:(void (^)(NSData *data))completion
+{
+    dispatch_async(dispatch_get_main_queue(), ^
+    {
+        NSString *baseUrl = self.remoteBaseUrl;
+        if (!baseUrl)
+        {
+            completion(nil);
+            return;
+        }
+
+        NSURL *url = [NSURL URLWithString:[NSString stringWithFormat:@"%@/%@", baseUrl, name]];
+        [JRConnectionManager startDataTaskWithRequest:[NSURLRequest requestWithURL:url]
+                                          retryPolicy:[JRRetryPolicy defaultPolicy]
+                                             priority:JRConnectionPriorityBackground
+                                    completionHandler:^(NSData *data, NSURLResponse *response, NSError *e)
+                                    {
+                                        NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ?
+                                                [(NSHTTPURLResponse *) response statusCode] : 0;
+                                        completion(!e && statusCode == 200 && [data length] ? data : nil);
+                                    }];
+    });
+}
+
+- (NSString *)remoteBaseUrl
+{
+    return remoteBaseUrl;
+}
+
+- (void)setRemoteBaseUrl:(NSString *)newRemoteBaseUrl
+{
+    if (remoteBaseUrl == newRemoteBaseUrl || [remoteBaseUrl isEqualToString:newRemoteBaseUrl]) return;
+    remoteBaseUrl = [newRemoteBaseUrl copy];
+
+    /* Give anything that couldn't be found at the old location another chance */
+    [cache forgetUnavailableIcons];
+}
+
+- (NSString *)iconNameForProvider:(NSString *)providerName style:(JRProviderIconStyle)style size:(CGSize)size
+{
+    return [JRIconCache iconNameForProvider:providerName blackAndWhite:style == JRProviderIconStyleBlackAndWhite
+                                      width:(NSUInteger) size.width height:(NSUInteger) size.height];
+}
+
+- (UIImage *)cachedIconForProvider:(NSString *)providerName style:(JRProviderIconStyle)style size:(CGSize)size
+{
+    if (!providerName) return nil;
+    return [cache cachedIconNamed:[self iconNameForProvider:providerName style:style size:size]];
+}
+
+- (void)iconForProvider:(NSString *)providerName style:(JRProviderIconStyle)style size:(CGSize)size
+             completion:(void (^)(UIImage *icon))completion
+{
+    NSString *name = providerName ? [self iconNameForProvider:providerName style:style size:size] : nil;
+    [cache iconNamed:name completion:completion];
+}
+
+- (void)prefetchIconsForProviders:(NSArray *)providerNames
+{
+    NSMutableArray *names = [NSMutableArray arrayWithCapacity:[providerNames count] * 2];
+    for (NSString *providerName in providerNames)
+    {
+        [names addObject:[self iconNameForProvider:providerName style:JRProviderIconStyleColor
+                                              size:CGSizeMake(30, 30)]];
+        [names addObject:[self iconNameForProvider:providerName style:JRProviderIconStyleBlackAndWhite
+                                              size:CGSizeMake(30, 30)]];
+    }
+
+    [cache prefetchIconsNamed:names];
+}
+@end
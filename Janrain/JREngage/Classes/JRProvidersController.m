@@ -44,6 +44,11 @@
 #import "JROpenIDAppAuth.h"
 #import "JROpenIDAppAuthProvider.h"
 #import "UIAlertController+JRAlertController.h"
+#import "JRConfigurationReadiness.h"
+#import "JRProviderIcons.h"
+
+/* How long the dialog waits for the provider list before giving up */
+#define PROVIDERS_LOADING_TIMEOUT 16.0
 
 
 @interface UITableViewCellProviders : UITableViewCell
@@ -85,7 +90,7 @@
     UITableView *myTableView;
 
     /* Activity Spinner and Label displayed while the list of configured providers is empty */
-    NSTimer *timer;
+    JRConfigurationReadiness *providersReadiness;
     UILabel                 *myLoadingLabel;
     //UIActivityIndicatorView *myActivitySpinner;
 
@@ -228,34 +233,32 @@
                 myActivitySpinner.frame.size.height)];
     }
 
-    if ([sessionData.authenticationProviders count] > 0)
-    {
-        self.providers = [NSMutableArray arrayWithArray:sessionData.authenticationProviders];
-        [providers removeObjectsInArray:[customInterface objectForKey:kJRRemoveProvidersFromAuthentication]];
-        [self stopActivityIndicator];
+    JRSessionData *theSessionData = sessionData;
+    providersReadiness = [[JRConfigurationReadiness alloc] initWithSender:sessionData
+                                                         notificationName:JRFinishedUpdatingEngageConfigurationNotification
+                                                  failureNotificationName:JRFailedToUpdateEngageConfigurationNotification
+                                                                condition:^BOOL
+                                                                {
+                                                                    return [theSessionData.authenticationProviders count] > 0;
+                                                                }];
 
-        // Load the table with the list of providers.
-        [myTableView reloadData];
-    }
-    else
+    if (![sessionData.authenticationProviders count])
     {
-        //DLog(@"prov count = %d", [sessionData.authenticationProviders count]);
-
         // If the user calls the library before the session data object is done initializing -
         // because either the requests for the base URL or provider list haven't returned -
-        // display the "Loading Providers" label and activity spinner.
-        // sessionData = nil when the call to get the base URL hasn't returned
-        // [sessionData.configuredProviders count] = 0 when the provider list hasn't returned
+        // display the "Loading Providers" label and activity spinner until the session data says it has finished
+        // updating its configuration, or we time out.
         [myActivitySpinner setHidden:NO];
         [myLoadingLabel setHidden:NO];
 
         [myActivitySpinner startAnimating];
-
-        // Poll
-        timer = [NSTimer scheduledTimerWithTimeInterval:0.5 target:self
-                                               selector:@selector(checkSessionDataAndProviders:)
-                                               userInfo:nil repeats:NO];
     }
+
+    __weak JRProvidersController *weakSelf = self;
+    [providersReadiness waitWithTimeout:PROVIDERS_LOADING_TIMEOUT completion:^(BOOL ready)
+    {
+        [weakSelf finishWaitingForProviders:ready];
+    }];
 }
 
 - (void)viewDidAppear:(BOOL)animated
@@ -263,33 +266,22 @@
     [super viewDidAppear:animated];
 }
 
-- (void)checkSessionDataAndProviders:(NSTimer *)theTimer
+- (void)finishWaitingForProviders:(BOOL)providersLoaded
 {
-    DLog(@"");
-    static NSTimeInterval interval = 0.5;
-    interval = interval + 0.5;
-
-    timer = nil;
-
     DLog(@"prov count = %lu", (unsigned long)[sessionData.authenticationProviders count]);
-    DLog(@"interval = %f", interval);
 
-    if ([sessionData.authenticationProviders count] > 0)
+    if (providersLoaded)
     {
-        // Stop polling
         self.providers = [NSMutableArray arrayWithArray:sessionData.authenticationProviders];
         [providers removeObjectsInArray:[customInterface objectForKey:kJRRemoveProvidersFromAuthentication]];
 
         [self stopActivityIndicator];
 
         [myTableView reloadData];
-
-        return;
     }
-
-    if (interval >= 16.0)
+    else
     {
-        // Polling has timed out
+        // Waiting has timed out
         DLog(@"No Available Providers");
 
         [self stopActivityIndicator];
@@ -306,12 +298,7 @@
         
         UIAlertController *alertController = [UIAlertController alertControllerWithTitle:NSLocalizedString(@"No Available Providers",nil) message:message alertActions:okAction, nil];
         [self presentViewController:alertController animated:YES completion:nil];
-        
-        return;
     }
-
-    timer = [NSTimer scheduledTimerWithTimeInterval:0.5 target:self selector:@selector(checkSessionDataAndProviders:)
-                                           userInfo:nil repeats:NO];
 }
 
 #define LOADING_VIEW_TAG         555
@@ -491,10 +478,29 @@
     if (!provider)
         return cell;
 
-    NSString *imagePath = [NSString stringWithFormat:@"icon_%@_30x30.png", provider.name];
+    JRProviderIcons *icons = [JRProviderIcons sharedIcons];
+    UIImage *icon = [icons cachedIconForProvider:provider.name style:JRProviderIconStyleColor
+                                            size:CGSizeMake(30, 30)];
 
     cell.textLabel.text = provider.friendlyName;
-    cell.imageView.image = [UIImage imageNamed:imagePath];
+    cell.imageView.image = icon;
+
+    /* Don't block scrolling on reading and decoding the icon; fill it in once it's ready, provided the row
+       is still showing the same provider */
+    if (!icon)
+    {
+        NSString *providerName = provider.name;
+        [icons iconForProvider:providerName style:JRProviderIconStyleColor size:CGSizeMake(30, 30)
+                    completion:^(UIImage *loadedIcon)
+                    {
+                        UITableViewCell *visibleCell = [tableView cellForRowAtIndexPath:indexPath];
+                        if (!loadedIcon || ![visibleCell.textLabel.text isEqualToString:provider.friendlyName])
+                            return;
+
+                        visibleCell.imageView.image = loadedIcon;
+                        [visibleCell setNeedsLayout];
+                    }];
+    }
 
     cell.accessoryType = UITableViewCellAccessoryDisclosureIndicator;
 
@@ -573,7 +579,7 @@
 
 - (void)userInterfaceWillClose
 {
-    [timer invalidate];
+    [providersReadiness cancel];
 }
 
 - (void)userInterfaceDidClose
@@ -42,6 +42,11 @@
 #import "JRUserLandingController.h"
 #import "JRCompatibilityUtils.h"
 #import "UIAlertController+JRAlertController.h"
+#import "JRConfigurationReadiness.h"
+#import "JRProviderIcons.h"
+
+/* How long the dialog waits for the list of sharing providers before giving up */
+#define CONFIGURATION_TIMEOUT 32.0
 
 #define JRR_OUTER_STROKE_COLOR    [UIColor colorWithRed:0.8 green:0.8 blue:0.8 alpha:1.0]
 #define JRR_INNER_STROKE_COLOR    JANRAIN_BLUE
@@ -288,7 +293,7 @@ or opacity of our rounded rectangle. */
 @property(nonatomic) NSMutableSet *alreadyShared;
 @property(nonatomic) NSMutableDictionary *cachedProfilePics;
 @property(nonatomic) UIView *titleView;
-@property(nonatomic) NSTimer *timer;
+@property(nonatomic) JRConfigurationReadiness *providersReadiness;
 @property(nonatomic) BOOL weAreCurrentlyPostingSomething;
 @property(nonatomic, copy) NSString *shortenedActivityUrl;
 @property(nonatomic) NSInteger maxCharacters;
@@ -306,6 +311,8 @@ or opacity of our rounded rectangle. */
 
 - (void)addProvidersToTabBar;
 
+- (UITabBarItem *)tabBarItemWithTitle:(NSString *)title iconName:(NSString *)iconName tag:(NSUInteger)tag;
+
 - (void)determineIfWeCanShareViaEmailAndOrSMS;
 
 - (void)loadActivityToViewForFirstTime;
@@ -443,10 +450,22 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
         [self showViewIsLoading:YES];
         self.navigationItem.leftBarButtonItem.enabled = YES;
 
-        /* Now poll every few milliseconds, for about 16 seconds, until the provider list is loaded or we time out. */
-        self.timer = [NSTimer scheduledTimerWithTimeInterval:0.5 target:self
-                                                    selector:@selector(checkSessionDataAndProviders:) userInfo:nil
-                                                     repeats:NO];
+        /* Now wait until the session data has updated its configuration with the provider list, or we time out. */
+        JRSessionData *theSessionData = self.sessionData;
+        self.providersReadiness =
+                [[JRConfigurationReadiness alloc] initWithSender:theSessionData
+                                                notificationName:JRFinishedUpdatingEngageConfigurationNotification
+                                         failureNotificationName:JRFailedToUpdateEngageConfigurationNotification
+                                                       condition:^BOOL
+                                                       {
+                                                           return [theSessionData.sharingProviders count] > 0;
+                                                       }];
+
+        __weak JRPublishActivityController *weakSelf = self;
+        [self.providersReadiness waitWithTimeout:CONFIGURATION_TIMEOUT completion:^(BOOL ready)
+        {
+            [weakSelf finishWaitingForProviders:ready];
+        }];
     }
     else
     {
@@ -483,23 +502,13 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
         [self showViewIsLoading:NO];
 }
 
-#define CONFIGURATION_TIMEOUT 32.0
-
-/* If the user calls the library before the session data object is done initializing -
- because either the requests for the base URL or provider list haven't returned -
- keep polling every few milliseconds, for about 16 seconds,
- until the provider list is loaded or we time out. */
-- (void)checkSessionDataAndProviders:(NSTimer *)theTimer
+/* Called once the provider list has loaded, or when we've given up waiting for it. */
+- (void)finishWaitingForProviders:(BOOL)providersLoaded
 {
-    static NSTimeInterval interval = 0.5;
-    interval = interval + 0.5;
-
-    self.timer = nil;
-
     DLog (@"Social Providers so far: %lu", (unsigned long)[self.sessionData.sharingProviders count]);
 
     /* If we have our list of providers, stop the progress indicators and load the table. */
-    if ([self.sessionData.sharingProviders count] > 0)
+    if (providersLoaded)
     {
         self.weAreStillWaitingOnSocialProviders = NO;
 
@@ -510,12 +519,8 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
         myLoadingLabel.text = NSLocalizedString(@"Sharing...", nil);
 
         [self addProvidersToTabBar];
-
-        return;
     }
-
-    /* Otherwise, keep polling until we've timed out. */
-    if (interval >= CONFIGURATION_TIMEOUT)
+    else
     {
         DLog(@"No Available Providers");
 
@@ -531,12 +536,7 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
         
         UIAlertController *alertController = [UIAlertController alertControllerWithTitle:@"No Available Providers" message:message alertActions:okAction, nil];
         [self presentViewController:alertController animated:YES completion:nil];
-        return;
     }
-
-    self.timer = [NSTimer scheduledTimerWithTimeInterval:0.5 target:self
-                                                selector:@selector(checkSessionDataAndProviders:)
-                                                userInfo:nil repeats:NO];
 }
 
 /* That is, cover the view with a transparent gray box and a large white activity indicator. */
@@ -841,7 +841,7 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
                  [UIAlertAction actionWithTitle:NSLocalizedString(@"SMS", nil)
                                           style:UIAlertActionStyleDestructive
                                         handler:^(UIAlertAction *action) {
-                                            NSLog(@"Sending SMS");
+                                            DLog(@"Sending SMS");
                                             [self sendSMS];
                                         }]];
                  
@@ -849,14 +849,14 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
                  [UIAlertAction actionWithTitle:@"Email"
                                           style:UIAlertActionStyleDefault
                                         handler:^(UIAlertAction *action) {
-                                            NSLog(@"Sending Email");
+                                            DLog(@"Sending Email");
                                             [self sendEmail];
                                         }]];
                 [alertController addAction:
                  [UIAlertAction actionWithTitle:@"Cancel"
                                           style:UIAlertActionStyleCancel
                                         handler:^(UIAlertAction *action) {
-                                            NSLog(@"Cancelled");
+                                            DLog(@"Cancelled");
                                             // Cancel button tappped.
                                             [self dismissViewControllerAnimated:YES completion:^{
                                             }];
@@ -904,8 +904,21 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
         NSString *buttonFileName2 = [NSString stringWithFormat:@"button_%@_135x40.png", selectedProvider.name];
         [myJustShareButton setBackgroundImage:[UIImage imageNamed:buttonFileName2] forState:UIControlStateNormal];
 
-        NSString *providerIconFileName = [NSString stringWithFormat:@"icon_%@_30x30.png", selectedProvider.name];
-        myProviderIcon.image = [UIImage imageNamed:providerIconFileName];
+        NSString *providerName = selectedProvider.name;
+        myProviderIcon.image = [[JRProviderIcons sharedIcons] cachedIconForProvider:providerName
+                                                                              style:JRProviderIconStyleColor
+                                                                               size:CGSizeMake(30, 30)];
+        if (!myProviderIcon.image)
+        {
+            __weak JRPublishActivityController *weakSelf = self;
+            [[JRProviderIcons sharedIcons] iconForProvider:providerName style:JRProviderIconStyleColor
+                                                      size:CGSizeMake(30, 30) completion:^(UIImage *icon)
+            {
+                JRPublishActivityController *strongSelf = weakSelf;
+                if ([strongSelf.selectedProvider.name isEqualToString:providerName])
+                    strongSelf->myProviderIcon.image = icon;
+            }];
+        }
 
         if (![self.customInterface objectForKey:kJRSocialSharingTitleString] &&
                 ![self.customInterface objectForKey:kJRSocialSharingTitleView])
@@ -1225,14 +1238,14 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
      [UIAlertAction actionWithTitle:@"Sign Out"
                               style:UIAlertActionStyleDestructive
                             handler:^(UIAlertAction *action) {
-                                NSLog(@"Signing Out");
+                                DLog(@"Signing Out");
                                 [self logUserOutForProvider:self.selectedProvider.name];
                             }]];
     [alertController addAction:
      [UIAlertAction actionWithTitle:@"Cancel"
                               style:UIAlertActionStyleCancel
                             handler:^(UIAlertAction *action) {
-                                NSLog(@"Cancelled");
+                                DLog(@"Cancelled");
                                 // Cancel button tappped.
                                 [self dismissViewControllerAnimated:YES completion:^{
                                 }];
@@ -1570,6 +1583,28 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
     [self adjustPreviewContainerLayout];
 }
 
+/* Tab bar items show the black and white icon; if it isn't decoded yet the item is added without an image and
+   the icon is set once it has loaded */
+- (UITabBarItem *)tabBarItemWithTitle:(NSString *)title iconName:(NSString *)iconName tag:(NSUInteger)tag
+{
+    JRProviderIcons *icons = [JRProviderIcons sharedIcons];
+    UIImage *icon = [icons cachedIconForProvider:iconName style:JRProviderIconStyleBlackAndWhite
+                                            size:CGSizeMake(30, 30)];
+    UITabBarItem *item = [[UITabBarItem alloc] initWithTitle:title image:icon tag:(NSInteger) tag];
+
+    if (!icon)
+    {
+        __weak UITabBarItem *weakItem = item;
+        [icons iconForProvider:iconName style:JRProviderIconStyleBlackAndWhite size:CGSizeMake(30, 30)
+                    completion:^(UIImage *loadedIcon)
+                    {
+                        if (loadedIcon) weakItem.image = loadedIcon;
+                    }];
+    }
+
+    return item;
+}
+
 - (void)addProvidersToTabBar
 {
     DLog(@"");
@@ -1591,10 +1626,8 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
         if (!provider)
             break;
 
-        NSString *imagePath = [NSString stringWithFormat:@"icon_bw_%@_30x30.png", provider.name];
-        UITabBarItem *providerTab = [[UITabBarItem alloc] initWithTitle:provider.friendlyName
-                                                                   image:[UIImage imageNamed:imagePath]
-                                                                     tag:[providerTabArr count]];
+        UITabBarItem *providerTab = [self tabBarItemWithTitle:provider.friendlyName iconName:provider.name
+                                                          tag:[providerTabArr count]];
 
         [providerTabArr insertObject:providerTab atIndex:[providerTabArr count]];
 
@@ -1613,11 +1646,9 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
                 NSLocalizedString(@"sms", nil),
                 NSLocalizedString(@"mail_sms", nil)};
 
-        NSString *fileName = [NSString stringWithFormat:@"icon_bw_%@_30x30.png",
-                                                        simpleStrArray[self.emailAndOrSmsIndex + 2]];
-        UITabBarItem *emailTab = [[UITabBarItem alloc] initWithTitle:simpleStrArray[self.emailAndOrSmsIndex - 1]
-                                                                image:[UIImage imageNamed:fileName]
-                                                                  tag:[providerTabArr count]];
+        UITabBarItem *emailTab = [self tabBarItemWithTitle:simpleStrArray[self.emailAndOrSmsIndex - 1]
+                                                  iconName:simpleStrArray[self.emailAndOrSmsIndex + 2]
+                                                       tag:[providerTabArr count]];
 
         [providerTabArr insertObject:emailTab atIndex:[providerTabArr count]];
     }
@@ -1983,7 +2014,7 @@ myUserName, mySignOutButton, mySharedCheckMark, mySharedLabel;
     DLog(@"");
 
     [self showViewIsLoading:NO];
-    [self.timer invalidate];
+    [self.providersReadiness cancel];
 
     [self loadActivityToViewForFirstTime];
 }
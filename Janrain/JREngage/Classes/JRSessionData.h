@@ -159,6 +159,13 @@
 
 - (void)tryToReconfigureLibrary;
 
+/**
+ * @internal
+ * Hands the Engage base URL and token URL to JRConnectionManager#preconnectToUrl:, which warms them if preconnecting
+ * is on
+ **/
+- (void)preconnectToEngageHosts;
+
 - (id)reconfigureWithAppId:(NSString *)newAppId appUrl:(NSString *)newAppUrl
                   tokenUrl:(NSString *)newTokenUrl;
 /**
@@ -190,6 +197,14 @@
 
 - (void)shareActivityForUser:(JRAuthenticatedUser *)user;
 
+/**
+ * Shares the current activity to every user's provider at once, a few requests at a time, serializing the activity
+ * only once. The delegates hear about each provider just as they do from shareActivityForUser:. The completion runs
+ * on the main queue after the last one, with a dictionary of provider names to the NSError the delegates were
+ * given, or NSNull where the activity was shared.
+ **/
+- (void)shareActivityForUsers:(NSArray *)users completion:(void (^)(NSDictionary *resultsByProvider))completion;
+
 - (void)setStatusForUser:(JRAuthenticatedUser *)user;
 
 - (void)triggerAuthenticationDidCompleteWithPayload:(NSDictionary *)payloadDict;
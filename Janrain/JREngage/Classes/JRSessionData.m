@@ -38,6 +38,15 @@
 #import "JRUserInterfaceMaestro.h"
 #import "JREngage+CustomInterface.h"
 #import "JRJsonUtils.h"
+#import "JRRetryPolicy.h"
+#import "NSMutableURLRequest+JRRequestUtils.h"
+#import "JRTracer.h"
+#import "JRStageMetrics.h"
+#import "JRProviderIcons.h"
+#import "JRSessionStore.h"
+#import "JRShortenedUrlCache.h"
+#import "JRAnalyticsBeacon.h"
+#import "NSString+JRStringReplacement.h"
 
 static NSString *serverUrl = @"https://rpxnow.com";
 static NSString *engageWhitelistedDomain = @"";
@@ -50,6 +59,18 @@ static NSString *const CONFIG_KEY_BASEURL = @"baseurl";
 static NSString *const CONFIG_KEY_SIGNIN_PROVIDERS = @"enabled_providers";
 static NSString *const CONFIG_KEY_SHARING_PROVIDERS = @"social_providers";
 
+/* Short urls don't change, but there's no point holding on to last week's campaign */
+#define SHORTENED_URL_CACHE_CAPACITY 128
+#define SHORTENED_URL_CACHE_TTL      (60 * 60)
+
+/* How many providers -shareActivityForUsers:completion: posts to at once */
+#define MAX_CONCURRENT_SHARES 4
+
+/* Share records wait up to a minute to go out together; a heavy sharer's backlog is capped */
+#define ANALYTICS_BUFFER_CAPACITY   100
+#define ANALYTICS_FLUSH_INTERVAL    60.0
+#define ANALYTICS_MAX_FLUSH_INTERVAL (15 * 60.0)
+
 #define cJRAuthenticatedUsersByProvider @"jrengage.sessionData.authenticatedUsersByProvider"
 #define cJREngageProviders                 @"jrengage.sessionData.allProviders"
 #define cJRAuthenticationProviders               @"jrengage.sessionData.basicProviders"
@@ -60,6 +81,7 @@ static NSString *const CONFIG_KEY_SHARING_PROVIDERS = @"social_providers";
 #define cJRHidePoweredBy                @"jrengage.sessionData.hidePoweredBy"
 #define cJRLastUsedSharingProvider       @"jrengage.sessionData.lastUsedSocialProvider"
 #define cJRLastUsedAuthenticationProvider        @"jrengage.sessionData.lastUsedBasicProvider"
+#define cJRPendingAnalyticsEvents       @"jrengage.sessionData.pendingAnalyticsEvents"
 
 #define cJRUserDefaultsUuidName @"jrUserDefaultsUuidName"
 
@@ -306,25 +328,23 @@ static void deleteWebViewCookiesForDomains(NSArray *domains)
 {
     _userInput = userInput;
 
-    [[NSUserDefaults standardUserDefaults] setValue:_userInput
-                                             forKey:[NSString stringWithFormat:cJRProviderUserInput, self.name]];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [[JRSessionStore sharedStore] setObject:_userInput
+                                     forKey:[NSString stringWithFormat:cJRProviderUserInput, self.name]];
 }
 
 - (void)setForceReauthStartUrlFlag:(BOOL)forceReauthStartUrlFlag
 {
     _forceReauthStartUrlFlag = forceReauthStartUrlFlag;
 
-    [[NSUserDefaults standardUserDefaults] setBool:_forceReauthStartUrlFlag
-                                            forKey:[NSString stringWithFormat:cJRProviderForceReauth, self.name]];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [[JRSessionStore sharedStore] setBool:_forceReauthStartUrlFlag
+                                   forKey:[NSString stringWithFormat:cJRProviderForceReauth, self.name]];
 }
 
 - (void)loadLocalConfig
 {
-    _userInput     = [[NSUserDefaults standardUserDefaults]
+    _userInput     = [[JRSessionStore sharedStore]
                        stringForKey:[NSString stringWithFormat:cJRProviderUserInput, _name]];
-    _forceReauthStartUrlFlag =  [[NSUserDefaults standardUserDefaults]
+    _forceReauthStartUrlFlag =  [[JRSessionStore sharedStore]
                        boolForKey:[NSString stringWithFormat:cJRProviderForceReauth, _name]];
 }
 
@@ -449,6 +469,28 @@ static void deleteWebViewCookiesForDomains(NSArray *domains)
 }
 @end
 
+#pragma mark JRShareBatch
+/* One call to -shareActivityForUsers:completion:, on the main thread */
+@interface JRShareBatch : NSObject
+@property(nonatomic) JRActivityObject *activity;
+@property(nonatomic) NSMutableDictionary *activityDictionary;
+@property(nonatomic) NSMutableDictionary *contentByProvider;
+@property(nonatomic) NSMutableArray *pendingUsers;
+@property(nonatomic) NSUInteger sharesInFlight;
+@property(nonatomic) NSMutableDictionary *results;
+@property(nonatomic, copy) void (^completion)(NSDictionary *resultsByProvider);
+@end
+
+@implementation JRShareBatch
+@synthesize activity;
+@synthesize activityDictionary;
+@synthesize contentByProvider;
+@synthesize pendingUsers;
+@synthesize sharesInFlight;
+@synthesize results;
+@synthesize completion;
+@end
+
 #pragma mark JRSessionData
 @interface JRSessionData ()
 {
@@ -457,8 +499,14 @@ static void deleteWebViewCookiesForDomains(NSArray *domains)
     JRProvider *currentProvider;
     NSMutableDictionary *authenticatedUsersByProvider;
 
-    NSMutableSet        *providersWithIcons;
-    NSMutableDictionary *iconsStillNeeded;
+    /* The saved users and providers are unarchived on a background queue while the app finishes launching. The
+       first use of either waits for savedStateGroup and adopts what was loaded, unless new providers have been set
+       in the meantime. Main thread only, like the rest of the session. */
+    dispatch_group_t savedStateGroup;
+    NSDictionary *savedUsers;
+    NSDictionary *savedProviders;
+    BOOL savedUsersAdopted;
+    BOOL savedProvidersAdopted;
 
     JRActivityObject *activity;
 
@@ -471,6 +519,8 @@ static void deleteWebViewCookiesForDomains(NSArray *domains)
     BOOL socialSharing;
     BOOL authenticationFlowIsInFlight;
     BOOL stillNeedToShortenUrls;
+    JRShortenedUrlCache *shortenedUrlCache;
+    JRAnalyticsBeacon *analyticsBeacon;
 
     NSError *error;
     NSArray *engageAuthenticationProviders;
@@ -493,6 +543,7 @@ static void deleteWebViewCookiesForDomains(NSArray *domains)
     publishing. The arrays are in the order configured by the RP on http://rpxnow.com. */
 @property (readwrite) NSMutableDictionary *engageProviders;
 @property (readwrite) NSArray             *sharingProviders;
+@property (readonly) NSMutableDictionary  *authenticatedUsersByProvider;
 
 - (NSError *)startGetConfiguration;
 - (void)startGetShortenedUrlsForActivity:(JRActivityObject *)theActivity;
@@ -599,6 +650,7 @@ static JRSessionData *singleton = nil;
     self.tokenUrl = newTokenUrl;
     self.appUrl = newAppUrl;
     self.error = [self startGetConfiguration];
+    [self preconnectToEngageHosts];
     
     return self;
 }
@@ -609,6 +661,7 @@ static JRSessionData *singleton = nil;
     self.tokenUrl = newTokenUrl;
     self.appUrl = serverUrl;
     self.error = [self startGetConfiguration];
+    [self preconnectToEngageHosts];
 
     return self;
 }
@@ -624,72 +677,113 @@ static JRSessionData *singleton = nil;
     
     if ((self = [super init]))
     {
+        JR_STAGE_BEGIN(JRStageSessionInit);
         singleton = self;
+        shortenedUrlCache = [[JRShortenedUrlCache alloc] initWithCapacity:SHORTENED_URL_CACHE_CAPACITY
+                                                               timeToLive:SHORTENED_URL_CACHE_TTL];
+        [self startAnalyticsBeacon];
         
         delegates     = [[NSMutableArray alloc] initWithObjects:newDelegate, nil];
         self.appId    = newAppId;
         self.appUrl   = newAppUrl;
         self.tokenUrl = newTokenUrl;
         
-        NSData *archivedUsers = [[NSUserDefaults standardUserDefaults] objectForKey:cJRAuthenticatedUsersByProvider];
-        if (archivedUsers != nil)
-        {
-            NSDictionary *unarchivedUsers = [NSKeyedUnarchiver unarchiveObjectWithData:archivedUsers];
-            if (unarchivedUsers != nil)
-                authenticatedUsersByProvider = [[NSMutableDictionary alloc] initWithDictionary:unarchivedUsers];
-        }
-        
-        if (!authenticatedUsersByProvider)
-            authenticatedUsersByProvider = [[NSMutableDictionary alloc] init];
-        
-        NSData *archivedProviders = [[NSUserDefaults standardUserDefaults] objectForKey:cJREngageProviders];
-        if (archivedProviders != nil)
-        {
-            NSDictionary *unarchivedProviders = [NSKeyedUnarchiver unarchiveObjectWithData:archivedProviders];
-            if (unarchivedProviders != nil)
-                self.engageProviders = [NSMutableDictionary dictionaryWithDictionary:unarchivedProviders];
-        }
+        [self startLoadingSavedState];
         
         engageAuthenticationProviders =
-        [[NSUserDefaults standardUserDefaults] objectForKey:cJRAuthenticationProviders];
-        self.sharingProviders = [[NSUserDefaults standardUserDefaults] objectForKey:cJRSharingProviders];
-        
-        NSData *archivedIconsStillNeeded = [[NSUserDefaults standardUserDefaults] objectForKey:cJRIconsStillNeeded];
-        if (archivedIconsStillNeeded != nil)
-        {
-            NSDictionary *iconsStillNeeded_ = [NSKeyedUnarchiver unarchiveObjectWithData:archivedIconsStillNeeded];
-            if (iconsStillNeeded_ != nil)
-                iconsStillNeeded = [[NSMutableDictionary alloc] initWithDictionary:iconsStillNeeded_];
-        }
-        
-        NSData *providersWithIcons_ = [[NSUserDefaults standardUserDefaults] objectForKey:cJRProvidersWithIcons];
-        if (providersWithIcons_ != nil)
-        {
-            NSSet *unarchivedProvidersWithIcons = [NSKeyedUnarchiver unarchiveObjectWithData:providersWithIcons_];
-            if (unarchivedProvidersWithIcons != nil)
-                providersWithIcons = [[NSMutableSet alloc] initWithSet:unarchivedProvidersWithIcons];
-        }
+        [[JRSessionStore sharedStore] objectForKey:cJRAuthenticationProviders];
+        self.sharingProviders = [[JRSessionStore sharedStore] objectForKey:cJRSharingProviders];
         
         if(newAppUrl.length > 0){
             baseUrl = [NSString stringWithFormat: @"https://%@",newAppUrl];
         }else{
-            baseUrl = [[NSUserDefaults standardUserDefaults] stringForKey:cJRBaseUrl];
+            baseUrl = [[JRSessionStore sharedStore] stringForKey:cJRBaseUrl];
         }
-        hidePoweredBy = !baseUrl ? YES : ([[NSUserDefaults standardUserDefaults] boolForKey:cJRHidePoweredBy]);
+        hidePoweredBy = !baseUrl ? YES : ([[JRSessionStore sharedStore] boolForKey:cJRHidePoweredBy]);
         
-        returningSharingProvider = [[NSUserDefaults standardUserDefaults] stringForKey:cJRLastUsedSharingProvider];
-        returningAuthenticationProvider = [[NSUserDefaults standardUserDefaults] stringForKey:cJRLastUsedAuthenticationProvider];
+        returningSharingProvider = [[JRSessionStore sharedStore] stringForKey:cJRLastUsedSharingProvider];
+        returningAuthenticationProvider = [[JRSessionStore sharedStore] stringForKey:cJRLastUsedAuthenticationProvider];
         
         if(newAppId.length > 0 || newAppUrl.length > 0){
             self.error = [self startGetConfiguration];
         }else{
             self.error = [self startGetNoEngageConfiguration];
         }
+        [self preconnectToEngageHosts];
+        JR_STAGE_END(JRStageSessionInit);
     }
     
     return self;
 }
 
+- (void)preconnectToEngageHosts
+{
+    [JRConnectionManager preconnectToUrl:baseUrl];
+    [JRConnectionManager preconnectToUrl:self.tokenUrl];
+}
+
+#pragma mark saved_state
+- (void)startLoadingSavedState
+{
+    savedStateGroup = dispatch_group_create();
+    dispatch_group_async(savedStateGroup, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^
+    {
+        JR_STAGE_BEGIN(JRStageSessionStateLoad);
+        NSDictionary *users = [[JRSessionStore sharedStore] unarchivedObjectForKey:cJRAuthenticatedUsersByProvider];
+        NSDictionary *providers = [[JRSessionStore sharedStore] unarchivedObjectForKey:cJREngageProviders];
+        JR_STAGE_END(JRStageSessionStateLoad);
+
+        /* Read on the main thread after dispatch_group_wait, which orders these writes before the reads */
+        self->savedUsers = [users isKindOfClass:[NSDictionary class]] ? users : nil;
+        self->savedProviders = [providers isKindOfClass:[NSDictionary class]] ? providers : nil;
+    });
+}
+
+/* Usually returns straight away: the load has had all of app launch to finish */
+- (void)waitForSavedState
+{
+    if (!savedStateGroup) return;
+
+    JR_STAGE_BEGIN(JRStageSessionStateWait);
+    dispatch_group_wait(savedStateGroup, DISPATCH_TIME_FOREVER);
+    JR_STAGE_END(JRStageSessionStateWait);
+}
+
+- (NSMutableDictionary *)authenticatedUsersByProvider
+{
+    if (!savedUsersAdopted)
+    {
+        [self waitForSavedState];
+        authenticatedUsersByProvider = savedUsers ? [[NSMutableDictionary alloc] initWithDictionary:savedUsers] :
+                [[NSMutableDictionary alloc] init];
+        savedUsers = nil;
+        savedUsersAdopted = YES;
+    }
+
+    return authenticatedUsersByProvider;
+}
+
+- (NSMutableDictionary *)engageProviders
+{
+    if (!savedProvidersAdopted)
+    {
+        [self waitForSavedState];
+        if (savedProviders)
+            engageProviders = [NSMutableDictionary dictionaryWithDictionary:savedProviders];
+        savedProviders = nil;
+        savedProvidersAdopted = YES;
+    }
+
+    return engageProviders;
+}
+
+/* A new configuration replaces the saved providers outright, so there's nothing to wait for */
+- (void)setEngageProviders:(NSMutableDictionary *)newEngageProviders
+{
+    savedProvidersAdopted = YES;
+    engageProviders = newEngageProviders;
+}
+
 - (id)initWithAppId:(NSString *)newAppId tokenUrl:(NSString *)newTokenUrl andDelegate:(id<JRSessionDelegate>)newDelegate
 {
     return [self initWithAppId:newAppId appUrl:serverUrl tokenUrl:newTokenUrl andDelegate:newDelegate];
@@ -759,9 +853,12 @@ static JRSessionData *singleton = nil;
     ALog (@"Getting configuration for RP: %@", urlString);
     
     NSMutableURLRequest *configRequest = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:urlString]];
+    [configRequest JR_setOperationName:@"config"];
     
     if (![JRConnectionManager createConnectionFromRequest:configRequest forDelegate:self returnFullResponse:YES
-                                                  withTag:GET_CONFIGURATION_TAG])
+                                                  withTag:GET_CONFIGURATION_TAG
+                                              retryPolicy:[JRRetryPolicy defaultPolicy]
+                                                 priority:JRConnectionPriorityBackground])
     {
         NSString *errMsg = NSLocalizedString(@"There was a problem connecting to the Janrain server while configuring authentication.", nil);
         return [JREngageError errorWithMessage:errMsg andCode:JRUrlError];
@@ -797,7 +894,8 @@ static JRSessionData *singleton = nil;
         [self startGetShortenedUrlsForActivity:activity];
     stillNeedToShortenUrls = NO;
     
-    [[NSUserDefaults standardUserDefaults] setValue:baseUrl forKey:cJRBaseUrl];
+    [[JRSessionStore sharedStore] setObject:baseUrl forKey:cJRBaseUrl];
+    [JRConnectionManager preconnectToUrl:baseUrl];
     NSDictionary *providerInfo = [configDict objectForKey:CONFIG_KEY_PROVIDER_INFO];
     
     self.engageProviders = [NSMutableDictionary dictionary];
@@ -809,25 +907,24 @@ static JRSessionData *singleton = nil;
         [self.engageProviders setObject:provider forKey:name];
     }
     
-    [[NSUserDefaults standardUserDefaults] setObject:[NSKeyedArchiver archivedDataWithRootObject:iconsStillNeeded]
-                                              forKey:cJRIconsStillNeeded];
-    [[NSUserDefaults standardUserDefaults] setObject:[NSKeyedArchiver archivedDataWithRootObject:providersWithIcons]
-                                              forKey:cJRProvidersWithIcons];
+    /* Icons are looked after by JRProviderIcons now; drop what older versions of the library kept track of */
+    [[JRSessionStore sharedStore] removeObjectForKey:cJRIconsStillNeeded];
+    [[JRSessionStore sharedStore] removeObjectForKey:cJRProvidersWithIcons];
+    [JRProviderIcons sharedIcons].remoteBaseUrl = [baseUrl stringByAppendingString:@"/cdn/images/mobile_icons/ios"];
+    [[JRProviderIcons sharedIcons] prefetchIconsForProviders:[self.engageProviders allKeys]];
     
     engageAuthenticationProviders =
     [NSArray arrayWithArray:[configDict objectForKey:CONFIG_KEY_SIGNIN_PROVIDERS]];
     self.sharingProviders = [NSArray arrayWithArray:[configDict objectForKey:CONFIG_KEY_SHARING_PROVIDERS]];
     
-    [[NSUserDefaults standardUserDefaults] setObject:[NSKeyedArchiver archivedDataWithRootObject:engageProviders]
-                                              forKey:cJREngageProviders];
-    [[NSUserDefaults standardUserDefaults] setObject:engageAuthenticationProviders forKey:cJRAuthenticationProviders];
-    [[NSUserDefaults standardUserDefaults] setObject:self.sharingProviders forKey:cJRSharingProviders];
+    [[JRSessionStore sharedStore] setArchivedObject:self.engageProviders forKey:cJREngageProviders];
+    [[JRSessionStore sharedStore] setObject:engageAuthenticationProviders forKey:cJRAuthenticationProviders];
+    [[JRSessionStore sharedStore] setObject:self.sharingProviders forKey:cJRSharingProviders];
     
     hidePoweredBy = ([[configDict objectForKey:@"hide_tagline"] isEqualToString:@"YES"]) ? YES : NO;
-    [[NSUserDefaults standardUserDefaults] setBool:hidePoweredBy forKey:cJRHidePoweredBy];
+    [[JRSessionStore sharedStore] setBool:hidePoweredBy forKey:cJRHidePoweredBy];
     
-    [[NSUserDefaults standardUserDefaults] setValue:self.updatedEtag forKey:PREFS_KEY_ETAG];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [[JRSessionStore sharedStore] setObject:self.updatedEtag forKey:PREFS_KEY_ETAG];
     
     
     self.savedConfigurationBlock = nil;
@@ -851,7 +948,8 @@ static JRSessionData *singleton = nil;
         [self startGetShortenedUrlsForActivity:activity];
     stillNeedToShortenUrls = NO;
 
-    [[NSUserDefaults standardUserDefaults] setValue:baseUrl forKey:cJRBaseUrl];
+    [[JRSessionStore sharedStore] setObject:baseUrl forKey:cJRBaseUrl];
+    [JRConnectionManager preconnectToUrl:baseUrl];
     NSDictionary *providerInfo = [configDict objectForKey:CONFIG_KEY_PROVIDER_INFO];
 
     self.engageProviders = [NSMutableDictionary dictionary];
@@ -867,27 +965,25 @@ static JRSessionData *singleton = nil;
         [self.engageProviders setObject:provider forKey:name];
     }
 
-    [[NSUserDefaults standardUserDefaults] setObject:[NSKeyedArchiver archivedDataWithRootObject:iconsStillNeeded]
-                                              forKey:cJRIconsStillNeeded];
-    [[NSUserDefaults standardUserDefaults] setObject:[NSKeyedArchiver archivedDataWithRootObject:providersWithIcons]
-                                              forKey:cJRProvidersWithIcons];
+    /* Icons are looked after by JRProviderIcons now; drop what older versions of the library kept track of */
+    [[JRSessionStore sharedStore] removeObjectForKey:cJRIconsStillNeeded];
+    [[JRSessionStore sharedStore] removeObjectForKey:cJRProvidersWithIcons];
+    [JRProviderIcons sharedIcons].remoteBaseUrl = [baseUrl stringByAppendingString:@"/cdn/images/mobile_icons/ios"];
+    [[JRProviderIcons sharedIcons] prefetchIconsForProviders:[self.engageProviders allKeys]];
 
     engageAuthenticationProviders =
             [NSArray arrayWithArray:[configDict objectForKey:CONFIG_KEY_SIGNIN_PROVIDERS]];
     self.sharingProviders = [NSArray arrayWithArray:[configDict objectForKey:CONFIG_KEY_SHARING_PROVIDERS]];
 
-    [[NSUserDefaults standardUserDefaults] setObject:[NSKeyedArchiver archivedDataWithRootObject:engageProviders]
-                                              forKey:cJREngageProviders];
-    [[NSUserDefaults standardUserDefaults] setObject:engageAuthenticationProviders forKey:cJRAuthenticationProviders];
-    [[NSUserDefaults standardUserDefaults] setObject:self.sharingProviders forKey:cJRSharingProviders];
+    [[JRSessionStore sharedStore] setArchivedObject:self.engageProviders forKey:cJREngageProviders];
+    [[JRSessionStore sharedStore] setObject:engageAuthenticationProviders forKey:cJRAuthenticationProviders];
+    [[JRSessionStore sharedStore] setObject:self.sharingProviders forKey:cJRSharingProviders];
 
     hidePoweredBy = ([[configDict objectForKey:@"hide_tagline"] isEqualToString:@"YES"]) ? YES : NO;
-    [[NSUserDefaults standardUserDefaults] setBool:hidePoweredBy forKey:cJRHidePoweredBy];
+    [[JRSessionStore sharedStore] setBool:hidePoweredBy forKey:cJRHidePoweredBy];
 
-    [[NSUserDefaults standardUserDefaults] setValue:self.updatedEtag forKey:PREFS_KEY_ETAG];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [[JRSessionStore sharedStore] setObject:self.updatedEtag forKey:PREFS_KEY_ETAG];
 
-    //[self downloadNeededIcons:iconsStillNeeded];
 
     self.savedConfigurationBlock = nil;
     self.updatedEtag = nil;
@@ -976,26 +1072,25 @@ static JRSessionData *singleton = nil;
 
 - (JRAuthenticatedUser *)authenticatedUserForProvider:(JRProvider *)provider
 {
-    return [authenticatedUsersByProvider objectForKey:provider.name];
+    return [self.authenticatedUsersByProvider objectForKey:provider.name];
 }
 
 - (JRAuthenticatedUser *)authenticatedUserForProviderNamed:(NSString *)provider;
 {
-    return [authenticatedUsersByProvider objectForKey:provider];
+    return [self.authenticatedUsersByProvider objectForKey:provider];
 }
 
 - (void)forgetAuthenticatedUserForProvider:(NSString *)providerName
 {
     DLog (@"");
-    JRProvider* provider = [engageProviders objectForKey:providerName];
+    JRProvider* provider = [self.engageProviders objectForKey:providerName];
 
     if (!provider) return;
 
     [provider forceReauth];
-    [authenticatedUsersByProvider removeObjectForKey:providerName];
-    NSData *usersData = [NSKeyedArchiver archivedDataWithRootObject:authenticatedUsersByProvider];
-    [[NSUserDefaults standardUserDefaults] setObject:usersData forKey:cJRAuthenticatedUsersByProvider];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [self.authenticatedUsersByProvider removeObjectForKey:providerName];
+    [[JRSessionStore sharedStore] setArchivedObject:self.authenticatedUsersByProvider
+                                             forKey:cJRAuthenticatedUsersByProvider];
 }
 
 - (NSDictionary *)allProviders
@@ -1034,10 +1129,9 @@ static JRSessionData *singleton = nil;
         [self forgetAuthenticatedUserForProvider:providerName];
     }
 
-    [authenticatedUsersByProvider removeAllObjects];
-    NSData *usersData = [NSKeyedArchiver archivedDataWithRootObject:authenticatedUsersByProvider];
-    [[NSUserDefaults standardUserDefaults] setObject:usersData forKey:cJRAuthenticatedUsersByProvider];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [self.authenticatedUsersByProvider removeAllObjects];
+    [[JRSessionStore sharedStore] setArchivedObject:self.authenticatedUsersByProvider
+                                             forKey:cJRAuthenticatedUsersByProvider];
 }
 
 #pragma mark provider_management
@@ -1053,9 +1147,8 @@ static JRSessionData *singleton = nil;
 
     returningSharingProvider = providerName;
 
-    [[NSUserDefaults standardUserDefaults] setObject:returningSharingProvider
-                                              forKey:cJRLastUsedSharingProvider];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [[JRSessionStore sharedStore] setObject:returningSharingProvider
+                                     forKey:cJRLastUsedSharingProvider];
 }
 
 - (void)saveLastUsedAuthenticationProvider:(NSString *)providerName
@@ -1064,9 +1157,8 @@ static JRSessionData *singleton = nil;
 
     returningAuthenticationProvider = providerName;
 
-    [[NSUserDefaults standardUserDefaults] setObject:returningAuthenticationProvider
-                                              forKey:cJRLastUsedAuthenticationProvider];
-    [[NSUserDefaults standardUserDefaults] synchronize];
+    [[JRSessionStore sharedStore] setObject:returningAuthenticationProvider
+                                     forKey:cJRLastUsedAuthenticationProvider];
 }
 
 - (NSString *)getWelcomeMessageFromCookie
@@ -1150,8 +1242,7 @@ static JRSessionData *singleton = nil;
 
 - (NSString *)deviceIdentifier
 {
-    NSUserDefaults *defaults = [NSUserDefaults standardUserDefaults];
-    NSString *uuid = [defaults objectForKey:cJRUserDefaultsUuidName];
+    NSString *uuid = [[JRSessionStore sharedStore] stringForKey:cJRUserDefaultsUuidName];
 
     if (!uuid)
     {
@@ -1160,8 +1251,7 @@ static JRSessionData *singleton = nil;
         CFUUIDRef cfUUID = CFUUIDCreate(NULL);
         uuid = (NSString *)CFBridgingRelease(CFUUIDCreateString(NULL, cfUUID));
 
-        [defaults setObject:uuid forKey:cJRUserDefaultsUuidName];
-        [defaults synchronize];
+        [[JRSessionStore sharedStore] setObject:uuid forKey:cJRUserDefaultsUuidName];
 
         CFRelease(cfUUID);
     }
@@ -1170,24 +1260,30 @@ static JRSessionData *singleton = nil;
 }
 
 #pragma mark sharing
-- (void)startShareActivityForUser:(JRAuthenticatedUser *)user
+/* The activity as the form encoded JSON that api/v2/activity takes; LinkedIn gets a shorter description */
+- (NSString *)activityContentForProvider:(NSString *)providerName fromDictionary:(NSDictionary *)activityDictionary
+                                activity:(JRActivityObject *)theActivity
 {
-    // TODO: Better error checking in sessionData's share activity bit
-    NSMutableDictionary *activityDictionary = [activity dictionaryForObject];
-
-    if ([currentProvider.name isEqualToString:@"linkedin"])
+    if ([providerName isEqualToString:@"linkedin"])
     {
-        NSString *desc = [activity.resourceDescription substringToIndex:((activity.resourceDescription.length < 256) ?
-                                                activity.resourceDescription.length : 256)];
-        [activityDictionary setObject:desc forKey:@"description"];
+        NSMutableDictionary *linkedInDictionary = [NSMutableDictionary dictionaryWithDictionary:activityDictionary];
+        NSString *desc = [theActivity.resourceDescription substringToIndex:((theActivity.resourceDescription.length < 256) ?
+                                                theActivity.resourceDescription.length : 256)];
+        [linkedInDictionary setObject:desc forKey:@"description"];
+        activityDictionary = linkedInDictionary;
     }
 
-
     NSString *activityContent = [[activityDictionary JR_jsonString] stringByAddingUrlPercentEscapes];
-    NSString *deviceToken = user.deviceToken;
-
     DLog(@"activity json string \n %@", activityContent);
 
+    return activityContent;
+}
+
+- (NSMutableURLRequest *)shareActivityRequestForUser:(JRAuthenticatedUser *)user provider:(NSString *)providerName
+                                     activityContent:(NSString *)activityContent
+{
+    NSString *deviceToken = user.deviceToken;
+
     NSMutableData *body = [NSMutableData data];
     [body appendData:[[NSString stringWithFormat:@"activity=%@",
                                                  activityContent] dataUsingEncoding:NSUTF8StringEncoding]];
@@ -1196,7 +1292,7 @@ static JRSessionData *singleton = nil;
     [body appendData:[[NSString stringWithFormat:@"&url_shortening=true"] dataUsingEncoding:NSUTF8StringEncoding]];
     [body appendData:[[NSString stringWithFormat:@"&device=%@", [self device]] dataUsingEncoding:NSUTF8StringEncoding]];
     [body appendData:[[NSString stringWithFormat:@"&provider=%@",
-                                                 currentProvider.name] dataUsingEncoding:NSUTF8StringEncoding]];
+                                                 providerName] dataUsingEncoding:NSUTF8StringEncoding]];
     [body appendData:[[NSString stringWithFormat:@"&app_name=%@",
                                                  applicationBundleDisplayName()] dataUsingEncoding:NSUTF8StringEncoding]];
 
@@ -1206,14 +1302,25 @@ static JRSessionData *singleton = nil;
     [request setHTTPMethod:@"POST"];
     [request setHTTPBody:body];
 
+    DLog(@"Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
+         JRLogRedactedPayload(body));
+
+    return request;
+}
+
+- (void)startShareActivityForUser:(JRAuthenticatedUser *)user
+{
+    // TODO: Better error checking in sessionData's share activity bit
+    NSString *activityContent = [self activityContentForProvider:currentProvider.name
+                                                  fromDictionary:[activity dictionaryForObject] activity:activity];
+    NSMutableURLRequest *request = [self shareActivityRequestForUser:user provider:currentProvider.name
+                                                     activityContent:activityContent];
+
     NSDictionary *tag = [NSDictionary dictionaryWithObjectsAndKeys:
                                               @"shareActivity", @"action",
                                               activity, @"activity",
                                               currentProvider.name, @"providerName", nil];
 
-    ALog ("Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
-    [NSString stringWithCString:body.bytes encoding:NSUTF8StringEncoding]);
-
     if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
     {
         NSString *message = @"There was a problem connecting to the Janrain server to share this activity";
@@ -1222,6 +1329,88 @@ static JRSessionData *singleton = nil;
     }
 }
 
+- (void)shareActivityForUsers:(NSArray *)users completion:(void (^)(NSDictionary *resultsByProvider))completion
+{
+    JRShareBatch *batch = [[JRShareBatch alloc] init];
+    batch.activity = activity;
+    batch.pendingUsers = [NSMutableArray arrayWithArray:users];
+    batch.results = [NSMutableDictionary dictionaryWithCapacity:[users count]];
+    batch.contentByProvider = [NSMutableDictionary dictionary];
+    batch.completion = completion;
+
+    if (!batch.activity || ![users count])
+    {
+        if (completion) completion([NSDictionary dictionary]);
+        return;
+    }
+
+    /* Serialized once for the whole batch; only LinkedIn's differs */
+    batch.activityDictionary = [batch.activity dictionaryForObject];
+
+    [self startNextSharesInBatch:batch];
+}
+
+- (void)startNextSharesInBatch:(JRShareBatch *)batch
+{
+    while (batch.sharesInFlight < MAX_CONCURRENT_SHARES && [batch.pendingUsers count])
+    {
+        JRAuthenticatedUser *user = [batch.pendingUsers objectAtIndex:0];
+        [batch.pendingUsers removeObjectAtIndex:0];
+
+        NSString *providerName = user.providerName;
+        BOOL contentDiffers = [providerName isEqualToString:@"linkedin"];
+        NSString *contentKey = contentDiffers ? providerName : @"";
+        NSString *activityContent = [batch.contentByProvider objectForKey:contentKey];
+        if (!activityContent)
+        {
+            activityContent = [self activityContentForProvider:providerName fromDictionary:batch.activityDictionary
+                                                      activity:batch.activity];
+            [batch.contentByProvider setObject:activityContent forKey:contentKey];
+        }
+
+        NSMutableURLRequest *request = [self shareActivityRequestForUser:user provider:providerName
+                                                         activityContent:activityContent];
+
+        batch.sharesInFlight++;
+        __weak JRSessionData *weakSelf = self;
+        [JRConnectionManager startDataTaskWithRequest:request retryPolicy:[JRRetryPolicy defaultPolicy]
+                                             priority:JRConnectionPriorityNormal
+                                    completionHandler:^(NSData *data, NSURLResponse *response, NSError *e)
+        {
+            JRSessionData *sessionData = weakSelf;
+            if (!sessionData) return;
+
+            NSError *shareError = e;
+
+            if (!e)
+            {
+                NSString *payload = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+                shareError = [sessionData finishShareActivity:batch.activity forProvider:providerName
+                                                 withResponse:(payload ? payload : @"")];
+            }
+            else
+            {
+                for (id <JRSessionDelegate> delegate in [NSArray arrayWithArray:sessionData->delegates])
+                    if ([delegate respondsToSelector:@selector(publishingActivity:didFailWithError:forProvider:)])
+                        [delegate publishingActivity:batch.activity didFailWithError:e forProvider:providerName];
+            }
+
+            if (providerName)
+                [batch.results setObject:(shareError ? (id) shareError : [NSNull null]) forKey:providerName];
+
+            batch.sharesInFlight--;
+            [sessionData startNextSharesInBatch:batch];
+
+            if (!batch.sharesInFlight && ![batch.pendingUsers count] && batch.completion)
+            {
+                void (^batchCompletion)(NSDictionary *) = batch.completion;
+                batch.completion = nil;
+                batchCompletion([NSDictionary dictionaryWithDictionary:batch.results]);
+            }
+        }];
+    }
+}
+
 - (void)startSetStatusForUser:(JRAuthenticatedUser *)user
 {
     DLog (@"activity status: %@", [activity userGeneratedContent]);
@@ -1251,8 +1440,8 @@ static JRSessionData *singleton = nil;
                                               activity, @"activity",
                                               currentProvider.name, @"providerName", nil];
 
-    ALog ("Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
-    [NSString stringWithCString:body.bytes encoding:NSUTF8StringEncoding]);
+    DLog(@"Sharing activity on %@:\n request=%@\nbody=%@", user.providerName, [[request URL] absoluteString],
+         JRLogRedactedPayload(body));
 
     if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag])
     {
@@ -1272,7 +1461,9 @@ static JRSessionData *singleton = nil;
     [self startSetStatusForUser:user];
 }
 
-- (void)finishShareActivity:(JRActivityObject *)_activity forProvider:(NSString *)providerName withResponse:(NSString *)response
+/* Tells the delegates how it went, and returns the error they were given, or nil if the activity was shared */
+- (NSError *)finishShareActivity:(JRActivityObject *)_activity forProvider:(NSString *)providerName
+                    withResponse:(NSString *)response
 {
     ALog (@"Activity sharing response: %@", response);
 
@@ -1280,16 +1471,17 @@ static JRSessionData *singleton = nil;
 
     if (!responseDict)
     {
+        NSError *responseError = [JREngageError errorWithMessage:[NSString stringWithString:response]
+                                                         andCode:JRPublishFailedError];
         NSArray *delegatesCopy = [NSArray arrayWithArray:delegates];
         for (id<JRSessionDelegate> delegate in delegatesCopy)
         {
             if ([delegate respondsToSelector:@selector(publishingActivity:didFailWithError:forProvider:)])
                 [delegate publishingActivity:_activity
-                            didFailWithError:[JREngageError errorWithMessage:[NSString stringWithString:response]
-                                                                     andCode:JRPublishFailedError]
+                            didFailWithError:responseError
                                  forProvider:providerName];
         }
-        return;
+        return responseError;
     }
 
     if ([[responseDict objectForKey:@"stat"] isEqualToString:@"ok"])
@@ -1301,6 +1493,8 @@ static JRSessionData *singleton = nil;
             if ([delegate respondsToSelector:@selector(publishingActivityDidSucceed:forProvider:)])
                 [delegate publishingActivityDidSucceed:_activity forProvider:providerName];
         }
+
+        return nil;
     }
     else
     {
@@ -1442,15 +1636,49 @@ static JRSessionData *singleton = nil;
                             didFailWithError:publishError
                                  forProvider:providerName];
         }
+
+        return publishError;
     }
 }
 
+- (void)startAnalyticsBeacon
+{
+    __weak JRSessionData *weakSelf = self;
+    analyticsBeacon = [[JRAnalyticsBeacon alloc] initWithStore:[JRSessionStore sharedStore]
+                                                           key:cJRPendingAnalyticsEvents
+                                                      capacity:ANALYTICS_BUFFER_CAPACITY
+                                                 flushInterval:ANALYTICS_FLUSH_INTERVAL
+                                              maxFlushInterval:ANALYTICS_MAX_FLUSH_INTERVAL
+                                                        sender:^(NSDictionary *event, void (^completion)(BOOL))
+                                                        {
+                                                            JRSessionData *sessionData = weakSelf;
+                                                            if (sessionData)
+                                                                [sessionData sendAnalyticsEvent:event
+                                                                                     completion:completion];
+                                                            else
+                                                                completion(NO);
+                                                        }];
+}
+
 - (void)startRecordActivitySharedBy:(NSString *)method
 {
     ALog (@"");
+    [analyticsBeacon recordEvent:[NSDictionary dictionaryWithObjectsAndKeys:[self device], @"device",
+                                                                            method, @"method", nil]];
+}
+
+- (void)sendAnalyticsEvent:(NSDictionary *)event completion:(void (^)(BOOL sent))completion
+{
+    /* Hold on to it until we know where to send it */
+    if (!baseUrl)
+    {
+        completion(NO);
+        return;
+    }
+
     NSMutableData* body = [NSMutableData data];
-    [body appendData:[[NSString stringWithFormat:@"device=%@", [self device]] dataUsingEncoding:NSUTF8StringEncoding]];
-    [body appendData:[[NSString stringWithFormat:@"&method=%@", method] dataUsingEncoding:NSUTF8StringEncoding]];
+    [body appendData:[[NSString stringWithFormat:@"device=%@", [event objectForKey:@"device"]] dataUsingEncoding:NSUTF8StringEncoding]];
+    [body appendData:[[NSString stringWithFormat:@"&method=%@", [event objectForKey:@"method"]] dataUsingEncoding:NSUTF8StringEncoding]];
 
     NSString *urlString = [NSString stringWithFormat:
                            @"%@/social/record_activity?",
@@ -1461,9 +1689,17 @@ static JRSessionData *singleton = nil;
     [request setHTTPMethod:@"POST"];
     [request setHTTPBody:body];
 
-    NSString *tag = [NSString stringWithFormat:@"%@Success", method];
+    [JRConnectionManager startDataTaskWithRequest:request retryPolicy:[JRRetryPolicy defaultPolicy]
+                                         priority:JRConnectionPriorityBackground
+                                completionHandler:^(NSData *data, NSURLResponse *response, NSError *e)
+                                {
+                                    NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ?
+                                            [(NSHTTPURLResponse *) response statusCode] : 0;
+                                    DLog (@"Recorded %@ share: %ld", [event objectForKey:@"method"], (long) statusCode);
 
-    [JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:NO withTag:tag];
+                                    /* A 4xx won't go any better next time, so don't keep it */
+                                    completion(!e && statusCode > 0 && statusCode < 500);
+                                }];
 }
 
 #pragma mark url_shortening
@@ -1485,10 +1721,25 @@ static JRSessionData *singleton = nil;
         return;
     }
 
+    /* Only ask Engage about the urls we haven't shortened recently */
     NSMutableDictionary *urls = [NSMutableDictionary dictionaryWithCapacity:3];
-    if (theActivity.email.urls) [urls setObject:theActivity.email.urls forKey:@"email"];
-    if (theActivity.sms.urls)   [urls setObject:theActivity.sms.urls forKey:@"sms"];
-    if (theActivity.url)        [urls setObject:[NSArray arrayWithObject:theActivity.url] forKey:@"activity"];
+    NSMutableDictionary *cachedUrls = [NSMutableDictionary dictionaryWithCapacity:3];
+    [self sortUrls:theActivity.email.urls forChannel:@"email" intoUncached:urls andCached:cachedUrls];
+    [self sortUrls:theActivity.sms.urls forChannel:@"sms" intoUncached:urls andCached:cachedUrls];
+    [self sortUrls:(theActivity.url ? [NSArray arrayWithObject:theActivity.url] : nil) forChannel:@"activity"
+      intoUncached:urls andCached:cachedUrls];
+
+    if (![urls count])
+    {
+        DLog (@"All URLs were shortened recently");
+
+        /* Delegates expect to hear about it after this returns, as they would from the connection */
+        dispatch_async(dispatch_get_main_queue(), ^
+        {
+            [self applyShortenedUrls:cachedUrls toActivity:theActivity];
+        });
+        return;
+    }
 
     NSString *urlsArg = [[urls JR_jsonString] stringByAddingPercentEncodingWithAllowedCharacters:[NSCharacterSet URLQueryAllowedCharacterSet]];
     NSString *urlString = [NSString stringWithFormat:@"%@/openid/get_urls?urls=%@&app_name=%@&device=%@",
@@ -1499,43 +1750,82 @@ static JRSessionData *singleton = nil;
     NSURLRequest *request = [NSURLRequest requestWithURL:[NSURL URLWithString:urlString]];
 
     NSDictionary *tag = [NSDictionary dictionaryWithObjectsAndKeys:theActivity, @"activity",
+                                                                   cachedUrls, @"cachedUrls",
                                                                    @"shortenUrls", @"action", nil];
 
-    [JRConnectionManager createConnectionFromRequest:request forDelegate:self withTag:tag];
+    [JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:NO withTag:tag
+                                         retryPolicy:[JRRetryPolicy defaultPolicy]
+                                            priority:JRConnectionPriorityBackground];
+}
+
+- (void)sortUrls:(NSArray *)longUrls forChannel:(NSString *)channel intoUncached:(NSMutableDictionary *)uncached
+       andCached:(NSMutableDictionary *)cached
+{
+    NSMutableArray *uncachedUrls = [NSMutableArray array];
+    NSMutableDictionary *cachedUrls = [NSMutableDictionary dictionary];
+
+    for (NSString *longUrl in longUrls)
+    {
+        NSString *shortenedUrl = [shortenedUrlCache shortenedUrlForUrl:longUrl channel:channel];
+        if (shortenedUrl)
+            [cachedUrls setObject:shortenedUrl forKey:longUrl];
+        else
+            [uncachedUrls addObject:longUrl];
+    }
+
+    if ([uncachedUrls count]) [uncached setObject:uncachedUrls forKey:channel];
+    if ([cachedUrls count]) [cached setObject:cachedUrls forKey:channel];
 }
 
 - (void)finishGetShortenedUrlsForActivity:(JRActivityObject *)_activity withShortenedUrls:(NSString *)urls
+                               cachedUrls:(NSDictionary *)cachedUrls
 {
     DLog ("Shortened Urls: %@", urls);
 
     NSDictionary *dict = [urls JR_objectFromJSONString];
+    NSMutableDictionary *shortenedUrls = [NSMutableDictionary dictionaryWithCapacity:3];
 
-    if (dict && !([dict objectForKey:@"err"]))
+    for (NSString *channel in [NSArray arrayWithObjects:@"email", @"sms", @"activity", nil])
     {
-        NSDictionary *emailUrls    = [[dict objectForKey:@"urls"] objectForKey:@"email"];
-        NSDictionary *smsUrls      = [[dict objectForKey:@"urls"] objectForKey:@"sms"];
-        NSDictionary *activityUrls = [[dict objectForKey:@"urls"] objectForKey:@"activity"];
+        NSMutableDictionary *channelUrls = [NSMutableDictionary dictionary];
+        [channelUrls addEntriesFromDictionary:[cachedUrls objectForKey:channel]];
 
-        for (NSString *key in [emailUrls allKeys])
+        NSDictionary *fetchedUrls = [dict isKindOfClass:[NSDictionary class]] && ![dict objectForKey:@"err"] ?
+                [[dict objectForKey:@"urls"] objectForKey:channel] : nil;
+        if ([fetchedUrls isKindOfClass:[NSDictionary class]])
         {
-            _activity.email.messageBody = [_activity.email.messageBody
-                                           stringByReplacingOccurrencesOfString:key
-                                           withString:[emailUrls objectForKey:key]];
-        }
+            for (NSString *longUrl in fetchedUrls)
+            {
+                NSString *shortenedUrl = [fetchedUrls objectForKey:longUrl];
+                if (![shortenedUrl isKindOfClass:[NSString class]]) continue;
 
-        for (NSString *key in [smsUrls allKeys])
-        {
-            _activity.sms.message = [_activity.sms.message
-                                     stringByReplacingOccurrencesOfString:key
-                                     withString:[smsUrls objectForKey:key]];
+                [shortenedUrlCache setShortenedUrl:shortenedUrl forUrl:longUrl channel:channel];
+                [channelUrls setObject:shortenedUrl forKey:longUrl];
+            }
         }
 
-        for (NSString *key in [activityUrls allKeys])
-        {
-            if ([key isEqualToString:activity.url])
-                [_activity setShortenedUrl:[activityUrls objectForKey:key]];
-        }
+        if ([channelUrls count]) [shortenedUrls setObject:channelUrls forKey:channel];
     }
+
+    [self applyShortenedUrls:shortenedUrls toActivity:_activity];
+}
+
+/* shortenedUrls maps each channel ("email", "sms", "activity") to a dictionary of long urls to short ones */
+- (void)applyShortenedUrls:(NSDictionary *)shortenedUrls toActivity:(JRActivityObject *)_activity
+{
+    NSDictionary *emailUrls = [shortenedUrls objectForKey:@"email"];
+    if ([emailUrls count] && _activity.email.messageBody)
+        _activity.email.messageBody = [_activity.email.messageBody JR_stringByReplacingOccurrencesOfStrings:emailUrls];
+
+    NSDictionary *smsUrls = [shortenedUrls objectForKey:@"sms"];
+    if ([smsUrls count] && _activity.sms.message)
+        _activity.sms.message = [_activity.sms.message JR_stringByReplacingOccurrencesOfStrings:smsUrls];
+
+    NSString *shortenedActivityUrl = _activity.url ?
+            [[shortenedUrls objectForKey:@"activity"] objectForKey:_activity.url] : nil;
+    if (shortenedActivityUrl)
+        [_activity setShortenedUrl:shortenedActivityUrl];
+
     for (id<JRSessionDelegate> delegate in [NSArray arrayWithArray:delegates])
         if ([delegate respondsToSelector:@selector(urlShortenedToNewUrl:forActivity:)])
             [delegate urlShortenedToNewUrl:[_activity shortenedUrl] forActivity:_activity];
@@ -1549,12 +1839,15 @@ static JRSessionData *singleton = nil;
     NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:_tokenUrl]];
 
     [request setHTTPMethod:@"POST"];
+    [request JR_setOperationName:@"token_url"];
     
     NSDictionary *tag = [NSDictionary dictionaryWithObjectsAndKeys:_tokenUrl, @"tokenUrl",
                                                                    providerName, @"providerName",
                                                                    @"callTokenUrl", @"action", nil];
 
-    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:YES withTag:tag])
+    if (![JRConnectionManager createConnectionFromRequest:request forDelegate:self returnFullResponse:YES withTag:tag
+                                              retryPolicy:[JRRetryPolicy defaultPolicy]
+                                                 priority:JRConnectionPriorityCritical])
     {
         NSError *_error = [JREngageError errorWithMessage:@"Problem initializing the connection to the token url"
                                                   andCode:JRAuthenticationTokenUrlFailedError];
@@ -1646,7 +1939,8 @@ static JRSessionData *singleton = nil;
         else if ([action isEqualToString:@"shortenUrls"])
         {
             [self finishGetShortenedUrlsForActivity:[(NSDictionary *)tag objectForKey:@"activity"]
-                                  withShortenedUrls:payload];
+                                  withShortenedUrls:payload
+                                         cachedUrls:[(NSDictionary *)tag objectForKey:@"cachedUrls"]];
         }
     }
     else if ([tag isKindOfClass:[NSString class]])
@@ -1678,6 +1972,10 @@ static JRSessionData *singleton = nil;
         {
             self.error = [JREngageError errorWithMessage:@"There was a problem communicating with the Janrain server while configuring authentication."
                                                  andCode:JRConfigurationInformationError];
+            [[NSNotificationCenter defaultCenter]
+                    postNotificationName:JRFailedToUpdateEngageConfigurationNotification
+                                  object:self
+                                userInfo:@{@"error" : self.error}];
         }
         else if ([(NSString *)tag isEqualToString:@"emailSuccess"])
         {
@@ -1722,13 +2020,10 @@ static JRSessionData *singleton = nil;
         }
         else if ([action isEqualToString:@"shortenUrls"])
         {
-            /* Call with _activity.shortenedUrl (as opposed to newShortened) in case there was an error, as
-             * _activity.shortenedUrl was previously set to fall back to the full url. */
-            NSArray *delegatesCopy = [NSArray arrayWithArray:delegates];
-            for (id<JRSessionDelegate> delegate in delegatesCopy)
-                if ([delegate respondsToSelector:@selector(urlShortenedToNewUrl:forActivity:)])
-                    [delegate urlShortenedToNewUrl:((JRActivityObject *)[(NSDictionary *)tag objectForKey:@"activity"]).shortenedUrl
-                                       forActivity:((JRActivityObject *)[(NSDictionary *)tag objectForKey:@"activity"])];
+            /* Still use whatever was cached; the delegates hear _activity.shortenedUrl, which was set to fall back
+             * to the full url in case there was an error. */
+            [self applyShortenedUrls:[(NSDictionary *)tag objectForKey:@"cachedUrls"]
+                          toActivity:[(NSDictionary *)tag objectForKey:@"activity"]];
         }
         else
         {
@@ -1762,6 +2057,8 @@ static JRSessionData *singleton = nil;
     // application issues the cancelAuthentication command.
     if (!currentProvider)
         return;
+
+    [[JRTracer sharedTracer] endSpanWithName:@"engage.authentication_dialog"];
     
     NSDictionary *rpxResult = [payloadDict objectForKey:@"rpx_result"];
     NSString *token = [rpxResult objectForKey:@"token"];
@@ -1782,10 +2079,9 @@ static JRSessionData *singleton = nil;
 
     if (user)
     {
-        [authenticatedUsersByProvider setObject:user forKey:currentProvider.name];
-        NSData *usersData = [NSKeyedArchiver archivedDataWithRootObject:authenticatedUsersByProvider];
-        [[NSUserDefaults standardUserDefaults] setObject:usersData forKey:cJRAuthenticatedUsersByProvider];
-        [[NSUserDefaults standardUserDefaults] synchronize];
+        [self.authenticatedUsersByProvider setObject:user forKey:currentProvider.name];
+        [[JRSessionStore sharedStore] setArchivedObject:self.authenticatedUsersByProvider
+                                                 forKey:cJRAuthenticatedUsersByProvider];
     }
 
     if ([self.authenticationProviders containsObject:currentProvider.name] && !socialSharing)
@@ -1839,10 +2135,9 @@ static JRSessionData *singleton = nil;
     }
     
     if (user) {
-        [authenticatedUsersByProvider setObject:user forKey:currentProvider.name];
-        NSData *usersData = [NSKeyedArchiver archivedDataWithRootObject:authenticatedUsersByProvider];
-        [[NSUserDefaults standardUserDefaults] setObject:usersData forKey:cJRAuthenticatedUsersByProvider];
-        [[NSUserDefaults standardUserDefaults] synchronize];
+        [self.authenticatedUsersByProvider setObject:user forKey:currentProvider.name];
+        [[JRSessionStore sharedStore] setArchivedObject:self.authenticatedUsersByProvider
+                                                 forKey:cJRAuthenticatedUsersByProvider];
     }
     
     if ([self.authenticationProviders containsObject:currentProvider.name] && !socialSharing) {
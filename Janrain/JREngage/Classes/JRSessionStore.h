@@ -0,0 +1,94 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Write-behind front for the NSUserDefaults keys JRSessionData keeps its state under.
+ *
+ * Writes only mark a key dirty; the dirty keys are written together once per turn of the main run loop, or straight
+ * away when the app goes to the background or is about to terminate. Values that equal what's already stored aren't
+ * written at all, so rewriting an unchanged configuration costs nothing. Reads see pending values. There are no
+ * -synchronize calls on the sign-in and sharing paths: NSUserDefaults persists on its own, and the store only
+ * synchronizes on the way into the background.
+ *
+ * The setters can be called from any thread. -flush, and with it the archiving of objects given to
+ * -setArchivedObject:forKey:, runs on the main thread.
+ */
+@interface JRSessionStore : NSObject
+@property(readonly) NSUserDefaults *userDefaults;
+
+/**
+ * Backed by [NSUserDefaults standardUserDefaults].
+ */
++ (JRSessionStore *)sharedStore;
+
+- (id)initWithUserDefaults:(NSUserDefaults *)userDefaults;
+
+- (id)objectForKey:(NSString *)key;
+
+- (NSString *)stringForKey:(NSString *)key;
+
+- (BOOL)boolForKey:(NSString *)key;
+
+/**
+ * The object last given to -setArchivedObject:forKey:, or the one unarchived from the stored data.
+ */
+- (id)unarchivedObjectForKey:(NSString *)key;
+
+/**
+ * A nil object removes the key.
+ */
+- (void)setObject:(id)object forKey:(NSString *)key;
+
+- (void)setBool:(BOOL)value forKey:(NSString *)key;
+
+/**
+ * The object isn't archived until the flush, so a mutable collection can go on changing until then and only its
+ * final state gets archived and written. Main thread objects only.
+ */
+- (void)setArchivedObject:(id <NSCoding>)object forKey:(NSString *)key;
+
+- (void)removeObjectForKey:(NSString *)key;
+
+- (BOOL)hasPendingChanges;
+
+/**
+ * Writes the pending changes now. Returns how many keys actually changed. Main thread only.
+ */
+- (NSUInteger)flush;
+
+/**
+ * -flush, then -[NSUserDefaults synchronize]; what the store does when the app goes to the background.
+ */
+- (void)flushAndSynchronize;
+@end
@@ -0,0 +1,255 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <UIKit/UIKit.h>
+#import "JRSessionStore.h"
+#import "JRStageMetrics.h"
+
+/* Pending value for -setArchivedObject:forKey:, archived when it's flushed */
+@interface JRSessionStoreArchivedValue : NSObject
+@property(readonly) id object;
+- (id)initWithObject:(id)object;
+@end
+
+@implementation JRSessionStoreArchivedValue
+@synthesize object;
+
+- (id)initWithObject:(id)theObject
+{
+    if ((self = [super init]))
+        object = theObject;
+
+    return self;
+}
+@end
+
+@implementation JRSessionStore
+{
+    /* Only touched on stateQueue. A removed key is pending as NSNull. */
+    dispatch_queue_t stateQueue;
+    NSMutableDictionary *pendingValues;
+    BOOL flushScheduled;
+}
+
+@synthesize userDefaults;
+
++ (JRSessionStore *)sharedStore
+{
+    static JRSessionStore *sharedStore = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        sharedStore = [[JRSessionStore alloc] initWithUserDefaults:[NSUserDefaults standardUserDefaults]];
+    });
+
+    return sharedStore;
+}
+
+- (id)initWithUserDefaults:(NSUserDefaults *)theUserDefaults
+{
+    if ((self = [super init]))
+    {
+        userDefaults = theUserDefaults;
+        stateQueue = dispatch_queue_create("com.janrain.engage.sessionStore", DISPATCH_QUEUE_SERIAL);
+        pendingValues = [NSMutableDictionary dictionary];
+
+        NSNotificationCenter *center = [NSNotificationCenter defaultCenter];
+        [center addObserver:self selector:@selector(applicationWillLeaveForeground:)
+                       name:UIApplicationDidEnterBackgroundNotification object:nil];
+        [center addObserver:self selector:@selector(applicationWillLeaveForeground:)
+                       name:UIApplicationWillTerminateNotification object:nil];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)applicationWillLeaveForeground:(NSNotification *)notification
+{
+    [self flushAndSynchronize];
+}
+
+#pragma mark reading
+
+- (id)pendingValueForKey:(NSString *)key
+{
+    __block id value;
+    dispatch_sync(stateQueue, ^
+    {
+        value = [self->pendingValues objectForKey:key];
+    });
+
+    return value;
+}
+
+- (id)objectForKey:(NSString *)key
+{
+    id value = [self pendingValueForKey:key];
+    if (!value) return [userDefaults objectForKey:key];
+    if (value == [NSNull null]) return nil;
+
+    if ([value isKindOfClass:[JRSessionStoreArchivedValue class]])
+        return [NSKeyedArchiver archivedDataWithRootObject:[value object]];
+
+    return value;
+}
+
+- (NSString *)stringForKey:(NSString *)key
+{
+    id value = [self objectForKey:key];
+    return [value isKindOfClass:[NSString class]] ? value : nil;
+}
+
+- (BOOL)boolForKey:(NSString *)key
+{
+    id value = [self objectForKey:key];
+    return [value respondsToSelector:@selector(boolValue)] ? [value boolValue] : NO;
+}
+
+- (id)unarchivedObjectForKey:(NSString *)key
+{
+    id value = [self pendingValueForKey:key];
+    if ([value isKindOfClass:[JRSessionStoreArchivedValue class]]) return [value object];
+    if (value == [NSNull null]) return nil;
+
+    NSData *data = value ? value : [userDefaults objectForKey:key];
+    if (![data isKindOfClass:[NSData class]]) return nil;
+
+    JR_STAGE_BEGIN(JRStageUnarchive);
+    id object = [NSKeyedUnarchiver unarchiveObjectWithData:data];
+    JR_STAGE_END(JRStageUnarchive);
+
+    return object;
+}
+
+#pragma mark writing
+
+- (void)setPendingValue:(id)value forKey:(NSString *)key
+{
+    if (!key) return;
+
+    dispatch_async(stateQueue, ^
+    {
+        [self->pendingValues setObject:value forKey:key];
+        if (self->flushScheduled) return;
+
+        self->flushScheduled = YES;
+        dispatch_async(dispatch_get_main_queue(), ^
+        {
+            [self flush];
+        });
+    });
+}
+
+- (void)setObject:(id)object forKey:(NSString *)key
+{
+    [self setPendingValue:object ? object : [NSNull null] forKey:key];
+}
+
+- (void)setBool:(BOOL)value forKey:(NSString *)key
+{
+    [self setPendingValue:[NSNumber numberWithBool:value] forKey:key];
+}
+
+- (void)setArchivedObject:(id <NSCoding>)object forKey:(NSString *)key
+{
+    [self setPendingValue:object ? [[JRSessionStoreArchivedValue alloc] initWithObject:object] : [NSNull null]
+                   forKey:key];
+}
+
+- (void)removeObjectForKey:(NSString *)key
+{
+    [self setPendingValue:[NSNull null] forKey:key];
+}
+
+- (BOOL)hasPendingChanges
+{
+    __block BOOL hasPendingChanges;
+    dispatch_sync(stateQueue, ^
+    {
+        hasPendingChanges = [self->pendingValues count] > 0;
+    });
+
+    return hasPendingChanges;
+}
+
+#pragma mark flushing
+
+- (NSUInteger)flush
+{
+    __block NSDictionary *changes;
+    dispatch_sync(stateQueue, ^
+    {
+        changes = [self->pendingValues copy];
+        [self->pendingValues removeAllObjects];
+        self->flushScheduled = NO;
+    });
+
+    NSUInteger changedKeyCount = 0;
+    for (NSString *key in changes)
+    {
+        id value = [changes objectForKey:key];
+        if (value == [NSNull null])
+        {
+            value = nil;
+        }
+        else if ([value isKindOfClass:[JRSessionStoreArchivedValue class]])
+        {
+            JR_STAGE_BEGIN(JRStageArchive);
+            value = [NSKeyedArchiver archivedDataWithRootObject:[value object]];
+            JR_STAGE_END(JRStageArchive);
+        }
+
+        id storedValue = [userDefaults objectForKey:key];
+        if (value == storedValue || [value isEqual:storedValue])
+            continue;
+
+        if (value)
+            [userDefaults setObject:value forKey:key];
+        else
+            [userDefaults removeObjectForKey:key];
+
+        changedKeyCount++;
+    }
+
+    return changedKeyCount;
+}
+
+- (void)flushAndSynchronize
+{
+    [self flush];
+    [userDefaults synchronize];
+}
+@end
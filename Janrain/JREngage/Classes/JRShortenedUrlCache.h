@@ -0,0 +1,57 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Remembers the short URLs Engage's openid/get_urls handed back, so sharing the same content again doesn't need
+ * another round trip. Entries are kept per channel ("email", "sms", "activity"), as Engage may shorten the same URL
+ * differently for each, and expire after timeToLive seconds. Beyond capacity entries, the least recently used one is
+ * dropped. Main thread only, like JRSessionData.
+ */
+@interface JRShortenedUrlCache : NSObject
+@property(readonly) NSUInteger capacity;
+@property(readonly) NSTimeInterval timeToLive;
+
+- (id)initWithCapacity:(NSUInteger)capacity timeToLive:(NSTimeInterval)timeToLive;
+
+/**
+ * nil if the URL hasn't been shortened for the channel, or was shortened too long ago.
+ */
+- (NSString *)shortenedUrlForUrl:(NSString *)url channel:(NSString *)channel;
+
+- (void)setShortenedUrl:(NSString *)shortenedUrl forUrl:(NSString *)url channel:(NSString *)channel;
+
+- (NSUInteger)count;
+
+- (void)removeAllUrls;
+@end
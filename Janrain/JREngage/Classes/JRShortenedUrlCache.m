@@ -0,0 +1,133 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRShortenedUrlCache.h"
+
+@interface JRShortenedUrlCacheEntry : NSObject
+@property(readonly) NSString *shortenedUrl;
+@property(readonly) NSTimeInterval expiresAt;
+- (id)initWithShortenedUrl:(NSString *)shortenedUrl expiresAt:(NSTimeInterval)expiresAt;
+@end
+
+@implementation JRShortenedUrlCacheEntry
+@synthesize shortenedUrl;
+@synthesize expiresAt;
+
+- (id)initWithShortenedUrl:(NSString *)theShortenedUrl expiresAt:(NSTimeInterval)theExpiresAt
+{
+    if ((self = [super init]))
+    {
+        shortenedUrl = [theShortenedUrl copy];
+        expiresAt = theExpiresAt;
+    }
+
+    return self;
+}
+@end
+
+@implementation JRShortenedUrlCache
+{
+    NSMutableDictionary *entries;
+    NSMutableArray *leastRecentlyUsed;
+}
+
+@synthesize capacity;
+@synthesize timeToLive;
+
+- (id)initWithCapacity:(NSUInteger)theCapacity timeToLive:(NSTimeInterval)theTimeToLive
+{
+    if ((self = [super init]))
+    {
+        capacity = MAX(theCapacity, 1);
+        timeToLive = theTimeToLive;
+        entries = [NSMutableDictionary dictionary];
+        leastRecentlyUsed = [NSMutableArray array];
+    }
+
+    return self;
+}
+
+- (NSString *)keyForUrl:(NSString *)url channel:(NSString *)channel
+{
+    return [NSString stringWithFormat:@"%@ %@", channel, url];
+}
+
+- (NSString *)shortenedUrlForUrl:(NSString *)url channel:(NSString *)channel
+{
+    if (!url || !channel) return nil;
+
+    NSString *key = [self keyForUrl:url channel:channel];
+    JRShortenedUrlCacheEntry *entry = [entries objectForKey:key];
+    if (!entry) return nil;
+
+    [leastRecentlyUsed removeObject:key];
+    if (entry.expiresAt <= [NSDate timeIntervalSinceReferenceDate])
+    {
+        [entries removeObjectForKey:key];
+        return nil;
+    }
+
+    [leastRecentlyUsed addObject:key];
+    return entry.shortenedUrl;
+}
+
+- (void)setShortenedUrl:(NSString *)shortenedUrl forUrl:(NSString *)url channel:(NSString *)channel
+{
+    if (![shortenedUrl isKindOfClass:[NSString class]] || !url || !channel) return;
+
+    NSString *key = [self keyForUrl:url channel:channel];
+    if (![entries objectForKey:key])
+    {
+        while ([leastRecentlyUsed count] >= capacity)
+        {
+            [entries removeObjectForKey:[leastRecentlyUsed objectAtIndex:0]];
+            [leastRecentlyUsed removeObjectAtIndex:0];
+        }
+    }
+
+    NSTimeInterval expiresAt = [NSDate timeIntervalSinceReferenceDate] + timeToLive;
+    [entries setObject:[[JRShortenedUrlCacheEntry alloc] initWithShortenedUrl:shortenedUrl expiresAt:expiresAt]
+                forKey:key];
+    [leastRecentlyUsed removeObject:key];
+    [leastRecentlyUsed addObject:key];
+}
+
+- (NSUInteger)count
+{
+    return [entries count];
+}
+
+- (void)removeAllUrls
+{
+    [entries removeAllObjects];
+    [leastRecentlyUsed removeAllObjects];
+}
+@end
@@ -0,0 +1,89 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * Counters and latency histograms for the CPU-bound stages of the library: JSON parsing and serialization, building
+ * and flattening the Capture model, date parsing, archiving, and the session's share of app launch (main thread time
+ * in JRSessionData's initializer, the background load of the saved session state, and any time the main thread then
+ * spent waiting on that load). JSON parsed while it downloads is counted once per chunk, as json_parse_chunk.
+ * Recording is a handful of relaxed atomic adds, so it's safe to leave on in production and on any thread.
+ *
+ * Build with JR_STAGE_METRICS defined to 0 to compile it out; JR_STAGE_BEGIN and JR_STAGE_END then expand to
+ * nothing and the snapshot is always empty.
+ */
+#ifndef JR_STAGE_METRICS
+#define JR_STAGE_METRICS 1
+#endif
+
+typedef NS_ENUM(NSUInteger, JRStage)
+{
+    JRStageJSONParse = 0,
+    JRStageJSONSerialize,
+    JRStageModelBuild,
+    JRStageModelEncode,
+    JRStageUpdateDictionary,
+    JRStageReplaceDictionary,
+    JRStageDateParse,
+    JRStageArchive,
+    JRStageUnarchive,
+    JRStageSessionInit,
+    JRStageSessionStateLoad,
+    JRStageSessionStateWait,
+    JRStageJSONParseChunk,
+    JRStageCount
+};
+
+#if JR_STAGE_METRICS
+uint64_t JRStageMetricsNow(void);
+void JRStageMetricsRecord(JRStage stage, uint64_t startTime);
+
+#define JR_STAGE_BEGIN(stage) uint64_t jrStageStart_##stage = JRStageMetricsNow()
+#define JR_STAGE_END(stage) JRStageMetricsRecord(stage, jrStageStart_##stage)
+#else
+#define JR_STAGE_BEGIN(stage)
+#define JR_STAGE_END(stage)
+#endif
+
+@interface JRStageMetrics : NSObject
+/**
+ * Keyed by stage name ("json_parse", "model_build", ...). Each value holds the "count" of times the stage ran, their
+ * "totalNanoseconds", and a "histogram" array of counts for the buckets bounded above by +histogramBucketBounds
+ * (in microseconds), plus one for anything slower.
+ */
++ (NSDictionary *)snapshot;
+
++ (void)reset;
+
++ (NSArray *)histogramBucketBounds;
+@end
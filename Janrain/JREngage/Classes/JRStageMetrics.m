@@ -0,0 +1,138 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRStageMetrics.h"
+
+#if JR_STAGE_METRICS
+#include <stdatomic.h>
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+#define JRStageBucketCount 6
+
+/* Upper bounds of all but the last bucket, in microseconds */
+static const uint64_t bucketBounds[JRStageBucketCount - 1] = { 10, 100, 1000, 10000, 100000 };
+
+static _Atomic uint64_t stageCounts[JRStageCount];
+static _Atomic uint64_t stageNanoseconds[JRStageCount];
+static _Atomic uint64_t stageBuckets[JRStageCount][JRStageBucketCount];
+
+uint64_t JRStageMetricsNow(void)
+{
+#ifdef __APPLE__
+    static mach_timebase_info_data_t timebase;
+    if (timebase.denom == 0) mach_timebase_info(&timebase);
+
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+#endif
+}
+
+void JRStageMetricsRecord(JRStage stage, uint64_t startTime)
+{
+    uint64_t elapsed = JRStageMetricsNow() - startTime;
+    uint64_t micros = elapsed / 1000;
+
+    NSUInteger bucket = 0;
+    while (bucket < JRStageBucketCount - 1 && micros >= bucketBounds[bucket])
+        bucket++;
+
+    atomic_fetch_add_explicit(&stageCounts[stage], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stageNanoseconds[stage], elapsed, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stageBuckets[stage][bucket], 1, memory_order_relaxed);
+}
+#endif
+
+@implementation JRStageMetrics
++ (NSArray *)stageNames
+{
+    return [NSArray arrayWithObjects:@"json_parse", @"json_serialize", @"model_build", @"model_encode",
+                                     @"update_dictionary", @"replace_dictionary", @"date_parse", @"archive",
+                                     @"unarchive", @"session_init", @"session_state_load", @"session_state_wait",
+                                     @"json_parse_chunk", nil];
+}
+
++ (NSArray *)histogramBucketBounds
+{
+    return [NSArray arrayWithObjects:[NSNumber numberWithUnsignedLongLong:10],
+                                     [NSNumber numberWithUnsignedLongLong:100],
+                                     [NSNumber numberWithUnsignedLongLong:1000],
+                                     [NSNumber numberWithUnsignedLongLong:10000],
+                                     [NSNumber numberWithUnsignedLongLong:100000], nil];
+}
+
++ (NSDictionary *)snapshot
+{
+    NSMutableDictionary *snapshot = [NSMutableDictionary dictionary];
+#if JR_STAGE_METRICS
+    NSArray *stageNames = [self stageNames];
+    for (NSUInteger stage = 0; stage < JRStageCount; stage++)
+    {
+        uint64_t count = atomic_load_explicit(&stageCounts[stage], memory_order_relaxed);
+        if (!count) continue;
+
+        NSMutableArray *histogram = [NSMutableArray arrayWithCapacity:JRStageBucketCount];
+        for (NSUInteger bucket = 0; bucket < JRStageBucketCount; bucket++)
+            [histogram addObject:[NSNumber numberWithUnsignedLongLong:
+                    atomic_load_explicit(&stageBuckets[stage][bucket], memory_order_relaxed)]];
+
+        uint64_t nanoseconds = atomic_load_explicit(&stageNanoseconds[stage], memory_order_relaxed);
+        [snapshot setObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                  [NSNumber numberWithUnsignedLongLong:count], @"count",
+                                                  [NSNumber numberWithUnsignedLongLong:nanoseconds], @"totalNanoseconds",
+                                                  histogram, @"histogram", nil]
+                     forKey:[stageNames objectAtIndex:stage]];
+    }
+#endif
+
+    return snapshot;
+}
+
++ (void)reset
+{
+#if JR_STAGE_METRICS
+    for (NSUInteger stage = 0; stage < JRStageCount; stage++)
+    {
+        atomic_store_explicit(&stageCounts[stage], 0, memory_order_relaxed);
+        atomic_store_explicit(&stageNanoseconds[stage], 0, memory_order_relaxed);
+        for (NSUInteger bucket = 0; bucket < JRStageBucketCount; bucket++)
+            atomic_store_explicit(&stageBuckets[stage][bucket], 0, memory_order_relaxed);
+    }
+#endif
+}
+@end
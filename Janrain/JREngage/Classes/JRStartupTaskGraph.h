@@ -0,0 +1,87 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import <Foundation/Foundation.h>
+
+typedef void (^JRStartupTaskFinish)(NSError *error);
+
+/**
+ * @internal
+ * The work the library kicks off at configuration time - downloading the Engage configuration and the Capture flow,
+ * restoring saved tokens - as named tasks. Each task starts as soon as the tasks it depends on have finished, so
+ * independent ones run concurrently, and callers can wait for exactly the tasks they need rather than for all of
+ * startup. A task that finishes with an error still counts as finished; its dependents start, and waiters are told
+ * through taskErrors. Use from the main thread; starts, waits and completions all happen there.
+ */
+@interface JRStartupTaskGraph : NSObject
+
+/**
+ * The start block is given a finish block to call, from any thread, exactly once when the task is done. It runs
+ * once the graph has been started and every named dependency has finished; dependencies that were never added
+ * don't hold the task back.
+ */
+- (void)addTaskNamed:(NSString *)name dependencies:(NSArray *)dependencies
+               start:(void (^)(JRStartupTaskFinish finish))start;
+
+/**
+ * Starts every task whose dependencies are done. Tasks added afterwards start as soon as they can.
+ */
+- (void)start;
+
+/**
+ * YES for a name that was never added: the graph only knows about work that has been scheduled, so there's nothing
+ * to wait for. This is deliberate - a task that's left out, like the flow when the configuration names none, would
+ * otherwise hold every waiter until its timeout - and it means a wait made before the tasks are added doesn't wait.
+ */
+- (BOOL)isTaskFinished:(NSString *)name;
+
+/**
+ * Runs the completion once every one of the named tasks has finished, with YES, or with NO if the timeout expires
+ * first. Names that were never added count as finished, as for isTaskFinished:. If they've all finished already the completion runs
+ * synchronously, so callers don't need a separate fast path.
+ */
+- (void)waitForTasks:(NSArray *)names timeout:(NSTimeInterval)timeout completion:(void (^)(BOOL finished))completion;
+
+/**
+ * Like waitForTasks:timeout:completion: for every task added so far
+ */
+- (void)waitForAllTasksWithTimeout:(NSTimeInterval)timeout completion:(void (^)(BOOL finished))completion;
+
+/**
+ * For each task that has started, a dictionary with its "start" time in seconds after the graph was started and,
+ * once it has finished, its "duration" in seconds
+ */
+- (NSDictionary *)taskTimings;
+
+/**
+ * The error each failed task finished with, keyed by task name
+ */
+- (NSDictionary *)taskErrors;
+@end
@@ -0,0 +1,254 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#import "debug_log.h"
+#import "JRStartupTaskGraph.h"
+
+@interface JRStartupTask : NSObject
+@property(nonatomic, copy) NSString *name;
+@property(nonatomic, copy) NSArray *dependencies;
+@property(nonatomic, copy) void (^start)(JRStartupTaskFinish finish);
+@property(nonatomic) CFAbsoluteTime startTime;
+@property(nonatomic) CFAbsoluteTime finishTime;
+@property(nonatomic) NSError *error;
+@property(nonatomic) BOOL started;
+@property(nonatomic) BOOL finished;
+@end
+
+@implementation JRStartupTask
+@synthesize name;
+@synthesize dependencies;
+@synthesize start;
+@synthesize startTime;
+@synthesize finishTime;
+@synthesize error;
+@synthesize started;
+@synthesize finished;
+@end
+
+@interface JRStartupTaskWaiter : NSObject
+@property(nonatomic, copy) NSArray *names;
+@property(nonatomic, copy) void (^completion)(BOOL finished);
+@end
+
+@implementation JRStartupTaskWaiter
+@synthesize names;
+@synthesize completion;
+@end
+
+@interface JRStartupTaskGraph ()
+@property(nonatomic) NSMutableDictionary *tasks;
+@property(nonatomic) NSMutableArray *waiters;
+@property(nonatomic) CFAbsoluteTime graphStartTime;
+@property(nonatomic) BOOL started;
+@end
+
+@implementation JRStartupTaskGraph
+@synthesize tasks;
+@synthesize waiters;
+@synthesize graphStartTime;
+@synthesize started;
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        tasks = [NSMutableDictionary dictionary];
+        waiters = [NSMutableArray array];
+    }
+
+    return self;
+}
+
+- (void)addTaskNamed:(NSString *)name dependencies:(NSArray *)dependencies
+               start:(void (^)(JRStartupTaskFinish finish))start
+{
+    if ([self.tasks objectForKey:name])
+    {
+        ALog(@"Startup task %@ was already added", name);
+        return;
+    }
+
+    JRStartupTask *task = [[JRStartupTask alloc] init];
+    task.name = name;
+    task.dependencies = dependencies ? dependencies : [NSArray array];
+    task.start = start;
+    [self.tasks setObject:task forKey:name];
+
+    if (self.started) [self startReadyTasks];
+}
+
+- (void)start
+{
+    if (self.started) return;
+
+    self.started = YES;
+    self.graphStartTime = CFAbsoluteTimeGetCurrent();
+    [self startReadyTasks];
+}
+
+- (BOOL)isTaskFinished:(NSString *)name
+{
+    JRStartupTask *task = [self.tasks objectForKey:name];
+    return !task || task.finished;
+}
+
+- (BOOL)areTasksFinished:(NSArray *)names
+{
+    for (NSString *name in names)
+        if (![self isTaskFinished:name]) return NO;
+
+    return YES;
+}
+
+/* Starting a task can finish it synchronously, which makes more tasks ready, so go round until nothing changes */
+- (void)startReadyTasks
+{
+    BOOL startedOne;
+    do
+    {
+        startedOne = NO;
+        for (JRStartupTask *task in [self.tasks allValues])
+        {
+            if (task.started || ![self areTasksFinished:task.dependencies]) continue;
+
+            [self startTask:task];
+            startedOne = YES;
+        }
+    }
+    while (startedOne);
+}
+
+- (void)startTask:(JRStartupTask *)task
+{
+    task.started = YES;
+    task.startTime = CFAbsoluteTimeGetCurrent();
+    DLog(@"Starting startup task %@", task.name);
+
+    __weak JRStartupTaskGraph *weakSelf = self;
+    __block BOOL calledFinish = NO;
+    JRStartupTaskFinish finish = ^(NSError *error)
+    {
+        dispatch_block_t finishOnMain = ^
+        {
+            if (calledFinish) return;
+            calledFinish = YES;
+            [weakSelf finishTask:task withError:error];
+        };
+
+        if ([NSThread isMainThread]) finishOnMain();
+        else dispatch_async(dispatch_get_main_queue(), finishOnMain);
+    };
+
+    void (^start)(JRStartupTaskFinish) = task.start;
+    task.start = nil;
+    start(finish);
+}
+
+- (void)finishTask:(JRStartupTask *)task withError:(NSError *)error
+{
+    task.finished = YES;
+    task.finishTime = CFAbsoluteTimeGetCurrent();
+    task.error = error;
+
+    if (error) ALog(@"Startup task %@ failed after %f seconds: %@", task.name, task.finishTime - task.startTime, error);
+    else DLog(@"Startup task %@ finished in %f seconds", task.name, task.finishTime - task.startTime);
+
+    [self startReadyTasks];
+    [self notifyWaiters];
+}
+
+- (void)notifyWaiters
+{
+    for (JRStartupTaskWaiter *waiter in [NSArray arrayWithArray:self.waiters])
+    {
+        if (![self areTasksFinished:waiter.names]) continue;
+
+        [self.waiters removeObjectIdenticalTo:waiter];
+        waiter.completion(YES);
+    }
+}
+
+- (void)waitForTasks:(NSArray *)names timeout:(NSTimeInterval)timeout completion:(void (^)(BOOL finished))completion
+{
+    if ([self areTasksFinished:names])
+    {
+        completion(YES);
+        return;
+    }
+
+    JRStartupTaskWaiter *waiter = [[JRStartupTaskWaiter alloc] init];
+    waiter.names = names;
+    waiter.completion = completion;
+    [self.waiters addObject:waiter];
+
+    __weak JRStartupTaskGraph *weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (timeout * NSEC_PER_SEC)), dispatch_get_main_queue(), ^
+    {
+        JRStartupTaskGraph *graph = weakSelf;
+        if (![graph.waiters containsObject:waiter]) return;
+
+        [graph.waiters removeObjectIdenticalTo:waiter];
+        waiter.completion(NO);
+    });
+}
+
+- (void)waitForAllTasksWithTimeout:(NSTimeInterval)timeout completion:(void (^)(BOOL finished))completion
+{
+    [self waitForTasks:[self.tasks allKeys] timeout:timeout completion:completion];
+}
+
+- (NSDictionary *)taskTimings
+{
+    NSMutableDictionary *timings = [NSMutableDictionary dictionary];
+    for (JRStartupTask *task in [self.tasks allValues])
+    {
+        if (!task.started) continue;
+
+        NSMutableDictionary *timing = [NSMutableDictionary dictionary];
+        [timing setObject:[NSNumber numberWithDouble:task.startTime - self.graphStartTime] forKey:@"start"];
+        if (task.finished)
+            [timing setObject:[NSNumber numberWithDouble:task.finishTime - task.startTime] forKey:@"duration"];
+
+        [timings setObject:timing forKey:task.name];
+    }
+
+    return timings;
+}
+
+- (NSDictionary *)taskErrors
+{
+    NSMutableDictionary *errors = [NSMutableDictionary dictionary];
+    for (JRStartupTask *task in [self.tasks allValues])
+        if (task.error) [errors setObject:task.error forKey:task.name];
+
+    return errors;
+}
+@end
@@ -0,0 +1,70 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+/**
+ * @internal
+ * Lays out a string for JRTextFitter. The real one wraps a font and line break mode (see JRPreviewLabel); tests and
+ * benchmarks supply fake metrics.
+ */
+@protocol JRTextMeasurer <NSObject>
+/**
+ * The size the string takes up when laid out within size, as -[NSString boundingRectWithSize:...] would report it.
+ */
+- (CGSize)sizeOfString:(NSString *)string constrainedToSize:(CGSize)size;
+
+- (CGFloat)lineHeight;
+@end
+
+/**
+ * @internal
+ * Finds how much of a string fits in a box, by binary searching the prefix length rather than measuring every
+ * prefix, so it costs O(log n) layouts instead of O(n).
+ */
+@interface JRTextFitter : NSObject
+@property(readonly) id<JRTextMeasurer> measurer;
+
+/**
+ * The number of times the measurer has been asked for a size, for tests and benchmarks.
+ */
+@property(readonly) NSUInteger measurementCount;
+
+- (id)initWithMeasurer:(id<JRTextMeasurer>)measurer;
+
+/**
+ * The length of the longest prefix of string that fits within size. When breakAtWords is YES, that is pulled back
+ * to just after the last space, newline or hyphen up to and including the first character that didn't fit, so the
+ * remainder starts on a word boundary.
+ */
+- (NSUInteger)lengthOfString:(NSString *)string visibleInSize:(CGSize)size breakAtWords:(BOOL)breakAtWords;
+@end
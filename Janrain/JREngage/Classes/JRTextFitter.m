@@ -0,0 +1,104 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRTextFitter.h"
+
+@interface JRTextFitter ()
+@property(readwrite) NSUInteger measurementCount;
+@end
+
+@implementation JRTextFitter
+@synthesize measurer;
+@synthesize measurementCount;
+
+- (id)initWithMeasurer:(id<JRTextMeasurer>)theMeasurer
+{
+    if ((self = [super init]))
+    {
+        measurer = theMeasurer;
+    }
+
+    return self;
+}
+
++ (NSCharacterSet *)breakingCharacters
+{
+    static NSCharacterSet *breakingCharacters = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^
+    {
+        NSMutableCharacterSet *characters = [[NSCharacterSet whitespaceAndNewlineCharacterSet] mutableCopy];
+        [characters addCharactersInString:@"-"];
+        breakingCharacters = [characters copy];
+    });
+
+    return breakingCharacters;
+}
+
+- (BOOL)prefixOfString:(NSString *)string length:(NSUInteger)length fitsInSize:(CGSize)size
+{
+    self.measurementCount++;
+
+    /* Allow one line more than the box, so that text that doesn't fit shows up as too tall rather than getting cut
+       off at the constraint */
+    CGSize constraint = CGSizeMake(size.width, size.height + [measurer lineHeight]);
+    CGSize stringSize = [measurer sizeOfString:[string substringToIndex:length] constrainedToSize:constraint];
+
+    return stringSize.height <= size.height && stringSize.width <= size.width;
+}
+
+- (NSUInteger)lengthOfString:(NSString *)string visibleInSize:(CGSize)size breakAtWords:(BOOL)breakAtWords
+{
+    NSUInteger stringLength = [string length];
+    if (stringLength == 0)
+        return 0;
+
+    /* Longer prefixes never take up less room, so the fitting lengths are exactly those up to some breakpoint */
+    NSUInteger low = 0, high = stringLength;
+    while (low < high)
+    {
+        NSUInteger middle = low + (high - low + 1) / 2;
+        if ([self prefixOfString:string length:middle fitsInSize:size])
+            low = middle;
+        else
+            high = middle - 1;
+    }
+
+    if (!breakAtWords)
+        return low;
+
+    NSUInteger searchLength = MIN(low + 1, stringLength);
+    NSRange lastBreak = [string rangeOfCharacterFromSet:[JRTextFitter breakingCharacters]
+                                                options:NSBackwardsSearch range:NSMakeRange(0, searchLength)];
+
+    return lastBreak.location == NSNotFound ? low : NSMaxRange(lastBreak);
+}
+@end
@@ -0,0 +1,128 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * One timed stage of a trace. Spans are started through JRTracer and exported when they end.
+ */
+@interface JRTraceSpan : NSObject
+@property(nonatomic, readonly) NSString *name;
+@property(nonatomic, readonly) NSString *correlationId;
+@property(nonatomic, readonly) NSString *spanId;
+@property(nonatomic, readonly) NSString *parentSpanId;
+@property(nonatomic, readonly) NSDate *startDate;
+@property(nonatomic, readonly) NSTimeInterval duration;
+@property(nonatomic, readonly) BOOL ended;
+@property(nonatomic, readonly) NSDictionary *attributes;
+
+- (void)setAttribute:(id)value forKey:(NSString *)key;
+
+/**
+ * Ends the span, and any of its descendants still open. Ending a span twice does nothing.
+ */
+- (void)end;
+@end
+
+@protocol JRTraceExporter <NSObject>
+/**
+ * Called on the main thread as each span ends
+ */
+- (void)exportSpan:(JRTraceSpan *)span;
+@end
+
+/**
+ * @internal
+ * A lightweight tracer for the sign-in and registration paths. Only one trace is current at a time, which fits
+ * those flows since only one of them can be on screen. Every span started while a trace is current nests under the
+ * innermost span still open, except async spans, which overlap freely and never become anyone's parent. Requests
+ * JRConnectionManager makes to Janrain hosts carry the trace's correlation id in the JRTracerCorrelationIdHeader
+ * header so server logs can be joined to the trace.
+ *
+ * Ended spans are kept in a ring buffer, and handed to the exporter if there is one. Only to be used from the main
+ * thread.
+ */
+@interface JRTracer : NSObject
+@property(nonatomic) id <JRTraceExporter> exporter;
+
++ (JRTracer *)sharedTracer;
+
+- (id)initWithRingBufferCapacity:(NSUInteger)capacity;
+
+/**
+ * Starts a new trace with a fresh correlation id and returns its root span. A trace that was still current is ended
+ * with the status "abandoned".
+ */
+- (JRTraceSpan *)startTraceWithName:(NSString *)name;
+
+/**
+ * Ends the root span of the current trace, and with it every span still open, recording status as the root's
+ * "status" attribute
+ */
+- (void)endTraceWithStatus:(NSString *)status;
+
+/**
+ * Returns nil, and records nothing, when no trace is current
+ */
+- (JRTraceSpan *)startSpanWithName:(NSString *)name;
+
+/**
+ * For work that runs concurrently with other spans, like a request. The span's parent is the innermost span open
+ * when it starts, and ending it ends nothing else; it's ended along with that parent if it's still open then.
+ * Returns nil, and records nothing, when no trace is current.
+ */
+- (JRTraceSpan *)startAsyncSpanWithName:(NSString *)name;
+
+/**
+ * Ends the innermost open span with that name, for stages that end in a different component than they started
+ */
+- (void)endSpanWithName:(NSString *)name;
+
+- (NSString *)currentCorrelationId;
+
+/**
+ * Requests to these hosts, or their subdomains, get the correlation id header; others, like the application's own
+ * token URL, don't. Starts out with the Janrain domains.
+ */
+- (void)addCorrelatedHost:(NSString *)host;
+
+- (BOOL)shouldCorrelateRequestToUrl:(NSURL *)url;
+
+/**
+ * Ended spans, oldest first
+ */
+- (NSArray *)recentSpans;
+
+- (void)removeAllSpans;
+@end
+
+extern NSString *const JRTracerCorrelationIdHeader;
@@ -0,0 +1,301 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "debug_log.h"
+#import "JRTracer.h"
+
+NSString *const JRTracerCorrelationIdHeader = @"X-Correlation-ID";
+
+static NSString *newIdentifier(NSUInteger length)
+{
+    return [[[[NSUUID UUID] UUIDString] stringByReplacingOccurrencesOfString:@"-" withString:@""]
+            substringToIndex:length];
+}
+
+@interface JRTracer ()
+@property(nonatomic) NSMutableArray *ringBuffer;
+@property(nonatomic) NSUInteger ringBufferCapacity;
+@property(nonatomic) NSUInteger ringBufferNext;
+@property(nonatomic) NSMutableArray *openSpans;
+@property(nonatomic) NSMutableArray *asyncSpans;
+@property(nonatomic) JRTraceSpan *rootSpan;
+@property(nonatomic) NSMutableSet *correlatedHosts;
+
+- (void)spanDidEnd:(JRTraceSpan *)span;
+@end
+
+@interface JRTraceSpan ()
+@property(nonatomic, weak) JRTracer *tracer;
+@property(nonatomic) NSMutableDictionary *mutableAttributes;
+@property(nonatomic) CFAbsoluteTime startTime;
+@property(nonatomic) CFAbsoluteTime endTime;
+@end
+
+@implementation JRTraceSpan
+@synthesize name;
+@synthesize correlationId;
+@synthesize spanId;
+@synthesize parentSpanId;
+@synthesize startDate;
+@synthesize ended;
+@synthesize tracer;
+@synthesize mutableAttributes;
+@synthesize startTime;
+@synthesize endTime;
+
+- (id)initWithName:(NSString *)name_ correlationId:(NSString *)correlationId_ parentSpanId:(NSString *)parentSpanId_
+            tracer:(JRTracer *)tracer_
+{
+    if ((self = [super init]))
+    {
+        name = [name_ copy];
+        correlationId = [correlationId_ copy];
+        parentSpanId = [parentSpanId_ copy];
+        spanId = newIdentifier(16);
+        tracer = tracer_;
+        mutableAttributes = [NSMutableDictionary dictionary];
+        startDate = [NSDate date];
+        startTime = CFAbsoluteTimeGetCurrent();
+    }
+
+    return self;
+}
+
+- (NSDictionary *)attributes
+{
+    return [self.mutableAttributes copy];
+}
+
+- (void)setAttribute:(id)value forKey:(NSString *)key
+{
+    if (value) [self.mutableAttributes setObject:value forKey:key];
+}
+
+- (NSTimeInterval)duration
+{
+    return (ended ? self.endTime : CFAbsoluteTimeGetCurrent()) - self.startTime;
+}
+
+- (void)end
+{
+    if (ended) return;
+
+    self.endTime = CFAbsoluteTimeGetCurrent();
+    ended = YES;
+    [self.tracer spanDidEnd:self];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %@ %@/%@ %.3fs %@>", self.name, self.correlationId, self.parentSpanId,
+                                      self.spanId, self.duration, self.mutableAttributes];
+}
+@end
+
+@implementation JRTracer
+@synthesize exporter;
+@synthesize ringBuffer;
+@synthesize ringBufferCapacity;
+@synthesize ringBufferNext;
+@synthesize openSpans;
+@synthesize asyncSpans;
+@synthesize rootSpan;
+@synthesize correlatedHosts;
+
++ (JRTracer *)sharedTracer
+{
+    static JRTracer *sharedTracer = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedTracer = [[JRTracer alloc] initWithRingBufferCapacity:256];
+    });
+
+    return sharedTracer;
+}
+
+- (id)initWithRingBufferCapacity:(NSUInteger)capacity
+{
+    if ((self = [super init]))
+    {
+        ringBufferCapacity = MAX(capacity, 1);
+        ringBuffer = [NSMutableArray arrayWithCapacity:ringBufferCapacity];
+        openSpans = [NSMutableArray array];
+        asyncSpans = [NSMutableArray array];
+        correlatedHosts = [NSMutableSet setWithObjects:@"janrain.com", @"janraincapture.com", @"rpxnow.com", nil];
+    }
+
+    return self;
+}
+
+- (id)init
+{
+    return [self initWithRingBufferCapacity:256];
+}
+
+- (JRTraceSpan *)startTraceWithName:(NSString *)name
+{
+    if (self.rootSpan)
+        [self endTraceWithStatus:@"abandoned"];
+
+    self.rootSpan = [[JRTraceSpan alloc] initWithName:name correlationId:newIdentifier(32) parentSpanId:nil
+                                               tracer:self];
+    [self.openSpans addObject:self.rootSpan];
+
+    return self.rootSpan;
+}
+
+- (void)endTraceWithStatus:(NSString *)status
+{
+    [self.rootSpan setAttribute:status forKey:@"status"];
+    [self.rootSpan end];
+}
+
+- (JRTraceSpan *)startSpanWithName:(NSString *)name
+{
+    if (!self.rootSpan)
+        return nil;
+
+    JRTraceSpan *parent = [self.openSpans lastObject];
+    JRTraceSpan *span = [[JRTraceSpan alloc] initWithName:name correlationId:self.rootSpan.correlationId
+                                             parentSpanId:parent.spanId tracer:self];
+    [self.openSpans addObject:span];
+
+    return span;
+}
+
+- (JRTraceSpan *)startAsyncSpanWithName:(NSString *)name
+{
+    if (!self.rootSpan)
+        return nil;
+
+    /* Kept off the stack, so that overlapping async spans don't nest under or end one another */
+    JRTraceSpan *parent = [self.openSpans lastObject];
+    JRTraceSpan *span = [[JRTraceSpan alloc] initWithName:name correlationId:self.rootSpan.correlationId
+                                             parentSpanId:parent.spanId tracer:self];
+    [self.asyncSpans addObject:span];
+
+    return span;
+}
+
+- (void)endSpanWithName:(NSString *)name
+{
+    for (JRTraceSpan *span in [self.openSpans reverseObjectEnumerator])
+        if ([span.name isEqualToString:name])
+            return [span end];
+}
+
+- (NSString *)currentCorrelationId
+{
+    return self.rootSpan.correlationId;
+}
+
+- (void)addCorrelatedHost:(NSString *)host
+{
+    if ([host length]) [self.correlatedHosts addObject:[host lowercaseString]];
+}
+
+- (BOOL)shouldCorrelateRequestToUrl:(NSURL *)url
+{
+    NSString *host = [[url host] lowercaseString];
+    if (!host) return NO;
+
+    for (NSString *correlatedHost in self.correlatedHosts)
+        if ([host isEqualToString:correlatedHost] ||
+                [host hasSuffix:[@"." stringByAppendingString:correlatedHost]])
+            return YES;
+
+    return NO;
+}
+
+- (void)spanDidEnd:(JRTraceSpan *)span
+{
+    NSUInteger asyncIndex = [self.asyncSpans indexOfObjectIdenticalTo:span];
+    if (asyncIndex != NSNotFound)
+    {
+        [self.asyncSpans removeObjectAtIndex:asyncIndex];
+        [self recordSpan:span];
+        return;
+    }
+
+    NSUInteger index = [self.openSpans indexOfObjectIdenticalTo:span];
+    if (index == NSNotFound)
+    {
+        /* A span from a trace that's already over, it still gets recorded */
+        [self recordSpan:span];
+        return;
+    }
+
+    /* Anything opened inside the span can't outlive it */
+    while ([self.openSpans count] > index + 1)
+        [[self.openSpans lastObject] end];
+
+    for (JRTraceSpan *asyncSpan in [self.asyncSpans copy])
+        if ([asyncSpan.parentSpanId isEqualToString:span.spanId])
+            [asyncSpan end];
+
+    [self.openSpans removeObjectAtIndex:index];
+    if (span == self.rootSpan)
+        self.rootSpan = nil;
+
+    [self recordSpan:span];
+}
+
+- (void)recordSpan:(JRTraceSpan *)span
+{
+    DLog(@"%@", span);
+
+    if ([self.ringBuffer count] < self.ringBufferCapacity)
+        [self.ringBuffer addObject:span];
+    else
+        [self.ringBuffer replaceObjectAtIndex:self.ringBufferNext withObject:span];
+    self.ringBufferNext = (self.ringBufferNext + 1) % self.ringBufferCapacity;
+
+    [self.exporter exportSpan:span];
+}
+
+- (NSArray *)recentSpans
+{
+    if ([self.ringBuffer count] < self.ringBufferCapacity)
+        return [self.ringBuffer copy];
+
+    NSRange newest = NSMakeRange(0, self.ringBufferNext);
+    NSRange oldest = NSMakeRange(self.ringBufferNext, self.ringBufferCapacity - self.ringBufferNext);
+
+    return [[self.ringBuffer subarrayWithRange:oldest] arrayByAddingObjectsFromArray:
+            [self.ringBuffer subarrayWithRange:newest]];
+}
+
+- (void)removeAllSpans
+{
+    [self.ringBuffer removeAllObjects];
+    self.ringBufferNext = 0;
+}
+@end
@@ -45,6 +45,7 @@
 #import "JRWebViewController.h"
 #import "JRPublishActivityController.h"
 #import "JRCompatibilityUtils.h"
+#import "JRTracer.h"
 
 static void handleCustomInterfaceException(NSException* exception, NSString* kJRKeyString)
 {
@@ -957,6 +958,7 @@ static JRUserInterfaceMaestro *singleton = nil;
 - (void)showAuthenticationDialogWithCustomInterface:(NSDictionary *)customizations
 {
     DLog(@"");
+    [[JRTracer sharedTracer] startSpanWithName:@"engage.authentication_dialog"];
     [self buildCustomInterface:customizations];
     [self setUpDialogPresentation];
     [self setUpViewControllers];
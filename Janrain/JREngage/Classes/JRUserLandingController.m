@@ -40,6 +40,7 @@
 #import "debug_log.h"
 #import "JRCompatibilityUtils.h"
 #import "UIAlertController+JRAlertController.h"
+#import "JRProviderIcons.h"
 
 #define frame_w(a) a.frame.size.width
 #define frame_h(a) a.frame.size.height
@@ -493,9 +494,20 @@ enum
     cell.backgroundColor = [UIColor whiteColor];
     cell.selectionStyle = UITableViewCellSelectionStyleNone;
 
-    NSString *imagePath = [NSString stringWithFormat:@"icon_%@_30x30.png",
-                    sessionData.currentProvider.name];
-    [self getLogo:cell].image = [UIImage imageNamed:imagePath];
+    NSString *providerName = sessionData.currentProvider.name;
+    UIImageView *logo = [self getLogo:cell];
+    logo.image = [[JRProviderIcons sharedIcons] cachedIconForProvider:providerName style:JRProviderIconStyleColor
+                                                                 size:CGSizeMake(30, 30)];
+    if (!logo.image)
+    {
+        __weak UIImageView *weakLogo = logo;
+        [[JRProviderIcons sharedIcons] iconForProvider:providerName style:JRProviderIconStyleColor
+                                                  size:CGSizeMake(30, 30) completion:^(UIImage *icon)
+        {
+            if ([self->sessionData.currentProvider.name isEqualToString:providerName])
+                weakLogo.image = icon;
+        }];
+    }
 
     /* If the provider requires input, we need to enable the textField, and set the text/placeholder text to the
     appropriate string */
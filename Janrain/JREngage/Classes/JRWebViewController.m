@@ -42,6 +42,7 @@
 #import "UIAlertController+JRAlertController.h"
 #import "JRCaptureData.h"
 #import "JREngage.h"
+#import "JRTracer.h"
 
 @interface JRWebViewController ()
 - (void)loadUrlInWebView:(NSURL *)url;
@@ -362,6 +363,7 @@
 {
     DLog(@"");
     [self stopProgress];
+    [[JRTracer sharedTracer] endSpanWithName:@"engage.provider_web_flow"];
 
     if ([tag isEqualToString:MEU_CONNECTION_TAG])
     {
@@ -472,6 +474,7 @@
     DLog(@"tag: %@", tag);
 
     [self stopProgress];
+    [[JRTracer sharedTracer] endSpanWithName:@"engage.provider_web_flow"];
 
     if ([tag isEqualToString:MEU_CONNECTION_TAG])
     {
@@ -633,6 +636,7 @@
 - (void)loadUrlInWebView:(NSURL *)url
 {
     DLog(@"");
+    [[JRTracer sharedTracer] startSpanWithName:@"engage.provider_web_flow"];
     NSURLRequest *request = [NSURLRequest requestWithURL:url];
     //UIWebview/WKWebView
     [myWebView loadRequest:request];
@@ -0,0 +1,252 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "NSString+JRStringReplacement.h"
+
+/* Aho-Corasick automaton over UTF-16 code units. Children are kept as sibling lists, which is plenty for the handful
+   of URLs in an activity. Node 0 is the root. */
+typedef struct
+{
+    unichar character;
+    int32_t firstChild;
+    int32_t nextSibling;
+    int32_t fail;
+    int32_t outputLink;   /* nearest proper suffix node that ends a pattern, or -1 */
+    int32_t patternIndex; /* pattern ending here, or -1 */
+    NSUInteger depth;
+} JRMatcherNode;
+
+typedef struct
+{
+    JRMatcherNode *nodes;
+    NSUInteger count;
+    NSUInteger capacity;
+} JRMatcher;
+
+static int32_t JRMatcherChild(const JRMatcher *matcher, int32_t node, unichar character)
+{
+    for (int32_t child = matcher->nodes[node].firstChild; child >= 0; child = matcher->nodes[child].nextSibling)
+        if (matcher->nodes[child].character == character)
+            return child;
+
+    return -1;
+}
+
+static int32_t JRMatcherAddNode(JRMatcher *matcher, int32_t parent, unichar character)
+{
+    if (matcher->count == matcher->capacity)
+    {
+        matcher->capacity = matcher->capacity ? matcher->capacity * 2 : 64;
+        matcher->nodes = realloc(matcher->nodes, matcher->capacity * sizeof(JRMatcherNode));
+    }
+
+    int32_t node = (int32_t) matcher->count++;
+    JRMatcherNode *newNode = &matcher->nodes[node];
+    newNode->character = character;
+    newNode->firstChild = -1;
+    newNode->nextSibling = -1;
+    newNode->fail = 0;
+    newNode->outputLink = -1;
+    newNode->patternIndex = -1;
+    newNode->depth = 0;
+
+    if (parent >= 0)
+    {
+        newNode->depth = matcher->nodes[parent].depth + 1;
+        newNode->nextSibling = matcher->nodes[parent].firstChild;
+        matcher->nodes[parent].firstChild = node;
+    }
+
+    return node;
+}
+
+static void JRMatcherAddPattern(JRMatcher *matcher, const unichar *pattern, NSUInteger length, int32_t patternIndex)
+{
+    int32_t node = 0;
+    for (NSUInteger i = 0; i < length; i++)
+    {
+        int32_t child = JRMatcherChild(matcher, node, pattern[i]);
+        node = child >= 0 ? child : JRMatcherAddNode(matcher, node, pattern[i]);
+    }
+
+    /* The first of two identical patterns wins */
+    if (matcher->nodes[node].patternIndex < 0)
+        matcher->nodes[node].patternIndex = patternIndex;
+}
+
+/* Breadth first, so a node's fail link is always settled before its children's */
+static void JRMatcherLink(JRMatcher *matcher)
+{
+    int32_t *queue = malloc(matcher->count * sizeof(int32_t));
+    NSUInteger head = 0, tail = 0;
+
+    for (int32_t child = matcher->nodes[0].firstChild; child >= 0; child = matcher->nodes[child].nextSibling)
+        queue[tail++] = child;
+
+    while (head < tail)
+    {
+        int32_t node = queue[head++];
+        for (int32_t child = matcher->nodes[node].firstChild; child >= 0; child = matcher->nodes[child].nextSibling)
+        {
+            unichar character = matcher->nodes[child].character;
+            int32_t fail = matcher->nodes[node].fail;
+            int32_t target = JRMatcherChild(matcher, fail, character);
+            while (target < 0 && fail != 0)
+            {
+                fail = matcher->nodes[fail].fail;
+                target = JRMatcherChild(matcher, fail, character);
+            }
+
+            matcher->nodes[child].fail = target >= 0 ? target : 0;
+
+            int32_t failNode = matcher->nodes[child].fail;
+            matcher->nodes[child].outputLink = matcher->nodes[failNode].patternIndex >= 0 ?
+                    failNode : matcher->nodes[failNode].outputLink;
+
+            queue[tail++] = child;
+        }
+    }
+
+    free(queue);
+}
+
+/* Fills longestMatch[start] with the index + 1 of the longest pattern found starting at start (0 for none).
+   Returns whether anything matched. */
+static int JRMatcherScan(const JRMatcher *matcher, const unichar *text, NSUInteger length, int32_t *longestMatch,
+                         const NSUInteger *patternLengths)
+{
+    int matched = 0;
+    int32_t state = 0;
+
+    for (NSUInteger i = 0; i < length; i++)
+    {
+        int32_t next = JRMatcherChild(matcher, state, text[i]);
+        while (next < 0 && state != 0)
+        {
+            state = matcher->nodes[state].fail;
+            next = JRMatcherChild(matcher, state, text[i]);
+        }
+
+        state = next >= 0 ? next : 0;
+
+        int32_t output = matcher->nodes[state].patternIndex >= 0 ? state : matcher->nodes[state].outputLink;
+        for (; output >= 0; output = matcher->nodes[output].outputLink)
+        {
+            NSUInteger depth = matcher->nodes[output].depth;
+            NSUInteger start = i + 1 - depth;
+            int32_t current = longestMatch[start];
+            if (!current || patternLengths[current - 1] < depth)
+                longestMatch[start] = matcher->nodes[output].patternIndex + 1;
+
+            matched = 1;
+        }
+    }
+
+    return matched;
+}
+
+@implementation NSString (JRStringReplacement)
+- (NSString *)JR_stringByReplacingOccurrencesOfStrings:(NSDictionary *)replacements
+{
+    NSUInteger length = [self length];
+    if (!length || ![replacements count]) return [self copy];
+
+    NSMutableArray *patterns = [NSMutableArray arrayWithCapacity:[replacements count]];
+    for (id pattern in replacements)
+    {
+        if ([pattern isKindOfClass:[NSString class]] && [pattern length] &&
+                [[replacements objectForKey:pattern] isKindOfClass:[NSString class]])
+            [patterns addObject:pattern];
+    }
+
+    if (![patterns count]) return [self copy];
+
+    JRMatcher matcher = { NULL, 0, 0 };
+    JRMatcherAddNode(&matcher, -1, 0);
+
+    NSUInteger *patternLengths = malloc([patterns count] * sizeof(NSUInteger));
+    for (NSUInteger i = 0; i < [patterns count]; i++)
+    {
+        NSString *pattern = [patterns objectAtIndex:i];
+        patternLengths[i] = [pattern length];
+
+        unichar *characters = malloc(patternLengths[i] * sizeof(unichar));
+        [pattern getCharacters:characters range:NSMakeRange(0, patternLengths[i])];
+        JRMatcherAddPattern(&matcher, characters, patternLengths[i], (int32_t) i);
+        free(characters);
+    }
+
+    JRMatcherLink(&matcher);
+
+    unichar *text = malloc(length * sizeof(unichar));
+    [self getCharacters:text range:NSMakeRange(0, length)];
+
+    int32_t *longestMatch = calloc(length, sizeof(int32_t));
+    NSString *result;
+
+    if (!JRMatcherScan(&matcher, text, length, longestMatch, patternLengths))
+    {
+        result = [self copy];
+    }
+    else
+    {
+        NSMutableString *replaced = [NSMutableString stringWithCapacity:length];
+        NSUInteger copiedUpTo = 0;
+        for (NSUInteger i = 0; i < length;)
+        {
+            if (!longestMatch[i])
+            {
+                i++;
+                continue;
+            }
+
+            NSUInteger patternIndex = (NSUInteger) longestMatch[i] - 1;
+            CFStringAppendCharacters((__bridge CFMutableStringRef) replaced, text + copiedUpTo,
+                                     (CFIndex) (i - copiedUpTo));
+            [replaced appendString:[replacements objectForKey:[patterns objectAtIndex:patternIndex]]];
+
+            i += patternLengths[patternIndex];
+            copiedUpTo = i;
+        }
+
+        CFStringAppendCharacters((__bridge CFMutableStringRef) replaced, text + copiedUpTo,
+                                 (CFIndex) (length - copiedUpTo));
+        result = replaced;
+    }
+
+    free(longestMatch);
+    free(text);
+    free(patternLengths);
+    free(matcher.nodes);
+
+    return result;
+}
+@end
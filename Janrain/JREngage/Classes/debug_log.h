@@ -30,26 +30,87 @@
 
 #import <Foundation/Foundation.h>
 
-#ifndef DLog
+/* The preprocessor can't see enum values, so the levels are plain numbers here and JRLogLevel names them */
+#define JR_LOG_LEVEL_OFF     0
+#define JR_LOG_LEVEL_ERROR   1
+#define JR_LOG_LEVEL_WARNING 2
+#define JR_LOG_LEVEL_INFO    3
+#define JR_LOG_LEVEL_DEBUG   4
+
+typedef NS_ENUM(NSInteger, JRLogLevel)
+{
+    JRLogLevelOff = JR_LOG_LEVEL_OFF,
+    JRLogLevelError = JR_LOG_LEVEL_ERROR,
+    JRLogLevelWarning = JR_LOG_LEVEL_WARNING,
+    JRLogLevelInfo = JR_LOG_LEVEL_INFO,
+    JRLogLevelDebug = JR_LOG_LEVEL_DEBUG,
+};
+
+/* The most verbose level compiled in. Debug builds keep everything; release builds keep info and up (what ALog
+   always logged), or nothing at all with JR_NO_RELEASE_LOGGING. */
+#ifndef JR_LOG_LEVEL
   #ifdef DEBUG
-    #define DLog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+    #define JR_LOG_LEVEL JR_LOG_LEVEL_DEBUG
+  #elif defined(JR_NO_RELEASE_LOGGING)
+    #define JR_LOG_LEVEL JR_LOG_LEVEL_OFF
   #else
-    #define DLog(fmt, ...) JRLogExpressionSink((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
+    #define JR_LOG_LEVEL JR_LOG_LEVEL_INFO
   #endif
 #endif
 
+/* Statements above JR_LOG_LEVEL are dead code: their arguments are still type checked, so variables only used for
+   logging don't warn, but never evaluated. The rest evaluate their arguments only once the runtime level, see
+   JRLogSetLevel, has let them through. */
+#define JR_LOG(level, fmt, ...) \
+    do { \
+        if ((level) <= JR_LOG_LEVEL && JRLogIsEnabled((JRLogLevel) (level))) \
+            JRLogWrite((JRLogLevel) (level), __PRETTY_FUNCTION__, __LINE__, fmt, ##__VA_ARGS__); \
+    } while (0)
+
+#define JRLogError(fmt, ...)   JR_LOG(JR_LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define JRLogWarning(fmt, ...) JR_LOG(JR_LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)
+#define JRLogInfo(fmt, ...)    JR_LOG(JR_LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define JRLogDebug(fmt, ...)   JR_LOG(JR_LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+
+#ifndef DLog
+  #define DLog(fmt, ...) JRLogDebug(fmt, ##__VA_ARGS__)
+#endif
+
 #ifndef ALog
-  #ifdef DEBUG
-    #define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
-  #else
-    #ifdef JR_NO_RELEASE_LOGGING
-      #define ALog(fmt, ...) JRLogExpressionSink((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
-    #else
-      #define ALog(fmt, ...) NSLog((@"%s [Line %d] " fmt), __PRETTY_FUNCTION__, __LINE__, ##__VA_ARGS__)
-    #endif
-  #endif
+  #define ALog(fmt, ...) JRLogInfo(fmt, ##__VA_ARGS__)
 #endif
 
+extern volatile JRLogLevel JRLogRuntimeLevel;
+
+static inline BOOL JRLogIsEnabled(JRLogLevel level)
+{
+    return level <= JRLogRuntimeLevel;
+}
+
+/* Defaults to JR_LOG_LEVEL. Statements compiled out stay out, whatever it's set to. */
+void JRLogSetLevel(JRLogLevel level);
+
+/* Formats the message and hands it to a fixed size ring buffer that a background queue drains into the sink, so the
+   caller never waits on the console. Formats without objects are formatted on the stack, without allocating. Messages
+   longer than JRLogMaxMessageLength UTF-8 bytes are truncated, and if the ring is full the message is dropped and
+   counted rather than blocking. Call through the macros above. */
+void JRLogWrite(JRLogLevel level, const char *function, int line, NSString *format, ...) NS_FORMAT_FUNCTION(4, 5);
+
+/* Where drained messages go, on a private serial queue. nil, the default, sends them to NSLog. */
+void JRLogSetSink(void (^sink)(JRLogLevel level, NSString *message));
+
+/* Blocks until everything written so far has reached the sink */
+void JRLogFlush(void);
+
+/* For logging request and response bodies (NSData, NSString, or anything with a description): the values of
+   tokens, secrets, signatures and passwords are replaced with <redacted>, and the result cut down to
+   JRLogMaxPayloadLength characters. Costs nothing when it's an argument to a statement that isn't logged. */
+NSString *JRLogRedactedPayload(id payload);
+
+#define JRLogMaxMessageLength 472
+#define JRLogMaxPayloadLength 384
+
+/* Kept for source compatibility with code that called it directly; it no longer does anything */
 void JRLogExpressionSink(NSString *format, ...);
 
 @interface NSException (JR_raiseDebugException)
@@ -30,16 +30,255 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #include "debug_log.h"
+#include <stdatomic.h>
+#include <dispatch/dispatch.h>
 
-// UPS-2039
-void JRLogExpressionSink(NSString *format, ...)
+#define JRLogRingCapacity 256
+
+/* A slot is free for the writer that reserved index i once its sequence is i, and readable once it's i + 1. The
+   message is kept apart from the function and line, which the drain puts in front of it; on 64-bit a slot comes to
+   512 bytes, so the whole ring is 128 KiB. */
+typedef struct
+{
+    _Atomic(uint64_t) sequence;
+    JRLogLevel level;
+    const char *function;
+    int line;
+    BOOL truncated;
+    NSUInteger length;
+    char bytes[JRLogMaxMessageLength];
+} JRLogSlot;
+
+volatile JRLogLevel JRLogRuntimeLevel = (JRLogLevel) JR_LOG_LEVEL;
+
+static JRLogSlot ring[JRLogRingCapacity];
+static _Atomic(uint64_t) writeIndex = 0;
+static _Atomic(uint64_t) readIndex = 0;
+static _Atomic(uint64_t) droppedCount = 0;
+
+static dispatch_queue_t drainQueue;
+static dispatch_source_t drainSource;
+static void (^logSink)(JRLogLevel, NSString *) = nil;
+
+static NSString *JRLogLevelName(JRLogLevel level)
+{
+    switch (level)
+    {
+        case JRLogLevelError:   return @"E";
+        case JRLogLevelWarning: return @"W";
+        case JRLogLevelInfo:    return @"I";
+        case JRLogLevelDebug:   return @"D";
+        default:                return @"-";
+    }
+}
+
+static void JRLogEmit(JRLogLevel level, NSString *message)
+{
+    if (logSink)
+        logSink(level, message);
+    else
+        NSLog(@"[%@] %@", JRLogLevelName(level), message);
+}
+
+/* Runs on drainQueue only */
+static void JRLogDrain(void)
+{
+    uint64_t dropped = atomic_exchange_explicit(&droppedCount, 0, memory_order_relaxed);
+    if (dropped)
+        JRLogEmit(JRLogLevelWarning, [NSString stringWithFormat:@"log ring full, dropped %llu messages",
+                                                                (unsigned long long) dropped]);
+
+    for (;;)
+    {
+        uint64_t index = atomic_load_explicit(&readIndex, memory_order_relaxed);
+        JRLogSlot *slot = &ring[index % JRLogRingCapacity];
+        if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != index + 1) break;
+
+        NSString *body = [[NSString alloc] initWithBytes:slot->bytes length:slot->length
+                                                encoding:NSUTF8StringEncoding];
+        NSString *message = body ? [NSString stringWithFormat:@"%s [Line %d] %@%@", slot->function, slot->line, body,
+                                                              slot->truncated ? @"..." : @""] : nil;
+        JRLogLevel level = slot->level;
+
+        /* Hand the slot back to writers a lap ahead before calling out to the sink */
+        atomic_store_explicit(&slot->sequence, index + JRLogRingCapacity, memory_order_release);
+        atomic_store_explicit(&readIndex, index + 1, memory_order_release);
+
+        if (message) JRLogEmit(level, message);
+    }
+}
+
+static void JRLogSetUp(void)
 {
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        for (uint64_t i = 0; i < JRLogRingCapacity; i++)
+            atomic_init(&ring[i].sequence, i);
+
+        drainQueue = dispatch_queue_create("com.janrain.log", DISPATCH_QUEUE_SERIAL);
+        dispatch_set_target_queue(drainQueue, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0));
+
+        /* Data-add sources coalesce, so a burst of writes costs one wake-up of the drain queue */
+        drainSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_DATA_ADD, 0, 0, drainQueue);
+        dispatch_source_set_event_handler(drainSource, ^{
+            JRLogDrain();
+        });
+        dispatch_resume(drainSource);
+    });
+}
+
+void JRLogSetLevel(JRLogLevel level)
+{
+    JRLogRuntimeLevel = level;
+}
+
+/* Whether printf formats the string the same as NSString would, i.e. it has no %@, nor %C or %S, which printf takes
+   to be wide characters rather than unichars */
+static BOOL JRLogIsPrintfFormat(const char *format)
+{
+    for (const char *c = format; (c = strchr(c, '%')); )
+    {
+        c++;
+        c += strspn(c, "0123456789.-+ #'*$hlqjztL");
+        if (*c == '@' || *c == 'C' || *c == 'S') return NO;
+        if (*c) c++;
+    }
+
+    return YES;
+}
+
+void JRLogWrite(JRLogLevel level, const char *function, int line, NSString *format, ...)
+{
+    JRLogSetUp();
+
+    /* One byte over, so that a cut can be seen, and backed up to the start of the character it splits */
+    char buffer[JRLogMaxMessageLength + 2];
+    NSUInteger length;
+    BOOL truncated;
+
     va_list va;
     va_start(va, format);
-    NSString *string = [[NSString alloc] initWithFormat:format arguments:va];
+    const char *cFormat = [format UTF8String];
+    if (cFormat && JRLogIsPrintfFormat(cFormat))
+    {
+        int written = vsnprintf(buffer, sizeof(buffer), cFormat, va);
+        length = (NSUInteger) MAX(MIN(written, JRLogMaxMessageLength), 0);
+        truncated = written > JRLogMaxMessageLength;
+        if (truncated)
+            while (length > 0 && ((unsigned char) buffer[length] & 0xC0) == 0x80) length--;
+    }
+    else
+    {
+        /* Objects have to go through NSString */
+        NSString *message = [[NSString alloc] initWithFormat:format arguments:va];
+        NSRange remaining = NSMakeRange(0, 0);
+        [message getBytes:buffer maxLength:JRLogMaxMessageLength usedLength:&length encoding:NSUTF8StringEncoding
+                  options:NSStringEncodingConversionAllowLossy range:NSMakeRange(0, [message length])
+           remainingRange:&remaining];
+        truncated = remaining.length > 0;
+    }
     va_end(va);
-    NSString *description = [string description];
-    #pragma unused (description)
+
+    uint64_t index = atomic_load_explicit(&writeIndex, memory_order_relaxed);
+    for (;;)
+    {
+        if (index - atomic_load_explicit(&readIndex, memory_order_acquire) >= JRLogRingCapacity)
+        {
+            atomic_fetch_add_explicit(&droppedCount, 1, memory_order_relaxed);
+            dispatch_source_merge_data(drainSource, 1);
+            return;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&writeIndex, &index, index + 1, memory_order_relaxed,
+                                                  memory_order_relaxed))
+            break;
+    }
+
+    JRLogSlot *slot = &ring[index % JRLogRingCapacity];
+
+    /* The reader may still be copying this slot's previous message out */
+    while (atomic_load_explicit(&slot->sequence, memory_order_acquire) != index) ;
+
+    memcpy(slot->bytes, buffer, length);
+    slot->length = length;
+    slot->truncated = truncated;
+    slot->function = function;
+    slot->line = line;
+    slot->level = level;
+
+    atomic_store_explicit(&slot->sequence, index + 1, memory_order_release);
+    dispatch_source_merge_data(drainSource, 1);
+}
+
+void JRLogSetSink(void (^sink)(JRLogLevel level, NSString *message))
+{
+    JRLogSetUp();
+
+    dispatch_sync(drainQueue, ^{
+        logSink = [sink copy];
+    });
+}
+
+void JRLogFlush(void)
+{
+    JRLogSetUp();
+
+    dispatch_sync(drainQueue, ^{
+        JRLogDrain();
+    });
+}
+
+static NSRegularExpression *JRLogSecretExpression(void)
+{
+    static NSRegularExpression *expression;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        /* key=value in form bodies and query strings, "key": "value" in JSON */
+        expression = [NSRegularExpression regularExpressionWithPattern:
+                @"(\\b(?:access_token|refresh_token|refresh_secret|client_secret|merge_token|creation_token|device_token|token"
+                 "|signature|code|[A-Za-z_]*[Pp]assword)\"?\\s*[=:]\\s*\"?)([^\"&,}\\s]+)"
+                                                              options:0 error:nil];
+    });
+
+    return expression;
+}
+
+NSString *JRLogRedactedPayload(id payload)
+{
+    if (!payload) return @"(null)";
+
+    NSString *string;
+    if ([payload isKindOfClass:[NSData class]])
+        string = [[NSString alloc] initWithData:payload encoding:NSUTF8StringEncoding];
+    else if ([payload isKindOfClass:[NSString class]])
+        string = payload;
+    else
+        string = [payload description];
+
+    if (!string) return [NSString stringWithFormat:@"(%lu bytes)", (unsigned long) [(NSData *) payload length]];
+
+    NSUInteger fullLength = [string length];
+    /* Redact a little past the cut so a secret straddling it can't leak its first half */
+    if (fullLength > JRLogMaxPayloadLength * 2)
+        string = [string substringToIndex:
+                [string rangeOfComposedCharacterSequenceAtIndex:JRLogMaxPayloadLength * 2].location];
+
+    string = [JRLogSecretExpression() stringByReplacingMatchesInString:string options:0
+                                                                 range:NSMakeRange(0, [string length])
+                                                          withTemplate:@"$1<redacted>"];
+
+    if ([string length] > JRLogMaxPayloadLength)
+    {
+        NSUInteger cut = [string rangeOfComposedCharacterSequenceAtIndex:JRLogMaxPayloadLength].location;
+        string = [NSString stringWithFormat:@"%@... (%lu characters)", [string substringToIndex:cut],
+                                            (unsigned long) fullLength];
+    }
+
+    return string;
+}
+
+void JRLogExpressionSink(NSString *format, ...)
+{
 }
 
 @implementation NSException (JR_raiseDebugException)
@@ -60,6 +60,7 @@
 
 - (void)setDomain:(NSString *)newDomain
 {
+    [self willChangeProperty:@"domain"];
     [self.dirtyPropertySet addObject:@"domain"];
 
     _domain = [newDomain copy];
@@ -72,6 +73,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [newPrimary copy];
@@ -84,6 +86,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [NSNumber numberWithBool:boolVal];
@@ -96,6 +99,7 @@
 
 - (void)setUserid:(NSString *)newUserid
 {
+    [self willChangeProperty:@"userid"];
     [self.dirtyPropertySet addObject:@"userid"];
 
     _userid = [newUserid copy];
@@ -108,6 +112,7 @@
 
 - (void)setUsername:(NSString *)newUsername
 {
+    [self willChangeProperty:@"username"];
     [self.dirtyPropertySet addObject:@"username"];
 
     _username = [newUsername copy];
@@ -131,18 +136,45 @@
     return [[JRAccountsElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRAccountsElement *accountsElementCopy = (JRAccountsElement *)[super copyWithZone:zone];
+
+    accountsElementCopy->_domain = _domain;
+    accountsElementCopy->_primary = _primary;
+    accountsElementCopy->_userid = _userid;
+    accountsElementCopy->_username = _username;
+
+    return accountsElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.domain ? self.domain : [NSNull null])
+    [dictionary setObject:(_domain ? _domain : [NSNull null])
                    forKey:@"domain"];
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null])
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null])
                    forKey:@"primary"];
-    [dictionary setObject:(self.userid ? self.userid : [NSNull null])
+    [dictionary setObject:(_userid ? _userid : [NSNull null])
                    forKey:@"userid"];
-    [dictionary setObject:(self.username ? self.username : [NSNull null])
+    [dictionary setObject:(_username ? _username : [NSNull null])
                    forKey:@"username"];
 
     if (forEncoder)
@@ -243,6 +275,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -259,6 +292,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"accountsElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"accountsElement"] allObjects]];
 
@@ -270,16 +305,16 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"domain"])
-        [dictionary setObject:(self.domain ? self.domain : [NSNull null]) forKey:@"domain"];
+        [dictionary setObject:(_domain ? _domain : [NSNull null]) forKey:@"domain"];
 
     if ([self.dirtyPropertySet containsObject:@"primary"])
-        [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
+        [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
     if ([self.dirtyPropertySet containsObject:@"userid"])
-        [dictionary setObject:(self.userid ? self.userid : [NSNull null]) forKey:@"userid"];
+        [dictionary setObject:(_userid ? _userid : [NSNull null]) forKey:@"userid"];
 
     if ([self.dirtyPropertySet containsObject:@"username"])
-        [dictionary setObject:(self.username ? self.username : [NSNull null]) forKey:@"username"];
+        [dictionary setObject:(_username ? _username : [NSNull null]) forKey:@"username"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -295,10 +330,10 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.domain ? self.domain : [NSNull null]) forKey:@"domain"];
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
-    [dictionary setObject:(self.userid ? self.userid : [NSNull null]) forKey:@"userid"];
-    [dictionary setObject:(self.username ? self.username : [NSNull null]) forKey:@"username"];
+    [dictionary setObject:(_domain ? _domain : [NSNull null]) forKey:@"domain"];
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
+    [dictionary setObject:(_userid ? _userid : [NSNull null]) forKey:@"userid"];
+    [dictionary setObject:(_username ? _username : [NSNull null]) forKey:@"username"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -314,25 +349,48 @@
 
 - (BOOL)isEqualToAccountsElement:(JRAccountsElement *)otherAccountsElement
 {
-    if (!self.domain && !otherAccountsElement.domain) /* Keep going... */;
-    else if ((self.domain == nil) ^ (otherAccountsElement.domain == nil)) return NO; // xor
-    else if (![self.domain isEqualToString:otherAccountsElement.domain]) return NO;
+    if (!otherAccountsElement) return NO;
+    if ([self hash] != [otherAccountsElement hash]) return NO;
+
+    if (!_domain && !otherAccountsElement->_domain) /* Keep going... */;
+    else if ((_domain == nil) ^ (otherAccountsElement->_domain == nil)) return NO; // xor
+    else if (![_domain isEqualToString:otherAccountsElement->_domain]) return NO;
 
-    if (!self.primary && !otherAccountsElement.primary) /* Keep going... */;
-    else if ((self.primary == nil) ^ (otherAccountsElement.primary == nil)) return NO; // xor
-    else if (![self.primary isEqualToNumber:otherAccountsElement.primary]) return NO;
+    if (!_primary && !otherAccountsElement->_primary) /* Keep going... */;
+    else if ((_primary == nil) ^ (otherAccountsElement->_primary == nil)) return NO; // xor
+    else if (![_primary isEqualToNumber:otherAccountsElement->_primary]) return NO;
 
-    if (!self.userid && !otherAccountsElement.userid) /* Keep going... */;
-    else if ((self.userid == nil) ^ (otherAccountsElement.userid == nil)) return NO; // xor
-    else if (![self.userid isEqualToString:otherAccountsElement.userid]) return NO;
+    if (!_userid && !otherAccountsElement->_userid) /* Keep going... */;
+    else if ((_userid == nil) ^ (otherAccountsElement->_userid == nil)) return NO; // xor
+    else if (![_userid isEqualToString:otherAccountsElement->_userid]) return NO;
 
-    if (!self.username && !otherAccountsElement.username) /* Keep going... */;
-    else if ((self.username == nil) ^ (otherAccountsElement.username == nil)) return NO; // xor
-    else if (![self.username isEqualToString:otherAccountsElement.username]) return NO;
+    if (!_username && !otherAccountsElement->_username) /* Keep going... */;
+    else if ((_username == nil) ^ (otherAccountsElement->_username == nil)) return NO; // xor
+    else if (![_username isEqualToString:otherAccountsElement->_username]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRAccountsElement class]]) return NO;
+
+    return [self isEqualToAccountsElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_domain hash];
+    hash = hash * 31 + [_primary hash];
+    hash = hash * 31 + [_userid hash];
+    hash = hash * 31 + [_username hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -68,6 +68,7 @@
 
 - (void)setCountry:(NSString *)newCountry
 {
+    [self willChangeProperty:@"country"];
     [self.dirtyPropertySet addObject:@"country"];
 
     _country = [newCountry copy];
@@ -80,6 +81,7 @@
 
 - (void)setExtendedAddress:(NSString *)newExtendedAddress
 {
+    [self willChangeProperty:@"extendedAddress"];
     [self.dirtyPropertySet addObject:@"extendedAddress"];
 
     _extendedAddress = [newExtendedAddress copy];
@@ -92,6 +94,7 @@
 
 - (void)setFormatted:(NSString *)newFormatted
 {
+    [self willChangeProperty:@"formatted"];
     [self.dirtyPropertySet addObject:@"formatted"];
 
     _formatted = [newFormatted copy];
@@ -104,6 +107,7 @@
 
 - (void)setLatitude:(JRDecimal *)newLatitude
 {
+    [self willChangeProperty:@"latitude"];
     [self.dirtyPropertySet addObject:@"latitude"];
 
     _latitude = [newLatitude copy];
@@ -116,6 +120,7 @@
 
 - (void)setLocality:(NSString *)newLocality
 {
+    [self willChangeProperty:@"locality"];
     [self.dirtyPropertySet addObject:@"locality"];
 
     _locality = [newLocality copy];
@@ -128,6 +133,7 @@
 
 - (void)setLongitude:(JRDecimal *)newLongitude
 {
+    [self willChangeProperty:@"longitude"];
     [self.dirtyPropertySet addObject:@"longitude"];
 
     _longitude = [newLongitude copy];
@@ -140,6 +146,7 @@
 
 - (void)setPoBox:(NSString *)newPoBox
 {
+    [self willChangeProperty:@"poBox"];
     [self.dirtyPropertySet addObject:@"poBox"];
 
     _poBox = [newPoBox copy];
@@ -152,6 +159,7 @@
 
 - (void)setPostalCode:(NSString *)newPostalCode
 {
+    [self willChangeProperty:@"postalCode"];
     [self.dirtyPropertySet addObject:@"postalCode"];
 
     _postalCode = [newPostalCode copy];
@@ -164,6 +172,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [newPrimary copy];
@@ -176,6 +185,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [NSNumber numberWithBool:boolVal];
@@ -188,6 +198,7 @@
 
 - (void)setRegion:(NSString *)newRegion
 {
+    [self willChangeProperty:@"region"];
     [self.dirtyPropertySet addObject:@"region"];
 
     _region = [newRegion copy];
@@ -200,6 +211,7 @@
 
 - (void)setStreetAddress:(NSString *)newStreetAddress
 {
+    [self willChangeProperty:@"streetAddress"];
     [self.dirtyPropertySet addObject:@"streetAddress"];
 
     _streetAddress = [newStreetAddress copy];
@@ -212,6 +224,7 @@
 
 - (void)setType:(NSString *)newType
 {
+    [self willChangeProperty:@"type"];
     [self.dirtyPropertySet addObject:@"type"];
 
     _type = [newType copy];
@@ -235,34 +248,69 @@
     return [[JRAddressesElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRAddressesElement *addressesElementCopy = (JRAddressesElement *)[super copyWithZone:zone];
+
+    addressesElementCopy->_country = _country;
+    addressesElementCopy->_extendedAddress = _extendedAddress;
+    addressesElementCopy->_formatted = _formatted;
+    addressesElementCopy->_latitude = _latitude;
+    addressesElementCopy->_locality = _locality;
+    addressesElementCopy->_longitude = _longitude;
+    addressesElementCopy->_poBox = _poBox;
+    addressesElementCopy->_postalCode = _postalCode;
+    addressesElementCopy->_primary = _primary;
+    addressesElementCopy->_region = _region;
+    addressesElementCopy->_streetAddress = _streetAddress;
+    addressesElementCopy->_type = _type;
+
+    return addressesElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.country ? self.country : [NSNull null])
+    [dictionary setObject:(_country ? _country : [NSNull null])
                    forKey:@"country"];
-    [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null])
+    [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null])
                    forKey:@"extendedAddress"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null])
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null])
                    forKey:@"formatted"];
-    [dictionary setObject:(self.latitude ? self.latitude : [NSNull null])
+    [dictionary setObject:(_latitude ? _latitude : [NSNull null])
                    forKey:@"latitude"];
-    [dictionary setObject:(self.locality ? self.locality : [NSNull null])
+    [dictionary setObject:(_locality ? _locality : [NSNull null])
                    forKey:@"locality"];
-    [dictionary setObject:(self.longitude ? self.longitude : [NSNull null])
+    [dictionary setObject:(_longitude ? _longitude : [NSNull null])
                    forKey:@"longitude"];
-    [dictionary setObject:(self.poBox ? self.poBox : [NSNull null])
+    [dictionary setObject:(_poBox ? _poBox : [NSNull null])
                    forKey:@"poBox"];
-    [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null])
+    [dictionary setObject:(_postalCode ? _postalCode : [NSNull null])
                    forKey:@"postalCode"];
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null])
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null])
                    forKey:@"primary"];
-    [dictionary setObject:(self.region ? self.region : [NSNull null])
+    [dictionary setObject:(_region ? _region : [NSNull null])
                    forKey:@"region"];
-    [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null])
+    [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null])
                    forKey:@"streetAddress"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null])
+    [dictionary setObject:(_type ? _type : [NSNull null])
                    forKey:@"type"];
 
     if (forEncoder)
@@ -427,6 +475,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -443,6 +492,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"addressesElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"addressesElement"] allObjects]];
 
@@ -454,40 +505,40 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"country"])
-        [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
+        [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
 
     if ([self.dirtyPropertySet containsObject:@"extendedAddress"])
-        [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
+        [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"formatted"])
-        [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
+        [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
 
     if ([self.dirtyPropertySet containsObject:@"latitude"])
-        [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
+        [dictionary setObject:(_latitude ? _latitude : [NSNull null]) forKey:@"latitude"];
 
     if ([self.dirtyPropertySet containsObject:@"locality"])
-        [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
+        [dictionary setObject:(_locality ? _locality : [NSNull null]) forKey:@"locality"];
 
     if ([self.dirtyPropertySet containsObject:@"longitude"])
-        [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
+        [dictionary setObject:(_longitude ? _longitude : [NSNull null]) forKey:@"longitude"];
 
     if ([self.dirtyPropertySet containsObject:@"poBox"])
-        [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
+        [dictionary setObject:(_poBox ? _poBox : [NSNull null]) forKey:@"poBox"];
 
     if ([self.dirtyPropertySet containsObject:@"postalCode"])
-        [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
+        [dictionary setObject:(_postalCode ? _postalCode : [NSNull null]) forKey:@"postalCode"];
 
     if ([self.dirtyPropertySet containsObject:@"primary"])
-        [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
+        [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
     if ([self.dirtyPropertySet containsObject:@"region"])
-        [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
+        [dictionary setObject:(_region ? _region : [NSNull null]) forKey:@"region"];
 
     if ([self.dirtyPropertySet containsObject:@"streetAddress"])
-        [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
+        [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null]) forKey:@"streetAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"type"])
-        [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+        [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -503,18 +554,18 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
-    [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
-    [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
-    [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
-    [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
-    [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
-    [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
-    [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
-    [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+    [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
+    [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
+    [dictionary setObject:(_latitude ? _latitude : [NSNull null]) forKey:@"latitude"];
+    [dictionary setObject:(_locality ? _locality : [NSNull null]) forKey:@"locality"];
+    [dictionary setObject:(_longitude ? _longitude : [NSNull null]) forKey:@"longitude"];
+    [dictionary setObject:(_poBox ? _poBox : [NSNull null]) forKey:@"poBox"];
+    [dictionary setObject:(_postalCode ? _postalCode : [NSNull null]) forKey:@"postalCode"];
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
+    [dictionary setObject:(_region ? _region : [NSNull null]) forKey:@"region"];
+    [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null]) forKey:@"streetAddress"];
+    [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -530,57 +581,88 @@
 
 - (BOOL)isEqualToAddressesElement:(JRAddressesElement *)otherAddressesElement
 {
-    if (!self.country && !otherAddressesElement.country) /* Keep going... */;
-    else if ((self.country == nil) ^ (otherAddressesElement.country == nil)) return NO; // xor
-    else if (![self.country isEqualToString:otherAddressesElement.country]) return NO;
+    if (!otherAddressesElement) return NO;
+    if ([self hash] != [otherAddressesElement hash]) return NO;
+
+    if (!_country && !otherAddressesElement->_country) /* Keep going... */;
+    else if ((_country == nil) ^ (otherAddressesElement->_country == nil)) return NO; // xor
+    else if (![_country isEqualToString:otherAddressesElement->_country]) return NO;
 
-    if (!self.extendedAddress && !otherAddressesElement.extendedAddress) /* Keep going... */;
-    else if ((self.extendedAddress == nil) ^ (otherAddressesElement.extendedAddress == nil)) return NO; // xor
-    else if (![self.extendedAddress isEqualToString:otherAddressesElement.extendedAddress]) return NO;
+    if (!_extendedAddress && !otherAddressesElement->_extendedAddress) /* Keep going... */;
+    else if ((_extendedAddress == nil) ^ (otherAddressesElement->_extendedAddress == nil)) return NO; // xor
+    else if (![_extendedAddress isEqualToString:otherAddressesElement->_extendedAddress]) return NO;
 
-    if (!self.formatted && !otherAddressesElement.formatted) /* Keep going... */;
-    else if ((self.formatted == nil) ^ (otherAddressesElement.formatted == nil)) return NO; // xor
-    else if (![self.formatted isEqualToString:otherAddressesElement.formatted]) return NO;
+    if (!_formatted && !otherAddressesElement->_formatted) /* Keep going... */;
+    else if ((_formatted == nil) ^ (otherAddressesElement->_formatted == nil)) return NO; // xor
+    else if (![_formatted isEqualToString:otherAddressesElement->_formatted]) return NO;
 
-    if (!self.latitude && !otherAddressesElement.latitude) /* Keep going... */;
-    else if ((self.latitude == nil) ^ (otherAddressesElement.latitude == nil)) return NO; // xor
-    else if (![self.latitude isEqualToNumber:otherAddressesElement.latitude]) return NO;
+    if (!_latitude && !otherAddressesElement->_latitude) /* Keep going... */;
+    else if ((_latitude == nil) ^ (otherAddressesElement->_latitude == nil)) return NO; // xor
+    else if (![_latitude isEqualToNumber:otherAddressesElement->_latitude]) return NO;
 
-    if (!self.locality && !otherAddressesElement.locality) /* Keep going... */;
-    else if ((self.locality == nil) ^ (otherAddressesElement.locality == nil)) return NO; // xor
-    else if (![self.locality isEqualToString:otherAddressesElement.locality]) return NO;
+    if (!_locality && !otherAddressesElement->_locality) /* Keep going... */;
+    else if ((_locality == nil) ^ (otherAddressesElement->_locality == nil)) return NO; // xor
+    else if (![_locality isEqualToString:otherAddressesElement->_locality]) return NO;
 
-    if (!self.longitude && !otherAddressesElement.longitude) /* Keep going... */;
-    else if ((self.longitude == nil) ^ (otherAddressesElement.longitude == nil)) return NO; // xor
-    else if (![self.longitude isEqualToNumber:otherAddressesElement.longitude]) return NO;
+    if (!_longitude && !otherAddressesElement->_longitude) /* Keep going... */;
+    else if ((_longitude == nil) ^ (otherAddressesElement->_longitude == nil)) return NO; // xor
+    else if (![_longitude isEqualToNumber:otherAddressesElement->_longitude]) return NO;
 
-    if (!self.poBox && !otherAddressesElement.poBox) /* Keep going... */;
-    else if ((self.poBox == nil) ^ (otherAddressesElement.poBox == nil)) return NO; // xor
-    else if (![self.poBox isEqualToString:otherAddressesElement.poBox]) return NO;
+    if (!_poBox && !otherAddressesElement->_poBox) /* Keep going... */;
+    else if ((_poBox == nil) ^ (otherAddressesElement->_poBox == nil)) return NO; // xor
+    else if (![_poBox isEqualToString:otherAddressesElement->_poBox]) return NO;
 
-    if (!self.postalCode && !otherAddressesElement.postalCode) /* Keep going... */;
-    else if ((self.postalCode == nil) ^ (otherAddressesElement.postalCode == nil)) return NO; // xor
-    else if (![self.postalCode isEqualToString:otherAddressesElement.postalCode]) return NO;
+    if (!_postalCode && !otherAddressesElement->_postalCode) /* Keep going... */;
+    else if ((_postalCode == nil) ^ (otherAddressesElement->_postalCode == nil)) return NO; // xor
+    else if (![_postalCode isEqualToString:otherAddressesElement->_postalCode]) return NO;
 
-    if (!self.primary && !otherAddressesElement.primary) /* Keep going... */;
-    else if ((self.primary == nil) ^ (otherAddressesElement.primary == nil)) return NO; // xor
-    else if (![self.primary isEqualToNumber:otherAddressesElement.primary]) return NO;
+    if (!_primary && !otherAddressesElement->_primary) /* Keep going... */;
+    else if ((_primary == nil) ^ (otherAddressesElement->_primary == nil)) return NO; // xor
+    else if (![_primary isEqualToNumber:otherAddressesElement->_primary]) return NO;
 
-    if (!self.region && !otherAddressesElement.region) /* Keep going... */;
-    else if ((self.region == nil) ^ (otherAddressesElement.region == nil)) return NO; // xor
-    else if (![self.region isEqualToString:otherAddressesElement.region]) return NO;
+    if (!_region && !otherAddressesElement->_region) /* Keep going... */;
+    else if ((_region == nil) ^ (otherAddressesElement->_region == nil)) return NO; // xor
+    else if (![_region isEqualToString:otherAddressesElement->_region]) return NO;
 
-    if (!self.streetAddress && !otherAddressesElement.streetAddress) /* Keep going... */;
-    else if ((self.streetAddress == nil) ^ (otherAddressesElement.streetAddress == nil)) return NO; // xor
-    else if (![self.streetAddress isEqualToString:otherAddressesElement.streetAddress]) return NO;
+    if (!_streetAddress && !otherAddressesElement->_streetAddress) /* Keep going... */;
+    else if ((_streetAddress == nil) ^ (otherAddressesElement->_streetAddress == nil)) return NO; // xor
+    else if (![_streetAddress isEqualToString:otherAddressesElement->_streetAddress]) return NO;
 
-    if (!self.type && !otherAddressesElement.type) /* Keep going... */;
-    else if ((self.type == nil) ^ (otherAddressesElement.type == nil)) return NO; // xor
-    else if (![self.type isEqualToString:otherAddressesElement.type]) return NO;
+    if (!_type && !otherAddressesElement->_type) /* Keep going... */;
+    else if ((_type == nil) ^ (otherAddressesElement->_type == nil)) return NO; // xor
+    else if (![_type isEqualToString:otherAddressesElement->_type]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRAddressesElement class]]) return NO;
+
+    return [self isEqualToAddressesElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_country hash];
+    hash = hash * 31 + [_extendedAddress hash];
+    hash = hash * 31 + [_formatted hash];
+    hash = hash * 31 + [_latitude hash];
+    hash = hash * 31 + [_locality hash];
+    hash = hash * 31 + [_longitude hash];
+    hash = hash * 31 + [_poBox hash];
+    hash = hash * 31 + [_postalCode hash];
+    hash = hash * 31 + [_primary hash];
+    hash = hash * 31 + [_region hash];
+    hash = hash * 31 + [_streetAddress hash];
+    hash = hash * 31 + [_type hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
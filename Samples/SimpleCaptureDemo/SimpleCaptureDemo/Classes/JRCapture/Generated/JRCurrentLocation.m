@@ -67,6 +67,7 @@
 
 - (void)setCountry:(NSString *)newCountry
 {
+    [self willChangeProperty:@"country"];
     [self.dirtyPropertySet addObject:@"country"];
 
     _country = [newCountry copy];
@@ -79,6 +80,7 @@
 
 - (void)setExtendedAddress:(NSString *)newExtendedAddress
 {
+    [self willChangeProperty:@"extendedAddress"];
     [self.dirtyPropertySet addObject:@"extendedAddress"];
 
     _extendedAddress = [newExtendedAddress copy];
@@ -91,6 +93,7 @@
 
 - (void)setFormatted:(NSString *)newFormatted
 {
+    [self willChangeProperty:@"formatted"];
     [self.dirtyPropertySet addObject:@"formatted"];
 
     _formatted = [newFormatted copy];
@@ -103,6 +106,7 @@
 
 - (void)setLatitude:(JRDecimal *)newLatitude
 {
+    [self willChangeProperty:@"latitude"];
     [self.dirtyPropertySet addObject:@"latitude"];
 
     _latitude = [newLatitude copy];
@@ -115,6 +119,7 @@
 
 - (void)setLocality:(NSString *)newLocality
 {
+    [self willChangeProperty:@"locality"];
     [self.dirtyPropertySet addObject:@"locality"];
 
     _locality = [newLocality copy];
@@ -127,6 +132,7 @@
 
 - (void)setLongitude:(JRDecimal *)newLongitude
 {
+    [self willChangeProperty:@"longitude"];
     [self.dirtyPropertySet addObject:@"longitude"];
 
     _longitude = [newLongitude copy];
@@ -139,6 +145,7 @@
 
 - (void)setPoBox:(NSString *)newPoBox
 {
+    [self willChangeProperty:@"poBox"];
     [self.dirtyPropertySet addObject:@"poBox"];
 
     _poBox = [newPoBox copy];
@@ -151,6 +158,7 @@
 
 - (void)setPostalCode:(NSString *)newPostalCode
 {
+    [self willChangeProperty:@"postalCode"];
     [self.dirtyPropertySet addObject:@"postalCode"];
 
     _postalCode = [newPostalCode copy];
@@ -163,6 +171,7 @@
 
 - (void)setRegion:(NSString *)newRegion
 {
+    [self willChangeProperty:@"region"];
     [self.dirtyPropertySet addObject:@"region"];
 
     _region = [newRegion copy];
@@ -175,6 +184,7 @@
 
 - (void)setStreetAddress:(NSString *)newStreetAddress
 {
+    [self willChangeProperty:@"streetAddress"];
     [self.dirtyPropertySet addObject:@"streetAddress"];
 
     _streetAddress = [newStreetAddress copy];
@@ -187,6 +197,7 @@
 
 - (void)setType:(NSString *)newType
 {
+    [self willChangeProperty:@"type"];
     [self.dirtyPropertySet addObject:@"type"];
 
     _type = [newType copy];
@@ -210,32 +221,66 @@
     return [[JRCurrentLocation alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRCurrentLocation *currentLocationCopy = (JRCurrentLocation *)[super copyWithZone:zone];
+
+    currentLocationCopy->_country = _country;
+    currentLocationCopy->_extendedAddress = _extendedAddress;
+    currentLocationCopy->_formatted = _formatted;
+    currentLocationCopy->_latitude = _latitude;
+    currentLocationCopy->_locality = _locality;
+    currentLocationCopy->_longitude = _longitude;
+    currentLocationCopy->_poBox = _poBox;
+    currentLocationCopy->_postalCode = _postalCode;
+    currentLocationCopy->_region = _region;
+    currentLocationCopy->_streetAddress = _streetAddress;
+    currentLocationCopy->_type = _type;
+
+    return currentLocationCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.country ? self.country : [NSNull null])
+    [dictionary setObject:(_country ? _country : [NSNull null])
                    forKey:@"country"];
-    [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null])
+    [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null])
                    forKey:@"extendedAddress"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null])
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null])
                    forKey:@"formatted"];
-    [dictionary setObject:(self.latitude ? self.latitude : [NSNull null])
+    [dictionary setObject:(_latitude ? _latitude : [NSNull null])
                    forKey:@"latitude"];
-    [dictionary setObject:(self.locality ? self.locality : [NSNull null])
+    [dictionary setObject:(_locality ? _locality : [NSNull null])
                    forKey:@"locality"];
-    [dictionary setObject:(self.longitude ? self.longitude : [NSNull null])
+    [dictionary setObject:(_longitude ? _longitude : [NSNull null])
                    forKey:@"longitude"];
-    [dictionary setObject:(self.poBox ? self.poBox : [NSNull null])
+    [dictionary setObject:(_poBox ? _poBox : [NSNull null])
                    forKey:@"poBox"];
-    [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null])
+    [dictionary setObject:(_postalCode ? _postalCode : [NSNull null])
                    forKey:@"postalCode"];
-    [dictionary setObject:(self.region ? self.region : [NSNull null])
+    [dictionary setObject:(_region ? _region : [NSNull null])
                    forKey:@"region"];
-    [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null])
+    [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null])
                    forKey:@"streetAddress"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null])
+    [dictionary setObject:(_type ? _type : [NSNull null])
                    forKey:@"type"];
 
     if (forEncoder)
@@ -392,6 +437,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -408,6 +454,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"currentLocation"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"currentLocation"] allObjects]];
 
@@ -419,37 +467,37 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"country"])
-        [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
+        [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
 
     if ([self.dirtyPropertySet containsObject:@"extendedAddress"])
-        [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
+        [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"formatted"])
-        [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
+        [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
 
     if ([self.dirtyPropertySet containsObject:@"latitude"])
-        [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
+        [dictionary setObject:(_latitude ? _latitude : [NSNull null]) forKey:@"latitude"];
 
     if ([self.dirtyPropertySet containsObject:@"locality"])
-        [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
+        [dictionary setObject:(_locality ? _locality : [NSNull null]) forKey:@"locality"];
 
     if ([self.dirtyPropertySet containsObject:@"longitude"])
-        [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
+        [dictionary setObject:(_longitude ? _longitude : [NSNull null]) forKey:@"longitude"];
 
     if ([self.dirtyPropertySet containsObject:@"poBox"])
-        [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
+        [dictionary setObject:(_poBox ? _poBox : [NSNull null]) forKey:@"poBox"];
 
     if ([self.dirtyPropertySet containsObject:@"postalCode"])
-        [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
+        [dictionary setObject:(_postalCode ? _postalCode : [NSNull null]) forKey:@"postalCode"];
 
     if ([self.dirtyPropertySet containsObject:@"region"])
-        [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
+        [dictionary setObject:(_region ? _region : [NSNull null]) forKey:@"region"];
 
     if ([self.dirtyPropertySet containsObject:@"streetAddress"])
-        [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
+        [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null]) forKey:@"streetAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"type"])
-        [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+        [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -465,17 +513,17 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.country ? self.country : [NSNull null]) forKey:@"country"];
-    [dictionary setObject:(self.extendedAddress ? self.extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
-    [dictionary setObject:(self.latitude ? self.latitude : [NSNull null]) forKey:@"latitude"];
-    [dictionary setObject:(self.locality ? self.locality : [NSNull null]) forKey:@"locality"];
-    [dictionary setObject:(self.longitude ? self.longitude : [NSNull null]) forKey:@"longitude"];
-    [dictionary setObject:(self.poBox ? self.poBox : [NSNull null]) forKey:@"poBox"];
-    [dictionary setObject:(self.postalCode ? self.postalCode : [NSNull null]) forKey:@"postalCode"];
-    [dictionary setObject:(self.region ? self.region : [NSNull null]) forKey:@"region"];
-    [dictionary setObject:(self.streetAddress ? self.streetAddress : [NSNull null]) forKey:@"streetAddress"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+    [dictionary setObject:(_country ? _country : [NSNull null]) forKey:@"country"];
+    [dictionary setObject:(_extendedAddress ? _extendedAddress : [NSNull null]) forKey:@"extendedAddress"];
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
+    [dictionary setObject:(_latitude ? _latitude : [NSNull null]) forKey:@"latitude"];
+    [dictionary setObject:(_locality ? _locality : [NSNull null]) forKey:@"locality"];
+    [dictionary setObject:(_longitude ? _longitude : [NSNull null]) forKey:@"longitude"];
+    [dictionary setObject:(_poBox ? _poBox : [NSNull null]) forKey:@"poBox"];
+    [dictionary setObject:(_postalCode ? _postalCode : [NSNull null]) forKey:@"postalCode"];
+    [dictionary setObject:(_region ? _region : [NSNull null]) forKey:@"region"];
+    [dictionary setObject:(_streetAddress ? _streetAddress : [NSNull null]) forKey:@"streetAddress"];
+    [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -491,53 +539,83 @@
 
 - (BOOL)isEqualToCurrentLocation:(JRCurrentLocation *)otherCurrentLocation
 {
-    if (!self.country && !otherCurrentLocation.country) /* Keep going... */;
-    else if ((self.country == nil) ^ (otherCurrentLocation.country == nil)) return NO; // xor
-    else if (![self.country isEqualToString:otherCurrentLocation.country]) return NO;
+    if (!otherCurrentLocation) return NO;
+    if ([self hash] != [otherCurrentLocation hash]) return NO;
+
+    if (!_country && !otherCurrentLocation->_country) /* Keep going... */;
+    else if ((_country == nil) ^ (otherCurrentLocation->_country == nil)) return NO; // xor
+    else if (![_country isEqualToString:otherCurrentLocation->_country]) return NO;
 
-    if (!self.extendedAddress && !otherCurrentLocation.extendedAddress) /* Keep going... */;
-    else if ((self.extendedAddress == nil) ^ (otherCurrentLocation.extendedAddress == nil)) return NO; // xor
-    else if (![self.extendedAddress isEqualToString:otherCurrentLocation.extendedAddress]) return NO;
+    if (!_extendedAddress && !otherCurrentLocation->_extendedAddress) /* Keep going... */;
+    else if ((_extendedAddress == nil) ^ (otherCurrentLocation->_extendedAddress == nil)) return NO; // xor
+    else if (![_extendedAddress isEqualToString:otherCurrentLocation->_extendedAddress]) return NO;
 
-    if (!self.formatted && !otherCurrentLocation.formatted) /* Keep going... */;
-    else if ((self.formatted == nil) ^ (otherCurrentLocation.formatted == nil)) return NO; // xor
-    else if (![self.formatted isEqualToString:otherCurrentLocation.formatted]) return NO;
+    if (!_formatted && !otherCurrentLocation->_formatted) /* Keep going... */;
+    else if ((_formatted == nil) ^ (otherCurrentLocation->_formatted == nil)) return NO; // xor
+    else if (![_formatted isEqualToString:otherCurrentLocation->_formatted]) return NO;
 
-    if (!self.latitude && !otherCurrentLocation.latitude) /* Keep going... */;
-    else if ((self.latitude == nil) ^ (otherCurrentLocation.latitude == nil)) return NO; // xor
-    else if (![self.latitude isEqualToNumber:otherCurrentLocation.latitude]) return NO;
+    if (!_latitude && !otherCurrentLocation->_latitude) /* Keep going... */;
+    else if ((_latitude == nil) ^ (otherCurrentLocation->_latitude == nil)) return NO; // xor
+    else if (![_latitude isEqualToNumber:otherCurrentLocation->_latitude]) return NO;
 
-    if (!self.locality && !otherCurrentLocation.locality) /* Keep going... */;
-    else if ((self.locality == nil) ^ (otherCurrentLocation.locality == nil)) return NO; // xor
-    else if (![self.locality isEqualToString:otherCurrentLocation.locality]) return NO;
+    if (!_locality && !otherCurrentLocation->_locality) /* Keep going... */;
+    else if ((_locality == nil) ^ (otherCurrentLocation->_locality == nil)) return NO; // xor
+    else if (![_locality isEqualToString:otherCurrentLocation->_locality]) return NO;
 
-    if (!self.longitude && !otherCurrentLocation.longitude) /* Keep going... */;
-    else if ((self.longitude == nil) ^ (otherCurrentLocation.longitude == nil)) return NO; // xor
-    else if (![self.longitude isEqualToNumber:otherCurrentLocation.longitude]) return NO;
+    if (!_longitude && !otherCurrentLocation->_longitude) /* Keep going... */;
+    else if ((_longitude == nil) ^ (otherCurrentLocation->_longitude == nil)) return NO; // xor
+    else if (![_longitude isEqualToNumber:otherCurrentLocation->_longitude]) return NO;
 
-    if (!self.poBox && !otherCurrentLocation.poBox) /* Keep going... */;
-    else if ((self.poBox == nil) ^ (otherCurrentLocation.poBox == nil)) return NO; // xor
-    else if (![self.poBox isEqualToString:otherCurrentLocation.poBox]) return NO;
+    if (!_poBox && !otherCurrentLocation->_poBox) /* Keep going... */;
+    else if ((_poBox == nil) ^ (otherCurrentLocation->_poBox == nil)) return NO; // xor
+    else if (![_poBox isEqualToString:otherCurrentLocation->_poBox]) return NO;
 
-    if (!self.postalCode && !otherCurrentLocation.postalCode) /* Keep going... */;
-    else if ((self.postalCode == nil) ^ (otherCurrentLocation.postalCode == nil)) return NO; // xor
-    else if (![self.postalCode isEqualToString:otherCurrentLocation.postalCode]) return NO;
+    if (!_postalCode && !otherCurrentLocation->_postalCode) /* Keep going... */;
+    else if ((_postalCode == nil) ^ (otherCurrentLocation->_postalCode == nil)) return NO; // xor
+    else if (![_postalCode isEqualToString:otherCurrentLocation->_postalCode]) return NO;
 
-    if (!self.region && !otherCurrentLocation.region) /* Keep going... */;
-    else if ((self.region == nil) ^ (otherCurrentLocation.region == nil)) return NO; // xor
-    else if (![self.region isEqualToString:otherCurrentLocation.region]) return NO;
+    if (!_region && !otherCurrentLocation->_region) /* Keep going... */;
+    else if ((_region == nil) ^ (otherCurrentLocation->_region == nil)) return NO; // xor
+    else if (![_region isEqualToString:otherCurrentLocation->_region]) return NO;
 
-    if (!self.streetAddress && !otherCurrentLocation.streetAddress) /* Keep going... */;
-    else if ((self.streetAddress == nil) ^ (otherCurrentLocation.streetAddress == nil)) return NO; // xor
-    else if (![self.streetAddress isEqualToString:otherCurrentLocation.streetAddress]) return NO;
+    if (!_streetAddress && !otherCurrentLocation->_streetAddress) /* Keep going... */;
+    else if ((_streetAddress == nil) ^ (otherCurrentLocation->_streetAddress == nil)) return NO; // xor
+    else if (![_streetAddress isEqualToString:otherCurrentLocation->_streetAddress]) return NO;
 
-    if (!self.type && !otherCurrentLocation.type) /* Keep going... */;
-    else if ((self.type == nil) ^ (otherCurrentLocation.type == nil)) return NO; // xor
-    else if (![self.type isEqualToString:otherCurrentLocation.type]) return NO;
+    if (!_type && !otherCurrentLocation->_type) /* Keep going... */;
+    else if ((_type == nil) ^ (otherCurrentLocation->_type == nil)) return NO; // xor
+    else if (![_type isEqualToString:otherCurrentLocation->_type]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRCurrentLocation class]]) return NO;
+
+    return [self isEqualToCurrentLocation:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_country hash];
+    hash = hash * 31 + [_extendedAddress hash];
+    hash = hash * 31 + [_formatted hash];
+    hash = hash * 31 + [_latitude hash];
+    hash = hash * 31 + [_locality hash];
+    hash = hash * 31 + [_longitude hash];
+    hash = hash * 31 + [_poBox hash];
+    hash = hash * 31 + [_postalCode hash];
+    hash = hash * 31 + [_region hash];
+    hash = hash * 31 + [_streetAddress hash];
+    hash = hash * 31 + [_type hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
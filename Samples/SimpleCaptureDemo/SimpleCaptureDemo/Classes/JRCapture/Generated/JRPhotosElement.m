@@ -58,6 +58,7 @@
 
 - (void)setType:(NSString *)newType
 {
+    [self willChangeProperty:@"type"];
     [self.dirtyPropertySet addObject:@"type"];
 
     _type = [newType copy];
@@ -70,6 +71,7 @@
 
 - (void)setValue:(NSString *)newValue
 {
+    [self willChangeProperty:@"value"];
     [self.dirtyPropertySet addObject:@"value"];
 
     _value = [newValue copy];
@@ -93,14 +95,39 @@
     return [[JRPhotosElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPhotosElement *photosElementCopy = (JRPhotosElement *)[super copyWithZone:zone];
+
+    photosElementCopy->_type = _type;
+    photosElementCopy->_value = _value;
+
+    return photosElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.type ? self.type : [NSNull null])
+    [dictionary setObject:(_type ? _type : [NSNull null])
                    forKey:@"type"];
-    [dictionary setObject:(self.value ? self.value : [NSNull null])
+    [dictionary setObject:(_value ? _value : [NSNull null])
                    forKey:@"value"];
 
     if (forEncoder)
@@ -185,6 +212,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -201,6 +229,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"photosElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"photosElement"] allObjects]];
 
@@ -212,10 +242,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"type"])
-        [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+        [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     if ([self.dirtyPropertySet containsObject:@"value"])
-        [dictionary setObject:(self.value ? self.value : [NSNull null]) forKey:@"value"];
+        [dictionary setObject:(_value ? _value : [NSNull null]) forKey:@"value"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -231,8 +261,8 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
-    [dictionary setObject:(self.value ? self.value : [NSNull null]) forKey:@"value"];
+    [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
+    [dictionary setObject:(_value ? _value : [NSNull null]) forKey:@"value"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -248,17 +278,38 @@
 
 - (BOOL)isEqualToPhotosElement:(JRPhotosElement *)otherPhotosElement
 {
-    if (!self.type && !otherPhotosElement.type) /* Keep going... */;
-    else if ((self.type == nil) ^ (otherPhotosElement.type == nil)) return NO; // xor
-    else if (![self.type isEqualToString:otherPhotosElement.type]) return NO;
+    if (!otherPhotosElement) return NO;
+    if ([self hash] != [otherPhotosElement hash]) return NO;
+
+    if (!_type && !otherPhotosElement->_type) /* Keep going... */;
+    else if ((_type == nil) ^ (otherPhotosElement->_type == nil)) return NO; // xor
+    else if (![_type isEqualToString:otherPhotosElement->_type]) return NO;
 
-    if (!self.value && !otherPhotosElement.value) /* Keep going... */;
-    else if ((self.value == nil) ^ (otherPhotosElement.value == nil)) return NO; // xor
-    else if (![self.value isEqualToString:otherPhotosElement.value]) return NO;
+    if (!_value && !otherPhotosElement->_value) /* Keep going... */;
+    else if ((_value == nil) ^ (otherPhotosElement->_value == nil)) return NO; // xor
+    else if (![_value isEqualToString:otherPhotosElement->_value]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPhotosElement class]]) return NO;
+
+    return [self isEqualToPhotosElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_type hash];
+    hash = hash * 31 + [_value hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
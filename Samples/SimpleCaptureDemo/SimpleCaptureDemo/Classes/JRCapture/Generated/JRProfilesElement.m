@@ -71,6 +71,7 @@
 
 - (void)setAccessCredentials:(JRJsonObject *)newAccessCredentials
 {
+    [self willChangeProperty:@"accessCredentials"];
     [self.dirtyPropertySet addObject:@"accessCredentials"];
 
     _accessCredentials = [newAccessCredentials copy];
@@ -83,6 +84,7 @@
 
 - (void)setDomain:(NSString *)newDomain
 {
+    [self willChangeProperty:@"domain"];
     [self.dirtyPropertySet addObject:@"domain"];
 
     _domain = [newDomain copy];
@@ -95,6 +97,8 @@
 
 - (void)setFollowers:(JRStringArray *)newFollowers
 {
+    [self willChangeProperty:@"followers"];
+
     _followers = [newFollowers copy];
 }
 
@@ -105,6 +109,8 @@
 
 - (void)setFollowing:(JRStringArray *)newFollowing
 {
+    [self willChangeProperty:@"following"];
+
     _following = [newFollowing copy];
 }
 
@@ -115,6 +121,8 @@
 
 - (void)setFriends:(JRStringArray *)newFriends
 {
+    [self willChangeProperty:@"friends"];
+
     _friends = [newFriends copy];
 }
 
@@ -125,6 +133,7 @@
 
 - (void)setIdentifier:(NSString *)newIdentifier
 {
+    [self willChangeProperty:@"identifier"];
     [self.dirtyPropertySet addObject:@"identifier"];
 
     _identifier = [newIdentifier copy];
@@ -132,14 +141,18 @@
 
 - (JRProfile *)profile
 {
+    if ([self.sharedPropertySet containsObject:@"profile"])
+        [self unshareProperty:@"profile"];
+
     return _profile;
 }
 
 - (void)setProfile:(JRProfile *)newProfile
 {
+    [self willChangeProperty:@"profile"];
     [self.dirtyPropertySet addObject:@"profile"];
 
-    _profile = newProfile;
+    _profile = [self claimValue:newProfile forProperty:@"profile"];
 
     [_profile setAllPropertiesToDirty];
 }
@@ -151,6 +164,7 @@
 
 - (void)setProvider:(JRJsonObject *)newProvider
 {
+    [self willChangeProperty:@"provider"];
     [self.dirtyPropertySet addObject:@"provider"];
 
     _provider = [newProvider copy];
@@ -163,6 +177,7 @@
 
 - (void)setProviderSpecifier:(NSString *)newProviderSpecifier
 {
+    [self willChangeProperty:@"providerSpecifier"];
     [self.dirtyPropertySet addObject:@"providerSpecifier"];
 
     _providerSpecifier = [newProviderSpecifier copy];
@@ -175,6 +190,7 @@
 
 - (void)setRemote_key:(NSString *)newRemote_key
 {
+    [self willChangeProperty:@"remote_key"];
     [self.dirtyPropertySet addObject:@"remote_key"];
 
     _remote_key = [newRemote_key copy];
@@ -187,7 +203,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _profile = [[JRProfile alloc] init];
+        _profile = [self claimValue:[[JRProfile alloc] init] forProperty:@"profile"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -208,7 +224,7 @@
 
         _domain = [newDomain copy];
         _identifier = [newIdentifier copy];
-        _profile = [[JRProfile alloc] init];
+        _profile = [self claimValue:[[JRProfile alloc] init] forProperty:@"profile"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -225,30 +241,65 @@
     return [[JRProfilesElement alloc] initWithDomain:domain andIdentifier:identifier];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRProfilesElement *profilesElementCopy = (JRProfilesElement *)[super copyWithZone:zone];
+
+    profilesElementCopy->_accessCredentials = _accessCredentials;
+    profilesElementCopy->_domain = _domain;
+    profilesElementCopy->_followers = _followers;
+    profilesElementCopy->_following = _following;
+    profilesElementCopy->_friends = _friends;
+    profilesElementCopy->_identifier = _identifier;
+    profilesElementCopy->_profile = _profile;
+    profilesElementCopy->_provider = _provider;
+    profilesElementCopy->_providerSpecifier = _providerSpecifier;
+    profilesElementCopy->_remote_key = _remote_key;
+
+    return profilesElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"profile", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"profile"]) return _profile;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"profile"]) _profile = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.accessCredentials ? self.accessCredentials : [NSNull null])
+    [dictionary setObject:(_accessCredentials ? _accessCredentials : [NSNull null])
                    forKey:@"accessCredentials"];
-    [dictionary setObject:(self.domain ? self.domain : [NSNull null])
+    [dictionary setObject:(_domain ? _domain : [NSNull null])
                    forKey:@"domain"];
-    [dictionary setObject:(self.followers ? self.followers : [NSNull null])
+    [dictionary setObject:(_followers ? _followers : [NSNull null])
                    forKey:@"followers"];
-    [dictionary setObject:(self.following ? self.following : [NSNull null])
+    [dictionary setObject:(_following ? _following : [NSNull null])
                    forKey:@"following"];
-    [dictionary setObject:(self.friends ? self.friends : [NSNull null])
+    [dictionary setObject:(_friends ? _friends : [NSNull null])
                    forKey:@"friends"];
-    [dictionary setObject:(self.identifier ? self.identifier : [NSNull null])
+    [dictionary setObject:(_identifier ? _identifier : [NSNull null])
                    forKey:@"identifier"];
-    [dictionary setObject:(self.profile ? [self.profile newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_profile ? [_profile newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"profile"];
-    [dictionary setObject:(self.provider ? self.provider : [NSNull null])
+    [dictionary setObject:(_provider ? _provider : [NSNull null])
                    forKey:@"provider"];
-    [dictionary setObject:(self.providerSpecifier ? self.providerSpecifier : [NSNull null])
+    [dictionary setObject:(_providerSpecifier ? _providerSpecifier : [NSNull null])
                    forKey:@"providerSpecifier"];
-    [dictionary setObject:(self.remote_key ? self.remote_key : [NSNull null])
+    [dictionary setObject:(_remote_key ? _remote_key : [NSNull null])
                    forKey:@"remote_key"];
 
     if (forEncoder)
@@ -400,6 +451,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -411,8 +463,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"profilesElement"];
 
-    if (self.profile)
-        [snapshotDictionary setObject:[self.profile snapshotDictionaryFromDirtyPropertySet]
+    if (_profile)
+        [snapshotDictionary setObject:[_profile snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"profile"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -420,6 +472,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"profilesElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"profilesElement"] allObjects]];
 
@@ -435,31 +489,31 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"accessCredentials"])
-        [dictionary setObject:(self.accessCredentials ? self.accessCredentials : [NSNull null]) forKey:@"accessCredentials"];
+        [dictionary setObject:(_accessCredentials ? _accessCredentials : [NSNull null]) forKey:@"accessCredentials"];
 
     if ([self.dirtyPropertySet containsObject:@"domain"])
-        [dictionary setObject:(self.domain ? self.domain : [NSNull null]) forKey:@"domain"];
+        [dictionary setObject:(_domain ? _domain : [NSNull null]) forKey:@"domain"];
 
     if ([self.dirtyPropertySet containsObject:@"identifier"])
-        [dictionary setObject:(self.identifier ? self.identifier : [NSNull null]) forKey:@"identifier"];
+        [dictionary setObject:(_identifier ? _identifier : [NSNull null]) forKey:@"identifier"];
 
     if ([self.dirtyPropertySet containsObject:@"profile"])
-        [dictionary setObject:(self.profile ?
-                              [self.profile toUpdateDictionary] :
+        [dictionary setObject:(_profile ?
+                              [_profile toUpdateDictionary] :
                               [[JRProfile profile] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"profile"];
-    else if ([self.profile needsUpdate])
-        [dictionary setObject:[self.profile toUpdateDictionary]
+    else if ([_profile needsUpdate])
+        [dictionary setObject:[_profile toUpdateDictionary]
                        forKey:@"profile"];
 
     if ([self.dirtyPropertySet containsObject:@"provider"])
-        [dictionary setObject:(self.provider ? self.provider : [NSNull null]) forKey:@"provider"];
+        [dictionary setObject:(_provider ? _provider : [NSNull null]) forKey:@"provider"];
 
     if ([self.dirtyPropertySet containsObject:@"providerSpecifier"])
-        [dictionary setObject:(self.providerSpecifier ? self.providerSpecifier : [NSNull null]) forKey:@"providerSpecifier"];
+        [dictionary setObject:(_providerSpecifier ? _providerSpecifier : [NSNull null]) forKey:@"providerSpecifier"];
 
     if ([self.dirtyPropertySet containsObject:@"remote_key"])
-        [dictionary setObject:(self.remote_key ? self.remote_key : [NSNull null]) forKey:@"remote_key"];
+        [dictionary setObject:(_remote_key ? _remote_key : [NSNull null]) forKey:@"remote_key"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -475,32 +529,32 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.accessCredentials ? self.accessCredentials : [NSNull null]) forKey:@"accessCredentials"];
-    [dictionary setObject:(self.domain ? self.domain : [NSNull null]) forKey:@"domain"];
+    [dictionary setObject:(_accessCredentials ? _accessCredentials : [NSNull null]) forKey:@"accessCredentials"];
+    [dictionary setObject:(_domain ? _domain : [NSNull null]) forKey:@"domain"];
 
-    [dictionary setObject:(self.followers ?
-                          self.followers :
+    [dictionary setObject:(_followers ?
+                          _followers :
                           [NSArray array])
                    forKey:@"followers"];
 
-    [dictionary setObject:(self.following ?
-                          self.following :
+    [dictionary setObject:(_following ?
+                          _following :
                           [NSArray array])
                    forKey:@"following"];
 
-    [dictionary setObject:(self.friends ?
-                          self.friends :
+    [dictionary setObject:(_friends ?
+                          _friends :
                           [NSArray array])
                    forKey:@"friends"];
-    [dictionary setObject:(self.identifier ? self.identifier : [NSNull null]) forKey:@"identifier"];
+    [dictionary setObject:(_identifier ? _identifier : [NSNull null]) forKey:@"identifier"];
 
-    [dictionary setObject:(self.profile ?
-                          [self.profile toReplaceDictionary] :
+    [dictionary setObject:(_profile ?
+                          [_profile toReplaceDictionary] :
                           [[JRProfile profile] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"profile"];
-    [dictionary setObject:(self.provider ? self.provider : [NSNull null]) forKey:@"provider"];
-    [dictionary setObject:(self.providerSpecifier ? self.providerSpecifier : [NSNull null]) forKey:@"providerSpecifier"];
-    [dictionary setObject:(self.remote_key ? self.remote_key : [NSNull null]) forKey:@"remote_key"];
+    [dictionary setObject:(_provider ? _provider : [NSNull null]) forKey:@"provider"];
+    [dictionary setObject:(_providerSpecifier ? _providerSpecifier : [NSNull null]) forKey:@"providerSpecifier"];
+    [dictionary setObject:(_remote_key ? _remote_key : [NSNull null]) forKey:@"remote_key"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -529,7 +583,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.profile needsUpdate])
+    if ([_profile needsUpdate])
         return YES;
 
     return NO;
@@ -537,53 +591,82 @@
 
 - (BOOL)isEqualToProfilesElement:(JRProfilesElement *)otherProfilesElement
 {
-    if (!self.accessCredentials && !otherProfilesElement.accessCredentials) /* Keep going... */;
-    else if ((self.accessCredentials == nil) ^ (otherProfilesElement.accessCredentials == nil)) return NO; // xor
-    else if (![self.accessCredentials isEqual:otherProfilesElement.accessCredentials]) return NO;
+    if (!otherProfilesElement) return NO;
+    if ([self hash] != [otherProfilesElement hash]) return NO;
+
+    if (!_accessCredentials && !otherProfilesElement->_accessCredentials) /* Keep going... */;
+    else if ((_accessCredentials == nil) ^ (otherProfilesElement->_accessCredentials == nil)) return NO; // xor
+    else if (![_accessCredentials isEqual:otherProfilesElement->_accessCredentials]) return NO;
 
-    if (!self.domain && !otherProfilesElement.domain) /* Keep going... */;
-    else if ((self.domain == nil) ^ (otherProfilesElement.domain == nil)) return NO; // xor
-    else if (![self.domain isEqualToString:otherProfilesElement.domain]) return NO;
+    if (!_domain && !otherProfilesElement->_domain) /* Keep going... */;
+    else if ((_domain == nil) ^ (otherProfilesElement->_domain == nil)) return NO; // xor
+    else if (![_domain isEqualToString:otherProfilesElement->_domain]) return NO;
 
-    if (!self.followers && !otherProfilesElement.followers) /* Keep going... */;
-    else if (!self.followers && ![otherProfilesElement.followers count]) /* Keep going... */;
-    else if (!otherProfilesElement.followers && ![self.followers count]) /* Keep going... */;
-    else if (![self.followers isEqualToArray:otherProfilesElement.followers]) return NO;
+    if (!_followers && !otherProfilesElement->_followers) /* Keep going... */;
+    else if (!_followers && ![otherProfilesElement->_followers count]) /* Keep going... */;
+    else if (!otherProfilesElement->_followers && ![_followers count]) /* Keep going... */;
+    else if (![_followers isEqualToArray:otherProfilesElement->_followers]) return NO;
 
-    if (!self.following && !otherProfilesElement.following) /* Keep going... */;
-    else if (!self.following && ![otherProfilesElement.following count]) /* Keep going... */;
-    else if (!otherProfilesElement.following && ![self.following count]) /* Keep going... */;
-    else if (![self.following isEqualToArray:otherProfilesElement.following]) return NO;
+    if (!_following && !otherProfilesElement->_following) /* Keep going... */;
+    else if (!_following && ![otherProfilesElement->_following count]) /* Keep going... */;
+    else if (!otherProfilesElement->_following && ![_following count]) /* Keep going... */;
+    else if (![_following isEqualToArray:otherProfilesElement->_following]) return NO;
 
-    if (!self.friends && !otherProfilesElement.friends) /* Keep going... */;
-    else if (!self.friends && ![otherProfilesElement.friends count]) /* Keep going... */;
-    else if (!otherProfilesElement.friends && ![self.friends count]) /* Keep going... */;
-    else if (![self.friends isEqualToArray:otherProfilesElement.friends]) return NO;
+    if (!_friends && !otherProfilesElement->_friends) /* Keep going... */;
+    else if (!_friends && ![otherProfilesElement->_friends count]) /* Keep going... */;
+    else if (!otherProfilesElement->_friends && ![_friends count]) /* Keep going... */;
+    else if (![_friends isEqualToArray:otherProfilesElement->_friends]) return NO;
 
-    if (!self.identifier && !otherProfilesElement.identifier) /* Keep going... */;
-    else if ((self.identifier == nil) ^ (otherProfilesElement.identifier == nil)) return NO; // xor
-    else if (![self.identifier isEqualToString:otherProfilesElement.identifier]) return NO;
+    if (!_identifier && !otherProfilesElement->_identifier) /* Keep going... */;
+    else if ((_identifier == nil) ^ (otherProfilesElement->_identifier == nil)) return NO; // xor
+    else if (![_identifier isEqualToString:otherProfilesElement->_identifier]) return NO;
 
-    if (!self.profile && !otherProfilesElement.profile) /* Keep going... */;
-    else if (!self.profile && [otherProfilesElement.profile isEqualToProfile:[JRProfile profile]]) /* Keep going... */;
-    else if (!otherProfilesElement.profile && [self.profile isEqualToProfile:[JRProfile profile]]) /* Keep going... */;
-    else if (![self.profile isEqualToProfile:otherProfilesElement.profile]) return NO;
+    if (!_profile && !otherProfilesElement->_profile) /* Keep going... */;
+    else if (!_profile && [otherProfilesElement->_profile isEqualToProfile:[JRProfile profile]]) /* Keep going... */;
+    else if (!otherProfilesElement->_profile && [_profile isEqualToProfile:[JRProfile profile]]) /* Keep going... */;
+    else if (![_profile isEqualToProfile:otherProfilesElement->_profile]) return NO;
 
-    if (!self.provider && !otherProfilesElement.provider) /* Keep going... */;
-    else if ((self.provider == nil) ^ (otherProfilesElement.provider == nil)) return NO; // xor
-    else if (![self.provider isEqual:otherProfilesElement.provider]) return NO;
+    if (!_provider && !otherProfilesElement->_provider) /* Keep going... */;
+    else if ((_provider == nil) ^ (otherProfilesElement->_provider == nil)) return NO; // xor
+    else if (![_provider isEqual:otherProfilesElement->_provider]) return NO;
 
-    if (!self.providerSpecifier && !otherProfilesElement.providerSpecifier) /* Keep going... */;
-    else if ((self.providerSpecifier == nil) ^ (otherProfilesElement.providerSpecifier == nil)) return NO; // xor
-    else if (![self.providerSpecifier isEqualToString:otherProfilesElement.providerSpecifier]) return NO;
+    if (!_providerSpecifier && !otherProfilesElement->_providerSpecifier) /* Keep going... */;
+    else if ((_providerSpecifier == nil) ^ (otherProfilesElement->_providerSpecifier == nil)) return NO; // xor
+    else if (![_providerSpecifier isEqualToString:otherProfilesElement->_providerSpecifier]) return NO;
 
-    if (!self.remote_key && !otherProfilesElement.remote_key) /* Keep going... */;
-    else if ((self.remote_key == nil) ^ (otherProfilesElement.remote_key == nil)) return NO; // xor
-    else if (![self.remote_key isEqualToString:otherProfilesElement.remote_key]) return NO;
+    if (!_remote_key && !otherProfilesElement->_remote_key) /* Keep going... */;
+    else if ((_remote_key == nil) ^ (otherProfilesElement->_remote_key == nil)) return NO; // xor
+    else if (![_remote_key isEqualToString:otherProfilesElement->_remote_key]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRProfilesElement class]]) return NO;
+
+    return [self isEqualToProfilesElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_accessCredentials hash];
+    hash = hash * 31 + [_domain hash];
+    hash = hash * 31 + [_followers hash];
+    hash = hash * 31 + [_following hash];
+    hash = hash * 31 + [_friends hash];
+    hash = hash * 31 + [_identifier hash];
+    hash = hash * 31 + [_profile hash];
+    hash = hash * 31 + [_provider hash];
+    hash = hash * 31 + [_providerSpecifier hash];
+    hash = hash * 31 + [_remote_key hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -61,6 +61,7 @@
 
 - (void)setBuild:(NSString *)newBuild
 {
+    [self willChangeProperty:@"build"];
     [self.dirtyPropertySet addObject:@"build"];
 
     _build = [newBuild copy];
@@ -73,6 +74,7 @@
 
 - (void)setColor:(NSString *)newColor
 {
+    [self willChangeProperty:@"color"];
     [self.dirtyPropertySet addObject:@"color"];
 
     _color = [newColor copy];
@@ -85,6 +87,7 @@
 
 - (void)setEyeColor:(NSString *)newEyeColor
 {
+    [self willChangeProperty:@"eyeColor"];
     [self.dirtyPropertySet addObject:@"eyeColor"];
 
     _eyeColor = [newEyeColor copy];
@@ -97,6 +100,7 @@
 
 - (void)setHairColor:(NSString *)newHairColor
 {
+    [self willChangeProperty:@"hairColor"];
     [self.dirtyPropertySet addObject:@"hairColor"];
 
     _hairColor = [newHairColor copy];
@@ -109,6 +113,7 @@
 
 - (void)setHeight:(JRDecimal *)newHeight
 {
+    [self willChangeProperty:@"height"];
     [self.dirtyPropertySet addObject:@"height"];
 
     _height = [newHeight copy];
@@ -132,20 +137,48 @@
     return [[JRBodyType alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRBodyType *bodyTypeCopy = (JRBodyType *)[super copyWithZone:zone];
+
+    bodyTypeCopy->_build = _build;
+    bodyTypeCopy->_color = _color;
+    bodyTypeCopy->_eyeColor = _eyeColor;
+    bodyTypeCopy->_hairColor = _hairColor;
+    bodyTypeCopy->_height = _height;
+
+    return bodyTypeCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.build ? self.build : [NSNull null])
+    [dictionary setObject:(_build ? _build : [NSNull null])
                    forKey:@"build"];
-    [dictionary setObject:(self.color ? self.color : [NSNull null])
+    [dictionary setObject:(_color ? _color : [NSNull null])
                    forKey:@"color"];
-    [dictionary setObject:(self.eyeColor ? self.eyeColor : [NSNull null])
+    [dictionary setObject:(_eyeColor ? _eyeColor : [NSNull null])
                    forKey:@"eyeColor"];
-    [dictionary setObject:(self.hairColor ? self.hairColor : [NSNull null])
+    [dictionary setObject:(_hairColor ? _hairColor : [NSNull null])
                    forKey:@"hairColor"];
-    [dictionary setObject:(self.height ? self.height : [NSNull null])
+    [dictionary setObject:(_height ? _height : [NSNull null])
                    forKey:@"height"];
 
     if (forEncoder)
@@ -254,6 +287,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -270,6 +304,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"bodyType"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"bodyType"] allObjects]];
 
@@ -281,19 +317,19 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"build"])
-        [dictionary setObject:(self.build ? self.build : [NSNull null]) forKey:@"build"];
+        [dictionary setObject:(_build ? _build : [NSNull null]) forKey:@"build"];
 
     if ([self.dirtyPropertySet containsObject:@"color"])
-        [dictionary setObject:(self.color ? self.color : [NSNull null]) forKey:@"color"];
+        [dictionary setObject:(_color ? _color : [NSNull null]) forKey:@"color"];
 
     if ([self.dirtyPropertySet containsObject:@"eyeColor"])
-        [dictionary setObject:(self.eyeColor ? self.eyeColor : [NSNull null]) forKey:@"eyeColor"];
+        [dictionary setObject:(_eyeColor ? _eyeColor : [NSNull null]) forKey:@"eyeColor"];
 
     if ([self.dirtyPropertySet containsObject:@"hairColor"])
-        [dictionary setObject:(self.hairColor ? self.hairColor : [NSNull null]) forKey:@"hairColor"];
+        [dictionary setObject:(_hairColor ? _hairColor : [NSNull null]) forKey:@"hairColor"];
 
     if ([self.dirtyPropertySet containsObject:@"height"])
-        [dictionary setObject:(self.height ? self.height : [NSNull null]) forKey:@"height"];
+        [dictionary setObject:(_height ? _height : [NSNull null]) forKey:@"height"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -309,11 +345,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.build ? self.build : [NSNull null]) forKey:@"build"];
-    [dictionary setObject:(self.color ? self.color : [NSNull null]) forKey:@"color"];
-    [dictionary setObject:(self.eyeColor ? self.eyeColor : [NSNull null]) forKey:@"eyeColor"];
-    [dictionary setObject:(self.hairColor ? self.hairColor : [NSNull null]) forKey:@"hairColor"];
-    [dictionary setObject:(self.height ? self.height : [NSNull null]) forKey:@"height"];
+    [dictionary setObject:(_build ? _build : [NSNull null]) forKey:@"build"];
+    [dictionary setObject:(_color ? _color : [NSNull null]) forKey:@"color"];
+    [dictionary setObject:(_eyeColor ? _eyeColor : [NSNull null]) forKey:@"eyeColor"];
+    [dictionary setObject:(_hairColor ? _hairColor : [NSNull null]) forKey:@"hairColor"];
+    [dictionary setObject:(_height ? _height : [NSNull null]) forKey:@"height"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -329,29 +365,53 @@
 
 - (BOOL)isEqualToBodyType:(JRBodyType *)otherBodyType
 {
-    if (!self.build && !otherBodyType.build) /* Keep going... */;
-    else if ((self.build == nil) ^ (otherBodyType.build == nil)) return NO; // xor
-    else if (![self.build isEqualToString:otherBodyType.build]) return NO;
+    if (!otherBodyType) return NO;
+    if ([self hash] != [otherBodyType hash]) return NO;
+
+    if (!_build && !otherBodyType->_build) /* Keep going... */;
+    else if ((_build == nil) ^ (otherBodyType->_build == nil)) return NO; // xor
+    else if (![_build isEqualToString:otherBodyType->_build]) return NO;
 
-    if (!self.color && !otherBodyType.color) /* Keep going... */;
-    else if ((self.color == nil) ^ (otherBodyType.color == nil)) return NO; // xor
-    else if (![self.color isEqualToString:otherBodyType.color]) return NO;
+    if (!_color && !otherBodyType->_color) /* Keep going... */;
+    else if ((_color == nil) ^ (otherBodyType->_color == nil)) return NO; // xor
+    else if (![_color isEqualToString:otherBodyType->_color]) return NO;
 
-    if (!self.eyeColor && !otherBodyType.eyeColor) /* Keep going... */;
-    else if ((self.eyeColor == nil) ^ (otherBodyType.eyeColor == nil)) return NO; // xor
-    else if (![self.eyeColor isEqualToString:otherBodyType.eyeColor]) return NO;
+    if (!_eyeColor && !otherBodyType->_eyeColor) /* Keep going... */;
+    else if ((_eyeColor == nil) ^ (otherBodyType->_eyeColor == nil)) return NO; // xor
+    else if (![_eyeColor isEqualToString:otherBodyType->_eyeColor]) return NO;
 
-    if (!self.hairColor && !otherBodyType.hairColor) /* Keep going... */;
-    else if ((self.hairColor == nil) ^ (otherBodyType.hairColor == nil)) return NO; // xor
-    else if (![self.hairColor isEqualToString:otherBodyType.hairColor]) return NO;
+    if (!_hairColor && !otherBodyType->_hairColor) /* Keep going... */;
+    else if ((_hairColor == nil) ^ (otherBodyType->_hairColor == nil)) return NO; // xor
+    else if (![_hairColor isEqualToString:otherBodyType->_hairColor]) return NO;
 
-    if (!self.height && !otherBodyType.height) /* Keep going... */;
-    else if ((self.height == nil) ^ (otherBodyType.height == nil)) return NO; // xor
-    else if (![self.height isEqualToNumber:otherBodyType.height]) return NO;
+    if (!_height && !otherBodyType->_height) /* Keep going... */;
+    else if ((_height == nil) ^ (otherBodyType->_height == nil)) return NO; // xor
+    else if (![_height isEqualToNumber:otherBodyType->_height]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRBodyType class]]) return NO;
+
+    return [self isEqualToBodyType:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_build hash];
+    hash = hash * 31 + [_color hash];
+    hash = hash * 31 + [_eyeColor hash];
+    hash = hash * 31 + [_hairColor hash];
+    hash = hash * 31 + [_height hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
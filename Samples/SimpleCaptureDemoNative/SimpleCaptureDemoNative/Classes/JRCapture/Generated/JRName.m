@@ -62,6 +62,7 @@
 
 - (void)setFamilyName:(NSString *)newFamilyName
 {
+    [self willChangeProperty:@"familyName"];
     [self.dirtyPropertySet addObject:@"familyName"];
 
     _familyName = [newFamilyName copy];
@@ -74,6 +75,7 @@
 
 - (void)setFormatted:(NSString *)newFormatted
 {
+    [self willChangeProperty:@"formatted"];
     [self.dirtyPropertySet addObject:@"formatted"];
 
     _formatted = [newFormatted copy];
@@ -86,6 +88,7 @@
 
 - (void)setGivenName:(NSString *)newGivenName
 {
+    [self willChangeProperty:@"givenName"];
     [self.dirtyPropertySet addObject:@"givenName"];
 
     _givenName = [newGivenName copy];
@@ -98,6 +101,7 @@
 
 - (void)setHonorificPrefix:(NSString *)newHonorificPrefix
 {
+    [self willChangeProperty:@"honorificPrefix"];
     [self.dirtyPropertySet addObject:@"honorificPrefix"];
 
     _honorificPrefix = [newHonorificPrefix copy];
@@ -110,6 +114,7 @@
 
 - (void)setHonorificSuffix:(NSString *)newHonorificSuffix
 {
+    [self willChangeProperty:@"honorificSuffix"];
     [self.dirtyPropertySet addObject:@"honorificSuffix"];
 
     _honorificSuffix = [newHonorificSuffix copy];
@@ -122,6 +127,7 @@
 
 - (void)setMiddleName:(NSString *)newMiddleName
 {
+    [self willChangeProperty:@"middleName"];
     [self.dirtyPropertySet addObject:@"middleName"];
 
     _middleName = [newMiddleName copy];
@@ -145,22 +151,51 @@
     return [[JRName alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRName *nameCopy = (JRName *)[super copyWithZone:zone];
+
+    nameCopy->_familyName = _familyName;
+    nameCopy->_formatted = _formatted;
+    nameCopy->_givenName = _givenName;
+    nameCopy->_honorificPrefix = _honorificPrefix;
+    nameCopy->_honorificSuffix = _honorificSuffix;
+    nameCopy->_middleName = _middleName;
+
+    return nameCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.familyName ? self.familyName : [NSNull null])
+    [dictionary setObject:(_familyName ? _familyName : [NSNull null])
                    forKey:@"familyName"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null])
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null])
                    forKey:@"formatted"];
-    [dictionary setObject:(self.givenName ? self.givenName : [NSNull null])
+    [dictionary setObject:(_givenName ? _givenName : [NSNull null])
                    forKey:@"givenName"];
-    [dictionary setObject:(self.honorificPrefix ? self.honorificPrefix : [NSNull null])
+    [dictionary setObject:(_honorificPrefix ? _honorificPrefix : [NSNull null])
                    forKey:@"honorificPrefix"];
-    [dictionary setObject:(self.honorificSuffix ? self.honorificSuffix : [NSNull null])
+    [dictionary setObject:(_honorificSuffix ? _honorificSuffix : [NSNull null])
                    forKey:@"honorificSuffix"];
-    [dictionary setObject:(self.middleName ? self.middleName : [NSNull null])
+    [dictionary setObject:(_middleName ? _middleName : [NSNull null])
                    forKey:@"middleName"];
 
     if (forEncoder)
@@ -277,6 +312,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -293,6 +329,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"name"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"name"] allObjects]];
 
@@ -304,22 +342,22 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"familyName"])
-        [dictionary setObject:(self.familyName ? self.familyName : [NSNull null]) forKey:@"familyName"];
+        [dictionary setObject:(_familyName ? _familyName : [NSNull null]) forKey:@"familyName"];
 
     if ([self.dirtyPropertySet containsObject:@"formatted"])
-        [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
+        [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
 
     if ([self.dirtyPropertySet containsObject:@"givenName"])
-        [dictionary setObject:(self.givenName ? self.givenName : [NSNull null]) forKey:@"givenName"];
+        [dictionary setObject:(_givenName ? _givenName : [NSNull null]) forKey:@"givenName"];
 
     if ([self.dirtyPropertySet containsObject:@"honorificPrefix"])
-        [dictionary setObject:(self.honorificPrefix ? self.honorificPrefix : [NSNull null]) forKey:@"honorificPrefix"];
+        [dictionary setObject:(_honorificPrefix ? _honorificPrefix : [NSNull null]) forKey:@"honorificPrefix"];
 
     if ([self.dirtyPropertySet containsObject:@"honorificSuffix"])
-        [dictionary setObject:(self.honorificSuffix ? self.honorificSuffix : [NSNull null]) forKey:@"honorificSuffix"];
+        [dictionary setObject:(_honorificSuffix ? _honorificSuffix : [NSNull null]) forKey:@"honorificSuffix"];
 
     if ([self.dirtyPropertySet containsObject:@"middleName"])
-        [dictionary setObject:(self.middleName ? self.middleName : [NSNull null]) forKey:@"middleName"];
+        [dictionary setObject:(_middleName ? _middleName : [NSNull null]) forKey:@"middleName"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -335,12 +373,12 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.familyName ? self.familyName : [NSNull null]) forKey:@"familyName"];
-    [dictionary setObject:(self.formatted ? self.formatted : [NSNull null]) forKey:@"formatted"];
-    [dictionary setObject:(self.givenName ? self.givenName : [NSNull null]) forKey:@"givenName"];
-    [dictionary setObject:(self.honorificPrefix ? self.honorificPrefix : [NSNull null]) forKey:@"honorificPrefix"];
-    [dictionary setObject:(self.honorificSuffix ? self.honorificSuffix : [NSNull null]) forKey:@"honorificSuffix"];
-    [dictionary setObject:(self.middleName ? self.middleName : [NSNull null]) forKey:@"middleName"];
+    [dictionary setObject:(_familyName ? _familyName : [NSNull null]) forKey:@"familyName"];
+    [dictionary setObject:(_formatted ? _formatted : [NSNull null]) forKey:@"formatted"];
+    [dictionary setObject:(_givenName ? _givenName : [NSNull null]) forKey:@"givenName"];
+    [dictionary setObject:(_honorificPrefix ? _honorificPrefix : [NSNull null]) forKey:@"honorificPrefix"];
+    [dictionary setObject:(_honorificSuffix ? _honorificSuffix : [NSNull null]) forKey:@"honorificSuffix"];
+    [dictionary setObject:(_middleName ? _middleName : [NSNull null]) forKey:@"middleName"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -356,33 +394,58 @@
 
 - (BOOL)isEqualToName:(JRName *)otherName
 {
-    if (!self.familyName && !otherName.familyName) /* Keep going... */;
-    else if ((self.familyName == nil) ^ (otherName.familyName == nil)) return NO; // xor
-    else if (![self.familyName isEqualToString:otherName.familyName]) return NO;
+    if (!otherName) return NO;
+    if ([self hash] != [otherName hash]) return NO;
+
+    if (!_familyName && !otherName->_familyName) /* Keep going... */;
+    else if ((_familyName == nil) ^ (otherName->_familyName == nil)) return NO; // xor
+    else if (![_familyName isEqualToString:otherName->_familyName]) return NO;
 
-    if (!self.formatted && !otherName.formatted) /* Keep going... */;
-    else if ((self.formatted == nil) ^ (otherName.formatted == nil)) return NO; // xor
-    else if (![self.formatted isEqualToString:otherName.formatted]) return NO;
+    if (!_formatted && !otherName->_formatted) /* Keep going... */;
+    else if ((_formatted == nil) ^ (otherName->_formatted == nil)) return NO; // xor
+    else if (![_formatted isEqualToString:otherName->_formatted]) return NO;
 
-    if (!self.givenName && !otherName.givenName) /* Keep going... */;
-    else if ((self.givenName == nil) ^ (otherName.givenName == nil)) return NO; // xor
-    else if (![self.givenName isEqualToString:otherName.givenName]) return NO;
+    if (!_givenName && !otherName->_givenName) /* Keep going... */;
+    else if ((_givenName == nil) ^ (otherName->_givenName == nil)) return NO; // xor
+    else if (![_givenName isEqualToString:otherName->_givenName]) return NO;
 
-    if (!self.honorificPrefix && !otherName.honorificPrefix) /* Keep going... */;
-    else if ((self.honorificPrefix == nil) ^ (otherName.honorificPrefix == nil)) return NO; // xor
-    else if (![self.honorificPrefix isEqualToString:otherName.honorificPrefix]) return NO;
+    if (!_honorificPrefix && !otherName->_honorificPrefix) /* Keep going... */;
+    else if ((_honorificPrefix == nil) ^ (otherName->_honorificPrefix == nil)) return NO; // xor
+    else if (![_honorificPrefix isEqualToString:otherName->_honorificPrefix]) return NO;
 
-    if (!self.honorificSuffix && !otherName.honorificSuffix) /* Keep going... */;
-    else if ((self.honorificSuffix == nil) ^ (otherName.honorificSuffix == nil)) return NO; // xor
-    else if (![self.honorificSuffix isEqualToString:otherName.honorificSuffix]) return NO;
+    if (!_honorificSuffix && !otherName->_honorificSuffix) /* Keep going... */;
+    else if ((_honorificSuffix == nil) ^ (otherName->_honorificSuffix == nil)) return NO; // xor
+    else if (![_honorificSuffix isEqualToString:otherName->_honorificSuffix]) return NO;
 
-    if (!self.middleName && !otherName.middleName) /* Keep going... */;
-    else if ((self.middleName == nil) ^ (otherName.middleName == nil)) return NO; // xor
-    else if (![self.middleName isEqualToString:otherName.middleName]) return NO;
+    if (!_middleName && !otherName->_middleName) /* Keep going... */;
+    else if ((_middleName == nil) ^ (otherName->_middleName == nil)) return NO; // xor
+    else if (![_middleName isEqualToString:otherName->_middleName]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRName class]]) return NO;
+
+    return [self isEqualToName:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_familyName hash];
+    hash = hash * 31 + [_formatted hash];
+    hash = hash * 31 + [_givenName hash];
+    hash = hash * 31 + [_honorificPrefix hash];
+    hash = hash * 31 + [_honorificSuffix hash];
+    hash = hash * 31 + [_middleName hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -58,6 +58,7 @@
 
 - (void)setStatus:(JRBoolean *)newStatus
 {
+    [self willChangeProperty:@"status"];
     [self.dirtyPropertySet addObject:@"status"];
 
     _status = [newStatus copy];
@@ -70,6 +71,7 @@
 
 - (void)setStatusWithBool:(BOOL)boolVal
 {
+    [self willChangeProperty:@"status"];
     [self.dirtyPropertySet addObject:@"status"];
 
     _status = [NSNumber numberWithBool:boolVal];
@@ -82,6 +84,7 @@
 
 - (void)setUpdated:(JRDateTime *)newUpdated
 {
+    [self willChangeProperty:@"updated"];
     [self.dirtyPropertySet addObject:@"updated"];
 
     _updated = [newUpdated copy];
@@ -105,14 +108,39 @@
     return [[JROptIn alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROptIn *optInCopy = (JROptIn *)[super copyWithZone:zone];
+
+    optInCopy->_status = _status;
+    optInCopy->_updated = _updated;
+
+    return optInCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.status ? [NSNumber numberWithBool:[self.status boolValue]] : [NSNull null])
+    [dictionary setObject:(_status ? [NSNumber numberWithBool:[_status boolValue]] : [NSNull null])
                    forKey:@"status"];
-    [dictionary setObject:(self.updated ? [self.updated stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_updated ? [_updated stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"updated"];
 
     if (forEncoder)
@@ -190,6 +218,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -206,6 +235,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"optIn"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"optIn"] allObjects]];
 
@@ -217,10 +248,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"status"])
-        [dictionary setObject:(self.status ? [NSNumber numberWithBool:[self.status boolValue]] : [NSNull null]) forKey:@"status"];
+        [dictionary setObject:(_status ? [NSNumber numberWithBool:[_status boolValue]] : [NSNull null]) forKey:@"status"];
 
     if ([self.dirtyPropertySet containsObject:@"updated"])
-        [dictionary setObject:(self.updated ? [self.updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
+        [dictionary setObject:(_updated ? [_updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -236,8 +267,8 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.status ? [NSNumber numberWithBool:[self.status boolValue]] : [NSNull null]) forKey:@"status"];
-    [dictionary setObject:(self.updated ? [self.updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
+    [dictionary setObject:(_status ? [NSNumber numberWithBool:[_status boolValue]] : [NSNull null]) forKey:@"status"];
+    [dictionary setObject:(_updated ? [_updated stringFromISO8601DateTime] : [NSNull null]) forKey:@"updated"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -253,17 +284,38 @@
 
 - (BOOL)isEqualToOptIn:(JROptIn *)otherOptIn
 {
-    if (!self.status && !otherOptIn.status) /* Keep going... */;
-    else if ((self.status == nil) ^ (otherOptIn.status == nil)) return NO; // xor
-    else if (![self.status isEqualToNumber:otherOptIn.status]) return NO;
+    if (!otherOptIn) return NO;
+    if ([self hash] != [otherOptIn hash]) return NO;
+
+    if (!_status && !otherOptIn->_status) /* Keep going... */;
+    else if ((_status == nil) ^ (otherOptIn->_status == nil)) return NO; // xor
+    else if (![_status isEqualToNumber:otherOptIn->_status]) return NO;
 
-    if (!self.updated && !otherOptIn.updated) /* Keep going... */;
-    else if ((self.updated == nil) ^ (otherOptIn.updated == nil)) return NO; // xor
-    else if (![self.updated isEqualToDate:otherOptIn.updated]) return NO;
+    if (!_updated && !otherOptIn->_updated) /* Keep going... */;
+    else if ((_updated == nil) ^ (otherOptIn->_updated == nil)) return NO; // xor
+    else if (![_updated isEqualToDate:otherOptIn->_updated]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROptIn class]]) return NO;
+
+    return [self isEqualToOptIn:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_status hash];
+    hash = hash * 31 + [_updated hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -70,6 +70,7 @@
 
 - (void)setDepartment:(NSString *)newDepartment
 {
+    [self willChangeProperty:@"department"];
     [self.dirtyPropertySet addObject:@"department"];
 
     _department = [newDepartment copy];
@@ -82,6 +83,7 @@
 
 - (void)setDescription:(NSString *)newDescription
 {
+    [self willChangeProperty:@"description"];
     [self.dirtyPropertySet addObject:@"description"];
 
     _description = [newDescription copy];
@@ -94,6 +96,7 @@
 
 - (void)setEndDate:(NSString *)newEndDate
 {
+    [self willChangeProperty:@"endDate"];
     [self.dirtyPropertySet addObject:@"endDate"];
 
     _endDate = [newEndDate copy];
@@ -101,14 +104,18 @@
 
 - (JRLocation *)location
 {
+    if ([self.sharedPropertySet containsObject:@"location"])
+        [self unshareProperty:@"location"];
+
     return _location;
 }
 
 - (void)setLocation:(JRLocation *)newLocation
 {
+    [self willChangeProperty:@"location"];
     [self.dirtyPropertySet addObject:@"location"];
 
-    _location = newLocation;
+    _location = [self claimValue:newLocation forProperty:@"location"];
 
     [_location setAllPropertiesToDirty];
 }
@@ -120,6 +127,7 @@
 
 - (void)setName:(NSString *)newName
 {
+    [self willChangeProperty:@"name"];
     [self.dirtyPropertySet addObject:@"name"];
 
     _name = [newName copy];
@@ -132,6 +140,7 @@
 
 - (void)setPrimary:(JRBoolean *)newPrimary
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [newPrimary copy];
@@ -144,6 +153,7 @@
 
 - (void)setPrimaryWithBool:(BOOL)boolVal
 {
+    [self willChangeProperty:@"primary"];
     [self.dirtyPropertySet addObject:@"primary"];
 
     _primary = [NSNumber numberWithBool:boolVal];
@@ -156,6 +166,7 @@
 
 - (void)setStartDate:(NSString *)newStartDate
 {
+    [self willChangeProperty:@"startDate"];
     [self.dirtyPropertySet addObject:@"startDate"];
 
     _startDate = [newStartDate copy];
@@ -168,6 +179,7 @@
 
 - (void)setTitle:(NSString *)newTitle
 {
+    [self willChangeProperty:@"title"];
     [self.dirtyPropertySet addObject:@"title"];
 
     _title = [newTitle copy];
@@ -180,6 +192,7 @@
 
 - (void)setType:(NSString *)newType
 {
+    [self willChangeProperty:@"type"];
     [self.dirtyPropertySet addObject:@"type"];
 
     _type = [newType copy];
@@ -192,7 +205,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _location = [[JRLocation alloc] init];
+        _location = [self claimValue:[[JRLocation alloc] init] forProperty:@"location"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -204,28 +217,62 @@
     return [[JROrganizationsElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROrganizationsElement *organizationsElementCopy = (JROrganizationsElement *)[super copyWithZone:zone];
+
+    organizationsElementCopy->_department = _department;
+    organizationsElementCopy->_description = _description;
+    organizationsElementCopy->_endDate = _endDate;
+    organizationsElementCopy->_location = _location;
+    organizationsElementCopy->_name = _name;
+    organizationsElementCopy->_primary = _primary;
+    organizationsElementCopy->_startDate = _startDate;
+    organizationsElementCopy->_title = _title;
+    organizationsElementCopy->_type = _type;
+
+    return organizationsElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"location", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"location"]) return _location;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"location"]) _location = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.department ? self.department : [NSNull null])
+    [dictionary setObject:(_department ? _department : [NSNull null])
                    forKey:@"department"];
-    [dictionary setObject:(self.description ? self.description : [NSNull null])
+    [dictionary setObject:(_description ? _description : [NSNull null])
                    forKey:@"description"];
-    [dictionary setObject:(self.endDate ? self.endDate : [NSNull null])
+    [dictionary setObject:(_endDate ? _endDate : [NSNull null])
                    forKey:@"endDate"];
-    [dictionary setObject:(self.location ? [self.location newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_location ? [_location newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"location"];
-    [dictionary setObject:(self.name ? self.name : [NSNull null])
+    [dictionary setObject:(_name ? _name : [NSNull null])
                    forKey:@"name"];
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null])
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null])
                    forKey:@"primary"];
-    [dictionary setObject:(self.startDate ? self.startDate : [NSNull null])
+    [dictionary setObject:(_startDate ? _startDate : [NSNull null])
                    forKey:@"startDate"];
-    [dictionary setObject:(self.title ? self.title : [NSNull null])
+    [dictionary setObject:(_title ? _title : [NSNull null])
                    forKey:@"title"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null])
+    [dictionary setObject:(_type ? _type : [NSNull null])
                    forKey:@"type"];
 
     if (forEncoder)
@@ -369,6 +416,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -380,8 +428,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"organizationsElement"];
 
-    if (self.location)
-        [snapshotDictionary setObject:[self.location snapshotDictionaryFromDirtyPropertySet]
+    if (_location)
+        [snapshotDictionary setObject:[_location snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"location"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -389,6 +437,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"organizationsElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"organizationsElement"] allObjects]];
 
@@ -404,37 +454,37 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"department"])
-        [dictionary setObject:(self.department ? self.department : [NSNull null]) forKey:@"department"];
+        [dictionary setObject:(_department ? _department : [NSNull null]) forKey:@"department"];
 
     if ([self.dirtyPropertySet containsObject:@"description"])
-        [dictionary setObject:(self.description ? self.description : [NSNull null]) forKey:@"description"];
+        [dictionary setObject:(_description ? _description : [NSNull null]) forKey:@"description"];
 
     if ([self.dirtyPropertySet containsObject:@"endDate"])
-        [dictionary setObject:(self.endDate ? self.endDate : [NSNull null]) forKey:@"endDate"];
+        [dictionary setObject:(_endDate ? _endDate : [NSNull null]) forKey:@"endDate"];
 
     if ([self.dirtyPropertySet containsObject:@"location"])
-        [dictionary setObject:(self.location ?
-                              [self.location toUpdateDictionary] :
+        [dictionary setObject:(_location ?
+                              [_location toUpdateDictionary] :
                               [[JRLocation location] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"location"];
-    else if ([self.location needsUpdate])
-        [dictionary setObject:[self.location toUpdateDictionary]
+    else if ([_location needsUpdate])
+        [dictionary setObject:[_location toUpdateDictionary]
                        forKey:@"location"];
 
     if ([self.dirtyPropertySet containsObject:@"name"])
-        [dictionary setObject:(self.name ? self.name : [NSNull null]) forKey:@"name"];
+        [dictionary setObject:(_name ? _name : [NSNull null]) forKey:@"name"];
 
     if ([self.dirtyPropertySet containsObject:@"primary"])
-        [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
+        [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
 
     if ([self.dirtyPropertySet containsObject:@"startDate"])
-        [dictionary setObject:(self.startDate ? self.startDate : [NSNull null]) forKey:@"startDate"];
+        [dictionary setObject:(_startDate ? _startDate : [NSNull null]) forKey:@"startDate"];
 
     if ([self.dirtyPropertySet containsObject:@"title"])
-        [dictionary setObject:(self.title ? self.title : [NSNull null]) forKey:@"title"];
+        [dictionary setObject:(_title ? _title : [NSNull null]) forKey:@"title"];
 
     if ([self.dirtyPropertySet containsObject:@"type"])
-        [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+        [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -450,19 +500,19 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.department ? self.department : [NSNull null]) forKey:@"department"];
-    [dictionary setObject:(self.description ? self.description : [NSNull null]) forKey:@"description"];
-    [dictionary setObject:(self.endDate ? self.endDate : [NSNull null]) forKey:@"endDate"];
+    [dictionary setObject:(_department ? _department : [NSNull null]) forKey:@"department"];
+    [dictionary setObject:(_description ? _description : [NSNull null]) forKey:@"description"];
+    [dictionary setObject:(_endDate ? _endDate : [NSNull null]) forKey:@"endDate"];
 
-    [dictionary setObject:(self.location ?
-                          [self.location toReplaceDictionary] :
+    [dictionary setObject:(_location ?
+                          [_location toReplaceDictionary] :
                           [[JRLocation location] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"location"];
-    [dictionary setObject:(self.name ? self.name : [NSNull null]) forKey:@"name"];
-    [dictionary setObject:(self.primary ? [NSNumber numberWithBool:[self.primary boolValue]] : [NSNull null]) forKey:@"primary"];
-    [dictionary setObject:(self.startDate ? self.startDate : [NSNull null]) forKey:@"startDate"];
-    [dictionary setObject:(self.title ? self.title : [NSNull null]) forKey:@"title"];
-    [dictionary setObject:(self.type ? self.type : [NSNull null]) forKey:@"type"];
+    [dictionary setObject:(_name ? _name : [NSNull null]) forKey:@"name"];
+    [dictionary setObject:(_primary ? [NSNumber numberWithBool:[_primary boolValue]] : [NSNull null]) forKey:@"primary"];
+    [dictionary setObject:(_startDate ? _startDate : [NSNull null]) forKey:@"startDate"];
+    [dictionary setObject:(_title ? _title : [NSNull null]) forKey:@"title"];
+    [dictionary setObject:(_type ? _type : [NSNull null]) forKey:@"type"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -473,7 +523,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.location needsUpdate])
+    if ([_location needsUpdate])
         return YES;
 
     return NO;
@@ -481,46 +531,74 @@
 
 - (BOOL)isEqualToOrganizationsElement:(JROrganizationsElement *)otherOrganizationsElement
 {
-    if (!self.department && !otherOrganizationsElement.department) /* Keep going... */;
-    else if ((self.department == nil) ^ (otherOrganizationsElement.department == nil)) return NO; // xor
-    else if (![self.department isEqualToString:otherOrganizationsElement.department]) return NO;
+    if (!otherOrganizationsElement) return NO;
+    if ([self hash] != [otherOrganizationsElement hash]) return NO;
+
+    if (!_department && !otherOrganizationsElement->_department) /* Keep going... */;
+    else if ((_department == nil) ^ (otherOrganizationsElement->_department == nil)) return NO; // xor
+    else if (![_department isEqualToString:otherOrganizationsElement->_department]) return NO;
 
-    if (!self.description && !otherOrganizationsElement.description) /* Keep going... */;
-    else if ((self.description == nil) ^ (otherOrganizationsElement.description == nil)) return NO; // xor
-    else if (![self.description isEqualToString:otherOrganizationsElement.description]) return NO;
+    if (!_description && !otherOrganizationsElement->_description) /* Keep going... */;
+    else if ((_description == nil) ^ (otherOrganizationsElement->_description == nil)) return NO; // xor
+    else if (![_description isEqualToString:otherOrganizationsElement->_description]) return NO;
 
-    if (!self.endDate && !otherOrganizationsElement.endDate) /* Keep going... */;
-    else if ((self.endDate == nil) ^ (otherOrganizationsElement.endDate == nil)) return NO; // xor
-    else if (![self.endDate isEqualToString:otherOrganizationsElement.endDate]) return NO;
+    if (!_endDate && !otherOrganizationsElement->_endDate) /* Keep going... */;
+    else if ((_endDate == nil) ^ (otherOrganizationsElement->_endDate == nil)) return NO; // xor
+    else if (![_endDate isEqualToString:otherOrganizationsElement->_endDate]) return NO;
 
-    if (!self.location && !otherOrganizationsElement.location) /* Keep going... */;
-    else if (!self.location && [otherOrganizationsElement.location isEqualToLocation:[JRLocation location]]) /* Keep going... */;
-    else if (!otherOrganizationsElement.location && [self.location isEqualToLocation:[JRLocation location]]) /* Keep going... */;
-    else if (![self.location isEqualToLocation:otherOrganizationsElement.location]) return NO;
+    if (!_location && !otherOrganizationsElement->_location) /* Keep going... */;
+    else if (!_location && [otherOrganizationsElement->_location isEqualToLocation:[JRLocation location]]) /* Keep going... */;
+    else if (!otherOrganizationsElement->_location && [_location isEqualToLocation:[JRLocation location]]) /* Keep going... */;
+    else if (![_location isEqualToLocation:otherOrganizationsElement->_location]) return NO;
 
-    if (!self.name && !otherOrganizationsElement.name) /* Keep going... */;
-    else if ((self.name == nil) ^ (otherOrganizationsElement.name == nil)) return NO; // xor
-    else if (![self.name isEqualToString:otherOrganizationsElement.name]) return NO;
+    if (!_name && !otherOrganizationsElement->_name) /* Keep going... */;
+    else if ((_name == nil) ^ (otherOrganizationsElement->_name == nil)) return NO; // xor
+    else if (![_name isEqualToString:otherOrganizationsElement->_name]) return NO;
 
-    if (!self.primary && !otherOrganizationsElement.primary) /* Keep going... */;
-    else if ((self.primary == nil) ^ (otherOrganizationsElement.primary == nil)) return NO; // xor
-    else if (![self.primary isEqualToNumber:otherOrganizationsElement.primary]) return NO;
+    if (!_primary && !otherOrganizationsElement->_primary) /* Keep going... */;
+    else if ((_primary == nil) ^ (otherOrganizationsElement->_primary == nil)) return NO; // xor
+    else if (![_primary isEqualToNumber:otherOrganizationsElement->_primary]) return NO;
 
-    if (!self.startDate && !otherOrganizationsElement.startDate) /* Keep going... */;
-    else if ((self.startDate == nil) ^ (otherOrganizationsElement.startDate == nil)) return NO; // xor
-    else if (![self.startDate isEqualToString:otherOrganizationsElement.startDate]) return NO;
+    if (!_startDate && !otherOrganizationsElement->_startDate) /* Keep going... */;
+    else if ((_startDate == nil) ^ (otherOrganizationsElement->_startDate == nil)) return NO; // xor
+    else if (![_startDate isEqualToString:otherOrganizationsElement->_startDate]) return NO;
 
-    if (!self.title && !otherOrganizationsElement.title) /* Keep going... */;
-    else if ((self.title == nil) ^ (otherOrganizationsElement.title == nil)) return NO; // xor
-    else if (![self.title isEqualToString:otherOrganizationsElement.title]) return NO;
+    if (!_title && !otherOrganizationsElement->_title) /* Keep going... */;
+    else if ((_title == nil) ^ (otherOrganizationsElement->_title == nil)) return NO; // xor
+    else if (![_title isEqualToString:otherOrganizationsElement->_title]) return NO;
 
-    if (!self.type && !otherOrganizationsElement.type) /* Keep going... */;
-    else if ((self.type == nil) ^ (otherOrganizationsElement.type == nil)) return NO; // xor
-    else if (![self.type isEqualToString:otherOrganizationsElement.type]) return NO;
+    if (!_type && !otherOrganizationsElement->_type) /* Keep going... */;
+    else if ((_type == nil) ^ (otherOrganizationsElement->_type == nil)) return NO; // xor
+    else if (![_type isEqualToString:otherOrganizationsElement->_type]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROrganizationsElement class]]) return NO;
+
+    return [self isEqualToOrganizationsElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_department hash];
+    hash = hash * 31 + [_description hash];
+    hash = hash * 31 + [_endDate hash];
+    hash = hash * 31 + [_location hash];
+    hash = hash * 31 + [_name hash];
+    hash = hash * 31 + [_primary hash];
+    hash = hash * 31 + [_startDate hash];
+    hash = hash * 31 + [_title hash];
+    hash = hash * 31 + [_type hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
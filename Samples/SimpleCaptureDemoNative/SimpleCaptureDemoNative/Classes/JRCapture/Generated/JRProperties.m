@@ -57,6 +57,8 @@
 
 - (void)setManagedBy:(JRStringArray *)newManagedBy
 {
+    [self willChangeProperty:@"managedBy"];
+
     _managedBy = [newManagedBy copy];
 }
 
@@ -78,12 +80,36 @@
     return [[JRProperties alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRProperties *propertiesCopy = (JRProperties *)[super copyWithZone:zone];
+
+    propertiesCopy->_managedBy = _managedBy;
+
+    return propertiesCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.managedBy ? self.managedBy : [NSNull null])
+    [dictionary setObject:(_managedBy ? _managedBy : [NSNull null])
                    forKey:@"managedBy"];
 
     if (forEncoder)
@@ -153,6 +179,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -169,6 +196,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"properties"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"properties"] allObjects]];
 
@@ -194,8 +223,8 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
 
-    [dictionary setObject:(self.managedBy ?
-                          self.managedBy :
+    [dictionary setObject:(_managedBy ?
+                          _managedBy :
                           [NSArray array])
                    forKey:@"managedBy"];
 
@@ -219,14 +248,34 @@
 
 - (BOOL)isEqualToProperties:(JRProperties *)otherProperties
 {
-    if (!self.managedBy && !otherProperties.managedBy) /* Keep going... */;
-    else if (!self.managedBy && ![otherProperties.managedBy count]) /* Keep going... */;
-    else if (!otherProperties.managedBy && ![self.managedBy count]) /* Keep going... */;
-    else if (![self.managedBy isEqualToArray:otherProperties.managedBy]) return NO;
+    if (!otherProperties) return NO;
+    if ([self hash] != [otherProperties hash]) return NO;
+
+    if (!_managedBy && !otherProperties->_managedBy) /* Keep going... */;
+    else if (!_managedBy && ![otherProperties->_managedBy count]) /* Keep going... */;
+    else if (!otherProperties->_managedBy && ![_managedBy count]) /* Keep going... */;
+    else if (![_managedBy isEqualToArray:otherProperties->_managedBy]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRProperties class]]) return NO;
+
+    return [self isEqualToProperties:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_managedBy hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -0,0 +1,173 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRBenchmarkRecordGenerator.h"
+
+@interface JRBenchmarkRecordGenerator ()
+@property(nonatomic, strong) NSArray *attrDefs;
+@end
+
+@implementation JRBenchmarkRecordGenerator
+@synthesize attrDefs;
+
+- (id)initWithSchemaAttributes:(NSArray *)attrDefs_
+{
+    if ((self = [super init]))
+    {
+        self.attrDefs = attrDefs_;
+    }
+
+    return self;
+}
+
+- (id)valueForAttribute:(NSDictionary *)attrDef index:(NSUInteger)index pluralCount:(NSUInteger)pluralCount
+                  depth:(NSUInteger)depth
+{
+    NSString *type = [attrDef objectForKey:@"type"];
+    NSString *name = [attrDef objectForKey:@"name"];
+
+    if ([type isEqualToString:@"string"] || [type isEqualToString:@"uuid"] || [type isEqualToString:@"ipAddress"])
+        return [NSString stringWithFormat:@"%@ value %lu", name, (unsigned long) index];
+    else if ([type hasPrefix:@"password"])
+        return [NSString stringWithFormat:@"$2a$10$%040lu", (unsigned long) index];
+    else if ([type isEqualToString:@"boolean"])
+        return [NSNumber numberWithBool:(index % 2 == 0)];
+    else if ([type isEqualToString:@"integer"] || [type isEqualToString:@"id"])
+        return [NSNumber numberWithUnsignedInteger:index + 1];
+    else if ([type isEqualToString:@"decimal"])
+        return [NSNumber numberWithDouble:index + 0.25];
+    else if ([type isEqualToString:@"date"])
+        return [NSString stringWithFormat:@"19%02lu-%02lu-%02lu", (unsigned long) (50 + index % 50),
+                                          (unsigned long) (1 + index % 12), (unsigned long) (1 + index % 28)];
+    else if ([type isEqualToString:@"dateTime"])
+        return [NSString stringWithFormat:@"2013-%02lu-%02lu 12:%02lu:%02lu.%06lu +0000", (unsigned long) (1 + index % 12),
+                                          (unsigned long) (1 + index % 28), (unsigned long) (index % 60),
+                                          (unsigned long) ((index * 7) % 60), (unsigned long) ((index * 7919) % 1000000)];
+    else if ([type isEqualToString:@"json"])
+        return [NSDictionary dictionaryWithObjectsAndKeys:
+                                     name, @"name",
+                                     [NSNumber numberWithUnsignedInteger:index], @"index",
+                                     [NSArray arrayWithObjects:@"a", @"b", @"c", nil], @"list", nil];
+    else if ([type isEqualToString:@"object"])
+        return [self objectForAttributes:[attrDef objectForKey:@"attr_defs"] index:index pluralCount:pluralCount
+                                   depth:depth + 1];
+    else if ([type isEqualToString:@"plural"])
+        return [self pluralForAttributes:[attrDef objectForKey:@"attr_defs"] pluralCount:pluralCount depth:depth + 1];
+
+    return [NSNull null];
+}
+
+- (NSMutableDictionary *)objectForAttributes:(NSArray *)attributes index:(NSUInteger)index
+                                 pluralCount:(NSUInteger)pluralCount depth:(NSUInteger)depth
+{
+    NSMutableDictionary *object = [NSMutableDictionary dictionaryWithCapacity:[attributes count]];
+
+    for (NSDictionary *attrDef in attributes)
+        [object setObject:[self valueForAttribute:attrDef index:index pluralCount:pluralCount depth:depth]
+                   forKey:[attrDef objectForKey:@"name"]];
+
+    return object;
+}
+
+- (NSArray *)pluralForAttributes:(NSArray *)attributes pluralCount:(NSUInteger)pluralCount depth:(NSUInteger)depth
+{
+    NSUInteger count = depth > 1 ? MAX(pluralCount / 10, (NSUInteger) 1) : pluralCount;
+    NSUInteger nestedCount = depth > 1 ? count : pluralCount;
+    NSMutableArray *plural = [NSMutableArray arrayWithCapacity:count];
+
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        NSMutableDictionary *element = [self objectForAttributes:attributes index:i pluralCount:nestedCount
+                                                           depth:depth];
+        [element setObject:[NSNumber numberWithUnsignedInteger:i + 1] forKey:@"id"];
+        [plural addObject:element];
+    }
+
+    return plural;
+}
+
+- (NSDictionary *)recordWithPluralCount:(NSUInteger)pluralCount
+{
+    NSMutableDictionary *record = [self objectForAttributes:self.attrDefs index:0 pluralCount:pluralCount depth:0];
+
+    [record setObject:[NSNumber numberWithUnsignedInteger:1] forKey:@"id"];
+    [record setObject:@"4d8d9e2c-3f39-4b7e-9a25-0c1d2e3f4a5b" forKey:@"uuid"];
+    [record setObject:@"2013-01-01 00:00:00.000000 +0000" forKey:@"created"];
+    [record setObject:@"2013-06-01 12:00:00.000000 +0000" forKey:@"lastUpdated"];
+
+    return record;
+}
+
+- (void)addFieldsForAttributes:(NSArray *)attributes pathPrefix:(NSString *)prefix
+                      toFields:(NSMutableDictionary *)fields names:(NSMutableArray *)names
+{
+    for (NSDictionary *attrDef in attributes)
+    {
+        NSString *type = [attrDef objectForKey:@"type"];
+        NSString *schemaId = [prefix stringByAppendingString:[attrDef objectForKey:@"name"]];
+        NSString *fieldName = [schemaId stringByReplacingOccurrencesOfString:@"." withString:@"_"];
+
+        if ([type isEqualToString:@"object"])
+        {
+            [self addFieldsForAttributes:[attrDef objectForKey:@"attr_defs"]
+                              pathPrefix:[schemaId stringByAppendingString:@"."] toFields:fields names:names];
+            continue;
+        }
+
+        NSString *fieldType;
+        if ([type isEqualToString:@"string"])
+            fieldType = @"text";
+        else if ([type isEqualToString:@"date"])
+            fieldType = @"dateselect";
+        else
+            continue;
+
+        [fields setObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                schemaId, @"schemaId",
+                                                fieldType, @"type", nil]
+                   forKey:fieldName];
+        [names addObject:fieldName];
+    }
+}
+
+- (NSDictionary *)flowDictionaryWithFormName:(NSString *)formName
+{
+    NSMutableDictionary *fields = [NSMutableDictionary dictionary];
+    NSMutableArray *names = [NSMutableArray array];
+
+    [self addFieldsForAttributes:self.attrDefs pathPrefix:@"" toFields:fields names:names];
+    [fields setObject:[NSDictionary dictionaryWithObjectsAndKeys:names, @"fields", nil] forKey:formName];
+
+    return [NSDictionary dictionaryWithObjectsAndKeys:
+                                 fields, @"fields",
+                                 @"benchmark", @"version", nil];
+}
+@end
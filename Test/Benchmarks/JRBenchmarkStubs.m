@@ -0,0 +1,118 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* The model classes reach for the network and session layers when asked to update, replace or fetch themselves.
+   The benchmark never does that, so these stand in for the UIKit-bound implementations just enough to link. */
+
+#import "JRCaptureData.h"
+#import "JRCaptureApidInterface.h"
+#import "JRCaptureError.h"
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wincomplete-implementation"
+#pragma clang diagnostic ignored "-Wprotocol"
+#pragma clang diagnostic ignored "-Wobjc-protocol-property-synthesis"
+
+@implementation JRCaptureData
++ (JRCaptureData *)sharedCaptureData
+{
+    static JRCaptureData *singleton = nil;
+    if (!singleton) singleton = [[JRCaptureData alloc] init];
+
+    return singleton;
+}
+
++ (void)setLinkedProfiles:(NSArray *)profileData
+{
+}
+
+- (NSString *)accessToken
+{
+    return nil;
+}
+
+- (JRCaptureFlow *)captureFlow
+{
+    return nil;
+}
+@end
+
+@implementation JRCaptureApidInterface
++ (void)getCaptureUserWithToken:(NSString *)token forDelegate:(id <JRCaptureInternalDelegate>)delegate
+                    withContext:(NSObject *)context
+{
+}
+
++ (void)updateCaptureObject:(NSDictionary *)captureObject atPath:(NSString *)entityPath withToken:(NSString *)token
+                forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
+{
+}
+
++ (void)replaceCaptureObject:(NSDictionary *)captureObject atPath:(NSString *)entityPath withToken:(NSString *)token
+                 forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
+{
+}
+
++ (void)replaceCaptureArray:(NSArray *)captureArray atPath:(NSString *)entityPath withToken:(NSString *)token
+                forDelegate:(id <JRCaptureInternalDelegate>)delegate withContext:(NSObject *)context
+{
+}
+@end
+
+@implementation JRCaptureError
+@end
+
+@implementation JRCaptureError (JRCaptureError_Builders)
++ (JRCaptureError *)errorFromResult:(NSDictionary *)result onProvider:(NSString *)onProvider
+                        engageToken:(NSString *)engageToken
+{
+    return nil;
+}
+@end
+
+@implementation JRCaptureError (JRCaptureError_Helpers)
++ (NSDictionary *)invalidClassErrorDictForResult:(NSObject *)result
+{
+    return nil;
+}
+
++ (NSDictionary *)invalidStatErrorDictForResult:(NSObject *)result
+{
+    return nil;
+}
+
++ (NSDictionary *)invalidDataErrorDictForResult:(NSObject *)result
+{
+    return nil;
+}
+@end
+
+#pragma clang diagnostic pop
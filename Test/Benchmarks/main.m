@@ -0,0 +1,408 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* A headless, Foundation-only benchmark of the Capture model layer. It builds synthetic records from a Capture
+   schema at several sizes and times each CPU-bound step a record goes through on its way in and out of the library,
+   then prints the results, and the library's own stage counters, as a single JSON document. See README.md. */
+
+#import <Foundation/Foundation.h>
+#import "JRBenchmarkRecordGenerator.h"
+#import "JRCaptureUser+Extras.h"
+#import "JRCaptureObject+Internal.h"
+#import "JRCaptureFlow.h"
+#import "JRIncrementalJsonParser.h"
+#import "JRNSDate+ISO8601_CaptureDateTimeString.h"
+#import "JRStageMetrics.h"
+#import "JRBase64.h"
+#import "JRLegacyBase64.h"
+#import "JRRequestBodyEncoder.h"
+
+#define JRBenchmarkWarmupIterations 3
+#define JRBenchmarkDateBatchSize 1000
+#define JRBenchmarkBase64BatchSize 100
+
+/* Stands in for a real access token, which is what entity.replace bodies carry alongside the attributes */
+static NSString *const JRBenchmarkAccessToken = @"abcdefghijklmnopqrstuvwxyz012345";
+
+static NSString *const JRBenchmarkFormName = @"benchmarkForm";
+
+@interface JRCaptureUser (JRBenchmark)
+- (BOOL)isEqualToCaptureUser:(JRCaptureUser *)otherCaptureUser;
+@end
+
+typedef void (^JRBenchmarkBlock)(void);
+
+static uint64_t JRBenchmarkNow(void)
+{
+    /* Same monotonic clock the stage counters use, so the two sets of numbers line up */
+    return JRStageMetricsNow();
+}
+
+static NSComparisonResult JRCompareNumbers(id a, id b, void *context)
+{
+    return [(NSNumber *) a compare:(NSNumber *) b];
+}
+
+static NSDictionary *JRRunBenchmark(NSString *operation, NSUInteger pluralCount, NSUInteger iterations,
+                                    JRBenchmarkBlock setUp, JRBenchmarkBlock block)
+{
+    NSMutableArray *samples = [NSMutableArray arrayWithCapacity:iterations];
+    uint64_t total = 0;
+
+    for (NSUInteger i = 0; i < JRBenchmarkWarmupIterations + iterations; i++)
+    {
+        @autoreleasepool
+        {
+            if (setUp) setUp();
+
+            uint64_t start = JRBenchmarkNow();
+            block();
+            uint64_t elapsed = JRBenchmarkNow() - start;
+
+            if (i < JRBenchmarkWarmupIterations) continue;
+
+            total += elapsed;
+            [samples addObject:[NSNumber numberWithUnsignedLongLong:elapsed]];
+        }
+    }
+
+    NSArray *sorted = [samples sortedArrayUsingFunction:JRCompareNumbers context:NULL];
+    NSUInteger count = [sorted count];
+
+    return [NSDictionary dictionaryWithObjectsAndKeys:
+                                 operation, @"operation",
+                                 [NSNumber numberWithUnsignedInteger:pluralCount], @"pluralCount",
+                                 [NSNumber numberWithUnsignedInteger:count], @"iterations",
+                                 [sorted objectAtIndex:0], @"minNanoseconds",
+                                 [sorted objectAtIndex:count / 2], @"medianNanoseconds",
+                                 [sorted objectAtIndex:MIN(count - 1, count * 95 / 100)], @"p95Nanoseconds",
+                                 [sorted lastObject], @"maxNanoseconds",
+                                 [NSNumber numberWithUnsignedLongLong:total / count], @"meanNanoseconds", nil];
+}
+
+static NSArray *JRBenchmarkRecord(JRBenchmarkRecordGenerator *generator, JRCaptureFlow *flow,
+                                  NSUInteger pluralCount, NSUInteger iterations)
+{
+    NSMutableArray *results = [NSMutableArray array];
+    NSDictionary *record = [generator recordWithPluralCount:pluralCount];
+    NSData *recordData = [NSJSONSerialization dataWithJSONObject:record options:0 error:nil];
+
+    __block id sink = nil;
+    JRCaptureUser *user = [JRCaptureUser captureUserObjectFromDictionary:record];
+    JRCaptureUser *userCopy = [user copy];
+    NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:user];
+
+    [results addObject:JRRunBenchmark(@"json_parse", pluralCount, iterations, nil, ^{
+        sink = [NSJSONSerialization JSONObjectWithData:recordData options:0 error:nil];
+    })];
+
+    /* The same record fed to the incremental parser in 16 KB pieces, as JRURLSessionDelegate gets it off the wire */
+    [results addObject:JRRunBenchmark(@"json_parse_incremental", pluralCount, iterations, nil, ^{
+        sink = [JRIncrementalJsonParser JSONObjectWithData:recordData chunkSize:16384 error:nil];
+    })];
+
+    [results addObject:JRRunBenchmark(@"parse_to_model", pluralCount, iterations, nil, ^{
+        sink = [JRCaptureUser captureUserObjectFromDictionary:record];
+    })];
+
+    /* A freshly built user has nothing dirty, which would make the update dictionary trivially empty */
+    [results addObject:JRRunBenchmark(@"update_dictionary", pluralCount, iterations, ^{
+        [user setAllPropertiesToDirty];
+    }, ^{
+        sink = [user toUpdateDictionary];
+    })];
+
+    [results addObject:JRRunBenchmark(@"replace_dictionary", pluralCount, iterations, nil, ^{
+        sink = [user toReplaceDictionary];
+    })];
+
+    [results addObject:JRRunBenchmark(@"equality", pluralCount, iterations, nil, ^{
+        sink = [NSNumber numberWithBool:[user isEqualToCaptureUser:userCopy]];
+    })];
+
+    [results addObject:JRRunBenchmark(@"copy", pluralCount, iterations, nil, ^{
+        sink = [user copy];
+    })];
+
+    [results addObject:JRRunBenchmark(@"archive", pluralCount, iterations, nil, ^{
+        sink = [NSKeyedArchiver archivedDataWithRootObject:user];
+    })];
+
+    [results addObject:JRRunBenchmark(@"unarchive", pluralCount, iterations, nil, ^{
+        sink = [NSKeyedUnarchiver unarchiveObjectWithData:archive];
+    })];
+
+    [results addObject:JRRunBenchmark(@"form_fields", pluralCount, iterations, nil, ^{
+        sink = [user toFormFieldsForForm:JRBenchmarkFormName withFlow:flow];
+    })];
+
+    for (NSUInteger i = 0; i < [results count]; i++)
+    {
+        NSMutableDictionary *result = [[results objectAtIndex:i] mutableCopy];
+        [result setObject:[NSNumber numberWithUnsignedInteger:[recordData length]] forKey:@"recordBytes"];
+        [results replaceObjectAtIndex:i withObject:result];
+    }
+
+    return results;
+}
+
+/* The entity.replace body of a whole record in each encoding JRRequestBodyEncoder can send: the time to build it,
+   and its size on the wire */
+static NSArray *JRBenchmarkRequestBodies(JRBenchmarkRecordGenerator *generator, NSUInteger pluralCount,
+                                         NSUInteger iterations)
+{
+    JRCaptureUser *user = [JRCaptureUser captureUserObjectFromDictionary:[generator recordWithPluralCount:pluralCount]];
+    NSDictionary *params = [NSDictionary dictionaryWithObjectsAndKeys:
+                                                 [user toReplaceDictionary], @"attributes",
+                                                 JRBenchmarkAccessToken, @"access_token",
+                                                 @"true", @"include_record", nil];
+
+    NSMutableArray *results = [NSMutableArray array];
+    NSMutableArray *bodySizes = [NSMutableArray array];
+    __block NSData *sink = nil;
+
+    [results addObject:JRRunBenchmark(@"body_form", pluralCount, iterations, nil, ^{
+        sink = [JRRequestBodyEncoder formBodyWithParams:params];
+    })];
+    [bodySizes addObject:[NSNumber numberWithUnsignedInteger:[sink length]]];
+
+    [results addObject:JRRunBenchmark(@"body_form_gzip", pluralCount, iterations, nil, ^{
+        sink = [JRRequestBodyEncoder gzipData:[JRRequestBodyEncoder formBodyWithParams:params]];
+    })];
+    [bodySizes addObject:[NSNumber numberWithUnsignedInteger:[sink length]]];
+
+    [results addObject:JRRunBenchmark(@"body_json", pluralCount, iterations, nil, ^{
+        sink = [JRRequestBodyEncoder jsonBodyWithParams:params];
+    })];
+    [bodySizes addObject:[NSNumber numberWithUnsignedInteger:[sink length]]];
+
+    [results addObject:JRRunBenchmark(@"body_json_gzip", pluralCount, iterations, nil, ^{
+        sink = [JRRequestBodyEncoder gzipData:[JRRequestBodyEncoder jsonBodyWithParams:params]];
+    })];
+    [bodySizes addObject:[NSNumber numberWithUnsignedInteger:[sink length]]];
+
+    for (NSUInteger i = 0; i < [results count]; i++)
+    {
+        NSMutableDictionary *result = [[results objectAtIndex:i] mutableCopy];
+        [result setObject:[bodySizes objectAtIndex:i] forKey:@"bodyBytes"];
+        [results replaceObjectAtIndex:i withObject:result];
+    }
+
+    return results;
+}
+
+static NSArray *JRBenchmarkDates(NSUInteger iterations)
+{
+    NSMutableArray *dateTimes = [NSMutableArray arrayWithCapacity:JRBenchmarkDateBatchSize];
+    NSMutableArray *dates = [NSMutableArray arrayWithCapacity:JRBenchmarkDateBatchSize];
+
+    for (NSUInteger i = 0; i < JRBenchmarkDateBatchSize; i++)
+    {
+        [dateTimes addObject:[NSString stringWithFormat:@"2013-%02lu-%02lu %02lu:%02lu:%02lu.%06lu +0000",
+                                                        (unsigned long) (1 + i % 12), (unsigned long) (1 + i % 28),
+                                                        (unsigned long) (i % 24), (unsigned long) (i % 60),
+                                                        (unsigned long) ((i * 7) % 60),
+                                                        (unsigned long) ((i * 7919) % 1000000)]];
+        [dates addObject:[NSString stringWithFormat:@"19%02lu-%02lu-%02lu", (unsigned long) (50 + i % 50),
+                                                    (unsigned long) (1 + i % 12), (unsigned long) (1 + i % 28)]];
+    }
+
+    __block id sink = nil;
+    NSMutableArray *results = [NSMutableArray array];
+
+    [results addObject:JRRunBenchmark(@"datetime_parse", 0, iterations, nil, ^{
+        for (NSString *dateTime in dateTimes)
+            sink = [NSDate dateFromISO8601DateTimeString:dateTime];
+    })];
+
+    [results addObject:JRRunBenchmark(@"date_parse", 0, iterations, nil, ^{
+        for (NSString *date in dates)
+            sink = [NSDate dateFromISO8601DateString:date];
+    })];
+
+    for (NSUInteger i = 0; i < [results count]; i++)
+    {
+        NSMutableDictionary *result = [[results objectAtIndex:i] mutableCopy];
+        [result setObject:[NSNumber numberWithUnsignedInteger:JRBenchmarkDateBatchSize] forKey:@"batchSize"];
+        [results replaceObjectAtIndex:i withObject:result];
+    }
+
+    return results;
+}
+
+static NSArray *JRBenchmarkBase64(NSUInteger iterations)
+{
+    /* A refresh signature, a typical token or small record, and a large attachment sized payload */
+    NSUInteger payloadSizes[] = {20, 4096, 262144};
+    NSMutableArray *results = [NSMutableArray array];
+    __block id sink = nil;
+
+    for (NSUInteger s = 0; s < sizeof(payloadSizes) / sizeof(payloadSizes[0]); s++)
+    {
+        NSUInteger payloadSize = payloadSizes[s];
+        NSMutableData *payload = [NSMutableData dataWithLength:payloadSize];
+        uint8_t *payloadBytes = [payload mutableBytes];
+        for (NSUInteger i = 0; i < payloadSize; i++)
+            payloadBytes[i] = (uint8_t) ((i * 2654435761u) >> 24);
+
+        NSString *encoded = [payload JRBase64EncodedString];
+        NSMutableData *buffer = [NSMutableData dataWithLength:JRBase64EncodedLength(payloadSize, JRBase64OptionsNone)];
+        NSUInteger batchSize = MAX(JRBenchmarkBase64BatchSize * 20 / payloadSize, 1);
+        NSUInteger first = [results count];
+
+        [results addObject:JRRunBenchmark(@"base64_encode_legacy", 0, iterations, nil, ^{
+            for (NSUInteger i = 0; i < batchSize; i++)
+                sink = [payload legacyJRBase64EncodedStringWithWrapWidth:0];
+        })];
+
+        [results addObject:JRRunBenchmark(@"base64_encode", 0, iterations, nil, ^{
+            for (NSUInteger i = 0; i < batchSize; i++)
+                sink = [payload JRBase64EncodedString];
+        })];
+
+        [results addObject:JRRunBenchmark(@"base64_encode_buffer", 0, iterations, nil, ^{
+            for (NSUInteger i = 0; i < batchSize; i++)
+                JRBase64Encode(payloadBytes, payloadSize, [buffer mutableBytes], JRBase64OptionsNone);
+        })];
+
+        [results addObject:JRRunBenchmark(@"base64url_encode", 0, iterations, nil, ^{
+            for (NSUInteger i = 0; i < batchSize; i++)
+                sink = [payload JRBase64URLEncodedString];
+        })];
+
+        [results addObject:JRRunBenchmark(@"base64_decode_legacy", 0, iterations, nil, ^{
+            for (NSUInteger i = 0; i < batchSize; i++)
+                sink = [NSData dataWithLegacyJRBase64EncodedString:encoded];
+        })];
+
+        [results addObject:JRRunBenchmark(@"base64_decode", 0, iterations, nil, ^{
+            for (NSUInteger i = 0; i < batchSize; i++)
+                sink = [NSData dataWithJRBase64EncodedString:encoded];
+        })];
+
+        for (NSUInteger i = first; i < [results count]; i++)
+        {
+            NSMutableDictionary *result = [[results objectAtIndex:i] mutableCopy];
+            [result setObject:[NSNumber numberWithUnsignedInteger:payloadSize] forKey:@"payloadBytes"];
+            [result setObject:[NSNumber numberWithUnsignedInteger:batchSize] forKey:@"batchSize"];
+            [results replaceObjectAtIndex:i withObject:result];
+        }
+    }
+
+    return results;
+}
+
+static void JRPrintUsage(void)
+{
+    fprintf(stderr, "usage: JRCaptureBenchmark [--schema path/to/schema.json] [--iterations n] [--sizes 1,10,100]"
+                    " [--output path/to/results.json]\n");
+}
+
+int main(int argc, const char *argv[])
+{
+    @autoreleasepool
+    {
+        NSArray *processArguments = [[NSProcessInfo processInfo] arguments];
+
+        NSString *schemaPath = @"../../Janrain/JRCapture/Script/default-schema.json";
+        NSUInteger iterations = 50;
+        NSArray *sizes = [NSArray arrayWithObjects:@"1", @"10", @"100", nil];
+        NSString *outputPath = nil;
+
+        for (NSUInteger i = 1; i < [processArguments count]; i++)
+        {
+            NSString *flag = [processArguments objectAtIndex:i];
+            NSString *value = i + 1 < [processArguments count] ? [processArguments objectAtIndex:i + 1] : nil;
+
+            if (!value || ![flag hasPrefix:@"--"])
+            {
+                JRPrintUsage();
+                return 2;
+            }
+
+            if ([flag isEqualToString:@"--schema"])
+                schemaPath = value;
+            else if ([flag isEqualToString:@"--iterations"])
+                iterations = (NSUInteger) MAX([value integerValue], 1);
+            else if ([flag isEqualToString:@"--sizes"])
+                sizes = [value componentsSeparatedByString:@","];
+            else if ([flag isEqualToString:@"--output"])
+                outputPath = value;
+            else
+            {
+                JRPrintUsage();
+                return 2;
+            }
+
+            i++;
+        }
+
+        NSData *schemaData = [NSData dataWithContentsOfFile:schemaPath];
+        NSArray *attrDefs = schemaData ? [NSJSONSerialization JSONObjectWithData:schemaData options:0 error:nil] : nil;
+        if (![attrDefs isKindOfClass:[NSArray class]])
+        {
+            fprintf(stderr, "could not read a schema from %s\n", [schemaPath UTF8String]);
+            return 1;
+        }
+
+        JRBenchmarkRecordGenerator *generator = [[JRBenchmarkRecordGenerator alloc] initWithSchemaAttributes:attrDefs];
+        JRCaptureFlow *flow = [JRCaptureFlow flowWithDictionary:[generator flowDictionaryWithFormName:JRBenchmarkFormName]];
+
+        [JRStageMetrics reset];
+
+        NSMutableArray *results = [NSMutableArray array];
+        for (NSString *size in sizes)
+        {
+            [results addObjectsFromArray:JRBenchmarkRecord(generator, flow, (NSUInteger) [size integerValue],
+                                                           iterations)];
+            [results addObjectsFromArray:JRBenchmarkRequestBodies(generator, (NSUInteger) [size integerValue],
+                                                                  iterations)];
+        }
+        [results addObjectsFromArray:JRBenchmarkDates(iterations)];
+        [results addObjectsFromArray:JRBenchmarkBase64(iterations)];
+
+        NSDictionary *report = [NSDictionary dictionaryWithObjectsAndKeys:
+                                                     [schemaPath lastPathComponent], @"schema",
+                                                     [NSNumber numberWithUnsignedInteger:iterations], @"iterations",
+                                                     results, @"results",
+                                                     [JRStageMetrics snapshot], @"stages", nil];
+
+        NSData *json = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:nil];
+
+        if (outputPath)
+            return [json writeToFile:outputPath atomically:YES] ? 0 : 1;
+
+        fwrite([json bytes], 1, [json length], stdout);
+        fputc('\n', stdout);
+    }
+
+    return 0;
+}
@@ -58,6 +58,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -70,6 +71,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -93,14 +95,39 @@
     return [[JRBasicObject alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRBasicObject *basicObjectCopy = (JRBasicObject *)[super copyWithZone:zone];
+
+    basicObjectCopy->_string1 = _string1;
+    basicObjectCopy->_string2 = _string2;
+
+    return basicObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
 
     if (forEncoder)
@@ -178,6 +205,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -194,6 +222,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"basicObject"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"basicObject"] allObjects]];
 
@@ -205,10 +235,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -224,8 +254,8 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -241,17 +271,38 @@
 
 - (BOOL)isEqualToBasicObject:(JRBasicObject *)otherBasicObject
 {
-    if (!self.string1 && !otherBasicObject.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherBasicObject.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherBasicObject.string1]) return NO;
+    if (!otherBasicObject) return NO;
+    if ([self hash] != [otherBasicObject hash]) return NO;
+
+    if (!_string1 && !otherBasicObject->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherBasicObject->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherBasicObject->_string1]) return NO;
 
-    if (!self.string2 && !otherBasicObject.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherBasicObject.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherBasicObject.string2]) return NO;
+    if (!_string2 && !otherBasicObject->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherBasicObject->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherBasicObject->_string2]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRBasicObject class]]) return NO;
+
+    return [self isEqualToBasicObject:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
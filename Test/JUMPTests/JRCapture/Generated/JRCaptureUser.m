@@ -687,6 +687,7 @@
 
 - (void)setUuid:(JRUuid *)newUuid
 {
+    [self willChangeProperty:@"uuid"];
     [self.dirtyPropertySet addObject:@"uuid"];
 
     _uuid = [newUuid copy];
@@ -699,6 +700,7 @@
 
 - (void)setCreated:(JRDateTime *)newCreated
 {
+    [self willChangeProperty:@"created"];
     [self.dirtyPropertySet addObject:@"created"];
 
     _created = [newCreated copy];
@@ -711,6 +713,7 @@
 
 - (void)setLastUpdated:(JRDateTime *)newLastUpdated
 {
+    [self willChangeProperty:@"lastUpdated"];
     [self.dirtyPropertySet addObject:@"lastUpdated"];
 
     _lastUpdated = [newLastUpdated copy];
@@ -723,6 +726,7 @@
 
 - (void)setEmail:(NSString *)newEmail
 {
+    [self willChangeProperty:@"email"];
     [self.dirtyPropertySet addObject:@"email"];
 
     _email = [newEmail copy];
@@ -735,6 +739,7 @@
 
 - (void)setBasicBoolean:(JRBoolean *)newBasicBoolean
 {
+    [self willChangeProperty:@"basicBoolean"];
     [self.dirtyPropertySet addObject:@"basicBoolean"];
 
     _basicBoolean = [newBasicBoolean copy];
@@ -747,6 +752,7 @@
 
 - (void)setBasicBooleanWithBool:(BOOL)boolVal
 {
+    [self willChangeProperty:@"basicBoolean"];
     [self.dirtyPropertySet addObject:@"basicBoolean"];
 
     _basicBoolean = [NSNumber numberWithBool:boolVal];
@@ -759,6 +765,7 @@
 
 - (void)setBasicString:(NSString *)newBasicString
 {
+    [self willChangeProperty:@"basicString"];
     [self.dirtyPropertySet addObject:@"basicString"];
 
     _basicString = [newBasicString copy];
@@ -771,6 +778,7 @@
 
 - (void)setBasicInteger:(JRInteger *)newBasicInteger
 {
+    [self willChangeProperty:@"basicInteger"];
     [self.dirtyPropertySet addObject:@"basicInteger"];
 
     _basicInteger = [newBasicInteger copy];
@@ -783,6 +791,7 @@
 
 - (void)setBasicIntegerWithInteger:(NSInteger)integerVal
 {
+    [self willChangeProperty:@"basicInteger"];
     [self.dirtyPropertySet addObject:@"basicInteger"];
 
     _basicInteger = [NSNumber numberWithInteger:integerVal];
@@ -795,6 +804,7 @@
 
 - (void)setBasicDecimal:(JRDecimal *)newBasicDecimal
 {
+    [self willChangeProperty:@"basicDecimal"];
     [self.dirtyPropertySet addObject:@"basicDecimal"];
 
     _basicDecimal = [newBasicDecimal copy];
@@ -807,6 +817,7 @@
 
 - (void)setBasicDate:(JRDate *)newBasicDate
 {
+    [self willChangeProperty:@"basicDate"];
     [self.dirtyPropertySet addObject:@"basicDate"];
 
     _basicDate = [newBasicDate copy];
@@ -819,6 +830,7 @@
 
 - (void)setBasicDateTime:(JRDateTime *)newBasicDateTime
 {
+    [self willChangeProperty:@"basicDateTime"];
     [self.dirtyPropertySet addObject:@"basicDateTime"];
 
     _basicDateTime = [newBasicDateTime copy];
@@ -831,6 +843,7 @@
 
 - (void)setBasicIpAddress:(JRIpAddress *)newBasicIpAddress
 {
+    [self willChangeProperty:@"basicIpAddress"];
     [self.dirtyPropertySet addObject:@"basicIpAddress"];
 
     _basicIpAddress = [newBasicIpAddress copy];
@@ -843,6 +856,7 @@
 
 - (void)setBasicPassword:(JRPassword *)newBasicPassword
 {
+    [self willChangeProperty:@"basicPassword"];
     [self.dirtyPropertySet addObject:@"basicPassword"];
 
     _basicPassword = [newBasicPassword copy];
@@ -855,6 +869,7 @@
 
 - (void)setJsonNumber:(JRJsonObject *)newJsonNumber
 {
+    [self willChangeProperty:@"jsonNumber"];
     [self.dirtyPropertySet addObject:@"jsonNumber"];
 
     _jsonNumber = [newJsonNumber copy];
@@ -867,6 +882,7 @@
 
 - (void)setJsonString:(JRJsonObject *)newJsonString
 {
+    [self willChangeProperty:@"jsonString"];
     [self.dirtyPropertySet addObject:@"jsonString"];
 
     _jsonString = [newJsonString copy];
@@ -879,6 +895,7 @@
 
 - (void)setJsonArray:(JRJsonObject *)newJsonArray
 {
+    [self willChangeProperty:@"jsonArray"];
     [self.dirtyPropertySet addObject:@"jsonArray"];
 
     _jsonArray = [newJsonArray copy];
@@ -891,6 +908,7 @@
 
 - (void)setJsonDictionary:(JRJsonObject *)newJsonDictionary
 {
+    [self willChangeProperty:@"jsonDictionary"];
     [self.dirtyPropertySet addObject:@"jsonDictionary"];
 
     _jsonDictionary = [newJsonDictionary copy];
@@ -903,6 +921,7 @@
 
 - (void)setStringTestJson:(NSString *)newStringTestJson
 {
+    [self willChangeProperty:@"stringTestJson"];
     [self.dirtyPropertySet addObject:@"stringTestJson"];
 
     _stringTestJson = [newStringTestJson copy];
@@ -915,6 +934,7 @@
 
 - (void)setStringTestEmpty:(NSString *)newStringTestEmpty
 {
+    [self willChangeProperty:@"stringTestEmpty"];
     [self.dirtyPropertySet addObject:@"stringTestEmpty"];
 
     _stringTestEmpty = [newStringTestEmpty copy];
@@ -927,6 +947,7 @@
 
 - (void)setStringTestNull:(NSString *)newStringTestNull
 {
+    [self willChangeProperty:@"stringTestNull"];
     [self.dirtyPropertySet addObject:@"stringTestNull"];
 
     _stringTestNull = [newStringTestNull copy];
@@ -939,6 +960,7 @@
 
 - (void)setStringTestInvalid:(NSString *)newStringTestInvalid
 {
+    [self willChangeProperty:@"stringTestInvalid"];
     [self.dirtyPropertySet addObject:@"stringTestInvalid"];
 
     _stringTestInvalid = [newStringTestInvalid copy];
@@ -951,6 +973,7 @@
 
 - (void)setStringTestNSNull:(NSString *)newStringTestNSNull
 {
+    [self willChangeProperty:@"stringTestNSNull"];
     [self.dirtyPropertySet addObject:@"stringTestNSNull"];
 
     _stringTestNSNull = [newStringTestNSNull copy];
@@ -963,6 +986,7 @@
 
 - (void)setStringTestAlphanumeric:(NSString *)newStringTestAlphanumeric
 {
+    [self willChangeProperty:@"stringTestAlphanumeric"];
     [self.dirtyPropertySet addObject:@"stringTestAlphanumeric"];
 
     _stringTestAlphanumeric = [newStringTestAlphanumeric copy];
@@ -975,6 +999,7 @@
 
 - (void)setStringTestUnicodeLetters:(NSString *)newStringTestUnicodeLetters
 {
+    [self willChangeProperty:@"stringTestUnicodeLetters"];
     [self.dirtyPropertySet addObject:@"stringTestUnicodeLetters"];
 
     _stringTestUnicodeLetters = [newStringTestUnicodeLetters copy];
@@ -987,6 +1012,7 @@
 
 - (void)setStringTestUnicodePrintable:(NSString *)newStringTestUnicodePrintable
 {
+    [self willChangeProperty:@"stringTestUnicodePrintable"];
     [self.dirtyPropertySet addObject:@"stringTestUnicodePrintable"];
 
     _stringTestUnicodePrintable = [newStringTestUnicodePrintable copy];
@@ -999,6 +1025,7 @@
 
 - (void)setStringTestEmailAddress:(NSString *)newStringTestEmailAddress
 {
+    [self willChangeProperty:@"stringTestEmailAddress"];
     [self.dirtyPropertySet addObject:@"stringTestEmailAddress"];
 
     _stringTestEmailAddress = [newStringTestEmailAddress copy];
@@ -1011,6 +1038,7 @@
 
 - (void)setStringTestLength:(NSString *)newStringTestLength
 {
+    [self willChangeProperty:@"stringTestLength"];
     [self.dirtyPropertySet addObject:@"stringTestLength"];
 
     _stringTestLength = [newStringTestLength copy];
@@ -1023,6 +1051,7 @@
 
 - (void)setStringTestCaseSensitive:(NSString *)newStringTestCaseSensitive
 {
+    [self willChangeProperty:@"stringTestCaseSensitive"];
     [self.dirtyPropertySet addObject:@"stringTestCaseSensitive"];
 
     _stringTestCaseSensitive = [newStringTestCaseSensitive copy];
@@ -1035,6 +1064,7 @@
 
 - (void)setStringTestFeatures:(NSString *)newStringTestFeatures
 {
+    [self willChangeProperty:@"stringTestFeatures"];
     [self.dirtyPropertySet addObject:@"stringTestFeatures"];
 
     _stringTestFeatures = [newStringTestFeatures copy];
@@ -1042,74 +1072,101 @@
 
 - (NSArray *)basicPlural
 {
+    if ([self.sharedPropertySet containsObject:@"basicPlural"])
+        [self unshareProperty:@"basicPlural"];
+
     return _basicPlural;
 }
 
 - (void)setBasicPlural:(NSArray *)newBasicPlural
 {
-    _basicPlural = [newBasicPlural copy];
+    [self willChangeProperty:@"basicPlural"];
+
+    _basicPlural = [self claimValue:[newBasicPlural copy] forProperty:@"basicPlural"];
 }
 
 - (JRBasicObject *)basicObject
 {
+    if ([self.sharedPropertySet containsObject:@"basicObject"])
+        [self unshareProperty:@"basicObject"];
+
     return _basicObject;
 }
 
 - (void)setBasicObject:(JRBasicObject *)newBasicObject
 {
+    [self willChangeProperty:@"basicObject"];
     [self.dirtyPropertySet addObject:@"basicObject"];
 
-    _basicObject = newBasicObject;
+    _basicObject = [self claimValue:newBasicObject forProperty:@"basicObject"];
 
     [_basicObject setAllPropertiesToDirty];
 }
 
 - (JRObjectTestRequired *)objectTestRequired
 {
+    if ([self.sharedPropertySet containsObject:@"objectTestRequired"])
+        [self unshareProperty:@"objectTestRequired"];
+
     return _objectTestRequired;
 }
 
 - (void)setObjectTestRequired:(JRObjectTestRequired *)newObjectTestRequired
 {
+    [self willChangeProperty:@"objectTestRequired"];
     [self.dirtyPropertySet addObject:@"objectTestRequired"];
 
-    _objectTestRequired = newObjectTestRequired;
+    _objectTestRequired = [self claimValue:newObjectTestRequired forProperty:@"objectTestRequired"];
 
     [_objectTestRequired setAllPropertiesToDirty];
 }
 
 - (NSArray *)pluralTestUnique
 {
+    if ([self.sharedPropertySet containsObject:@"pluralTestUnique"])
+        [self unshareProperty:@"pluralTestUnique"];
+
     return _pluralTestUnique;
 }
 
 - (void)setPluralTestUnique:(NSArray *)newPluralTestUnique
 {
-    _pluralTestUnique = [newPluralTestUnique copy];
+    [self willChangeProperty:@"pluralTestUnique"];
+
+    _pluralTestUnique = [self claimValue:[newPluralTestUnique copy] forProperty:@"pluralTestUnique"];
 }
 
 - (JRObjectTestRequiredUnique *)objectTestRequiredUnique
 {
+    if ([self.sharedPropertySet containsObject:@"objectTestRequiredUnique"])
+        [self unshareProperty:@"objectTestRequiredUnique"];
+
     return _objectTestRequiredUnique;
 }
 
 - (void)setObjectTestRequiredUnique:(JRObjectTestRequiredUnique *)newObjectTestRequiredUnique
 {
+    [self willChangeProperty:@"objectTestRequiredUnique"];
     [self.dirtyPropertySet addObject:@"objectTestRequiredUnique"];
 
-    _objectTestRequiredUnique = newObjectTestRequiredUnique;
+    _objectTestRequiredUnique = [self claimValue:newObjectTestRequiredUnique forProperty:@"objectTestRequiredUnique"];
 
     [_objectTestRequiredUnique setAllPropertiesToDirty];
 }
 
 - (NSArray *)pluralTestAlphabetic
 {
+    if ([self.sharedPropertySet containsObject:@"pluralTestAlphabetic"])
+        [self unshareProperty:@"pluralTestAlphabetic"];
+
     return _pluralTestAlphabetic;
 }
 
 - (void)setPluralTestAlphabetic:(NSArray *)newPluralTestAlphabetic
 {
-    _pluralTestAlphabetic = [newPluralTestAlphabetic copy];
+    [self willChangeProperty:@"pluralTestAlphabetic"];
+
+    _pluralTestAlphabetic = [self claimValue:[newPluralTestAlphabetic copy] forProperty:@"pluralTestAlphabetic"];
 }
 
 - (JRStringArray *)simpleStringPluralOne
@@ -1119,6 +1176,8 @@
 
 - (void)setSimpleStringPluralOne:(JRStringArray *)newSimpleStringPluralOne
 {
+    [self willChangeProperty:@"simpleStringPluralOne"];
+
     _simpleStringPluralOne = [newSimpleStringPluralOne copy];
 }
 
@@ -1129,149 +1188,205 @@
 
 - (void)setSimpleStringPluralTwo:(JRStringArray *)newSimpleStringPluralTwo
 {
+    [self willChangeProperty:@"simpleStringPluralTwo"];
+
     _simpleStringPluralTwo = [newSimpleStringPluralTwo copy];
 }
 
 - (NSArray *)pinapL1Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinapL1Plural"])
+        [self unshareProperty:@"pinapL1Plural"];
+
     return _pinapL1Plural;
 }
 
 - (void)setPinapL1Plural:(NSArray *)newPinapL1Plural
 {
-    _pinapL1Plural = [newPinapL1Plural copy];
+    [self willChangeProperty:@"pinapL1Plural"];
+
+    _pinapL1Plural = [self claimValue:[newPinapL1Plural copy] forProperty:@"pinapL1Plural"];
 }
 
 - (JRPinoL1Object *)pinoL1Object
 {
+    if ([self.sharedPropertySet containsObject:@"pinoL1Object"])
+        [self unshareProperty:@"pinoL1Object"];
+
     return _pinoL1Object;
 }
 
 - (void)setPinoL1Object:(JRPinoL1Object *)newPinoL1Object
 {
+    [self willChangeProperty:@"pinoL1Object"];
     [self.dirtyPropertySet addObject:@"pinoL1Object"];
 
-    _pinoL1Object = newPinoL1Object;
+    _pinoL1Object = [self claimValue:newPinoL1Object forProperty:@"pinoL1Object"];
 
     [_pinoL1Object setAllPropertiesToDirty];
 }
 
 - (NSArray *)onipL1Plural
 {
+    if ([self.sharedPropertySet containsObject:@"onipL1Plural"])
+        [self unshareProperty:@"onipL1Plural"];
+
     return _onipL1Plural;
 }
 
 - (void)setOnipL1Plural:(NSArray *)newOnipL1Plural
 {
-    _onipL1Plural = [newOnipL1Plural copy];
+    [self willChangeProperty:@"onipL1Plural"];
+
+    _onipL1Plural = [self claimValue:[newOnipL1Plural copy] forProperty:@"onipL1Plural"];
 }
 
 - (JROinoL1Object *)oinoL1Object
 {
+    if ([self.sharedPropertySet containsObject:@"oinoL1Object"])
+        [self unshareProperty:@"oinoL1Object"];
+
     return _oinoL1Object;
 }
 
 - (void)setOinoL1Object:(JROinoL1Object *)newOinoL1Object
 {
+    [self willChangeProperty:@"oinoL1Object"];
     [self.dirtyPropertySet addObject:@"oinoL1Object"];
 
-    _oinoL1Object = newOinoL1Object;
+    _oinoL1Object = [self claimValue:newOinoL1Object forProperty:@"oinoL1Object"];
 
     [_oinoL1Object setAllPropertiesToDirty];
 }
 
 - (NSArray *)pinapinapL1Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinapinapL1Plural"])
+        [self unshareProperty:@"pinapinapL1Plural"];
+
     return _pinapinapL1Plural;
 }
 
 - (void)setPinapinapL1Plural:(NSArray *)newPinapinapL1Plural
 {
-    _pinapinapL1Plural = [newPinapinapL1Plural copy];
+    [self willChangeProperty:@"pinapinapL1Plural"];
+
+    _pinapinapL1Plural = [self claimValue:[newPinapinapL1Plural copy] forProperty:@"pinapinapL1Plural"];
 }
 
 - (NSArray *)pinonipL1Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinonipL1Plural"])
+        [self unshareProperty:@"pinonipL1Plural"];
+
     return _pinonipL1Plural;
 }
 
 - (void)setPinonipL1Plural:(NSArray *)newPinonipL1Plural
 {
-    _pinonipL1Plural = [newPinonipL1Plural copy];
+    [self willChangeProperty:@"pinonipL1Plural"];
+
+    _pinonipL1Plural = [self claimValue:[newPinonipL1Plural copy] forProperty:@"pinonipL1Plural"];
 }
 
 - (JRPinapinoL1Object *)pinapinoL1Object
 {
+    if ([self.sharedPropertySet containsObject:@"pinapinoL1Object"])
+        [self unshareProperty:@"pinapinoL1Object"];
+
     return _pinapinoL1Object;
 }
 
 - (void)setPinapinoL1Object:(JRPinapinoL1Object *)newPinapinoL1Object
 {
+    [self willChangeProperty:@"pinapinoL1Object"];
     [self.dirtyPropertySet addObject:@"pinapinoL1Object"];
 
-    _pinapinoL1Object = newPinapinoL1Object;
+    _pinapinoL1Object = [self claimValue:newPinapinoL1Object forProperty:@"pinapinoL1Object"];
 
     [_pinapinoL1Object setAllPropertiesToDirty];
 }
 
 - (JRPinoinoL1Object *)pinoinoL1Object
 {
+    if ([self.sharedPropertySet containsObject:@"pinoinoL1Object"])
+        [self unshareProperty:@"pinoinoL1Object"];
+
     return _pinoinoL1Object;
 }
 
 - (void)setPinoinoL1Object:(JRPinoinoL1Object *)newPinoinoL1Object
 {
+    [self willChangeProperty:@"pinoinoL1Object"];
     [self.dirtyPropertySet addObject:@"pinoinoL1Object"];
 
-    _pinoinoL1Object = newPinoinoL1Object;
+    _pinoinoL1Object = [self claimValue:newPinoinoL1Object forProperty:@"pinoinoL1Object"];
 
     [_pinoinoL1Object setAllPropertiesToDirty];
 }
 
 - (NSArray *)onipinapL1Plural
 {
+    if ([self.sharedPropertySet containsObject:@"onipinapL1Plural"])
+        [self unshareProperty:@"onipinapL1Plural"];
+
     return _onipinapL1Plural;
 }
 
 - (void)setOnipinapL1Plural:(NSArray *)newOnipinapL1Plural
 {
-    _onipinapL1Plural = [newOnipinapL1Plural copy];
+    [self willChangeProperty:@"onipinapL1Plural"];
+
+    _onipinapL1Plural = [self claimValue:[newOnipinapL1Plural copy] forProperty:@"onipinapL1Plural"];
 }
 
 - (NSArray *)oinonipL1Plural
 {
+    if ([self.sharedPropertySet containsObject:@"oinonipL1Plural"])
+        [self unshareProperty:@"oinonipL1Plural"];
+
     return _oinonipL1Plural;
 }
 
 - (void)setOinonipL1Plural:(NSArray *)newOinonipL1Plural
 {
-    _oinonipL1Plural = [newOinonipL1Plural copy];
+    [self willChangeProperty:@"oinonipL1Plural"];
+
+    _oinonipL1Plural = [self claimValue:[newOinonipL1Plural copy] forProperty:@"oinonipL1Plural"];
 }
 
 - (JROnipinoL1Object *)onipinoL1Object
 {
+    if ([self.sharedPropertySet containsObject:@"onipinoL1Object"])
+        [self unshareProperty:@"onipinoL1Object"];
+
     return _onipinoL1Object;
 }
 
 - (void)setOnipinoL1Object:(JROnipinoL1Object *)newOnipinoL1Object
 {
+    [self willChangeProperty:@"onipinoL1Object"];
     [self.dirtyPropertySet addObject:@"onipinoL1Object"];
 
-    _onipinoL1Object = newOnipinoL1Object;
+    _onipinoL1Object = [self claimValue:newOnipinoL1Object forProperty:@"onipinoL1Object"];
 
     [_onipinoL1Object setAllPropertiesToDirty];
 }
 
 - (JROinoinoL1Object *)oinoinoL1Object
 {
+    if ([self.sharedPropertySet containsObject:@"oinoinoL1Object"])
+        [self unshareProperty:@"oinoinoL1Object"];
+
     return _oinoinoL1Object;
 }
 
 - (void)setOinoinoL1Object:(JROinoinoL1Object *)newOinoinoL1Object
 {
+    [self willChangeProperty:@"oinoinoL1Object"];
     [self.dirtyPropertySet addObject:@"oinoinoL1Object"];
 
-    _oinoinoL1Object = newOinoinoL1Object;
+    _oinoinoL1Object = [self claimValue:newOinoinoL1Object forProperty:@"oinoinoL1Object"];
 
     [_oinoinoL1Object setAllPropertiesToDirty];
 }
@@ -1283,6 +1398,7 @@
 
 - (void)setCaptureUserId:(JRObjectId *)newCaptureUserId
 {
+    [self willChangeProperty:@"captureUserId"];
     [self.dirtyPropertySet addObject:@"captureUserId"];
 
     _captureUserId = [newCaptureUserId copy];
@@ -1295,15 +1411,15 @@
         self.captureObjectPath = @"";
         self.canBeUpdatedOnCapture = YES;
 
-        _basicObject = [[JRBasicObject alloc] init];
-        _objectTestRequired = [[JRObjectTestRequired alloc] init];
-        _objectTestRequiredUnique = [[JRObjectTestRequiredUnique alloc] init];
-        _pinoL1Object = [[JRPinoL1Object alloc] init];
-        _oinoL1Object = [[JROinoL1Object alloc] init];
-        _pinapinoL1Object = [[JRPinapinoL1Object alloc] init];
-        _pinoinoL1Object = [[JRPinoinoL1Object alloc] init];
-        _onipinoL1Object = [[JROnipinoL1Object alloc] init];
-        _oinoinoL1Object = [[JROinoinoL1Object alloc] init];
+        _basicObject = [self claimValue:[[JRBasicObject alloc] init] forProperty:@"basicObject"];
+        _objectTestRequired = [self claimValue:[[JRObjectTestRequired alloc] init] forProperty:@"objectTestRequired"];
+        _objectTestRequiredUnique = [self claimValue:[[JRObjectTestRequiredUnique alloc] init] forProperty:@"objectTestRequiredUnique"];
+        _pinoL1Object = [self claimValue:[[JRPinoL1Object alloc] init] forProperty:@"pinoL1Object"];
+        _oinoL1Object = [self claimValue:[[JROinoL1Object alloc] init] forProperty:@"oinoL1Object"];
+        _pinapinoL1Object = [self claimValue:[[JRPinapinoL1Object alloc] init] forProperty:@"pinapinoL1Object"];
+        _pinoinoL1Object = [self claimValue:[[JRPinoinoL1Object alloc] init] forProperty:@"pinoinoL1Object"];
+        _onipinoL1Object = [self claimValue:[[JROnipinoL1Object alloc] init] forProperty:@"onipinoL1Object"];
+        _oinoinoL1Object = [self claimValue:[[JROinoinoL1Object alloc] init] forProperty:@"oinoinoL1Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -1315,108 +1431,216 @@
     return [[JRCaptureUser alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRCaptureUser *captureUserCopy = (JRCaptureUser *)[super copyWithZone:zone];
+
+    captureUserCopy->_uuid = _uuid;
+    captureUserCopy->_created = _created;
+    captureUserCopy->_lastUpdated = _lastUpdated;
+    captureUserCopy->_email = _email;
+    captureUserCopy->_basicBoolean = _basicBoolean;
+    captureUserCopy->_basicString = _basicString;
+    captureUserCopy->_basicInteger = _basicInteger;
+    captureUserCopy->_basicDecimal = _basicDecimal;
+    captureUserCopy->_basicDate = _basicDate;
+    captureUserCopy->_basicDateTime = _basicDateTime;
+    captureUserCopy->_basicIpAddress = _basicIpAddress;
+    captureUserCopy->_basicPassword = _basicPassword;
+    captureUserCopy->_jsonNumber = _jsonNumber;
+    captureUserCopy->_jsonString = _jsonString;
+    captureUserCopy->_jsonArray = _jsonArray;
+    captureUserCopy->_jsonDictionary = _jsonDictionary;
+    captureUserCopy->_stringTestJson = _stringTestJson;
+    captureUserCopy->_stringTestEmpty = _stringTestEmpty;
+    captureUserCopy->_stringTestNull = _stringTestNull;
+    captureUserCopy->_stringTestInvalid = _stringTestInvalid;
+    captureUserCopy->_stringTestNSNull = _stringTestNSNull;
+    captureUserCopy->_stringTestAlphanumeric = _stringTestAlphanumeric;
+    captureUserCopy->_stringTestUnicodeLetters = _stringTestUnicodeLetters;
+    captureUserCopy->_stringTestUnicodePrintable = _stringTestUnicodePrintable;
+    captureUserCopy->_stringTestEmailAddress = _stringTestEmailAddress;
+    captureUserCopy->_stringTestLength = _stringTestLength;
+    captureUserCopy->_stringTestCaseSensitive = _stringTestCaseSensitive;
+    captureUserCopy->_stringTestFeatures = _stringTestFeatures;
+    captureUserCopy->_basicPlural = _basicPlural;
+    captureUserCopy->_basicObject = _basicObject;
+    captureUserCopy->_objectTestRequired = _objectTestRequired;
+    captureUserCopy->_pluralTestUnique = _pluralTestUnique;
+    captureUserCopy->_objectTestRequiredUnique = _objectTestRequiredUnique;
+    captureUserCopy->_pluralTestAlphabetic = _pluralTestAlphabetic;
+    captureUserCopy->_simpleStringPluralOne = _simpleStringPluralOne;
+    captureUserCopy->_simpleStringPluralTwo = _simpleStringPluralTwo;
+    captureUserCopy->_pinapL1Plural = _pinapL1Plural;
+    captureUserCopy->_pinoL1Object = _pinoL1Object;
+    captureUserCopy->_onipL1Plural = _onipL1Plural;
+    captureUserCopy->_oinoL1Object = _oinoL1Object;
+    captureUserCopy->_pinapinapL1Plural = _pinapinapL1Plural;
+    captureUserCopy->_pinonipL1Plural = _pinonipL1Plural;
+    captureUserCopy->_pinapinoL1Object = _pinapinoL1Object;
+    captureUserCopy->_pinoinoL1Object = _pinoinoL1Object;
+    captureUserCopy->_onipinapL1Plural = _onipinapL1Plural;
+    captureUserCopy->_oinonipL1Plural = _oinonipL1Plural;
+    captureUserCopy->_onipinoL1Object = _onipinoL1Object;
+    captureUserCopy->_oinoinoL1Object = _oinoinoL1Object;
+    captureUserCopy->_captureUserId = _captureUserId;
+
+    return captureUserCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"basicPlural", @"basicObject", @"objectTestRequired", @"pluralTestUnique", @"objectTestRequiredUnique", @"pluralTestAlphabetic", @"pinapL1Plural", @"pinoL1Object", @"onipL1Plural", @"oinoL1Object", @"pinapinapL1Plural", @"pinonipL1Plural", @"pinapinoL1Object", @"pinoinoL1Object", @"onipinapL1Plural", @"oinonipL1Plural", @"onipinoL1Object", @"oinoinoL1Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"basicPlural"]) return _basicPlural;
+    if ([propertyName isEqualToString:@"basicObject"]) return _basicObject;
+    if ([propertyName isEqualToString:@"objectTestRequired"]) return _objectTestRequired;
+    if ([propertyName isEqualToString:@"pluralTestUnique"]) return _pluralTestUnique;
+    if ([propertyName isEqualToString:@"objectTestRequiredUnique"]) return _objectTestRequiredUnique;
+    if ([propertyName isEqualToString:@"pluralTestAlphabetic"]) return _pluralTestAlphabetic;
+    if ([propertyName isEqualToString:@"pinapL1Plural"]) return _pinapL1Plural;
+    if ([propertyName isEqualToString:@"pinoL1Object"]) return _pinoL1Object;
+    if ([propertyName isEqualToString:@"onipL1Plural"]) return _onipL1Plural;
+    if ([propertyName isEqualToString:@"oinoL1Object"]) return _oinoL1Object;
+    if ([propertyName isEqualToString:@"pinapinapL1Plural"]) return _pinapinapL1Plural;
+    if ([propertyName isEqualToString:@"pinonipL1Plural"]) return _pinonipL1Plural;
+    if ([propertyName isEqualToString:@"pinapinoL1Object"]) return _pinapinoL1Object;
+    if ([propertyName isEqualToString:@"pinoinoL1Object"]) return _pinoinoL1Object;
+    if ([propertyName isEqualToString:@"onipinapL1Plural"]) return _onipinapL1Plural;
+    if ([propertyName isEqualToString:@"oinonipL1Plural"]) return _oinonipL1Plural;
+    if ([propertyName isEqualToString:@"onipinoL1Object"]) return _onipinoL1Object;
+    if ([propertyName isEqualToString:@"oinoinoL1Object"]) return _oinoinoL1Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"basicPlural"]) _basicPlural = value;
+    if ([propertyName isEqualToString:@"basicObject"]) _basicObject = value;
+    if ([propertyName isEqualToString:@"objectTestRequired"]) _objectTestRequired = value;
+    if ([propertyName isEqualToString:@"pluralTestUnique"]) _pluralTestUnique = value;
+    if ([propertyName isEqualToString:@"objectTestRequiredUnique"]) _objectTestRequiredUnique = value;
+    if ([propertyName isEqualToString:@"pluralTestAlphabetic"]) _pluralTestAlphabetic = value;
+    if ([propertyName isEqualToString:@"pinapL1Plural"]) _pinapL1Plural = value;
+    if ([propertyName isEqualToString:@"pinoL1Object"]) _pinoL1Object = value;
+    if ([propertyName isEqualToString:@"onipL1Plural"]) _onipL1Plural = value;
+    if ([propertyName isEqualToString:@"oinoL1Object"]) _oinoL1Object = value;
+    if ([propertyName isEqualToString:@"pinapinapL1Plural"]) _pinapinapL1Plural = value;
+    if ([propertyName isEqualToString:@"pinonipL1Plural"]) _pinonipL1Plural = value;
+    if ([propertyName isEqualToString:@"pinapinoL1Object"]) _pinapinoL1Object = value;
+    if ([propertyName isEqualToString:@"pinoinoL1Object"]) _pinoinoL1Object = value;
+    if ([propertyName isEqualToString:@"onipinapL1Plural"]) _onipinapL1Plural = value;
+    if ([propertyName isEqualToString:@"oinonipL1Plural"]) _oinonipL1Plural = value;
+    if ([propertyName isEqualToString:@"onipinoL1Object"]) _onipinoL1Object = value;
+    if ([propertyName isEqualToString:@"oinoinoL1Object"]) _oinoinoL1Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.uuid ? self.uuid : [NSNull null])
+    [dictionary setObject:(_uuid ? _uuid : [NSNull null])
                    forKey:@"uuid"];
-    [dictionary setObject:(self.created ? [self.created stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_created ? [_created stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"created"];
-    [dictionary setObject:(self.lastUpdated ? [self.lastUpdated stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_lastUpdated ? [_lastUpdated stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"lastUpdated"];
-    [dictionary setObject:(self.email ? self.email : [NSNull null])
+    [dictionary setObject:(_email ? _email : [NSNull null])
                    forKey:@"email"];
-    [dictionary setObject:(self.basicBoolean ? [NSNumber numberWithBool:[self.basicBoolean boolValue]] : [NSNull null])
+    [dictionary setObject:(_basicBoolean ? [NSNumber numberWithBool:[_basicBoolean boolValue]] : [NSNull null])
                    forKey:@"basicBoolean"];
-    [dictionary setObject:(self.basicString ? self.basicString : [NSNull null])
+    [dictionary setObject:(_basicString ? _basicString : [NSNull null])
                    forKey:@"basicString"];
-    [dictionary setObject:(self.basicInteger ? [NSNumber numberWithInteger:[self.basicInteger integerValue]] : [NSNull null])
+    [dictionary setObject:(_basicInteger ? [NSNumber numberWithInteger:[_basicInteger integerValue]] : [NSNull null])
                    forKey:@"basicInteger"];
-    [dictionary setObject:(self.basicDecimal ? self.basicDecimal : [NSNull null])
+    [dictionary setObject:(_basicDecimal ? _basicDecimal : [NSNull null])
                    forKey:@"basicDecimal"];
-    [dictionary setObject:(self.basicDate ? [self.basicDate stringFromISO8601Date] : [NSNull null])
+    [dictionary setObject:(_basicDate ? [_basicDate stringFromISO8601Date] : [NSNull null])
                    forKey:@"basicDate"];
-    [dictionary setObject:(self.basicDateTime ? [self.basicDateTime stringFromISO8601DateTime] : [NSNull null])
+    [dictionary setObject:(_basicDateTime ? [_basicDateTime stringFromISO8601DateTime] : [NSNull null])
                    forKey:@"basicDateTime"];
-    [dictionary setObject:(self.basicIpAddress ? self.basicIpAddress : [NSNull null])
+    [dictionary setObject:(_basicIpAddress ? _basicIpAddress : [NSNull null])
                    forKey:@"basicIpAddress"];
-    [dictionary setObject:(self.basicPassword ? self.basicPassword : [NSNull null])
+    [dictionary setObject:(_basicPassword ? _basicPassword : [NSNull null])
                    forKey:@"basicPassword"];
-    [dictionary setObject:(self.jsonNumber ? self.jsonNumber : [NSNull null])
+    [dictionary setObject:(_jsonNumber ? _jsonNumber : [NSNull null])
                    forKey:@"jsonNumber"];
-    [dictionary setObject:(self.jsonString ? self.jsonString : [NSNull null])
+    [dictionary setObject:(_jsonString ? _jsonString : [NSNull null])
                    forKey:@"jsonString"];
-    [dictionary setObject:(self.jsonArray ? self.jsonArray : [NSNull null])
+    [dictionary setObject:(_jsonArray ? _jsonArray : [NSNull null])
                    forKey:@"jsonArray"];
-    [dictionary setObject:(self.jsonDictionary ? self.jsonDictionary : [NSNull null])
+    [dictionary setObject:(_jsonDictionary ? _jsonDictionary : [NSNull null])
                    forKey:@"jsonDictionary"];
-    [dictionary setObject:(self.stringTestJson ? self.stringTestJson : [NSNull null])
+    [dictionary setObject:(_stringTestJson ? _stringTestJson : [NSNull null])
                    forKey:@"stringTestJson"];
-    [dictionary setObject:(self.stringTestEmpty ? self.stringTestEmpty : [NSNull null])
+    [dictionary setObject:(_stringTestEmpty ? _stringTestEmpty : [NSNull null])
                    forKey:@"stringTestEmpty"];
-    [dictionary setObject:(self.stringTestNull ? self.stringTestNull : [NSNull null])
+    [dictionary setObject:(_stringTestNull ? _stringTestNull : [NSNull null])
                    forKey:@"stringTestNull"];
-    [dictionary setObject:(self.stringTestInvalid ? self.stringTestInvalid : [NSNull null])
+    [dictionary setObject:(_stringTestInvalid ? _stringTestInvalid : [NSNull null])
                    forKey:@"stringTestInvalid"];
-    [dictionary setObject:(self.stringTestNSNull ? self.stringTestNSNull : [NSNull null])
+    [dictionary setObject:(_stringTestNSNull ? _stringTestNSNull : [NSNull null])
                    forKey:@"stringTestNSNull"];
-    [dictionary setObject:(self.stringTestAlphanumeric ? self.stringTestAlphanumeric : [NSNull null])
+    [dictionary setObject:(_stringTestAlphanumeric ? _stringTestAlphanumeric : [NSNull null])
                    forKey:@"stringTestAlphanumeric"];
-    [dictionary setObject:(self.stringTestUnicodeLetters ? self.stringTestUnicodeLetters : [NSNull null])
+    [dictionary setObject:(_stringTestUnicodeLetters ? _stringTestUnicodeLetters : [NSNull null])
                    forKey:@"stringTestUnicodeLetters"];
-    [dictionary setObject:(self.stringTestUnicodePrintable ? self.stringTestUnicodePrintable : [NSNull null])
+    [dictionary setObject:(_stringTestUnicodePrintable ? _stringTestUnicodePrintable : [NSNull null])
                    forKey:@"stringTestUnicodePrintable"];
-    [dictionary setObject:(self.stringTestEmailAddress ? self.stringTestEmailAddress : [NSNull null])
+    [dictionary setObject:(_stringTestEmailAddress ? _stringTestEmailAddress : [NSNull null])
                    forKey:@"stringTestEmailAddress"];
-    [dictionary setObject:(self.stringTestLength ? self.stringTestLength : [NSNull null])
+    [dictionary setObject:(_stringTestLength ? _stringTestLength : [NSNull null])
                    forKey:@"stringTestLength"];
-    [dictionary setObject:(self.stringTestCaseSensitive ? self.stringTestCaseSensitive : [NSNull null])
+    [dictionary setObject:(_stringTestCaseSensitive ? _stringTestCaseSensitive : [NSNull null])
                    forKey:@"stringTestCaseSensitive"];
-    [dictionary setObject:(self.stringTestFeatures ? self.stringTestFeatures : [NSNull null])
+    [dictionary setObject:(_stringTestFeatures ? _stringTestFeatures : [NSNull null])
                    forKey:@"stringTestFeatures"];
-    [dictionary setObject:(self.basicPlural ? [self.basicPlural arrayOfBasicPluralDictionariesFromBasicPluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_basicPlural ? [_basicPlural arrayOfBasicPluralDictionariesFromBasicPluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"basicPlural"];
-    [dictionary setObject:(self.basicObject ? [self.basicObject newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_basicObject ? [_basicObject newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"basicObject"];
-    [dictionary setObject:(self.objectTestRequired ? [self.objectTestRequired newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_objectTestRequired ? [_objectTestRequired newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"objectTestRequired"];
-    [dictionary setObject:(self.pluralTestUnique ? [self.pluralTestUnique arrayOfPluralTestUniqueDictionariesFromPluralTestUniqueElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pluralTestUnique ? [_pluralTestUnique arrayOfPluralTestUniqueDictionariesFromPluralTestUniqueElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pluralTestUnique"];
-    [dictionary setObject:(self.objectTestRequiredUnique ? [self.objectTestRequiredUnique newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_objectTestRequiredUnique ? [_objectTestRequiredUnique newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"objectTestRequiredUnique"];
-    [dictionary setObject:(self.pluralTestAlphabetic ? [self.pluralTestAlphabetic arrayOfPluralTestAlphabeticDictionariesFromPluralTestAlphabeticElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pluralTestAlphabetic ? [_pluralTestAlphabetic arrayOfPluralTestAlphabeticDictionariesFromPluralTestAlphabeticElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pluralTestAlphabetic"];
-    [dictionary setObject:(self.simpleStringPluralOne ? self.simpleStringPluralOne : [NSNull null])
+    [dictionary setObject:(_simpleStringPluralOne ? _simpleStringPluralOne : [NSNull null])
                    forKey:@"simpleStringPluralOne"];
-    [dictionary setObject:(self.simpleStringPluralTwo ? self.simpleStringPluralTwo : [NSNull null])
+    [dictionary setObject:(_simpleStringPluralTwo ? _simpleStringPluralTwo : [NSNull null])
                    forKey:@"simpleStringPluralTwo"];
-    [dictionary setObject:(self.pinapL1Plural ? [self.pinapL1Plural arrayOfPinapL1PluralDictionariesFromPinapL1PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapL1Plural ? [_pinapL1Plural arrayOfPinapL1PluralDictionariesFromPinapL1PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapL1Plural"];
-    [dictionary setObject:(self.pinoL1Object ? [self.pinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinoL1Object ? [_pinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinoL1Object"];
-    [dictionary setObject:(self.onipL1Plural ? [self.onipL1Plural arrayOfOnipL1PluralDictionariesFromOnipL1PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipL1Plural ? [_onipL1Plural arrayOfOnipL1PluralDictionariesFromOnipL1PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipL1Plural"];
-    [dictionary setObject:(self.oinoL1Object ? [self.oinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinoL1Object ? [_oinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinoL1Object"];
-    [dictionary setObject:(self.pinapinapL1Plural ? [self.pinapinapL1Plural arrayOfPinapinapL1PluralDictionariesFromPinapinapL1PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapinapL1Plural ? [_pinapinapL1Plural arrayOfPinapinapL1PluralDictionariesFromPinapinapL1PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapinapL1Plural"];
-    [dictionary setObject:(self.pinonipL1Plural ? [self.pinonipL1Plural arrayOfPinonipL1PluralDictionariesFromPinonipL1PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinonipL1Plural ? [_pinonipL1Plural arrayOfPinonipL1PluralDictionariesFromPinonipL1PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinonipL1Plural"];
-    [dictionary setObject:(self.pinapinoL1Object ? [self.pinapinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapinoL1Object ? [_pinapinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapinoL1Object"];
-    [dictionary setObject:(self.pinoinoL1Object ? [self.pinoinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinoinoL1Object ? [_pinoinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinoinoL1Object"];
-    [dictionary setObject:(self.onipinapL1Plural ? [self.onipinapL1Plural arrayOfOnipinapL1PluralDictionariesFromOnipinapL1PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipinapL1Plural ? [_onipinapL1Plural arrayOfOnipinapL1PluralDictionariesFromOnipinapL1PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipinapL1Plural"];
-    [dictionary setObject:(self.oinonipL1Plural ? [self.oinonipL1Plural arrayOfOinonipL1PluralDictionariesFromOinonipL1PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinonipL1Plural ? [_oinonipL1Plural arrayOfOinonipL1PluralDictionariesFromOinonipL1PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinonipL1Plural"];
-    [dictionary setObject:(self.onipinoL1Object ? [self.onipinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipinoL1Object ? [_onipinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipinoL1Object"];
-    [dictionary setObject:(self.oinoinoL1Object ? [self.oinoinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinoinoL1Object ? [_oinoinoL1Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinoinoL1Object"];
-    [dictionary setObject:(self.captureUserId ? [NSNumber numberWithInteger:[self.captureUserId integerValue]] : [NSNull null])
+    [dictionary setObject:(_captureUserId ? [NSNumber numberWithInteger:[_captureUserId integerValue]] : [NSNull null])
                    forKey:@"id"];
 
     if (forEncoder)
@@ -2103,6 +2327,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -2114,40 +2339,40 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"captureUser"];
 
-    if (self.basicObject)
-        [snapshotDictionary setObject:[self.basicObject snapshotDictionaryFromDirtyPropertySet]
+    if (_basicObject)
+        [snapshotDictionary setObject:[_basicObject snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"basicObject"];
 
-    if (self.objectTestRequired)
-        [snapshotDictionary setObject:[self.objectTestRequired snapshotDictionaryFromDirtyPropertySet]
+    if (_objectTestRequired)
+        [snapshotDictionary setObject:[_objectTestRequired snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"objectTestRequired"];
 
-    if (self.objectTestRequiredUnique)
-        [snapshotDictionary setObject:[self.objectTestRequiredUnique snapshotDictionaryFromDirtyPropertySet]
+    if (_objectTestRequiredUnique)
+        [snapshotDictionary setObject:[_objectTestRequiredUnique snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"objectTestRequiredUnique"];
 
-    if (self.pinoL1Object)
-        [snapshotDictionary setObject:[self.pinoL1Object snapshotDictionaryFromDirtyPropertySet]
+    if (_pinoL1Object)
+        [snapshotDictionary setObject:[_pinoL1Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"pinoL1Object"];
 
-    if (self.oinoL1Object)
-        [snapshotDictionary setObject:[self.oinoL1Object snapshotDictionaryFromDirtyPropertySet]
+    if (_oinoL1Object)
+        [snapshotDictionary setObject:[_oinoL1Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"oinoL1Object"];
 
-    if (self.pinapinoL1Object)
-        [snapshotDictionary setObject:[self.pinapinoL1Object snapshotDictionaryFromDirtyPropertySet]
+    if (_pinapinoL1Object)
+        [snapshotDictionary setObject:[_pinapinoL1Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"pinapinoL1Object"];
 
-    if (self.pinoinoL1Object)
-        [snapshotDictionary setObject:[self.pinoinoL1Object snapshotDictionaryFromDirtyPropertySet]
+    if (_pinoinoL1Object)
+        [snapshotDictionary setObject:[_pinoinoL1Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"pinoinoL1Object"];
 
-    if (self.onipinoL1Object)
-        [snapshotDictionary setObject:[self.onipinoL1Object snapshotDictionaryFromDirtyPropertySet]
+    if (_onipinoL1Object)
+        [snapshotDictionary setObject:[_onipinoL1Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"onipinoL1Object"];
 
-    if (self.oinoinoL1Object)
-        [snapshotDictionary setObject:[self.oinoinoL1Object snapshotDictionaryFromDirtyPropertySet]
+    if (_oinoinoL1Object)
+        [snapshotDictionary setObject:[_oinoinoL1Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"oinoinoL1Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -2155,6 +2380,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"captureUser"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"captureUser"] allObjects]];
 
@@ -2202,159 +2429,159 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"email"])
-        [dictionary setObject:(self.email ? self.email : [NSNull null]) forKey:@"email"];
+        [dictionary setObject:(_email ? _email : [NSNull null]) forKey:@"email"];
 
     if ([self.dirtyPropertySet containsObject:@"basicBoolean"])
-        [dictionary setObject:(self.basicBoolean ? [NSNumber numberWithBool:[self.basicBoolean boolValue]] : [NSNull null]) forKey:@"basicBoolean"];
+        [dictionary setObject:(_basicBoolean ? [NSNumber numberWithBool:[_basicBoolean boolValue]] : [NSNull null]) forKey:@"basicBoolean"];
 
     if ([self.dirtyPropertySet containsObject:@"basicString"])
-        [dictionary setObject:(self.basicString ? self.basicString : [NSNull null]) forKey:@"basicString"];
+        [dictionary setObject:(_basicString ? _basicString : [NSNull null]) forKey:@"basicString"];
 
     if ([self.dirtyPropertySet containsObject:@"basicInteger"])
-        [dictionary setObject:(self.basicInteger ? [NSNumber numberWithInteger:[self.basicInteger integerValue]] : [NSNull null]) forKey:@"basicInteger"];
+        [dictionary setObject:(_basicInteger ? [NSNumber numberWithInteger:[_basicInteger integerValue]] : [NSNull null]) forKey:@"basicInteger"];
 
     if ([self.dirtyPropertySet containsObject:@"basicDecimal"])
-        [dictionary setObject:(self.basicDecimal ? self.basicDecimal : [NSNull null]) forKey:@"basicDecimal"];
+        [dictionary setObject:(_basicDecimal ? _basicDecimal : [NSNull null]) forKey:@"basicDecimal"];
 
     if ([self.dirtyPropertySet containsObject:@"basicDate"])
-        [dictionary setObject:(self.basicDate ? [self.basicDate stringFromISO8601Date] : [NSNull null]) forKey:@"basicDate"];
+        [dictionary setObject:(_basicDate ? [_basicDate stringFromISO8601Date] : [NSNull null]) forKey:@"basicDate"];
 
     if ([self.dirtyPropertySet containsObject:@"basicDateTime"])
-        [dictionary setObject:(self.basicDateTime ? [self.basicDateTime stringFromISO8601DateTime] : [NSNull null]) forKey:@"basicDateTime"];
+        [dictionary setObject:(_basicDateTime ? [_basicDateTime stringFromISO8601DateTime] : [NSNull null]) forKey:@"basicDateTime"];
 
     if ([self.dirtyPropertySet containsObject:@"basicIpAddress"])
-        [dictionary setObject:(self.basicIpAddress ? self.basicIpAddress : [NSNull null]) forKey:@"basicIpAddress"];
+        [dictionary setObject:(_basicIpAddress ? _basicIpAddress : [NSNull null]) forKey:@"basicIpAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"basicPassword"])
-        [dictionary setObject:(self.basicPassword ? self.basicPassword : [NSNull null]) forKey:@"basicPassword"];
+        [dictionary setObject:(_basicPassword ? _basicPassword : [NSNull null]) forKey:@"basicPassword"];
 
     if ([self.dirtyPropertySet containsObject:@"jsonNumber"])
-        [dictionary setObject:(self.jsonNumber ? self.jsonNumber : [NSNull null]) forKey:@"jsonNumber"];
+        [dictionary setObject:(_jsonNumber ? _jsonNumber : [NSNull null]) forKey:@"jsonNumber"];
 
     if ([self.dirtyPropertySet containsObject:@"jsonString"])
-        [dictionary setObject:(self.jsonString ? self.jsonString : [NSNull null]) forKey:@"jsonString"];
+        [dictionary setObject:(_jsonString ? _jsonString : [NSNull null]) forKey:@"jsonString"];
 
     if ([self.dirtyPropertySet containsObject:@"jsonArray"])
-        [dictionary setObject:(self.jsonArray ? self.jsonArray : [NSNull null]) forKey:@"jsonArray"];
+        [dictionary setObject:(_jsonArray ? _jsonArray : [NSNull null]) forKey:@"jsonArray"];
 
     if ([self.dirtyPropertySet containsObject:@"jsonDictionary"])
-        [dictionary setObject:(self.jsonDictionary ? self.jsonDictionary : [NSNull null]) forKey:@"jsonDictionary"];
+        [dictionary setObject:(_jsonDictionary ? _jsonDictionary : [NSNull null]) forKey:@"jsonDictionary"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestJson"])
-        [dictionary setObject:(self.stringTestJson ? self.stringTestJson : [NSNull null]) forKey:@"stringTestJson"];
+        [dictionary setObject:(_stringTestJson ? _stringTestJson : [NSNull null]) forKey:@"stringTestJson"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestEmpty"])
-        [dictionary setObject:(self.stringTestEmpty ? self.stringTestEmpty : [NSNull null]) forKey:@"stringTestEmpty"];
+        [dictionary setObject:(_stringTestEmpty ? _stringTestEmpty : [NSNull null]) forKey:@"stringTestEmpty"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestNull"])
-        [dictionary setObject:(self.stringTestNull ? self.stringTestNull : [NSNull null]) forKey:@"stringTestNull"];
+        [dictionary setObject:(_stringTestNull ? _stringTestNull : [NSNull null]) forKey:@"stringTestNull"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestInvalid"])
-        [dictionary setObject:(self.stringTestInvalid ? self.stringTestInvalid : [NSNull null]) forKey:@"stringTestInvalid"];
+        [dictionary setObject:(_stringTestInvalid ? _stringTestInvalid : [NSNull null]) forKey:@"stringTestInvalid"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestNSNull"])
-        [dictionary setObject:(self.stringTestNSNull ? self.stringTestNSNull : [NSNull null]) forKey:@"stringTestNSNull"];
+        [dictionary setObject:(_stringTestNSNull ? _stringTestNSNull : [NSNull null]) forKey:@"stringTestNSNull"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestAlphanumeric"])
-        [dictionary setObject:(self.stringTestAlphanumeric ? self.stringTestAlphanumeric : [NSNull null]) forKey:@"stringTestAlphanumeric"];
+        [dictionary setObject:(_stringTestAlphanumeric ? _stringTestAlphanumeric : [NSNull null]) forKey:@"stringTestAlphanumeric"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestUnicodeLetters"])
-        [dictionary setObject:(self.stringTestUnicodeLetters ? self.stringTestUnicodeLetters : [NSNull null]) forKey:@"stringTestUnicodeLetters"];
+        [dictionary setObject:(_stringTestUnicodeLetters ? _stringTestUnicodeLetters : [NSNull null]) forKey:@"stringTestUnicodeLetters"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestUnicodePrintable"])
-        [dictionary setObject:(self.stringTestUnicodePrintable ? self.stringTestUnicodePrintable : [NSNull null]) forKey:@"stringTestUnicodePrintable"];
+        [dictionary setObject:(_stringTestUnicodePrintable ? _stringTestUnicodePrintable : [NSNull null]) forKey:@"stringTestUnicodePrintable"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestEmailAddress"])
-        [dictionary setObject:(self.stringTestEmailAddress ? self.stringTestEmailAddress : [NSNull null]) forKey:@"stringTestEmailAddress"];
+        [dictionary setObject:(_stringTestEmailAddress ? _stringTestEmailAddress : [NSNull null]) forKey:@"stringTestEmailAddress"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestLength"])
-        [dictionary setObject:(self.stringTestLength ? self.stringTestLength : [NSNull null]) forKey:@"stringTestLength"];
+        [dictionary setObject:(_stringTestLength ? _stringTestLength : [NSNull null]) forKey:@"stringTestLength"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestCaseSensitive"])
-        [dictionary setObject:(self.stringTestCaseSensitive ? self.stringTestCaseSensitive : [NSNull null]) forKey:@"stringTestCaseSensitive"];
+        [dictionary setObject:(_stringTestCaseSensitive ? _stringTestCaseSensitive : [NSNull null]) forKey:@"stringTestCaseSensitive"];
 
     if ([self.dirtyPropertySet containsObject:@"stringTestFeatures"])
-        [dictionary setObject:(self.stringTestFeatures ? self.stringTestFeatures : [NSNull null]) forKey:@"stringTestFeatures"];
+        [dictionary setObject:(_stringTestFeatures ? _stringTestFeatures : [NSNull null]) forKey:@"stringTestFeatures"];
 
     if ([self.dirtyPropertySet containsObject:@"basicObject"])
-        [dictionary setObject:(self.basicObject ?
-                              [self.basicObject toUpdateDictionary] :
+        [dictionary setObject:(_basicObject ?
+                              [_basicObject toUpdateDictionary] :
                               [[JRBasicObject basicObject] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"basicObject"];
-    else if ([self.basicObject needsUpdate])
-        [dictionary setObject:[self.basicObject toUpdateDictionary]
+    else if ([_basicObject needsUpdate])
+        [dictionary setObject:[_basicObject toUpdateDictionary]
                        forKey:@"basicObject"];
 
     if ([self.dirtyPropertySet containsObject:@"objectTestRequired"])
-        [dictionary setObject:(self.objectTestRequired ?
-                              [self.objectTestRequired toUpdateDictionary] :
+        [dictionary setObject:(_objectTestRequired ?
+                              [_objectTestRequired toUpdateDictionary] :
                               [[JRObjectTestRequired objectTestRequired] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"objectTestRequired"];
-    else if ([self.objectTestRequired needsUpdate])
-        [dictionary setObject:[self.objectTestRequired toUpdateDictionary]
+    else if ([_objectTestRequired needsUpdate])
+        [dictionary setObject:[_objectTestRequired toUpdateDictionary]
                        forKey:@"objectTestRequired"];
 
     if ([self.dirtyPropertySet containsObject:@"objectTestRequiredUnique"])
-        [dictionary setObject:(self.objectTestRequiredUnique ?
-                              [self.objectTestRequiredUnique toUpdateDictionary] :
+        [dictionary setObject:(_objectTestRequiredUnique ?
+                              [_objectTestRequiredUnique toUpdateDictionary] :
                               [[JRObjectTestRequiredUnique objectTestRequiredUnique] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"objectTestRequiredUnique"];
-    else if ([self.objectTestRequiredUnique needsUpdate])
-        [dictionary setObject:[self.objectTestRequiredUnique toUpdateDictionary]
+    else if ([_objectTestRequiredUnique needsUpdate])
+        [dictionary setObject:[_objectTestRequiredUnique toUpdateDictionary]
                        forKey:@"objectTestRequiredUnique"];
 
     if ([self.dirtyPropertySet containsObject:@"pinoL1Object"])
-        [dictionary setObject:(self.pinoL1Object ?
-                              [self.pinoL1Object toUpdateDictionary] :
+        [dictionary setObject:(_pinoL1Object ?
+                              [_pinoL1Object toUpdateDictionary] :
                               [[JRPinoL1Object pinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"pinoL1Object"];
-    else if ([self.pinoL1Object needsUpdate])
-        [dictionary setObject:[self.pinoL1Object toUpdateDictionary]
+    else if ([_pinoL1Object needsUpdate])
+        [dictionary setObject:[_pinoL1Object toUpdateDictionary]
                        forKey:@"pinoL1Object"];
 
     if ([self.dirtyPropertySet containsObject:@"oinoL1Object"])
-        [dictionary setObject:(self.oinoL1Object ?
-                              [self.oinoL1Object toUpdateDictionary] :
+        [dictionary setObject:(_oinoL1Object ?
+                              [_oinoL1Object toUpdateDictionary] :
                               [[JROinoL1Object oinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"oinoL1Object"];
-    else if ([self.oinoL1Object needsUpdate])
-        [dictionary setObject:[self.oinoL1Object toUpdateDictionary]
+    else if ([_oinoL1Object needsUpdate])
+        [dictionary setObject:[_oinoL1Object toUpdateDictionary]
                        forKey:@"oinoL1Object"];
 
     if ([self.dirtyPropertySet containsObject:@"pinapinoL1Object"])
-        [dictionary setObject:(self.pinapinoL1Object ?
-                              [self.pinapinoL1Object toUpdateDictionary] :
+        [dictionary setObject:(_pinapinoL1Object ?
+                              [_pinapinoL1Object toUpdateDictionary] :
                               [[JRPinapinoL1Object pinapinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"pinapinoL1Object"];
-    else if ([self.pinapinoL1Object needsUpdate])
-        [dictionary setObject:[self.pinapinoL1Object toUpdateDictionary]
+    else if ([_pinapinoL1Object needsUpdate])
+        [dictionary setObject:[_pinapinoL1Object toUpdateDictionary]
                        forKey:@"pinapinoL1Object"];
 
     if ([self.dirtyPropertySet containsObject:@"pinoinoL1Object"])
-        [dictionary setObject:(self.pinoinoL1Object ?
-                              [self.pinoinoL1Object toUpdateDictionary] :
+        [dictionary setObject:(_pinoinoL1Object ?
+                              [_pinoinoL1Object toUpdateDictionary] :
                               [[JRPinoinoL1Object pinoinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"pinoinoL1Object"];
-    else if ([self.pinoinoL1Object needsUpdate])
-        [dictionary setObject:[self.pinoinoL1Object toUpdateDictionary]
+    else if ([_pinoinoL1Object needsUpdate])
+        [dictionary setObject:[_pinoinoL1Object toUpdateDictionary]
                        forKey:@"pinoinoL1Object"];
 
     if ([self.dirtyPropertySet containsObject:@"onipinoL1Object"])
-        [dictionary setObject:(self.onipinoL1Object ?
-                              [self.onipinoL1Object toUpdateDictionary] :
+        [dictionary setObject:(_onipinoL1Object ?
+                              [_onipinoL1Object toUpdateDictionary] :
                               [[JROnipinoL1Object onipinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"onipinoL1Object"];
-    else if ([self.onipinoL1Object needsUpdate])
-        [dictionary setObject:[self.onipinoL1Object toUpdateDictionary]
+    else if ([_onipinoL1Object needsUpdate])
+        [dictionary setObject:[_onipinoL1Object toUpdateDictionary]
                        forKey:@"onipinoL1Object"];
 
     if ([self.dirtyPropertySet containsObject:@"oinoinoL1Object"])
-        [dictionary setObject:(self.oinoinoL1Object ?
-                              [self.oinoinoL1Object toUpdateDictionary] :
+        [dictionary setObject:(_oinoinoL1Object ?
+                              [_oinoinoL1Object toUpdateDictionary] :
                               [[JROinoinoL1Object oinoinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"oinoinoL1Object"];
-    else if ([self.oinoinoL1Object needsUpdate])
-        [dictionary setObject:[self.oinoinoL1Object toUpdateDictionary]
+    else if ([_oinoinoL1Object needsUpdate])
+        [dictionary setObject:[_oinoinoL1Object toUpdateDictionary]
                        forKey:@"oinoinoL1Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -2371,129 +2598,129 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.email ? self.email : [NSNull null]) forKey:@"email"];
-    [dictionary setObject:(self.basicBoolean ? [NSNumber numberWithBool:[self.basicBoolean boolValue]] : [NSNull null]) forKey:@"basicBoolean"];
-    [dictionary setObject:(self.basicString ? self.basicString : [NSNull null]) forKey:@"basicString"];
-    [dictionary setObject:(self.basicInteger ? [NSNumber numberWithInteger:[self.basicInteger integerValue]] : [NSNull null]) forKey:@"basicInteger"];
-    [dictionary setObject:(self.basicDecimal ? self.basicDecimal : [NSNull null]) forKey:@"basicDecimal"];
-    [dictionary setObject:(self.basicDate ? [self.basicDate stringFromISO8601Date] : [NSNull null]) forKey:@"basicDate"];
-    [dictionary setObject:(self.basicDateTime ? [self.basicDateTime stringFromISO8601DateTime] : [NSNull null]) forKey:@"basicDateTime"];
-    [dictionary setObject:(self.basicIpAddress ? self.basicIpAddress : [NSNull null]) forKey:@"basicIpAddress"];
-    [dictionary setObject:(self.basicPassword ? self.basicPassword : [NSNull null]) forKey:@"basicPassword"];
-    [dictionary setObject:(self.jsonNumber ? self.jsonNumber : [NSNull null]) forKey:@"jsonNumber"];
-    [dictionary setObject:(self.jsonString ? self.jsonString : [NSNull null]) forKey:@"jsonString"];
-    [dictionary setObject:(self.jsonArray ? self.jsonArray : [NSNull null]) forKey:@"jsonArray"];
-    [dictionary setObject:(self.jsonDictionary ? self.jsonDictionary : [NSNull null]) forKey:@"jsonDictionary"];
-    [dictionary setObject:(self.stringTestJson ? self.stringTestJson : [NSNull null]) forKey:@"stringTestJson"];
-    [dictionary setObject:(self.stringTestEmpty ? self.stringTestEmpty : [NSNull null]) forKey:@"stringTestEmpty"];
-    [dictionary setObject:(self.stringTestNull ? self.stringTestNull : [NSNull null]) forKey:@"stringTestNull"];
-    [dictionary setObject:(self.stringTestInvalid ? self.stringTestInvalid : [NSNull null]) forKey:@"stringTestInvalid"];
-    [dictionary setObject:(self.stringTestNSNull ? self.stringTestNSNull : [NSNull null]) forKey:@"stringTestNSNull"];
-    [dictionary setObject:(self.stringTestAlphanumeric ? self.stringTestAlphanumeric : [NSNull null]) forKey:@"stringTestAlphanumeric"];
-    [dictionary setObject:(self.stringTestUnicodeLetters ? self.stringTestUnicodeLetters : [NSNull null]) forKey:@"stringTestUnicodeLetters"];
-    [dictionary setObject:(self.stringTestUnicodePrintable ? self.stringTestUnicodePrintable : [NSNull null]) forKey:@"stringTestUnicodePrintable"];
-    [dictionary setObject:(self.stringTestEmailAddress ? self.stringTestEmailAddress : [NSNull null]) forKey:@"stringTestEmailAddress"];
-    [dictionary setObject:(self.stringTestLength ? self.stringTestLength : [NSNull null]) forKey:@"stringTestLength"];
-    [dictionary setObject:(self.stringTestCaseSensitive ? self.stringTestCaseSensitive : [NSNull null]) forKey:@"stringTestCaseSensitive"];
-    [dictionary setObject:(self.stringTestFeatures ? self.stringTestFeatures : [NSNull null]) forKey:@"stringTestFeatures"];
-
-    [dictionary setObject:(self.basicPlural ?
-                          [self.basicPlural arrayOfBasicPluralReplaceDictionariesFromBasicPluralElements] :
+    [dictionary setObject:(_email ? _email : [NSNull null]) forKey:@"email"];
+    [dictionary setObject:(_basicBoolean ? [NSNumber numberWithBool:[_basicBoolean boolValue]] : [NSNull null]) forKey:@"basicBoolean"];
+    [dictionary setObject:(_basicString ? _basicString : [NSNull null]) forKey:@"basicString"];
+    [dictionary setObject:(_basicInteger ? [NSNumber numberWithInteger:[_basicInteger integerValue]] : [NSNull null]) forKey:@"basicInteger"];
+    [dictionary setObject:(_basicDecimal ? _basicDecimal : [NSNull null]) forKey:@"basicDecimal"];
+    [dictionary setObject:(_basicDate ? [_basicDate stringFromISO8601Date] : [NSNull null]) forKey:@"basicDate"];
+    [dictionary setObject:(_basicDateTime ? [_basicDateTime stringFromISO8601DateTime] : [NSNull null]) forKey:@"basicDateTime"];
+    [dictionary setObject:(_basicIpAddress ? _basicIpAddress : [NSNull null]) forKey:@"basicIpAddress"];
+    [dictionary setObject:(_basicPassword ? _basicPassword : [NSNull null]) forKey:@"basicPassword"];
+    [dictionary setObject:(_jsonNumber ? _jsonNumber : [NSNull null]) forKey:@"jsonNumber"];
+    [dictionary setObject:(_jsonString ? _jsonString : [NSNull null]) forKey:@"jsonString"];
+    [dictionary setObject:(_jsonArray ? _jsonArray : [NSNull null]) forKey:@"jsonArray"];
+    [dictionary setObject:(_jsonDictionary ? _jsonDictionary : [NSNull null]) forKey:@"jsonDictionary"];
+    [dictionary setObject:(_stringTestJson ? _stringTestJson : [NSNull null]) forKey:@"stringTestJson"];
+    [dictionary setObject:(_stringTestEmpty ? _stringTestEmpty : [NSNull null]) forKey:@"stringTestEmpty"];
+    [dictionary setObject:(_stringTestNull ? _stringTestNull : [NSNull null]) forKey:@"stringTestNull"];
+    [dictionary setObject:(_stringTestInvalid ? _stringTestInvalid : [NSNull null]) forKey:@"stringTestInvalid"];
+    [dictionary setObject:(_stringTestNSNull ? _stringTestNSNull : [NSNull null]) forKey:@"stringTestNSNull"];
+    [dictionary setObject:(_stringTestAlphanumeric ? _stringTestAlphanumeric : [NSNull null]) forKey:@"stringTestAlphanumeric"];
+    [dictionary setObject:(_stringTestUnicodeLetters ? _stringTestUnicodeLetters : [NSNull null]) forKey:@"stringTestUnicodeLetters"];
+    [dictionary setObject:(_stringTestUnicodePrintable ? _stringTestUnicodePrintable : [NSNull null]) forKey:@"stringTestUnicodePrintable"];
+    [dictionary setObject:(_stringTestEmailAddress ? _stringTestEmailAddress : [NSNull null]) forKey:@"stringTestEmailAddress"];
+    [dictionary setObject:(_stringTestLength ? _stringTestLength : [NSNull null]) forKey:@"stringTestLength"];
+    [dictionary setObject:(_stringTestCaseSensitive ? _stringTestCaseSensitive : [NSNull null]) forKey:@"stringTestCaseSensitive"];
+    [dictionary setObject:(_stringTestFeatures ? _stringTestFeatures : [NSNull null]) forKey:@"stringTestFeatures"];
+
+    [dictionary setObject:(_basicPlural ?
+                          [_basicPlural arrayOfBasicPluralReplaceDictionariesFromBasicPluralElements] :
                           [NSArray array])
                    forKey:@"basicPlural"];
 
-    [dictionary setObject:(self.basicObject ?
-                          [self.basicObject toReplaceDictionary] :
+    [dictionary setObject:(_basicObject ?
+                          [_basicObject toReplaceDictionary] :
                           [[JRBasicObject basicObject] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"basicObject"];
 
-    [dictionary setObject:(self.objectTestRequired ?
-                          [self.objectTestRequired toReplaceDictionary] :
+    [dictionary setObject:(_objectTestRequired ?
+                          [_objectTestRequired toReplaceDictionary] :
                           [[JRObjectTestRequired objectTestRequired] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"objectTestRequired"];
 
-    [dictionary setObject:(self.pluralTestUnique ?
-                          [self.pluralTestUnique arrayOfPluralTestUniqueReplaceDictionariesFromPluralTestUniqueElements] :
+    [dictionary setObject:(_pluralTestUnique ?
+                          [_pluralTestUnique arrayOfPluralTestUniqueReplaceDictionariesFromPluralTestUniqueElements] :
                           [NSArray array])
                    forKey:@"pluralTestUnique"];
 
-    [dictionary setObject:(self.objectTestRequiredUnique ?
-                          [self.objectTestRequiredUnique toReplaceDictionary] :
+    [dictionary setObject:(_objectTestRequiredUnique ?
+                          [_objectTestRequiredUnique toReplaceDictionary] :
                           [[JRObjectTestRequiredUnique objectTestRequiredUnique] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"objectTestRequiredUnique"];
 
-    [dictionary setObject:(self.pluralTestAlphabetic ?
-                          [self.pluralTestAlphabetic arrayOfPluralTestAlphabeticReplaceDictionariesFromPluralTestAlphabeticElements] :
+    [dictionary setObject:(_pluralTestAlphabetic ?
+                          [_pluralTestAlphabetic arrayOfPluralTestAlphabeticReplaceDictionariesFromPluralTestAlphabeticElements] :
                           [NSArray array])
                    forKey:@"pluralTestAlphabetic"];
 
-    [dictionary setObject:(self.simpleStringPluralOne ?
-                          self.simpleStringPluralOne :
+    [dictionary setObject:(_simpleStringPluralOne ?
+                          _simpleStringPluralOne :
                           [NSArray array])
                    forKey:@"simpleStringPluralOne"];
 
-    [dictionary setObject:(self.simpleStringPluralTwo ?
-                          self.simpleStringPluralTwo :
+    [dictionary setObject:(_simpleStringPluralTwo ?
+                          _simpleStringPluralTwo :
                           [NSArray array])
                    forKey:@"simpleStringPluralTwo"];
 
-    [dictionary setObject:(self.pinapL1Plural ?
-                          [self.pinapL1Plural arrayOfPinapL1PluralReplaceDictionariesFromPinapL1PluralElements] :
+    [dictionary setObject:(_pinapL1Plural ?
+                          [_pinapL1Plural arrayOfPinapL1PluralReplaceDictionariesFromPinapL1PluralElements] :
                           [NSArray array])
                    forKey:@"pinapL1Plural"];
 
-    [dictionary setObject:(self.pinoL1Object ?
-                          [self.pinoL1Object toReplaceDictionary] :
+    [dictionary setObject:(_pinoL1Object ?
+                          [_pinoL1Object toReplaceDictionary] :
                           [[JRPinoL1Object pinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"pinoL1Object"];
 
-    [dictionary setObject:(self.onipL1Plural ?
-                          [self.onipL1Plural arrayOfOnipL1PluralReplaceDictionariesFromOnipL1PluralElements] :
+    [dictionary setObject:(_onipL1Plural ?
+                          [_onipL1Plural arrayOfOnipL1PluralReplaceDictionariesFromOnipL1PluralElements] :
                           [NSArray array])
                    forKey:@"onipL1Plural"];
 
-    [dictionary setObject:(self.oinoL1Object ?
-                          [self.oinoL1Object toReplaceDictionary] :
+    [dictionary setObject:(_oinoL1Object ?
+                          [_oinoL1Object toReplaceDictionary] :
                           [[JROinoL1Object oinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"oinoL1Object"];
 
-    [dictionary setObject:(self.pinapinapL1Plural ?
-                          [self.pinapinapL1Plural arrayOfPinapinapL1PluralReplaceDictionariesFromPinapinapL1PluralElements] :
+    [dictionary setObject:(_pinapinapL1Plural ?
+                          [_pinapinapL1Plural arrayOfPinapinapL1PluralReplaceDictionariesFromPinapinapL1PluralElements] :
                           [NSArray array])
                    forKey:@"pinapinapL1Plural"];
 
-    [dictionary setObject:(self.pinonipL1Plural ?
-                          [self.pinonipL1Plural arrayOfPinonipL1PluralReplaceDictionariesFromPinonipL1PluralElements] :
+    [dictionary setObject:(_pinonipL1Plural ?
+                          [_pinonipL1Plural arrayOfPinonipL1PluralReplaceDictionariesFromPinonipL1PluralElements] :
                           [NSArray array])
                    forKey:@"pinonipL1Plural"];
 
-    [dictionary setObject:(self.pinapinoL1Object ?
-                          [self.pinapinoL1Object toReplaceDictionary] :
+    [dictionary setObject:(_pinapinoL1Object ?
+                          [_pinapinoL1Object toReplaceDictionary] :
                           [[JRPinapinoL1Object pinapinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"pinapinoL1Object"];
 
-    [dictionary setObject:(self.pinoinoL1Object ?
-                          [self.pinoinoL1Object toReplaceDictionary] :
+    [dictionary setObject:(_pinoinoL1Object ?
+                          [_pinoinoL1Object toReplaceDictionary] :
                           [[JRPinoinoL1Object pinoinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"pinoinoL1Object"];
 
-    [dictionary setObject:(self.onipinapL1Plural ?
-                          [self.onipinapL1Plural arrayOfOnipinapL1PluralReplaceDictionariesFromOnipinapL1PluralElements] :
+    [dictionary setObject:(_onipinapL1Plural ?
+                          [_onipinapL1Plural arrayOfOnipinapL1PluralReplaceDictionariesFromOnipinapL1PluralElements] :
                           [NSArray array])
                    forKey:@"onipinapL1Plural"];
 
-    [dictionary setObject:(self.oinonipL1Plural ?
-                          [self.oinonipL1Plural arrayOfOinonipL1PluralReplaceDictionariesFromOinonipL1PluralElements] :
+    [dictionary setObject:(_oinonipL1Plural ?
+                          [_oinonipL1Plural arrayOfOinonipL1PluralReplaceDictionariesFromOinonipL1PluralElements] :
                           [NSArray array])
                    forKey:@"oinonipL1Plural"];
 
-    [dictionary setObject:(self.onipinoL1Object ?
-                          [self.onipinoL1Object toReplaceDictionary] :
+    [dictionary setObject:(_onipinoL1Object ?
+                          [_onipinoL1Object toReplaceDictionary] :
                           [[JROnipinoL1Object onipinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"onipinoL1Object"];
 
-    [dictionary setObject:(self.oinoinoL1Object ?
-                          [self.oinoinoL1Object toReplaceDictionary] :
+    [dictionary setObject:(_oinoinoL1Object ?
+                          [_oinoinoL1Object toReplaceDictionary] :
                           [[JROinoinoL1Object oinoinoL1Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"oinoinoL1Object"];
 
@@ -2572,31 +2799,31 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.basicObject needsUpdate])
+    if ([_basicObject needsUpdate])
         return YES;
 
-    if ([self.objectTestRequired needsUpdate])
+    if ([_objectTestRequired needsUpdate])
         return YES;
 
-    if ([self.objectTestRequiredUnique needsUpdate])
+    if ([_objectTestRequiredUnique needsUpdate])
         return YES;
 
-    if ([self.pinoL1Object needsUpdate])
+    if ([_pinoL1Object needsUpdate])
         return YES;
 
-    if ([self.oinoL1Object needsUpdate])
+    if ([_oinoL1Object needsUpdate])
         return YES;
 
-    if ([self.pinapinoL1Object needsUpdate])
+    if ([_pinapinoL1Object needsUpdate])
         return YES;
 
-    if ([self.pinoinoL1Object needsUpdate])
+    if ([_pinoinoL1Object needsUpdate])
         return YES;
 
-    if ([self.onipinoL1Object needsUpdate])
+    if ([_onipinoL1Object needsUpdate])
         return YES;
 
-    if ([self.oinoinoL1Object needsUpdate])
+    if ([_oinoinoL1Object needsUpdate])
         return YES;
 
     return NO;
@@ -2604,209 +2831,273 @@
 
 - (BOOL)isEqualToCaptureUser:(JRCaptureUser *)otherCaptureUser
 {
-    if (!self.email && !otherCaptureUser.email) /* Keep going... */;
-    else if ((self.email == nil) ^ (otherCaptureUser.email == nil)) return NO; // xor
-    else if (![self.email isEqualToString:otherCaptureUser.email]) return NO;
+    if (!otherCaptureUser) return NO;
+    if ([self hash] != [otherCaptureUser hash]) return NO;
+
+    if (!_email && !otherCaptureUser->_email) /* Keep going... */;
+    else if ((_email == nil) ^ (otherCaptureUser->_email == nil)) return NO; // xor
+    else if (![_email isEqualToString:otherCaptureUser->_email]) return NO;
 
-    if (!self.basicBoolean && !otherCaptureUser.basicBoolean) /* Keep going... */;
-    else if ((self.basicBoolean == nil) ^ (otherCaptureUser.basicBoolean == nil)) return NO; // xor
-    else if (![self.basicBoolean isEqualToNumber:otherCaptureUser.basicBoolean]) return NO;
+    if (!_basicBoolean && !otherCaptureUser->_basicBoolean) /* Keep going... */;
+    else if ((_basicBoolean == nil) ^ (otherCaptureUser->_basicBoolean == nil)) return NO; // xor
+    else if (![_basicBoolean isEqualToNumber:otherCaptureUser->_basicBoolean]) return NO;
 
-    if (!self.basicString && !otherCaptureUser.basicString) /* Keep going... */;
-    else if ((self.basicString == nil) ^ (otherCaptureUser.basicString == nil)) return NO; // xor
-    else if (![self.basicString isEqualToString:otherCaptureUser.basicString]) return NO;
+    if (!_basicString && !otherCaptureUser->_basicString) /* Keep going... */;
+    else if ((_basicString == nil) ^ (otherCaptureUser->_basicString == nil)) return NO; // xor
+    else if (![_basicString isEqualToString:otherCaptureUser->_basicString]) return NO;
 
-    if (!self.basicInteger && !otherCaptureUser.basicInteger) /* Keep going... */;
-    else if ((self.basicInteger == nil) ^ (otherCaptureUser.basicInteger == nil)) return NO; // xor
-    else if (![self.basicInteger isEqualToNumber:otherCaptureUser.basicInteger]) return NO;
+    if (!_basicInteger && !otherCaptureUser->_basicInteger) /* Keep going... */;
+    else if ((_basicInteger == nil) ^ (otherCaptureUser->_basicInteger == nil)) return NO; // xor
+    else if (![_basicInteger isEqualToNumber:otherCaptureUser->_basicInteger]) return NO;
 
-    if (!self.basicDecimal && !otherCaptureUser.basicDecimal) /* Keep going... */;
-    else if ((self.basicDecimal == nil) ^ (otherCaptureUser.basicDecimal == nil)) return NO; // xor
-    else if (![self.basicDecimal isEqualToNumber:otherCaptureUser.basicDecimal]) return NO;
+    if (!_basicDecimal && !otherCaptureUser->_basicDecimal) /* Keep going... */;
+    else if ((_basicDecimal == nil) ^ (otherCaptureUser->_basicDecimal == nil)) return NO; // xor
+    else if (![_basicDecimal isEqualToNumber:otherCaptureUser->_basicDecimal]) return NO;
 
-    if (!self.basicDate && !otherCaptureUser.basicDate) /* Keep going... */;
-    else if ((self.basicDate == nil) ^ (otherCaptureUser.basicDate == nil)) return NO; // xor
-    else if (![self.basicDate isEqualToDate:otherCaptureUser.basicDate]) return NO;
-
-    if (!self.basicDateTime && !otherCaptureUser.basicDateTime) /* Keep going... */;
-    else if ((self.basicDateTime == nil) ^ (otherCaptureUser.basicDateTime == nil)) return NO; // xor
-    else if (![self.basicDateTime isEqualToDate:otherCaptureUser.basicDateTime]) return NO;
-
-    if (!self.basicIpAddress && !otherCaptureUser.basicIpAddress) /* Keep going... */;
-    else if ((self.basicIpAddress == nil) ^ (otherCaptureUser.basicIpAddress == nil)) return NO; // xor
-    else if (![self.basicIpAddress isEqualToString:otherCaptureUser.basicIpAddress]) return NO;
-
-    if (!self.basicPassword && !otherCaptureUser.basicPassword) /* Keep going... */;
-    else if ((self.basicPassword == nil) ^ (otherCaptureUser.basicPassword == nil)) return NO; // xor
-    else if (![self.basicPassword isEqual:otherCaptureUser.basicPassword]) return NO;
-
-    if (!self.jsonNumber && !otherCaptureUser.jsonNumber) /* Keep going... */;
-    else if ((self.jsonNumber == nil) ^ (otherCaptureUser.jsonNumber == nil)) return NO; // xor
-    else if (![self.jsonNumber isEqual:otherCaptureUser.jsonNumber]) return NO;
-
-    if (!self.jsonString && !otherCaptureUser.jsonString) /* Keep going... */;
-    else if ((self.jsonString == nil) ^ (otherCaptureUser.jsonString == nil)) return NO; // xor
-    else if (![self.jsonString isEqual:otherCaptureUser.jsonString]) return NO;
-
-    if (!self.jsonArray && !otherCaptureUser.jsonArray) /* Keep going... */;
-    else if ((self.jsonArray == nil) ^ (otherCaptureUser.jsonArray == nil)) return NO; // xor
-    else if (![self.jsonArray isEqual:otherCaptureUser.jsonArray]) return NO;
-
-    if (!self.jsonDictionary && !otherCaptureUser.jsonDictionary) /* Keep going... */;
-    else if ((self.jsonDictionary == nil) ^ (otherCaptureUser.jsonDictionary == nil)) return NO; // xor
-    else if (![self.jsonDictionary isEqual:otherCaptureUser.jsonDictionary]) return NO;
-
-    if (!self.stringTestJson && !otherCaptureUser.stringTestJson) /* Keep going... */;
-    else if ((self.stringTestJson == nil) ^ (otherCaptureUser.stringTestJson == nil)) return NO; // xor
-    else if (![self.stringTestJson isEqualToString:otherCaptureUser.stringTestJson]) return NO;
-
-    if (!self.stringTestEmpty && !otherCaptureUser.stringTestEmpty) /* Keep going... */;
-    else if ((self.stringTestEmpty == nil) ^ (otherCaptureUser.stringTestEmpty == nil)) return NO; // xor
-    else if (![self.stringTestEmpty isEqualToString:otherCaptureUser.stringTestEmpty]) return NO;
-
-    if (!self.stringTestNull && !otherCaptureUser.stringTestNull) /* Keep going... */;
-    else if ((self.stringTestNull == nil) ^ (otherCaptureUser.stringTestNull == nil)) return NO; // xor
-    else if (![self.stringTestNull isEqualToString:otherCaptureUser.stringTestNull]) return NO;
-
-    if (!self.stringTestInvalid && !otherCaptureUser.stringTestInvalid) /* Keep going... */;
-    else if ((self.stringTestInvalid == nil) ^ (otherCaptureUser.stringTestInvalid == nil)) return NO; // xor
-    else if (![self.stringTestInvalid isEqualToString:otherCaptureUser.stringTestInvalid]) return NO;
-
-    if (!self.stringTestNSNull && !otherCaptureUser.stringTestNSNull) /* Keep going... */;
-    else if ((self.stringTestNSNull == nil) ^ (otherCaptureUser.stringTestNSNull == nil)) return NO; // xor
-    else if (![self.stringTestNSNull isEqualToString:otherCaptureUser.stringTestNSNull]) return NO;
-
-    if (!self.stringTestAlphanumeric && !otherCaptureUser.stringTestAlphanumeric) /* Keep going... */;
-    else if ((self.stringTestAlphanumeric == nil) ^ (otherCaptureUser.stringTestAlphanumeric == nil)) return NO; // xor
-    else if (![self.stringTestAlphanumeric isEqualToString:otherCaptureUser.stringTestAlphanumeric]) return NO;
-
-    if (!self.stringTestUnicodeLetters && !otherCaptureUser.stringTestUnicodeLetters) /* Keep going... */;
-    else if ((self.stringTestUnicodeLetters == nil) ^ (otherCaptureUser.stringTestUnicodeLetters == nil)) return NO; // xor
-    else if (![self.stringTestUnicodeLetters isEqualToString:otherCaptureUser.stringTestUnicodeLetters]) return NO;
-
-    if (!self.stringTestUnicodePrintable && !otherCaptureUser.stringTestUnicodePrintable) /* Keep going... */;
-    else if ((self.stringTestUnicodePrintable == nil) ^ (otherCaptureUser.stringTestUnicodePrintable == nil)) return NO; // xor
-    else if (![self.stringTestUnicodePrintable isEqualToString:otherCaptureUser.stringTestUnicodePrintable]) return NO;
-
-    if (!self.stringTestEmailAddress && !otherCaptureUser.stringTestEmailAddress) /* Keep going... */;
-    else if ((self.stringTestEmailAddress == nil) ^ (otherCaptureUser.stringTestEmailAddress == nil)) return NO; // xor
-    else if (![self.stringTestEmailAddress isEqualToString:otherCaptureUser.stringTestEmailAddress]) return NO;
-
-    if (!self.stringTestLength && !otherCaptureUser.stringTestLength) /* Keep going... */;
-    else if ((self.stringTestLength == nil) ^ (otherCaptureUser.stringTestLength == nil)) return NO; // xor
-    else if (![self.stringTestLength isEqualToString:otherCaptureUser.stringTestLength]) return NO;
-
-    if (!self.stringTestCaseSensitive && !otherCaptureUser.stringTestCaseSensitive) /* Keep going... */;
-    else if ((self.stringTestCaseSensitive == nil) ^ (otherCaptureUser.stringTestCaseSensitive == nil)) return NO; // xor
-    else if (![self.stringTestCaseSensitive isEqualToString:otherCaptureUser.stringTestCaseSensitive]) return NO;
-
-    if (!self.stringTestFeatures && !otherCaptureUser.stringTestFeatures) /* Keep going... */;
-    else if ((self.stringTestFeatures == nil) ^ (otherCaptureUser.stringTestFeatures == nil)) return NO; // xor
-    else if (![self.stringTestFeatures isEqualToString:otherCaptureUser.stringTestFeatures]) return NO;
-
-    if (!self.basicPlural && !otherCaptureUser.basicPlural) /* Keep going... */;
-    else if (!self.basicPlural && ![otherCaptureUser.basicPlural count]) /* Keep going... */;
-    else if (!otherCaptureUser.basicPlural && ![self.basicPlural count]) /* Keep going... */;
-    else if (![self.basicPlural isEqualToBasicPluralArray:otherCaptureUser.basicPlural]) return NO;
-
-    if (!self.basicObject && !otherCaptureUser.basicObject) /* Keep going... */;
-    else if (!self.basicObject && [otherCaptureUser.basicObject isEqualToBasicObject:[JRBasicObject basicObject]]) /* Keep going... */;
-    else if (!otherCaptureUser.basicObject && [self.basicObject isEqualToBasicObject:[JRBasicObject basicObject]]) /* Keep going... */;
-    else if (![self.basicObject isEqualToBasicObject:otherCaptureUser.basicObject]) return NO;
-
-    if (!self.objectTestRequired && !otherCaptureUser.objectTestRequired) /* Keep going... */;
-    else if (!self.objectTestRequired && [otherCaptureUser.objectTestRequired isEqualToObjectTestRequired:[JRObjectTestRequired objectTestRequired]]) /* Keep going... */;
-    else if (!otherCaptureUser.objectTestRequired && [self.objectTestRequired isEqualToObjectTestRequired:[JRObjectTestRequired objectTestRequired]]) /* Keep going... */;
-    else if (![self.objectTestRequired isEqualToObjectTestRequired:otherCaptureUser.objectTestRequired]) return NO;
-
-    if (!self.pluralTestUnique && !otherCaptureUser.pluralTestUnique) /* Keep going... */;
-    else if (!self.pluralTestUnique && ![otherCaptureUser.pluralTestUnique count]) /* Keep going... */;
-    else if (!otherCaptureUser.pluralTestUnique && ![self.pluralTestUnique count]) /* Keep going... */;
-    else if (![self.pluralTestUnique isEqualToPluralTestUniqueArray:otherCaptureUser.pluralTestUnique]) return NO;
-
-    if (!self.objectTestRequiredUnique && !otherCaptureUser.objectTestRequiredUnique) /* Keep going... */;
-    else if (!self.objectTestRequiredUnique && [otherCaptureUser.objectTestRequiredUnique isEqualToObjectTestRequiredUnique:[JRObjectTestRequiredUnique objectTestRequiredUnique]]) /* Keep going... */;
-    else if (!otherCaptureUser.objectTestRequiredUnique && [self.objectTestRequiredUnique isEqualToObjectTestRequiredUnique:[JRObjectTestRequiredUnique objectTestRequiredUnique]]) /* Keep going... */;
-    else if (![self.objectTestRequiredUnique isEqualToObjectTestRequiredUnique:otherCaptureUser.objectTestRequiredUnique]) return NO;
-
-    if (!self.pluralTestAlphabetic && !otherCaptureUser.pluralTestAlphabetic) /* Keep going... */;
-    else if (!self.pluralTestAlphabetic && ![otherCaptureUser.pluralTestAlphabetic count]) /* Keep going... */;
-    else if (!otherCaptureUser.pluralTestAlphabetic && ![self.pluralTestAlphabetic count]) /* Keep going... */;
-    else if (![self.pluralTestAlphabetic isEqualToPluralTestAlphabeticArray:otherCaptureUser.pluralTestAlphabetic]) return NO;
-
-    if (!self.simpleStringPluralOne && !otherCaptureUser.simpleStringPluralOne) /* Keep going... */;
-    else if (!self.simpleStringPluralOne && ![otherCaptureUser.simpleStringPluralOne count]) /* Keep going... */;
-    else if (!otherCaptureUser.simpleStringPluralOne && ![self.simpleStringPluralOne count]) /* Keep going... */;
-    else if (![self.simpleStringPluralOne isEqualToArray:otherCaptureUser.simpleStringPluralOne]) return NO;
-
-    if (!self.simpleStringPluralTwo && !otherCaptureUser.simpleStringPluralTwo) /* Keep going... */;
-    else if (!self.simpleStringPluralTwo && ![otherCaptureUser.simpleStringPluralTwo count]) /* Keep going... */;
-    else if (!otherCaptureUser.simpleStringPluralTwo && ![self.simpleStringPluralTwo count]) /* Keep going... */;
-    else if (![self.simpleStringPluralTwo isEqualToArray:otherCaptureUser.simpleStringPluralTwo]) return NO;
-
-    if (!self.pinapL1Plural && !otherCaptureUser.pinapL1Plural) /* Keep going... */;
-    else if (!self.pinapL1Plural && ![otherCaptureUser.pinapL1Plural count]) /* Keep going... */;
-    else if (!otherCaptureUser.pinapL1Plural && ![self.pinapL1Plural count]) /* Keep going... */;
-    else if (![self.pinapL1Plural isEqualToPinapL1PluralArray:otherCaptureUser.pinapL1Plural]) return NO;
-
-    if (!self.pinoL1Object && !otherCaptureUser.pinoL1Object) /* Keep going... */;
-    else if (!self.pinoL1Object && [otherCaptureUser.pinoL1Object isEqualToPinoL1Object:[JRPinoL1Object pinoL1Object]]) /* Keep going... */;
-    else if (!otherCaptureUser.pinoL1Object && [self.pinoL1Object isEqualToPinoL1Object:[JRPinoL1Object pinoL1Object]]) /* Keep going... */;
-    else if (![self.pinoL1Object isEqualToPinoL1Object:otherCaptureUser.pinoL1Object]) return NO;
-
-    if (!self.onipL1Plural && !otherCaptureUser.onipL1Plural) /* Keep going... */;
-    else if (!self.onipL1Plural && ![otherCaptureUser.onipL1Plural count]) /* Keep going... */;
-    else if (!otherCaptureUser.onipL1Plural && ![self.onipL1Plural count]) /* Keep going... */;
-    else if (![self.onipL1Plural isEqualToOnipL1PluralArray:otherCaptureUser.onipL1Plural]) return NO;
-
-    if (!self.oinoL1Object && !otherCaptureUser.oinoL1Object) /* Keep going... */;
-    else if (!self.oinoL1Object && [otherCaptureUser.oinoL1Object isEqualToOinoL1Object:[JROinoL1Object oinoL1Object]]) /* Keep going... */;
-    else if (!otherCaptureUser.oinoL1Object && [self.oinoL1Object isEqualToOinoL1Object:[JROinoL1Object oinoL1Object]]) /* Keep going... */;
-    else if (![self.oinoL1Object isEqualToOinoL1Object:otherCaptureUser.oinoL1Object]) return NO;
-
-    if (!self.pinapinapL1Plural && !otherCaptureUser.pinapinapL1Plural) /* Keep going... */;
-    else if (!self.pinapinapL1Plural && ![otherCaptureUser.pinapinapL1Plural count]) /* Keep going... */;
-    else if (!otherCaptureUser.pinapinapL1Plural && ![self.pinapinapL1Plural count]) /* Keep going... */;
-    else if (![self.pinapinapL1Plural isEqualToPinapinapL1PluralArray:otherCaptureUser.pinapinapL1Plural]) return NO;
-
-    if (!self.pinonipL1Plural && !otherCaptureUser.pinonipL1Plural) /* Keep going... */;
-    else if (!self.pinonipL1Plural && ![otherCaptureUser.pinonipL1Plural count]) /* Keep going... */;
-    else if (!otherCaptureUser.pinonipL1Plural && ![self.pinonipL1Plural count]) /* Keep going... */;
-    else if (![self.pinonipL1Plural isEqualToPinonipL1PluralArray:otherCaptureUser.pinonipL1Plural]) return NO;
-
-    if (!self.pinapinoL1Object && !otherCaptureUser.pinapinoL1Object) /* Keep going... */;
-    else if (!self.pinapinoL1Object && [otherCaptureUser.pinapinoL1Object isEqualToPinapinoL1Object:[JRPinapinoL1Object pinapinoL1Object]]) /* Keep going... */;
-    else if (!otherCaptureUser.pinapinoL1Object && [self.pinapinoL1Object isEqualToPinapinoL1Object:[JRPinapinoL1Object pinapinoL1Object]]) /* Keep going... */;
-    else if (![self.pinapinoL1Object isEqualToPinapinoL1Object:otherCaptureUser.pinapinoL1Object]) return NO;
-
-    if (!self.pinoinoL1Object && !otherCaptureUser.pinoinoL1Object) /* Keep going... */;
-    else if (!self.pinoinoL1Object && [otherCaptureUser.pinoinoL1Object isEqualToPinoinoL1Object:[JRPinoinoL1Object pinoinoL1Object]]) /* Keep going... */;
-    else if (!otherCaptureUser.pinoinoL1Object && [self.pinoinoL1Object isEqualToPinoinoL1Object:[JRPinoinoL1Object pinoinoL1Object]]) /* Keep going... */;
-    else if (![self.pinoinoL1Object isEqualToPinoinoL1Object:otherCaptureUser.pinoinoL1Object]) return NO;
-
-    if (!self.onipinapL1Plural && !otherCaptureUser.onipinapL1Plural) /* Keep going... */;
-    else if (!self.onipinapL1Plural && ![otherCaptureUser.onipinapL1Plural count]) /* Keep going... */;
-    else if (!otherCaptureUser.onipinapL1Plural && ![self.onipinapL1Plural count]) /* Keep going... */;
-    else if (![self.onipinapL1Plural isEqualToOnipinapL1PluralArray:otherCaptureUser.onipinapL1Plural]) return NO;
-
-    if (!self.oinonipL1Plural && !otherCaptureUser.oinonipL1Plural) /* Keep going... */;
-    else if (!self.oinonipL1Plural && ![otherCaptureUser.oinonipL1Plural count]) /* Keep going... */;
-    else if (!otherCaptureUser.oinonipL1Plural && ![self.oinonipL1Plural count]) /* Keep going... */;
-    else if (![self.oinonipL1Plural isEqualToOinonipL1PluralArray:otherCaptureUser.oinonipL1Plural]) return NO;
-
-    if (!self.onipinoL1Object && !otherCaptureUser.onipinoL1Object) /* Keep going... */;
-    else if (!self.onipinoL1Object && [otherCaptureUser.onipinoL1Object isEqualToOnipinoL1Object:[JROnipinoL1Object onipinoL1Object]]) /* Keep going... */;
-    else if (!otherCaptureUser.onipinoL1Object && [self.onipinoL1Object isEqualToOnipinoL1Object:[JROnipinoL1Object onipinoL1Object]]) /* Keep going... */;
-    else if (![self.onipinoL1Object isEqualToOnipinoL1Object:otherCaptureUser.onipinoL1Object]) return NO;
-
-    if (!self.oinoinoL1Object && !otherCaptureUser.oinoinoL1Object) /* Keep going... */;
-    else if (!self.oinoinoL1Object && [otherCaptureUser.oinoinoL1Object isEqualToOinoinoL1Object:[JROinoinoL1Object oinoinoL1Object]]) /* Keep going... */;
-    else if (!otherCaptureUser.oinoinoL1Object && [self.oinoinoL1Object isEqualToOinoinoL1Object:[JROinoinoL1Object oinoinoL1Object]]) /* Keep going... */;
-    else if (![self.oinoinoL1Object isEqualToOinoinoL1Object:otherCaptureUser.oinoinoL1Object]) return NO;
+    if (!_basicDate && !otherCaptureUser->_basicDate) /* Keep going... */;
+    else if ((_basicDate == nil) ^ (otherCaptureUser->_basicDate == nil)) return NO; // xor
+    else if (![_basicDate isEqualToDate:otherCaptureUser->_basicDate]) return NO;
+
+    if (!_basicDateTime && !otherCaptureUser->_basicDateTime) /* Keep going... */;
+    else if ((_basicDateTime == nil) ^ (otherCaptureUser->_basicDateTime == nil)) return NO; // xor
+    else if (![_basicDateTime isEqualToDate:otherCaptureUser->_basicDateTime]) return NO;
+
+    if (!_basicIpAddress && !otherCaptureUser->_basicIpAddress) /* Keep going... */;
+    else if ((_basicIpAddress == nil) ^ (otherCaptureUser->_basicIpAddress == nil)) return NO; // xor
+    else if (![_basicIpAddress isEqualToString:otherCaptureUser->_basicIpAddress]) return NO;
+
+    if (!_basicPassword && !otherCaptureUser->_basicPassword) /* Keep going... */;
+    else if ((_basicPassword == nil) ^ (otherCaptureUser->_basicPassword == nil)) return NO; // xor
+    else if (![_basicPassword isEqual:otherCaptureUser->_basicPassword]) return NO;
+
+    if (!_jsonNumber && !otherCaptureUser->_jsonNumber) /* Keep going... */;
+    else if ((_jsonNumber == nil) ^ (otherCaptureUser->_jsonNumber == nil)) return NO; // xor
+    else if (![_jsonNumber isEqual:otherCaptureUser->_jsonNumber]) return NO;
+
+    if (!_jsonString && !otherCaptureUser->_jsonString) /* Keep going... */;
+    else if ((_jsonString == nil) ^ (otherCaptureUser->_jsonString == nil)) return NO; // xor
+    else if (![_jsonString isEqual:otherCaptureUser->_jsonString]) return NO;
+
+    if (!_jsonArray && !otherCaptureUser->_jsonArray) /* Keep going... */;
+    else if ((_jsonArray == nil) ^ (otherCaptureUser->_jsonArray == nil)) return NO; // xor
+    else if (![_jsonArray isEqual:otherCaptureUser->_jsonArray]) return NO;
+
+    if (!_jsonDictionary && !otherCaptureUser->_jsonDictionary) /* Keep going... */;
+    else if ((_jsonDictionary == nil) ^ (otherCaptureUser->_jsonDictionary == nil)) return NO; // xor
+    else if (![_jsonDictionary isEqual:otherCaptureUser->_jsonDictionary]) return NO;
+
+    if (!_stringTestJson && !otherCaptureUser->_stringTestJson) /* Keep going... */;
+    else if ((_stringTestJson == nil) ^ (otherCaptureUser->_stringTestJson == nil)) return NO; // xor
+    else if (![_stringTestJson isEqualToString:otherCaptureUser->_stringTestJson]) return NO;
+
+    if (!_stringTestEmpty && !otherCaptureUser->_stringTestEmpty) /* Keep going... */;
+    else if ((_stringTestEmpty == nil) ^ (otherCaptureUser->_stringTestEmpty == nil)) return NO; // xor
+    else if (![_stringTestEmpty isEqualToString:otherCaptureUser->_stringTestEmpty]) return NO;
+
+    if (!_stringTestNull && !otherCaptureUser->_stringTestNull) /* Keep going... */;
+    else if ((_stringTestNull == nil) ^ (otherCaptureUser->_stringTestNull == nil)) return NO; // xor
+    else if (![_stringTestNull isEqualToString:otherCaptureUser->_stringTestNull]) return NO;
+
+    if (!_stringTestInvalid && !otherCaptureUser->_stringTestInvalid) /* Keep going... */;
+    else if ((_stringTestInvalid == nil) ^ (otherCaptureUser->_stringTestInvalid == nil)) return NO; // xor
+    else if (![_stringTestInvalid isEqualToString:otherCaptureUser->_stringTestInvalid]) return NO;
+
+    if (!_stringTestNSNull && !otherCaptureUser->_stringTestNSNull) /* Keep going... */;
+    else if ((_stringTestNSNull == nil) ^ (otherCaptureUser->_stringTestNSNull == nil)) return NO; // xor
+    else if (![_stringTestNSNull isEqualToString:otherCaptureUser->_stringTestNSNull]) return NO;
+
+    if (!_stringTestAlphanumeric && !otherCaptureUser->_stringTestAlphanumeric) /* Keep going... */;
+    else if ((_stringTestAlphanumeric == nil) ^ (otherCaptureUser->_stringTestAlphanumeric == nil)) return NO; // xor
+    else if (![_stringTestAlphanumeric isEqualToString:otherCaptureUser->_stringTestAlphanumeric]) return NO;
+
+    if (!_stringTestUnicodeLetters && !otherCaptureUser->_stringTestUnicodeLetters) /* Keep going... */;
+    else if ((_stringTestUnicodeLetters == nil) ^ (otherCaptureUser->_stringTestUnicodeLetters == nil)) return NO; // xor
+    else if (![_stringTestUnicodeLetters isEqualToString:otherCaptureUser->_stringTestUnicodeLetters]) return NO;
+
+    if (!_stringTestUnicodePrintable && !otherCaptureUser->_stringTestUnicodePrintable) /* Keep going... */;
+    else if ((_stringTestUnicodePrintable == nil) ^ (otherCaptureUser->_stringTestUnicodePrintable == nil)) return NO; // xor
+    else if (![_stringTestUnicodePrintable isEqualToString:otherCaptureUser->_stringTestUnicodePrintable]) return NO;
+
+    if (!_stringTestEmailAddress && !otherCaptureUser->_stringTestEmailAddress) /* Keep going... */;
+    else if ((_stringTestEmailAddress == nil) ^ (otherCaptureUser->_stringTestEmailAddress == nil)) return NO; // xor
+    else if (![_stringTestEmailAddress isEqualToString:otherCaptureUser->_stringTestEmailAddress]) return NO;
+
+    if (!_stringTestLength && !otherCaptureUser->_stringTestLength) /* Keep going... */;
+    else if ((_stringTestLength == nil) ^ (otherCaptureUser->_stringTestLength == nil)) return NO; // xor
+    else if (![_stringTestLength isEqualToString:otherCaptureUser->_stringTestLength]) return NO;
+
+    if (!_stringTestCaseSensitive && !otherCaptureUser->_stringTestCaseSensitive) /* Keep going... */;
+    else if ((_stringTestCaseSensitive == nil) ^ (otherCaptureUser->_stringTestCaseSensitive == nil)) return NO; // xor
+    else if (![_stringTestCaseSensitive isEqualToString:otherCaptureUser->_stringTestCaseSensitive]) return NO;
+
+    if (!_stringTestFeatures && !otherCaptureUser->_stringTestFeatures) /* Keep going... */;
+    else if ((_stringTestFeatures == nil) ^ (otherCaptureUser->_stringTestFeatures == nil)) return NO; // xor
+    else if (![_stringTestFeatures isEqualToString:otherCaptureUser->_stringTestFeatures]) return NO;
+
+    if (!_basicPlural && !otherCaptureUser->_basicPlural) /* Keep going... */;
+    else if (!_basicPlural && ![otherCaptureUser->_basicPlural count]) /* Keep going... */;
+    else if (!otherCaptureUser->_basicPlural && ![_basicPlural count]) /* Keep going... */;
+    else if (![_basicPlural isEqualToBasicPluralArray:otherCaptureUser->_basicPlural]) return NO;
+
+    if (!_basicObject && !otherCaptureUser->_basicObject) /* Keep going... */;
+    else if (!_basicObject && [otherCaptureUser->_basicObject isEqualToBasicObject:[JRBasicObject basicObject]]) /* Keep going... */;
+    else if (!otherCaptureUser->_basicObject && [_basicObject isEqualToBasicObject:[JRBasicObject basicObject]]) /* Keep going... */;
+    else if (![_basicObject isEqualToBasicObject:otherCaptureUser->_basicObject]) return NO;
+
+    if (!_objectTestRequired && !otherCaptureUser->_objectTestRequired) /* Keep going... */;
+    else if (!_objectTestRequired && [otherCaptureUser->_objectTestRequired isEqualToObjectTestRequired:[JRObjectTestRequired objectTestRequired]]) /* Keep going... */;
+    else if (!otherCaptureUser->_objectTestRequired && [_objectTestRequired isEqualToObjectTestRequired:[JRObjectTestRequired objectTestRequired]]) /* Keep going... */;
+    else if (![_objectTestRequired isEqualToObjectTestRequired:otherCaptureUser->_objectTestRequired]) return NO;
+
+    if (!_pluralTestUnique && !otherCaptureUser->_pluralTestUnique) /* Keep going... */;
+    else if (!_pluralTestUnique && ![otherCaptureUser->_pluralTestUnique count]) /* Keep going... */;
+    else if (!otherCaptureUser->_pluralTestUnique && ![_pluralTestUnique count]) /* Keep going... */;
+    else if (![_pluralTestUnique isEqualToPluralTestUniqueArray:otherCaptureUser->_pluralTestUnique]) return NO;
+
+    if (!_objectTestRequiredUnique && !otherCaptureUser->_objectTestRequiredUnique) /* Keep going... */;
+    else if (!_objectTestRequiredUnique && [otherCaptureUser->_objectTestRequiredUnique isEqualToObjectTestRequiredUnique:[JRObjectTestRequiredUnique objectTestRequiredUnique]]) /* Keep going... */;
+    else if (!otherCaptureUser->_objectTestRequiredUnique && [_objectTestRequiredUnique isEqualToObjectTestRequiredUnique:[JRObjectTestRequiredUnique objectTestRequiredUnique]]) /* Keep going... */;
+    else if (![_objectTestRequiredUnique isEqualToObjectTestRequiredUnique:otherCaptureUser->_objectTestRequiredUnique]) return NO;
+
+    if (!_pluralTestAlphabetic && !otherCaptureUser->_pluralTestAlphabetic) /* Keep going... */;
+    else if (!_pluralTestAlphabetic && ![otherCaptureUser->_pluralTestAlphabetic count]) /* Keep going... */;
+    else if (!otherCaptureUser->_pluralTestAlphabetic && ![_pluralTestAlphabetic count]) /* Keep going... */;
+    else if (![_pluralTestAlphabetic isEqualToPluralTestAlphabeticArray:otherCaptureUser->_pluralTestAlphabetic]) return NO;
+
+    if (!_simpleStringPluralOne && !otherCaptureUser->_simpleStringPluralOne) /* Keep going... */;
+    else if (!_simpleStringPluralOne && ![otherCaptureUser->_simpleStringPluralOne count]) /* Keep going... */;
+    else if (!otherCaptureUser->_simpleStringPluralOne && ![_simpleStringPluralOne count]) /* Keep going... */;
+    else if (![_simpleStringPluralOne isEqualToArray:otherCaptureUser->_simpleStringPluralOne]) return NO;
+
+    if (!_simpleStringPluralTwo && !otherCaptureUser->_simpleStringPluralTwo) /* Keep going... */;
+    else if (!_simpleStringPluralTwo && ![otherCaptureUser->_simpleStringPluralTwo count]) /* Keep going... */;
+    else if (!otherCaptureUser->_simpleStringPluralTwo && ![_simpleStringPluralTwo count]) /* Keep going... */;
+    else if (![_simpleStringPluralTwo isEqualToArray:otherCaptureUser->_simpleStringPluralTwo]) return NO;
+
+    if (!_pinapL1Plural && !otherCaptureUser->_pinapL1Plural) /* Keep going... */;
+    else if (!_pinapL1Plural && ![otherCaptureUser->_pinapL1Plural count]) /* Keep going... */;
+    else if (!otherCaptureUser->_pinapL1Plural && ![_pinapL1Plural count]) /* Keep going... */;
+    else if (![_pinapL1Plural isEqualToPinapL1PluralArray:otherCaptureUser->_pinapL1Plural]) return NO;
+
+    if (!_pinoL1Object && !otherCaptureUser->_pinoL1Object) /* Keep going... */;
+    else if (!_pinoL1Object && [otherCaptureUser->_pinoL1Object isEqualToPinoL1Object:[JRPinoL1Object pinoL1Object]]) /* Keep going... */;
+    else if (!otherCaptureUser->_pinoL1Object && [_pinoL1Object isEqualToPinoL1Object:[JRPinoL1Object pinoL1Object]]) /* Keep going... */;
+    else if (![_pinoL1Object isEqualToPinoL1Object:otherCaptureUser->_pinoL1Object]) return NO;
+
+    if (!_onipL1Plural && !otherCaptureUser->_onipL1Plural) /* Keep going... */;
+    else if (!_onipL1Plural && ![otherCaptureUser->_onipL1Plural count]) /* Keep going... */;
+    else if (!otherCaptureUser->_onipL1Plural && ![_onipL1Plural count]) /* Keep going... */;
+    else if (![_onipL1Plural isEqualToOnipL1PluralArray:otherCaptureUser->_onipL1Plural]) return NO;
+
+    if (!_oinoL1Object && !otherCaptureUser->_oinoL1Object) /* Keep going... */;
+    else if (!_oinoL1Object && [otherCaptureUser->_oinoL1Object isEqualToOinoL1Object:[JROinoL1Object oinoL1Object]]) /* Keep going... */;
+    else if (!otherCaptureUser->_oinoL1Object && [_oinoL1Object isEqualToOinoL1Object:[JROinoL1Object oinoL1Object]]) /* Keep going... */;
+    else if (![_oinoL1Object isEqualToOinoL1Object:otherCaptureUser->_oinoL1Object]) return NO;
+
+    if (!_pinapinapL1Plural && !otherCaptureUser->_pinapinapL1Plural) /* Keep going... */;
+    else if (!_pinapinapL1Plural && ![otherCaptureUser->_pinapinapL1Plural count]) /* Keep going... */;
+    else if (!otherCaptureUser->_pinapinapL1Plural && ![_pinapinapL1Plural count]) /* Keep going... */;
+    else if (![_pinapinapL1Plural isEqualToPinapinapL1PluralArray:otherCaptureUser->_pinapinapL1Plural]) return NO;
+
+    if (!_pinonipL1Plural && !otherCaptureUser->_pinonipL1Plural) /* Keep going... */;
+    else if (!_pinonipL1Plural && ![otherCaptureUser->_pinonipL1Plural count]) /* Keep going... */;
+    else if (!otherCaptureUser->_pinonipL1Plural && ![_pinonipL1Plural count]) /* Keep going... */;
+    else if (![_pinonipL1Plural isEqualToPinonipL1PluralArray:otherCaptureUser->_pinonipL1Plural]) return NO;
+
+    if (!_pinapinoL1Object && !otherCaptureUser->_pinapinoL1Object) /* Keep going... */;
+    else if (!_pinapinoL1Object && [otherCaptureUser->_pinapinoL1Object isEqualToPinapinoL1Object:[JRPinapinoL1Object pinapinoL1Object]]) /* Keep going... */;
+    else if (!otherCaptureUser->_pinapinoL1Object && [_pinapinoL1Object isEqualToPinapinoL1Object:[JRPinapinoL1Object pinapinoL1Object]]) /* Keep going... */;
+    else if (![_pinapinoL1Object isEqualToPinapinoL1Object:otherCaptureUser->_pinapinoL1Object]) return NO;
+
+    if (!_pinoinoL1Object && !otherCaptureUser->_pinoinoL1Object) /* Keep going... */;
+    else if (!_pinoinoL1Object && [otherCaptureUser->_pinoinoL1Object isEqualToPinoinoL1Object:[JRPinoinoL1Object pinoinoL1Object]]) /* Keep going... */;
+    else if (!otherCaptureUser->_pinoinoL1Object && [_pinoinoL1Object isEqualToPinoinoL1Object:[JRPinoinoL1Object pinoinoL1Object]]) /* Keep going... */;
+    else if (![_pinoinoL1Object isEqualToPinoinoL1Object:otherCaptureUser->_pinoinoL1Object]) return NO;
+
+    if (!_onipinapL1Plural && !otherCaptureUser->_onipinapL1Plural) /* Keep going... */;
+    else if (!_onipinapL1Plural && ![otherCaptureUser->_onipinapL1Plural count]) /* Keep going... */;
+    else if (!otherCaptureUser->_onipinapL1Plural && ![_onipinapL1Plural count]) /* Keep going... */;
+    else if (![_onipinapL1Plural isEqualToOnipinapL1PluralArray:otherCaptureUser->_onipinapL1Plural]) return NO;
+
+    if (!_oinonipL1Plural && !otherCaptureUser->_oinonipL1Plural) /* Keep going... */;
+    else if (!_oinonipL1Plural && ![otherCaptureUser->_oinonipL1Plural count]) /* Keep going... */;
+    else if (!otherCaptureUser->_oinonipL1Plural && ![_oinonipL1Plural count]) /* Keep going... */;
+    else if (![_oinonipL1Plural isEqualToOinonipL1PluralArray:otherCaptureUser->_oinonipL1Plural]) return NO;
+
+    if (!_onipinoL1Object && !otherCaptureUser->_onipinoL1Object) /* Keep going... */;
+    else if (!_onipinoL1Object && [otherCaptureUser->_onipinoL1Object isEqualToOnipinoL1Object:[JROnipinoL1Object onipinoL1Object]]) /* Keep going... */;
+    else if (!otherCaptureUser->_onipinoL1Object && [_onipinoL1Object isEqualToOnipinoL1Object:[JROnipinoL1Object onipinoL1Object]]) /* Keep going... */;
+    else if (![_onipinoL1Object isEqualToOnipinoL1Object:otherCaptureUser->_onipinoL1Object]) return NO;
+
+    if (!_oinoinoL1Object && !otherCaptureUser->_oinoinoL1Object) /* Keep going... */;
+    else if (!_oinoinoL1Object && [otherCaptureUser->_oinoinoL1Object isEqualToOinoinoL1Object:[JROinoinoL1Object oinoinoL1Object]]) /* Keep going... */;
+    else if (!otherCaptureUser->_oinoinoL1Object && [_oinoinoL1Object isEqualToOinoinoL1Object:[JROinoinoL1Object oinoinoL1Object]]) /* Keep going... */;
+    else if (![_oinoinoL1Object isEqualToOinoinoL1Object:otherCaptureUser->_oinoinoL1Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRCaptureUser class]]) return NO;
+
+    return [self isEqualToCaptureUser:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_email hash];
+    hash = hash * 31 + [_basicBoolean hash];
+    hash = hash * 31 + [_basicString hash];
+    hash = hash * 31 + [_basicInteger hash];
+    hash = hash * 31 + [_basicDecimal hash];
+    hash = hash * 31 + [_basicDate hash];
+    hash = hash * 31 + [_basicDateTime hash];
+    hash = hash * 31 + [_basicIpAddress hash];
+    hash = hash * 31 + [_basicPassword hash];
+    hash = hash * 31 + [_jsonNumber hash];
+    hash = hash * 31 + [_jsonString hash];
+    hash = hash * 31 + [_jsonArray hash];
+    hash = hash * 31 + [_jsonDictionary hash];
+    hash = hash * 31 + [_stringTestJson hash];
+    hash = hash * 31 + [_stringTestEmpty hash];
+    hash = hash * 31 + [_stringTestNull hash];
+    hash = hash * 31 + [_stringTestInvalid hash];
+    hash = hash * 31 + [_stringTestNSNull hash];
+    hash = hash * 31 + [_stringTestAlphanumeric hash];
+    hash = hash * 31 + [_stringTestUnicodeLetters hash];
+    hash = hash * 31 + [_stringTestUnicodePrintable hash];
+    hash = hash * 31 + [_stringTestEmailAddress hash];
+    hash = hash * 31 + [_stringTestLength hash];
+    hash = hash * 31 + [_stringTestCaseSensitive hash];
+    hash = hash * 31 + [_stringTestFeatures hash];
+    hash = hash * 31 + [_basicPlural captureObjectElementsHash];
+    hash = hash * 31 + [_basicObject hash];
+    hash = hash * 31 + [_objectTestRequired hash];
+    hash = hash * 31 + [_pluralTestUnique captureObjectElementsHash];
+    hash = hash * 31 + [_objectTestRequiredUnique hash];
+    hash = hash * 31 + [_pluralTestAlphabetic captureObjectElementsHash];
+    hash = hash * 31 + [_simpleStringPluralOne hash];
+    hash = hash * 31 + [_simpleStringPluralTwo hash];
+    hash = hash * 31 + [_pinapL1Plural captureObjectElementsHash];
+    hash = hash * 31 + [_pinoL1Object hash];
+    hash = hash * 31 + [_onipL1Plural captureObjectElementsHash];
+    hash = hash * 31 + [_oinoL1Object hash];
+    hash = hash * 31 + [_pinapinapL1Plural captureObjectElementsHash];
+    hash = hash * 31 + [_pinonipL1Plural captureObjectElementsHash];
+    hash = hash * 31 + [_pinapinoL1Object hash];
+    hash = hash * 31 + [_pinoinoL1Object hash];
+    hash = hash * 31 + [_onipinapL1Plural captureObjectElementsHash];
+    hash = hash * 31 + [_oinonipL1Plural captureObjectElementsHash];
+    hash = hash * 31 + [_onipinoL1Object hash];
+    hash = hash * 31 + [_oinoinoL1Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
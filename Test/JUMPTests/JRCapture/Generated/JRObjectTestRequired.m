@@ -59,6 +59,7 @@
 
 - (void)setRequiredString:(NSString *)newRequiredString
 {
+    [self willChangeProperty:@"requiredString"];
     [self.dirtyPropertySet addObject:@"requiredString"];
 
     _requiredString = [newRequiredString copy];
@@ -71,6 +72,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -83,6 +85,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -130,16 +133,42 @@
     return [[JRObjectTestRequired alloc] initWithRequiredString:requiredString];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRObjectTestRequired *objectTestRequiredCopy = (JRObjectTestRequired *)[super copyWithZone:zone];
+
+    objectTestRequiredCopy->_requiredString = _requiredString;
+    objectTestRequiredCopy->_string1 = _string1;
+    objectTestRequiredCopy->_string2 = _string2;
+
+    return objectTestRequiredCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null])
+    [dictionary setObject:(_requiredString ? _requiredString : [NSNull null])
                    forKey:@"requiredString"];
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
 
     if (forEncoder)
@@ -225,6 +254,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -241,6 +271,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"objectTestRequired"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"objectTestRequired"] allObjects]];
 
@@ -252,13 +284,13 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"requiredString"])
-        [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null]) forKey:@"requiredString"];
+        [dictionary setObject:(_requiredString ? _requiredString : [NSNull null]) forKey:@"requiredString"];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -274,9 +306,9 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null]) forKey:@"requiredString"];
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_requiredString ? _requiredString : [NSNull null]) forKey:@"requiredString"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -292,21 +324,43 @@
 
 - (BOOL)isEqualToObjectTestRequired:(JRObjectTestRequired *)otherObjectTestRequired
 {
-    if (!self.requiredString && !otherObjectTestRequired.requiredString) /* Keep going... */;
-    else if ((self.requiredString == nil) ^ (otherObjectTestRequired.requiredString == nil)) return NO; // xor
-    else if (![self.requiredString isEqualToString:otherObjectTestRequired.requiredString]) return NO;
+    if (!otherObjectTestRequired) return NO;
+    if ([self hash] != [otherObjectTestRequired hash]) return NO;
+
+    if (!_requiredString && !otherObjectTestRequired->_requiredString) /* Keep going... */;
+    else if ((_requiredString == nil) ^ (otherObjectTestRequired->_requiredString == nil)) return NO; // xor
+    else if (![_requiredString isEqualToString:otherObjectTestRequired->_requiredString]) return NO;
 
-    if (!self.string1 && !otherObjectTestRequired.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherObjectTestRequired.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherObjectTestRequired.string1]) return NO;
+    if (!_string1 && !otherObjectTestRequired->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherObjectTestRequired->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherObjectTestRequired->_string1]) return NO;
 
-    if (!self.string2 && !otherObjectTestRequired.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherObjectTestRequired.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherObjectTestRequired.string2]) return NO;
+    if (!_string2 && !otherObjectTestRequired->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherObjectTestRequired->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherObjectTestRequired->_string2]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRObjectTestRequired class]]) return NO;
+
+    return [self isEqualToObjectTestRequired:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_requiredString hash];
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
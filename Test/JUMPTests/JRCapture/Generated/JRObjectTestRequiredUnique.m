@@ -59,6 +59,7 @@
 
 - (void)setRequiredString:(NSString *)newRequiredString
 {
+    [self willChangeProperty:@"requiredString"];
     [self.dirtyPropertySet addObject:@"requiredString"];
 
     _requiredString = [newRequiredString copy];
@@ -71,6 +72,7 @@
 
 - (void)setUniqueString:(NSString *)newUniqueString
 {
+    [self willChangeProperty:@"uniqueString"];
     [self.dirtyPropertySet addObject:@"uniqueString"];
 
     _uniqueString = [newUniqueString copy];
@@ -83,6 +85,7 @@
 
 - (void)setRequiredUniqueString:(NSString *)newRequiredUniqueString
 {
+    [self willChangeProperty:@"requiredUniqueString"];
     [self.dirtyPropertySet addObject:@"requiredUniqueString"];
 
     _requiredUniqueString = [newRequiredUniqueString copy];
@@ -131,16 +134,42 @@
     return [[JRObjectTestRequiredUnique alloc] initWithRequiredString:requiredString andRequiredUniqueString:requiredUniqueString];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRObjectTestRequiredUnique *objectTestRequiredUniqueCopy = (JRObjectTestRequiredUnique *)[super copyWithZone:zone];
+
+    objectTestRequiredUniqueCopy->_requiredString = _requiredString;
+    objectTestRequiredUniqueCopy->_uniqueString = _uniqueString;
+    objectTestRequiredUniqueCopy->_requiredUniqueString = _requiredUniqueString;
+
+    return objectTestRequiredUniqueCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null])
+    [dictionary setObject:(_requiredString ? _requiredString : [NSNull null])
                    forKey:@"requiredString"];
-    [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null])
+    [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null])
                    forKey:@"uniqueString"];
-    [dictionary setObject:(self.requiredUniqueString ? self.requiredUniqueString : [NSNull null])
+    [dictionary setObject:(_requiredUniqueString ? _requiredUniqueString : [NSNull null])
                    forKey:@"requiredUniqueString"];
 
     if (forEncoder)
@@ -226,6 +255,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -242,6 +272,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"objectTestRequiredUnique"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"objectTestRequiredUnique"] allObjects]];
 
@@ -253,13 +285,13 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"requiredString"])
-        [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null]) forKey:@"requiredString"];
+        [dictionary setObject:(_requiredString ? _requiredString : [NSNull null]) forKey:@"requiredString"];
 
     if ([self.dirtyPropertySet containsObject:@"uniqueString"])
-        [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
+        [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null]) forKey:@"uniqueString"];
 
     if ([self.dirtyPropertySet containsObject:@"requiredUniqueString"])
-        [dictionary setObject:(self.requiredUniqueString ? self.requiredUniqueString : [NSNull null]) forKey:@"requiredUniqueString"];
+        [dictionary setObject:(_requiredUniqueString ? _requiredUniqueString : [NSNull null]) forKey:@"requiredUniqueString"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -275,9 +307,9 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.requiredString ? self.requiredString : [NSNull null]) forKey:@"requiredString"];
-    [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
-    [dictionary setObject:(self.requiredUniqueString ? self.requiredUniqueString : [NSNull null]) forKey:@"requiredUniqueString"];
+    [dictionary setObject:(_requiredString ? _requiredString : [NSNull null]) forKey:@"requiredString"];
+    [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null]) forKey:@"uniqueString"];
+    [dictionary setObject:(_requiredUniqueString ? _requiredUniqueString : [NSNull null]) forKey:@"requiredUniqueString"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -293,21 +325,43 @@
 
 - (BOOL)isEqualToObjectTestRequiredUnique:(JRObjectTestRequiredUnique *)otherObjectTestRequiredUnique
 {
-    if (!self.requiredString && !otherObjectTestRequiredUnique.requiredString) /* Keep going... */;
-    else if ((self.requiredString == nil) ^ (otherObjectTestRequiredUnique.requiredString == nil)) return NO; // xor
-    else if (![self.requiredString isEqualToString:otherObjectTestRequiredUnique.requiredString]) return NO;
+    if (!otherObjectTestRequiredUnique) return NO;
+    if ([self hash] != [otherObjectTestRequiredUnique hash]) return NO;
+
+    if (!_requiredString && !otherObjectTestRequiredUnique->_requiredString) /* Keep going... */;
+    else if ((_requiredString == nil) ^ (otherObjectTestRequiredUnique->_requiredString == nil)) return NO; // xor
+    else if (![_requiredString isEqualToString:otherObjectTestRequiredUnique->_requiredString]) return NO;
 
-    if (!self.uniqueString && !otherObjectTestRequiredUnique.uniqueString) /* Keep going... */;
-    else if ((self.uniqueString == nil) ^ (otherObjectTestRequiredUnique.uniqueString == nil)) return NO; // xor
-    else if (![self.uniqueString isEqualToString:otherObjectTestRequiredUnique.uniqueString]) return NO;
+    if (!_uniqueString && !otherObjectTestRequiredUnique->_uniqueString) /* Keep going... */;
+    else if ((_uniqueString == nil) ^ (otherObjectTestRequiredUnique->_uniqueString == nil)) return NO; // xor
+    else if (![_uniqueString isEqualToString:otherObjectTestRequiredUnique->_uniqueString]) return NO;
 
-    if (!self.requiredUniqueString && !otherObjectTestRequiredUnique.requiredUniqueString) /* Keep going... */;
-    else if ((self.requiredUniqueString == nil) ^ (otherObjectTestRequiredUnique.requiredUniqueString == nil)) return NO; // xor
-    else if (![self.requiredUniqueString isEqualToString:otherObjectTestRequiredUnique.requiredUniqueString]) return NO;
+    if (!_requiredUniqueString && !otherObjectTestRequiredUnique->_requiredUniqueString) /* Keep going... */;
+    else if ((_requiredUniqueString == nil) ^ (otherObjectTestRequiredUnique->_requiredUniqueString == nil)) return NO; // xor
+    else if (![_requiredUniqueString isEqualToString:otherObjectTestRequiredUnique->_requiredUniqueString]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRObjectTestRequiredUnique class]]) return NO;
+
+    return [self isEqualToObjectTestRequiredUnique:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_requiredString hash];
+    hash = hash * 31 + [_uniqueString hash];
+    hash = hash * 31 + [_requiredUniqueString hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROinoL2Object *)oinoL2Object
 {
+    if ([self.sharedPropertySet containsObject:@"oinoL2Object"])
+        [self unshareProperty:@"oinoL2Object"];
+
     return _oinoL2Object;
 }
 
 - (void)setOinoL2Object:(JROinoL2Object *)newOinoL2Object
 {
+    [self willChangeProperty:@"oinoL2Object"];
     [self.dirtyPropertySet addObject:@"oinoL2Object"];
 
-    _oinoL2Object = newOinoL2Object;
+    _oinoL2Object = [self claimValue:newOinoL2Object forProperty:@"oinoL2Object"];
 
     [_oinoL2Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath = @"/oinoL1Object";
         self.canBeUpdatedOnCapture = YES;
 
-        _oinoL2Object = [[JROinoL2Object alloc] init];
+        _oinoL2Object = [self claimValue:[[JROinoL2Object alloc] init] forProperty:@"oinoL2Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROinoL1Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROinoL1Object *oinoL1ObjectCopy = (JROinoL1Object *)[super copyWithZone:zone];
+
+    oinoL1ObjectCopy->_string1 = _string1;
+    oinoL1ObjectCopy->_string2 = _string2;
+    oinoL1ObjectCopy->_oinoL2Object = _oinoL2Object;
+
+    return oinoL1ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"oinoL2Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinoL2Object"]) return _oinoL2Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinoL2Object"]) _oinoL2Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.oinoL2Object ? [self.oinoL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinoL2Object ? [_oinoL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinoL2Object"];
 
     if (forEncoder)
@@ -212,6 +246,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -223,8 +258,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinoL1Object"];
 
-    if (self.oinoL2Object)
-        [snapshotDictionary setObject:[self.oinoL2Object snapshotDictionaryFromDirtyPropertySet]
+    if (_oinoL2Object)
+        [snapshotDictionary setObject:[_oinoL2Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"oinoL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -232,6 +267,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"oinoL1Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinoL1Object"] allObjects]];
 
@@ -247,18 +284,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"oinoL2Object"])
-        [dictionary setObject:(self.oinoL2Object ?
-                              [self.oinoL2Object toUpdateDictionary] :
+        [dictionary setObject:(_oinoL2Object ?
+                              [_oinoL2Object toUpdateDictionary] :
                               [[JROinoL2Object oinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"oinoL2Object"];
-    else if ([self.oinoL2Object needsUpdate])
-        [dictionary setObject:[self.oinoL2Object toUpdateDictionary]
+    else if ([_oinoL2Object needsUpdate])
+        [dictionary setObject:[_oinoL2Object toUpdateDictionary]
                        forKey:@"oinoL2Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -275,11 +312,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.oinoL2Object ?
-                          [self.oinoL2Object toReplaceDictionary] :
+    [dictionary setObject:(_oinoL2Object ?
+                          [_oinoL2Object toReplaceDictionary] :
                           [[JROinoL2Object oinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"oinoL2Object"];
 
@@ -292,7 +329,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.oinoL2Object needsUpdate])
+    if ([_oinoL2Object needsUpdate])
         return YES;
 
     return NO;
@@ -300,22 +337,44 @@
 
 - (BOOL)isEqualToOinoL1Object:(JROinoL1Object *)otherOinoL1Object
 {
-    if (!self.string1 && !otherOinoL1Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOinoL1Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOinoL1Object.string1]) return NO;
+    if (!otherOinoL1Object) return NO;
+    if ([self hash] != [otherOinoL1Object hash]) return NO;
+
+    if (!_string1 && !otherOinoL1Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOinoL1Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOinoL1Object->_string1]) return NO;
 
-    if (!self.string2 && !otherOinoL1Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOinoL1Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOinoL1Object.string2]) return NO;
+    if (!_string2 && !otherOinoL1Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOinoL1Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOinoL1Object->_string2]) return NO;
 
-    if (!self.oinoL2Object && !otherOinoL1Object.oinoL2Object) /* Keep going... */;
-    else if (!self.oinoL2Object && [otherOinoL1Object.oinoL2Object isEqualToOinoL2Object:[JROinoL2Object oinoL2Object]]) /* Keep going... */;
-    else if (!otherOinoL1Object.oinoL2Object && [self.oinoL2Object isEqualToOinoL2Object:[JROinoL2Object oinoL2Object]]) /* Keep going... */;
-    else if (![self.oinoL2Object isEqualToOinoL2Object:otherOinoL1Object.oinoL2Object]) return NO;
+    if (!_oinoL2Object && !otherOinoL1Object->_oinoL2Object) /* Keep going... */;
+    else if (!_oinoL2Object && [otherOinoL1Object->_oinoL2Object isEqualToOinoL2Object:[JROinoL2Object oinoL2Object]]) /* Keep going... */;
+    else if (!otherOinoL1Object->_oinoL2Object && [_oinoL2Object isEqualToOinoL2Object:[JROinoL2Object oinoL2Object]]) /* Keep going... */;
+    else if (![_oinoL2Object isEqualToOinoL2Object:otherOinoL1Object->_oinoL2Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROinoL1Object class]]) return NO;
+
+    return [self isEqualToOinoL1Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_oinoL2Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -58,6 +58,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -70,6 +71,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -93,14 +95,39 @@
     return [[JROinoL2Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROinoL2Object *oinoL2ObjectCopy = (JROinoL2Object *)[super copyWithZone:zone];
+
+    oinoL2ObjectCopy->_string1 = _string1;
+    oinoL2ObjectCopy->_string2 = _string2;
+
+    return oinoL2ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
 
     if (forEncoder)
@@ -178,6 +205,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -194,6 +222,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"oinoL2Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinoL2Object"] allObjects]];
 
@@ -205,10 +235,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -224,8 +254,8 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -241,17 +271,38 @@
 
 - (BOOL)isEqualToOinoL2Object:(JROinoL2Object *)otherOinoL2Object
 {
-    if (!self.string1 && !otherOinoL2Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOinoL2Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOinoL2Object.string1]) return NO;
+    if (!otherOinoL2Object) return NO;
+    if ([self hash] != [otherOinoL2Object hash]) return NO;
+
+    if (!_string1 && !otherOinoL2Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOinoL2Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOinoL2Object->_string1]) return NO;
 
-    if (!self.string2 && !otherOinoL2Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOinoL2Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOinoL2Object.string2]) return NO;
+    if (!_string2 && !otherOinoL2Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOinoL2Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOinoL2Object->_string2]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROinoL2Object class]]) return NO;
+
+    return [self isEqualToOinoL2Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
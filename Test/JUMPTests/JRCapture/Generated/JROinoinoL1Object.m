@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROinoinoL2Object *)oinoinoL2Object
 {
+    if ([self.sharedPropertySet containsObject:@"oinoinoL2Object"])
+        [self unshareProperty:@"oinoinoL2Object"];
+
     return _oinoinoL2Object;
 }
 
 - (void)setOinoinoL2Object:(JROinoinoL2Object *)newOinoinoL2Object
 {
+    [self willChangeProperty:@"oinoinoL2Object"];
     [self.dirtyPropertySet addObject:@"oinoinoL2Object"];
 
-    _oinoinoL2Object = newOinoinoL2Object;
+    _oinoinoL2Object = [self claimValue:newOinoinoL2Object forProperty:@"oinoinoL2Object"];
 
     [_oinoinoL2Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath = @"/oinoinoL1Object";
         self.canBeUpdatedOnCapture = YES;
 
-        _oinoinoL2Object = [[JROinoinoL2Object alloc] init];
+        _oinoinoL2Object = [self claimValue:[[JROinoinoL2Object alloc] init] forProperty:@"oinoinoL2Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROinoinoL1Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROinoinoL1Object *oinoinoL1ObjectCopy = (JROinoinoL1Object *)[super copyWithZone:zone];
+
+    oinoinoL1ObjectCopy->_string1 = _string1;
+    oinoinoL1ObjectCopy->_string2 = _string2;
+    oinoinoL1ObjectCopy->_oinoinoL2Object = _oinoinoL2Object;
+
+    return oinoinoL1ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"oinoinoL2Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinoinoL2Object"]) return _oinoinoL2Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinoinoL2Object"]) _oinoinoL2Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.oinoinoL2Object ? [self.oinoinoL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinoinoL2Object ? [_oinoinoL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinoinoL2Object"];
 
     if (forEncoder)
@@ -212,6 +246,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -223,8 +258,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinoinoL1Object"];
 
-    if (self.oinoinoL2Object)
-        [snapshotDictionary setObject:[self.oinoinoL2Object snapshotDictionaryFromDirtyPropertySet]
+    if (_oinoinoL2Object)
+        [snapshotDictionary setObject:[_oinoinoL2Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"oinoinoL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -232,6 +267,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"oinoinoL1Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinoinoL1Object"] allObjects]];
 
@@ -247,18 +284,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"oinoinoL2Object"])
-        [dictionary setObject:(self.oinoinoL2Object ?
-                              [self.oinoinoL2Object toUpdateDictionary] :
+        [dictionary setObject:(_oinoinoL2Object ?
+                              [_oinoinoL2Object toUpdateDictionary] :
                               [[JROinoinoL2Object oinoinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"oinoinoL2Object"];
-    else if ([self.oinoinoL2Object needsUpdate])
-        [dictionary setObject:[self.oinoinoL2Object toUpdateDictionary]
+    else if ([_oinoinoL2Object needsUpdate])
+        [dictionary setObject:[_oinoinoL2Object toUpdateDictionary]
                        forKey:@"oinoinoL2Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -275,11 +312,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.oinoinoL2Object ?
-                          [self.oinoinoL2Object toReplaceDictionary] :
+    [dictionary setObject:(_oinoinoL2Object ?
+                          [_oinoinoL2Object toReplaceDictionary] :
                           [[JROinoinoL2Object oinoinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"oinoinoL2Object"];
 
@@ -292,7 +329,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.oinoinoL2Object needsUpdate])
+    if ([_oinoinoL2Object needsUpdate])
         return YES;
 
     return NO;
@@ -300,22 +337,44 @@
 
 - (BOOL)isEqualToOinoinoL1Object:(JROinoinoL1Object *)otherOinoinoL1Object
 {
-    if (!self.string1 && !otherOinoinoL1Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOinoinoL1Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOinoinoL1Object.string1]) return NO;
+    if (!otherOinoinoL1Object) return NO;
+    if ([self hash] != [otherOinoinoL1Object hash]) return NO;
+
+    if (!_string1 && !otherOinoinoL1Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOinoinoL1Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOinoinoL1Object->_string1]) return NO;
 
-    if (!self.string2 && !otherOinoinoL1Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOinoinoL1Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOinoinoL1Object.string2]) return NO;
+    if (!_string2 && !otherOinoinoL1Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOinoinoL1Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOinoinoL1Object->_string2]) return NO;
 
-    if (!self.oinoinoL2Object && !otherOinoinoL1Object.oinoinoL2Object) /* Keep going... */;
-    else if (!self.oinoinoL2Object && [otherOinoinoL1Object.oinoinoL2Object isEqualToOinoinoL2Object:[JROinoinoL2Object oinoinoL2Object]]) /* Keep going... */;
-    else if (!otherOinoinoL1Object.oinoinoL2Object && [self.oinoinoL2Object isEqualToOinoinoL2Object:[JROinoinoL2Object oinoinoL2Object]]) /* Keep going... */;
-    else if (![self.oinoinoL2Object isEqualToOinoinoL2Object:otherOinoinoL1Object.oinoinoL2Object]) return NO;
+    if (!_oinoinoL2Object && !otherOinoinoL1Object->_oinoinoL2Object) /* Keep going... */;
+    else if (!_oinoinoL2Object && [otherOinoinoL1Object->_oinoinoL2Object isEqualToOinoinoL2Object:[JROinoinoL2Object oinoinoL2Object]]) /* Keep going... */;
+    else if (!otherOinoinoL1Object->_oinoinoL2Object && [_oinoinoL2Object isEqualToOinoinoL2Object:[JROinoinoL2Object oinoinoL2Object]]) /* Keep going... */;
+    else if (![_oinoinoL2Object isEqualToOinoinoL2Object:otherOinoinoL1Object->_oinoinoL2Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROinoinoL1Object class]]) return NO;
+
+    return [self isEqualToOinoinoL1Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_oinoinoL2Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
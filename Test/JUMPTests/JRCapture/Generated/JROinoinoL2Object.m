@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROinoinoL3Object *)oinoinoL3Object
 {
+    if ([self.sharedPropertySet containsObject:@"oinoinoL3Object"])
+        [self unshareProperty:@"oinoinoL3Object"];
+
     return _oinoinoL3Object;
 }
 
 - (void)setOinoinoL3Object:(JROinoinoL3Object *)newOinoinoL3Object
 {
+    [self willChangeProperty:@"oinoinoL3Object"];
     [self.dirtyPropertySet addObject:@"oinoinoL3Object"];
 
-    _oinoinoL3Object = newOinoinoL3Object;
+    _oinoinoL3Object = [self claimValue:newOinoinoL3Object forProperty:@"oinoinoL3Object"];
 
     [_oinoinoL3Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath = @"/oinoinoL1Object/oinoinoL2Object";
         self.canBeUpdatedOnCapture = YES;
 
-        _oinoinoL3Object = [[JROinoinoL3Object alloc] init];
+        _oinoinoL3Object = [self claimValue:[[JROinoinoL3Object alloc] init] forProperty:@"oinoinoL3Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROinoinoL2Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROinoinoL2Object *oinoinoL2ObjectCopy = (JROinoinoL2Object *)[super copyWithZone:zone];
+
+    oinoinoL2ObjectCopy->_string1 = _string1;
+    oinoinoL2ObjectCopy->_string2 = _string2;
+    oinoinoL2ObjectCopy->_oinoinoL3Object = _oinoinoL3Object;
+
+    return oinoinoL2ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"oinoinoL3Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinoinoL3Object"]) return _oinoinoL3Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinoinoL3Object"]) _oinoinoL3Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.oinoinoL3Object ? [self.oinoinoL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinoinoL3Object ? [_oinoinoL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinoinoL3Object"];
 
     if (forEncoder)
@@ -212,6 +246,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -223,8 +258,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinoinoL2Object"];
 
-    if (self.oinoinoL3Object)
-        [snapshotDictionary setObject:[self.oinoinoL3Object snapshotDictionaryFromDirtyPropertySet]
+    if (_oinoinoL3Object)
+        [snapshotDictionary setObject:[_oinoinoL3Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"oinoinoL3Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -232,6 +267,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"oinoinoL2Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinoinoL2Object"] allObjects]];
 
@@ -247,18 +284,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"oinoinoL3Object"])
-        [dictionary setObject:(self.oinoinoL3Object ?
-                              [self.oinoinoL3Object toUpdateDictionary] :
+        [dictionary setObject:(_oinoinoL3Object ?
+                              [_oinoinoL3Object toUpdateDictionary] :
                               [[JROinoinoL3Object oinoinoL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"oinoinoL3Object"];
-    else if ([self.oinoinoL3Object needsUpdate])
-        [dictionary setObject:[self.oinoinoL3Object toUpdateDictionary]
+    else if ([_oinoinoL3Object needsUpdate])
+        [dictionary setObject:[_oinoinoL3Object toUpdateDictionary]
                        forKey:@"oinoinoL3Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -275,11 +312,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.oinoinoL3Object ?
-                          [self.oinoinoL3Object toReplaceDictionary] :
+    [dictionary setObject:(_oinoinoL3Object ?
+                          [_oinoinoL3Object toReplaceDictionary] :
                           [[JROinoinoL3Object oinoinoL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"oinoinoL3Object"];
 
@@ -292,7 +329,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.oinoinoL3Object needsUpdate])
+    if ([_oinoinoL3Object needsUpdate])
         return YES;
 
     return NO;
@@ -300,22 +337,44 @@
 
 - (BOOL)isEqualToOinoinoL2Object:(JROinoinoL2Object *)otherOinoinoL2Object
 {
-    if (!self.string1 && !otherOinoinoL2Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOinoinoL2Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOinoinoL2Object.string1]) return NO;
+    if (!otherOinoinoL2Object) return NO;
+    if ([self hash] != [otherOinoinoL2Object hash]) return NO;
+
+    if (!_string1 && !otherOinoinoL2Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOinoinoL2Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOinoinoL2Object->_string1]) return NO;
 
-    if (!self.string2 && !otherOinoinoL2Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOinoinoL2Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOinoinoL2Object.string2]) return NO;
+    if (!_string2 && !otherOinoinoL2Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOinoinoL2Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOinoinoL2Object->_string2]) return NO;
 
-    if (!self.oinoinoL3Object && !otherOinoinoL2Object.oinoinoL3Object) /* Keep going... */;
-    else if (!self.oinoinoL3Object && [otherOinoinoL2Object.oinoinoL3Object isEqualToOinoinoL3Object:[JROinoinoL3Object oinoinoL3Object]]) /* Keep going... */;
-    else if (!otherOinoinoL2Object.oinoinoL3Object && [self.oinoinoL3Object isEqualToOinoinoL3Object:[JROinoinoL3Object oinoinoL3Object]]) /* Keep going... */;
-    else if (![self.oinoinoL3Object isEqualToOinoinoL3Object:otherOinoinoL2Object.oinoinoL3Object]) return NO;
+    if (!_oinoinoL3Object && !otherOinoinoL2Object->_oinoinoL3Object) /* Keep going... */;
+    else if (!_oinoinoL3Object && [otherOinoinoL2Object->_oinoinoL3Object isEqualToOinoinoL3Object:[JROinoinoL3Object oinoinoL3Object]]) /* Keep going... */;
+    else if (!otherOinoinoL2Object->_oinoinoL3Object && [_oinoinoL3Object isEqualToOinoinoL3Object:[JROinoinoL3Object oinoinoL3Object]]) /* Keep going... */;
+    else if (![_oinoinoL3Object isEqualToOinoinoL3Object:otherOinoinoL2Object->_oinoinoL3Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROinoinoL2Object class]]) return NO;
+
+    return [self isEqualToOinoinoL2Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_oinoinoL3Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
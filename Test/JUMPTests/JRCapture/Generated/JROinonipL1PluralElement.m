@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROinonipL2Object *)oinonipL2Object
 {
+    if ([self.sharedPropertySet containsObject:@"oinonipL2Object"])
+        [self unshareProperty:@"oinonipL2Object"];
+
     return _oinonipL2Object;
 }
 
 - (void)setOinonipL2Object:(JROinonipL2Object *)newOinonipL2Object
 {
+    [self willChangeProperty:@"oinonipL2Object"];
     [self.dirtyPropertySet addObject:@"oinonipL2Object"];
 
-    _oinonipL2Object = newOinonipL2Object;
+    _oinonipL2Object = [self claimValue:newOinonipL2Object forProperty:@"oinonipL2Object"];
 
     [_oinonipL2Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _oinonipL2Object = [[JROinonipL2Object alloc] init];
+        _oinonipL2Object = [self claimValue:[[JROinonipL2Object alloc] init] forProperty:@"oinonipL2Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROinonipL1PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROinonipL1PluralElement *oinonipL1PluralElementCopy = (JROinonipL1PluralElement *)[super copyWithZone:zone];
+
+    oinonipL1PluralElementCopy->_string1 = _string1;
+    oinonipL1PluralElementCopy->_string2 = _string2;
+    oinonipL1PluralElementCopy->_oinonipL2Object = _oinonipL2Object;
+
+    return oinonipL1PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"oinonipL2Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinonipL2Object"]) return _oinonipL2Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinonipL2Object"]) _oinonipL2Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.oinonipL2Object ? [self.oinonipL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinonipL2Object ? [_oinonipL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinonipL2Object"];
 
     if (forEncoder)
@@ -219,6 +253,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -230,8 +265,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinonipL1PluralElement"];
 
-    if (self.oinonipL2Object)
-        [snapshotDictionary setObject:[self.oinonipL2Object snapshotDictionaryFromDirtyPropertySet]
+    if (_oinonipL2Object)
+        [snapshotDictionary setObject:[_oinonipL2Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"oinonipL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -239,6 +274,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"oinonipL1PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinonipL1PluralElement"] allObjects]];
 
@@ -254,18 +291,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"oinonipL2Object"])
-        [dictionary setObject:(self.oinonipL2Object ?
-                              [self.oinonipL2Object toUpdateDictionary] :
+        [dictionary setObject:(_oinonipL2Object ?
+                              [_oinonipL2Object toUpdateDictionary] :
                               [[JROinonipL2Object oinonipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"oinonipL2Object"];
-    else if ([self.oinonipL2Object needsUpdate])
-        [dictionary setObject:[self.oinonipL2Object toUpdateDictionary]
+    else if ([_oinonipL2Object needsUpdate])
+        [dictionary setObject:[_oinonipL2Object toUpdateDictionary]
                        forKey:@"oinonipL2Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -282,11 +319,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.oinonipL2Object ?
-                          [self.oinonipL2Object toReplaceDictionary] :
+    [dictionary setObject:(_oinonipL2Object ?
+                          [_oinonipL2Object toReplaceDictionary] :
                           [[JROinonipL2Object oinonipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"oinonipL2Object"];
 
@@ -299,7 +336,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.oinonipL2Object needsUpdate])
+    if ([_oinonipL2Object needsUpdate])
         return YES;
 
     return NO;
@@ -307,22 +344,44 @@
 
 - (BOOL)isEqualToOinonipL1PluralElement:(JROinonipL1PluralElement *)otherOinonipL1PluralElement
 {
-    if (!self.string1 && !otherOinonipL1PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOinonipL1PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOinonipL1PluralElement.string1]) return NO;
+    if (!otherOinonipL1PluralElement) return NO;
+    if ([self hash] != [otherOinonipL1PluralElement hash]) return NO;
+
+    if (!_string1 && !otherOinonipL1PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOinonipL1PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOinonipL1PluralElement->_string1]) return NO;
 
-    if (!self.string2 && !otherOinonipL1PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOinonipL1PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOinonipL1PluralElement.string2]) return NO;
+    if (!_string2 && !otherOinonipL1PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOinonipL1PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOinonipL1PluralElement->_string2]) return NO;
 
-    if (!self.oinonipL2Object && !otherOinonipL1PluralElement.oinonipL2Object) /* Keep going... */;
-    else if (!self.oinonipL2Object && [otherOinonipL1PluralElement.oinonipL2Object isEqualToOinonipL2Object:[JROinonipL2Object oinonipL2Object]]) /* Keep going... */;
-    else if (!otherOinonipL1PluralElement.oinonipL2Object && [self.oinonipL2Object isEqualToOinonipL2Object:[JROinonipL2Object oinonipL2Object]]) /* Keep going... */;
-    else if (![self.oinonipL2Object isEqualToOinonipL2Object:otherOinonipL1PluralElement.oinonipL2Object]) return NO;
+    if (!_oinonipL2Object && !otherOinonipL1PluralElement->_oinonipL2Object) /* Keep going... */;
+    else if (!_oinonipL2Object && [otherOinonipL1PluralElement->_oinonipL2Object isEqualToOinonipL2Object:[JROinonipL2Object oinonipL2Object]]) /* Keep going... */;
+    else if (!otherOinonipL1PluralElement->_oinonipL2Object && [_oinonipL2Object isEqualToOinonipL2Object:[JROinonipL2Object oinonipL2Object]]) /* Keep going... */;
+    else if (![_oinonipL2Object isEqualToOinonipL2Object:otherOinonipL1PluralElement->_oinonipL2Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROinonipL1PluralElement class]]) return NO;
+
+    return [self isEqualToOinonipL1PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_oinonipL2Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
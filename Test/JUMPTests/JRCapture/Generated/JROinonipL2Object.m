@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROinonipL3Object *)oinonipL3Object
 {
+    if ([self.sharedPropertySet containsObject:@"oinonipL3Object"])
+        [self unshareProperty:@"oinonipL3Object"];
+
     return _oinonipL3Object;
 }
 
 - (void)setOinonipL3Object:(JROinonipL3Object *)newOinonipL3Object
 {
+    [self willChangeProperty:@"oinonipL3Object"];
     [self.dirtyPropertySet addObject:@"oinonipL3Object"];
 
-    _oinonipL3Object = newOinonipL3Object;
+    _oinonipL3Object = [self claimValue:newOinonipL3Object forProperty:@"oinonipL3Object"];
 
     [_oinonipL3Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _oinonipL3Object = [[JROinonipL3Object alloc] init];
+        _oinonipL3Object = [self claimValue:[[JROinonipL3Object alloc] init] forProperty:@"oinonipL3Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROinonipL2Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROinonipL2Object *oinonipL2ObjectCopy = (JROinonipL2Object *)[super copyWithZone:zone];
+
+    oinonipL2ObjectCopy->_string1 = _string1;
+    oinonipL2ObjectCopy->_string2 = _string2;
+    oinonipL2ObjectCopy->_oinonipL3Object = _oinonipL3Object;
+
+    return oinonipL2ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"oinonipL3Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinonipL3Object"]) return _oinonipL3Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"oinonipL3Object"]) _oinonipL3Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.oinonipL3Object ? [self.oinonipL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_oinonipL3Object ? [_oinonipL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"oinonipL3Object"];
 
     if (forEncoder)
@@ -219,6 +253,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -230,8 +265,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"oinonipL2Object"];
 
-    if (self.oinonipL3Object)
-        [snapshotDictionary setObject:[self.oinonipL3Object snapshotDictionaryFromDirtyPropertySet]
+    if (_oinonipL3Object)
+        [snapshotDictionary setObject:[_oinonipL3Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"oinonipL3Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -239,6 +274,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"oinonipL2Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinonipL2Object"] allObjects]];
 
@@ -254,18 +291,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"oinonipL3Object"])
-        [dictionary setObject:(self.oinonipL3Object ?
-                              [self.oinonipL3Object toUpdateDictionary] :
+        [dictionary setObject:(_oinonipL3Object ?
+                              [_oinonipL3Object toUpdateDictionary] :
                               [[JROinonipL3Object oinonipL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"oinonipL3Object"];
-    else if ([self.oinonipL3Object needsUpdate])
-        [dictionary setObject:[self.oinonipL3Object toUpdateDictionary]
+    else if ([_oinonipL3Object needsUpdate])
+        [dictionary setObject:[_oinonipL3Object toUpdateDictionary]
                        forKey:@"oinonipL3Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -282,11 +319,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.oinonipL3Object ?
-                          [self.oinonipL3Object toReplaceDictionary] :
+    [dictionary setObject:(_oinonipL3Object ?
+                          [_oinonipL3Object toReplaceDictionary] :
                           [[JROinonipL3Object oinonipL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"oinonipL3Object"];
 
@@ -299,7 +336,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.oinonipL3Object needsUpdate])
+    if ([_oinonipL3Object needsUpdate])
         return YES;
 
     return NO;
@@ -307,22 +344,44 @@
 
 - (BOOL)isEqualToOinonipL2Object:(JROinonipL2Object *)otherOinonipL2Object
 {
-    if (!self.string1 && !otherOinonipL2Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOinonipL2Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOinonipL2Object.string1]) return NO;
+    if (!otherOinonipL2Object) return NO;
+    if ([self hash] != [otherOinonipL2Object hash]) return NO;
+
+    if (!_string1 && !otherOinonipL2Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOinonipL2Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOinonipL2Object->_string1]) return NO;
 
-    if (!self.string2 && !otherOinonipL2Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOinonipL2Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOinonipL2Object.string2]) return NO;
+    if (!_string2 && !otherOinonipL2Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOinonipL2Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOinonipL2Object->_string2]) return NO;
 
-    if (!self.oinonipL3Object && !otherOinonipL2Object.oinonipL3Object) /* Keep going... */;
-    else if (!self.oinonipL3Object && [otherOinonipL2Object.oinonipL3Object isEqualToOinonipL3Object:[JROinonipL3Object oinonipL3Object]]) /* Keep going... */;
-    else if (!otherOinonipL2Object.oinonipL3Object && [self.oinonipL3Object isEqualToOinonipL3Object:[JROinonipL3Object oinonipL3Object]]) /* Keep going... */;
-    else if (![self.oinonipL3Object isEqualToOinonipL3Object:otherOinonipL2Object.oinonipL3Object]) return NO;
+    if (!_oinonipL3Object && !otherOinonipL2Object->_oinonipL3Object) /* Keep going... */;
+    else if (!_oinonipL3Object && [otherOinonipL2Object->_oinonipL3Object isEqualToOinonipL3Object:[JROinonipL3Object oinonipL3Object]]) /* Keep going... */;
+    else if (!otherOinonipL2Object->_oinonipL3Object && [_oinonipL3Object isEqualToOinonipL3Object:[JROinonipL3Object oinonipL3Object]]) /* Keep going... */;
+    else if (![_oinonipL3Object isEqualToOinonipL3Object:otherOinonipL2Object->_oinonipL3Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROinonipL2Object class]]) return NO;
+
+    return [self isEqualToOinonipL2Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_oinonipL3Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
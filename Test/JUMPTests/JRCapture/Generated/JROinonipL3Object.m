@@ -58,6 +58,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -70,6 +71,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -93,14 +95,39 @@
     return [[JROinonipL3Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROinonipL3Object *oinonipL3ObjectCopy = (JROinonipL3Object *)[super copyWithZone:zone];
+
+    oinonipL3ObjectCopy->_string1 = _string1;
+    oinonipL3ObjectCopy->_string2 = _string2;
+
+    return oinonipL3ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
 
     if (forEncoder)
@@ -185,6 +212,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -201,6 +229,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"oinonipL3Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"oinonipL3Object"] allObjects]];
 
@@ -212,10 +242,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -231,8 +261,8 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -248,17 +278,38 @@
 
 - (BOOL)isEqualToOinonipL3Object:(JROinonipL3Object *)otherOinonipL3Object
 {
-    if (!self.string1 && !otherOinonipL3Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOinonipL3Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOinonipL3Object.string1]) return NO;
+    if (!otherOinonipL3Object) return NO;
+    if ([self hash] != [otherOinonipL3Object hash]) return NO;
+
+    if (!_string1 && !otherOinonipL3Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOinonipL3Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOinonipL3Object->_string1]) return NO;
 
-    if (!self.string2 && !otherOinonipL3Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOinonipL3Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOinonipL3Object.string2]) return NO;
+    if (!_string2 && !otherOinonipL3Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOinonipL3Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOinonipL3Object->_string2]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROinonipL3Object class]]) return NO;
+
+    return [self isEqualToOinonipL3Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
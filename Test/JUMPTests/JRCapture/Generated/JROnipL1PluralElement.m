@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROnipL2Object *)onipL2Object
 {
+    if ([self.sharedPropertySet containsObject:@"onipL2Object"])
+        [self unshareProperty:@"onipL2Object"];
+
     return _onipL2Object;
 }
 
 - (void)setOnipL2Object:(JROnipL2Object *)newOnipL2Object
 {
+    [self willChangeProperty:@"onipL2Object"];
     [self.dirtyPropertySet addObject:@"onipL2Object"];
 
-    _onipL2Object = newOnipL2Object;
+    _onipL2Object = [self claimValue:newOnipL2Object forProperty:@"onipL2Object"];
 
     [_onipL2Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _onipL2Object = [[JROnipL2Object alloc] init];
+        _onipL2Object = [self claimValue:[[JROnipL2Object alloc] init] forProperty:@"onipL2Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROnipL1PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROnipL1PluralElement *onipL1PluralElementCopy = (JROnipL1PluralElement *)[super copyWithZone:zone];
+
+    onipL1PluralElementCopy->_string1 = _string1;
+    onipL1PluralElementCopy->_string2 = _string2;
+    onipL1PluralElementCopy->_onipL2Object = _onipL2Object;
+
+    return onipL1PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"onipL2Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipL2Object"]) return _onipL2Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipL2Object"]) _onipL2Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.onipL2Object ? [self.onipL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipL2Object ? [_onipL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipL2Object"];
 
     if (forEncoder)
@@ -219,6 +253,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -230,8 +265,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipL1PluralElement"];
 
-    if (self.onipL2Object)
-        [snapshotDictionary setObject:[self.onipL2Object snapshotDictionaryFromDirtyPropertySet]
+    if (_onipL2Object)
+        [snapshotDictionary setObject:[_onipL2Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"onipL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -239,6 +274,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"onipL1PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipL1PluralElement"] allObjects]];
 
@@ -254,18 +291,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"onipL2Object"])
-        [dictionary setObject:(self.onipL2Object ?
-                              [self.onipL2Object toUpdateDictionary] :
+        [dictionary setObject:(_onipL2Object ?
+                              [_onipL2Object toUpdateDictionary] :
                               [[JROnipL2Object onipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"onipL2Object"];
-    else if ([self.onipL2Object needsUpdate])
-        [dictionary setObject:[self.onipL2Object toUpdateDictionary]
+    else if ([_onipL2Object needsUpdate])
+        [dictionary setObject:[_onipL2Object toUpdateDictionary]
                        forKey:@"onipL2Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -282,11 +319,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.onipL2Object ?
-                          [self.onipL2Object toReplaceDictionary] :
+    [dictionary setObject:(_onipL2Object ?
+                          [_onipL2Object toReplaceDictionary] :
                           [[JROnipL2Object onipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"onipL2Object"];
 
@@ -299,7 +336,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.onipL2Object needsUpdate])
+    if ([_onipL2Object needsUpdate])
         return YES;
 
     return NO;
@@ -307,22 +344,44 @@
 
 - (BOOL)isEqualToOnipL1PluralElement:(JROnipL1PluralElement *)otherOnipL1PluralElement
 {
-    if (!self.string1 && !otherOnipL1PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOnipL1PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOnipL1PluralElement.string1]) return NO;
+    if (!otherOnipL1PluralElement) return NO;
+    if ([self hash] != [otherOnipL1PluralElement hash]) return NO;
+
+    if (!_string1 && !otherOnipL1PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOnipL1PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOnipL1PluralElement->_string1]) return NO;
 
-    if (!self.string2 && !otherOnipL1PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOnipL1PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOnipL1PluralElement.string2]) return NO;
+    if (!_string2 && !otherOnipL1PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOnipL1PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOnipL1PluralElement->_string2]) return NO;
 
-    if (!self.onipL2Object && !otherOnipL1PluralElement.onipL2Object) /* Keep going... */;
-    else if (!self.onipL2Object && [otherOnipL1PluralElement.onipL2Object isEqualToOnipL2Object:[JROnipL2Object onipL2Object]]) /* Keep going... */;
-    else if (!otherOnipL1PluralElement.onipL2Object && [self.onipL2Object isEqualToOnipL2Object:[JROnipL2Object onipL2Object]]) /* Keep going... */;
-    else if (![self.onipL2Object isEqualToOnipL2Object:otherOnipL1PluralElement.onipL2Object]) return NO;
+    if (!_onipL2Object && !otherOnipL1PluralElement->_onipL2Object) /* Keep going... */;
+    else if (!_onipL2Object && [otherOnipL1PluralElement->_onipL2Object isEqualToOnipL2Object:[JROnipL2Object onipL2Object]]) /* Keep going... */;
+    else if (!otherOnipL1PluralElement->_onipL2Object && [_onipL2Object isEqualToOnipL2Object:[JROnipL2Object onipL2Object]]) /* Keep going... */;
+    else if (![_onipL2Object isEqualToOnipL2Object:otherOnipL1PluralElement->_onipL2Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROnipL1PluralElement class]]) return NO;
+
+    return [self isEqualToOnipL1PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_onipL2Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)onipinapL2Plural
 {
+    if ([self.sharedPropertySet containsObject:@"onipinapL2Plural"])
+        [self unshareProperty:@"onipinapL2Plural"];
+
     return _onipinapL2Plural;
 }
 
 - (void)setOnipinapL2Plural:(NSArray *)newOnipinapL2Plural
 {
-    _onipinapL2Plural = [newOnipinapL2Plural copy];
+    [self willChangeProperty:@"onipinapL2Plural"];
+
+    _onipinapL2Plural = [self claimValue:[newOnipinapL2Plural copy] forProperty:@"onipinapL2Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JROnipinapL1PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROnipinapL1PluralElement *onipinapL1PluralElementCopy = (JROnipinapL1PluralElement *)[super copyWithZone:zone];
+
+    onipinapL1PluralElementCopy->_string1 = _string1;
+    onipinapL1PluralElementCopy->_string2 = _string2;
+    onipinapL1PluralElementCopy->_onipinapL2Plural = _onipinapL2Plural;
+
+    return onipinapL1PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"onipinapL2Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinapL2Plural"]) return _onipinapL2Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinapL2Plural"]) _onipinapL2Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.onipinapL2Plural ? [self.onipinapL2Plural arrayOfOnipinapL2PluralDictionariesFromOnipinapL2PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipinapL2Plural ? [_onipinapL2Plural arrayOfOnipinapL2PluralDictionariesFromOnipinapL2PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipinapL2Plural"];
 
     if (forEncoder)
@@ -271,6 +306,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -287,6 +323,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"onipinapL1PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinapL1PluralElement"] allObjects]];
 
@@ -298,10 +336,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -317,11 +355,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.onipinapL2Plural ?
-                          [self.onipinapL2Plural arrayOfOnipinapL2PluralReplaceDictionariesFromOnipinapL2PluralElements] :
+    [dictionary setObject:(_onipinapL2Plural ?
+                          [_onipinapL2Plural arrayOfOnipinapL2PluralReplaceDictionariesFromOnipinapL2PluralElements] :
                           [NSArray array])
                    forKey:@"onipinapL2Plural"];
 
@@ -345,22 +383,44 @@
 
 - (BOOL)isEqualToOnipinapL1PluralElement:(JROnipinapL1PluralElement *)otherOnipinapL1PluralElement
 {
-    if (!self.string1 && !otherOnipinapL1PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOnipinapL1PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOnipinapL1PluralElement.string1]) return NO;
+    if (!otherOnipinapL1PluralElement) return NO;
+    if ([self hash] != [otherOnipinapL1PluralElement hash]) return NO;
 
-    if (!self.string2 && !otherOnipinapL1PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOnipinapL1PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOnipinapL1PluralElement.string2]) return NO;
+    if (!_string1 && !otherOnipinapL1PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOnipinapL1PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOnipinapL1PluralElement->_string1]) return NO;
 
-    if (!self.onipinapL2Plural && !otherOnipinapL1PluralElement.onipinapL2Plural) /* Keep going... */;
-    else if (!self.onipinapL2Plural && ![otherOnipinapL1PluralElement.onipinapL2Plural count]) /* Keep going... */;
-    else if (!otherOnipinapL1PluralElement.onipinapL2Plural && ![self.onipinapL2Plural count]) /* Keep going... */;
-    else if (![self.onipinapL2Plural isEqualToOnipinapL2PluralArray:otherOnipinapL1PluralElement.onipinapL2Plural]) return NO;
+    if (!_string2 && !otherOnipinapL1PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOnipinapL1PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOnipinapL1PluralElement->_string2]) return NO;
+
+    if (!_onipinapL2Plural && !otherOnipinapL1PluralElement->_onipinapL2Plural) /* Keep going... */;
+    else if (!_onipinapL2Plural && ![otherOnipinapL1PluralElement->_onipinapL2Plural count]) /* Keep going... */;
+    else if (!otherOnipinapL1PluralElement->_onipinapL2Plural && ![_onipinapL2Plural count]) /* Keep going... */;
+    else if (![_onipinapL2Plural isEqualToOnipinapL2PluralArray:otherOnipinapL1PluralElement->_onipinapL2Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROnipinapL1PluralElement class]]) return NO;
+
+    return [self isEqualToOnipinapL1PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_onipinapL2Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROnipinapL3Object *)onipinapL3Object
 {
+    if ([self.sharedPropertySet containsObject:@"onipinapL3Object"])
+        [self unshareProperty:@"onipinapL3Object"];
+
     return _onipinapL3Object;
 }
 
 - (void)setOnipinapL3Object:(JROnipinapL3Object *)newOnipinapL3Object
 {
+    [self willChangeProperty:@"onipinapL3Object"];
     [self.dirtyPropertySet addObject:@"onipinapL3Object"];
 
-    _onipinapL3Object = newOnipinapL3Object;
+    _onipinapL3Object = [self claimValue:newOnipinapL3Object forProperty:@"onipinapL3Object"];
 
     [_onipinapL3Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _onipinapL3Object = [[JROnipinapL3Object alloc] init];
+        _onipinapL3Object = [self claimValue:[[JROnipinapL3Object alloc] init] forProperty:@"onipinapL3Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROnipinapL2PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROnipinapL2PluralElement *onipinapL2PluralElementCopy = (JROnipinapL2PluralElement *)[super copyWithZone:zone];
+
+    onipinapL2PluralElementCopy->_string1 = _string1;
+    onipinapL2PluralElementCopy->_string2 = _string2;
+    onipinapL2PluralElementCopy->_onipinapL3Object = _onipinapL3Object;
+
+    return onipinapL2PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"onipinapL3Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinapL3Object"]) return _onipinapL3Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinapL3Object"]) _onipinapL3Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.onipinapL3Object ? [self.onipinapL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipinapL3Object ? [_onipinapL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipinapL3Object"];
 
     if (forEncoder)
@@ -219,6 +253,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -230,8 +265,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipinapL2PluralElement"];
 
-    if (self.onipinapL3Object)
-        [snapshotDictionary setObject:[self.onipinapL3Object snapshotDictionaryFromDirtyPropertySet]
+    if (_onipinapL3Object)
+        [snapshotDictionary setObject:[_onipinapL3Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"onipinapL3Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -239,6 +274,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"onipinapL2PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinapL2PluralElement"] allObjects]];
 
@@ -254,18 +291,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"onipinapL3Object"])
-        [dictionary setObject:(self.onipinapL3Object ?
-                              [self.onipinapL3Object toUpdateDictionary] :
+        [dictionary setObject:(_onipinapL3Object ?
+                              [_onipinapL3Object toUpdateDictionary] :
                               [[JROnipinapL3Object onipinapL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"onipinapL3Object"];
-    else if ([self.onipinapL3Object needsUpdate])
-        [dictionary setObject:[self.onipinapL3Object toUpdateDictionary]
+    else if ([_onipinapL3Object needsUpdate])
+        [dictionary setObject:[_onipinapL3Object toUpdateDictionary]
                        forKey:@"onipinapL3Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -282,11 +319,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.onipinapL3Object ?
-                          [self.onipinapL3Object toReplaceDictionary] :
+    [dictionary setObject:(_onipinapL3Object ?
+                          [_onipinapL3Object toReplaceDictionary] :
                           [[JROnipinapL3Object onipinapL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"onipinapL3Object"];
 
@@ -299,7 +336,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.onipinapL3Object needsUpdate])
+    if ([_onipinapL3Object needsUpdate])
         return YES;
 
     return NO;
@@ -307,22 +344,44 @@
 
 - (BOOL)isEqualToOnipinapL2PluralElement:(JROnipinapL2PluralElement *)otherOnipinapL2PluralElement
 {
-    if (!self.string1 && !otherOnipinapL2PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOnipinapL2PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOnipinapL2PluralElement.string1]) return NO;
+    if (!otherOnipinapL2PluralElement) return NO;
+    if ([self hash] != [otherOnipinapL2PluralElement hash]) return NO;
+
+    if (!_string1 && !otherOnipinapL2PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOnipinapL2PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOnipinapL2PluralElement->_string1]) return NO;
 
-    if (!self.string2 && !otherOnipinapL2PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOnipinapL2PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOnipinapL2PluralElement.string2]) return NO;
+    if (!_string2 && !otherOnipinapL2PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOnipinapL2PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOnipinapL2PluralElement->_string2]) return NO;
 
-    if (!self.onipinapL3Object && !otherOnipinapL2PluralElement.onipinapL3Object) /* Keep going... */;
-    else if (!self.onipinapL3Object && [otherOnipinapL2PluralElement.onipinapL3Object isEqualToOnipinapL3Object:[JROnipinapL3Object onipinapL3Object]]) /* Keep going... */;
-    else if (!otherOnipinapL2PluralElement.onipinapL3Object && [self.onipinapL3Object isEqualToOnipinapL3Object:[JROnipinapL3Object onipinapL3Object]]) /* Keep going... */;
-    else if (![self.onipinapL3Object isEqualToOnipinapL3Object:otherOnipinapL2PluralElement.onipinapL3Object]) return NO;
+    if (!_onipinapL3Object && !otherOnipinapL2PluralElement->_onipinapL3Object) /* Keep going... */;
+    else if (!_onipinapL3Object && [otherOnipinapL2PluralElement->_onipinapL3Object isEqualToOnipinapL3Object:[JROnipinapL3Object onipinapL3Object]]) /* Keep going... */;
+    else if (!otherOnipinapL2PluralElement->_onipinapL3Object && [_onipinapL3Object isEqualToOnipinapL3Object:[JROnipinapL3Object onipinapL3Object]]) /* Keep going... */;
+    else if (![_onipinapL3Object isEqualToOnipinapL3Object:otherOnipinapL2PluralElement->_onipinapL3Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROnipinapL2PluralElement class]]) return NO;
+
+    return [self isEqualToOnipinapL2PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_onipinapL3Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)onipinoL2Plural
 {
+    if ([self.sharedPropertySet containsObject:@"onipinoL2Plural"])
+        [self unshareProperty:@"onipinoL2Plural"];
+
     return _onipinoL2Plural;
 }
 
 - (void)setOnipinoL2Plural:(NSArray *)newOnipinoL2Plural
 {
-    _onipinoL2Plural = [newOnipinoL2Plural copy];
+    [self willChangeProperty:@"onipinoL2Plural"];
+
+    _onipinoL2Plural = [self claimValue:[newOnipinoL2Plural copy] forProperty:@"onipinoL2Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JROnipinoL1Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROnipinoL1Object *onipinoL1ObjectCopy = (JROnipinoL1Object *)[super copyWithZone:zone];
+
+    onipinoL1ObjectCopy->_string1 = _string1;
+    onipinoL1ObjectCopy->_string2 = _string2;
+    onipinoL1ObjectCopy->_onipinoL2Plural = _onipinoL2Plural;
+
+    return onipinoL1ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"onipinoL2Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinoL2Plural"]) return _onipinoL2Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinoL2Plural"]) _onipinoL2Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.onipinoL2Plural ? [self.onipinoL2Plural arrayOfOnipinoL2PluralDictionariesFromOnipinoL2PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipinoL2Plural ? [_onipinoL2Plural arrayOfOnipinoL2PluralDictionariesFromOnipinoL2PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipinoL2Plural"];
 
     if (forEncoder)
@@ -264,6 +299,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -280,6 +316,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"onipinoL1Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinoL1Object"] allObjects]];
 
@@ -291,10 +329,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -310,11 +348,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.onipinoL2Plural ?
-                          [self.onipinoL2Plural arrayOfOnipinoL2PluralReplaceDictionariesFromOnipinoL2PluralElements] :
+    [dictionary setObject:(_onipinoL2Plural ?
+                          [_onipinoL2Plural arrayOfOnipinoL2PluralReplaceDictionariesFromOnipinoL2PluralElements] :
                           [NSArray array])
                    forKey:@"onipinoL2Plural"];
 
@@ -338,22 +376,44 @@
 
 - (BOOL)isEqualToOnipinoL1Object:(JROnipinoL1Object *)otherOnipinoL1Object
 {
-    if (!self.string1 && !otherOnipinoL1Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOnipinoL1Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOnipinoL1Object.string1]) return NO;
+    if (!otherOnipinoL1Object) return NO;
+    if ([self hash] != [otherOnipinoL1Object hash]) return NO;
 
-    if (!self.string2 && !otherOnipinoL1Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOnipinoL1Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOnipinoL1Object.string2]) return NO;
+    if (!_string1 && !otherOnipinoL1Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOnipinoL1Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOnipinoL1Object->_string1]) return NO;
 
-    if (!self.onipinoL2Plural && !otherOnipinoL1Object.onipinoL2Plural) /* Keep going... */;
-    else if (!self.onipinoL2Plural && ![otherOnipinoL1Object.onipinoL2Plural count]) /* Keep going... */;
-    else if (!otherOnipinoL1Object.onipinoL2Plural && ![self.onipinoL2Plural count]) /* Keep going... */;
-    else if (![self.onipinoL2Plural isEqualToOnipinoL2PluralArray:otherOnipinoL1Object.onipinoL2Plural]) return NO;
+    if (!_string2 && !otherOnipinoL1Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOnipinoL1Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOnipinoL1Object->_string2]) return NO;
+
+    if (!_onipinoL2Plural && !otherOnipinoL1Object->_onipinoL2Plural) /* Keep going... */;
+    else if (!_onipinoL2Plural && ![otherOnipinoL1Object->_onipinoL2Plural count]) /* Keep going... */;
+    else if (!otherOnipinoL1Object->_onipinoL2Plural && ![_onipinoL2Plural count]) /* Keep going... */;
+    else if (![_onipinoL2Plural isEqualToOnipinoL2PluralArray:otherOnipinoL1Object->_onipinoL2Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROnipinoL1Object class]]) return NO;
+
+    return [self isEqualToOnipinoL1Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_onipinoL2Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
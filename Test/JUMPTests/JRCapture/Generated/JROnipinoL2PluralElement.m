@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JROnipinoL3Object *)onipinoL3Object
 {
+    if ([self.sharedPropertySet containsObject:@"onipinoL3Object"])
+        [self unshareProperty:@"onipinoL3Object"];
+
     return _onipinoL3Object;
 }
 
 - (void)setOnipinoL3Object:(JROnipinoL3Object *)newOnipinoL3Object
 {
+    [self willChangeProperty:@"onipinoL3Object"];
     [self.dirtyPropertySet addObject:@"onipinoL3Object"];
 
-    _onipinoL3Object = newOnipinoL3Object;
+    _onipinoL3Object = [self claimValue:newOnipinoL3Object forProperty:@"onipinoL3Object"];
 
     [_onipinoL3Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _onipinoL3Object = [[JROnipinoL3Object alloc] init];
+        _onipinoL3Object = [self claimValue:[[JROnipinoL3Object alloc] init] forProperty:@"onipinoL3Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JROnipinoL2PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JROnipinoL2PluralElement *onipinoL2PluralElementCopy = (JROnipinoL2PluralElement *)[super copyWithZone:zone];
+
+    onipinoL2PluralElementCopy->_string1 = _string1;
+    onipinoL2PluralElementCopy->_string2 = _string2;
+    onipinoL2PluralElementCopy->_onipinoL3Object = _onipinoL3Object;
+
+    return onipinoL2PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"onipinoL3Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinoL3Object"]) return _onipinoL3Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"onipinoL3Object"]) _onipinoL3Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.onipinoL3Object ? [self.onipinoL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_onipinoL3Object ? [_onipinoL3Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"onipinoL3Object"];
 
     if (forEncoder)
@@ -219,6 +253,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -230,8 +265,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"onipinoL2PluralElement"];
 
-    if (self.onipinoL3Object)
-        [snapshotDictionary setObject:[self.onipinoL3Object snapshotDictionaryFromDirtyPropertySet]
+    if (_onipinoL3Object)
+        [snapshotDictionary setObject:[_onipinoL3Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"onipinoL3Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -239,6 +274,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"onipinoL2PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"onipinoL2PluralElement"] allObjects]];
 
@@ -254,18 +291,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"onipinoL3Object"])
-        [dictionary setObject:(self.onipinoL3Object ?
-                              [self.onipinoL3Object toUpdateDictionary] :
+        [dictionary setObject:(_onipinoL3Object ?
+                              [_onipinoL3Object toUpdateDictionary] :
                               [[JROnipinoL3Object onipinoL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"onipinoL3Object"];
-    else if ([self.onipinoL3Object needsUpdate])
-        [dictionary setObject:[self.onipinoL3Object toUpdateDictionary]
+    else if ([_onipinoL3Object needsUpdate])
+        [dictionary setObject:[_onipinoL3Object toUpdateDictionary]
                        forKey:@"onipinoL3Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -282,11 +319,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.onipinoL3Object ?
-                          [self.onipinoL3Object toReplaceDictionary] :
+    [dictionary setObject:(_onipinoL3Object ?
+                          [_onipinoL3Object toReplaceDictionary] :
                           [[JROnipinoL3Object onipinoL3Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"onipinoL3Object"];
 
@@ -299,7 +336,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.onipinoL3Object needsUpdate])
+    if ([_onipinoL3Object needsUpdate])
         return YES;
 
     return NO;
@@ -307,22 +344,44 @@
 
 - (BOOL)isEqualToOnipinoL2PluralElement:(JROnipinoL2PluralElement *)otherOnipinoL2PluralElement
 {
-    if (!self.string1 && !otherOnipinoL2PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherOnipinoL2PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherOnipinoL2PluralElement.string1]) return NO;
+    if (!otherOnipinoL2PluralElement) return NO;
+    if ([self hash] != [otherOnipinoL2PluralElement hash]) return NO;
+
+    if (!_string1 && !otherOnipinoL2PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherOnipinoL2PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherOnipinoL2PluralElement->_string1]) return NO;
 
-    if (!self.string2 && !otherOnipinoL2PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherOnipinoL2PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherOnipinoL2PluralElement.string2]) return NO;
+    if (!_string2 && !otherOnipinoL2PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherOnipinoL2PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherOnipinoL2PluralElement->_string2]) return NO;
 
-    if (!self.onipinoL3Object && !otherOnipinoL2PluralElement.onipinoL3Object) /* Keep going... */;
-    else if (!self.onipinoL3Object && [otherOnipinoL2PluralElement.onipinoL3Object isEqualToOnipinoL3Object:[JROnipinoL3Object onipinoL3Object]]) /* Keep going... */;
-    else if (!otherOnipinoL2PluralElement.onipinoL3Object && [self.onipinoL3Object isEqualToOnipinoL3Object:[JROnipinoL3Object onipinoL3Object]]) /* Keep going... */;
-    else if (![self.onipinoL3Object isEqualToOnipinoL3Object:otherOnipinoL2PluralElement.onipinoL3Object]) return NO;
+    if (!_onipinoL3Object && !otherOnipinoL2PluralElement->_onipinoL3Object) /* Keep going... */;
+    else if (!_onipinoL3Object && [otherOnipinoL2PluralElement->_onipinoL3Object isEqualToOnipinoL3Object:[JROnipinoL3Object onipinoL3Object]]) /* Keep going... */;
+    else if (!otherOnipinoL2PluralElement->_onipinoL3Object && [_onipinoL3Object isEqualToOnipinoL3Object:[JROnipinoL3Object onipinoL3Object]]) /* Keep going... */;
+    else if (![_onipinoL3Object isEqualToOnipinoL3Object:otherOnipinoL2PluralElement->_onipinoL3Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JROnipinoL2PluralElement class]]) return NO;
+
+    return [self isEqualToOnipinoL2PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_onipinoL3Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinapL2Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinapL2Plural"])
+        [self unshareProperty:@"pinapL2Plural"];
+
     return _pinapL2Plural;
 }
 
 - (void)setPinapL2Plural:(NSArray *)newPinapL2Plural
 {
-    _pinapL2Plural = [newPinapL2Plural copy];
+    [self willChangeProperty:@"pinapL2Plural"];
+
+    _pinapL2Plural = [self claimValue:[newPinapL2Plural copy] forProperty:@"pinapL2Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinapL1PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinapL1PluralElement *pinapL1PluralElementCopy = (JRPinapL1PluralElement *)[super copyWithZone:zone];
+
+    pinapL1PluralElementCopy->_string1 = _string1;
+    pinapL1PluralElementCopy->_string2 = _string2;
+    pinapL1PluralElementCopy->_pinapL2Plural = _pinapL2Plural;
+
+    return pinapL1PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinapL2Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapL2Plural"]) return _pinapL2Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapL2Plural"]) _pinapL2Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinapL2Plural ? [self.pinapL2Plural arrayOfPinapL2PluralDictionariesFromPinapL2PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapL2Plural ? [_pinapL2Plural arrayOfPinapL2PluralDictionariesFromPinapL2PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapL2Plural"];
 
     if (forEncoder)
@@ -271,6 +306,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -287,6 +323,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinapL1PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapL1PluralElement"] allObjects]];
 
@@ -298,10 +336,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -317,11 +355,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinapL2Plural ?
-                          [self.pinapL2Plural arrayOfPinapL2PluralReplaceDictionariesFromPinapL2PluralElements] :
+    [dictionary setObject:(_pinapL2Plural ?
+                          [_pinapL2Plural arrayOfPinapL2PluralReplaceDictionariesFromPinapL2PluralElements] :
                           [NSArray array])
                    forKey:@"pinapL2Plural"];
 
@@ -345,22 +383,44 @@
 
 - (BOOL)isEqualToPinapL1PluralElement:(JRPinapL1PluralElement *)otherPinapL1PluralElement
 {
-    if (!self.string1 && !otherPinapL1PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinapL1PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinapL1PluralElement.string1]) return NO;
+    if (!otherPinapL1PluralElement) return NO;
+    if ([self hash] != [otherPinapL1PluralElement hash]) return NO;
 
-    if (!self.string2 && !otherPinapL1PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinapL1PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinapL1PluralElement.string2]) return NO;
+    if (!_string1 && !otherPinapL1PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinapL1PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinapL1PluralElement->_string1]) return NO;
 
-    if (!self.pinapL2Plural && !otherPinapL1PluralElement.pinapL2Plural) /* Keep going... */;
-    else if (!self.pinapL2Plural && ![otherPinapL1PluralElement.pinapL2Plural count]) /* Keep going... */;
-    else if (!otherPinapL1PluralElement.pinapL2Plural && ![self.pinapL2Plural count]) /* Keep going... */;
-    else if (![self.pinapL2Plural isEqualToPinapL2PluralArray:otherPinapL1PluralElement.pinapL2Plural]) return NO;
+    if (!_string2 && !otherPinapL1PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinapL1PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinapL1PluralElement->_string2]) return NO;
+
+    if (!_pinapL2Plural && !otherPinapL1PluralElement->_pinapL2Plural) /* Keep going... */;
+    else if (!_pinapL2Plural && ![otherPinapL1PluralElement->_pinapL2Plural count]) /* Keep going... */;
+    else if (!otherPinapL1PluralElement->_pinapL2Plural && ![_pinapL2Plural count]) /* Keep going... */;
+    else if (![_pinapL2Plural isEqualToPinapL2PluralArray:otherPinapL1PluralElement->_pinapL2Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinapL1PluralElement class]]) return NO;
+
+    return [self isEqualToPinapL1PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinapL2Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
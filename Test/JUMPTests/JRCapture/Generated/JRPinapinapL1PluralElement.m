@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinapinapL2Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinapinapL2Plural"])
+        [self unshareProperty:@"pinapinapL2Plural"];
+
     return _pinapinapL2Plural;
 }
 
 - (void)setPinapinapL2Plural:(NSArray *)newPinapinapL2Plural
 {
-    _pinapinapL2Plural = [newPinapinapL2Plural copy];
+    [self willChangeProperty:@"pinapinapL2Plural"];
+
+    _pinapinapL2Plural = [self claimValue:[newPinapinapL2Plural copy] forProperty:@"pinapinapL2Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinapinapL1PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinapinapL1PluralElement *pinapinapL1PluralElementCopy = (JRPinapinapL1PluralElement *)[super copyWithZone:zone];
+
+    pinapinapL1PluralElementCopy->_string1 = _string1;
+    pinapinapL1PluralElementCopy->_string2 = _string2;
+    pinapinapL1PluralElementCopy->_pinapinapL2Plural = _pinapinapL2Plural;
+
+    return pinapinapL1PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinapinapL2Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinapL2Plural"]) return _pinapinapL2Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinapL2Plural"]) _pinapinapL2Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinapinapL2Plural ? [self.pinapinapL2Plural arrayOfPinapinapL2PluralDictionariesFromPinapinapL2PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapinapL2Plural ? [_pinapinapL2Plural arrayOfPinapinapL2PluralDictionariesFromPinapinapL2PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapinapL2Plural"];
 
     if (forEncoder)
@@ -271,6 +306,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -287,6 +323,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinapinapL1PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinapL1PluralElement"] allObjects]];
 
@@ -298,10 +336,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -317,11 +355,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinapinapL2Plural ?
-                          [self.pinapinapL2Plural arrayOfPinapinapL2PluralReplaceDictionariesFromPinapinapL2PluralElements] :
+    [dictionary setObject:(_pinapinapL2Plural ?
+                          [_pinapinapL2Plural arrayOfPinapinapL2PluralReplaceDictionariesFromPinapinapL2PluralElements] :
                           [NSArray array])
                    forKey:@"pinapinapL2Plural"];
 
@@ -345,22 +383,44 @@
 
 - (BOOL)isEqualToPinapinapL1PluralElement:(JRPinapinapL1PluralElement *)otherPinapinapL1PluralElement
 {
-    if (!self.string1 && !otherPinapinapL1PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinapinapL1PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinapinapL1PluralElement.string1]) return NO;
+    if (!otherPinapinapL1PluralElement) return NO;
+    if ([self hash] != [otherPinapinapL1PluralElement hash]) return NO;
 
-    if (!self.string2 && !otherPinapinapL1PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinapinapL1PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinapinapL1PluralElement.string2]) return NO;
+    if (!_string1 && !otherPinapinapL1PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinapinapL1PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinapinapL1PluralElement->_string1]) return NO;
 
-    if (!self.pinapinapL2Plural && !otherPinapinapL1PluralElement.pinapinapL2Plural) /* Keep going... */;
-    else if (!self.pinapinapL2Plural && ![otherPinapinapL1PluralElement.pinapinapL2Plural count]) /* Keep going... */;
-    else if (!otherPinapinapL1PluralElement.pinapinapL2Plural && ![self.pinapinapL2Plural count]) /* Keep going... */;
-    else if (![self.pinapinapL2Plural isEqualToPinapinapL2PluralArray:otherPinapinapL1PluralElement.pinapinapL2Plural]) return NO;
+    if (!_string2 && !otherPinapinapL1PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinapinapL1PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinapinapL1PluralElement->_string2]) return NO;
+
+    if (!_pinapinapL2Plural && !otherPinapinapL1PluralElement->_pinapinapL2Plural) /* Keep going... */;
+    else if (!_pinapinapL2Plural && ![otherPinapinapL1PluralElement->_pinapinapL2Plural count]) /* Keep going... */;
+    else if (!otherPinapinapL1PluralElement->_pinapinapL2Plural && ![_pinapinapL2Plural count]) /* Keep going... */;
+    else if (![_pinapinapL2Plural isEqualToPinapinapL2PluralArray:otherPinapinapL1PluralElement->_pinapinapL2Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinapinapL1PluralElement class]]) return NO;
+
+    return [self isEqualToPinapinapL1PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinapinapL2Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
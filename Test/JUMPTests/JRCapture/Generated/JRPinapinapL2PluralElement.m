@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinapinapL3Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinapinapL3Plural"])
+        [self unshareProperty:@"pinapinapL3Plural"];
+
     return _pinapinapL3Plural;
 }
 
 - (void)setPinapinapL3Plural:(NSArray *)newPinapinapL3Plural
 {
-    _pinapinapL3Plural = [newPinapinapL3Plural copy];
+    [self willChangeProperty:@"pinapinapL3Plural"];
+
+    _pinapinapL3Plural = [self claimValue:[newPinapinapL3Plural copy] forProperty:@"pinapinapL3Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinapinapL2PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinapinapL2PluralElement *pinapinapL2PluralElementCopy = (JRPinapinapL2PluralElement *)[super copyWithZone:zone];
+
+    pinapinapL2PluralElementCopy->_string1 = _string1;
+    pinapinapL2PluralElementCopy->_string2 = _string2;
+    pinapinapL2PluralElementCopy->_pinapinapL3Plural = _pinapinapL3Plural;
+
+    return pinapinapL2PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinapinapL3Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinapL3Plural"]) return _pinapinapL3Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinapL3Plural"]) _pinapinapL3Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinapinapL3Plural ? [self.pinapinapL3Plural arrayOfPinapinapL3PluralDictionariesFromPinapinapL3PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapinapL3Plural ? [_pinapinapL3Plural arrayOfPinapinapL3PluralDictionariesFromPinapinapL3PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapinapL3Plural"];
 
     if (forEncoder)
@@ -271,6 +306,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -287,6 +323,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinapinapL2PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinapL2PluralElement"] allObjects]];
 
@@ -298,10 +336,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -317,11 +355,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinapinapL3Plural ?
-                          [self.pinapinapL3Plural arrayOfPinapinapL3PluralReplaceDictionariesFromPinapinapL3PluralElements] :
+    [dictionary setObject:(_pinapinapL3Plural ?
+                          [_pinapinapL3Plural arrayOfPinapinapL3PluralReplaceDictionariesFromPinapinapL3PluralElements] :
                           [NSArray array])
                    forKey:@"pinapinapL3Plural"];
 
@@ -345,22 +383,44 @@
 
 - (BOOL)isEqualToPinapinapL2PluralElement:(JRPinapinapL2PluralElement *)otherPinapinapL2PluralElement
 {
-    if (!self.string1 && !otherPinapinapL2PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinapinapL2PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinapinapL2PluralElement.string1]) return NO;
+    if (!otherPinapinapL2PluralElement) return NO;
+    if ([self hash] != [otherPinapinapL2PluralElement hash]) return NO;
 
-    if (!self.string2 && !otherPinapinapL2PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinapinapL2PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinapinapL2PluralElement.string2]) return NO;
+    if (!_string1 && !otherPinapinapL2PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinapinapL2PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinapinapL2PluralElement->_string1]) return NO;
 
-    if (!self.pinapinapL3Plural && !otherPinapinapL2PluralElement.pinapinapL3Plural) /* Keep going... */;
-    else if (!self.pinapinapL3Plural && ![otherPinapinapL2PluralElement.pinapinapL3Plural count]) /* Keep going... */;
-    else if (!otherPinapinapL2PluralElement.pinapinapL3Plural && ![self.pinapinapL3Plural count]) /* Keep going... */;
-    else if (![self.pinapinapL3Plural isEqualToPinapinapL3PluralArray:otherPinapinapL2PluralElement.pinapinapL3Plural]) return NO;
+    if (!_string2 && !otherPinapinapL2PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinapinapL2PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinapinapL2PluralElement->_string2]) return NO;
+
+    if (!_pinapinapL3Plural && !otherPinapinapL2PluralElement->_pinapinapL3Plural) /* Keep going... */;
+    else if (!_pinapinapL3Plural && ![otherPinapinapL2PluralElement->_pinapinapL3Plural count]) /* Keep going... */;
+    else if (!otherPinapinapL2PluralElement->_pinapinapL3Plural && ![_pinapinapL3Plural count]) /* Keep going... */;
+    else if (![_pinapinapL3Plural isEqualToPinapinapL3PluralArray:otherPinapinapL2PluralElement->_pinapinapL3Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinapinapL2PluralElement class]]) return NO;
+
+    return [self isEqualToPinapinapL2PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinapinapL3Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
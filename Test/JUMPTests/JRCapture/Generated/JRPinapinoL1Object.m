@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinapinoL2Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinapinoL2Plural"])
+        [self unshareProperty:@"pinapinoL2Plural"];
+
     return _pinapinoL2Plural;
 }
 
 - (void)setPinapinoL2Plural:(NSArray *)newPinapinoL2Plural
 {
-    _pinapinoL2Plural = [newPinapinoL2Plural copy];
+    [self willChangeProperty:@"pinapinoL2Plural"];
+
+    _pinapinoL2Plural = [self claimValue:[newPinapinoL2Plural copy] forProperty:@"pinapinoL2Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinapinoL1Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinapinoL1Object *pinapinoL1ObjectCopy = (JRPinapinoL1Object *)[super copyWithZone:zone];
+
+    pinapinoL1ObjectCopy->_string1 = _string1;
+    pinapinoL1ObjectCopy->_string2 = _string2;
+    pinapinoL1ObjectCopy->_pinapinoL2Plural = _pinapinoL2Plural;
+
+    return pinapinoL1ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinapinoL2Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinoL2Plural"]) return _pinapinoL2Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinoL2Plural"]) _pinapinoL2Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinapinoL2Plural ? [self.pinapinoL2Plural arrayOfPinapinoL2PluralDictionariesFromPinapinoL2PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapinoL2Plural ? [_pinapinoL2Plural arrayOfPinapinoL2PluralDictionariesFromPinapinoL2PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapinoL2Plural"];
 
     if (forEncoder)
@@ -264,6 +299,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -280,6 +316,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinapinoL1Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinoL1Object"] allObjects]];
 
@@ -291,10 +329,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -310,11 +348,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinapinoL2Plural ?
-                          [self.pinapinoL2Plural arrayOfPinapinoL2PluralReplaceDictionariesFromPinapinoL2PluralElements] :
+    [dictionary setObject:(_pinapinoL2Plural ?
+                          [_pinapinoL2Plural arrayOfPinapinoL2PluralReplaceDictionariesFromPinapinoL2PluralElements] :
                           [NSArray array])
                    forKey:@"pinapinoL2Plural"];
 
@@ -338,22 +376,44 @@
 
 - (BOOL)isEqualToPinapinoL1Object:(JRPinapinoL1Object *)otherPinapinoL1Object
 {
-    if (!self.string1 && !otherPinapinoL1Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinapinoL1Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinapinoL1Object.string1]) return NO;
+    if (!otherPinapinoL1Object) return NO;
+    if ([self hash] != [otherPinapinoL1Object hash]) return NO;
 
-    if (!self.string2 && !otherPinapinoL1Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinapinoL1Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinapinoL1Object.string2]) return NO;
+    if (!_string1 && !otherPinapinoL1Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinapinoL1Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinapinoL1Object->_string1]) return NO;
 
-    if (!self.pinapinoL2Plural && !otherPinapinoL1Object.pinapinoL2Plural) /* Keep going... */;
-    else if (!self.pinapinoL2Plural && ![otherPinapinoL1Object.pinapinoL2Plural count]) /* Keep going... */;
-    else if (!otherPinapinoL1Object.pinapinoL2Plural && ![self.pinapinoL2Plural count]) /* Keep going... */;
-    else if (![self.pinapinoL2Plural isEqualToPinapinoL2PluralArray:otherPinapinoL1Object.pinapinoL2Plural]) return NO;
+    if (!_string2 && !otherPinapinoL1Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinapinoL1Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinapinoL1Object->_string2]) return NO;
+
+    if (!_pinapinoL2Plural && !otherPinapinoL1Object->_pinapinoL2Plural) /* Keep going... */;
+    else if (!_pinapinoL2Plural && ![otherPinapinoL1Object->_pinapinoL2Plural count]) /* Keep going... */;
+    else if (!otherPinapinoL1Object->_pinapinoL2Plural && ![_pinapinoL2Plural count]) /* Keep going... */;
+    else if (![_pinapinoL2Plural isEqualToPinapinoL2PluralArray:otherPinapinoL1Object->_pinapinoL2Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinapinoL1Object class]]) return NO;
+
+    return [self isEqualToPinapinoL1Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinapinoL2Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinapinoL3Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinapinoL3Plural"])
+        [self unshareProperty:@"pinapinoL3Plural"];
+
     return _pinapinoL3Plural;
 }
 
 - (void)setPinapinoL3Plural:(NSArray *)newPinapinoL3Plural
 {
-    _pinapinoL3Plural = [newPinapinoL3Plural copy];
+    [self willChangeProperty:@"pinapinoL3Plural"];
+
+    _pinapinoL3Plural = [self claimValue:[newPinapinoL3Plural copy] forProperty:@"pinapinoL3Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinapinoL2PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinapinoL2PluralElement *pinapinoL2PluralElementCopy = (JRPinapinoL2PluralElement *)[super copyWithZone:zone];
+
+    pinapinoL2PluralElementCopy->_string1 = _string1;
+    pinapinoL2PluralElementCopy->_string2 = _string2;
+    pinapinoL2PluralElementCopy->_pinapinoL3Plural = _pinapinoL3Plural;
+
+    return pinapinoL2PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinapinoL3Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinoL3Plural"]) return _pinapinoL3Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinapinoL3Plural"]) _pinapinoL3Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinapinoL3Plural ? [self.pinapinoL3Plural arrayOfPinapinoL3PluralDictionariesFromPinapinoL3PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinapinoL3Plural ? [_pinapinoL3Plural arrayOfPinapinoL3PluralDictionariesFromPinapinoL3PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinapinoL3Plural"];
 
     if (forEncoder)
@@ -271,6 +306,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -287,6 +323,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinapinoL2PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinapinoL2PluralElement"] allObjects]];
 
@@ -298,10 +336,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -317,11 +355,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinapinoL3Plural ?
-                          [self.pinapinoL3Plural arrayOfPinapinoL3PluralReplaceDictionariesFromPinapinoL3PluralElements] :
+    [dictionary setObject:(_pinapinoL3Plural ?
+                          [_pinapinoL3Plural arrayOfPinapinoL3PluralReplaceDictionariesFromPinapinoL3PluralElements] :
                           [NSArray array])
                    forKey:@"pinapinoL3Plural"];
 
@@ -345,22 +383,44 @@
 
 - (BOOL)isEqualToPinapinoL2PluralElement:(JRPinapinoL2PluralElement *)otherPinapinoL2PluralElement
 {
-    if (!self.string1 && !otherPinapinoL2PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinapinoL2PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinapinoL2PluralElement.string1]) return NO;
+    if (!otherPinapinoL2PluralElement) return NO;
+    if ([self hash] != [otherPinapinoL2PluralElement hash]) return NO;
 
-    if (!self.string2 && !otherPinapinoL2PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinapinoL2PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinapinoL2PluralElement.string2]) return NO;
+    if (!_string1 && !otherPinapinoL2PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinapinoL2PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinapinoL2PluralElement->_string1]) return NO;
 
-    if (!self.pinapinoL3Plural && !otherPinapinoL2PluralElement.pinapinoL3Plural) /* Keep going... */;
-    else if (!self.pinapinoL3Plural && ![otherPinapinoL2PluralElement.pinapinoL3Plural count]) /* Keep going... */;
-    else if (!otherPinapinoL2PluralElement.pinapinoL3Plural && ![self.pinapinoL3Plural count]) /* Keep going... */;
-    else if (![self.pinapinoL3Plural isEqualToPinapinoL3PluralArray:otherPinapinoL2PluralElement.pinapinoL3Plural]) return NO;
+    if (!_string2 && !otherPinapinoL2PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinapinoL2PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinapinoL2PluralElement->_string2]) return NO;
+
+    if (!_pinapinoL3Plural && !otherPinapinoL2PluralElement->_pinapinoL3Plural) /* Keep going... */;
+    else if (!_pinapinoL3Plural && ![otherPinapinoL2PluralElement->_pinapinoL3Plural count]) /* Keep going... */;
+    else if (!otherPinapinoL2PluralElement->_pinapinoL3Plural && ![_pinapinoL3Plural count]) /* Keep going... */;
+    else if (![_pinapinoL3Plural isEqualToPinapinoL3PluralArray:otherPinapinoL2PluralElement->_pinapinoL3Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinapinoL2PluralElement class]]) return NO;
+
+    return [self isEqualToPinapinoL2PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinapinoL3Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
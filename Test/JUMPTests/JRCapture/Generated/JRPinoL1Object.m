@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinoL2Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinoL2Plural"])
+        [self unshareProperty:@"pinoL2Plural"];
+
     return _pinoL2Plural;
 }
 
 - (void)setPinoL2Plural:(NSArray *)newPinoL2Plural
 {
-    _pinoL2Plural = [newPinoL2Plural copy];
+    [self willChangeProperty:@"pinoL2Plural"];
+
+    _pinoL2Plural = [self claimValue:[newPinoL2Plural copy] forProperty:@"pinoL2Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinoL1Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinoL1Object *pinoL1ObjectCopy = (JRPinoL1Object *)[super copyWithZone:zone];
+
+    pinoL1ObjectCopy->_string1 = _string1;
+    pinoL1ObjectCopy->_string2 = _string2;
+    pinoL1ObjectCopy->_pinoL2Plural = _pinoL2Plural;
+
+    return pinoL1ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinoL2Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinoL2Plural"]) return _pinoL2Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinoL2Plural"]) _pinoL2Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinoL2Plural ? [self.pinoL2Plural arrayOfPinoL2PluralDictionariesFromPinoL2PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinoL2Plural ? [_pinoL2Plural arrayOfPinoL2PluralDictionariesFromPinoL2PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinoL2Plural"];
 
     if (forEncoder)
@@ -264,6 +299,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -280,6 +316,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinoL1Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinoL1Object"] allObjects]];
 
@@ -291,10 +329,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -310,11 +348,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinoL2Plural ?
-                          [self.pinoL2Plural arrayOfPinoL2PluralReplaceDictionariesFromPinoL2PluralElements] :
+    [dictionary setObject:(_pinoL2Plural ?
+                          [_pinoL2Plural arrayOfPinoL2PluralReplaceDictionariesFromPinoL2PluralElements] :
                           [NSArray array])
                    forKey:@"pinoL2Plural"];
 
@@ -338,22 +376,44 @@
 
 - (BOOL)isEqualToPinoL1Object:(JRPinoL1Object *)otherPinoL1Object
 {
-    if (!self.string1 && !otherPinoL1Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinoL1Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinoL1Object.string1]) return NO;
+    if (!otherPinoL1Object) return NO;
+    if ([self hash] != [otherPinoL1Object hash]) return NO;
 
-    if (!self.string2 && !otherPinoL1Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinoL1Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinoL1Object.string2]) return NO;
+    if (!_string1 && !otherPinoL1Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinoL1Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinoL1Object->_string1]) return NO;
 
-    if (!self.pinoL2Plural && !otherPinoL1Object.pinoL2Plural) /* Keep going... */;
-    else if (!self.pinoL2Plural && ![otherPinoL1Object.pinoL2Plural count]) /* Keep going... */;
-    else if (!otherPinoL1Object.pinoL2Plural && ![self.pinoL2Plural count]) /* Keep going... */;
-    else if (![self.pinoL2Plural isEqualToPinoL2PluralArray:otherPinoL1Object.pinoL2Plural]) return NO;
+    if (!_string2 && !otherPinoL1Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinoL1Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinoL1Object->_string2]) return NO;
+
+    if (!_pinoL2Plural && !otherPinoL1Object->_pinoL2Plural) /* Keep going... */;
+    else if (!_pinoL2Plural && ![otherPinoL1Object->_pinoL2Plural count]) /* Keep going... */;
+    else if (!otherPinoL1Object->_pinoL2Plural && ![_pinoL2Plural count]) /* Keep going... */;
+    else if (![_pinoL2Plural isEqualToPinoL2PluralArray:otherPinoL1Object->_pinoL2Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinoL1Object class]]) return NO;
+
+    return [self isEqualToPinoL1Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinoL2Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JRPinoinoL2Object *)pinoinoL2Object
 {
+    if ([self.sharedPropertySet containsObject:@"pinoinoL2Object"])
+        [self unshareProperty:@"pinoinoL2Object"];
+
     return _pinoinoL2Object;
 }
 
 - (void)setPinoinoL2Object:(JRPinoinoL2Object *)newPinoinoL2Object
 {
+    [self willChangeProperty:@"pinoinoL2Object"];
     [self.dirtyPropertySet addObject:@"pinoinoL2Object"];
 
-    _pinoinoL2Object = newPinoinoL2Object;
+    _pinoinoL2Object = [self claimValue:newPinoinoL2Object forProperty:@"pinoinoL2Object"];
 
     [_pinoinoL2Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath = @"/pinoinoL1Object";
         self.canBeUpdatedOnCapture = YES;
 
-        _pinoinoL2Object = [[JRPinoinoL2Object alloc] init];
+        _pinoinoL2Object = [self claimValue:[[JRPinoinoL2Object alloc] init] forProperty:@"pinoinoL2Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JRPinoinoL1Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinoinoL1Object *pinoinoL1ObjectCopy = (JRPinoinoL1Object *)[super copyWithZone:zone];
+
+    pinoinoL1ObjectCopy->_string1 = _string1;
+    pinoinoL1ObjectCopy->_string2 = _string2;
+    pinoinoL1ObjectCopy->_pinoinoL2Object = _pinoinoL2Object;
+
+    return pinoinoL1ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinoinoL2Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinoinoL2Object"]) return _pinoinoL2Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinoinoL2Object"]) _pinoinoL2Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinoinoL2Object ? [self.pinoinoL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinoinoL2Object ? [_pinoinoL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinoinoL2Object"];
 
     if (forEncoder)
@@ -212,6 +246,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -223,8 +258,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinoinoL1Object"];
 
-    if (self.pinoinoL2Object)
-        [snapshotDictionary setObject:[self.pinoinoL2Object snapshotDictionaryFromDirtyPropertySet]
+    if (_pinoinoL2Object)
+        [snapshotDictionary setObject:[_pinoinoL2Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"pinoinoL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -232,6 +267,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinoinoL1Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinoinoL1Object"] allObjects]];
 
@@ -247,18 +284,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"pinoinoL2Object"])
-        [dictionary setObject:(self.pinoinoL2Object ?
-                              [self.pinoinoL2Object toUpdateDictionary] :
+        [dictionary setObject:(_pinoinoL2Object ?
+                              [_pinoinoL2Object toUpdateDictionary] :
                               [[JRPinoinoL2Object pinoinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"pinoinoL2Object"];
-    else if ([self.pinoinoL2Object needsUpdate])
-        [dictionary setObject:[self.pinoinoL2Object toUpdateDictionary]
+    else if ([_pinoinoL2Object needsUpdate])
+        [dictionary setObject:[_pinoinoL2Object toUpdateDictionary]
                        forKey:@"pinoinoL2Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -275,11 +312,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinoinoL2Object ?
-                          [self.pinoinoL2Object toReplaceDictionary] :
+    [dictionary setObject:(_pinoinoL2Object ?
+                          [_pinoinoL2Object toReplaceDictionary] :
                           [[JRPinoinoL2Object pinoinoL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"pinoinoL2Object"];
 
@@ -292,7 +329,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.pinoinoL2Object needsUpdate])
+    if ([_pinoinoL2Object needsUpdate])
         return YES;
 
     return NO;
@@ -300,22 +337,44 @@
 
 - (BOOL)isEqualToPinoinoL1Object:(JRPinoinoL1Object *)otherPinoinoL1Object
 {
-    if (!self.string1 && !otherPinoinoL1Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinoinoL1Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinoinoL1Object.string1]) return NO;
+    if (!otherPinoinoL1Object) return NO;
+    if ([self hash] != [otherPinoinoL1Object hash]) return NO;
+
+    if (!_string1 && !otherPinoinoL1Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinoinoL1Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinoinoL1Object->_string1]) return NO;
 
-    if (!self.string2 && !otherPinoinoL1Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinoinoL1Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinoinoL1Object.string2]) return NO;
+    if (!_string2 && !otherPinoinoL1Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinoinoL1Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinoinoL1Object->_string2]) return NO;
 
-    if (!self.pinoinoL2Object && !otherPinoinoL1Object.pinoinoL2Object) /* Keep going... */;
-    else if (!self.pinoinoL2Object && [otherPinoinoL1Object.pinoinoL2Object isEqualToPinoinoL2Object:[JRPinoinoL2Object pinoinoL2Object]]) /* Keep going... */;
-    else if (!otherPinoinoL1Object.pinoinoL2Object && [self.pinoinoL2Object isEqualToPinoinoL2Object:[JRPinoinoL2Object pinoinoL2Object]]) /* Keep going... */;
-    else if (![self.pinoinoL2Object isEqualToPinoinoL2Object:otherPinoinoL1Object.pinoinoL2Object]) return NO;
+    if (!_pinoinoL2Object && !otherPinoinoL1Object->_pinoinoL2Object) /* Keep going... */;
+    else if (!_pinoinoL2Object && [otherPinoinoL1Object->_pinoinoL2Object isEqualToPinoinoL2Object:[JRPinoinoL2Object pinoinoL2Object]]) /* Keep going... */;
+    else if (!otherPinoinoL1Object->_pinoinoL2Object && [_pinoinoL2Object isEqualToPinoinoL2Object:[JRPinoinoL2Object pinoinoL2Object]]) /* Keep going... */;
+    else if (![_pinoinoL2Object isEqualToPinoinoL2Object:otherPinoinoL1Object->_pinoinoL2Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinoinoL1Object class]]) return NO;
+
+    return [self isEqualToPinoinoL1Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinoinoL2Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
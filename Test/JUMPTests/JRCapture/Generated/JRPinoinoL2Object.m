@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinoinoL3Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinoinoL3Plural"])
+        [self unshareProperty:@"pinoinoL3Plural"];
+
     return _pinoinoL3Plural;
 }
 
 - (void)setPinoinoL3Plural:(NSArray *)newPinoinoL3Plural
 {
-    _pinoinoL3Plural = [newPinoinoL3Plural copy];
+    [self willChangeProperty:@"pinoinoL3Plural"];
+
+    _pinoinoL3Plural = [self claimValue:[newPinoinoL3Plural copy] forProperty:@"pinoinoL3Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinoinoL2Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinoinoL2Object *pinoinoL2ObjectCopy = (JRPinoinoL2Object *)[super copyWithZone:zone];
+
+    pinoinoL2ObjectCopy->_string1 = _string1;
+    pinoinoL2ObjectCopy->_string2 = _string2;
+    pinoinoL2ObjectCopy->_pinoinoL3Plural = _pinoinoL3Plural;
+
+    return pinoinoL2ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinoinoL3Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinoinoL3Plural"]) return _pinoinoL3Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinoinoL3Plural"]) _pinoinoL3Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinoinoL3Plural ? [self.pinoinoL3Plural arrayOfPinoinoL3PluralDictionariesFromPinoinoL3PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinoinoL3Plural ? [_pinoinoL3Plural arrayOfPinoinoL3PluralDictionariesFromPinoinoL3PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinoinoL3Plural"];
 
     if (forEncoder)
@@ -264,6 +299,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -280,6 +316,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinoinoL2Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinoinoL2Object"] allObjects]];
 
@@ -291,10 +329,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -310,11 +348,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinoinoL3Plural ?
-                          [self.pinoinoL3Plural arrayOfPinoinoL3PluralReplaceDictionariesFromPinoinoL3PluralElements] :
+    [dictionary setObject:(_pinoinoL3Plural ?
+                          [_pinoinoL3Plural arrayOfPinoinoL3PluralReplaceDictionariesFromPinoinoL3PluralElements] :
                           [NSArray array])
                    forKey:@"pinoinoL3Plural"];
 
@@ -338,22 +376,44 @@
 
 - (BOOL)isEqualToPinoinoL2Object:(JRPinoinoL2Object *)otherPinoinoL2Object
 {
-    if (!self.string1 && !otherPinoinoL2Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinoinoL2Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinoinoL2Object.string1]) return NO;
+    if (!otherPinoinoL2Object) return NO;
+    if ([self hash] != [otherPinoinoL2Object hash]) return NO;
 
-    if (!self.string2 && !otherPinoinoL2Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinoinoL2Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinoinoL2Object.string2]) return NO;
+    if (!_string1 && !otherPinoinoL2Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinoinoL2Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinoinoL2Object->_string1]) return NO;
 
-    if (!self.pinoinoL3Plural && !otherPinoinoL2Object.pinoinoL3Plural) /* Keep going... */;
-    else if (!self.pinoinoL3Plural && ![otherPinoinoL2Object.pinoinoL3Plural count]) /* Keep going... */;
-    else if (!otherPinoinoL2Object.pinoinoL3Plural && ![self.pinoinoL3Plural count]) /* Keep going... */;
-    else if (![self.pinoinoL3Plural isEqualToPinoinoL3PluralArray:otherPinoinoL2Object.pinoinoL3Plural]) return NO;
+    if (!_string2 && !otherPinoinoL2Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinoinoL2Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinoinoL2Object->_string2]) return NO;
+
+    if (!_pinoinoL3Plural && !otherPinoinoL2Object->_pinoinoL3Plural) /* Keep going... */;
+    else if (!_pinoinoL3Plural && ![otherPinoinoL2Object->_pinoinoL3Plural count]) /* Keep going... */;
+    else if (!otherPinoinoL2Object->_pinoinoL3Plural && ![_pinoinoL3Plural count]) /* Keep going... */;
+    else if (![_pinoinoL3Plural isEqualToPinoinoL3PluralArray:otherPinoinoL2Object->_pinoinoL3Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinoinoL2Object class]]) return NO;
+
+    return [self isEqualToPinoinoL2Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinoinoL3Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
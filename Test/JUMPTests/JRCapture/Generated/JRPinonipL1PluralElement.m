@@ -64,6 +64,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -76,6 +77,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -83,14 +85,18 @@
 
 - (JRPinonipL2Object *)pinonipL2Object
 {
+    if ([self.sharedPropertySet containsObject:@"pinonipL2Object"])
+        [self unshareProperty:@"pinonipL2Object"];
+
     return _pinonipL2Object;
 }
 
 - (void)setPinonipL2Object:(JRPinonipL2Object *)newPinonipL2Object
 {
+    [self willChangeProperty:@"pinonipL2Object"];
     [self.dirtyPropertySet addObject:@"pinonipL2Object"];
 
-    _pinonipL2Object = newPinonipL2Object;
+    _pinonipL2Object = [self claimValue:newPinonipL2Object forProperty:@"pinonipL2Object"];
 
     [_pinonipL2Object setAllPropertiesToDirty];
 }
@@ -102,7 +108,7 @@
         self.captureObjectPath      = @"";
         self.canBeUpdatedOnCapture  = NO;
 
-        _pinonipL2Object = [[JRPinonipL2Object alloc] init];
+        _pinonipL2Object = [self claimValue:[[JRPinonipL2Object alloc] init] forProperty:@"pinonipL2Object"];
 
         [self.dirtyPropertySet setSet:[self updatablePropertySet]];
     }
@@ -114,16 +120,44 @@
     return [[JRPinonipL1PluralElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinonipL1PluralElement *pinonipL1PluralElementCopy = (JRPinonipL1PluralElement *)[super copyWithZone:zone];
+
+    pinonipL1PluralElementCopy->_string1 = _string1;
+    pinonipL1PluralElementCopy->_string2 = _string2;
+    pinonipL1PluralElementCopy->_pinonipL2Object = _pinonipL2Object;
+
+    return pinonipL1PluralElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinonipL2Object", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinonipL2Object"]) return _pinonipL2Object;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinonipL2Object"]) _pinonipL2Object = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinonipL2Object ? [self.pinonipL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinonipL2Object ? [_pinonipL2Object newDictionaryForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinonipL2Object"];
 
     if (forEncoder)
@@ -219,6 +253,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -230,8 +265,8 @@
 
     [snapshotDictionary setObject:[self.dirtyPropertySet copy] forKey:@"pinonipL1PluralElement"];
 
-    if (self.pinonipL2Object)
-        [snapshotDictionary setObject:[self.pinonipL2Object snapshotDictionaryFromDirtyPropertySet]
+    if (_pinonipL2Object)
+        [snapshotDictionary setObject:[_pinonipL2Object snapshotDictionaryFromDirtyPropertySet]
                                forKey:@"pinonipL2Object"];
 
     return [NSDictionary dictionaryWithDictionary:snapshotDictionary];
@@ -239,6 +274,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinonipL1PluralElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinonipL1PluralElement"] allObjects]];
 
@@ -254,18 +291,18 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     if ([self.dirtyPropertySet containsObject:@"pinonipL2Object"])
-        [dictionary setObject:(self.pinonipL2Object ?
-                              [self.pinonipL2Object toUpdateDictionary] :
+        [dictionary setObject:(_pinonipL2Object ?
+                              [_pinonipL2Object toUpdateDictionary] :
                               [[JRPinonipL2Object pinonipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                        forKey:@"pinonipL2Object"];
-    else if ([self.pinonipL2Object needsUpdate])
-        [dictionary setObject:[self.pinonipL2Object toUpdateDictionary]
+    else if ([_pinonipL2Object needsUpdate])
+        [dictionary setObject:[_pinonipL2Object toUpdateDictionary]
                        forKey:@"pinonipL2Object"];
 
     [self.dirtyPropertySet removeAllObjects];
@@ -282,11 +319,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinonipL2Object ?
-                          [self.pinonipL2Object toReplaceDictionary] :
+    [dictionary setObject:(_pinonipL2Object ?
+                          [_pinonipL2Object toReplaceDictionary] :
                           [[JRPinonipL2Object pinonipL2Object] toUpdateDictionary]) /* Use the default constructor to create an empty object */
                    forKey:@"pinonipL2Object"];
 
@@ -299,7 +336,7 @@
     if ([self.dirtyPropertySet count])
          return YES;
 
-    if ([self.pinonipL2Object needsUpdate])
+    if ([_pinonipL2Object needsUpdate])
         return YES;
 
     return NO;
@@ -307,22 +344,44 @@
 
 - (BOOL)isEqualToPinonipL1PluralElement:(JRPinonipL1PluralElement *)otherPinonipL1PluralElement
 {
-    if (!self.string1 && !otherPinonipL1PluralElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinonipL1PluralElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinonipL1PluralElement.string1]) return NO;
+    if (!otherPinonipL1PluralElement) return NO;
+    if ([self hash] != [otherPinonipL1PluralElement hash]) return NO;
+
+    if (!_string1 && !otherPinonipL1PluralElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinonipL1PluralElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinonipL1PluralElement->_string1]) return NO;
 
-    if (!self.string2 && !otherPinonipL1PluralElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinonipL1PluralElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinonipL1PluralElement.string2]) return NO;
+    if (!_string2 && !otherPinonipL1PluralElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinonipL1PluralElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinonipL1PluralElement->_string2]) return NO;
 
-    if (!self.pinonipL2Object && !otherPinonipL1PluralElement.pinonipL2Object) /* Keep going... */;
-    else if (!self.pinonipL2Object && [otherPinonipL1PluralElement.pinonipL2Object isEqualToPinonipL2Object:[JRPinonipL2Object pinonipL2Object]]) /* Keep going... */;
-    else if (!otherPinonipL1PluralElement.pinonipL2Object && [self.pinonipL2Object isEqualToPinonipL2Object:[JRPinonipL2Object pinonipL2Object]]) /* Keep going... */;
-    else if (![self.pinonipL2Object isEqualToPinonipL2Object:otherPinonipL1PluralElement.pinonipL2Object]) return NO;
+    if (!_pinonipL2Object && !otherPinonipL1PluralElement->_pinonipL2Object) /* Keep going... */;
+    else if (!_pinonipL2Object && [otherPinonipL1PluralElement->_pinonipL2Object isEqualToPinonipL2Object:[JRPinonipL2Object pinonipL2Object]]) /* Keep going... */;
+    else if (!otherPinonipL1PluralElement->_pinonipL2Object && [_pinonipL2Object isEqualToPinonipL2Object:[JRPinonipL2Object pinonipL2Object]]) /* Keep going... */;
+    else if (![_pinonipL2Object isEqualToPinonipL2Object:otherPinonipL1PluralElement->_pinonipL2Object]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinonipL1PluralElement class]]) return NO;
+
+    return [self isEqualToPinonipL1PluralElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinonipL2Object hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -124,6 +124,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -136,6 +137,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -143,12 +145,17 @@
 
 - (NSArray *)pinonipL3Plural
 {
+    if ([self.sharedPropertySet containsObject:@"pinonipL3Plural"])
+        [self unshareProperty:@"pinonipL3Plural"];
+
     return _pinonipL3Plural;
 }
 
 - (void)setPinonipL3Plural:(NSArray *)newPinonipL3Plural
 {
-    _pinonipL3Plural = [newPinonipL3Plural copy];
+    [self willChangeProperty:@"pinonipL3Plural"];
+
+    _pinonipL3Plural = [self claimValue:[newPinonipL3Plural copy] forProperty:@"pinonipL3Plural"];
 }
 
 - (id)init
@@ -169,16 +176,44 @@
     return [[JRPinonipL2Object alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPinonipL2Object *pinonipL2ObjectCopy = (JRPinonipL2Object *)[super copyWithZone:zone];
+
+    pinonipL2ObjectCopy->_string1 = _string1;
+    pinonipL2ObjectCopy->_string2 = _string2;
+    pinonipL2ObjectCopy->_pinonipL3Plural = _pinonipL3Plural;
+
+    return pinonipL2ObjectCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:@"pinonipL3Plural", nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinonipL3Plural"]) return _pinonipL3Plural;
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+    if ([propertyName isEqualToString:@"pinonipL3Plural"]) _pinonipL3Plural = value;
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
-    [dictionary setObject:(self.pinonipL3Plural ? [self.pinonipL3Plural arrayOfPinonipL3PluralDictionariesFromPinonipL3PluralElementsForEncoder:forEncoder] : [NSNull null])
+    [dictionary setObject:(_pinonipL3Plural ? [_pinonipL3Plural arrayOfPinonipL3PluralDictionariesFromPinonipL3PluralElementsForEncoder:forEncoder] : [NSNull null])
                    forKey:@"pinonipL3Plural"];
 
     if (forEncoder)
@@ -271,6 +306,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -287,6 +323,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pinonipL2Object"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pinonipL2Object"] allObjects]];
 
@@ -298,10 +336,10 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -317,11 +355,11 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
-    [dictionary setObject:(self.pinonipL3Plural ?
-                          [self.pinonipL3Plural arrayOfPinonipL3PluralReplaceDictionariesFromPinonipL3PluralElements] :
+    [dictionary setObject:(_pinonipL3Plural ?
+                          [_pinonipL3Plural arrayOfPinonipL3PluralReplaceDictionariesFromPinonipL3PluralElements] :
                           [NSArray array])
                    forKey:@"pinonipL3Plural"];
 
@@ -345,22 +383,44 @@
 
 - (BOOL)isEqualToPinonipL2Object:(JRPinonipL2Object *)otherPinonipL2Object
 {
-    if (!self.string1 && !otherPinonipL2Object.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPinonipL2Object.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPinonipL2Object.string1]) return NO;
+    if (!otherPinonipL2Object) return NO;
+    if ([self hash] != [otherPinonipL2Object hash]) return NO;
 
-    if (!self.string2 && !otherPinonipL2Object.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPinonipL2Object.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPinonipL2Object.string2]) return NO;
+    if (!_string1 && !otherPinonipL2Object->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPinonipL2Object->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPinonipL2Object->_string1]) return NO;
 
-    if (!self.pinonipL3Plural && !otherPinonipL2Object.pinonipL3Plural) /* Keep going... */;
-    else if (!self.pinonipL3Plural && ![otherPinonipL2Object.pinonipL3Plural count]) /* Keep going... */;
-    else if (!otherPinonipL2Object.pinonipL3Plural && ![self.pinonipL3Plural count]) /* Keep going... */;
-    else if (![self.pinonipL3Plural isEqualToPinonipL3PluralArray:otherPinonipL2Object.pinonipL3Plural]) return NO;
+    if (!_string2 && !otherPinonipL2Object->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPinonipL2Object->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPinonipL2Object->_string2]) return NO;
+
+    if (!_pinonipL3Plural && !otherPinonipL2Object->_pinonipL3Plural) /* Keep going... */;
+    else if (!_pinonipL3Plural && ![otherPinonipL2Object->_pinonipL3Plural count]) /* Keep going... */;
+    else if (!otherPinonipL2Object->_pinonipL3Plural && ![_pinonipL3Plural count]) /* Keep going... */;
+    else if (![_pinonipL3Plural isEqualToPinonipL3PluralArray:otherPinonipL2Object->_pinonipL3Plural]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPinonipL2Object class]]) return NO;
+
+    return [self isEqualToPinonipL2Object:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+    hash = hash * 31 + [_pinonipL3Plural captureObjectElementsHash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
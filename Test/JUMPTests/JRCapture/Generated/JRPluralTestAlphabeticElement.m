@@ -59,6 +59,7 @@
 
 - (void)setUniqueString:(NSString *)newUniqueString
 {
+    [self willChangeProperty:@"uniqueString"];
     [self.dirtyPropertySet addObject:@"uniqueString"];
 
     _uniqueString = [newUniqueString copy];
@@ -71,6 +72,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -83,6 +85,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -106,16 +109,42 @@
     return [[JRPluralTestAlphabeticElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPluralTestAlphabeticElement *pluralTestAlphabeticElementCopy = (JRPluralTestAlphabeticElement *)[super copyWithZone:zone];
+
+    pluralTestAlphabeticElementCopy->_uniqueString = _uniqueString;
+    pluralTestAlphabeticElementCopy->_string1 = _string1;
+    pluralTestAlphabeticElementCopy->_string2 = _string2;
+
+    return pluralTestAlphabeticElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null])
+    [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null])
                    forKey:@"uniqueString"];
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
 
     if (forEncoder)
@@ -208,6 +237,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -224,6 +254,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pluralTestAlphabeticElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pluralTestAlphabeticElement"] allObjects]];
 
@@ -235,13 +267,13 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"uniqueString"])
-        [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
+        [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null]) forKey:@"uniqueString"];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -257,9 +289,9 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null]) forKey:@"uniqueString"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -275,21 +307,43 @@
 
 - (BOOL)isEqualToPluralTestAlphabeticElement:(JRPluralTestAlphabeticElement *)otherPluralTestAlphabeticElement
 {
-    if (!self.uniqueString && !otherPluralTestAlphabeticElement.uniqueString) /* Keep going... */;
-    else if ((self.uniqueString == nil) ^ (otherPluralTestAlphabeticElement.uniqueString == nil)) return NO; // xor
-    else if (![self.uniqueString isEqualToString:otherPluralTestAlphabeticElement.uniqueString]) return NO;
+    if (!otherPluralTestAlphabeticElement) return NO;
+    if ([self hash] != [otherPluralTestAlphabeticElement hash]) return NO;
+
+    if (!_uniqueString && !otherPluralTestAlphabeticElement->_uniqueString) /* Keep going... */;
+    else if ((_uniqueString == nil) ^ (otherPluralTestAlphabeticElement->_uniqueString == nil)) return NO; // xor
+    else if (![_uniqueString isEqualToString:otherPluralTestAlphabeticElement->_uniqueString]) return NO;
 
-    if (!self.string1 && !otherPluralTestAlphabeticElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPluralTestAlphabeticElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPluralTestAlphabeticElement.string1]) return NO;
+    if (!_string1 && !otherPluralTestAlphabeticElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPluralTestAlphabeticElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPluralTestAlphabeticElement->_string1]) return NO;
 
-    if (!self.string2 && !otherPluralTestAlphabeticElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPluralTestAlphabeticElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPluralTestAlphabeticElement.string2]) return NO;
+    if (!_string2 && !otherPluralTestAlphabeticElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPluralTestAlphabeticElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPluralTestAlphabeticElement->_string2]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPluralTestAlphabeticElement class]]) return NO;
+
+    return [self isEqualToPluralTestAlphabeticElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_uniqueString hash];
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -59,6 +59,7 @@
 
 - (void)setUniqueString:(NSString *)newUniqueString
 {
+    [self willChangeProperty:@"uniqueString"];
     [self.dirtyPropertySet addObject:@"uniqueString"];
 
     _uniqueString = [newUniqueString copy];
@@ -71,6 +72,7 @@
 
 - (void)setString1:(NSString *)newString1
 {
+    [self willChangeProperty:@"string1"];
     [self.dirtyPropertySet addObject:@"string1"];
 
     _string1 = [newString1 copy];
@@ -83,6 +85,7 @@
 
 - (void)setString2:(NSString *)newString2
 {
+    [self willChangeProperty:@"string2"];
     [self.dirtyPropertySet addObject:@"string2"];
 
     _string2 = [newString2 copy];
@@ -106,16 +109,42 @@
     return [[JRPluralTestUniqueElement alloc] init];
 }
 
+- (id)copyWithZone:(NSZone*)zone
+{
+    JRPluralTestUniqueElement *pluralTestUniqueElementCopy = (JRPluralTestUniqueElement *)[super copyWithZone:zone];
+
+    pluralTestUniqueElementCopy->_uniqueString = _uniqueString;
+    pluralTestUniqueElementCopy->_string1 = _string1;
+    pluralTestUniqueElementCopy->_string2 = _string2;
+
+    return pluralTestUniqueElementCopy;
+}
+
+- (NSSet *)copyOnWritePropertySet
+{
+    return [NSSet setWithObjects:nil];
+}
+
+- (id)valueForCopyOnWriteProperty:(NSString *)propertyName
+{
+
+    return nil;
+}
+
+- (void)setValue:(id)value forCopyOnWriteProperty:(NSString *)propertyName
+{
+}
+
 - (NSDictionary*)newDictionaryForEncoder:(BOOL)forEncoder
 {
     NSMutableDictionary *dictionary =
         [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null])
+    [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null])
                    forKey:@"uniqueString"];
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null])
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null])
                    forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null])
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null])
                    forKey:@"string2"];
 
     if (forEncoder)
@@ -208,6 +237,7 @@
 
 - (void)setAllPropertiesToDirty
 {
+    [self willMutate];
     [self.dirtyPropertySet addObjectsFromArray:[[self updatablePropertySet] allObjects]];
 
 }
@@ -224,6 +254,8 @@
 
 - (void)restoreDirtyPropertiesFromSnapshotDictionary:(NSDictionary *)snapshotDictionary
 {
+    [self willMutate];
+
     if ([snapshotDictionary objectForKey:@"pluralTestUniqueElement"])
         [self.dirtyPropertySet addObjectsFromArray:[[snapshotDictionary objectForKey:@"pluralTestUniqueElement"] allObjects]];
 
@@ -235,13 +267,13 @@
          [NSMutableDictionary dictionaryWithCapacity:10];
 
     if ([self.dirtyPropertySet containsObject:@"uniqueString"])
-        [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
+        [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null]) forKey:@"uniqueString"];
 
     if ([self.dirtyPropertySet containsObject:@"string1"])
-        [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
+        [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
 
     if ([self.dirtyPropertySet containsObject:@"string2"])
-        [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+        [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -257,9 +289,9 @@
     NSMutableDictionary *dictionary =
          [NSMutableDictionary dictionaryWithCapacity:10];
 
-    [dictionary setObject:(self.uniqueString ? self.uniqueString : [NSNull null]) forKey:@"uniqueString"];
-    [dictionary setObject:(self.string1 ? self.string1 : [NSNull null]) forKey:@"string1"];
-    [dictionary setObject:(self.string2 ? self.string2 : [NSNull null]) forKey:@"string2"];
+    [dictionary setObject:(_uniqueString ? _uniqueString : [NSNull null]) forKey:@"uniqueString"];
+    [dictionary setObject:(_string1 ? _string1 : [NSNull null]) forKey:@"string1"];
+    [dictionary setObject:(_string2 ? _string2 : [NSNull null]) forKey:@"string2"];
 
     [self.dirtyPropertySet removeAllObjects];
     return [NSDictionary dictionaryWithDictionary:dictionary];
@@ -275,21 +307,43 @@
 
 - (BOOL)isEqualToPluralTestUniqueElement:(JRPluralTestUniqueElement *)otherPluralTestUniqueElement
 {
-    if (!self.uniqueString && !otherPluralTestUniqueElement.uniqueString) /* Keep going... */;
-    else if ((self.uniqueString == nil) ^ (otherPluralTestUniqueElement.uniqueString == nil)) return NO; // xor
-    else if (![self.uniqueString isEqualToString:otherPluralTestUniqueElement.uniqueString]) return NO;
+    if (!otherPluralTestUniqueElement) return NO;
+    if ([self hash] != [otherPluralTestUniqueElement hash]) return NO;
+
+    if (!_uniqueString && !otherPluralTestUniqueElement->_uniqueString) /* Keep going... */;
+    else if ((_uniqueString == nil) ^ (otherPluralTestUniqueElement->_uniqueString == nil)) return NO; // xor
+    else if (![_uniqueString isEqualToString:otherPluralTestUniqueElement->_uniqueString]) return NO;
 
-    if (!self.string1 && !otherPluralTestUniqueElement.string1) /* Keep going... */;
-    else if ((self.string1 == nil) ^ (otherPluralTestUniqueElement.string1 == nil)) return NO; // xor
-    else if (![self.string1 isEqualToString:otherPluralTestUniqueElement.string1]) return NO;
+    if (!_string1 && !otherPluralTestUniqueElement->_string1) /* Keep going... */;
+    else if ((_string1 == nil) ^ (otherPluralTestUniqueElement->_string1 == nil)) return NO; // xor
+    else if (![_string1 isEqualToString:otherPluralTestUniqueElement->_string1]) return NO;
 
-    if (!self.string2 && !otherPluralTestUniqueElement.string2) /* Keep going... */;
-    else if ((self.string2 == nil) ^ (otherPluralTestUniqueElement.string2 == nil)) return NO; // xor
-    else if (![self.string2 isEqualToString:otherPluralTestUniqueElement.string2]) return NO;
+    if (!_string2 && !otherPluralTestUniqueElement->_string2) /* Keep going... */;
+    else if ((_string2 == nil) ^ (otherPluralTestUniqueElement->_string2 == nil)) return NO; // xor
+    else if (![_string2 isEqualToString:otherPluralTestUniqueElement->_string2]) return NO;
 
     return YES;
 }
 
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (![object isKindOfClass:[JRPluralTestUniqueElement class]]) return NO;
+
+    return [self isEqualToPluralTestUniqueElement:object];
+}
+
+- (NSUInteger)contentHash
+{
+    NSUInteger hash = 0;
+
+    hash = hash * 31 + [_uniqueString hash];
+    hash = hash * 31 + [_string1 hash];
+    hash = hash * 31 + [_string2 hash];
+
+    return hash;
+}
+
 - (NSDictionary*)objectProperties
 {
     NSMutableDictionary *dictionary =
@@ -0,0 +1,171 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRAnalyticsBeacon.h"
+#import "JRSessionStore.h"
+
+static NSString *const JRTestSuiteName = @"com.janrain.test.analyticsBeacon";
+static NSString *const JRTestEventsKey = @"pendingEvents";
+
+@interface JRAnalyticsBeaconTests : GHTestCase
+@property(nonatomic) JRSessionStore *store;
+@property(nonatomic) NSMutableArray *sent;
+@property(nonatomic) BOOL serverIsDown;
+@end
+
+@implementation JRAnalyticsBeaconTests
+@synthesize store;
+@synthesize sent;
+@synthesize serverIsDown;
+
+- (void)setUp
+{
+    [[NSUserDefaults standardUserDefaults] removePersistentDomainForName:JRTestSuiteName];
+    self.store = [[JRSessionStore alloc] initWithUserDefaults:[[NSUserDefaults alloc]
+                                                                      initWithSuiteName:JRTestSuiteName]];
+    self.sent = [NSMutableArray array];
+    self.serverIsDown = NO;
+}
+
+- (void)tearDown
+{
+    [self.store flush];
+    [[NSUserDefaults standardUserDefaults] removePersistentDomainForName:JRTestSuiteName];
+}
+
+- (JRAnalyticsBeacon *)beaconWithCapacity:(NSUInteger)capacity flushInterval:(NSTimeInterval)flushInterval
+{
+    __weak JRAnalyticsBeaconTests *weakSelf = self;
+    return [[JRAnalyticsBeacon alloc] initWithStore:self.store key:JRTestEventsKey capacity:capacity
+                                      flushInterval:flushInterval maxFlushInterval:flushInterval * 4
+                                             sender:^(NSDictionary *event, void (^completion)(BOOL))
+                                             {
+                                                 /* Asynchronous, like the real request */
+                                                 dispatch_async(dispatch_get_main_queue(), ^
+                                                 {
+                                                     BOOL up = !weakSelf.serverIsDown;
+                                                     if (up) [weakSelf.sent addObject:event];
+                                                     completion(up);
+                                                 });
+                                             }];
+}
+
+- (NSDictionary *)event:(NSString *)method
+{
+    return [NSDictionary dictionaryWithObjectsAndKeys:@"iphone", @"device", method, @"method", nil];
+}
+
+- (void)runMainQueueFor:(NSTimeInterval)seconds
+{
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:seconds]];
+}
+
+- (void)test_a100_eventsWaitForTheFlush
+{
+    JRAnalyticsBeacon *beacon = [self beaconWithCapacity:10 flushInterval:60];
+    [beacon recordEvent:[self event:@"email"]];
+    [beacon recordEvent:[self event:@"sms"]];
+
+    [self runMainQueueFor:0.1];
+    GHAssertEquals([self.sent count], (NSUInteger) 0, nil);
+
+    [beacon flush];
+    [self runMainQueueFor:0.1];
+
+    GHAssertEqualObjects(self.sent, ([NSArray arrayWithObjects:[self event:@"email"], [self event:@"sms"], nil]), nil);
+    GHAssertEquals([[beacon pendingEvents] count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a101_flushesOnItsOwnAfterTheInterval
+{
+    JRAnalyticsBeacon *beacon = [self beaconWithCapacity:10 flushInterval:0.1];
+    [beacon recordEvent:[self event:@"email"]];
+
+    [self runMainQueueFor:0.5];
+
+    GHAssertEquals([self.sent count], (NSUInteger) 1, nil);
+}
+
+- (void)test_a102_failedSendsAreKeptForLater
+{
+    JRAnalyticsBeacon *beacon = [self beaconWithCapacity:10 flushInterval:60];
+    [beacon recordEvent:[self event:@"email"]];
+    [beacon recordEvent:[self event:@"sms"]];
+
+    self.serverIsDown = YES;
+    [beacon flush];
+    [self runMainQueueFor:0.1];
+
+    GHAssertEquals([[beacon pendingEvents] count], (NSUInteger) 2, nil);
+
+    self.serverIsDown = NO;
+    [beacon flush];
+    [self runMainQueueFor:0.1];
+
+    GHAssertEquals([self.sent count], (NSUInteger) 2, nil);
+    GHAssertEquals([[beacon pendingEvents] count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a103_oldestEventsAreDroppedWhenFull
+{
+    JRAnalyticsBeacon *beacon = [self beaconWithCapacity:2 flushInterval:60];
+    [beacon recordEvent:[self event:@"1"]];
+    [beacon recordEvent:[self event:@"2"]];
+    [beacon recordEvent:[self event:@"3"]];
+
+    GHAssertEquals(beacon.droppedEventCount, (NSUInteger) 1, nil);
+    GHAssertEqualObjects([beacon pendingEvents], ([NSArray arrayWithObjects:[self event:@"2"], [self event:@"3"], nil]),
+                         nil);
+}
+
+- (void)test_a104_pendingEventsSurviveARelaunch
+{
+    JRAnalyticsBeacon *beacon = [self beaconWithCapacity:10 flushInterval:60];
+    [beacon recordEvent:[self event:@"email"]];
+    [self.store flush];
+
+    JRAnalyticsBeacon *relaunched = [self beaconWithCapacity:10 flushInterval:60];
+    GHAssertEqualObjects([relaunched pendingEvents], [NSArray arrayWithObject:[self event:@"email"]], nil);
+}
+
+- (void)test_a105_backgroundingFlushes
+{
+    JRAnalyticsBeacon *beacon = [self beaconWithCapacity:10 flushInterval:60];
+    [beacon recordEvent:[self event:@"sms"]];
+
+    [[NSNotificationCenter defaultCenter] postNotificationName:UIApplicationDidEnterBackgroundNotification
+                                                        object:nil];
+    [self runMainQueueFor:0.1];
+
+    GHAssertEquals([self.sent count], (NSUInteger) 1, nil);
+}
+@end
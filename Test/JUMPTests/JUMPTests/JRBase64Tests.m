@@ -0,0 +1,159 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRBase64.h"
+
+@interface JRBase64Tests : GHTestCase
+@end
+
+@implementation JRBase64Tests
+
+- (NSData *)bytesOfLength:(NSUInteger)length seed:(uint32_t)seed
+{
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    uint8_t *bytes = [data mutableBytes];
+    for (NSUInteger i = 0; i < length; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        bytes[i] = (uint8_t) (seed >> 16);
+    }
+    return data;
+}
+
+- (void)test_a100_rfc4648TestVectors
+{
+    NSArray *plain = [NSArray arrayWithObjects:@"f", @"fo", @"foo", @"foob", @"fooba", @"foobar", nil];
+    NSArray *encoded = [NSArray arrayWithObjects:@"Zg==", @"Zm8=", @"Zm9v", @"Zm9vYg==", @"Zm9vYmE=", @"Zm9vYmFy", nil];
+
+    for (NSUInteger i = 0; i < [plain count]; i++)
+    {
+        GHAssertEqualStrings([[plain objectAtIndex:i] JRBase64EncodedString], [encoded objectAtIndex:i], nil);
+        GHAssertEqualStrings([[encoded objectAtIndex:i] JRBase64DecodedString], [plain objectAtIndex:i], nil);
+    }
+}
+
+- (void)test_a101_emptyInputIsNil
+{
+    GHAssertNil([[NSData data] JRBase64EncodedString], nil);
+    GHAssertNil([[NSData data] JRBase64URLEncodedString], nil);
+    GHAssertNil([NSData dataWithJRBase64EncodedString:@""], nil);
+    GHAssertNil([NSData dataWithJRBase64EncodedString:@"===="], nil);
+    GHAssertNil([NSData dataWithJRBase64EncodedString:nil], nil);
+}
+
+- (void)test_a102_matchesFoundationAcrossBlockBoundaries
+{
+    /* Long enough to run through the vector path several times, and every remainder either side of it */
+    for (NSUInteger length = 1; length < 300; length++)
+    {
+        NSData *data = [self bytesOfLength:length seed:(uint32_t) length];
+        NSString *expected = [data base64EncodedStringWithOptions:0];
+
+        GHAssertEqualStrings([data JRBase64EncodedString], expected, @"length %lu", (unsigned long) length);
+        GHAssertEqualObjects([NSData dataWithJRBase64EncodedString:expected], data, @"length %lu",
+                             (unsigned long) length);
+    }
+}
+
+- (void)test_a103_urlSafeAlphabetWithoutPadding
+{
+    uint8_t bytes[] = {0xfb, 0xff, 0xbf, 0xfe};
+    NSData *data = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+
+    GHAssertEqualStrings([data JRBase64EncodedString], @"+/+//g==", nil);
+    GHAssertEqualStrings([data JRBase64URLEncodedString], @"-_-__g", nil);
+    GHAssertEqualObjects([NSData dataWithJRBase64URLEncodedString:@"-_-__g"], data, nil);
+    GHAssertEqualObjects([NSData dataWithJRBase64URLEncodedString:@"-_-__g=="], data, nil);
+
+    for (NSUInteger length = 1; length < 200; length++)
+    {
+        NSData *random = [self bytesOfLength:length seed:(uint32_t) (length * 31)];
+        NSString *encoded = [random JRBase64URLEncodedString];
+
+        GHAssertEquals([encoded rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"+/="]].location,
+                       (NSUInteger) NSNotFound, nil);
+        GHAssertEqualObjects([NSData dataWithJRBase64URLEncodedString:encoded], random, nil);
+    }
+}
+
+- (void)test_a104_wrapWidthBreaksAfterEveryFullLine
+{
+    NSData *data = [self bytesOfLength:120 seed:7];
+    NSString *wrapped = [data JRBase64EncodedStringWithWrapWidth:64];
+    NSArray *lines = [wrapped componentsSeparatedByString:@"\r\n"];
+
+    GHAssertEquals([lines count], (NSUInteger) 3, nil);
+    GHAssertEquals([[lines objectAtIndex:0] length], (NSUInteger) 64, nil);
+    GHAssertEquals([[lines objectAtIndex:1] length], (NSUInteger) 64, nil);
+    GHAssertEquals([[lines objectAtIndex:2] length], (NSUInteger) 32, nil);
+    GHAssertEqualStrings([lines componentsJoinedByString:@""], [data JRBase64EncodedString], nil);
+    GHAssertEqualObjects([NSData dataWithJRBase64EncodedString:wrapped], data, nil);
+
+    /* A width that is not a multiple of 4 is rounded down */
+    GHAssertEqualStrings([data JRBase64EncodedStringWithWrapWidth:66], wrapped, nil);
+}
+
+- (void)test_a105_decodeSkipsCharactersOutsideTheAlphabet
+{
+    NSData *data = [self bytesOfLength:96 seed:11];
+    NSString *encoded = [data base64EncodedStringWithOptions:NSDataBase64Encoding76CharacterLineLength];
+    NSString *noisy = [NSString stringWithFormat:@" \t%@\né", [encoded stringByReplacingOccurrencesOfString:@"AB"
+                                                                                                    withString:@"A B"]];
+
+    GHAssertEqualObjects([NSData dataWithJRBase64EncodedString:noisy], data, nil);
+}
+
+- (void)test_a106_callerBuffers
+{
+    NSData *data = [self bytesOfLength:1000 seed:3];
+    JRBase64Options options = JRBase64OptionsURLSafe | JRBase64OptionsOmitPadding;
+
+    size_t encodedLength = JRBase64EncodedLength([data length], options);
+    char *encoded = malloc(encodedLength + 1);
+    encoded[encodedLength] = '#';
+    GHAssertEquals(JRBase64Encode([data bytes], [data length], encoded, options), encodedLength, nil);
+    GHAssertEquals(encoded[encodedLength], '#', nil);
+
+    size_t decodedMaxLength = JRBase64DecodedMaxLength(encodedLength);
+    uint8_t *decoded = malloc(decodedMaxLength + 1);
+    decoded[decodedMaxLength] = 0xA5;
+    size_t decodedLength = JRBase64Decode(encoded, encodedLength, decoded, options);
+
+    GHAssertEquals(decodedLength, (size_t) [data length], nil);
+    GHAssertTrue(memcmp(decoded, [data bytes], decodedLength) == 0, nil);
+    GHAssertEquals(decoded[decodedMaxLength], (uint8_t) 0xA5, nil);
+
+    free(encoded);
+    free(decoded);
+}
+
+@end
@@ -0,0 +1,214 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRCaptureFlow.h"
+#import "JRCaptureFormValidator.h"
+#import "JRCaptureError.h"
+
+@interface JRCaptureFormValidatorTests : GHTestCase
+@property(nonatomic) JRCaptureFlow *flow;
+@end
+
+@implementation JRCaptureFormValidatorTests
+@synthesize flow;
+
+- (void)setUp
+{
+    self.flow = [JRCaptureFlow flowWithDictionary:@{
+            @"fields" : @{
+                    @"registrationForm" : @{
+                            @"fields" : @[ @"emailAddress", @"displayName", @"newPassword", @"newPasswordConfirm",
+                                           @"birthdate", @"zip" ]
+                    },
+                    @"editProfileForm" : @{
+                            @"fields" : @[ @"displayName", @"aboutMe" ]
+                    },
+                    @"emailAddress" : @{
+                            @"type" : @"email",
+                            @"schemaId" : @"email",
+                            @"validation" : @[
+                                    @{ @"rule" : @"required", @"value" : @YES, @"message" : @"Email is required" },
+                                    @{ @"rule" : @"format", @"value" : @"email", @"message" : @"Invalid email" },
+                                    @{ @"rule" : @"unique", @"value" : @YES, @"message" : @"Email in use" },
+                            ]
+                    },
+                    @"displayName" : @{
+                            @"type" : @"text",
+                            @"schemaId" : @"displayName",
+                            @"validation" : @[
+                                    @{ @"rule" : @"required", @"value" : @YES, @"message" : @"Name is required" },
+                                    @{ @"rule" : @"minLength", @"value" : @"3", @"message" : @"Name too short" },
+                                    @{ @"rule" : @"maxLength", @"value" : @10, @"message" : @"Name too long" },
+                            ]
+                    },
+                    @"newPassword" : @{
+                            @"type" : @"password",
+                            @"schemaId" : @"password",
+                            @"validation" : @[
+                                    @{ @"rule" : @"minLength", @"value" : @6, @"message" : @"Password too short" },
+                            ]
+                    },
+                    @"newPasswordConfirm" : @{
+                            @"type" : @"password",
+                            @"validation" : @[
+                                    @{ @"rule" : @"match", @"value" : @"newPassword",
+                                       @"message" : @"Passwords don't match" },
+                            ]
+                    },
+                    @"birthdate" : @{
+                            @"type" : @"dateselect",
+                            @"schemaId" : @{ @"dateselect_year" : @"birthday" },
+                            @"validation" : @[
+                                    @{ @"rule" : @"required", @"value" : @YES, @"message" : @"Birthdate required" },
+                            ]
+                    },
+                    @"zip" : @{
+                            @"type" : @"text",
+                            @"schemaId" : @"zip",
+                            @"validation" : @[
+                                    @{ @"rule" : @"formatRegex", @"value" : @"/^[0-9]{5}$/",
+                                       @"message" : @"Invalid zip" },
+                            ]
+                    },
+                    @"aboutMe" : @{
+                            @"type" : @"textarea",
+                            @"schemaId" : @"aboutMe"
+                    },
+            }
+    }];
+}
+
+- (NSDictionary *)validRegistration
+{
+    return @{
+            @"emailAddress" : @"someone@example.com",
+            @"displayName" : @"someone",
+            @"newPassword" : @"hunter22",
+            @"newPasswordConfirm" : @"hunter22",
+            @"birthdate[dateselect_year]" : @"1980",
+            @"zip" : @"97204",
+    };
+}
+
+- (NSDictionary *)invalidFieldsWithRegistration:(NSDictionary *)overrides
+{
+    NSMutableDictionary *fields = [[self validRegistration] mutableCopy];
+    for (NSString *key in overrides) {
+        if ([overrides objectForKey:key] == [NSNull null]) [fields removeObjectForKey:key];
+        else [fields setObject:[overrides objectForKey:key] forKey:key];
+    }
+
+    return [[self.flow validatorForForm:@"registrationForm"] invalidFieldsForFormFields:fields];
+}
+
+- (void)test_a100_compilesOnlyClientCheckableRules
+{
+    GHAssertEquals([self.flow validatorForForm:@"registrationForm"].ruleCount, (NSUInteger) 9, nil);
+    GHAssertEquals([self.flow validatorForForm:@"editProfileForm"].ruleCount, (NSUInteger) 3, nil);
+    GHAssertNil([self.flow validatorForForm:@"noSuchForm"], nil);
+    GHAssertNil([self.flow validatorForForm:@"emailAddress"], nil);
+}
+
+- (void)test_a101_validFormPasses
+{
+    GHAssertNil([self invalidFieldsWithRegistration:@{}], nil);
+}
+
+- (void)test_a102_requiredFields
+{
+    NSDictionary *invalid = [self invalidFieldsWithRegistration:@{
+            @"emailAddress" : [NSNull null],
+            @"displayName" : @"   ",
+            @"birthdate[dateselect_year]" : [NSNull null],
+    }];
+
+    GHAssertEqualObjects([invalid objectForKey:@"emailAddress"], @[ @"Email is required" ], nil);
+    GHAssertEqualObjects([invalid objectForKey:@"displayName"], @[ @"Name is required" ], nil);
+    GHAssertEqualObjects([invalid objectForKey:@"birthdate"], @[ @"Birthdate required" ], nil);
+    GHAssertEquals([invalid count], (NSUInteger) 3, nil);
+}
+
+- (void)test_a103_lengthCountsCharacters
+{
+    GHAssertEqualObjects([self invalidFieldsWithRegistration:@{ @"displayName" : @"ab" }],
+            @{ @"displayName" : @[ @"Name too short" ] }, nil);
+    GHAssertEqualObjects([self invalidFieldsWithRegistration:@{ @"displayName" : @"abcdefghijk" }],
+            @{ @"displayName" : @[ @"Name too long" ] }, nil);
+    GHAssertNil([self invalidFieldsWithRegistration:@{ @"displayName" : @"\U0001F600\U0001F600\U0001F600" }], nil);
+}
+
+- (void)test_a104_formats
+{
+    GHAssertEqualObjects([self invalidFieldsWithRegistration:@{ @"emailAddress" : @"someone" }],
+            @{ @"emailAddress" : @[ @"Invalid email" ] }, nil);
+    GHAssertEqualObjects([self invalidFieldsWithRegistration:@{ @"zip" : @"9720" }],
+            @{ @"zip" : @[ @"Invalid zip" ] }, nil);
+
+    /* Optional fields are only format checked when they have a value */
+    GHAssertNil([self invalidFieldsWithRegistration:@{ @"zip" : [NSNull null] }], nil);
+}
+
+- (void)test_a105_matchField
+{
+    GHAssertEqualObjects([self invalidFieldsWithRegistration:@{ @"newPasswordConfirm" : @"hunter2" }],
+            @{ @"newPasswordConfirm" : @[ @"Passwords don't match" ] }, nil);
+    GHAssertNil([self invalidFieldsWithRegistration:@{ @"newPassword" : [NSNull null],
+                                                       @"newPasswordConfirm" : [NSNull null] }], nil);
+}
+
+- (void)test_a106_errorMatchesServerFormValidationError
+{
+    NSDictionary *invalidFields = @{ @"emailAddress" : @[ @"Invalid email" ] };
+    JRCaptureError *error = [JRCaptureError formValidationErrorWithInvalidFields:invalidFields];
+
+    GHAssertTrue([error isFormValidationError], nil);
+    GHAssertEquals([error code], (NSInteger) JRCaptureApidErrorFormValidation, nil);
+    GHAssertEqualObjects([error validationFailureMessages], invalidFields, nil);
+}
+
+- (void)test_a107_malformedRulesAreSkipped
+{
+    JRCaptureFlow *badFlow = [JRCaptureFlow flowWithDictionary:@{
+            @"fields" : @{
+                    @"form" : @{ @"fields" : @[ @"a", @"b", @"missing" ] },
+                    @"a" : @{ @"validation" : @[ @{ @"rule" : @"formatRegex", @"value" : @"([" },
+                                                 @{ @"rule" : @"format", @"value" : @"noSuchFormat" },
+                                                 @{ @"rule" : @"required", @"value" : @NO } ] },
+                    @"b" : @{ @"validation" : @"required" },
+            }
+    }];
+
+    GHAssertEquals([badFlow validatorForForm:@"form"].ruleCount, (NSUInteger) 0, nil);
+    GHAssertNil([[badFlow validatorForForm:@"form"] invalidFieldsForFormFields:@{}], nil);
+}
+
+@end
@@ -0,0 +1,274 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import <mach/mach.h>
+#import "JRCaptureUser.h"
+#import "JRCaptureObject+Internal.h"
+
+#define cJRLargeUserPluralCount 5000
+
+static uint64_t JRMemoryFootprint()
+{
+    task_vm_info_data_t info;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, (task_info_t) &info, &count) != KERN_SUCCESS) return 0;
+
+    return info.phys_footprint;
+}
+
+@interface JRCaptureObjectCopyTests : GHTestCase
+@end
+
+@implementation JRCaptureObjectCopyTests
+
+- (JRCaptureUser *)largeUser
+{
+    JRCaptureUser *user = [JRCaptureUser captureUser];
+    user.basicString = @"basic string";
+    user.basicObject.string1 = @"object string";
+
+    NSMutableArray *plural = [NSMutableArray arrayWithCapacity:cJRLargeUserPluralCount];
+    for (NSUInteger i = 0; i < cJRLargeUserPluralCount; i++)
+    {
+        JRBasicPluralElement *element = [JRBasicPluralElement basicPluralElement];
+        element.string1 = [NSString stringWithFormat:@"element %lu", (unsigned long) i];
+        [plural addObject:element];
+    }
+    user.basicPlural = plural;
+
+    return user;
+}
+
+- (void)test_copyKeepsValues
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    GHAssertEqualStrings(userCopy.basicString, @"basic string", nil);
+    GHAssertEqualStrings(userCopy.basicObject.string1, @"object string", nil);
+    GHAssertEquals([userCopy.basicPlural count], (NSUInteger) cJRLargeUserPluralCount, nil);
+    GHAssertEqualObjects(userCopy.dirtyPropertySet, user.dirtyPropertySet, nil);
+    GHAssertTrue([user isEqualToCaptureUser:userCopy], nil);
+}
+
+- (void)test_copySharesSubObjectsUntilAccessed
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    GHAssertTrue([userCopy.sharedPropertySet containsObject:@"basicObject"], nil);
+    GHAssertTrue([userCopy.sharedPropertySet containsObject:@"basicPlural"], nil);
+    GHAssertFalse([userCopy.sharedPropertySet containsObject:@"basicString"], nil);
+
+    JRBasicObject *copiedObject = userCopy.basicObject;
+
+    GHAssertFalse([userCopy.sharedPropertySet containsObject:@"basicObject"], nil);
+    GHAssertTrue([userCopy.sharedPropertySet containsObject:@"basicPlural"], nil);
+    GHAssertTrue(copiedObject != user.basicObject, nil);
+}
+
+- (void)test_mutatingCopyLeavesOriginalAlone
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    userCopy.basicObject.string1 = @"changed";
+    ((JRBasicPluralElement *) [userCopy.basicPlural objectAtIndex:0]).string1 = @"changed";
+
+    GHAssertEqualStrings(user.basicObject.string1, @"object string", nil);
+    GHAssertEqualStrings(((JRBasicPluralElement *) [user.basicPlural objectAtIndex:0]).string1, @"element 0", nil);
+}
+
+- (void)test_mutatingOriginalLeavesCopyAlone
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    user.basicObject.string1 = @"changed";
+    ((JRBasicPluralElement *) [user.basicPlural objectAtIndex:0]).string1 = @"changed";
+
+    GHAssertEqualStrings(userCopy.basicObject.string1, @"object string", nil);
+    GHAssertEqualStrings(((JRBasicPluralElement *) [userCopy.basicPlural objectAtIndex:0]).string1, @"element 0", nil);
+}
+
+- (void)test_settingSharedPropertyDoesNotDuplicateIt
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    JRBasicObject *newObject = [JRBasicObject basicObject];
+    userCopy.basicObject = newObject;
+
+    GHAssertFalse([userCopy.sharedPropertySet containsObject:@"basicObject"], nil);
+    GHAssertTrue(userCopy.basicObject == newObject, nil);
+    GHAssertEqualStrings(user.basicObject.string1, @"object string", nil);
+}
+
+- (void)test_readingCopyDoesNotUnshareIt
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    [NSKeyedArchiver archivedDataWithRootObject:userCopy];
+    [userCopy toReplaceDictionary];
+    [userCopy toUpdateDictionary];
+    [userCopy needsUpdate];
+    [userCopy hash];
+    GHAssertTrue([userCopy isEqualToCaptureUser:user], nil);
+    GHAssertTrue([user isEqualToCaptureUser:userCopy], nil);
+
+    GHAssertTrue([userCopy.sharedPropertySet containsObject:@"basicObject"], nil);
+    GHAssertTrue([userCopy.sharedPropertySet containsObject:@"basicPlural"], nil);
+    GHAssertTrue([userCopy valueForCopyOnWriteProperty:@"basicObject"] == user.basicObject, nil);
+    GHAssertTrue([userCopy valueForCopyOnWriteProperty:@"basicPlural"] == user.basicPlural, nil);
+}
+
+- (void)test_readingOriginalDoesNotUnshareIt
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    JRBasicObject *object = user.basicObject;
+    NSArray *plural = user.basicPlural;
+
+    GHAssertNil(user.sharedPropertySet, nil);
+    GHAssertTrue([userCopy valueForCopyOnWriteProperty:@"basicObject"] == object, nil);
+    GHAssertTrue([userCopy valueForCopyOnWriteProperty:@"basicPlural"] == plural, nil);
+}
+
+- (void)test_mutatingOriginalElementDuplicatesOnlyThatElement
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+
+    ((JRBasicPluralElement *) [user.basicPlural objectAtIndex:0]).string1 = @"changed";
+
+    NSArray *sharedPlural = [userCopy valueForCopyOnWriteProperty:@"basicPlural"];
+    GHAssertTrue([userCopy.sharedPropertySet containsObject:@"basicPlural"], nil);
+    GHAssertTrue([sharedPlural objectAtIndex:0] != [user.basicPlural objectAtIndex:0], nil);
+    GHAssertTrue([sharedPlural objectAtIndex:1] == [user.basicPlural objectAtIndex:1], nil);
+    GHAssertEqualStrings(((JRBasicPluralElement *) [sharedPlural objectAtIndex:0]).string1, @"element 0", nil);
+}
+
+- (void)test_mutatingOriginalLeavesCopiesOfCopiesAlone
+{
+    JRCaptureUser *user = [self largeUser];
+    JRCaptureUser *userCopy = [user copy];
+    JRCaptureUser *userCopyCopy = [userCopy copy];
+
+    user.basicObject.string1 = @"changed";
+
+    GHAssertEqualStrings(userCopy.basicObject.string1, @"object string", nil);
+    GHAssertEqualStrings(userCopyCopy.basicObject.string1, @"object string", nil);
+}
+
+- (void)test_assigningAnotherUsersSubObjectCopiesIt
+{
+    JRCaptureUser *userA = [self largeUser];
+    JRCaptureUser *userACopy = [userA copy];
+    JRCaptureUser *userB = [JRCaptureUser captureUser];
+
+    userB.basicObject = userA.basicObject;
+    userB.basicPlural = userA.basicPlural;
+    GHAssertTrue(userB.basicObject != userA.basicObject, nil);
+    GHAssertTrue([userB.basicPlural objectAtIndex:0] != [userA.basicPlural objectAtIndex:0], nil);
+    GHAssertEqualStrings(userB.basicObject.string1, @"object string", nil);
+
+    /* userA still hears about changes to its own tree, and userB doesn't */
+    userA.basicObject.string1 = @"changed";
+    ((JRBasicPluralElement *) [userA.basicPlural objectAtIndex:0]).string1 = @"changed";
+
+    GHAssertEqualStrings(userACopy.basicObject.string1, @"object string", nil);
+    GHAssertEqualStrings(((JRBasicPluralElement *) [userACopy.basicPlural objectAtIndex:0]).string1, @"element 0",
+                         nil);
+    GHAssertEqualStrings(userB.basicObject.string1, @"object string", nil);
+    GHAssertEqualStrings(((JRBasicPluralElement *) [userB.basicPlural objectAtIndex:0]).string1, @"element 0", nil);
+    GHAssertFalse([userA isEqualToCaptureUser:userB], nil);
+
+    userB.basicObject.string1 = @"changed in b";
+    GHAssertEqualStrings(userA.basicObject.string1, @"changed", nil);
+}
+
+- (void)test_copyBenchmark
+{
+    JRCaptureUser *user = [self largeUser];
+    NSUInteger iterations = 1000;
+
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < iterations; i++)
+        [user copy];
+    CFAbsoluteTime copyTime = CFAbsoluteTimeGetCurrent() - start;
+
+    /* Touching the plural forces the deep copy that every copy used to pay for */
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < 10; i++)
+        [[user copy] basicPlural];
+    CFAbsoluteTime deepCopyTime = (CFAbsoluteTimeGetCurrent() - start) * iterations / 10;
+
+    GHTestLog(@"%lu copies of a user with %d plural elements: %f s shared, %f s duplicated", (unsigned long) iterations,
+              cJRLargeUserPluralCount, copyTime, deepCopyTime);
+
+    GHAssertLessThan(copyTime, deepCopyTime, nil);
+
+    /* Memory held by copies that are kept around, e.g. for undo, with and without the plural duplicated */
+    NSUInteger keptCopies = 20;
+    NSMutableArray *copies = [NSMutableArray arrayWithCapacity:keptCopies];
+
+    uint64_t footprint = JRMemoryFootprint();
+    @autoreleasepool
+    {
+        for (NSUInteger i = 0; i < keptCopies; i++)
+            [copies addObject:[user copy]];
+    }
+    int64_t sharedBytes = (int64_t) (JRMemoryFootprint() - footprint);
+
+    [copies removeAllObjects];
+
+    footprint = JRMemoryFootprint();
+    @autoreleasepool
+    {
+        for (NSUInteger i = 0; i < keptCopies; i++)
+        {
+            JRCaptureUser *userCopy = [user copy];
+            [userCopy basicPlural];
+            [copies addObject:userCopy];
+        }
+    }
+    int64_t duplicatedBytes = (int64_t) (JRMemoryFootprint() - footprint);
+
+    GHTestLog(@"%lu kept copies: %lld bytes shared, %lld bytes duplicated", (unsigned long) keptCopies, sharedBytes,
+              duplicatedBytes);
+
+    GHAssertLessThan(sharedBytes, duplicatedBytes, nil);
+}
+
+@end
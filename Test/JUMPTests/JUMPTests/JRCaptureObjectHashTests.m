@@ -0,0 +1,199 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRCaptureUser.h"
+#import "JRCaptureObject+Internal.h"
+
+@interface JRCaptureUser (JRCaptureUser_InternalMethods)
+- (BOOL)isEqualToCaptureUser:(JRCaptureUser *)otherCaptureUser;
+@end
+
+@interface JRBasicObject (JRBasicObject_InternalMethods)
+- (BOOL)isEqualToBasicObject:(JRBasicObject *)otherBasicObject;
+@end
+
+@interface JRCaptureObjectHashTests : GHTestCase
+@end
+
+@implementation JRCaptureObjectHashTests
+
+- (JRCaptureUser *)userWithPluralCount:(NSUInteger)count
+{
+    JRCaptureUser *user = [JRCaptureUser captureUser];
+    user.basicString = @"basic string";
+    user.basicObject.string1 = @"object string";
+
+    NSMutableArray *plural = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        JRBasicPluralElement *element = [JRBasicPluralElement basicPluralElement];
+        element.string1 = [NSString stringWithFormat:@"element %lu", (unsigned long) i];
+        [plural addObject:element];
+    }
+    user.basicPlural = plural;
+
+    return user;
+}
+
+- (void)test_equalUsersHaveEqualHashes
+{
+    JRCaptureUser *user1 = [self userWithPluralCount:10];
+    JRCaptureUser *user2 = [self userWithPluralCount:10];
+
+    GHAssertTrue(user1 != user2, nil);
+    GHAssertEqualObjects(user1, user2, nil);
+    GHAssertEquals([user1 hash], [user2 hash], nil);
+}
+
+- (void)test_emptyAndNilSubObjectsHashTheSame
+{
+    JRCaptureUser *user1 = [JRCaptureUser captureUser];
+    JRCaptureUser *user2 = [JRCaptureUser captureUser];
+    user2.basicObject = nil;
+    user2.basicPlural = [NSArray array];
+
+    GHAssertTrue([user1 isEqualToCaptureUser:user2], nil);
+    GHAssertEquals([user1 hash], [user2 hash], nil);
+}
+
+- (void)test_changingPluralElementChangesUserHash
+{
+    JRCaptureUser *user1 = [self userWithPluralCount:10];
+    JRCaptureUser *user2 = [self userWithPluralCount:10];
+    NSUInteger hash = [user1 hash];
+
+    ((JRBasicPluralElement *) [user1.basicPlural objectAtIndex:5]).string2 = @"changed";
+
+    GHAssertFalse([user1 hash] == hash, nil);
+    GHAssertFalse([user1 isEqual:user2], nil);
+}
+
+- (void)test_changingSubObjectChangesUserHash
+{
+    JRCaptureUser *user = [self userWithPluralCount:0];
+    NSUInteger hash = [user hash];
+
+    user.basicObject.string2 = @"changed";
+
+    GHAssertFalse([user hash] == hash, nil);
+}
+
+- (void)test_changingElementInvalidatesOnlyItsOwnAndItsParentsHashes
+{
+    JRCaptureUser *user = [self userWithPluralCount:10];
+    JRBasicPluralElement *changedElement = [user.basicPlural objectAtIndex:5];
+    JRBasicPluralElement *otherElement = [user.basicPlural objectAtIndex:6];
+    [user hash];
+
+    changedElement.string2 = @"changed";
+
+    GHAssertFalse(user.cachedContentHashIsValid, nil);
+    GHAssertFalse(changedElement.cachedContentHashIsValid, nil);
+    GHAssertTrue(otherElement.cachedContentHashIsValid, nil);
+    GHAssertTrue(user.basicObject.cachedContentHashIsValid, nil);
+}
+
+- (void)test_changingOneUserLeavesOtherHashesCached
+{
+    JRCaptureUser *user1 = [self userWithPluralCount:10];
+    JRCaptureUser *user2 = [self userWithPluralCount:10];
+    JRCaptureUser *user1Copy = [user1 copy];
+    [user1 hash];
+    [user2 hash];
+    [user1Copy hash];
+
+    user1.basicObject.string2 = @"changed";
+
+    GHAssertFalse(user1.cachedContentHashIsValid, nil);
+    GHAssertTrue(user2.cachedContentHashIsValid, nil);
+    GHAssertTrue(user1Copy.cachedContentHashIsValid, nil);
+    GHAssertEquals([user1Copy hash], [user2 hash], nil);
+}
+
+- (void)test_copyIsEqualAndHashesTheSame
+{
+    JRCaptureUser *user = [self userWithPluralCount:10];
+    JRCaptureUser *userCopy = [user copy];
+
+    GHAssertEqualObjects(user, userCopy, nil);
+    GHAssertEquals([user hash], [userCopy hash], nil);
+
+    userCopy.basicString = @"changed";
+
+    GHAssertFalse([user isEqual:userCopy], nil);
+}
+
+- (void)test_usersWorkAsSetMembers
+{
+    NSSet *set = [NSSet setWithObjects:[self userWithPluralCount:3], [self userWithPluralCount:4], nil];
+
+    GHAssertTrue([set containsObject:[self userWithPluralCount:3]], nil);
+    GHAssertFalse([set containsObject:[self userWithPluralCount:5]], nil);
+}
+
+- (void)test_elementsDoNotEqualOtherClasses
+{
+    JRBasicPluralElement *element = [JRBasicPluralElement basicPluralElement];
+    JRBasicObject *object = [JRBasicObject basicObject];
+
+    GHAssertFalse([element isEqual:object], nil);
+    GHAssertFalse([element isEqual:@"string"], nil);
+}
+
+- (void)test_nothingEqualsNil
+{
+    JRCaptureUser *user = [JRCaptureUser captureUser];
+    JRBasicObject *object = [JRBasicObject basicObject];
+
+    GHAssertFalse([user isEqualToCaptureUser:nil], nil);
+    GHAssertFalse([object isEqualToBasicObject:nil], nil);
+    GHAssertFalse([user isEqual:nil], nil);
+    GHAssertFalse([object isEqual:nil], nil);
+}
+
+- (void)test_mismatchBenchmark
+{
+    JRCaptureUser *user1 = [self userWithPluralCount:5000];
+    JRCaptureUser *user2 = [self userWithPluralCount:5000];
+    ((JRBasicPluralElement *) [user2.basicPlural lastObject]).string2 = @"changed";
+
+    NSUInteger iterations = 1000;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < iterations; i++)
+        GHAssertFalse([user1 isEqualToCaptureUser:user2], nil);
+    CFAbsoluteTime time = CFAbsoluteTimeGetCurrent() - start;
+
+    GHTestLog(@"%lu comparisons of users with 5000 plural elements differing in the last one: %f s",
+              (unsigned long) iterations, time);
+}
+
+@end
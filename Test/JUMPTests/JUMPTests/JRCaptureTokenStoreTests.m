@@ -0,0 +1,198 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRCaptureTokenStore.h"
+
+@interface JRCountingTokenBackend : NSObject <JRCaptureTokenStoreBackend>
+@property(nonatomic) NSMutableDictionary *stored;
+@property(nonatomic) NSUInteger readCount;
+@property(nonatomic) NSUInteger writeCount;
+@property(nonatomic) NSDictionary *lastWrite;
+@property(nonatomic) BOOL failWrites;
+@end
+
+@implementation JRCountingTokenBackend
+- (id)init
+{
+    if ((self = [super init]))
+        _stored = [NSMutableDictionary dictionary];
+
+    return self;
+}
+
+- (NSDictionary *)tokensForNames:(NSArray *)tokenNames
+{
+    self.readCount++;
+    return [self.stored copy];
+}
+
+- (BOOL)writeTokens:(NSDictionary *)tokens error:(NSError **)error
+{
+    self.writeCount++;
+    self.lastWrite = tokens;
+    if (self.failWrites)
+    {
+        if (error) *error = [NSError errorWithDomain:@"JRCountingTokenBackend" code:1 userInfo:nil];
+        return NO;
+    }
+
+    for (NSString *tokenName in tokens)
+        if ([tokens objectForKey:tokenName] == [NSNull null])
+            [self.stored removeObjectForKey:tokenName];
+        else
+            [self.stored setObject:[tokens objectForKey:tokenName] forKey:tokenName];
+
+    return YES;
+}
+@end
+
+@interface JRCaptureTokenStoreTests : GHTestCase
+@property(nonatomic) JRCountingTokenBackend *backend;
+@property(nonatomic) JRCaptureTokenStore *store;
+@end
+
+@implementation JRCaptureTokenStoreTests
+
+- (void)setUp
+{
+    self.backend = [[JRCountingTokenBackend alloc] init];
+    [self.backend.stored setObject:@"stored access token" forKey:@"access_token"];
+    self.store = [[JRCaptureTokenStore alloc] initWithBackend:self.backend
+                                                   tokenNames:@[ @"access_token", @"refresh_secret" ]];
+}
+
+- (void)test_readsComeFromMemory
+{
+    for (int i = 0; i < 10; i++)
+        GHAssertEqualStrings([self.store tokenForName:@"access_token"], @"stored access token", nil);
+
+    GHAssertNil([self.store tokenForName:@"refresh_secret"], nil);
+    GHAssertEquals(self.backend.readCount, (NSUInteger) 1, nil);
+}
+
+- (void)test_writeGoesThroughOnce
+{
+    [self.store setToken:@"new access token" forName:@"access_token"];
+
+    GHAssertEqualStrings([self.store tokenForName:@"access_token"], @"new access token", nil);
+    GHAssertEqualStrings([self.backend.stored objectForKey:@"access_token"], @"new access token", nil);
+    GHAssertEquals(self.backend.writeCount, (NSUInteger) 1, nil);
+}
+
+- (void)test_unchangedTokenIsNotWritten
+{
+    [self.store setToken:@"stored access token" forName:@"access_token"];
+    [self.store setToken:nil forName:@"refresh_secret"];
+
+    GHAssertEquals(self.backend.writeCount, (NSUInteger) 0, nil);
+}
+
+- (void)test_batchedTokensAreWrittenTogether
+{
+    [self.store setTokens:@{ @"access_token" : @"a", @"refresh_secret" : @"b" }];
+
+    GHAssertEquals(self.backend.writeCount, (NSUInteger) 1, nil);
+    GHAssertEquals([self.backend.lastWrite count], (NSUInteger) 2, nil);
+}
+
+- (void)test_failedWriteLeavesCacheAlone
+{
+    self.backend.failWrites = YES;
+
+    GHAssertFalse([self.store setTokens:@{ @"access_token" : @"a", @"refresh_secret" : @"b" }], nil);
+    GHAssertFalse([self.store removeAllTokens], nil);
+
+    GHAssertEqualStrings([self.store tokenForName:@"access_token"], @"stored access token", nil);
+    GHAssertNil([self.store tokenForName:@"refresh_secret"], nil);
+
+    self.backend.failWrites = NO;
+    GHAssertTrue([self.store setToken:@"a" forName:@"access_token"], nil);
+    GHAssertEqualStrings([self.store tokenForName:@"access_token"], @"a", nil);
+}
+
+- (void)test_removeAllTokens
+{
+    [self.store setToken:@"secret" forName:@"refresh_secret"];
+    [self.store removeAllTokens];
+
+    GHAssertNil([self.store tokenForName:@"access_token"], nil);
+    GHAssertNil([self.store tokenForName:@"refresh_secret"], nil);
+    GHAssertEquals([self.backend.stored count], (NSUInteger) 0, nil);
+    GHAssertEquals(self.backend.writeCount, (NSUInteger) 2, nil);
+}
+
+- (void)test_fileBackendRoundTrip
+{
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"JRCaptureTokenStoreTests.plist"];
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+
+    JRCaptureFileTokenBackend *fileBackend = [[JRCaptureFileTokenBackend alloc] initWithPath:path];
+    JRCaptureTokenStore *store = [[JRCaptureTokenStore alloc] initWithBackend:fileBackend
+                                                                   tokenNames:@[ @"access_token", @"refresh_secret" ]];
+    [store setTokens:@{ @"access_token" : @"a", @"refresh_secret" : @"b" }];
+    [store setToken:nil forName:@"refresh_secret"];
+
+    JRCaptureTokenStore *reloaded = [[JRCaptureTokenStore alloc] initWithBackend:fileBackend
+                                                                      tokenNames:@[ @"access_token", @"refresh_secret" ]];
+    GHAssertEqualStrings([reloaded tokenForName:@"access_token"], @"a", nil);
+    GHAssertNil([reloaded tokenForName:@"refresh_secret"], nil);
+
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)test_readBenchmark
+{
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"JRCaptureTokenStoreBenchmark.plist"];
+    JRCaptureFileTokenBackend *fileBackend = [[JRCaptureFileTokenBackend alloc] initWithPath:path];
+    JRCaptureTokenStore *store = [[JRCaptureTokenStore alloc] initWithBackend:fileBackend
+                                                                   tokenNames:@[ @"access_token" ]];
+    [store setToken:@"a" forName:@"access_token"];
+
+    NSUInteger iterations = 1000;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < iterations; i++)
+        [fileBackend tokensForNames:@[ @"access_token" ]];
+    CFAbsoluteTime backendTime = CFAbsoluteTimeGetCurrent() - start;
+
+    start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < iterations; i++)
+        [store tokenForName:@"access_token"];
+    CFAbsoluteTime storeTime = CFAbsoluteTimeGetCurrent() - start;
+
+    GHTestLog(@"%lu token reads: %f s from the backend, %f s from the store", (unsigned long) iterations,
+              backendTime, storeTime);
+    GHAssertLessThan(storeTime, backendTime, nil);
+
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+@end
@@ -0,0 +1,210 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRConfigurationReadiness.h"
+
+static NSString *const JRTestConfigurationNotification = @"JRTestConfigurationNotification";
+static NSString *const JRTestConfigurationFailedNotification = @"JRTestConfigurationFailedNotification";
+
+@interface JRConfigurationReadinessTests : GHAsyncTestCase
+@property(nonatomic) BOOL providersLoaded;
+@property(nonatomic) NSObject *sender;
+@property(nonatomic) JRConfigurationReadiness *readiness;
+@property(nonatomic) NSMutableArray *results;
+@end
+
+@implementation JRConfigurationReadinessTests
+
+- (void)setUp
+{
+    self.providersLoaded = NO;
+    self.sender = [[NSObject alloc] init];
+    self.results = [NSMutableArray array];
+
+    __weak JRConfigurationReadinessTests *weakSelf = self;
+    self.readiness = [[JRConfigurationReadiness alloc] initWithSender:self.sender
+                                                     notificationName:JRTestConfigurationNotification
+                                              failureNotificationName:JRTestConfigurationFailedNotification
+                                                            condition:^BOOL
+                                                            {
+                                                                return weakSelf.providersLoaded;
+                                                            }];
+}
+
+- (void)tearDown
+{
+    [self.readiness cancel];
+}
+
+- (void)postFrom:(id)sender
+{
+    [[NSNotificationCenter defaultCenter] postNotificationName:JRTestConfigurationNotification object:sender];
+}
+
+- (void)test_a100_alreadyReadyCompletesSynchronously
+{
+    self.providersLoaded = YES;
+
+    [self.readiness waitWithTimeout:10 completion:^(BOOL ready)
+    {
+        [self.results addObject:[NSNumber numberWithBool:ready]];
+    }];
+
+    GHAssertEqualObjects(self.results, [NSArray arrayWithObject:[NSNumber numberWithBool:YES]], nil);
+    GHAssertFalse(self.readiness.waiting, nil);
+}
+
+- (void)test_a101_notificationCompletesOnceConditionHolds
+{
+    [self prepare];
+
+    [self.readiness waitWithTimeout:10 completion:^(BOOL ready)
+    {
+        [self.results addObject:[NSNumber numberWithBool:ready]];
+        [self notify:ready ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure forSelector:_cmd];
+    }];
+
+    GHAssertTrue(self.readiness.waiting, nil);
+
+    /* Finished updating, but still no providers: keep waiting */
+    [self postFrom:self.sender];
+
+    self.providersLoaded = YES;
+    [self postFrom:self.sender];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+
+    /* Further notifications don't call the completion again */
+    [self postFrom:self.sender];
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+    GHAssertEquals([self.results count], (NSUInteger) 1, nil);
+}
+
+- (void)test_a102_otherSendersAreIgnored
+{
+    [self prepare];
+
+    [self.readiness waitWithTimeout:0.3 completion:^(BOOL ready)
+    {
+        [self notify:ready ? kGHUnitWaitStatusFailure : kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    self.providersLoaded = YES;
+    [self postFrom:[[NSObject alloc] init]];
+    self.providersLoaded = NO;
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+}
+
+- (void)test_a103_timesOut
+{
+    [self prepare];
+
+    NSDate *start = [NSDate date];
+    [self.readiness waitWithTimeout:0.2 completion:^(BOOL ready)
+    {
+        [self notify:ready ? kGHUnitWaitStatusFailure : kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+    GHAssertGreaterThanOrEqual([[NSDate date] timeIntervalSinceDate:start], 0.2, nil);
+    GHAssertFalse(self.readiness.waiting, nil);
+}
+
+- (void)test_a104_cancelSuppressesCompletion
+{
+    [self.readiness waitWithTimeout:0.1 completion:^(BOOL ready)
+    {
+        [self.results addObject:[NSNumber numberWithBool:ready]];
+    }];
+    [self.readiness cancel];
+
+    self.providersLoaded = YES;
+    [self postFrom:self.sender];
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.3]];
+
+    GHAssertEquals([self.results count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a105_staleTimeoutDoesNotEndANewWait
+{
+    [self prepare];
+
+    [self.readiness waitWithTimeout:0.1 completion:^(BOOL ready)
+    {
+        [self.results addObject:@"first"];
+    }];
+    [self.readiness waitWithTimeout:0.5 completion:^(BOOL ready)
+    {
+        [self.results addObject:@"second"];
+        [self notify:ready ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure forSelector:_cmd];
+    }];
+
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+    GHAssertTrue(self.readiness.waiting, nil);
+
+    self.providersLoaded = YES;
+    [self postFrom:self.sender];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+    GHAssertEqualObjects(self.results, [NSArray arrayWithObject:@"second"], nil);
+}
+
+- (void)test_a106_failureCompletesRightAway
+{
+    [self prepare];
+
+    NSDate *start = [NSDate date];
+    [self.readiness waitWithTimeout:10 completion:^(BOOL ready)
+    {
+        [self.results addObject:[NSNumber numberWithBool:ready]];
+        [self notify:ready ? kGHUnitWaitStatusFailure : kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    /* Only the sender's failure counts */
+    [[NSNotificationCenter defaultCenter] postNotificationName:JRTestConfigurationFailedNotification
+                                                        object:[[NSObject alloc] init]];
+    GHAssertTrue(self.readiness.waiting, nil);
+
+    [[NSNotificationCenter defaultCenter] postNotificationName:JRTestConfigurationFailedNotification
+                                                        object:self.sender];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+    GHAssertLessThan([[NSDate date] timeIntervalSinceDate:start], 1.0, nil);
+    GHAssertFalse(self.readiness.waiting, nil);
+
+    [self postFrom:self.sender];
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+    GHAssertEquals([self.results count], (NSUInteger) 1, nil);
+}
+
+@end
@@ -0,0 +1,260 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRIconCache.h"
+
+@interface JRIconCacheTests : GHAsyncTestCase
+@property(nonatomic) NSString *directory;
+@property(nonatomic) NSMutableDictionary *bundle;
+@property(nonatomic) NSMutableDictionary *remote;
+@property(nonatomic) NSMutableArray *fetched;
+@property(nonatomic) JRIconCache *cache;
+@end
+
+@implementation JRIconCacheTests
+@synthesize directory;
+@synthesize bundle;
+@synthesize remote;
+@synthesize fetched;
+@synthesize cache;
+
+- (NSData *)dataWithString:(NSString *)string
+{
+    return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+/* Icons are the file contents as strings, which keeps the assertions readable */
+- (JRIconCache *)cacheWithCapacity:(NSUInteger)capacity
+{
+    __weak JRIconCacheTests *weakSelf = self;
+    return [[JRIconCache alloc] initWithDiskCacheDirectory:self.directory memoryCapacity:capacity
+                                              bundleLoader:^NSData *(NSString *name)
+                                              {
+                                                  return [weakSelf.bundle objectForKey:name];
+                                              }
+                                                   fetcher:^(NSString *name, void (^completion)(NSData *))
+                                                   {
+                                                       dispatch_async(dispatch_get_main_queue(), ^
+                                                       {
+                                                           [weakSelf.fetched addObject:name];
+                                                           completion([weakSelf.remote objectForKey:name]);
+                                                       });
+                                                   }
+                                                   decoder:^id(NSData *data)
+                                                   {
+                                                       return [[NSString alloc] initWithData:data
+                                                                                    encoding:NSUTF8StringEncoding];
+                                                   }];
+}
+
+- (void)setUp
+{
+    self.directory = [NSTemporaryDirectory() stringByAppendingPathComponent:
+            [NSString stringWithFormat:@"JRIconCacheTests-%@", [[NSProcessInfo processInfo] globallyUniqueString]]];
+    self.bundle = [NSMutableDictionary dictionary];
+    self.remote = [NSMutableDictionary dictionary];
+    self.fetched = [NSMutableArray array];
+    self.cache = [self cacheWithCapacity:4];
+}
+
+- (void)tearDown
+{
+    [self.cache removeAllIcons];
+}
+
+- (void)test_a100_iconNames
+{
+    GHAssertEqualStrings([JRIconCache iconNameForProvider:@"facebook" blackAndWhite:NO width:30 height:30],
+                         @"icon_facebook_30x30.png", nil);
+    GHAssertEqualStrings([JRIconCache iconNameForProvider:@"twitter" blackAndWhite:YES width:30 height:30],
+                         @"icon_bw_twitter_30x30.png", nil);
+}
+
+- (void)test_a101_bundledIconIsLoadedAndKeptInMemory
+{
+    [self prepare];
+    [self.bundle setObject:[self dataWithString:@"facebook"] forKey:@"icon_facebook_30x30.png"];
+
+    GHAssertNil([self.cache cachedIconNamed:@"icon_facebook_30x30.png"], nil);
+
+    [self.cache iconNamed:@"icon_facebook_30x30.png" completion:^(id icon)
+    {
+        GHAssertTrue([NSThread isMainThread], nil);
+        [self notify:[icon isEqual:@"facebook"] ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure
+         forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+
+    GHAssertEqualObjects([self.cache cachedIconNamed:@"icon_facebook_30x30.png"], @"facebook", nil);
+    GHAssertEquals([self.fetched count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a102_fetchedIconIsWrittenToDisk
+{
+    [self prepare];
+    [self.remote setObject:[self dataWithString:@"mixi"] forKey:@"icon_mixi_30x30.png"];
+
+    [self.cache iconNamed:@"icon_mixi_30x30.png" completion:^(id icon)
+    {
+        [self notify:[icon isEqual:@"mixi"] ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+
+    NSString *path = [self.directory stringByAppendingPathComponent:@"icon_mixi_30x30.png"];
+    GHAssertEqualObjects([NSData dataWithContentsOfFile:path], [self dataWithString:@"mixi"], nil);
+
+    /* A new cache with an empty memory cache finds it on disk without fetching it again */
+    [self.remote removeAllObjects];
+    [self.fetched removeAllObjects];
+    self.cache = [self cacheWithCapacity:4];
+
+    [self prepare];
+    [self.cache iconNamed:@"icon_mixi_30x30.png" completion:^(id icon)
+    {
+        [self notify:[icon isEqual:@"mixi"] ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+    GHAssertEquals([self.fetched count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a103_concurrentRequestsShareOneFetch
+{
+    [self prepare];
+    [self.remote setObject:[self dataWithString:@"yahoo"] forKey:@"icon_yahoo_30x30.png"];
+
+    NSMutableArray *results = [NSMutableArray array];
+    for (int i = 0; i < 3; i++)
+    {
+        [self.cache iconNamed:@"icon_yahoo_30x30.png" completion:^(id icon)
+        {
+            [results addObject:icon ? icon : [NSNull null]];
+            if ([results count] == 3)
+                [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+        }];
+    }
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+
+    GHAssertEqualObjects(results, ([NSArray arrayWithObjects:@"yahoo", @"yahoo", @"yahoo", nil]), nil);
+    GHAssertEqualObjects(self.fetched, [NSArray arrayWithObject:@"icon_yahoo_30x30.png"], nil);
+}
+
+- (void)test_a104_leastRecentlyUsedIconIsEvicted
+{
+    self.cache = [self cacheWithCapacity:2];
+    for (NSString *name in [NSArray arrayWithObjects:@"a", @"b", @"c", nil])
+        [self.bundle setObject:[self dataWithString:name] forKey:name];
+
+    [self prepare];
+    [self.cache iconNamed:@"a" completion:^(id icon)
+    {
+        [self.cache iconNamed:@"b" completion:^(id icon2)
+        {
+            /* Touch a, so that b is the one to go */
+            [self.cache cachedIconNamed:@"a"];
+            [self.cache iconNamed:@"c" completion:^(id icon3)
+            {
+                [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+            }];
+        }];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+
+    GHAssertEquals([self.cache memoryCount], (NSUInteger) 2, nil);
+    GHAssertEqualObjects([self.cache cachedIconNamed:@"a"], @"a", nil);
+    GHAssertNil([self.cache cachedIconNamed:@"b"], nil);
+    GHAssertEqualObjects([self.cache cachedIconNamed:@"c"], @"c", nil);
+}
+
+- (void)test_a105_unavailableIconsAreNotFetchedAgain
+{
+    [self prepare];
+    [self.cache iconNamed:@"icon_missing_30x30.png" completion:^(id icon)
+    {
+        [self.cache iconNamed:@"icon_missing_30x30.png" completion:^(id icon2)
+        {
+            [self notify:!icon && !icon2 ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure forSelector:_cmd];
+        }];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+    GHAssertEquals([self.fetched count], (NSUInteger) 1, nil);
+
+    /* Until it's forgotten, say once the remote location changes */
+    [self.cache forgetUnavailableIcons];
+    [self.remote setObject:[self dataWithString:@"found"] forKey:@"icon_missing_30x30.png"];
+
+    [self prepare];
+    [self.cache iconNamed:@"icon_missing_30x30.png" completion:^(id icon)
+    {
+        [self notify:[icon isEqual:@"found"] ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure
+         forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+    GHAssertEquals([self.fetched count], (NSUInteger) 2, nil);
+}
+
+- (void)test_a106_nilNameCompletesWithNil
+{
+    [self prepare];
+    [self.cache iconNamed:nil completion:^(id icon)
+    {
+        [self notify:icon ? kGHUnitWaitStatusFailure : kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+    GHAssertNil([self.cache cachedIconNamed:nil], nil);
+}
+
+- (void)test_a107_completionsRunOnTheCallbackQueue
+{
+    dispatch_queue_t queue = dispatch_queue_create("com.janrain.test.iconCallbacks", DISPATCH_QUEUE_SERIAL);
+    static char queueKey;
+    dispatch_queue_set_specific(queue, &queueKey, &queueKey, NULL);
+    [self.cache setCallbackQueue:queue];
+    [self.bundle setObject:[self dataWithString:@"google"] forKey:@"icon_google_30x30.png"];
+
+    [self prepare];
+    [self.cache iconNamed:@"icon_google_30x30.png" completion:^(id icon)
+    {
+        BOOL onQueue = dispatch_get_specific(&queueKey) == &queueKey;
+        [self notify:onQueue && icon ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+}
+@end
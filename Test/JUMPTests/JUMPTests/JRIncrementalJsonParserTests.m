@@ -0,0 +1,164 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRIncrementalJsonParser.h"
+
+@interface JRIncrementalJsonParserTests : GHTestCase
+@end
+
+@implementation JRIncrementalJsonParserTests
+
+- (NSArray *)corpus
+{
+    return @[
+            @"{}",
+            @"[]",
+            @" \n\t{ \"a\" : 1 } \r\n",
+            @"[1,-2,0,3.5,-0.25,1e3,2.5E-1,9223372036854775807,-9223372036854775808]",
+            @"[true,false,null,\"\"]",
+            @"{\"nested\":{\"array\":[[],{},[{\"deep\":[1,[2,[3]]]}]]},\"after\":\"x\"}",
+            @"[\"plain\",\"esc\\\"aped\\\\\",\"\\/\\b\\f\\n\\r\\t\",\"\\u0041\\u00e9\\u4e2d\"]",
+            @"[\"\\ud83d\\ude00 and a raw 😀 and é\"]",
+            @"{\"uuid\":\"0b1b9c4e-5ab5-4f3a-9e53-8ff1a1b0e1f4\",\"email\":\"someone@example.com\",\"created\":"
+                    "\"2013-01-17 19:21:47.000000 +0000\",\"photos\":[{\"id\":1,\"value\":null,\"type\":\"small\"}]}"
+    ];
+}
+
+- (id)parseByteByByte:(NSString *)json error:(NSError **)error
+{
+    return [JRIncrementalJsonParser JSONObjectWithData:[json dataUsingEncoding:NSUTF8StringEncoding] chunkSize:1
+                                                 error:error];
+}
+
+- (void)test_a100_matchesNSJSONSerializationWhateverTheChunkSize
+{
+    for (NSString *json in [self corpus])
+    {
+        NSData *data = [json dataUsingEncoding:NSUTF8StringEncoding];
+        id expected = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+
+        for (NSUInteger chunkSize = 1; chunkSize <= [data length]; chunkSize++)
+        {
+            NSError *error = nil;
+            id parsed = [JRIncrementalJsonParser JSONObjectWithData:data chunkSize:chunkSize error:&error];
+            GHAssertNil(error, @"%@ in %lu byte chunks", json, (unsigned long) chunkSize);
+            GHAssertEqualObjects(parsed, expected, @"%@ in %lu byte chunks", json, (unsigned long) chunkSize);
+        }
+    }
+}
+
+- (void)test_a110_numberTypes
+{
+    NSArray *parsed = [self parseByteByByte:@"[42,9223372036854775808,1.5,true]" error:nil];
+
+    GHAssertEquals([[parsed objectAtIndex:0] longLongValue], 42LL, nil);
+    GHAssertEquals(strcmp([[parsed objectAtIndex:0] objCType], @encode(long long)), 0, nil);
+    GHAssertEquals(strcmp([[parsed objectAtIndex:1] objCType], @encode(double)), 0, nil);
+    GHAssertEquals([[parsed objectAtIndex:2] doubleValue], 1.5, nil);
+    GHAssertTrue([parsed objectAtIndex:3] == [NSNumber numberWithBool:YES], nil);
+}
+
+- (void)test_a120_unpairedSurrogatesBecomeReplacementCharacters
+{
+    NSArray *parsed = [self parseByteByByte:@"[\"\\ud83dx\",\"\\ude00\",\"\\ud83d\"]" error:nil];
+
+    GHAssertEqualObjects(parsed, (@[@"\ufffdx", @"\ufffd", @"\ufffd"]), nil);
+}
+
+- (void)test_a130_numberEndingTheChunkWaitsForTheNextOne
+{
+    JRIncrementalJsonParser *parser = [[JRIncrementalJsonParser alloc] init];
+
+    GHAssertTrue([parser appendData:[@"[12" dataUsingEncoding:NSUTF8StringEncoding]], nil);
+    GHAssertTrue([parser appendData:[@"34]" dataUsingEncoding:NSUTF8StringEncoding]], nil);
+
+    GHAssertEqualObjects([parser finishWithError:nil], (@[@1234]), nil);
+    GHAssertEquals(parser.bytesParsed, (NSUInteger) 6, nil);
+}
+
+- (void)test_a200_rejectsMalformedDocuments
+{
+    NSArray *malformed = @[@"", @"   ", @"\"fragment\"", @"42", @"null", @"[1,]", @"{\"a\":1,}", @"{\"a\" 1}",
+            @"{1:2}", @"[01]", @"[1.]", @"[-]", @"[1e]", @"[tru]", @"[nul]", @"[\"\\x\"]", @"[\"\\u12g4\"]",
+            @"[\"tab\there\"]", @"[1] [2]", @"{]", @"[}"];
+
+    for (NSString *json in malformed)
+    {
+        NSError *error = nil;
+        GHAssertNil([self parseByteByByte:json error:&error], json);
+        GHAssertEqualStrings([error domain], NSCocoaErrorDomain, json);
+        GHAssertEquals([error code], (NSInteger) 3840, json);
+    }
+}
+
+- (void)test_a210_rejectsIncompleteDocuments
+{
+    for (NSString *json in @[@"{", @"[1", @"[1,", @"{\"a\"", @"{\"a\":", @"[\"abc", @"[\"\\u00", @"[tr"])
+    {
+        NSError *error = nil;
+        GHAssertNil([self parseByteByByte:json error:&error], json);
+        GHAssertNotNil(error, json);
+    }
+}
+
+- (void)test_a220_rejectsInvalidUtf8
+{
+    const uint8_t bytes[] = {'[', '"', 0xC3, 0x28, '"', ']'};
+    NSError *error = nil;
+
+    GHAssertNil([JRIncrementalJsonParser JSONObjectWithData:[NSData dataWithBytes:bytes length:sizeof(bytes)]
+                                                  chunkSize:1 error:&error], nil);
+    GHAssertNotNil(error, nil);
+}
+
+- (void)test_a230_stopsAtTheFirstError
+{
+    JRIncrementalJsonParser *parser = [[JRIncrementalJsonParser alloc] init];
+
+    GHAssertFalse([parser appendData:[@"[1,,2]" dataUsingEncoding:NSUTF8StringEncoding]], nil);
+    GHAssertFalse([parser appendData:[@"[3]" dataUsingEncoding:NSUTF8StringEncoding]], nil);
+    GHAssertEquals(parser.bytesParsed, (NSUInteger) 3, nil);
+    GHAssertNotNil(parser.error, nil);
+}
+
+- (void)test_a240_limitsNesting
+{
+    NSString *deep = [[@"" stringByPaddingToLength:513 withString:@"[" startingAtIndex:0]
+            stringByAppendingString:[@"" stringByPaddingToLength:513 withString:@"]" startingAtIndex:0]];
+    NSString *allowed = [deep substringWithRange:NSMakeRange(1, [deep length] - 2)];
+    NSError *error = nil;
+
+    GHAssertNil([self parseByteByByte:deep error:&error], nil);
+    GHAssertNotNil(error, nil);
+    GHAssertNotNil([self parseByteByByte:allowed error:nil], nil);
+}
+@end
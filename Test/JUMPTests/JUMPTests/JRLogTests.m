@@ -0,0 +1,148 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "debug_log.h"
+
+@interface JRLogTests : GHTestCase
+@property(nonatomic) NSMutableArray *messages;
+@end
+
+@implementation JRLogTests
+
+- (void)setUp
+{
+    NSMutableArray *messages = [NSMutableArray array];
+    self.messages = messages;
+    JRLogSetSink(^(JRLogLevel level, NSString *message) {
+        [messages addObject:message];
+    });
+    JRLogSetLevel(JRLogLevelDebug);
+}
+
+- (void)tearDown
+{
+    JRLogFlush();
+    JRLogSetSink(nil);
+    JRLogSetLevel((JRLogLevel) JR_LOG_LEVEL);
+}
+
+- (void)test_a100_messagesReachTheSinkInOrder
+{
+    for (int i = 0; i < 10; i++)
+        JRLogInfo(@"message %d", i);
+    JRLogFlush();
+
+    GHAssertEquals([self.messages count], (NSUInteger) 10, nil);
+    GHAssertTrue([[self.messages objectAtIndex:0] hasSuffix:@"message 0"], nil);
+    GHAssertTrue([[self.messages lastObject] hasSuffix:@"message 9"], nil);
+}
+
+- (void)test_a101_runtimeLevelFiltersWithoutEvaluatingArguments
+{
+    __block int evaluations = 0;
+    NSString *(^expensive)(void) = ^{
+        evaluations++;
+        return @"expensive";
+    };
+
+    JRLogSetLevel(JRLogLevelWarning);
+    JRLogInfo(@"%@", expensive());
+    JRLogWarning(@"%@", expensive());
+    JRLogFlush();
+
+    GHAssertEquals(evaluations, 1, nil);
+    GHAssertEquals([self.messages count], (NSUInteger) 1, nil);
+}
+
+- (void)test_a102_longMessagesAreTruncated
+{
+    NSString *longString = [@"" stringByPaddingToLength:JRLogMaxMessageLength * 2 withString:@"x" startingAtIndex:0];
+    JRLogInfo(@"%@", longString);
+    JRLogFlush();
+
+    NSString *message = [self.messages lastObject];
+    GHAssertTrue([message hasSuffix:@"..."], nil);
+    GHAssertTrue([[message componentsSeparatedByString:@"x"] count] - 1 <= JRLogMaxMessageLength, nil);
+}
+
+- (void)test_a103_overflowDropsInsteadOfBlocking
+{
+    JRLogSetSink(^(JRLogLevel level, NSString *message) {
+        [NSThread sleepForTimeInterval:0.001];
+    });
+
+    NSDate *start = [NSDate date];
+    for (int i = 0; i < 2000; i++)
+        JRLogInfo(@"flood %d", i);
+
+    GHAssertTrue([[NSDate date] timeIntervalSinceDate:start] < 1.0, nil);
+}
+
+- (void)test_a104_printfFormatsKeepWholeCharacters
+{
+    char longString[JRLogMaxMessageLength * 2 + 1];
+    for (int i = 0; i < JRLogMaxMessageLength; i++)
+        memcpy(longString + i * 2, "\xC3\xA9", 2);
+    longString[JRLogMaxMessageLength * 2] = 0;
+
+    JRLogInfo(@"%d %s", 1, longString);
+    JRLogFlush();
+
+    NSString *message = [self.messages lastObject];
+    GHAssertNotNil(message, nil);
+    GHAssertTrue([message hasSuffix:@"\u00e9..."], nil);
+    GHAssertTrue([message rangeOfString:@"[Line "].location != NSNotFound, nil);
+}
+
+- (void)test_b100_payloadSecretsAreRedacted
+{
+    NSString *form = JRLogRedactedPayload(@"client_id=abc&access_token=s3cret&traditionalSignIn_password=hunter2");
+    GHAssertEqualStrings(form, @"client_id=abc&access_token=<redacted>&traditionalSignIn_password=<redacted>", nil);
+
+    NSData *json = [@"{\"stat\":\"ok\",\"refresh_secret\":\"abcdef\"}" dataUsingEncoding:NSUTF8StringEncoding];
+    GHAssertEqualStrings(JRLogRedactedPayload(json), @"{\"stat\":\"ok\",\"refresh_secret\":\"<redacted>\"}", nil);
+
+    GHAssertEqualStrings(JRLogRedactedPayload(@"activity=x&device_token=abc123&provider=facebook"),
+                         @"activity=x&device_token=<redacted>&provider=facebook", nil);
+
+    GHAssertEqualStrings(JRLogRedactedPayload(@"error_code=503"), @"error_code=503", nil);
+}
+
+- (void)test_b101_payloadsAreTruncated
+{
+    NSString *big = [@"" stringByPaddingToLength:JRLogMaxPayloadLength * 10 withString:@"y" startingAtIndex:0];
+    NSString *logged = JRLogRedactedPayload(big);
+
+    GHAssertTrue([logged length] < JRLogMaxPayloadLength + 40, nil);
+    GHAssertTrue([logged hasSuffix:@"(3840 characters)"], nil);
+}
+@end
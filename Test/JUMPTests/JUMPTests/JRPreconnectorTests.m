@@ -0,0 +1,145 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRPreconnector.h"
+#import "JRStandInServer.h"
+#import "JRStandInURLProtocol.h"
+
+@interface JRPreconnectorTests : GHTestCase
+@property(nonatomic) JRStandInServer *server;
+@property(nonatomic) NSURLSession *session;
+@property(nonatomic) JRPreconnector *preconnector;
+@end
+
+@implementation JRPreconnectorTests
+@synthesize server;
+@synthesize session;
+@synthesize preconnector;
+
+- (BOOL)shouldRunOnMainThread
+{
+    return YES;
+}
+
+- (void)setUp
+{
+    self.server = [JRStandInServer serverWithDefaultRoutes];
+    [JRStandInURLProtocol setServer:self.server];
+    [JRStandInURLProtocol setForwardingBaseURL:nil];
+
+    self.session = [NSURLSession sessionWithConfiguration:[JRStandInURLProtocol sessionConfiguration]];
+    self.preconnector = [[JRPreconnector alloc] initWithSession:self.session];
+}
+
+- (void)tearDown
+{
+    self.preconnector.enabled = NO;
+    self.preconnector = nil;
+    [self.session invalidateAndCancel];
+    [JRStandInURLProtocol setServer:nil];
+}
+
+- (NSUInteger)headRequestCount
+{
+    NSUInteger count = 0;
+    for (NSDictionary *entry in [self.server requestLog])
+        if ([[entry objectForKey:@"method"] isEqualToString:@"HEAD"]) count++;
+
+    return count;
+}
+
+/* The warm-ups complete on the main queue, so spin the run loop until the stand-in has seen them */
+- (void)waitForHeadRequestCount:(NSUInteger)count
+{
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:5.0];
+    while ([self headRequestCount] < count && [deadline timeIntervalSinceNow] > 0)
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.05]];
+
+    /* Let the completion handlers clear the in-flight state */
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+}
+
+- (void)test_a100_originsAreNormalized
+{
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://Standin.JanrainCapture.com/oauth/auth_native"]];
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://standin.janraincapture.com:443/entity"]];
+    [self.preconnector addUrl:[NSURL URLWithString:@"http://rpxnow.com"]];
+    [self.preconnector addUrl:[NSURL URLWithString:@"janrain://not-http"]];
+    [self.preconnector addUrl:nil];
+
+    NSSet *expected = [NSSet setWithObjects:@"https://standin.janraincapture.com:443", @"http://rpxnow.com:80", nil];
+    GHAssertEqualObjects([self.preconnector origins], expected, nil);
+}
+
+- (void)test_a101_nothingIsRequestedUntilEnabled
+{
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://standin.janraincapture.com/oauth/auth_native"]];
+    [self.preconnector rewarmAll];
+    GHAssertEquals([self.preconnector warmCount], (NSUInteger) 0, nil);
+
+    self.preconnector.enabled = YES;
+    [self waitForHeadRequestCount:1];
+
+    GHAssertEquals([self.preconnector warmCount], (NSUInteger) 1, nil);
+    GHAssertEquals([self headRequestCount], (NSUInteger) 1, nil);
+    GHAssertEqualStrings([[[self.server requestLog] lastObject] objectForKey:@"path"], @"/", nil);
+}
+
+- (void)test_a102_recentlyWarmedOriginsAreSkipped
+{
+    self.preconnector.enabled = YES;
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://standin.janraincapture.com/oauth/auth_native"]];
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://standin.janraincapture.com/entity"]];
+    [self waitForHeadRequestCount:1];
+
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://standin.janraincapture.com/entity"]];
+    GHAssertEquals([self.preconnector warmCount], (NSUInteger) 1, nil);
+
+    /* A network change warms everything again regardless */
+    [self.preconnector rewarmAll];
+    [self waitForHeadRequestCount:2];
+    GHAssertEquals([self.preconnector warmCount], (NSUInteger) 2, nil);
+}
+
+- (void)test_a103_staleOriginsAreWarmedAgain
+{
+    self.preconnector.enabled = YES;
+    self.preconnector.warmInterval = 0;
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://standin.janraincapture.com/oauth/auth_native"]];
+    [self waitForHeadRequestCount:1];
+
+    [self.preconnector addUrl:[NSURL URLWithString:@"https://standin.janraincapture.com/oauth/auth_native"]];
+    [self waitForHeadRequestCount:2];
+    GHAssertEquals([self headRequestCount], (NSUInteger) 2, nil);
+}
+
+@end
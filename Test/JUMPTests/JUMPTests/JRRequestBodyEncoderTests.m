@@ -0,0 +1,215 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import <zlib.h>
+#import "JRRequestBodyEncoder.h"
+
+#define ENTITY_REPLACE_URL @"https://example.janraincapture.com/entity.replace"
+
+@interface JRRequestBodyEncoderTests : GHTestCase
+@property(nonatomic) JRRequestBodyEncoder *encoder;
+@property(nonatomic) NSDictionary *largeParams;
+@end
+
+@implementation JRRequestBodyEncoderTests
+@synthesize encoder;
+@synthesize largeParams;
+
+- (void)setUp
+{
+    self.encoder = [[JRRequestBodyEncoder alloc] init];
+
+    NSMutableArray *plural = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 100; i++)
+        [plural addObject:@{@"id" : [NSNumber numberWithUnsignedInteger:i], @"name" : @"a repeated \"value\" & more"}];
+    self.largeParams = @{@"attributes" : @{@"plural" : plural}, @"access_token" : @"token"};
+}
+
+- (NSMutableURLRequest *)requestWithParams:(NSDictionary *)params
+{
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:ENTITY_REPLACE_URL]];
+    [self.encoder setBodyOfRequest:request withParams:params];
+    return request;
+}
+
+- (NSHTTPURLResponse *)responseWithStatusCode:(NSInteger)statusCode
+{
+    return [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:ENTITY_REPLACE_URL] statusCode:statusCode
+                                      HTTPVersion:@"HTTP/1.1" headerFields:nil];
+}
+
+- (NSData *)gunzip:(NSData *)data
+{
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    inflateInit2(&stream, MAX_WBITS + 16);
+
+    NSMutableData *inflated = [NSMutableData dataWithLength:[data length] * 20];
+    stream.next_in = (Bytef *) [data bytes];
+    stream.avail_in = (uInt) [data length];
+    stream.next_out = [inflated mutableBytes];
+    stream.avail_out = (uInt) [inflated length];
+
+    int status = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+    if (status != Z_STREAM_END) return nil;
+
+    [inflated setLength:stream.total_out];
+    return inflated;
+}
+
+- (void)test_a100_formBodyIsSortedAndEscaped
+{
+    NSDictionary *params = @{@"b" : @"x&y=z", @"a" : @{@"k" : @"v"}, @"c" : [NSNumber numberWithInt:3]};
+    NSString *body = [[NSString alloc] initWithData:[JRRequestBodyEncoder formBodyWithParams:params]
+                                           encoding:NSUTF8StringEncoding];
+
+    GHAssertEqualStrings(body, @"a=%7B%22k%22:%22v%22%7D&b=x%26y%3Dz&c=3", nil);
+}
+
+- (void)test_a101_plainBodyByDefault
+{
+    NSMutableURLRequest *request = [self requestWithParams:self.largeParams];
+
+    GHAssertEqualStrings([request HTTPMethod], @"POST", nil);
+    GHAssertEqualObjects([request HTTPBody], [JRRequestBodyEncoder formBodyWithParams:self.largeParams], nil);
+    GHAssertNil([request valueForHTTPHeaderField:@"Content-Encoding"], nil);
+    GHAssertNil([self.encoder fallbackRequestForRequest:request response:[self responseWithStatusCode:415]], nil);
+}
+
+- (void)test_a102_largeBodyIsCompressed
+{
+    self.encoder.compressionEnabled = YES;
+    NSMutableURLRequest *request = [self requestWithParams:self.largeParams];
+    NSData *plainBody = [JRRequestBodyEncoder formBodyWithParams:self.largeParams];
+
+    GHAssertEqualStrings([request valueForHTTPHeaderField:@"Content-Encoding"], @"gzip", nil);
+    GHAssertLessThan([[request HTTPBody] length], [plainBody length] / 3, nil);
+    GHAssertEqualObjects([self gunzip:[request HTTPBody]], plainBody, nil);
+}
+
+- (void)test_a103_smallBodyIsNotCompressed
+{
+    self.encoder.compressionEnabled = YES;
+    NSDictionary *params = @{@"access_token" : @"token"};
+    NSMutableURLRequest *request = [self requestWithParams:params];
+
+    GHAssertNil([request valueForHTTPHeaderField:@"Content-Encoding"], nil);
+    GHAssertEqualObjects([request HTTPBody], [JRRequestBodyEncoder formBodyWithParams:params], nil);
+}
+
+- (void)test_a104_jsonBodyKeepsAttributesAsObjects
+{
+    self.encoder.jsonBodiesEnabled = YES;
+    NSMutableURLRequest *request = [self requestWithParams:self.largeParams];
+    NSDictionary *sent = [NSJSONSerialization JSONObjectWithData:[request HTTPBody] options:0 error:nil];
+
+    GHAssertEqualStrings([request valueForHTTPHeaderField:@"Content-Type"], @"application/json", nil);
+    GHAssertEqualObjects(sent, self.largeParams, nil);
+}
+
+- (void)test_a105_refusedEncodingFallsBackToPlainBody
+{
+    self.encoder.compressionEnabled = YES;
+    self.encoder.jsonBodiesEnabled = YES;
+    NSMutableURLRequest *request = [self requestWithParams:self.largeParams];
+    [request setValue:@"trace" forHTTPHeaderField:@"X-Correlation-Id"];
+
+    GHAssertNil([self.encoder fallbackRequestForRequest:request response:[self responseWithStatusCode:500]], nil);
+    GHAssertFalse([self.encoder isEncodingRefusedForUrl:[request URL]], nil);
+
+    NSURLRequest *fallback = [self.encoder fallbackRequestForRequest:request
+                                                            response:[self responseWithStatusCode:415]];
+    GHAssertEqualObjects([fallback HTTPBody], [JRRequestBodyEncoder formBodyWithParams:self.largeParams], nil);
+    GHAssertNil([fallback valueForHTTPHeaderField:@"Content-Encoding"], nil);
+    GHAssertNil([fallback valueForHTTPHeaderField:@"Content-Type"], nil);
+    GHAssertEqualStrings([fallback valueForHTTPHeaderField:@"X-Correlation-Id"], @"trace", nil);
+    GHAssertTrue([self.encoder isEncodingRefusedForUrl:[request URL]], nil);
+
+    /* The plain body is final, so a second refusal has nothing to fall back to */
+    GHAssertNil([self.encoder fallbackRequestForRequest:fallback response:[self responseWithStatusCode:415]], nil);
+}
+
+- (void)test_a106_refusalIsRememberedPerEndpoint
+{
+    self.encoder.compressionEnabled = YES;
+    NSMutableURLRequest *request = [self requestWithParams:self.largeParams];
+    [self.encoder fallbackRequestForRequest:request response:[self responseWithStatusCode:415]];
+
+    NSMutableURLRequest *nextRequest = [self requestWithParams:self.largeParams];
+    GHAssertNil([nextRequest valueForHTTPHeaderField:@"Content-Encoding"], nil);
+
+    NSMutableURLRequest *update = [NSMutableURLRequest requestWithURL:
+            [NSURL URLWithString:@"https://example.janraincapture.com/entity.update"]];
+    [self.encoder setBodyOfRequest:update withParams:self.largeParams];
+    GHAssertEqualStrings([update valueForHTTPHeaderField:@"Content-Encoding"], @"gzip", nil);
+
+    [self.encoder resetRefusedEndpoints];
+    GHAssertFalse([self.encoder isEncodingRefusedForUrl:[request URL]], nil);
+}
+
+- (void)test_a107_unreadableBodyErrorFallsBack
+{
+    self.encoder.jsonBodiesEnabled = YES;
+    NSMutableURLRequest *request = [self requestWithParams:self.largeParams];
+    NSData *invalidValue = [@"{\"stat\":\"error\",\"code\":200,\"error\":\"invalid_argument\","
+                             "\"error_description\":\"email is not a valid email address\"}"
+            dataUsingEncoding:NSUTF8StringEncoding];
+    NSDictionary *unparsedAttributes = @{@"stat" : @"error", @"code" : [NSNumber numberWithInt:200],
+                                         @"error" : @"invalid_argument",
+                                         @"error_description" : @"attributes must be a JSON object"};
+    NSDictionary *missingToken = @{@"stat" : @"error", @"code" : [NSNumber numberWithInt:100],
+                                   @"error" : @"missing_argument",
+                                   @"error_description" : @"missing required argument: access_token"};
+
+    GHAssertNil([self.encoder fallbackRequestForRequest:request response:[self responseWithStatusCode:200]
+                                                   body:invalidValue], nil);
+    GHAssertNil([self.encoder fallbackRequestForRequest:request response:[self responseWithStatusCode:200]
+                                                   body:@{@"stat" : @"ok"}], nil);
+    GHAssertFalse([self.encoder isEncodingRefusedForUrl:[request URL]], nil);
+
+    NSURLRequest *fallback = [self.encoder fallbackRequestForRequest:request
+                                                            response:[self responseWithStatusCode:200]
+                                                                body:unparsedAttributes];
+    GHAssertEqualObjects([fallback HTTPBody], [JRRequestBodyEncoder formBodyWithParams:self.largeParams], nil);
+    GHAssertTrue([self.encoder isEncodingRefusedForUrl:[request URL]], nil);
+
+    [self.encoder resetRefusedEndpoints];
+    NSData *missingTokenData = [NSJSONSerialization dataWithJSONObject:missingToken options:0 error:nil];
+    GHAssertNotNil([self.encoder fallbackRequestForRequest:request response:[self responseWithStatusCode:200]
+                                                      body:missingTokenData], nil);
+
+    /* A plain body gets the error as it is */
+    GHAssertNil([self.encoder fallbackRequestForRequest:fallback response:[self responseWithStatusCode:200]
+                                                   body:missingToken], nil);
+}
+@end
@@ -0,0 +1,116 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRRequestMetrics.h"
+#import "NSMutableURLRequest+JRRequestUtils.h"
+
+@interface JRRecordingMetricsObserver : NSObject <JRRequestMetricsObserver>
+@property(nonatomic) NSMutableArray *seen;
+@end
+
+@implementation JRRecordingMetricsObserver
+- (id)init
+{
+    if ((self = [super init]))
+        _seen = [NSMutableArray array];
+
+    return self;
+}
+
+- (void)requestDidFinishWithMetrics:(JRRequestMetrics *)metrics
+{
+    [self.seen addObject:metrics];
+}
+@end
+
+@interface JRRequestMetricsTests : GHTestCase
+@property(nonatomic) JRRequestMetricsCollector *collector;
+@end
+
+@implementation JRRequestMetricsTests
+
+- (void)setUp
+{
+    self.collector = [[JRRequestMetricsCollector alloc] init];
+}
+
+- (JRRequestMetrics *)metricsForOperation:(NSString *)operationName duration:(NSTimeInterval)duration
+{
+    JRRequestMetrics *metrics = [[JRRequestMetrics alloc] init];
+    metrics.operationName = operationName;
+    metrics.totalDuration = duration;
+    return metrics;
+}
+
+- (void)test_a100_operationName
+{
+    NSMutableURLRequest *request =
+            [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://x.janraincapture.com/entity.update"]];
+    GHAssertEqualStrings([request JR_operationName], @"entity.update", nil);
+
+    [request JR_setOperationName:@"profile"];
+    GHAssertEqualStrings([[request copy] JR_operationName], @"profile", nil);
+}
+
+- (void)test_a101_histogramBuckets
+{
+    [self.collector recordMetrics:[self metricsForOperation:@"entity" duration:0.01]];
+    [self.collector recordMetrics:[self metricsForOperation:@"entity" duration:0.3]];
+    [self.collector recordMetrics:[self metricsForOperation:@"entity" duration:60]];
+    [self.collector recordMetrics:[self metricsForOperation:@"flow" duration:0.3]];
+
+    NSDictionary *entity = [[self.collector histogramSnapshot] objectForKey:@"entity"];
+    NSArray *histogram = [entity objectForKey:@"histogram"];
+    GHAssertEquals([[entity objectForKey:@"count"] unsignedIntegerValue], (NSUInteger) 3, nil);
+    GHAssertEquals([histogram count], [[JRRequestMetricsCollector histogramBucketBounds] count] + 1, nil);
+    GHAssertEquals([[histogram objectAtIndex:0] unsignedIntegerValue], (NSUInteger) 1, nil);
+    GHAssertEquals([[histogram objectAtIndex:3] unsignedIntegerValue], (NSUInteger) 1, nil);
+    GHAssertEquals([[histogram lastObject] unsignedIntegerValue], (NSUInteger) 1, nil);
+    GHAssertEqualsWithAccuracy([[entity objectForKey:@"totalDuration"] doubleValue], 60.31, 0.0001, nil);
+
+    [self.collector resetHistograms];
+    GHAssertEquals([[self.collector histogramSnapshot] count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a102_observers
+{
+    JRRecordingMetricsObserver *observer = [[JRRecordingMetricsObserver alloc] init];
+    [self.collector addObserver:observer];
+    [self.collector recordMetrics:[self metricsForOperation:@"config" duration:0.2]];
+    GHAssertEquals([observer.seen count], (NSUInteger) 1, nil);
+    GHAssertEqualStrings([[observer.seen lastObject] operationName], @"config", nil);
+
+    [self.collector removeObserver:observer];
+    [self.collector recordMetrics:[self metricsForOperation:@"config" duration:0.2]];
+    GHAssertEquals([observer.seen count], (NSUInteger) 1, nil);
+}
+@end
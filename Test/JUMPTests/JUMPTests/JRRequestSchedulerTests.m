@@ -0,0 +1,151 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRRequestScheduler.h"
+
+/* Stands in for an NSURLSessionTask, the scheduler only ever resumes them */
+@interface JRFakeSessionTask : NSObject
+@property(nonatomic) BOOL resumed;
+@end
+
+@implementation JRFakeSessionTask
+- (void)resume
+{
+    self.resumed = YES;
+}
+
+- (NSURLRequest *)originalRequest
+{
+    return nil;
+}
+@end
+
+@interface JRRequestSchedulerTests : GHTestCase
+@property(nonatomic) JRRequestScheduler *scheduler;
+@end
+
+@implementation JRRequestSchedulerTests
+
+- (void)setUp
+{
+    self.scheduler = [[JRRequestScheduler alloc] init];
+}
+
+- (JRFakeSessionTask *)scheduleWithPriority:(JRConnectionPriority)priority
+{
+    JRFakeSessionTask *task = [[JRFakeSessionTask alloc] init];
+    [self.scheduler scheduleTask:(NSURLSessionTask *) task withPriority:priority];
+    return task;
+}
+
+- (void)complete:(JRFakeSessionTask *)task
+{
+    [self.scheduler taskDidComplete:(NSURLSessionTask *) task];
+}
+
+- (void)test_a100_criticalAndNormalStartRightAway
+{
+    GHAssertTrue([self scheduleWithPriority:JRConnectionPriorityCritical].resumed, nil);
+    GHAssertTrue([self scheduleWithPriority:JRConnectionPriorityNormal].resumed, nil);
+    GHAssertTrue([self.scheduler isCriticalPathActive], nil);
+}
+
+- (void)test_a101_backgroundWaitsForCriticalPath
+{
+    JRFakeSessionTask *critical = [self scheduleWithPriority:JRConnectionPriorityCritical];
+    JRFakeSessionTask *background = [self scheduleWithPriority:JRConnectionPriorityBackground];
+    GHAssertFalse(background.resumed, nil);
+
+    [self complete:critical];
+    GHAssertFalse([self.scheduler isCriticalPathActive], nil);
+    GHAssertTrue(background.resumed, nil);
+}
+
+- (void)test_a102_backgroundConcurrencyIsCapped
+{
+    self.scheduler.maxConcurrentBackgroundTasks = 2;
+    JRFakeSessionTask *first = [self scheduleWithPriority:JRConnectionPriorityBackground];
+    JRFakeSessionTask *second = [self scheduleWithPriority:JRConnectionPriorityBackground];
+    JRFakeSessionTask *third = [self scheduleWithPriority:JRConnectionPriorityBackground];
+    GHAssertTrue(first.resumed && second.resumed, nil);
+    GHAssertFalse(third.resumed, nil);
+
+    [self complete:first];
+    GHAssertTrue(third.resumed, nil);
+}
+
+- (void)test_a103_cancelledWaitingTaskIsDropped
+{
+    JRFakeSessionTask *critical = [self scheduleWithPriority:JRConnectionPriorityCritical];
+    JRFakeSessionTask *background = [self scheduleWithPriority:JRConnectionPriorityBackground];
+    [self complete:background];
+    [self complete:critical];
+    GHAssertFalse(background.resumed, nil);
+}
+
+- (void)test_a104_queueingDelayIsReportedPerClass
+{
+    JRFakeSessionTask *critical = [self scheduleWithPriority:JRConnectionPriorityCritical];
+    [self scheduleWithPriority:JRConnectionPriorityBackground];
+    [NSThread sleepForTimeInterval:0.05];
+    [self complete:critical];
+
+    NSDictionary *snapshot = [self.scheduler queueingDelaySnapshot];
+    GHAssertEquals([[[snapshot objectForKey:@"critical"] objectForKey:@"count"] unsignedIntegerValue], (NSUInteger) 1, nil);
+    GHAssertEquals([[[snapshot objectForKey:@"background"] objectForKey:@"count"] unsignedIntegerValue], (NSUInteger) 1, nil);
+    GHAssertTrue([[[snapshot objectForKey:@"background"] objectForKey:@"maxDelay"] doubleValue] >= 0.05, nil);
+    GHAssertTrue([[[snapshot objectForKey:@"critical"] objectForKey:@"maxDelay"] doubleValue] < 0.05, nil);
+
+    [self.scheduler resetQueueingDelays];
+    snapshot = [self.scheduler queueingDelaySnapshot];
+    GHAssertEquals([[[snapshot objectForKey:@"background"] objectForKey:@"count"] unsignedIntegerValue], (NSUInteger) 0, nil);
+}
+
+- (void)test_a105_criticalRetryHoldsBackgroundThroughBackoff
+{
+    JRFakeSessionTask *critical = [self scheduleWithPriority:JRConnectionPriorityCritical];
+    JRFakeSessionTask *background = [self scheduleWithPriority:JRConnectionPriorityBackground];
+
+    [self.scheduler beginRetryWithPriority:JRConnectionPriorityCritical];
+    [self complete:critical];
+    GHAssertTrue([self.scheduler isCriticalPathActive], nil);
+    GHAssertFalse(background.resumed, nil);
+
+    JRFakeSessionTask *retry = [self scheduleWithPriority:JRConnectionPriorityCritical];
+    [self.scheduler endRetryWithPriority:JRConnectionPriorityCritical];
+    GHAssertTrue(retry.resumed, nil);
+    GHAssertFalse(background.resumed, nil);
+
+    [self complete:retry];
+    GHAssertTrue(background.resumed, nil);
+}
+@end
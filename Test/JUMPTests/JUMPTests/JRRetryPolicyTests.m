@@ -0,0 +1,226 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRRetryPolicy.h"
+#import "JRConnectionManager.h"
+
+static NSUInteger failuresRemaining = 0;
+static NSUInteger requestsSeen = 0;
+
+/* Answers every request to jr-retry-test://, with a 503 until failuresRemaining runs out and a 200 after that */
+@interface JRFlakyURLProtocol : NSURLProtocol
+@end
+
+@implementation JRFlakyURLProtocol
++ (BOOL)canInitWithRequest:(NSURLRequest *)request
+{
+    return [[[request URL] scheme] isEqualToString:@"jr-retry-test"];
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request
+{
+    return request;
+}
+
+- (void)startLoading
+{
+    requestsSeen++;
+    NSInteger statusCode = 200;
+    if (failuresRemaining > 0)
+    {
+        failuresRemaining--;
+        statusCode = 503;
+    }
+
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[[self request] URL] statusCode:statusCode
+                                                             HTTPVersion:@"HTTP/1.1" headerFields:nil];
+    [[self client] URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [[self client] URLProtocol:self didLoadData:[@"{}" dataUsingEncoding:NSUTF8StringEncoding]];
+    [[self client] URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading
+{
+}
+@end
+
+@interface JRRetryPolicyTests : GHAsyncTestCase
+@property(nonatomic) NSMutableURLRequest *getRequest;
+@property(nonatomic) NSMutableURLRequest *postRequest;
+@end
+
+@implementation JRRetryPolicyTests
+
+- (void)setUpClass
+{
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration defaultSessionConfiguration];
+    configuration.protocolClasses = [NSArray arrayWithObject:[JRFlakyURLProtocol class]];
+    [JRConnectionManager setSessionConfiguration:configuration];
+}
+
+- (void)tearDownClass
+{
+    [JRConnectionManager setSessionConfiguration:[NSURLSessionConfiguration defaultSessionConfiguration]];
+}
+
+- (void)setUp
+{
+    self.getRequest = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"jr-retry-test://host/entity"]];
+    self.postRequest = [self.getRequest mutableCopy];
+    [self.postRequest setHTTPMethod:@"POST"];
+    failuresRemaining = 0;
+    requestsSeen = 0;
+    [JRConnectionManager resetRetryCounters];
+}
+
+- (NSHTTPURLResponse *)responseWithStatusCode:(NSInteger)statusCode
+{
+    return [[NSHTTPURLResponse alloc] initWithURL:[self.getRequest URL] statusCode:statusCode HTTPVersion:@"HTTP/1.1"
+                                     headerFields:nil];
+}
+
+- (JRRetryPolicy *)fastPolicy
+{
+    JRRetryPolicy *policy = [JRRetryPolicy defaultPolicy];
+    policy.initialBackoff = 0.01;
+    policy.jitter = 0;
+    return policy;
+}
+
+- (void)test_a100_statusCodeClassification
+{
+    JRRetryPolicy *policy = [JRRetryPolicy defaultPolicy];
+    GHAssertTrue([policy isRetryableFailureOfRequest:self.getRequest response:[self responseWithStatusCode:503]
+                                               error:nil], nil);
+    GHAssertTrue([policy isRetryableFailureOfRequest:self.getRequest response:[self responseWithStatusCode:429]
+                                               error:nil], nil);
+    GHAssertFalse([policy isRetryableFailureOfRequest:self.getRequest response:[self responseWithStatusCode:404]
+                                                error:nil], nil);
+    GHAssertFalse([policy isRetryableFailureOfRequest:self.getRequest response:[self responseWithStatusCode:200]
+                                                error:nil], nil);
+}
+
+- (void)test_a101_errorClassification
+{
+    JRRetryPolicy *policy = [JRRetryPolicy defaultPolicy];
+    NSError *timedOut = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil];
+    NSError *cancelled = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCancelled userInfo:nil];
+    GHAssertTrue([policy isRetryableFailureOfRequest:self.getRequest response:nil error:timedOut], nil);
+    GHAssertFalse([policy isRetryableFailureOfRequest:self.getRequest response:nil error:cancelled], nil);
+}
+
+- (void)test_a102_idempotentOnly
+{
+    NSHTTPURLResponse *unavailable = [self responseWithStatusCode:503];
+    GHAssertFalse([[JRRetryPolicy defaultPolicy] isRetryableFailureOfRequest:self.postRequest response:unavailable
+                                                                        error:nil], nil);
+    GHAssertTrue([[JRRetryPolicy idempotentPostPolicy] isRetryableFailureOfRequest:self.postRequest
+                                                                          response:unavailable error:nil], nil);
+}
+
+- (void)test_a103_attemptLimit
+{
+    JRRetryPolicy *policy = [JRRetryPolicy defaultPolicy];
+    NSHTTPURLResponse *unavailable = [self responseWithStatusCode:503];
+    GHAssertTrue([policy shouldRetryRequest:self.getRequest response:unavailable error:nil attempt:1], nil);
+    GHAssertTrue([policy shouldRetryRequest:self.getRequest response:unavailable error:nil attempt:2], nil);
+    GHAssertFalse([policy shouldRetryRequest:self.getRequest response:unavailable error:nil attempt:3], nil);
+    GHAssertFalse([[JRRetryPolicy noRetryPolicy] shouldRetryRequest:self.getRequest response:unavailable error:nil
+                                                             attempt:1], nil);
+}
+
+- (void)test_a104_backoffIsBoundedAndJittered
+{
+    JRRetryPolicy *policy = [JRRetryPolicy defaultPolicy];
+    for (int i = 0; i < 100; i++)
+    {
+        NSTimeInterval first = [policy delayBeforeRetryAfterAttempt:1];
+        GHAssertTrue(first > 0.25 - 0.0001 && first <= 0.5, nil);
+
+        NSTimeInterval late = [policy delayBeforeRetryAfterAttempt:20];
+        GHAssertTrue(late >= policy.maxBackoff * 0.5 - 0.0001 && late <= policy.maxBackoff, nil);
+    }
+
+    policy.jitter = 0;
+    GHAssertEquals([policy delayBeforeRetryAfterAttempt:3], 2.0, nil);
+}
+
+- (void)test_b100_retriesUntilSuccess
+{
+    [self prepare];
+    failuresRemaining = 2;
+
+    [JRConnectionManager startDataTaskWithRequest:self.getRequest retryPolicy:[self fastPolicy]
+                                completionHandler:^(NSData *data, NSURLResponse *response, NSError *e) {
+        GHAssertEquals([(NSHTTPURLResponse *) response statusCode], (NSInteger) 200, nil);
+        GHAssertEquals(requestsSeen, (NSUInteger) 3, nil);
+        GHAssertEquals([JRConnectionManager retryCount], (NSUInteger) 2, nil);
+        GHAssertEquals([JRConnectionManager retryGiveUpCount], (NSUInteger) 0, nil);
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+}
+
+- (void)test_b101_givesUpAfterMaxAttempts
+{
+    [self prepare];
+    failuresRemaining = 10;
+
+    [JRConnectionManager startDataTaskWithRequest:self.getRequest retryPolicy:[self fastPolicy]
+                                completionHandler:^(NSData *data, NSURLResponse *response, NSError *e) {
+        GHAssertEquals([(NSHTTPURLResponse *) response statusCode], (NSInteger) 503, nil);
+        GHAssertEquals(requestsSeen, (NSUInteger) 3, nil);
+        GHAssertEquals([JRConnectionManager retryCount], (NSUInteger) 2, nil);
+        GHAssertEquals([JRConnectionManager retryGiveUpCount], (NSUInteger) 1, nil);
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+}
+
+- (void)test_b102_nonIdempotentPostIsNotRetried
+{
+    [self prepare];
+    failuresRemaining = 1;
+
+    [JRConnectionManager startDataTaskWithRequest:self.postRequest retryPolicy:[self fastPolicy]
+                                completionHandler:^(NSData *data, NSURLResponse *response, NSError *e) {
+        GHAssertEquals([(NSHTTPURLResponse *) response statusCode], (NSInteger) 503, nil);
+        GHAssertEquals(requestsSeen, (NSUInteger) 1, nil);
+        GHAssertEquals([JRConnectionManager retryCount], (NSUInteger) 0, nil);
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+}
+@end
@@ -0,0 +1,156 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRSessionStore.h"
+
+static NSString *const JRTestSuiteName = @"com.janrain.test.sessionStore";
+
+@interface JRSessionStoreTests : GHAsyncTestCase
+@property(nonatomic) NSUserDefaults *defaults;
+@property(nonatomic) JRSessionStore *store;
+@end
+
+@implementation JRSessionStoreTests
+@synthesize defaults;
+@synthesize store;
+
+- (void)setUp
+{
+    [[NSUserDefaults standardUserDefaults] removePersistentDomainForName:JRTestSuiteName];
+    self.defaults = [[NSUserDefaults alloc] initWithSuiteName:JRTestSuiteName];
+    self.store = [[JRSessionStore alloc] initWithUserDefaults:self.defaults];
+}
+
+- (void)tearDown
+{
+    [self.store flush];
+    [[NSUserDefaults standardUserDefaults] removePersistentDomainForName:JRTestSuiteName];
+}
+
+- (void)test_a100_writesAreDeferredButVisibleThroughTheStore
+{
+    [self.store setObject:@"facebook" forKey:@"lastUsed"];
+    [self.store setBool:YES forKey:@"hidePoweredBy"];
+
+    GHAssertNil([self.defaults objectForKey:@"lastUsed"], nil);
+    GHAssertTrue([self.store hasPendingChanges], nil);
+    GHAssertEqualStrings([self.store stringForKey:@"lastUsed"], @"facebook", nil);
+    GHAssertTrue([self.store boolForKey:@"hidePoweredBy"], nil);
+
+    GHAssertEquals([self.store flush], (NSUInteger) 2, nil);
+    GHAssertFalse([self.store hasPendingChanges], nil);
+    GHAssertEqualStrings([self.defaults stringForKey:@"lastUsed"], @"facebook", nil);
+    GHAssertTrue([self.defaults boolForKey:@"hidePoweredBy"], nil);
+}
+
+- (void)test_a101_repeatedWritesCoalesce
+{
+    [self.store setObject:@"twitter" forKey:@"lastUsed"];
+    [self.store setObject:@"linkedin" forKey:@"lastUsed"];
+    [self.store setObject:@"google" forKey:@"lastUsed"];
+
+    GHAssertEquals([self.store flush], (NSUInteger) 1, nil);
+    GHAssertEqualStrings([self.defaults stringForKey:@"lastUsed"], @"google", nil);
+}
+
+- (void)test_a102_unchangedValuesAreNotWritten
+{
+    NSArray *providers = [NSArray arrayWithObjects:@"facebook", @"twitter", nil];
+    [self.store setObject:providers forKey:@"sharingProviders"];
+    [self.store setBool:NO forKey:@"hidePoweredBy"];
+    GHAssertEquals([self.store flush], (NSUInteger) 2, nil);
+
+    /* The same configuration again */
+    [self.store setObject:[providers mutableCopy] forKey:@"sharingProviders"];
+    [self.store setBool:NO forKey:@"hidePoweredBy"];
+    [self.store removeObjectForKey:@"neverWritten"];
+    GHAssertEquals([self.store flush], (NSUInteger) 0, nil);
+}
+
+- (void)test_a103_archivedObjectsAreArchivedAtFlushTime
+{
+    NSMutableDictionary *users = [NSMutableDictionary dictionary];
+    [self.store setArchivedObject:users forKey:@"users"];
+    [users setObject:@"jane" forKey:@"facebook"];
+
+    GHAssertEquals([self.store unarchivedObjectForKey:@"users"], users, nil);
+    GHAssertEquals([self.store flush], (NSUInteger) 1, nil);
+
+    NSDictionary *stored = [NSKeyedUnarchiver unarchiveObjectWithData:[self.defaults objectForKey:@"users"]];
+    GHAssertEqualObjects(stored, [NSDictionary dictionaryWithObject:@"jane" forKey:@"facebook"], nil);
+
+    /* Archived data that hasn't changed isn't rewritten */
+    [self.store setArchivedObject:users forKey:@"users"];
+    GHAssertEquals([self.store flush], (NSUInteger) 0, nil);
+
+    JRSessionStore *freshStore = [[JRSessionStore alloc] initWithUserDefaults:self.defaults];
+    GHAssertEqualObjects([freshStore unarchivedObjectForKey:@"users"], stored, nil);
+}
+
+- (void)test_a104_nilAndRemovalDeleteTheKey
+{
+    [self.defaults setObject:@"etag" forKey:@"etag"];
+    [self.defaults setObject:@"url" forKey:@"baseUrl"];
+
+    [self.store setObject:nil forKey:@"etag"];
+    [self.store removeObjectForKey:@"baseUrl"];
+    GHAssertNil([self.store objectForKey:@"etag"], nil);
+    GHAssertNil([self.store stringForKey:@"baseUrl"], nil);
+
+    GHAssertEquals([self.store flush], (NSUInteger) 2, nil);
+    GHAssertNil([self.defaults objectForKey:@"etag"], nil);
+    GHAssertNil([self.defaults objectForKey:@"baseUrl"], nil);
+}
+
+- (void)test_a105_flushesOnTheNextRunLoopTurn
+{
+    [self.store setObject:@"yahoo" forKey:@"lastUsed"];
+    GHAssertNil([self.defaults objectForKey:@"lastUsed"], nil);
+
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:2.0];
+    while (![self.defaults objectForKey:@"lastUsed"] && [deadline timeIntervalSinceNow] > 0)
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+
+    GHAssertEqualStrings([self.defaults stringForKey:@"lastUsed"], @"yahoo", nil);
+    GHAssertFalse([self.store hasPendingChanges], nil);
+}
+
+- (void)test_a106_backgroundingFlushes
+{
+    [self.store setObject:@"paypal" forKey:@"lastUsed"];
+
+    [[NSNotificationCenter defaultCenter] postNotificationName:UIApplicationDidEnterBackgroundNotification
+                                                        object:nil];
+
+    GHAssertEqualStrings([self.defaults stringForKey:@"lastUsed"], @"paypal", nil);
+}
+@end
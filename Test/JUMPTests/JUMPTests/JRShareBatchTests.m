@@ -0,0 +1,273 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <objc/runtime.h>
+#import <GHUnitIOS/GHUnit.h>
+#import "JRSessionData.h"
+#import "JRActivityObject.h"
+#import "JRConnectionManager.h"
+
+/* MAX_CONCURRENT_SHARES in JRSessionData.m */
+#define JRTestMaxConcurrentShares 4
+
+static NSUInteger sharesInFlight = 0;
+static NSUInteger maxSharesInFlight = 0;
+static NSMutableDictionary *activityContentByProvider = nil;
+static NSUInteger dictionaryForObjectCalls = 0;
+
+@interface JRAuthenticatedUser (JRShareBatchTests)
+- (id)initUserWithDictionary:(NSDictionary *)dictionary andWelcomeString:(NSString *)welcomeString
+            forProviderNamed:(NSString *)providerName;
+@end
+
+@interface JRActivityObject (JRShareBatchTests)
+- (NSMutableDictionary *)JR_countedDictionaryForObject;
+@end
+
+@implementation JRActivityObject (JRShareBatchTests)
+/* Swapped in for dictionaryForObject, so calling it calls the original */
+- (NSMutableDictionary *)JR_countedDictionaryForObject
+{
+    dictionaryForObjectCalls++;
+    return [self JR_countedDictionaryForObject];
+}
+@end
+
+/* Answers every request on the connection manager's session. Shares are held for a moment, so they overlap, and fail
+   for myspace; anything else, like the configuration call, gets an empty body. */
+@interface JRShareURLProtocol : NSURLProtocol
+@end
+
+@implementation JRShareURLProtocol
++ (BOOL)canInitWithRequest:(NSURLRequest *)request
+{
+    return YES;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request
+{
+    return request;
+}
+
++ (NSDictionary *)formOfRequest:(NSURLRequest *)request
+{
+    NSData *body = [request HTTPBody];
+    if (!body && [request HTTPBodyStream])
+    {
+        NSMutableData *streamed = [NSMutableData data];
+        NSInputStream *stream = [request HTTPBodyStream];
+        uint8_t buffer[4096];
+        [stream open];
+        for (NSInteger read; (read = [stream read:buffer maxLength:sizeof(buffer)]) > 0; )
+            [streamed appendBytes:buffer length:(NSUInteger) read];
+        [stream close];
+        body = streamed;
+    }
+
+    NSMutableDictionary *form = [NSMutableDictionary dictionary];
+    NSString *bodyString = [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding];
+    for (NSString *pair in [bodyString componentsSeparatedByString:@"&"])
+    {
+        NSRange equals = [pair rangeOfString:@"="];
+        if (equals.location != NSNotFound)
+            [form setObject:[pair substringFromIndex:NSMaxRange(equals)] forKey:[pair substringToIndex:equals.location]];
+    }
+
+    return form;
+}
+
+- (void)respondWithString:(NSString *)string
+{
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[[self request] URL] statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1" headerFields:nil];
+    [[self client] URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [[self client] URLProtocol:self didLoadData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+    [[self client] URLProtocolDidFinishLoading:self];
+}
+
+- (void)startLoading
+{
+    if (![[[[self request] URL] path] hasSuffix:@"/api/v2/activity"])
+    {
+        [self respondWithString:@""];
+        return;
+    }
+
+    NSDictionary *form = [JRShareURLProtocol formOfRequest:[self request]];
+    NSString *provider = [form objectForKey:@"provider"];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [activityContentByProvider setObject:[form objectForKey:@"activity"] forKey:provider];
+        sharesInFlight++;
+        maxSharesInFlight = MAX(maxSharesInFlight, sharesInFlight);
+    });
+
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) (0.05 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        sharesInFlight--;
+        if ([provider isEqualToString:@"myspace"])
+            [self respondWithString:@"{\"stat\":\"fail\",\"err\":{\"msg\":\"nope\",\"code\":0}}"];
+        else
+            [self respondWithString:@"{\"stat\":\"ok\"}"];
+    });
+}
+
+- (void)stopLoading
+{
+}
+@end
+
+@interface JRShareBatchTests : GHAsyncTestCase
+@property(nonatomic) JRSessionData *sessionData;
+@property(nonatomic) NSMutableArray *completions;
+@end
+
+@implementation JRShareBatchTests
+
+- (void)setUpClass
+{
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = [NSArray arrayWithObject:[JRShareURLProtocol class]];
+    [JRConnectionManager setSessionConfiguration:configuration];
+
+    method_exchangeImplementations(
+            class_getInstanceMethod([JRActivityObject class], @selector(dictionaryForObject)),
+            class_getInstanceMethod([JRActivityObject class], @selector(JR_countedDictionaryForObject)));
+}
+
+- (void)tearDownClass
+{
+    method_exchangeImplementations(
+            class_getInstanceMethod([JRActivityObject class], @selector(dictionaryForObject)),
+            class_getInstanceMethod([JRActivityObject class], @selector(JR_countedDictionaryForObject)));
+
+    [JRConnectionManager setSessionConfiguration:[NSURLSessionConfiguration defaultSessionConfiguration]];
+}
+
+- (void)setUp
+{
+    self.sessionData = [JRSessionData jrSessionDataWithAppId:@"appId" tokenUrl:nil andDelegate:nil];
+    self.completions = [NSMutableArray array];
+
+    JRActivityObject *activity = [[JRActivityObject alloc] initWithAction:@"shared" andUrl:@"http://example.com/"];
+    activity.resourceDescription = [@"" stringByPaddingToLength:400 withString:@"d" startingAtIndex:0];
+    self.sessionData.activity = activity;
+
+    sharesInFlight = 0;
+    maxSharesInFlight = 0;
+    activityContentByProvider = [NSMutableDictionary dictionary];
+    dictionaryForObjectCalls = 0;
+}
+
+- (NSArray *)usersForProviders:(NSArray *)providerNames
+{
+    NSMutableArray *users = [NSMutableArray array];
+    for (NSString *providerName in providerNames)
+    {
+        NSDictionary *dictionary = [NSDictionary dictionaryWithObject:[providerName stringByAppendingString:@"-token"]
+                                                               forKey:@"device_token"];
+        [users addObject:[[JRAuthenticatedUser alloc] initUserWithDictionary:dictionary andWelcomeString:nil
+                                                            forProviderNamed:providerName]];
+    }
+
+    return users;
+}
+
+- (void)test_a100_emptyBatchCompletesOnce
+{
+    [self.sessionData shareActivityForUsers:[NSArray array] completion:^(NSDictionary *resultsByProvider)
+    {
+        [self.completions addObject:resultsByProvider];
+    }];
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+
+    GHAssertEquals([self.completions count], (NSUInteger) 1, nil);
+    GHAssertEquals([[self.completions lastObject] count], (NSUInteger) 0, nil);
+    GHAssertEquals(dictionaryForObjectCalls, (NSUInteger) 0, nil);
+}
+
+- (void)test_a101_sharesAreBoundedAndCompleteOnce
+{
+    [self prepare];
+
+    NSArray *providers = [NSArray arrayWithObjects:@"facebook", @"twitter", @"linkedin", @"myspace", @"yahoo",
+                                                   @"google", @"tumblr", nil];
+    [self.sessionData shareActivityForUsers:[self usersForProviders:providers]
+                                 completion:^(NSDictionary *resultsByProvider)
+    {
+        [self.completions addObject:resultsByProvider];
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+
+    GHAssertEquals([self.completions count], (NSUInteger) 1, nil);
+    GHAssertLessThanOrEqual(maxSharesInFlight, (NSUInteger) JRTestMaxConcurrentShares, nil);
+    GHAssertGreaterThan(maxSharesInFlight, (NSUInteger) 1, nil);
+
+    NSDictionary *results = [self.completions lastObject];
+    GHAssertEquals([results count], [providers count], nil);
+    GHAssertTrue([[results objectForKey:@"myspace"] isKindOfClass:[NSError class]], nil);
+    for (NSString *provider in providers)
+        if (![provider isEqualToString:@"myspace"])
+            GHAssertEqualObjects([results objectForKey:provider], [NSNull null], provider);
+}
+
+- (void)test_a102_contentIsBuiltOncePerBatch
+{
+    [self prepare];
+
+    NSArray *providers = [NSArray arrayWithObjects:@"facebook", @"twitter", @"linkedin", @"yahoo", nil];
+    [self.sessionData shareActivityForUsers:[self usersForProviders:providers]
+                                 completion:^(NSDictionary *resultsByProvider)
+    {
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+
+    GHAssertEquals(dictionaryForObjectCalls, (NSUInteger) 1, nil);
+    GHAssertEquals([activityContentByProvider count], [providers count], nil);
+
+    NSString *shared = [activityContentByProvider objectForKey:@"facebook"];
+    GHAssertEqualStrings([activityContentByProvider objectForKey:@"twitter"], shared, nil);
+    GHAssertEqualStrings([activityContentByProvider objectForKey:@"yahoo"], shared, nil);
+
+    /* LinkedIn's description is cut to 256 characters */
+    NSString *linkedIn = [activityContentByProvider objectForKey:@"linkedin"];
+    GHAssertFalse([linkedIn isEqualToString:shared], nil);
+    NSString *fullDescription = [@"" stringByPaddingToLength:400 withString:@"d" startingAtIndex:0];
+    GHAssertTrue([shared rangeOfString:fullDescription].location != NSNotFound, nil);
+    GHAssertTrue([linkedIn rangeOfString:[fullDescription substringToIndex:257]].location == NSNotFound, nil);
+    GHAssertTrue([linkedIn rangeOfString:[fullDescription substringToIndex:256]].location != NSNotFound, nil);
+}
+
+@end
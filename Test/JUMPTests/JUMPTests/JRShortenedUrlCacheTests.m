@@ -0,0 +1,78 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRShortenedUrlCache.h"
+
+@interface JRShortenedUrlCacheTests : GHTestCase
+@end
+
+@implementation JRShortenedUrlCacheTests
+
+- (void)test_a100_rememberedPerChannel
+{
+    JRShortenedUrlCache *cache = [[JRShortenedUrlCache alloc] initWithCapacity:8 timeToLive:60];
+    [cache setShortenedUrl:@"http://rpx.me/e" forUrl:@"http://example.com" channel:@"email"];
+
+    GHAssertEqualStrings([cache shortenedUrlForUrl:@"http://example.com" channel:@"email"], @"http://rpx.me/e", nil);
+    GHAssertNil([cache shortenedUrlForUrl:@"http://example.com" channel:@"sms"], nil);
+    GHAssertNil([cache shortenedUrlForUrl:@"http://example.org" channel:@"email"], nil);
+}
+
+- (void)test_a101_entriesExpire
+{
+    JRShortenedUrlCache *cache = [[JRShortenedUrlCache alloc] initWithCapacity:8 timeToLive:0.05];
+    [cache setShortenedUrl:@"http://rpx.me/a" forUrl:@"http://example.com" channel:@"activity"];
+    GHAssertNotNil([cache shortenedUrlForUrl:@"http://example.com" channel:@"activity"], nil);
+
+    [NSThread sleepForTimeInterval:0.1];
+
+    GHAssertNil([cache shortenedUrlForUrl:@"http://example.com" channel:@"activity"], nil);
+    GHAssertEquals([cache count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a102_leastRecentlyUsedIsDropped
+{
+    JRShortenedUrlCache *cache = [[JRShortenedUrlCache alloc] initWithCapacity:2 timeToLive:60];
+    [cache setShortenedUrl:@"1" forUrl:@"http://one" channel:@"sms"];
+    [cache setShortenedUrl:@"2" forUrl:@"http://two" channel:@"sms"];
+    [cache shortenedUrlForUrl:@"http://one" channel:@"sms"];
+    [cache setShortenedUrl:@"3" forUrl:@"http://three" channel:@"sms"];
+
+    GHAssertEquals([cache count], (NSUInteger) 2, nil);
+    GHAssertEqualStrings([cache shortenedUrlForUrl:@"http://one" channel:@"sms"], @"1", nil);
+    GHAssertNil([cache shortenedUrlForUrl:@"http://two" channel:@"sms"], nil);
+    GHAssertEqualStrings([cache shortenedUrlForUrl:@"http://three" channel:@"sms"], @"3", nil);
+
+    [cache removeAllUrls];
+    GHAssertEquals([cache count], (NSUInteger) 0, nil);
+}
+@end
@@ -0,0 +1,99 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRStageMetrics.h"
+#import "JRJsonUtils.h"
+#import "JRNSDate+ISO8601_CaptureDateTimeString.h"
+
+@interface JRStageMetricsTests : GHTestCase
+@end
+
+@implementation JRStageMetricsTests
+
+- (void)setUp
+{
+    [JRStageMetrics reset];
+}
+
+- (NSUInteger)countForStage:(NSString *)stageName
+{
+    return [[[[JRStageMetrics snapshot] objectForKey:stageName] objectForKey:@"count"] unsignedIntegerValue];
+}
+
+- (void)test_a100_recordsInstrumentedStages
+{
+    [@"{\"a\":[1,2,3]}" JR_objectFromJSONString];
+    [NSDate dateFromISO8601DateString:@"1983-03-12"];
+    [NSDate dateFromISO8601DateTimeString:@"2012-02-02 01:33:20 +0000"];
+
+    GHAssertEquals([self countForStage:@"json_parse"], (NSUInteger) 1, nil);
+    GHAssertEquals([self countForStage:@"date_parse"], (NSUInteger) 2, nil);
+    GHAssertEquals([self countForStage:@"archive"], (NSUInteger) 0, nil);
+}
+
+- (void)test_a101_histogramAddsUp
+{
+    for (int i = 0; i < 10; i++)
+    {
+        JR_STAGE_BEGIN(JRStageArchive);
+        [NSKeyedArchiver archivedDataWithRootObject:[NSArray arrayWithObject:@"x"]];
+        JR_STAGE_END(JRStageArchive);
+    }
+
+    NSDictionary *archive = [[JRStageMetrics snapshot] objectForKey:@"archive"];
+    NSArray *histogram = [archive objectForKey:@"histogram"];
+    GHAssertEquals([histogram count], [[JRStageMetrics histogramBucketBounds] count] + 1, nil);
+    GHAssertEqualObjects([histogram valueForKeyPath:@"@sum.unsignedLongLongValue"], [archive objectForKey:@"count"], nil);
+    GHAssertTrue([[archive objectForKey:@"totalNanoseconds"] unsignedLongLongValue] > 0, nil);
+}
+
+- (void)test_a102_sessionStartupStagesHaveNames
+{
+    JR_STAGE_BEGIN(JRStageSessionInit);
+    JR_STAGE_END(JRStageSessionInit);
+    JR_STAGE_BEGIN(JRStageSessionStateLoad);
+    JR_STAGE_END(JRStageSessionStateLoad);
+    JR_STAGE_BEGIN(JRStageSessionStateWait);
+    JR_STAGE_END(JRStageSessionStateWait);
+
+    GHAssertEquals([self countForStage:@"session_init"], (NSUInteger) 1, nil);
+    GHAssertEquals([self countForStage:@"session_state_load"], (NSUInteger) 1, nil);
+    GHAssertEquals([self countForStage:@"session_state_wait"], (NSUInteger) 1, nil);
+}
+
+- (void)test_a103_reset
+{
+    [@"[]" JR_objectFromJSONString];
+    [JRStageMetrics reset];
+    GHAssertEquals([[JRStageMetrics snapshot] count], (NSUInteger) 0, nil);
+}
+@end
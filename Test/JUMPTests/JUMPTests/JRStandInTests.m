@@ -0,0 +1,180 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRStandInServer.h"
+#import "JRStandInURLProtocol.h"
+#import "JRStandInHTTPServer.h"
+#import "JRConnectionManager.h"
+#import "JRRetryPolicy.h"
+
+@interface JRStandInTests : GHAsyncTestCase
+@property(nonatomic) JRStandInServer *server;
+@end
+
+@implementation JRStandInTests
+
+- (void)setUpClass
+{
+    [JRConnectionManager setSessionConfiguration:[JRStandInURLProtocol sessionConfiguration]];
+}
+
+- (void)tearDownClass
+{
+    [JRStandInURLProtocol setServer:nil];
+    [JRConnectionManager setSessionConfiguration:[NSURLSessionConfiguration defaultSessionConfiguration]];
+}
+
+- (void)setUp
+{
+    self.server = [JRStandInServer serverWithDefaultRoutes];
+    [JRStandInURLProtocol setServer:self.server];
+    [JRStandInURLProtocol setForwardingBaseURL:nil];
+}
+
+- (NSString *)routeNameForPath:(NSString *)path
+{
+    NSURL *url = [NSURL URLWithString:[@"https://standin.janraincapture.com" stringByAppendingString:path]];
+    return [self.server responseForMethod:@"POST" URL:url body:nil].routeName;
+}
+
+- (NSInteger)statusCodeForPath:(NSString *)path
+{
+    NSURL *url = [NSURL URLWithString:[@"https://standin.janraincapture.com" stringByAppendingString:path]];
+    return [self.server responseForMethod:@"POST" URL:url body:nil].statusCode;
+}
+
+- (void)test_a100_defaultRoutesMatchLibraryPaths
+{
+    GHAssertEqualStrings([self routeNameForPath:@"/entity"], @"entity", nil);
+    GHAssertEqualStrings([self routeNameForPath:@"/entity.update"], @"entity.update", nil);
+    GHAssertEqualStrings([self routeNameForPath:@"/oauth/refresh_access_token"], @"oauth.refresh", nil);
+    GHAssertEqualStrings([self routeNameForPath:@"/oauth/auth_native_traditional"], @"oauth", nil);
+    GHAssertEqualStrings([self routeNameForPath:@"/widget_data/flows/app/standard/HEAD/en-US.json"], @"flow", nil);
+    GHAssertEqualStrings([self routeNameForPath:@"/openid/mobile_config_and_baseurl"], @"mobile_config_and_baseurl",
+                         nil);
+    GHAssertEquals([self statusCodeForPath:@"/nowhere"], (NSInteger) 404, nil);
+}
+
+- (void)test_a101_failureScheduleIsRepeatable
+{
+    [self.server applyConfiguration:[NSDictionary dictionaryWithObject:
+            [NSDictionary dictionaryWithObjectsAndKeys:
+                                  [NSNumber numberWithInt:1], @"failFirstRequests",
+                                  [NSNumber numberWithInt:2], @"failEveryNthRequest", nil]
+                                                                forKey:@"entity"]];
+
+    for (int run = 0; run < 2; run++)
+    {
+        GHAssertEquals([self statusCodeForPath:@"/entity"], (NSInteger) 503, nil);
+        GHAssertEquals([self statusCodeForPath:@"/entity"], (NSInteger) 200, nil);
+        GHAssertEquals([self statusCodeForPath:@"/entity"], (NSInteger) 503, nil);
+        GHAssertEquals([self statusCodeForPath:@"/entity"], (NSInteger) 200, nil);
+        [self.server resetRequestLog];
+    }
+}
+
+- (void)test_a102_paddingGrowsJSONBodies
+{
+    NSURL *url = [NSURL URLWithString:@"https://standin.janraincapture.com/entity"];
+    NSUInteger plainLength = [[self.server responseForMethod:@"POST" URL:url body:nil].body length];
+
+    [self.server routeNamed:@"entity"].paddingBytes = 10000;
+    NSData *padded = [self.server responseForMethod:@"POST" URL:url body:nil].body;
+    NSDictionary *paddedObject = [NSJSONSerialization JSONObjectWithData:padded options:0 error:nil];
+
+    GHAssertTrue([padded length] >= plainLength + 10000, nil);
+    GHAssertEqualStrings([paddedObject objectForKey:@"stat"], @"ok", nil);
+}
+
+- (void)test_b100_interceptsConnectionManagerRequests
+{
+    [self prepare];
+    NSURLRequest *request =
+            [NSURLRequest requestWithURL:[NSURL URLWithString:@"https://standin.janraincapture.com/entity"]];
+
+    [JRConnectionManager startDataTaskWithRequest:request retryPolicy:[JRRetryPolicy noRetryPolicy]
+                                completionHandler:^(NSData *data, NSURLResponse *response, NSError *e) {
+        NSDictionary *result = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+        GHAssertEquals([(NSHTTPURLResponse *) response statusCode], (NSInteger) 200, nil);
+        GHAssertEqualStrings([result objectForKey:@"stat"], @"ok", nil);
+        GHAssertEquals([self.server requestCountForRouteNamed:@"entity"], (NSUInteger) 1, nil);
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+}
+
+- (void)test_b101_droppedConnectionsFail
+{
+    [self prepare];
+    [self.server routeNamed:@"entity"].failFirstRequests = 1;
+    [self.server routeNamed:@"entity"].failureStatusCode = 0;
+    NSURLRequest *request =
+            [NSURLRequest requestWithURL:[NSURL URLWithString:@"https://standin.janraincapture.com/entity"]];
+
+    [JRConnectionManager startDataTaskWithRequest:request retryPolicy:[JRRetryPolicy noRetryPolicy]
+                                completionHandler:^(NSData *data, NSURLResponse *response, NSError *e) {
+        GHAssertEquals([e code], (NSInteger) NSURLErrorNetworkConnectionLost, nil);
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+}
+
+- (void)test_b102_forwardsToLoopbackServer
+{
+    [self prepare];
+    JRStandInHTTPServer *httpServer = [[JRStandInHTTPServer alloc] initWithServer:self.server];
+    NSError *error = nil;
+    GHAssertTrue([httpServer startOnPort:0 error:&error], @"%@", error);
+    [JRStandInURLProtocol setForwardingBaseURL:[httpServer baseURL]];
+    [self.server routeNamed:@"entity.update"].latency = 0.05;
+
+    NSMutableURLRequest *request =
+            [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://standin.janraincapture.com/entity.update"]];
+    [request setHTTPMethod:@"POST"];
+    [request setHTTPBody:[@"attributes=%7B%7D" dataUsingEncoding:NSUTF8StringEncoding]];
+
+    [JRConnectionManager startDataTaskWithRequest:request retryPolicy:[JRRetryPolicy noRetryPolicy]
+                                completionHandler:^(NSData *data, NSURLResponse *response, NSError *e) {
+        NSDictionary *logged = [[self.server requestLog] lastObject];
+        GHAssertEquals([(NSHTTPURLResponse *) response statusCode], (NSInteger) 200, nil);
+        GHAssertEqualStrings([[response URL] host], @"standin.janraincapture.com", nil);
+        GHAssertEqualStrings([logged objectForKey:@"route"], @"entity.update", nil);
+        GHAssertEquals([[logged objectForKey:@"bodyLength"] unsignedIntegerValue], (NSUInteger) 17, nil);
+        [httpServer stop];
+        [self notify:kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:5.0];
+}
+@end
@@ -0,0 +1,288 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRStartupTaskGraph.h"
+
+@interface JRStartupTaskGraphTests : GHAsyncTestCase
+@property(nonatomic) JRStartupTaskGraph *graph;
+@property(nonatomic) NSMutableArray *events;
+@property(nonatomic) NSMutableDictionary *finishBlocks;
+@end
+
+@implementation JRStartupTaskGraphTests
+
+- (BOOL)shouldRunOnMainThread
+{
+    return YES;
+}
+
+- (void)setUp
+{
+    self.graph = [[JRStartupTaskGraph alloc] init];
+    self.events = [NSMutableArray array];
+    self.finishBlocks = [NSMutableDictionary dictionary];
+}
+
+/* Adds a task that records its start and keeps its finish block, so the test decides when it finishes */
+- (void)addTask:(NSString *)name dependencies:(NSArray *)dependencies
+{
+    [self.graph addTaskNamed:name dependencies:dependencies start:^(JRStartupTaskFinish finish)
+    {
+        [self.events addObject:name];
+        [self.finishBlocks setObject:[finish copy] forKey:name];
+    }];
+}
+
+- (void)finishTask:(NSString *)name withError:(NSError *)error
+{
+    JRStartupTaskFinish finish = [self.finishBlocks objectForKey:name];
+    finish(error);
+}
+
+- (void)test_a100_tasksWaitForStart
+{
+    [self addTask:@"a" dependencies:nil];
+    GHAssertEquals([self.events count], (NSUInteger) 0, nil);
+
+    [self.graph start];
+    GHAssertEqualObjects(self.events, [NSArray arrayWithObject:@"a"], nil);
+}
+
+- (void)test_a101_independentTasksStartTogether
+{
+    [self addTask:@"a" dependencies:nil];
+    [self addTask:@"b" dependencies:nil];
+    [self.graph start];
+
+    GHAssertEquals([self.events count], (NSUInteger) 2, nil);
+    GHAssertFalse([self.graph isTaskFinished:@"a"], nil);
+    GHAssertFalse([self.graph isTaskFinished:@"b"], nil);
+}
+
+- (void)test_a102_dependentTaskStartsAfterDependency
+{
+    [self addTask:@"a" dependencies:nil];
+    [self addTask:@"b" dependencies:[NSArray arrayWithObject:@"a"]];
+    [self.graph start];
+    GHAssertEqualObjects(self.events, [NSArray arrayWithObject:@"a"], nil);
+
+    [self finishTask:@"a" withError:nil];
+    GHAssertEqualObjects(self.events, ([NSArray arrayWithObjects:@"a", @"b", nil]), nil);
+}
+
+- (void)test_a103_synchronousFinishStartsDependents
+{
+    [self.graph addTaskNamed:@"a" dependencies:nil start:^(JRStartupTaskFinish finish)
+    {
+        [self.events addObject:@"a"];
+        finish(nil);
+    }];
+    [self addTask:@"b" dependencies:[NSArray arrayWithObject:@"a"]];
+    [self.graph start];
+
+    GHAssertEqualObjects(self.events, ([NSArray arrayWithObjects:@"a", @"b", nil]), nil);
+    GHAssertTrue([self.graph isTaskFinished:@"a"], nil);
+}
+
+- (void)test_a104_taskAddedAfterStartStartsImmediately
+{
+    [self.graph start];
+    [self addTask:@"a" dependencies:nil];
+
+    GHAssertEqualObjects(self.events, [NSArray arrayWithObject:@"a"], nil);
+}
+
+- (void)test_a105_unknownDependenciesAndNamesCountAsFinished
+{
+    [self addTask:@"a" dependencies:[NSArray arrayWithObject:@"never_added"]];
+    [self.graph start];
+
+    GHAssertEqualObjects(self.events, [NSArray arrayWithObject:@"a"], nil);
+    GHAssertTrue([self.graph isTaskFinished:@"never_added"], nil);
+}
+
+- (void)test_a106_duplicateNamesAreIgnored
+{
+    [self addTask:@"a" dependencies:nil];
+    [self.graph addTaskNamed:@"a" dependencies:nil start:^(JRStartupTaskFinish finish)
+    {
+        [self.events addObject:@"duplicate"];
+    }];
+    [self.graph start];
+
+    GHAssertEqualObjects(self.events, [NSArray arrayWithObject:@"a"], nil);
+}
+
+- (void)test_a107_finishingTwiceIsHarmless
+{
+    [self addTask:@"a" dependencies:nil];
+    [self.graph start];
+
+    [self finishTask:@"a" withError:nil];
+    [self finishTask:@"a" withError:[NSError errorWithDomain:@"test" code:1 userInfo:nil]];
+
+    GHAssertTrue([self.graph isTaskFinished:@"a"], nil);
+    GHAssertEquals([[self.graph taskErrors] count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a108_failedTaskStillCountsAsFinished
+{
+    NSError *error = [NSError errorWithDomain:@"test" code:1 userInfo:nil];
+    [self addTask:@"a" dependencies:nil];
+    [self addTask:@"b" dependencies:[NSArray arrayWithObject:@"a"]];
+    [self.graph start];
+
+    [self finishTask:@"a" withError:error];
+
+    GHAssertEqualObjects(self.events, ([NSArray arrayWithObjects:@"a", @"b", nil]), nil);
+    GHAssertEqualObjects([self.graph taskErrors], [NSDictionary dictionaryWithObject:error forKey:@"a"], nil);
+}
+
+- (void)test_a200_waitOnFinishedTasksCompletesSynchronously
+{
+    [self addTask:@"a" dependencies:nil];
+    [self addTask:@"b" dependencies:nil];
+    [self.graph start];
+    [self finishTask:@"a" withError:nil];
+
+    __block BOOL result = NO;
+    [self.graph waitForTasks:[NSArray arrayWithObject:@"a"] timeout:10 completion:^(BOOL finished)
+    {
+        result = finished;
+    }];
+
+    GHAssertTrue(result, nil);
+}
+
+- (void)test_a201_waitCompletesWhenTasksFinish
+{
+    [self addTask:@"a" dependencies:nil];
+    [self addTask:@"b" dependencies:nil];
+    [self.graph start];
+
+    __block NSUInteger calls = 0;
+    [self.graph waitForTasks:[NSArray arrayWithObjects:@"a", @"b", nil] timeout:10 completion:^(BOOL finished)
+    {
+        GHAssertTrue(finished, nil);
+        calls++;
+    }];
+
+    [self finishTask:@"a" withError:nil];
+    GHAssertEquals(calls, (NSUInteger) 0, nil);
+
+    [self finishTask:@"b" withError:nil];
+    GHAssertEquals(calls, (NSUInteger) 1, nil);
+}
+
+- (void)test_a202_finishFromBackgroundThreadCompletesOnMain
+{
+    [self prepare];
+
+    [self.graph addTaskNamed:@"a" dependencies:nil start:^(JRStartupTaskFinish finish)
+    {
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^
+        {
+            finish(nil);
+        });
+    }];
+    [self.graph start];
+
+    [self.graph waitForTasks:[NSArray arrayWithObject:@"a"] timeout:10 completion:^(BOOL finished)
+    {
+        BOOL ok = finished && [NSThread isMainThread];
+        [self notify:ok ? kGHUnitWaitStatusSuccess : kGHUnitWaitStatusFailure forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+}
+
+- (void)test_a203_waitTimesOut
+{
+    [self prepare];
+
+    [self addTask:@"a" dependencies:nil];
+    [self.graph start];
+
+    __block NSUInteger calls = 0;
+    [self.graph waitForAllTasksWithTimeout:0.2 completion:^(BOOL finished)
+    {
+        calls++;
+        [self notify:finished ? kGHUnitWaitStatusFailure : kGHUnitWaitStatusSuccess forSelector:_cmd];
+    }];
+
+    [self waitForStatus:kGHUnitWaitStatusSuccess timeout:2.0];
+
+    /* Finishing afterwards doesn't call the timed out completion again */
+    [self finishTask:@"a" withError:nil];
+    GHAssertEquals(calls, (NSUInteger) 1, nil);
+}
+
+- (void)test_a204_unknownNamesAreNotWaitedFor
+{
+    __block NSUInteger calls = 0;
+    [self.graph waitForTasks:[NSArray arrayWithObject:@"never_added"] timeout:10 completion:^(BOOL finished)
+    {
+        GHAssertTrue(finished, nil);
+        calls++;
+    }];
+    GHAssertEquals(calls, (NSUInteger) 1, nil);
+
+    [self addTask:@"a" dependencies:nil];
+    [self.graph start];
+    [self.graph waitForTasks:[NSArray arrayWithObjects:@"a", @"never_added", nil] timeout:10
+                  completion:^(BOOL finished)
+    {
+        GHAssertTrue(finished, nil);
+        calls++;
+    }];
+    GHAssertEquals(calls, (NSUInteger) 1, nil);
+
+    [self finishTask:@"a" withError:nil];
+    GHAssertEquals(calls, (NSUInteger) 2, nil);
+}
+
+- (void)test_a300_timingsCoverStartedTasks
+{
+    [self addTask:@"a" dependencies:nil];
+    [self addTask:@"b" dependencies:[NSArray arrayWithObject:@"a"]];
+    [self.graph start];
+    [self finishTask:@"a" withError:nil];
+
+    NSDictionary *timings = [self.graph taskTimings];
+    GHAssertNotNil([[timings objectForKey:@"a"] objectForKey:@"start"], nil);
+    GHAssertNotNil([[timings objectForKey:@"a"] objectForKey:@"duration"], nil);
+    GHAssertNotNil([[timings objectForKey:@"b"] objectForKey:@"start"], nil);
+    GHAssertNil([[timings objectForKey:@"b"] objectForKey:@"duration"], nil);
+    GHAssertGreaterThanOrEqual([[[timings objectForKey:@"b"] objectForKey:@"start"] doubleValue],
+            [[[timings objectForKey:@"a"] objectForKey:@"start"] doubleValue], nil);
+}
+@end
@@ -0,0 +1,93 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "NSString+JRStringReplacement.h"
+
+@interface JRStringReplacementTests : GHTestCase
+@end
+
+@implementation JRStringReplacementTests
+
+- (void)test_a100_replacesEveryPattern
+{
+    NSDictionary *urls = [NSDictionary dictionaryWithObjectsAndKeys:@"http://rpx.me/a", @"http://example.com/story",
+                                                                    @"http://rpx.me/b", @"http://example.com/photo",
+                                                                    nil];
+    NSString *body = @"Read http://example.com/story, see http://example.com/photo, reread http://example.com/story";
+
+    GHAssertEqualStrings([body JR_stringByReplacingOccurrencesOfStrings:urls],
+                         @"Read http://rpx.me/a, see http://rpx.me/b, reread http://rpx.me/a", nil);
+}
+
+- (void)test_a101_longestMatchWinsWhereUrlsShareAPrefix
+{
+    NSDictionary *urls = [NSDictionary dictionaryWithObjectsAndKeys:@"SHORT", @"http://example.com",
+                                                                    @"LONG", @"http://example.com/story",
+                                                                    nil];
+
+    GHAssertEqualStrings([@"http://example.com/story http://example.com"
+                                  JR_stringByReplacingOccurrencesOfStrings:urls], @"LONG SHORT", nil);
+}
+
+- (void)test_a102_replacementsAreNotScannedAgain
+{
+    NSDictionary *replacements = [NSDictionary dictionaryWithObjectsAndKeys:@"b", @"a", @"c", @"b", nil];
+
+    GHAssertEqualStrings([@"aabb" JR_stringByReplacingOccurrencesOfStrings:replacements], @"bbcc", nil);
+}
+
+- (void)test_a103_overlappingPatternsPreferTheLeftmost
+{
+    NSDictionary *replacements = [NSDictionary dictionaryWithObjectsAndKeys:@"1", @"abc", @"2", @"bcd", nil];
+
+    GHAssertEqualStrings([@"abcd bcd" JR_stringByReplacingOccurrencesOfStrings:replacements], @"1d 2", nil);
+}
+
+- (void)test_a104_nonAsciiText
+{
+    NSDictionary *replacements = [NSDictionary dictionaryWithObject:@"→" forKey:@"😀 "];
+
+    GHAssertEqualStrings([@"Ünïcödé 😀 text 😀 " JR_stringByReplacingOccurrencesOfStrings:replacements],
+                         @"Ünïcödé →text →", nil);
+}
+
+- (void)test_a105_nothingToReplace
+{
+    GHAssertEqualStrings([@"plain" JR_stringByReplacingOccurrencesOfStrings:nil], @"plain", nil);
+    GHAssertEqualStrings([@"" JR_stringByReplacingOccurrencesOfStrings:
+            [NSDictionary dictionaryWithObject:@"x" forKey:@"y"]], @"", nil);
+
+    /* Empty keys and values that aren't strings are skipped */
+    NSDictionary *replacements = [NSDictionary dictionaryWithObjectsAndKeys:@"x", @"", [NSNull null], @"plain", nil];
+    GHAssertEqualStrings([@"plain" JR_stringByReplacingOccurrencesOfStrings:replacements], @"plain", nil);
+}
+@end
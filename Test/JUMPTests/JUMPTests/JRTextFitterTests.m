@@ -0,0 +1,162 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRTextFitter.h"
+
+/* Fixed width characters, 10 points wide on 20 point lines, wrapped wherever the line is full */
+@interface JRFakeTextMeasurer : NSObject <JRTextMeasurer>
+@end
+
+@implementation JRFakeTextMeasurer
+- (CGFloat)lineHeight
+{
+    return 20;
+}
+
+- (CGSize)sizeOfString:(NSString *)string constrainedToSize:(CGSize)size
+{
+    NSUInteger charactersPerLine = MAX((NSUInteger) (size.width / 10), 1);
+    NSUInteger length = [string length];
+    NSUInteger lines = (length + charactersPerLine - 1) / charactersPerLine;
+
+    return CGSizeMake(MIN(MIN(length, charactersPerLine) * 10, size.width), MIN(lines * [self lineHeight], size.height));
+}
+@end
+
+@interface JRTextFitterTests : GHTestCase
+@property(nonatomic) JRFakeTextMeasurer *measurer;
+@end
+
+@implementation JRTextFitterTests
+
+- (void)setUp
+{
+    self.measurer = [[JRFakeTextMeasurer alloc] init];
+}
+
+/* What the preview label did before: measure every prefix until one doesn't fit */
+- (NSUInteger)linearLengthOfString:(NSString *)string visibleInSize:(CGSize)size breakAtWords:(BOOL)breakAtWords
+                  measurements:(NSUInteger *)measurements
+{
+    NSInteger indexOfLastBreakingCharacter = -1;
+    NSUInteger visibleLength = 0;
+
+    for (NSUInteger i = 1; i <= [string length]; i++)
+    {
+        unichar currentChar = [string characterAtIndex:i - 1];
+        if ([[NSCharacterSet whitespaceAndNewlineCharacterSet] characterIsMember:currentChar] || currentChar == '-')
+            indexOfLastBreakingCharacter = i - 1;
+
+        (*measurements)++;
+        CGSize stringSize = [self.measurer sizeOfString:[string substringToIndex:i]
+                                      constrainedToSize:CGSizeMake(size.width, size.height + 20)];
+        if (stringSize.height > size.height || stringSize.width > size.width)
+            break;
+
+        visibleLength = i;
+    }
+
+    if (breakAtWords && indexOfLastBreakingCharacter != -1)
+        return (NSUInteger) indexOfLastBreakingCharacter + 1;
+
+    return visibleLength;
+}
+
+- (void)test_a100_emptyStringMeasuresNothing
+{
+    JRTextFitter *fitter = [[JRTextFitter alloc] initWithMeasurer:self.measurer];
+    GHAssertEquals([fitter lengthOfString:@"" visibleInSize:CGSizeMake(100, 20) breakAtWords:YES], (NSUInteger) 0, nil);
+    GHAssertEquals(fitter.measurementCount, (NSUInteger) 0, nil);
+}
+
+- (void)test_a101_breaksAfterTheLastWordThatFits
+{
+    JRTextFitter *fitter = [[JRTextFitter alloc] initWithMeasurer:self.measurer];
+    NSString *text = @"Sharing this with everyone I know";
+
+    /* 12 characters fit on a line: "Sharing this" exactly, so the break is at the space after it */
+    GHAssertEquals([fitter lengthOfString:text visibleInSize:CGSizeMake(120, 20) breakAtWords:NO], (NSUInteger) 12, nil);
+    GHAssertEquals([fitter lengthOfString:text visibleInSize:CGSizeMake(120, 20) breakAtWords:YES], (NSUInteger) 13, nil);
+
+    /* No break anywhere: fall back to the characters that fit */
+    GHAssertEquals([fitter lengthOfString:@"abcdefghijklmnop" visibleInSize:CGSizeMake(50, 20) breakAtWords:YES],
+                   (NSUInteger) 5, nil);
+}
+
+- (void)test_a102_agreesWithMeasuringEveryPrefix
+{
+    NSArray *texts = [NSArray arrayWithObjects:@"Check out this article about mobile identity",
+                                               @"well-known hyphenated-words break-too",
+                                               @"averyveryverylongwordwithoutanywhere to break it",
+                                               @"short", @"  leading and trailing spaces  ", nil];
+
+    for (NSString *text in texts)
+    {
+        for (CGFloat width = 10; width <= 300; width += 10)
+        {
+            for (int words = 0; words < 2; words++)
+            {
+                JRTextFitter *fitter = [[JRTextFitter alloc] initWithMeasurer:self.measurer];
+                NSUInteger linearMeasurements = 0;
+                CGSize size = CGSizeMake(width, 20);
+
+                NSUInteger expected = [self linearLengthOfString:text visibleInSize:size breakAtWords:words
+                                                    measurements:&linearMeasurements];
+                NSUInteger actual = [fitter lengthOfString:text visibleInSize:size breakAtWords:words];
+
+                GHAssertEquals(actual, expected, @"\"%@\" in %g", text, width);
+                GHAssertLessThanOrEqual(fitter.measurementCount, MAX(linearMeasurements, (NSUInteger) 6), nil);
+            }
+        }
+    }
+}
+
+- (void)test_a103_measurementsGrowLogarithmically
+{
+    NSMutableString *text = [NSMutableString string];
+    while ([text length] < 4000)
+        [text appendString:@"lorem ipsum dolor sit amet "];
+
+    JRTextFitter *fitter = [[JRTextFitter alloc] initWithMeasurer:self.measurer];
+    NSUInteger linearMeasurements = 0;
+    CGSize size = CGSizeMake(20000, 20);
+
+    NSUInteger expected = [self linearLengthOfString:text visibleInSize:size breakAtWords:YES
+                                        measurements:&linearMeasurements];
+    GHAssertEquals([fitter lengthOfString:text visibleInSize:size breakAtWords:YES], expected, nil);
+
+    /* ~2000 visible characters: the old loop lays out every one of them, binary search about a dozen */
+    GHAssertGreaterThan(linearMeasurements, (NSUInteger) 1000, nil);
+    GHAssertLessThanOrEqual(fitter.measurementCount, (NSUInteger) 13, nil);
+}
+
+@end
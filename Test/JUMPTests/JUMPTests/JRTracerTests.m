@@ -0,0 +1,171 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <GHUnitIOS/GHUnit.h>
+#import "JRTracer.h"
+
+@interface JRCollectingTraceExporter : NSObject <JRTraceExporter>
+@property(nonatomic) NSMutableArray *spans;
+@end
+
+@implementation JRCollectingTraceExporter
+- (id)init
+{
+    if ((self = [super init]))
+        _spans = [NSMutableArray array];
+
+    return self;
+}
+
+- (void)exportSpan:(JRTraceSpan *)span
+{
+    [self.spans addObject:span];
+}
+@end
+
+@interface JRTracerTests : GHTestCase
+@property(nonatomic) JRTracer *tracer;
+@property(nonatomic) JRCollectingTraceExporter *exporter;
+@end
+
+@implementation JRTracerTests
+
+- (void)setUp
+{
+    self.tracer = [[JRTracer alloc] initWithRingBufferCapacity:4];
+    self.exporter = [[JRCollectingTraceExporter alloc] init];
+    self.tracer.exporter = self.exporter;
+}
+
+- (void)test_a100_noSpansOutsideATrace
+{
+    GHAssertNil([self.tracer startSpanWithName:@"orphan"], nil);
+    GHAssertNil([self.tracer currentCorrelationId], nil);
+}
+
+- (void)test_a101_spansNestAndShareTheCorrelationId
+{
+    JRTraceSpan *root = [self.tracer startTraceWithName:@"signin"];
+    JRTraceSpan *dialog = [self.tracer startSpanWithName:@"dialog"];
+    JRTraceSpan *web = [self.tracer startSpanWithName:@"web"];
+    [self.tracer endSpanWithName:@"web"];
+    [dialog end];
+    JRTraceSpan *http = [self.tracer startSpanWithName:@"http"];
+
+    GHAssertEqualStrings([self.tracer currentCorrelationId], root.correlationId, nil);
+    GHAssertEqualStrings(dialog.correlationId, root.correlationId, nil);
+    GHAssertEqualStrings(dialog.parentSpanId, root.spanId, nil);
+    GHAssertEqualStrings(web.parentSpanId, dialog.spanId, nil);
+    GHAssertEqualStrings(http.parentSpanId, root.spanId, nil);
+
+    [self.tracer endTraceWithStatus:@"ok"];
+    GHAssertTrue(http.ended, nil);
+    GHAssertNil([self.tracer currentCorrelationId], nil);
+    GHAssertEqualStrings([root.attributes objectForKey:@"status"], @"ok", nil);
+    GHAssertEquals([self.exporter.spans count], (NSUInteger) 4, nil);
+    GHAssertEquals([self.exporter.spans lastObject], root, nil);
+}
+
+- (void)test_a102_endingAParentEndsItsChildren
+{
+    [self.tracer startTraceWithName:@"signin"];
+    JRTraceSpan *outer = [self.tracer startSpanWithName:@"outer"];
+    JRTraceSpan *inner = [self.tracer startSpanWithName:@"inner"];
+    [outer end];
+    GHAssertTrue(inner.ended, nil);
+    GHAssertEquals([self.exporter.spans objectAtIndex:0], inner, nil);
+}
+
+- (void)test_a103_newTraceAbandonsTheOldOne
+{
+    JRTraceSpan *first = [self.tracer startTraceWithName:@"signin"];
+    JRTraceSpan *second = [self.tracer startTraceWithName:@"register"];
+    GHAssertTrue(first.ended, nil);
+    GHAssertEqualStrings([first.attributes objectForKey:@"status"], @"abandoned", nil);
+    GHAssertFalse([first.correlationId isEqualToString:second.correlationId], nil);
+}
+
+- (void)test_a104_ringBufferKeepsTheNewestSpans
+{
+    for (int i = 0; i < 6; i++)
+    {
+        [self.tracer startTraceWithName:[NSString stringWithFormat:@"trace%d", i]];
+        [self.tracer endTraceWithStatus:@"ok"];
+    }
+
+    NSArray *recent = [self.tracer recentSpans];
+    GHAssertEquals([recent count], (NSUInteger) 4, nil);
+    GHAssertEqualStrings([[recent objectAtIndex:0] name], @"trace2", nil);
+    GHAssertEqualStrings([[recent lastObject] name], @"trace5", nil);
+
+    [self.tracer removeAllSpans];
+    GHAssertEquals([[self.tracer recentSpans] count], (NSUInteger) 0, nil);
+}
+
+- (void)test_a105_asyncSpansOverlapWithoutNesting
+{
+    JRTraceSpan *root = [self.tracer startTraceWithName:@"signin"];
+    JRTraceSpan *first = [self.tracer startAsyncSpanWithName:@"http.first"];
+    JRTraceSpan *second = [self.tracer startAsyncSpanWithName:@"http.second"];
+    JRTraceSpan *dialog = [self.tracer startSpanWithName:@"dialog"];
+
+    GHAssertEqualStrings(first.parentSpanId, root.spanId, nil);
+    GHAssertEqualStrings(second.parentSpanId, root.spanId, nil);
+    GHAssertEqualStrings(dialog.parentSpanId, root.spanId, nil);
+
+    [first end];
+    GHAssertFalse(second.ended, nil);
+    GHAssertFalse(dialog.ended, nil);
+
+    JRTraceSpan *third = [self.tracer startAsyncSpanWithName:@"http.third"];
+    GHAssertEqualStrings(third.parentSpanId, dialog.spanId, nil);
+    [dialog end];
+    GHAssertTrue(third.ended, nil);
+    GHAssertFalse(second.ended, nil);
+
+    [self.tracer endTraceWithStatus:@"ok"];
+    GHAssertTrue(second.ended, nil);
+    GHAssertEquals([self.exporter.spans lastObject], root, nil);
+}
+
+- (void)test_a106_onlyJanrainHostsAreCorrelated
+{
+    GHAssertTrue([self.tracer shouldCorrelateRequestToUrl:[NSURL URLWithString:@"https://rpxnow.com/jsonp"]], nil);
+    GHAssertTrue([self.tracer shouldCorrelateRequestToUrl:
+            [NSURL URLWithString:@"https://app.us.janraincapture.com/oauth/auth_native"]], nil);
+    GHAssertFalse([self.tracer shouldCorrelateRequestToUrl:[NSURL URLWithString:@"https://example.com/token"]], nil);
+    GHAssertFalse([self.tracer shouldCorrelateRequestToUrl:[NSURL URLWithString:@"https://notrpxnow.com/"]], nil);
+
+    [self.tracer addCorrelatedHost:@"login.example.com"];
+    GHAssertTrue([self.tracer shouldCorrelateRequestToUrl:[NSURL URLWithString:@"https://login.example.com/x"]], nil);
+    GHAssertFalse([self.tracer shouldCorrelateRequestToUrl:[NSURL URLWithString:@"https://example.com/token"]], nil);
+}
+@end
@@ -0,0 +1,382 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRStandInHTTPServer.h"
+#import "JRStandInServer.h"
+#include <dispatch/dispatch.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef MSG_NOSIGNAL
+#define JRStandInSendFlags MSG_NOSIGNAL
+#else
+#define JRStandInSendFlags 0
+#endif
+
+#define JRStandInMaxRequestBytes (64 * 1024 * 1024)
+
+@class JRStandInHTTPConnection;
+
+@interface JRStandInHTTPServer ()
+@property(nonatomic, readwrite) JRStandInServer *server;
+@property(nonatomic, readwrite) uint16_t port;
+@property(nonatomic, strong) NSMutableSet *connections;
+- (void)connectionDidClose:(JRStandInHTTPConnection *)connection;
+@end
+
+/* One accepted socket. Reads until it has the request line, the headers and Content-Length bytes of body, asks the
+   server what to send, waits out the route's latency and writes the response. */
+@interface JRStandInHTTPConnection : NSObject
+- (id)initWithSocket:(int)fd owner:(JRStandInHTTPServer *)owner queue:(dispatch_queue_t)queue;
+- (void)start;
+- (void)close;
+@end
+
+@implementation JRStandInHTTPConnection
+{
+    int socketFd;
+    __weak JRStandInHTTPServer *owner;
+    dispatch_queue_t queue;
+    dispatch_source_t readSource;
+    NSMutableData *buffer;
+}
+
+- (id)initWithSocket:(int)fd owner:(JRStandInHTTPServer *)owner_ queue:(dispatch_queue_t)queue_
+{
+    if ((self = [super init]))
+    {
+        socketFd = fd;
+        owner = owner_;
+        queue = queue_;
+        buffer = [NSMutableData data];
+    }
+
+    return self;
+}
+
+- (void)start
+{
+    fcntl(socketFd, F_SETFL, fcntl(socketFd, F_GETFL) | O_NONBLOCK);
+
+    readSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_READ, (uintptr_t) socketFd, 0, queue);
+    dispatch_source_set_event_handler(readSource, ^{
+        [self readAvailableBytes];
+    });
+    dispatch_resume(readSource);
+}
+
+- (void)stopReading
+{
+    if (!readSource) return;
+
+    dispatch_source_cancel(readSource);
+#if !OS_OBJECT_USE_OBJC
+    dispatch_release(readSource);
+#endif
+    readSource = NULL;
+}
+
+- (void)close
+{
+    [self stopReading];
+    if (socketFd < 0) return;
+
+    close(socketFd);
+    socketFd = -1;
+    [owner connectionDidClose:self];
+}
+
+- (void)readAvailableBytes
+{
+    uint8_t chunk[16 * 1024];
+    for (;;)
+    {
+        ssize_t count = read(socketFd, chunk, sizeof(chunk));
+        if (count > 0)
+        {
+            [buffer appendBytes:chunk length:(NSUInteger) count];
+            continue;
+        }
+
+        if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+        /* The client went away, or broke */
+        [self close];
+        return;
+    }
+
+    if ([buffer length] > JRStandInMaxRequestBytes)
+    {
+        [self close];
+        return;
+    }
+
+    [self handleRequestIfComplete];
+}
+
+- (void)handleRequestIfComplete
+{
+    NSData *separator = [@"\r\n\r\n" dataUsingEncoding:NSASCIIStringEncoding];
+    NSRange headerEnd = [buffer rangeOfData:separator options:0 range:NSMakeRange(0, [buffer length])];
+    if (headerEnd.location == NSNotFound) return;
+
+    NSString *head = [[NSString alloc] initWithData:[buffer subdataWithRange:NSMakeRange(0, headerEnd.location)]
+                                           encoding:NSISOLatin1StringEncoding];
+    NSArray *lines = [head componentsSeparatedByString:@"\r\n"];
+    NSArray *requestLine = [[lines objectAtIndex:0] componentsSeparatedByString:@" "];
+    if ([requestLine count] < 2)
+    {
+        [self close];
+        return;
+    }
+
+    NSUInteger contentLength = 0;
+    for (NSUInteger i = 1; i < [lines count]; i++)
+    {
+        NSString *line = [lines objectAtIndex:i];
+        NSRange colon = [line rangeOfString:@":"];
+        if (colon.location == NSNotFound) continue;
+
+        NSString *name = [[line substringToIndex:colon.location] lowercaseString];
+        if ([name isEqualToString:@"content-length"])
+            contentLength = (NSUInteger) [[line substringFromIndex:colon.location + 1] integerValue];
+    }
+
+    NSUInteger bodyStart = NSMaxRange(headerEnd);
+    if ([buffer length] < bodyStart + contentLength) return;
+
+    [self stopReading];
+
+    NSString *method = [requestLine objectAtIndex:0];
+    NSString *target = [requestLine objectAtIndex:1];
+    NSURL *url = [NSURL URLWithString:[NSString stringWithFormat:@"http://127.0.0.1%@", target]];
+    NSData *body = [buffer subdataWithRange:NSMakeRange(bodyStart, contentLength)];
+
+    JRStandInResponse *response = [[owner server] responseForMethod:method URL:url body:body];
+
+    dispatch_time_t when = dispatch_time(DISPATCH_TIME_NOW, (int64_t) (response.delay * 1000000000.0));
+    dispatch_after(when, queue, ^{
+        if (response.dropsConnection)
+        {
+            [self close];
+            return;
+        }
+
+        [self writeResponse:response];
+    });
+}
+
+- (NSString *)reasonPhraseForStatusCode:(NSInteger)statusCode
+{
+    switch (statusCode)
+    {
+        case 200: return @"OK";
+        case 304: return @"Not Modified";
+        case 400: return @"Bad Request";
+        case 404: return @"Not Found";
+        case 408: return @"Request Timeout";
+        case 429: return @"Too Many Requests";
+        case 500: return @"Internal Server Error";
+        case 502: return @"Bad Gateway";
+        case 503: return @"Service Unavailable";
+        case 504: return @"Gateway Timeout";
+        default:  return @"Stand-In";
+    }
+}
+
+- (void)writeResponse:(JRStandInResponse *)response
+{
+    NSMutableString *head = [NSMutableString stringWithFormat:@"HTTP/1.1 %ld %@\r\n", (long) response.statusCode,
+                                                              [self reasonPhraseForStatusCode:response.statusCode]];
+    for (NSString *name in response.headers)
+        [head appendFormat:@"%@: %@\r\n", name, [response.headers objectForKey:name]];
+    [head appendFormat:@"Content-Length: %lu\r\nConnection: close\r\n\r\n", (unsigned long) [response.body length]];
+
+    NSMutableData *data = [[head dataUsingEncoding:NSISOLatin1StringEncoding] mutableCopy];
+    if (response.body) [data appendData:response.body];
+
+    /* Blocking writes are simplest, and keep a slow reader from holding up everyone else */
+    int fd = socketFd;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+    int noSigPipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        const uint8_t *bytes = [data bytes];
+        NSUInteger remaining = [data length];
+        while (remaining > 0)
+        {
+            ssize_t sent = send(fd, bytes, remaining, JRStandInSendFlags);
+            if (sent < 0 && errno == EINTR) continue;
+            if (sent <= 0) break;
+
+            bytes += sent;
+            remaining -= (NSUInteger) sent;
+        }
+
+        dispatch_async(queue, ^{
+            [self close];
+        });
+    });
+}
+@end
+
+@implementation JRStandInHTTPServer
+{
+    int listenFd;
+    dispatch_queue_t queue;
+    dispatch_source_t acceptSource;
+}
+@synthesize server;
+@synthesize port;
+@synthesize connections;
+
+- (id)initWithServer:(JRStandInServer *)server_
+{
+    if ((self = [super init]))
+    {
+        self.server = server_;
+        self.connections = [NSMutableSet set];
+        listenFd = -1;
+        queue = dispatch_queue_create("com.janrain.standin.http", DISPATCH_QUEUE_SERIAL);
+    }
+
+    return self;
+}
+
+/* No blocks here: anything that captured self would outlive it */
+- (void)dealloc
+{
+    if (listenFd < 0) return;
+
+    dispatch_source_cancel(acceptSource);
+    close(listenFd);
+    for (JRStandInHTTPConnection *connection in [self.connections allObjects])
+        [connection close];
+}
+
+- (BOOL)failWithErrno:(NSError **)error
+{
+    if (error) *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+    if (listenFd >= 0) close(listenFd);
+    listenFd = -1;
+
+    return NO;
+}
+
+- (BOOL)startOnPort:(uint16_t)port_ error:(NSError **)error
+{
+    if (listenFd >= 0) return YES;
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) return [self failWithErrno:error];
+
+    int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port_);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(listenFd, (struct sockaddr *) &address, sizeof(address)) < 0) return [self failWithErrno:error];
+    if (listen(listenFd, 128) < 0) return [self failWithErrno:error];
+
+    socklen_t length = sizeof(address);
+    if (getsockname(listenFd, (struct sockaddr *) &address, &length) < 0) return [self failWithErrno:error];
+    self.port = ntohs(address.sin_port);
+
+    fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL) | O_NONBLOCK);
+
+    acceptSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_READ, (uintptr_t) listenFd, 0, queue);
+    __weak JRStandInHTTPServer *weakSelf = self;
+    dispatch_source_set_event_handler(acceptSource, ^{
+        [weakSelf acceptConnections];
+    });
+    dispatch_resume(acceptSource);
+
+    return YES;
+}
+
+- (void)acceptConnections
+{
+    for (;;)
+    {
+        int fd = accept(listenFd, NULL, NULL);
+        if (fd < 0) return;
+
+        JRStandInHTTPConnection *connection = [[JRStandInHTTPConnection alloc] initWithSocket:fd owner:self
+                                                                                       queue:queue];
+        [self.connections addObject:connection];
+        [connection start];
+    }
+}
+
+- (void)connectionDidClose:(JRStandInHTTPConnection *)connection
+{
+    [self.connections removeObject:connection];
+}
+
+- (void)stop
+{
+    if (listenFd < 0) return;
+
+    dispatch_sync(queue, ^{
+        dispatch_source_cancel(acceptSource);
+#if !OS_OBJECT_USE_OBJC
+        dispatch_release(acceptSource);
+#endif
+        acceptSource = NULL;
+
+        for (JRStandInHTTPConnection *connection in [self.connections allObjects])
+            [connection close];
+
+        close(listenFd);
+        listenFd = -1;
+    });
+
+    self.port = 0;
+}
+
+- (NSURL *)baseURL
+{
+    if (listenFd < 0) return nil;
+
+    return [NSURL URLWithString:[NSString stringWithFormat:@"http://127.0.0.1:%u", (unsigned) self.port]];
+}
+@end
@@ -0,0 +1,110 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+/**
+ * @internal
+ * A canned response for every request whose path matches pathPattern, and how to misbehave while serving it.
+ */
+@interface JRStandInRoute : NSObject
+@property(nonatomic, copy) NSString *name;
+/** A regular expression searched for in the request's path */
+@property(nonatomic, copy) NSString *pathPattern;
+@property(nonatomic) NSInteger statusCode;
+@property(nonatomic, copy) NSDictionary *headers;
+@property(nonatomic, copy) NSData *body;
+/** How long to hold the response before starting to send it, plus up to latencyJitter more */
+@property(nonatomic) NSTimeInterval latency;
+@property(nonatomic) NSTimeInterval latencyJitter;
+/** When the body is a JSON object, a string of this many bytes is added to it under "standInPadding" */
+@property(nonatomic) NSUInteger paddingBytes;
+/** The first failFirstRequests requests fail, and after that every failEveryNthRequest'th one (0 for never) */
+@property(nonatomic) NSUInteger failFirstRequests;
+@property(nonatomic) NSUInteger failEveryNthRequest;
+/** The status of a failed request, with a Capture style error body, or 0 to drop the connection instead */
+@property(nonatomic) NSInteger failureStatusCode;
+
++ (JRStandInRoute *)routeWithName:(NSString *)name pathPattern:(NSString *)pathPattern JSONObject:(id)object;
+@end
+
+/**
+ * @internal
+ * What a front end should do with one request.
+ */
+@interface JRStandInResponse : NSObject
+@property(nonatomic, readonly) NSInteger statusCode;
+@property(nonatomic, readonly) NSDictionary *headers;
+@property(nonatomic, readonly) NSData *body;
+@property(nonatomic, readonly) NSTimeInterval delay;
+@property(nonatomic, readonly) BOOL dropsConnection;
+@property(nonatomic, readonly) NSString *routeName;
+@end
+
+/**
+ * @internal
+ * Stands in for the Capture and Engage servers so the networking paths can be load tested offline and repeatably.
+ * It holds an ordered table of routes (the first match wins) and a log of the requests it has answered; the
+ * front ends, JRStandInURLProtocol in process and JRStandInHTTPServer over loopback, ask it what to send back.
+ *
+ * +serverWithDefaultRoutes answers entity, entity.update, entity.replace, oauth/refresh_access_token, the other
+ * oauth/ calls, the flow download, and mobile_config_and_baseurl with responses recorded from a test application.
+ * Any path nothing matches gets a 404.
+ *
+ * Safe to use from any thread.
+ */
+@interface JRStandInServer : NSObject
++ (JRStandInServer *)serverWithDefaultRoutes;
+
+- (NSArray *)routes;
+- (JRStandInRoute *)routeNamed:(NSString *)name;
+
+/** Inserted ahead of the existing routes, so it can override them */
+- (void)addRoute:(JRStandInRoute *)route;
+- (void)removeAllRoutes;
+
+/**
+ * Changes routes by name. Each key of configuration is a route name, or "*" for every route, and each value a
+ * dictionary of route property names (latency, latencyJitter, statusCode, paddingBytes, failFirstRequests,
+ * failEveryNthRequest, failureStatusCode) to numbers.
+ */
+- (void)applyConfiguration:(NSDictionary *)configuration;
+
+/** Replaces the body of each route with the contents of <route name>.json in directory, if there is one */
+- (BOOL)loadRecordedResponsesFromDirectory:(NSString *)directory error:(NSError **)error;
+
+- (JRStandInResponse *)responseForMethod:(NSString *)method URL:(NSURL *)url body:(NSData *)body;
+
+/** One dictionary per answered request, oldest first, with its "method", "path", "route" and "bodyLength" */
+- (NSArray *)requestLog;
+- (NSUInteger)requestCountForRouteNamed:(NSString *)name;
+- (void)resetRequestLog;
+@end
@@ -0,0 +1,404 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRStandInServer.h"
+#include <dispatch/dispatch.h>
+
+@interface JRStandInRoute ()
+@property(nonatomic) NSUInteger requestCount;
+- (BOOL)matchesPath:(NSString *)path;
+- (BOOL)nextRequestFails;
+- (double)jitterFraction;
+- (NSData *)paddedBody;
+@end
+
+@implementation JRStandInRoute
+@synthesize name;
+@synthesize pathPattern;
+@synthesize statusCode;
+@synthesize headers;
+@synthesize body;
+@synthesize latency;
+@synthesize latencyJitter;
+@synthesize paddingBytes;
+@synthesize failFirstRequests;
+@synthesize failEveryNthRequest;
+@synthesize failureStatusCode;
+@synthesize requestCount;
+
++ (JRStandInRoute *)routeWithName:(NSString *)name pathPattern:(NSString *)pathPattern JSONObject:(id)object
+{
+    JRStandInRoute *route = [[JRStandInRoute alloc] init];
+    route.name = name;
+    route.pathPattern = pathPattern;
+    route.statusCode = 200;
+    route.failureStatusCode = 503;
+    route.headers = [NSDictionary dictionaryWithObjectsAndKeys:@"application/json", @"Content-Type", nil];
+    route.body = [NSJSONSerialization dataWithJSONObject:object options:0 error:nil];
+
+    return route;
+}
+
+- (BOOL)matchesPath:(NSString *)path
+{
+    return [path rangeOfString:self.pathPattern options:NSRegularExpressionSearch].location != NSNotFound;
+}
+
+/* Called once per matching request, so the failure schedule and jitter advance with the traffic */
+- (BOOL)nextRequestFails
+{
+    NSUInteger count = ++self.requestCount;
+
+    if (count <= self.failFirstRequests) return YES;
+    if (self.failEveryNthRequest && (count - self.failFirstRequests) % self.failEveryNthRequest == 0) return YES;
+
+    return NO;
+}
+
+/* Spread over [0, 1) but the same from run to run, so a load test with jitter can still be repeated exactly */
+- (double)jitterFraction
+{
+    return (double) ((self.requestCount * 2654435761u) % 1000) / 1000.0;
+}
+
+- (NSData *)paddedBody
+{
+    if (!self.paddingBytes || !self.body) return self.body;
+
+    id object = [NSJSONSerialization JSONObjectWithData:self.body options:NSJSONReadingMutableContainers error:nil];
+    if (![object isKindOfClass:[NSMutableDictionary class]]) return self.body;
+
+    NSMutableData *padding = [NSMutableData dataWithLength:self.paddingBytes];
+    memset([padding mutableBytes], 'x', self.paddingBytes);
+    [object setObject:[[NSString alloc] initWithData:padding encoding:NSASCIIStringEncoding] forKey:@"standInPadding"];
+
+    return [NSJSONSerialization dataWithJSONObject:object options:0 error:nil];
+}
+@end
+
+@interface JRStandInResponse ()
+@property(nonatomic, readwrite) NSInteger statusCode;
+@property(nonatomic, readwrite) NSDictionary *headers;
+@property(nonatomic, readwrite) NSData *body;
+@property(nonatomic, readwrite) NSTimeInterval delay;
+@property(nonatomic, readwrite) BOOL dropsConnection;
+@property(nonatomic, readwrite) NSString *routeName;
+@end
+
+@implementation JRStandInResponse
+@synthesize statusCode;
+@synthesize headers;
+@synthesize body;
+@synthesize delay;
+@synthesize dropsConnection;
+@synthesize routeName;
+@end
+
+@interface JRStandInServer ()
+@property(nonatomic, strong) NSMutableArray *mutableRoutes;
+@property(nonatomic, strong) NSMutableArray *mutableRequestLog;
+@end
+
+@implementation JRStandInServer
+{
+    dispatch_queue_t queue;
+}
+@synthesize mutableRoutes;
+@synthesize mutableRequestLog;
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        self.mutableRoutes = [NSMutableArray array];
+        self.mutableRequestLog = [NSMutableArray array];
+        queue = dispatch_queue_create("com.janrain.standin.server", DISPATCH_QUEUE_SERIAL);
+    }
+
+    return self;
+}
+
++ (NSDictionary *)recordedUser
+{
+    return [NSDictionary dictionaryWithObjectsAndKeys:
+                                 [NSNumber numberWithInt:1016], @"id",
+                                 @"8c6e4d2a-8f0f-4c1e-a3e5-5a0b7e3f9d21", @"uuid",
+                                 @"2013-05-02 18:12:55.531064 +0000", @"created",
+                                 @"2013-05-09 22:41:07.012346 +0000", @"lastUpdated",
+                                 @"standin@example.com", @"email",
+                                 @"2013-05-02 18:13:40 +0000", @"emailVerified",
+                                 @"Stand In", @"displayName",
+                                 @"Stand", @"givenName",
+                                 @"In", @"familyName",
+                                 @"1980-01-01", @"birthday",
+                                 [NSArray array], @"profiles",
+                                 [NSArray array], @"statuses",
+                                 [NSArray array], @"photos", nil];
+}
+
++ (NSDictionary *)recordedFlow
+{
+    NSDictionary *fields = [NSDictionary dictionaryWithObjectsAndKeys:
+            [NSDictionary dictionaryWithObjectsAndKeys:
+                    [NSArray arrayWithObjects:@"signInEmailAddress", @"currentPassword", nil], @"fields", nil],
+            @"signInForm",
+            [NSDictionary dictionaryWithObjectsAndKeys:@"email", @"schemaId", @"email", @"type", nil],
+            @"signInEmailAddress",
+            [NSDictionary dictionaryWithObjectsAndKeys:@"password", @"schemaId", @"password", @"type", nil],
+            @"currentPassword", nil];
+
+    return [NSDictionary dictionaryWithObjectsAndKeys:
+                                 @"standin", @"version",
+                                 fields, @"fields", nil];
+}
+
++ (NSDictionary *)recordedConfiguration
+{
+    NSDictionary *google = [NSDictionary dictionaryWithObjectsAndKeys:
+                                                 @"Google", @"friendly_name",
+                                                 @"/openid/start?openid_identifier=https%3A%2F%2Fwww.google.com%2Faccounts%2Fo8%2Fid",
+                                                 @"url",
+                                                 @"NO", @"requires_input", nil];
+    NSDictionary *facebook = [NSDictionary dictionaryWithObjectsAndKeys:
+                                                   @"Facebook", @"friendly_name",
+                                                   @"/facebook/start", @"url",
+                                                   @"NO", @"requires_input",
+                                                   [NSDictionary dictionary], @"social_sharing_properties", nil];
+
+    return [NSDictionary dictionaryWithObjectsAndKeys:
+                                 @"https://standin.rpxnow.com", @"baseurl",
+                                 [NSDictionary dictionaryWithObjectsAndKeys:google, @"google", facebook, @"facebook", nil],
+                                 @"provider_info",
+                                 [NSArray arrayWithObjects:@"google", @"facebook", nil], @"enabled_providers",
+                                 [NSArray arrayWithObjects:@"facebook", nil], @"social_providers",
+                                 @"NO", @"hide_tagline", nil];
+}
+
++ (JRStandInServer *)serverWithDefaultRoutes
+{
+    JRStandInServer *server = [[JRStandInServer alloc] init];
+    NSDictionary *ok = [NSDictionary dictionaryWithObjectsAndKeys:@"ok", @"stat", nil];
+
+    NSArray *routes = [NSArray arrayWithObjects:
+            [JRStandInRoute routeWithName:@"entity" pathPattern:@"/entity$"
+                               JSONObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                                @"ok", @"stat",
+                                                                [self recordedUser], @"result", nil]],
+            [JRStandInRoute routeWithName:@"entity.update" pathPattern:@"/entity\\.update$" JSONObject:ok],
+            [JRStandInRoute routeWithName:@"entity.replace" pathPattern:@"/entity\\.replace$" JSONObject:ok],
+            [JRStandInRoute routeWithName:@"oauth.refresh" pathPattern:@"/oauth/refresh_access_token$"
+                               JSONObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                                @"ok", @"stat",
+                                                                @"standin-refreshed-access-token", @"access_token",
+                                                                nil]],
+            [JRStandInRoute routeWithName:@"oauth" pathPattern:@"/oauth/"
+                               JSONObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                                @"ok", @"stat",
+                                                                @"standin-access-token", @"access_token",
+                                                                [NSNumber numberWithBool:NO], @"is_new",
+                                                                [self recordedUser], @"capture_user", nil]],
+            [JRStandInRoute routeWithName:@"flow" pathPattern:@"/widget_data/flows/"
+                               JSONObject:[self recordedFlow]],
+            [JRStandInRoute routeWithName:@"mobile_config_and_baseurl"
+                              pathPattern:@"/openid/mobile_config_and_baseurl$"
+                               JSONObject:[self recordedConfiguration]], nil];
+
+    JRStandInRoute *configuration = [routes lastObject];
+    configuration.headers = [NSDictionary dictionaryWithObjectsAndKeys:
+                                                  @"application/json", @"Content-Type",
+                                                  @"\"standin-config\"", @"ETag", nil];
+
+    [server.mutableRoutes addObjectsFromArray:routes];
+
+    return server;
+}
+
+- (NSArray *)routes
+{
+    __block NSArray *routes;
+    dispatch_sync(queue, ^{
+        routes = [self.mutableRoutes copy];
+    });
+
+    return routes;
+}
+
+- (JRStandInRoute *)routeNamed:(NSString *)name
+{
+    for (JRStandInRoute *route in [self routes])
+        if ([route.name isEqualToString:name]) return route;
+
+    return nil;
+}
+
+- (void)addRoute:(JRStandInRoute *)route
+{
+    dispatch_sync(queue, ^{
+        [self.mutableRoutes insertObject:route atIndex:0];
+    });
+}
+
+- (void)removeAllRoutes
+{
+    dispatch_sync(queue, ^{
+        [self.mutableRoutes removeAllObjects];
+    });
+}
+
+- (void)applyConfiguration:(NSDictionary *)configuration
+{
+    NSSet *settable = [NSSet setWithObjects:@"latency", @"latencyJitter", @"statusCode", @"paddingBytes",
+                                            @"failFirstRequests", @"failEveryNthRequest", @"failureStatusCode", nil];
+
+    dispatch_sync(queue, ^{
+        for (NSString *name in configuration)
+        {
+            NSDictionary *settings = [configuration objectForKey:name];
+            for (JRStandInRoute *route in self.mutableRoutes)
+            {
+                if (![name isEqualToString:@"*"] && ![name isEqualToString:route.name]) continue;
+
+                for (NSString *key in settings)
+                    if ([settable containsObject:key]) [route setValue:[settings objectForKey:key] forKey:key];
+            }
+        }
+    });
+}
+
+- (BOOL)loadRecordedResponsesFromDirectory:(NSString *)directory error:(NSError **)error
+{
+    for (JRStandInRoute *route in [self routes])
+    {
+        NSString *path = [directory stringByAppendingPathComponent:[route.name stringByAppendingPathExtension:@"json"]];
+        if (![[NSFileManager defaultManager] fileExistsAtPath:path]) continue;
+
+        NSData *recorded = [NSData dataWithContentsOfFile:path options:0 error:error];
+        if (!recorded) return NO;
+
+        dispatch_sync(queue, ^{
+            route.body = recorded;
+        });
+    }
+
+    return YES;
+}
+
+- (JRStandInResponse *)responseForMethod:(NSString *)method URL:(NSURL *)url body:(NSData *)body
+{
+    NSString *path = [url path] ? [url path] : @"/";
+    JRStandInResponse *response = [[JRStandInResponse alloc] init];
+
+    dispatch_sync(queue, ^{
+        JRStandInRoute *match = nil;
+        for (JRStandInRoute *route in self.mutableRoutes)
+        {
+            if ([route matchesPath:path])
+            {
+                match = route;
+                break;
+            }
+        }
+
+        [self.mutableRequestLog addObject:[NSDictionary dictionaryWithObjectsAndKeys:
+                                                                (method ? method : @"GET"), @"method",
+                                                                path, @"path",
+                                                                (match ? match.name : @""), @"route",
+                                                                [NSNumber numberWithUnsignedInteger:[body length]],
+                                                                @"bodyLength", nil]];
+
+        if (!match)
+        {
+            response.statusCode = 404;
+            response.headers = [NSDictionary dictionaryWithObjectsAndKeys:@"application/json", @"Content-Type", nil];
+            response.body = [NSJSONSerialization dataWithJSONObject:
+                    [NSDictionary dictionaryWithObjectsAndKeys:
+                                          @"error", @"stat",
+                                          [NSNumber numberWithInt:404], @"code",
+                                          @"not_found", @"error",
+                                          [NSString stringWithFormat:@"no stand-in route for %@", path],
+                                          @"error_description", nil] options:0 error:nil];
+            return;
+        }
+
+        response.routeName = match.name;
+        BOOL fails = [match nextRequestFails];
+        response.delay = match.latency + match.latencyJitter * [match jitterFraction];
+        response.headers = match.headers;
+
+        if (fails)
+        {
+            response.dropsConnection = (match.failureStatusCode == 0);
+            response.statusCode = match.failureStatusCode;
+            response.body = [NSJSONSerialization dataWithJSONObject:
+                    [NSDictionary dictionaryWithObjectsAndKeys:
+                                          @"error", @"stat",
+                                          [NSNumber numberWithInteger:match.failureStatusCode], @"code",
+                                          @"stand_in_failure", @"error",
+                                          @"failure injected by the stand-in server", @"error_description", nil]
+                                                            options:0 error:nil];
+            return;
+        }
+
+        response.statusCode = match.statusCode;
+        response.body = [match paddedBody];
+    });
+
+    return response;
+}
+
+- (NSArray *)requestLog
+{
+    __block NSArray *log;
+    dispatch_sync(queue, ^{
+        log = [self.mutableRequestLog copy];
+    });
+
+    return log;
+}
+
+- (NSUInteger)requestCountForRouteNamed:(NSString *)name
+{
+    NSUInteger count = 0;
+    for (NSDictionary *entry in [self requestLog])
+        if ([[entry objectForKey:@"route"] isEqualToString:name]) count++;
+
+    return count;
+}
+
+- (void)resetRequestLog
+{
+    dispatch_sync(queue, ^{
+        [self.mutableRequestLog removeAllObjects];
+        for (JRStandInRoute *route in self.mutableRoutes)
+            route.requestCount = 0;
+    });
+}
+@end
@@ -0,0 +1,54 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import <Foundation/Foundation.h>
+
+@class JRStandInServer;
+
+/**
+ * @internal
+ * Answers http and https requests from a JRStandInServer, in process, so the library can be pointed at the stand-in
+ * without changing any of its URLs. With a forwardingBaseURL set the requests are sent on, over a real socket, to a
+ * JRStandInHTTPServer instead; the scheme, host and port are swapped out and the path and query kept.
+ *
+ * Plug it in with +[JRConnectionManager setSessionConfiguration:] and +sessionConfiguration, or register it with
+ * NSURLProtocol for anything not on the manager's session. Setting the server back to nil stops the interception.
+ */
+@interface JRStandInURLProtocol : NSURLProtocol
++ (void)setServer:(JRStandInServer *)server;
++ (JRStandInServer *)server;
+
++ (void)setForwardingBaseURL:(NSURL *)baseURL;
++ (NSURL *)forwardingBaseURL;
+
+/** An ephemeral configuration whose only protocol class is this one */
++ (NSURLSessionConfiguration *)sessionConfiguration;
+@end
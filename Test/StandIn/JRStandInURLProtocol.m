@@ -0,0 +1,256 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#import "JRStandInURLProtocol.h"
+#import "JRStandInServer.h"
+
+static NSString *const JRStandInForwardedKey = @"JRStandInForwarded";
+
+static JRStandInServer *standInServer = nil;
+static NSURL *standInForwardingBaseURL = nil;
+
+@interface JRStandInURLProtocol ()
+@property(nonatomic, strong) NSURLSessionDataTask *forwardedTask;
+@property(nonatomic) BOOL stopped;
+@end
+
+@implementation JRStandInURLProtocol
+{
+    CFRunLoopRef clientRunLoop;
+}
+@synthesize forwardedTask;
+@synthesize stopped;
+
+/* The settings are read from whatever thread the session asks canInitWithRequest: on */
++ (dispatch_queue_t)settingsQueue
+{
+    static dispatch_queue_t queue;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        queue = dispatch_queue_create("com.janrain.standin.protocol", DISPATCH_QUEUE_SERIAL);
+    });
+
+    return queue;
+}
+
++ (void)setServer:(JRStandInServer *)server
+{
+    dispatch_sync([self settingsQueue], ^{
+        standInServer = server;
+    });
+}
+
++ (JRStandInServer *)server
+{
+    __block JRStandInServer *server;
+    dispatch_sync([self settingsQueue], ^{
+        server = standInServer;
+    });
+
+    return server;
+}
+
++ (void)setForwardingBaseURL:(NSURL *)baseURL
+{
+    dispatch_sync([self settingsQueue], ^{
+        standInForwardingBaseURL = [baseURL copy];
+    });
+}
+
++ (NSURL *)forwardingBaseURL
+{
+    __block NSURL *baseURL;
+    dispatch_sync([self settingsQueue], ^{
+        baseURL = standInForwardingBaseURL;
+    });
+
+    return baseURL;
+}
+
++ (NSURLSessionConfiguration *)sessionConfiguration
+{
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = [NSArray arrayWithObject:self];
+
+    return configuration;
+}
+
+/* Forwarded requests go out on a session of their own, which this protocol stays out of */
++ (NSURLSession *)forwardingSession
+{
+    static NSURLSession *session = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+        configuration.protocolClasses = [NSArray array];
+        session = [NSURLSession sessionWithConfiguration:configuration];
+    });
+
+    return session;
+}
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request
+{
+    NSString *scheme = [[[request URL] scheme] lowercaseString];
+    if (![scheme isEqualToString:@"http"] && ![scheme isEqualToString:@"https"]) return NO;
+    if ([NSURLProtocol propertyForKey:JRStandInForwardedKey inRequest:request]) return NO;
+
+    return [self server] != nil;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request
+{
+    return request;
+}
+
+/* Sessions hand protocols the body as a stream, whatever the caller set */
++ (NSData *)bodyOfRequest:(NSURLRequest *)request
+{
+    if ([request HTTPBody] || ![request HTTPBodyStream]) return [request HTTPBody];
+
+    NSInputStream *stream = [request HTTPBodyStream];
+    NSMutableData *body = [NSMutableData data];
+    uint8_t buffer[4096];
+
+    [stream open];
+    NSInteger read;
+    while ((read = [stream read:buffer maxLength:sizeof(buffer)]) > 0)
+        [body appendBytes:buffer length:(NSUInteger) read];
+    [stream close];
+
+    return body;
+}
+
+/* Client callbacks have to come back on the thread that started the load */
+- (void)performOnClientThread:(void (^)(void))block
+{
+    CFRunLoopPerformBlock(clientRunLoop, kCFRunLoopCommonModes, ^{
+        if (!self.stopped) block();
+    });
+    CFRunLoopWakeUp(clientRunLoop);
+}
+
+- (void)startLoading
+{
+    clientRunLoop = (CFRunLoopRef) CFRetain(CFRunLoopGetCurrent());
+
+    NSURL *forwardingBaseURL = [JRStandInURLProtocol forwardingBaseURL];
+    if (forwardingBaseURL)
+    {
+        [self forwardToBaseURL:forwardingBaseURL];
+        return;
+    }
+
+    NSURLRequest *request = [self request];
+    JRStandInResponse *response = [[JRStandInURLProtocol server]
+            responseForMethod:[request HTTPMethod] URL:[request URL] body:[JRStandInURLProtocol bodyOfRequest:request]];
+
+    dispatch_time_t when = dispatch_time(DISPATCH_TIME_NOW, (int64_t) (response.delay * NSEC_PER_SEC));
+    dispatch_after(when, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        [self performOnClientThread:^{
+            [self deliverResponse:response];
+        }];
+    });
+}
+
+- (void)deliverResponse:(JRStandInResponse *)response
+{
+    id <NSURLProtocolClient> client = [self client];
+
+    if (response.dropsConnection)
+    {
+        [client URLProtocol:self didFailWithError:[NSError errorWithDomain:NSURLErrorDomain
+                                                                      code:NSURLErrorNetworkConnectionLost
+                                                                  userInfo:nil]];
+        return;
+    }
+
+    NSHTTPURLResponse *httpResponse = [[NSHTTPURLResponse alloc] initWithURL:[[self request] URL]
+                                                                  statusCode:response.statusCode
+                                                                 HTTPVersion:@"HTTP/1.1"
+                                                                headerFields:response.headers];
+
+    [client URLProtocol:self didReceiveResponse:httpResponse cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    if ([response.body length]) [client URLProtocol:self didLoadData:response.body];
+    [client URLProtocolDidFinishLoading:self];
+}
+
+- (void)forwardToBaseURL:(NSURL *)baseURL
+{
+    NSURLComponents *components = [NSURLComponents componentsWithURL:[[self request] URL] resolvingAgainstBaseURL:YES];
+    components.scheme = [baseURL scheme];
+    components.host = [baseURL host];
+    components.port = [baseURL port];
+
+    NSMutableURLRequest *forwarded = [[self request] mutableCopy];
+    [forwarded setURL:[components URL]];
+    [forwarded setHTTPBody:[JRStandInURLProtocol bodyOfRequest:[self request]]];
+    [NSURLProtocol setProperty:[NSNumber numberWithBool:YES] forKey:JRStandInForwardedKey inRequest:forwarded];
+
+    self.forwardedTask = [[JRStandInURLProtocol forwardingSession] dataTaskWithRequest:forwarded
+            completionHandler:^(NSData *data, NSURLResponse *response, NSError *error)
+            {
+                [self performOnClientThread:^{
+                    id <NSURLProtocolClient> client = [self client];
+                    if (error)
+                    {
+                        [client URLProtocol:self didFailWithError:error];
+                        return;
+                    }
+
+                    /* Reported against the URL the library asked for, not the loopback one */
+                    NSHTTPURLResponse *forwardedResponse = (NSHTTPURLResponse *) response;
+                    NSHTTPURLResponse *httpResponse =
+                            [[NSHTTPURLResponse alloc] initWithURL:[[self request] URL]
+                                                        statusCode:[forwardedResponse statusCode]
+                                                       HTTPVersion:@"HTTP/1.1"
+                                                      headerFields:[forwardedResponse allHeaderFields]];
+
+                    [client URLProtocol:self didReceiveResponse:httpResponse
+                     cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+                    if ([data length]) [client URLProtocol:self didLoadData:data];
+                    [client URLProtocolDidFinishLoading:self];
+                }];
+            }];
+    [self.forwardedTask resume];
+}
+
+- (void)stopLoading
+{
+    self.stopped = YES;
+    [self.forwardedTask cancel];
+}
+
+- (void)dealloc
+{
+    if (clientRunLoop) CFRelease(clientRunLoop);
+}
+@end
@@ -0,0 +1,120 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ Copyright (c) 2013, Janrain, Inc.
+
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+ * Neither the name of the Janrain, Inc. nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Runs the stand-in on loopback until killed, for load tests driven from outside the app. Prints the base URL it
+   is listening on as the first line of output; see README.md. */
+
+#import <Foundation/Foundation.h>
+#import "JRStandInServer.h"
+#import "JRStandInHTTPServer.h"
+#include <dispatch/dispatch.h>
+
+static void JRPrintUsage(void)
+{
+    fprintf(stderr, "usage: JRStandInServer [--port n] [--config routes.json] [--responses dir] [--latency seconds]"
+                    " [--padding bytes] [--fail-every n] [--failure-status code]\n");
+}
+
+int main(int argc, const char *argv[])
+{
+    @autoreleasepool
+    {
+        NSArray *arguments = [[NSProcessInfo processInfo] arguments];
+        JRStandInServer *server = [JRStandInServer serverWithDefaultRoutes];
+        NSMutableDictionary *everyRoute = [NSMutableDictionary dictionary];
+        uint16_t port = 0;
+
+        for (NSUInteger i = 1; i < [arguments count]; i += 2)
+        {
+            NSString *flag = [arguments objectAtIndex:i];
+            NSString *value = i + 1 < [arguments count] ? [arguments objectAtIndex:i + 1] : nil;
+            if (!value)
+            {
+                JRPrintUsage();
+                return 2;
+            }
+
+            if ([flag isEqualToString:@"--port"])
+            {
+                port = (uint16_t) [value integerValue];
+            }
+            else if ([flag isEqualToString:@"--config"])
+            {
+                NSData *data = [NSData dataWithContentsOfFile:value];
+                id configuration = data ? [NSJSONSerialization JSONObjectWithData:data options:0 error:nil] : nil;
+                if (![configuration isKindOfClass:[NSDictionary class]])
+                {
+                    fprintf(stderr, "could not read a route configuration from %s\n", [value UTF8String]);
+                    return 1;
+                }
+                [server applyConfiguration:configuration];
+            }
+            else if ([flag isEqualToString:@"--responses"])
+            {
+                NSError *error = nil;
+                if (![server loadRecordedResponsesFromDirectory:value error:&error])
+                {
+                    fprintf(stderr, "%s\n", [[error description] UTF8String]);
+                    return 1;
+                }
+            }
+            else if ([flag isEqualToString:@"--latency"])
+                [everyRoute setObject:[NSNumber numberWithDouble:[value doubleValue]] forKey:@"latency"];
+            else if ([flag isEqualToString:@"--padding"])
+                [everyRoute setObject:[NSNumber numberWithInteger:[value integerValue]] forKey:@"paddingBytes"];
+            else if ([flag isEqualToString:@"--fail-every"])
+                [everyRoute setObject:[NSNumber numberWithInteger:[value integerValue]] forKey:@"failEveryNthRequest"];
+            else if ([flag isEqualToString:@"--failure-status"])
+                [everyRoute setObject:[NSNumber numberWithInteger:[value integerValue]] forKey:@"failureStatusCode"];
+            else
+            {
+                JRPrintUsage();
+                return 2;
+            }
+        }
+
+        if ([everyRoute count])
+            [server applyConfiguration:[NSDictionary dictionaryWithObject:everyRoute forKey:@"*"]];
+
+        JRStandInHTTPServer *httpServer = [[JRStandInHTTPServer alloc] initWithServer:server];
+        NSError *error = nil;
+        if (![httpServer startOnPort:port error:&error])
+        {
+            fprintf(stderr, "could not listen on port %u: %s\n", (unsigned) port, [[error description] UTF8String]);
+            return 1;
+        }
+
+        printf("%s\n", [[[httpServer baseURL] absoluteString] UTF8String]);
+        fflush(stdout);
+
+        dispatch_main();
+    }
+}